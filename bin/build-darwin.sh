@@ -82,7 +82,7 @@ fi
 
 
 # Build other dependencies
-brew install flex bison google-benchmark zlib
+brew install flex bison google-benchmark zlib zstd lz4
 
 # Determine paths based on Intel vs Apple Silicon CPU
 if [ "$(uname -p)" == 'arm' ]; then
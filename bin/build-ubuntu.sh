@@ -20,7 +20,9 @@ sudo apt install -y --no-install-recommends \
     libfl-dev \
     libbenchmark-dev \
     libtool \
-    libz-dev
+    libz-dev \
+    libzstd-dev \
+    liblz4-dev
 PREREQUISITES
 
 # :: Parse and validate arguments :::::::::::::::::::::::::::::::::::::::::::::
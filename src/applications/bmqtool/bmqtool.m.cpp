@@ -260,6 +260,18 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "use custom event handler threads",
          balcl::TypeInfo(&params.noSessionEventHandler()),
          balcl::OccurrenceInfo::e_OPTIONAL},
+        {"busypollus",
+         "busyPollUs",
+         "microseconds during which event handler threads busy-poll for "
+         "new events before blocking (lower latency, higher CPU usage)",
+         balcl::TypeInfo(&params.busyPollUs()),
+         balcl::OccurrenceInfo::e_OPTIONAL},
+        {"inlinedelivery",
+         "inlineDelivery",
+         "deliver message events from the SDK internal thread, bypassing "
+         "the event queue",
+         balcl::TypeInfo(&params.inlineDelivery()),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"s|storage",
          "storage",
          "path to storage files to open",
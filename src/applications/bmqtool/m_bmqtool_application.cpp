@@ -578,7 +578,10 @@ int Application::initialize()
     bmqt::SessionOptions options;
     options.setBrokerUri(d_parameters_p->broker())
         .setNumProcessingThreads(d_parameters_p->numProcessingThreads())
-        .configureEventQueue(1000, 10 * 1000);
+        .configureEventQueue(1000, 10 * 1000)
+        .setEventQueueBusyPollDuration(bsls::TimeInterval().addMicroseconds(
+            d_parameters_p->busyPollUs()))
+        .setInlineMessageEventDelivery(d_parameters_p->inlineDelivery());
 
     // Create the session
     if (d_parameters_p->noSessionEventHandler()) {
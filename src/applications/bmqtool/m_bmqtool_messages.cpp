@@ -4211,6 +4211,10 @@ const char
     CommandLineParameters::DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[] =
         "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_BUSY_POLL_US = 0;
+
+const bool CommandLineParameters::DEFAULT_INITIALIZER_INLINE_DELIVERY = false;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4336,14 +4340,24 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_BUSY_POLL_US,
+     "busyPollUs",
+     sizeof("busyPollUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_INLINE_DELIVERY,
+     "inlineDelivery",
+     sizeof("inlineDelivery") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 25; ++i) {
+    for (int i = 0; i < 27; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4408,6 +4422,10 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_BUSY_POLL_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUSY_POLL_US];
+    case ATTRIBUTE_ID_INLINE_DELIVERY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INLINE_DELIVERY];
     default: return 0;
     }
 }
@@ -4437,10 +4455,12 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_postInterval(DEFAULT_INITIALIZER_POST_INTERVAL)
 , d_threads(DEFAULT_INITIALIZER_THREADS)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
+, d_busyPollUs(DEFAULT_INITIALIZER_BUSY_POLL_US)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
 , d_noSessionEventHandler(DEFAULT_INITIALIZER_NO_SESSION_EVENT_HANDLER)
+, d_inlineDelivery(DEFAULT_INITIALIZER_INLINE_DELIVERY)
 {
 }
 
@@ -4469,10 +4489,12 @@ CommandLineParameters::CommandLineParameters(
 , d_postInterval(original.d_postInterval)
 , d_threads(original.d_threads)
 , d_shutdownGrace(original.d_shutdownGrace)
+, d_busyPollUs(original.d_busyPollUs)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
 , d_noSessionEventHandler(original.d_noSessionEventHandler)
+, d_inlineDelivery(original.d_inlineDelivery)
 {
 }
 
@@ -4501,10 +4523,12 @@ CommandLineParameters::CommandLineParameters(
   d_postInterval(bsl::move(original.d_postInterval)),
   d_threads(bsl::move(original.d_threads)),
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
+  d_busyPollUs(bsl::move(original.d_busyPollUs)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
-  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+  d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler)),
+  d_inlineDelivery(bsl::move(original.d_inlineDelivery))
 {
 }
 
@@ -4532,10 +4556,12 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_postInterval(bsl::move(original.d_postInterval))
 , d_threads(bsl::move(original.d_threads))
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
+, d_busyPollUs(bsl::move(original.d_busyPollUs))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
 , d_noSessionEventHandler(bsl::move(original.d_noSessionEventHandler))
+, d_inlineDelivery(bsl::move(original.d_inlineDelivery))
 {
 }
 #endif
@@ -4575,6 +4601,8 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_sequentialMessagePattern = rhs.d_sequentialMessagePattern;
         d_messageProperties        = rhs.d_messageProperties;
         d_subscriptions            = rhs.d_subscriptions;
+        d_busyPollUs               = rhs.d_busyPollUs;
+        d_inlineDelivery           = rhs.d_inlineDelivery;
     }
 
     return *this;
@@ -4611,6 +4639,8 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_sequentialMessagePattern = bsl::move(rhs.d_sequentialMessagePattern);
         d_messageProperties        = bsl::move(rhs.d_messageProperties);
         d_subscriptions            = bsl::move(rhs.d_subscriptions);
+        d_busyPollUs               = bsl::move(rhs.d_busyPollUs);
+        d_inlineDelivery           = bsl::move(rhs.d_inlineDelivery);
     }
 
     return *this;
@@ -4645,6 +4675,8 @@ void CommandLineParameters::reset()
         DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN;
     bdlat_ValueTypeFunctions::reset(&d_messageProperties);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_busyPollUs     = DEFAULT_INITIALIZER_BUSY_POLL_US;
+    d_inlineDelivery = DEFAULT_INITIALIZER_INLINE_DELIVERY;
 }
 
 // ACCESSORS
@@ -4682,6 +4714,8 @@ bsl::ostream& CommandLineParameters::print(bsl::ostream& stream,
                            this->sequentialMessagePattern());
     printer.printAttribute("messageProperties", this->messageProperties());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("busyPollUs", this->busyPollUs());
+    printer.printAttribute("inlineDelivery", this->inlineDelivery());
     printer.end();
     return stream;
 }
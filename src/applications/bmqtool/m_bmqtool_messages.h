@@ -4721,10 +4721,12 @@ class CommandLineParameters {
     int                          d_postInterval;
     int                          d_threads;
     int                          d_shutdownGrace;
+    int                          d_busyPollUs;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
     bool                         d_noSessionEventHandler;
+    bool                         d_inlineDelivery;
 
   public:
     // TYPES
@@ -4753,10 +4755,12 @@ class CommandLineParameters {
         ATTRIBUTE_ID_LOG                        = 21,
         ATTRIBUTE_ID_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_ID_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_ID_BUSY_POLL_US               = 25,
+        ATTRIBUTE_ID_INLINE_DELIVERY            = 26
     };
 
-    enum { NUM_ATTRIBUTES = 25 };
+    enum { NUM_ATTRIBUTES = 27 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -4783,7 +4787,9 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_LOG                        = 21,
         ATTRIBUTE_INDEX_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_INDEX_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_INDEX_BUSY_POLL_US               = 25,
+        ATTRIBUTE_INDEX_INLINE_DELIVERY            = 26
     };
 
     // CONSTANTS
@@ -4835,6 +4841,10 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[];
 
+    static const int DEFAULT_INITIALIZER_BUSY_POLL_US;
+
+    static const bool DEFAULT_INITIALIZER_INLINE_DELIVERY;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5030,6 +5040,14 @@ class CommandLineParameters {
     /// this object.
     bsl::vector<Subscription>& subscriptions();
 
+    /// Return a reference to the modifiable "BusyPollUs" attribute of this
+    /// object.
+    int& busyPollUs();
+
+    /// Return a reference to the modifiable "InlineDelivery" attribute of
+    /// this object.
+    bool& inlineDelivery();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5173,6 +5191,14 @@ class CommandLineParameters {
     /// Return a reference to the non-modifiable "Subscriptions" attribute
     /// of this object.
     const bsl::vector<Subscription>& subscriptions() const;
+
+    /// Return a reference to the non-modifiable "BusyPollUs" attribute of
+    /// this object.
+    int busyPollUs() const;
+
+    /// Return a reference to the non-modifiable "InlineDelivery" attribute
+    /// of this object.
+    bool inlineDelivery() const;
 };
 
 // FREE OPERATORS
@@ -9640,6 +9666,18 @@ int CommandLineParameters::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_busyPollUs,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUSY_POLL_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_inlineDelivery,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INLINE_DELIVERY]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -9757,6 +9795,15 @@ int CommandLineParameters::manipulateAttribute(MANIPULATOR& manipulator,
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_BUSY_POLL_US: {
+        return manipulator(&d_busyPollUs,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUSY_POLL_US]);
+    }
+    case ATTRIBUTE_ID_INLINE_DELIVERY: {
+        return manipulator(
+            &d_inlineDelivery,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INLINE_DELIVERY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -9902,6 +9949,16 @@ inline bsl::vector<Subscription>& CommandLineParameters::subscriptions()
     return d_subscriptions;
 }
 
+inline int& CommandLineParameters::busyPollUs()
+{
+    return d_busyPollUs;
+}
+
+inline bool& CommandLineParameters::inlineDelivery()
+{
+    return d_inlineDelivery;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
@@ -10052,6 +10109,18 @@ int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_busyPollUs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUSY_POLL_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_inlineDelivery,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INLINE_DELIVERY]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -10162,6 +10231,14 @@ int CommandLineParameters::accessAttribute(ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_BUSY_POLL_US: {
+        return accessor(d_busyPollUs,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUSY_POLL_US]);
+    }
+    case ATTRIBUTE_ID_INLINE_DELIVERY: {
+        return accessor(d_inlineDelivery,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INLINE_DELIVERY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -10310,6 +10387,16 @@ CommandLineParameters::subscriptions() const
     return d_subscriptions;
 }
 
+inline int CommandLineParameters::busyPollUs() const
+{
+    return d_busyPollUs;
+}
+
+inline bool CommandLineParameters::inlineDelivery() const
+{
+    return d_inlineDelivery;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                         hashAlg,
                 const m_bmqtool::CommandLineParameters& object)
@@ -10342,6 +10429,8 @@ void hashAppend(HASH_ALGORITHM&                         hashAlg,
     hashAppend(hashAlg, object.sequentialMessagePattern());
     hashAppend(hashAlg, object.messageProperties());
     hashAppend(hashAlg, object.subscriptions());
+    hashAppend(hashAlg, object.busyPollUs());
+    hashAppend(hashAlg, object.inlineDelivery());
 }
 
 // --------------------
@@ -11657,7 +11746,9 @@ inline bool m_bmqtool::operator==(const m_bmqtool::CommandLineParameters& lhs,
            lhs.storage() == rhs.storage() && lhs.log() == rhs.log() &&
            lhs.sequentialMessagePattern() == rhs.sequentialMessagePattern() &&
            lhs.messageProperties() == rhs.messageProperties() &&
-           lhs.subscriptions() == rhs.subscriptions();
+           lhs.subscriptions() == rhs.subscriptions() &&
+           lhs.busyPollUs() == rhs.busyPollUs() &&
+           lhs.inlineDelivery() == rhs.inlineDelivery();
 }
 
 inline bool m_bmqtool::operator!=(const m_bmqtool::CommandLineParameters& lhs,
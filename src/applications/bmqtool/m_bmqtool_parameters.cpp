@@ -302,6 +302,8 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("numProcessingThreads", numProcessingThreads());
     printer.printAttribute("shutdownGrace", shutdownGrace());
     printer.printAttribute("noSessionEventHandler", noSessionEventHandler());
+    printer.printAttribute("busyPollUs", busyPollUs());
+    printer.printAttribute("inlineDelivery", inlineDelivery());
     printer.printAttribute("sequentialMessagePattern",
                            d_sequentialMessagePattern);
     printer.printAttribute("messageProperties", d_messageProperties);
@@ -386,6 +388,8 @@ bool Parameters::from(bsl::ostream&                stream,
     setMemoryDebug(params.memoryDebug());
     setNumProcessingThreads(params.threads());
     setNoSessionEventHandler(params.noSessionEventHandler());
+    setBusyPollUs(params.busyPollUs());
+    setInlineDelivery(params.inlineDelivery());
     setLatency(paramLatency);
     setLatencyReportPath(params.latencyReport());
     setDumpMsg(params.dumpMsg());
@@ -433,6 +437,13 @@ bool Parameters::validate(bsl::string* error)
         ss << "NoSessionEventHandler is only to use in interactive or storage "
            << "mode\n";
     }
+    if (d_busyPollUs < 0) {
+        ss << "BusyPollUs must be non-negative\n";
+    }
+    if (d_noSessionEventHandler && (d_busyPollUs != 0 || d_inlineDelivery)) {
+        ss << "BusyPollUs and InlineDelivery require the EventHandler "
+           << "callback\n";
+    }
 
     error->assign(ss.str().data(), ss.str().length());
     return error->empty();
@@ -260,6 +260,17 @@ class Parameters {
     // False to use the EventHandler callback,
     // true to use custom event handler threads.
 
+    int d_busyPollUs;
+    // How many microseconds the event handler
+    // threads busy-poll the event queue before
+    // blocking on it (0 to block immediately).
+
+    bool d_inlineDelivery;
+    // True to deliver message events to the
+    // EventHandler callback from the SDK
+    // internal thread, bypassing the event
+    // queue.
+
     bool d_memoryDebug;
     // Should we use a testAllocator
     // Default: false
@@ -295,6 +306,8 @@ class Parameters {
     Parameters& setMemoryDebug(bool value);
     Parameters& setNumProcessingThreads(int value);
     Parameters& setNoSessionEventHandler(bool value);
+    Parameters& setBusyPollUs(int value);
+    Parameters& setInlineDelivery(bool value);
     Parameters& setStoragePath(const bsl::string& value);
     Parameters& setLogFilePath(const bsl::string& value);
     Parameters& setSequentialMessagePattern(const bsl::string& value);
@@ -357,6 +370,8 @@ class Parameters {
     int                                 numProcessingThreads() const;
     int                                 shutdownGrace() const;
     bool                                noSessionEventHandler() const;
+    int                                 busyPollUs() const;
+    bool                                inlineDelivery() const;
     const bsl::vector<MessageProperty>& messageProperties() const;
 
     /// Return the corresponding data member value.
@@ -501,6 +516,18 @@ inline Parameters& Parameters::setNoSessionEventHandler(bool value)
     return *this;
 }
 
+inline Parameters& Parameters::setBusyPollUs(int value)
+{
+    d_busyPollUs = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setInlineDelivery(bool value)
+{
+    d_inlineDelivery = value;
+    return *this;
+}
+
 inline Parameters& Parameters::setStoragePath(const bsl::string& value)
 {
     bsl::string dataExt(mqbs::FileStoreProtocol::k_DATA_FILE_EXTENSION);
@@ -694,6 +721,16 @@ inline bool Parameters::noSessionEventHandler() const
     return d_noSessionEventHandler;
 }
 
+inline int Parameters::busyPollUs() const
+{
+    return d_busyPollUs;
+}
+
+inline bool Parameters::inlineDelivery() const
+{
+    return d_inlineDelivery;
+}
+
 inline const bsl::vector<MessageProperty>&
 Parameters::messageProperties() const
 {
@@ -171,6 +171,21 @@ Message& Message::setCompressionAlgorithmType(
     return *this;
 }
 
+Message& Message::setCompressionLevel(int level)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isInitialized() &&
+                     "message is invalid: use "
+                     "'MessageEventBuilder::startMessage' to get one");
+    BSLS_ASSERT_SAFE(d_impl.d_event_p->putEventBuilder() &&
+                     "message not editable");
+
+    bmqp::PutEventBuilder* builder = d_impl.d_event_p->putEventBuilder();
+    builder->setCompressionLevel(level);
+
+    return *this;
+}
+
 #ifdef BMQ_ENABLE_MSG_GROUPID
 Message& Message::setGroupId(const bsl::string& groupId)
 {
@@ -546,6 +561,70 @@ int Message::loadProperties(MessageProperties* buffer) const
     return rc;
 }
 
+int Message::loadProperties(MessagePropertiesView* view) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isInitialized());
+    BSLS_ASSERT_SAFE(view);
+
+    enum RcEnum { rc_SUCCESS = 0, rc_IMPLICIT_APP_DATA = -1 };
+
+    bmqp::MessagePropertiesView* viewImpl =
+        *reinterpret_cast<bmqp::MessagePropertiesView**>(view);
+
+    const bmqp::Event& rawEvent = d_impl.d_event_p->rawEvent();
+    int                rc       = rc_SUCCESS;
+
+    viewImpl->clear();
+
+    if (rawEvent.isPushEvent()) {
+        const bmqp::PushMessageIterator& it =
+            *d_impl.d_event_p->pushMessageIterator();
+
+        if (it.isApplicationDataImplicit()) {
+            return rc_IMPLICIT_APP_DATA;  // RETURN
+        }
+
+        if (!it.hasMessageProperties()) {
+            return rc_SUCCESS;  // RETURN
+        }
+
+        bsl::shared_ptr<bmqimp::Queue>& queue =
+            reinterpret_cast<bsl::shared_ptr<bmqimp::Queue>&>(
+                d_impl.d_queueId);
+
+        if (queue->id() == bmqimp::Queue::k_INVALID_QUEUE_ID) {
+            queue = d_impl.d_event_p->lookupQueue();
+        }
+        BSLS_ASSERT_SAFE(queue);
+
+        rc = queue->schemaLearner().read(queue->schemaLearnerContext(),
+                                         viewImpl,
+                                         bmqp::MessagePropertiesInfo(
+                                             it.header()),
+                                         it.applicationData());
+    }
+    else if (rawEvent.isPutEvent()) {
+        const bmqp::PutMessageIterator& it =
+            *d_impl.d_event_p->putMessageIterator();
+
+        if (!it.hasMessageProperties()) {
+            return rc_SUCCESS;  // RETURN
+        }
+
+        // Schema learning for PUSHs only, not for PUTs assuming 'Message'
+        // builds PUTs and receives PUSHs.
+        rc = viewImpl->reset(
+            &it.applicationData(),
+            bmqp::MessagePropertiesInfo(it.header()).isExtended());
+    }
+    else {
+        BSLS_ASSERT_OPT(false && "Invalid raw event type");
+    }
+
+    return rc;
+}
+
 bsl::ostream&
 Message::print(bsl::ostream& stream, int level, int spacesPerLevel) const
 {
@@ -86,6 +86,7 @@ namespace bmqa {
 
 // FORWARD DECLARATION
 class MessageProperties;
+class MessagePropertiesView;
 
 // ==================
 // struct MessageImpl
@@ -263,10 +264,20 @@ class Message {
 
     /// Set the Compression algorithm type of the current message to the
     /// specified `value` and return a reference offering modifiable access
-    /// to this object.
+    /// to this object.  Note that the message is compressed with `e_ZLIB`,
+    /// at its default level, instead if the broker does not support
+    /// `value`, as is the case of the brokers predating `e_ZSTD` and `e_LZ4`.
     Message&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
 
+    /// Set the compression level used with the compression algorithm of
+    /// the current message to the specified `level` and return a reference
+    /// offering modifiable access to this object.  The meaning and valid
+    /// range of `level` depend on the compression algorithm (see
+    /// `bmqp::Compression`); if not set, the algorithm's default level is
+    /// used.  The level is ignored if the message is not compressed.
+    Message& setCompressionLevel(int level);
+
 #ifdef BMQ_ENABLE_MSG_GROUPID
     /// Set Group Id of this message to the specified `groupId`.  The
     /// `groupId` must be a null-terminated string with up to
@@ -391,6 +402,20 @@ class Message {
     /// method multiple times on a message.
     int loadProperties(MessageProperties* buffer) const;
 
+    /// Load into the specified `view` a view on the properties associated
+    /// with this message.  Return zero on success, and a non-zero value
+    /// otherwise.  Behavior is undefined unless this instance represents a
+    /// `PUT` or a `PUSH` message, and unless `view` is non-null.  Unlike
+    /// the overload above, the properties are neither decoded nor copied:
+    /// each property is read from the message when accessed through the
+    /// `view`, which makes this overload more efficient when only a few of
+    /// the properties are read.  Note that if there are no properties
+    /// associated with this message, zero will be returned and the `view`
+    /// will be empty.  Also note that the `view` refers to the current
+    /// message of the iterator this message was obtained from, and must not
+    /// be used once that iterator advances to the next message.
+    int loadProperties(MessagePropertiesView* view) const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
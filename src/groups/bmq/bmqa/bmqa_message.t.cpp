@@ -28,6 +28,7 @@
 // BMQ
 #include <bmqa_event.h>
 #include <bmqa_messageeventbuilder.h>
+#include <bmqa_messageproperties.h>
 #include <bmqa_mocksession.h>
 #include <bmqimp_event.h>
 #include <bmqimp_queue.h>
@@ -35,6 +36,7 @@
 #include <bmqp_crc32c.h>
 #include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
+#include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_puteventbuilder.h>
@@ -593,6 +595,152 @@ static void test4_subscriptionHandle()
     }
 }
 
+static void test5_messagePropertiesView()
+// ------------------------------------------------------------------------
+// MESSAGE PROPERTIES VIEW
+//
+// Concerns:
+//   1. A view loaded from a PUSH message provides access to all its
+//      properties, and reports the absence of the other ones.
+//   2. Loading the same message again into the same view, once the schema
+//      has been learned, provides the same access.
+//   3. Loading a message without properties into a view which was loaded
+//      from another message empties it.
+//
+// Plan:
+//   Build a PUSH event with a message with properties followed by a
+//   message without properties, and load the properties of each of them
+//   into the same view while iterating.
+//
+// Testing:
+//   int loadProperties(MessagePropertiesView* view) const;
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // Can't ensure no default memory is allocated because a default
+    // QueueId is instantiated and that uses the default allocator to
+    // allocate memory for an automatically generated CorrelationId.
+
+    mwctst::TestHelper::printTestName("MESSAGE PROPERTIES VIEW");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4 * 1024, s_allocator_p);
+
+    const int               queueId    = 4321;
+    const unsigned int      subQueueId = 1234;
+    const bmqt::MessageGUID guid;
+    const char*             buffer = "abcdefghijklmnopqrstuvwxyz";
+    const int               flags  = 0;
+
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(s_allocator_p);
+    subQueueInfos.push_back(bmqp::SubQueueInfo(subQueueId));
+
+    bmqp::MessageProperties     in(s_allocator_p);
+    bmqp::MessagePropertiesInfo input(true, 1, false);
+    const bsls::Types::Int64    l = 0x123456789LL;
+
+    in.setPropertyAsString("s", "string");
+    in.setPropertyAsInt32("i", 17);
+    in.setPropertyAsInt64("l", l);
+
+    bdlbb::Blob payload(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&payload, in.streamOut(&bufferFactory, input));
+    bdlbb::BlobUtil::append(&payload, buffer, bsl::strlen(buffer));
+
+    bdlbb::Blob noPropertiesPayload(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&noPropertiesPayload,
+                            buffer,
+                            bsl::strlen(buffer));
+
+    bmqp::PushEventBuilder peb(&bufferFactory, s_allocator_p);
+
+    bmqt::EventBuilderResult::Enum rc = peb.addSubQueueInfosOption(
+        subQueueInfos);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, rc);
+
+    rc = peb.packMessage(payload,
+                         queueId,
+                         guid,
+                         flags,
+                         bmqt::CompressionAlgorithmType::e_NONE,
+                         input);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, rc);
+
+    rc = peb.addSubQueueInfosOption(subQueueInfos);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, rc);
+
+    rc = peb.packMessage(noPropertiesPayload,
+                         queueId,
+                         guid,
+                         flags,
+                         bmqt::CompressionAlgorithmType::e_NONE);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, rc);
+    ASSERT_EQ(2, peb.messageCount());
+
+    bmqa::Event                     event;
+    bsl::shared_ptr<bmqimp::Event>& implPtr =
+        reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>(event);
+
+    implPtr = bsl::make_shared<bmqimp::Event>(&bufferFactory, s_allocator_p);
+
+    // For the SchemaLearner
+    bsl::shared_ptr<bmqimp::Queue> queue =
+        bsl::allocate_shared<bmqimp::Queue, bslma::Allocator>(s_allocator_p);
+    queue->setId(queueId);
+    implPtr->insertQueue(subQueueId, queue);
+
+    bmqp::Event bmqpEvent(&peb.blob(), s_allocator_p, true);
+
+    implPtr->configureAsMessageEvent(bmqpEvent);
+    implPtr->addCorrelationId(bmqt::CorrelationId());
+
+    bmqa::MessageEvent    pushMsgEvt = event.messageEvent();
+    bmqa::MessageIterator mIter      = pushMsgEvt.messageIterator();
+    bmqa::MessagePropertiesView view;
+
+    ASSERT(mIter.nextMessage());
+    {
+        PV("Message with properties");
+
+        const bmqa::Message& message = mIter.message();
+
+        // Load twice, the second time with the schema learned from the
+        // first one.
+        for (int i = 0; i < 2; ++i) {
+            ASSERT_EQ_D(i, 0, message.loadProperties(&view));
+            ASSERT_EQ_D(i, 3, view.numProperties());
+
+            bmqt::PropertyType::Enum type = bmqt::PropertyType::e_UNDEFINED;
+            ASSERT_D(i, view.hasProperty("i", &type));
+            ASSERT_EQ_D(i, bmqt::PropertyType::e_INT32, type);
+            ASSERT_D(i, !view.hasProperty("missing"));
+
+            ASSERT_EQ_D(i, 17, view.getPropertyAsInt32Or("i", 0));
+            ASSERT_EQ_D(i, l, view.getPropertyAsInt64Or("l", 0));
+
+            // Wrong type or missing name
+            ASSERT_EQ_D(i, 0LL, view.getPropertyAsInt64Or("i", 0));
+            ASSERT_EQ_D(i, 5, view.getPropertyAsInt32Or("missing", 5));
+
+            bsl::string value(s_allocator_p);
+            ASSERT_EQ_D(i, 0, view.loadPropertyAsString(&value, "s"));
+            ASSERT_EQ_D(i, bsl::string("string"), value);
+            ASSERT_NE_D(i, 0, view.loadPropertyAsString(&value, "i"));
+        }
+    }
+
+    ASSERT(mIter.nextMessage());
+    {
+        PV("Message without properties");
+
+        ASSERT_EQ(0, mIter.message().loadProperties(&view));
+        ASSERT_EQ(0, view.numProperties());
+        ASSERT(!view.hasProperty("i"));
+        ASSERT_EQ(5, view.getPropertyAsInt32Or("i", 5));
+    }
+
+    ASSERT(!mIter.nextMessage());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -607,6 +755,7 @@ int main(int argc, char* argv[])
     case 2: test2_validPushMessagePrint(); break;
     case 3: test3_messageProperties(); break;
     case 4: test4_subscriptionHandle(); break;
+    case 5: test5_messagePropertiesView(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -23,6 +23,7 @@
 #include <bmqimp_queue.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_queueflags.h>
 
@@ -144,6 +145,19 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
     d_impl.d_guidGenerator_sp->generateGUID(&guid);
     builder->setMessageGUID(guid);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !queueSpRef->isCompressionAlgorithmSupported(
+                builder->compressionAlgorithmType()))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // The broker would reject the message: fall back to ZLIB, which is
+        // supported by every broker.  The level set for the requested
+        // algorithm, if any, is meaningless (and possibly out of range) for
+        // ZLIB: use its default level instead.
+        builder->setCompressionAlgorithmType(
+            bmqt::CompressionAlgorithmType::e_ZLIB);
+        builder->resetCompressionLevel();
+    }
+
     if (queueSpRef->isOldStyle()) {
         // Temporary; shall remove after 2nd roll out of "new style" brokers.
         rc = builder->packMessageInOldStyle(queueSpRef->id());
@@ -154,6 +168,11 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
                 builder->messageProperties());
         builder->setMessagePropertiesInfo(info);
 
+        // Small messages compress well with the dictionary of the queue, if
+        // the broker provided one.
+        builder->setCompressionDictionary(
+            queueSpRef->compressionDictionary().get());
+
         rc = builder->packMessage(queueSpRef->id());
     }
 
@@ -48,7 +48,10 @@
 //:   (e.g. until related ACK event is received).  The recommended approach is
 //:   to create one instance of the builder and use that throughout the
 //:   lifetime of the task (if the task is multi-threaded, an instance per
-//:   thread must be created and maintained).
+//:   thread must be created and maintained).  Resetting the builder also
+//:   keeps the memory of the underlying event, so that once a few events
+//:   have been built, packing messages (including their properties) does not
+//:   allocate memory, unless they are compressed.
 //:   See usage example #1 for an illustration.
 //:
 //: o The lifetime of an instance of the builder is bound by the bmqa::Session
@@ -428,5 +428,143 @@ const bsl::vector<char>& MessagePropertiesIterator::getAsBinary() const
     return d_impl_p->getAsBinary();
 }
 
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// CREATORS
+MessagePropertiesView::MessagePropertiesView()
+: d_impl_p(0)
+, d_buffer()
+{
+    BSLMF_ASSERT(k_MAX_SIZEOF_BMQP_MESSAGEPROPERTIESVIEW >=
+                 sizeof(bmqp::MessagePropertiesView));
+    // Compile-time assert to keep the hardcoded value of size of an object
+    // of type 'bmqp::MessagePropertiesView' in sync with its actual size.
+
+    new (d_buffer.buffer()) bmqp::MessagePropertiesView();
+    d_impl_p = reinterpret_cast<bmqp::MessagePropertiesView*>(
+        d_buffer.buffer());
+}
+
+MessagePropertiesView::MessagePropertiesView(
+    const MessagePropertiesView& other)
+: d_impl_p(0)
+, d_buffer()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(other.d_impl_p);
+
+    new (d_buffer.buffer()) bmqp::MessagePropertiesView(*other.d_impl_p);
+    d_impl_p = reinterpret_cast<bmqp::MessagePropertiesView*>(
+        d_buffer.buffer());
+}
+
+MessagePropertiesView::~MessagePropertiesView()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    d_impl_p->bmqp::MessagePropertiesView::~MessagePropertiesView();
+    d_impl_p = 0;
+}
+
+// MANIPULATORS
+MessagePropertiesView&
+MessagePropertiesView::operator=(const MessagePropertiesView& rhs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+    BSLS_ASSERT(rhs.d_impl_p);
+
+    *d_impl_p = *rhs.d_impl_p;
+    return *this;
+}
+
+// ACCESSORS
+int MessagePropertiesView::numProperties() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->numProperties();
+}
+
+bool MessagePropertiesView::hasProperty(const bsl::string&        name,
+                                        bmqt::PropertyType::Enum* type) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->hasProperty(name, type);
+}
+
+bool MessagePropertiesView::getPropertyAsBoolOr(const bsl::string& name,
+                                                bool               value) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->getPropertyAsBoolOr(name, value);
+}
+
+char MessagePropertiesView::getPropertyAsCharOr(const bsl::string& name,
+                                                char               value) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->getPropertyAsCharOr(name, value);
+}
+
+short MessagePropertiesView::getPropertyAsShortOr(const bsl::string& name,
+                                                  short value) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->getPropertyAsShortOr(name, value);
+}
+
+bsl::int32_t
+MessagePropertiesView::getPropertyAsInt32Or(const bsl::string& name,
+                                            bsl::int32_t       value) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->getPropertyAsInt32Or(name, value);
+}
+
+bsls::Types::Int64
+MessagePropertiesView::getPropertyAsInt64Or(const bsl::string& name,
+                                            bsls::Types::Int64 value) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+
+    return d_impl_p->getPropertyAsInt64Or(name, value);
+}
+
+int MessagePropertiesView::loadPropertyAsString(bsl::string*       buffer,
+                                                const bsl::string& name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+    BSLS_ASSERT(buffer);
+
+    return d_impl_p->loadPropertyAsString(buffer, name);
+}
+
+int MessagePropertiesView::loadPropertyAsBinary(bsl::vector<char>* buffer,
+                                                const bsl::string& name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl_p);
+    BSLS_ASSERT(buffer);
+
+    return d_impl_p->loadPropertyAsBinary(buffer, name);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
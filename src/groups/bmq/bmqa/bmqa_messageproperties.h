@@ -22,6 +22,7 @@
 //@CLASSES:
 //  bmqa::MessageProperties:         VST representing message properties.
 //  bmqa::MessagePropertiesIterator: Mechanism to iterate over properties.
+//  bmqa::MessagePropertiesView:     Read-only view on message properties.
 //
 //@SEE ALSO: bmqt::PropertyType
 //
@@ -37,6 +38,10 @@
 // entire payload to retrieve these attributes.
 // 'bmqa::MessagePropertiesIterator' provides a mechanism to iterate over all
 // the properties of a 'bmqa::MessageProperties' object.
+// 'bmqa::MessagePropertiesView' provides read-only access to the properties of
+// a received message without decoding them: each property is located and read
+// from the message on access, so that reading a few properties of a message
+// carrying many does not pay for all of them.
 //
 /// Restrictions on Property Names
 ///------------------------------
@@ -82,6 +87,9 @@ class MessageProperties;
 namespace bmqp {
 class MessagePropertiesIterator;
 }
+namespace bmqp {
+class MessagePropertiesView;
+}
 
 namespace bmqa {
 
@@ -375,6 +383,100 @@ class MessagePropertiesIterator {
     const bsl::vector<char>& getAsBinary() const;
 };
 
+// ===========================
+// class MessagePropertiesView
+// ===========================
+
+/// Provide read-only access to the properties of a `bmqa::Message`, as
+/// loaded by `Message::loadProperties`, without decoding them.  Each
+/// access locates and reads the requested property directly from the
+/// message, without allocating memory.  A view refers to the current
+/// message of the `bmqa::MessageIterator` it was loaded from, and is
+/// *valid* until the next call to `Message::loadProperties` with it, or
+/// until that iterator advances to the next message (through
+/// `nextMessage`), whichever comes first.  Behavior is undefined if a view
+/// is used after it became invalid.
+class MessagePropertiesView {
+  private:
+    // PRIVATE CONSTANTS
+
+    // Constant representing the maximum size of a
+    // `bmqp::MessagePropertiesView` object, so that the below
+    // AlignedBuffer is big enough.
+    static const int k_MAX_SIZEOF_BMQP_MESSAGEPROPERTIESVIEW = 64;
+
+    // PRIVATE TYPES
+    typedef bsls::AlignedBuffer<k_MAX_SIZEOF_BMQP_MESSAGEPROPERTIESVIEW>
+        ImplBuffer;
+
+  private:
+    // DATA
+    mutable bmqp::MessagePropertiesView* d_impl_p;
+    // Pointer to the implementation object
+    // in 'd_buffer'.  This variable *must*
+    // *be* the first member of this class,
+    // as other components in bmqa package
+    // may reinterpret_cast to that
+    // variable.
+
+    ImplBuffer d_buffer;
+    // Buffer containing the implementation
+    // object, maximally aligned.
+
+  public:
+    // CREATORS
+
+    /// Create an empty view.
+    MessagePropertiesView();
+
+    /// Create a view referring to the same properties as the specified
+    /// `other`.
+    MessagePropertiesView(const MessagePropertiesView& other);
+
+    /// Destroy this view.
+    ~MessagePropertiesView();
+
+    // MANIPULATORS
+
+    /// Make this view refer to the same properties as the specified `rhs`.
+    MessagePropertiesView& operator=(const MessagePropertiesView& rhs);
+
+    // ACCESSORS
+
+    /// Return the total number of properties.
+    int numProperties() const;
+
+    /// Return true if a property with the specified `name` exists and load
+    /// into the optionally specified `type` the type of the property.
+    /// Return false otherwise.
+    bool hasProperty(const bsl::string&        name,
+                     bmqt::PropertyType::Enum* type = 0) const;
+
+    bool  getPropertyAsBoolOr(const bsl::string& name, bool value) const;
+    char  getPropertyAsCharOr(const bsl::string& name, char value) const;
+    short getPropertyAsShortOr(const bsl::string& name, short value) const;
+    bsl::int32_t getPropertyAsInt32Or(const bsl::string& name,
+                                      bsl::int32_t       value) const;
+
+    /// Return the property having the corresponding type and the specified
+    /// `name` if property with such a name and type exists.  Return the
+    /// specified `value` otherwise.
+    bsls::Types::Int64 getPropertyAsInt64Or(const bsl::string& name,
+                                            bsls::Types::Int64 value) const;
+
+    int loadPropertyAsString(bsl::string*       buffer,
+                             const bsl::string& name) const;
+
+    /// Load into the specified `buffer` the property having the
+    /// corresponding type and the specified `name`.  Return zero on
+    /// success, and a non-zero value if property with such a name and type
+    /// does not exist.  Note that the capacity of `buffer` is reused, so
+    /// that reading the same property of successive messages into the same
+    /// `buffer` does not allocate memory once it is large enough.
+    int loadPropertyAsBinary(bsl::vector<char>* buffer,
+                             const bsl::string& name) const;
+};
+
 }  // close package namespace
 
 // ============================================================================
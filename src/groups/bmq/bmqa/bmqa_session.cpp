@@ -259,7 +259,13 @@ int SessionUtil::createApplication(SessionImpl* sessionImpl)
         .append(";")
         .append(bmqp::MessagePropertiesFeatures::k_FIELD_NAME)
         .append(":")
-        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX);
+        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX)
+        .append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_ZSTD)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_LZ4);
 
     ci.protocolVersion() = bmqp::Protocol::k_VERSION;
     ci.sdkVersion()      = bmqscm::Version::versionAsInt();
@@ -19,9 +19,51 @@
 #include <bmqeval_simpleevaluatorparser.hpp>
 #include <bmqeval_simpleevaluatorscanner.h>
 
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
+#include <bsls_annotation.h>
+
 namespace BloombergLP {
 namespace bmqeval {
 
+namespace {
+
+// CONSTANTS
+
+/// The maximum number of values on the stack of a running program.  Each
+/// operator has at most two operands, so an expression has at most one more
+/// operand than operators.
+const int k_MAX_STACK_SIZE = SimpleEvaluator::k_MAX_OPERATORS + 1;
+
+}  // close unnamed namespace
+
+// ------------------------
+// class PropertyConstraint
+// ------------------------
+
+// CREATORS
+PropertyConstraint::PropertyConstraint(bslma::Allocator* allocator)
+: d_name(allocator)
+, d_type(e_STRING)
+, d_string(allocator)
+, d_min(0)
+, d_max(0)
+{
+    // NOTHING
+}
+
+PropertyConstraint::PropertyConstraint(const PropertyConstraint& other,
+                                       bslma::Allocator*         allocator)
+: d_name(other.d_name, allocator)
+, d_type(other.d_type)
+, d_string(other.d_string, allocator)
+, d_min(other.d_min)
+, d_max(other.d_max)
+{
+    // NOTHING
+}
+
 // ----------------------
 // class PropertiesReader
 // ----------------------
@@ -60,11 +102,136 @@ int SimpleEvaluator::compile(const bsl::string&  expression,
     else {
         d_expression = context.d_expression;
     }
+
+    d_program.reset();
+
+    if (d_expression) {
+        d_program = bsl::allocate_shared<Program>(context.d_allocator);
+        d_expression->emit(d_program.get());
+
+        // Guaranteed by the limit on the number of operators.
+        BSLS_ASSERT_OPT(d_program->maxStackSize() <= k_MAX_STACK_SIZE);
+    }
+
     d_isCompiled = true;
 
     return context.lastError();
 }
 
+bool SimpleEvaluator::loadPropertyConstraint(
+    PropertyConstraint* constraint) const
+{
+    BSLS_ASSERT_SAFE(constraint);
+
+    if (!d_expression) {
+        return false;  // RETURN
+    }
+
+    return d_expression->loadConstraint(constraint);
+}
+
+bool SimpleEvaluator::loadComparisonConstraint(
+    PropertyConstraint* constraint,
+    Instruction::Opcode opcode,
+    const Expression&   left,
+    const Expression&   right)
+{
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_MIN = bsl::numeric_limits<Int64>::min();
+    const Int64 k_MAX = bsl::numeric_limits<Int64>::max();
+
+    const Property*   property = dynamic_cast<const Property*>(&left);
+    const Expression* literal  = &right;
+
+    if (!property) {
+        // 'literal <op> property' is 'property <reversed op> literal'.
+
+        property = dynamic_cast<const Property*>(&right);
+        literal  = &left;
+
+        switch (opcode) {
+        case Instruction::e_LESS: opcode = Instruction::e_GREATER; break;
+        case Instruction::e_LESS_EQUAL:
+            opcode = Instruction::e_GREATER_EQUAL;
+            break;
+        case Instruction::e_GREATER: opcode = Instruction::e_LESS; break;
+        case Instruction::e_GREATER_EQUAL:
+            opcode = Instruction::e_LESS_EQUAL;
+            break;
+        default: break;
+        }
+    }
+
+    if (!property) {
+        return false;  // RETURN
+    }
+
+    if (const StringLiteral* string = dynamic_cast<const StringLiteral*>(
+            literal)) {
+        if (opcode != Instruction::e_EQUAL) {
+            return false;  // RETURN
+        }
+
+        constraint->d_name   = property->name();
+        constraint->d_type   = PropertyConstraint::e_STRING;
+        constraint->d_string = string->value();
+
+        return true;  // RETURN
+    }
+
+    const IntegerLiteral* integer = dynamic_cast<const IntegerLiteral*>(
+        literal);
+
+    if (!integer) {
+        return false;  // RETURN
+    }
+
+    const Int64 value = integer->value();
+    Int64       min   = k_MIN;
+    Int64       max   = k_MAX;
+
+    switch (opcode) {
+    case Instruction::e_EQUAL: {
+        min = value;
+        max = value;
+    } break;
+    case Instruction::e_LESS: {
+        if (value == k_MIN) {
+            // Nothing is less than the minimum: use an empty range.
+            min = k_MAX;
+        }
+        else {
+            max = value - 1;
+        }
+    } break;
+    case Instruction::e_LESS_EQUAL: {
+        max = value;
+    } break;
+    case Instruction::e_GREATER: {
+        if (value == k_MAX) {
+            max = k_MIN;
+        }
+        else {
+            min = value + 1;
+        }
+    } break;
+    case Instruction::e_GREATER_EQUAL: {
+        min = value;
+    } break;
+    default: {
+        return false;  // RETURN
+    }
+    }
+
+    constraint->d_name = property->name();
+    constraint->d_type = PropertyConstraint::e_INTEGER;
+    constraint->d_min  = min;
+    constraint->d_max  = max;
+
+    return true;
+}
+
 bool SimpleEvaluator::validate(const bsl::string&  expression,
                                CompilationContext& context)
 {
@@ -117,6 +284,16 @@ void SimpleEvaluator::parse(const bsl::string&  expression,
 }
 
 bool SimpleEvaluator::evaluate(EvaluationContext& context) const
+{
+    BSLS_ASSERT_SAFE(d_program.get());
+    BSLS_ASSERT_SAFE(context.d_propertiesReader);
+
+    context.reset();
+
+    return d_program->execute(context);
+}
+
+bool SimpleEvaluator::evaluateTree(EvaluationContext& context) const
 {
     BSLS_ASSERT_SAFE(d_expression.get());
     BSLS_ASSERT_SAFE(context.d_propertiesReader);
@@ -139,6 +316,16 @@ bool SimpleEvaluator::evaluate(EvaluationContext& context) const
     return value.theBoolean();
 }
 
+// ---------------------------------
+// class SimpleEvaluator::Expression
+// ---------------------------------
+
+bool SimpleEvaluator::Expression::loadConstraint(
+    BSLS_ANNOTATION_UNUSED PropertyConstraint* constraint) const
+{
+    return false;
+}
+
 // -------------------------------
 // class SimpleEvaluator::Property
 // -------------------------------
@@ -159,7 +346,18 @@ SimpleEvaluator::Property::Property(bsl::string&& name) noexcept
 bdld::Datum
 SimpleEvaluator::Property::evaluate(EvaluationContext& context) const
 {
-    bdld::Datum value = context.d_propertiesReader->get(d_name,
+    return read(d_name, context);
+}
+
+void SimpleEvaluator::Property::emit(Program* program) const
+{
+    program->emitProperty(d_name);
+}
+
+bdld::Datum SimpleEvaluator::Property::read(const bsl::string& name,
+                                            EvaluationContext& context)
+{
+    bdld::Datum value = context.d_propertiesReader->get(name,
                                                         context.d_allocator);
 
     if (value.isError()) {
@@ -191,6 +389,11 @@ SimpleEvaluator::IntegerLiteral::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(d_value, context.d_allocator);
 }
 
+void SimpleEvaluator::IntegerLiteral::emit(Program* program) const
+{
+    program->emitInteger(d_value);
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -201,6 +404,11 @@ SimpleEvaluator::BooleanLiteral::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(d_value);
 }
 
+void SimpleEvaluator::BooleanLiteral::emit(Program* program) const
+{
+    program->emitBoolean(d_value);
+}
+
 // ---------------------------------
 // class SimpleEvaluator::UnaryMinus
 // ---------------------------------
@@ -231,6 +439,14 @@ SimpleEvaluator::UnaryMinus::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(-value, context.d_allocator);
 }
 
+void SimpleEvaluator::UnaryMinus::emit(Program* program) const
+{
+    const bsl::size_t operand = program->size();
+    d_expression->emit(program);
+
+    program->emitUnary(Instruction::e_NEGATE, operand);
+}
+
 // ------------------------------------
 // class SimpleEvaluator::StringLiteral
 // ------------------------------------
@@ -258,6 +474,11 @@ SimpleEvaluator::StringLiteral::evaluate(EvaluationContext& context) const
                                         context.d_allocator);
 }
 
+void SimpleEvaluator::StringLiteral::emit(Program* program) const
+{
+    program->emitString(d_value);
+}
+
 // -------------------------
 // class SimpleEvaluator::Or
 // -------------------------
@@ -293,6 +514,13 @@ bdld::Datum SimpleEvaluator::Or::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::Or::emit(Program* program) const
+{
+    program->emitLogical(Instruction::e_JUMP_IF_TRUE_OR_POP,
+                         *d_left,
+                         *d_right);
+}
+
 // --------------------------
 // class SimpleEvaluator::And
 // --------------------------
@@ -328,6 +556,48 @@ bdld::Datum SimpleEvaluator::And::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::And::emit(Program* program) const
+{
+    program->emitLogical(Instruction::e_JUMP_IF_FALSE_OR_POP,
+                         *d_left,
+                         *d_right);
+}
+
+bool SimpleEvaluator::And::loadConstraint(
+    PropertyConstraint* constraint) const
+{
+    // Both operands must be 'true', so the condition of either one is
+    // necessary.  Prefer the most selective one.
+
+    PropertyConstraint right(constraint->d_name.get_allocator().mechanism());
+
+    const bool hasLeft  = d_left->loadConstraint(constraint);
+    const bool hasRight = d_right->loadConstraint(&right);
+
+    if (!hasRight) {
+        return hasLeft;  // RETURN
+    }
+
+    if (!hasLeft) {
+        *constraint = right;
+        return true;  // RETURN
+    }
+
+    if (constraint->d_type == PropertyConstraint::e_INTEGER &&
+        right.d_type == PropertyConstraint::e_INTEGER &&
+        constraint->d_name == right.d_name) {
+        // Both ranges apply to the same property: intersect them.
+
+        constraint->d_min = bsl::max(constraint->d_min, right.d_min);
+        constraint->d_max = bsl::min(constraint->d_max, right.d_max);
+    }
+    else if (!constraint->isEquality() && right.isEquality()) {
+        *constraint = right;
+    }
+
+    return true;
+}
+
 // --------------------------
 // class SimpleEvaluator::Not
 // --------------------------
@@ -349,5 +619,437 @@ bdld::Datum SimpleEvaluator::Not::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(!value.theBoolean());
 }
 
+void SimpleEvaluator::Not::emit(Program* program) const
+{
+    const bsl::size_t operand = program->size();
+    d_expression->emit(program);
+
+    program->emitUnary(Instruction::e_NOT, operand);
+}
+
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+// CREATORS
+SimpleEvaluator::Program::Program(bslma::Allocator* allocator)
+: d_code(allocator)
+, d_strings(allocator)
+, d_stackSize(0)
+, d_maxStackSize(0)
+{
+    // NOTHING
+}
+
+// PRIVATE MANIPULATORS
+void SimpleEvaluator::Program::emitPush(Instruction::Opcode opcode,
+                                        int                 index,
+                                        bsls::Types::Int64  value)
+{
+    Instruction instruction;
+    instruction.d_opcode = opcode;
+    instruction.d_index  = index;
+    instruction.d_value  = value;
+    d_code.push_back(instruction);
+
+    if (++d_stackSize > d_maxStackSize) {
+        d_maxStackSize = d_stackSize;
+    }
+}
+
+void SimpleEvaluator::Program::replaceWithConstant(bsl::size_t  start,
+                                                   const Value& value)
+{
+    // Only called on operands which are literals, each of which pushed
+    // one value.
+
+    d_stackSize -= static_cast<int>(d_code.size() - start);
+    d_code.resize(start);
+
+    BSLS_ASSERT_SAFE(value.d_type == Value::e_BOOLEAN ||
+                     value.d_type == Value::e_INTEGER);
+
+    emitPush(value.d_type == Value::e_BOOLEAN ? Instruction::e_PUSH_BOOLEAN
+                                              : Instruction::e_PUSH_INTEGER,
+             0,
+             value.d_integer);
+}
+
+// PRIVATE ACCESSORS
+bool SimpleEvaluator::Program::constantAt(Value*      value,
+                                          bsl::size_t start) const
+{
+    if (start + 1 != d_code.size()) {
+        return false;  // RETURN
+    }
+
+    const Instruction& instruction = d_code[start];
+
+    switch (instruction.d_opcode) {
+    case Instruction::e_PUSH_BOOLEAN: {
+        value->d_type    = Value::e_BOOLEAN;
+        value->d_integer = instruction.d_value;
+    } break;
+    case Instruction::e_PUSH_INTEGER: {
+        value->d_type    = Value::e_INTEGER;
+        value->d_integer = instruction.d_value;
+    } break;
+    case Instruction::e_PUSH_STRING: {
+        value->d_type   = Value::e_STRING;
+        value->d_string = d_strings[instruction.d_index];
+    } break;
+    default: {
+        return false;  // RETURN
+    }
+    }
+
+    return true;
+}
+
+// MANIPULATORS
+void SimpleEvaluator::Program::emitBoolean(bool value)
+{
+    emitPush(Instruction::e_PUSH_BOOLEAN, 0, value);
+}
+
+void SimpleEvaluator::Program::emitInteger(bsls::Types::Int64 value)
+{
+    emitPush(Instruction::e_PUSH_INTEGER, 0, value);
+}
+
+void SimpleEvaluator::Program::emitString(const bsl::string& value)
+{
+    emitPush(Instruction::e_PUSH_STRING,
+             static_cast<int>(d_strings.size()),
+             0);
+    d_strings.push_back(value);
+}
+
+void SimpleEvaluator::Program::emitProperty(const bsl::string& name)
+{
+    emitPush(Instruction::e_PUSH_PROPERTY,
+             static_cast<int>(d_strings.size()),
+             0);
+    d_strings.push_back(name);
+}
+
+void SimpleEvaluator::Program::emitBinary(Instruction::Opcode opcode,
+                                          bsl::size_t         left,
+                                          bsl::size_t         right)
+{
+    Value a;
+    Value b;
+    Value result;
+
+    if (right == left + 1 && constantAt(&b, right)) {
+        // 'constantAt' requires the operand to end the program, so check
+        // the left operand as if the right one was not there.
+
+        const Instruction rightInstruction = d_code.back();
+        d_code.pop_back();
+        const bool isConstant = constantAt(&a, left);
+        d_code.push_back(rightInstruction);
+
+        // Do not fold divisions that would fail at compile time rather
+        // than at evaluation time.
+        const bool isSafe = (opcode != Instruction::e_DIVIDES &&
+                             opcode != Instruction::e_MODULUS) ||
+                            b.d_type != Value::e_INTEGER ||
+                            (b.d_integer != 0 && b.d_integer != -1);
+
+        if (isConstant && isSafe &&
+            apply(&result, opcode, a, b) == ErrorType::e_OK) {
+            replaceWithConstant(left, result);
+            return;  // RETURN
+        }
+    }
+
+    Instruction instruction;
+    instruction.d_opcode = opcode;
+    instruction.d_index  = 0;
+    instruction.d_value  = 0;
+    d_code.push_back(instruction);
+
+    --d_stackSize;
+}
+
+void SimpleEvaluator::Program::emitUnary(Instruction::Opcode opcode,
+                                         bsl::size_t         operand)
+{
+    Value value;
+    Value result;
+
+    if (constantAt(&value, operand) &&
+        apply(&result, opcode, value) == ErrorType::e_OK) {
+        replaceWithConstant(operand, result);
+        return;  // RETURN
+    }
+
+    Instruction instruction;
+    instruction.d_opcode = opcode;
+    instruction.d_index  = 0;
+    instruction.d_value  = 0;
+    d_code.push_back(instruction);
+}
+
+void SimpleEvaluator::Program::emitLogical(Instruction::Opcode jump,
+                                           const Expression&   left,
+                                           const Expression&   right)
+{
+    BSLS_ASSERT_SAFE(jump == Instruction::e_JUMP_IF_FALSE_OR_POP ||
+                     jump == Instruction::e_JUMP_IF_TRUE_OR_POP);
+
+    const bool        shortCircuitValue = jump ==
+                                   Instruction::e_JUMP_IF_TRUE_OR_POP;
+    const bsl::size_t start             = d_code.size();
+    Value             value;
+
+    left.emit(this);
+
+    if (constantAt(&value, start) && value.d_type == Value::e_BOOLEAN) {
+        if ((value.d_integer != 0) == shortCircuitValue) {
+            // The result is the left operand, e.g. 'false && x'.
+            return;  // RETURN
+        }
+
+        // The result is the right operand, e.g. 'true && x', provided it is
+        // a boolean.
+        d_code.pop_back();
+        --d_stackSize;
+
+        right.emit(this);
+        emitUnary(Instruction::e_CHECK_BOOLEAN, start);
+        return;  // RETURN
+    }
+
+    const bsl::size_t jumpPosition = d_code.size();
+
+    Instruction instruction;
+    instruction.d_opcode = jump;
+    instruction.d_index  = 0;
+    instruction.d_value  = 0;
+    d_code.push_back(instruction);
+
+    // If the jump is not taken, the left operand is popped and replaced
+    // with the right one.
+    --d_stackSize;
+
+    right.emit(this);
+    emitUnary(Instruction::e_CHECK_BOOLEAN, jumpPosition + 1);
+
+    d_code[jumpPosition].d_index = static_cast<int>(d_code.size());
+}
+
+// ACCESSORS
+bool SimpleEvaluator::Program::execute(EvaluationContext& context) const
+{
+    Value                    stack[k_MAX_STACK_SIZE];
+    int                      top  = -1;
+    const Instruction* const code = d_code.data();
+    const int                size = static_cast<int>(d_code.size());
+
+    for (int pc = 0; pc < size; ++pc) {
+        const Instruction& instruction = code[pc];
+        ErrorType::Enum    rc          = ErrorType::e_OK;
+
+        switch (instruction.d_opcode) {
+        case Instruction::e_PUSH_BOOLEAN: {
+            Value& value    = stack[++top];
+            value.d_type    = Value::e_BOOLEAN;
+            value.d_integer = instruction.d_value;
+        } break;
+        case Instruction::e_PUSH_INTEGER: {
+            Value& value    = stack[++top];
+            value.d_type    = Value::e_INTEGER;
+            value.d_integer = instruction.d_value;
+        } break;
+        case Instruction::e_PUSH_STRING: {
+            Value& value   = stack[++top];
+            value.d_type   = Value::e_STRING;
+            value.d_string = d_strings[instruction.d_index];
+        } break;
+        case Instruction::e_PUSH_PROPERTY: {
+            const bdld::Datum datum = Property::read(
+                d_strings[instruction.d_index],
+                context);
+
+            if (context.d_stop) {
+                return false;  // RETURN
+            }
+
+            Value& value = stack[++top];
+
+            if (datum.isBoolean()) {
+                value.d_type    = Value::e_BOOLEAN;
+                value.d_integer = datum.theBoolean();
+            }
+            else if (datum.isInteger64()) {
+                value.d_type    = Value::e_INTEGER;
+                value.d_integer = datum.theInteger64();
+            }
+            else if (datum.isInteger()) {
+                value.d_type    = Value::e_INTEGER;
+                value.d_integer = datum.theInteger();
+            }
+            else if (datum.isString()) {
+                value.d_type   = Value::e_STRING;
+                value.d_string = datum.theString();
+            }
+            else {
+                value.d_type = Value::e_OTHER;
+            }
+        } break;
+        case Instruction::e_JUMP_IF_FALSE_OR_POP:
+        case Instruction::e_JUMP_IF_TRUE_OR_POP: {
+            const Value& value = stack[top];
+
+            if (value.d_type != Value::e_BOOLEAN) {
+                rc = ErrorType::e_TYPE;
+            }
+            else if ((value.d_integer != 0) ==
+                     (instruction.d_opcode ==
+                      Instruction::e_JUMP_IF_TRUE_OR_POP)) {
+                pc = instruction.d_index - 1;
+            }
+            else {
+                --top;
+            }
+        } break;
+        case Instruction::e_NEGATE:
+        case Instruction::e_NOT:
+        case Instruction::e_CHECK_BOOLEAN: {
+            rc = apply(&stack[top], instruction.d_opcode, stack[top]);
+        } break;
+        default: {
+            --top;
+            rc = apply(&stack[top],
+                       instruction.d_opcode,
+                       stack[top],
+                       stack[top + 1]);
+        }
+        }
+
+        if (rc != ErrorType::e_OK) {
+            context.d_lastError = rc;
+            context.stop();
+            return false;  // RETURN
+        }
+    }
+
+    BSLS_ASSERT_SAFE(top == 0);
+
+    if (stack[0].d_type != Value::e_BOOLEAN) {
+        context.d_lastError = ErrorType::e_TYPE;
+        context.stop();
+        return false;  // RETURN
+    }
+
+    return stack[0].d_integer != 0;
+}
+
+// CLASS METHODS
+ErrorType::Enum
+SimpleEvaluator::Program::apply(Value*              result,
+                                Instruction::Opcode opcode,
+                                const Value&        left,
+                                const Value&        right)
+{
+    if (opcode <= Instruction::e_GREATER_EQUAL) {
+        // Strings compare to strings, and integers to integers.
+
+        int comparison;
+
+        if (left.d_type == Value::e_STRING) {
+            if (right.d_type != Value::e_STRING) {
+                return ErrorType::e_TYPE;  // RETURN
+            }
+
+            comparison = left.d_string.compare(right.d_string);
+        }
+        else if (left.d_type == Value::e_INTEGER &&
+                 right.d_type == Value::e_INTEGER) {
+            comparison = (left.d_integer > right.d_integer) -
+                         (left.d_integer < right.d_integer);
+        }
+        else {
+            return ErrorType::e_TYPE;  // RETURN
+        }
+
+        bool value = false;
+
+        switch (opcode) {
+        case Instruction::e_EQUAL: value = comparison == 0; break;
+        case Instruction::e_NOT_EQUAL: value = comparison != 0; break;
+        case Instruction::e_LESS: value = comparison < 0; break;
+        case Instruction::e_LESS_EQUAL: value = comparison <= 0; break;
+        case Instruction::e_GREATER: value = comparison > 0; break;
+        case Instruction::e_GREATER_EQUAL: value = comparison >= 0; break;
+        default: BSLS_ASSERT_SAFE(false && "Unexpected opcode");
+        }
+
+        result->d_type    = Value::e_BOOLEAN;
+        result->d_integer = value;
+
+        return ErrorType::e_OK;  // RETURN
+    }
+
+    // Arithmetic operators apply to integers only.
+
+    if (left.d_type != Value::e_INTEGER || right.d_type != Value::e_INTEGER) {
+        return ErrorType::e_TYPE;  // RETURN
+    }
+
+    const bsls::Types::Int64 a = left.d_integer;
+    const bsls::Types::Int64 b = right.d_integer;
+
+    switch (opcode) {
+    case Instruction::e_PLUS: result->d_integer = a + b; break;
+    case Instruction::e_MINUS: result->d_integer = a - b; break;
+    case Instruction::e_MULTIPLIES: result->d_integer = a * b; break;
+    case Instruction::e_DIVIDES: result->d_integer = a / b; break;
+    case Instruction::e_MODULUS: result->d_integer = a % b; break;
+    default: BSLS_ASSERT_SAFE(false && "Unexpected opcode");
+    }
+
+    result->d_type = Value::e_INTEGER;
+
+    return ErrorType::e_OK;
+}
+
+ErrorType::Enum
+SimpleEvaluator::Program::apply(Value*              result,
+                                Instruction::Opcode opcode,
+                                const Value&        operand)
+{
+    switch (opcode) {
+    case Instruction::e_NEGATE: {
+        if (operand.d_type != Value::e_INTEGER) {
+            return ErrorType::e_TYPE;  // RETURN
+        }
+
+        result->d_type    = Value::e_INTEGER;
+        result->d_integer = -operand.d_integer;
+    } break;
+    case Instruction::e_NOT: {
+        if (operand.d_type != Value::e_BOOLEAN) {
+            return ErrorType::e_TYPE;  // RETURN
+        }
+
+        result->d_type    = Value::e_BOOLEAN;
+        result->d_integer = operand.d_integer == 0;
+    } break;
+    case Instruction::e_CHECK_BOOLEAN: {
+        if (operand.d_type != Value::e_BOOLEAN) {
+            return ErrorType::e_TYPE;  // RETURN
+        }
+
+        *result = operand;
+    } break;
+    default: BSLS_ASSERT_SAFE(false && "Unexpected opcode");
+    }
+
+    return ErrorType::e_OK;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
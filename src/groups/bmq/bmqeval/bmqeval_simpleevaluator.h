@@ -26,9 +26,22 @@
 //  names.
 //  CompilationContext: Contains data used during parsing.
 //  EvaluationContext: Contains data used during evaluation.
+//  PropertyConstraint: Condition on a property necessary for an expression.
 //
 //@DESCRIPTION: 'SimpleEvaluator' handles expression evaluation.
 //
+/// Compiled Form
+///-------------
+// 'compile' parses the expression into an abstract syntax tree, then flattens
+// that tree into a 'program': a linear sequence of instructions for a small
+// stack machine, which is what 'evaluate' runs.  While flattening,
+// sub-expressions whose operands are all literals are folded into a single
+// literal (e.g., 'x > 2 * 1024' compares 'x' to '2048'), and the right operand
+// of '&&' and '||' is skipped by a forward jump when the left operand alone
+// determines the result.  Evaluating a program neither allocates memory nor
+// makes virtual calls, other than to read properties.  The tree is kept, and
+// can be evaluated with 'evaluateTree', for testing and benchmarking.
+//
 /// Thread Safety
 ///-------------
 //: o SimpleEvaluator is thread safe
@@ -60,11 +73,15 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
+#include <bslstl_stringref.h>
 
 // MWC
 #include <mwcu_memoutstream.h>
@@ -123,6 +140,60 @@ class PropertiesReader {
                             bslma::Allocator*  allocator) = 0;
 };
 
+// ========================
+// class PropertyConstraint
+// ========================
+
+/// A condition on the value of a single property, which is necessary (but
+/// not sufficient) for an expression to evaluate to `true`.  See
+/// `SimpleEvaluator::loadPropertyConstraint`.
+struct PropertyConstraint {
+    // TYPES
+    enum Type {
+        e_STRING = 0  // the property is a string equal to 'd_string'
+        ,
+        e_INTEGER = 1  // the property is an integer in '[d_min, d_max]'
+    };
+
+    // DATA
+
+    // The name of the property.
+    bsl::string d_name;
+
+    Type d_type;
+
+    // The value of the property, if `d_type` is `e_STRING`.
+    bsl::string d_string;
+
+    // The lowest value of the property, if `d_type` is `e_INTEGER`.
+    bsls::Types::Int64 d_min;
+
+    // The highest value of the property, if `d_type` is `e_INTEGER`.  Note
+    // that the range is empty if `d_max < d_min`.
+    bsls::Types::Int64 d_max;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PropertyConstraint,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a constraint requiring an empty property name to be an empty
+    /// string, using the optionally specified `allocator` to supply memory.
+    explicit PropertyConstraint(bslma::Allocator* allocator = 0);
+
+    /// Create a constraint having the same value as the specified `other`,
+    /// using the optionally specified `allocator` to supply memory.
+    PropertyConstraint(const PropertyConstraint& other,
+                       bslma::Allocator*         allocator = 0);
+
+    // ACCESSORS
+
+    /// Return `true` if this constraint requires the property to have a
+    /// single value.
+    bool isEquality() const;
+};
+
 // =====================
 // class SimpleEvaluator
 // =====================
@@ -132,6 +203,9 @@ class SimpleEvaluator {
   private:
     // PRIVATE TYPES
 
+    // FORWARD DECLARATIONS
+    class Program;
+
     // ----------
     // Expression
     // ----------
@@ -144,6 +218,16 @@ class SimpleEvaluator {
 
         /// Evaluate a Expression.
         virtual bdld::Datum evaluate(EvaluationContext& context) const = 0;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this Expression.
+        virtual void emit(Program* program) const = 0;
+
+        /// Load into the specified `constraint` a condition on the value of
+        /// a property which is necessary for this Expression to evaluate to
+        /// `true`, and return `true`.  Return `false` if no such condition
+        /// is found.  The default implementation returns `false`.
+        virtual bool loadConstraint(PropertyConstraint* constraint) const;
     };
 
     // Bison generates different code for different available standards:
@@ -191,6 +275,22 @@ class SimpleEvaluator {
         /// `false`;
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` an instruction reading the
+        /// property.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return the name of the property.
+        const bsl::string& name() const;
+
+        // CLASS METHODS
+
+        /// Return the value of the property having the specified `name`,
+        /// read from the properties reader of the specified `context`.  If
+        /// the property cannot be read, stop evaluation, set the last error
+        /// of `context` accordingly, and return an error Datum.
+        static bdld::Datum read(const bsl::string& name,
+                                EvaluationContext& context);
     };
 
     // --------------
@@ -216,6 +316,13 @@ class SimpleEvaluator {
         /// Return the integer passed to the constructor, as an Int64 Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        bsls::Types::Int64 value() const;
     };
 
     // -------------
@@ -247,6 +354,13 @@ class SimpleEvaluator {
         /// Return the string passed to the constructor, as StringRef Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        const bsl::string& value() const;
     };
 
     // --------------
@@ -274,6 +388,10 @@ class SimpleEvaluator {
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
 
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
         /// Return `d_value`.
         bool value() const;
     };
@@ -309,6 +427,17 @@ class SimpleEvaluator {
         /// return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Load into the specified `constraint` a condition on the value
+        /// of a property which is necessary for this expression to
+        /// evaluate to `true`, and return `true`.  Return `false` if no
+        /// such condition is found.
+        bool loadConstraint(PropertyConstraint* constraint) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // --
@@ -344,6 +473,10 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -379,6 +512,17 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Load into the specified `constraint` a condition on the value
+        /// of a property which is necessary for this expression to
+        /// evaluate to `true`, and return `true`.  Return `false` if no
+        /// such condition is found.
+        bool loadConstraint(PropertyConstraint* constraint) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------------------
@@ -413,6 +557,10 @@ class SimpleEvaluator {
         /// datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ----------
@@ -440,6 +588,10 @@ class SimpleEvaluator {
         /// and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -467,6 +619,213 @@ class SimpleEvaluator {
         /// evaluation, and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+    };
+
+    // -----------
+    // Instruction
+    // -----------
+
+    /// An instruction of a `Program`.
+    struct Instruction {
+        // TYPES
+
+        /// `e_PUSH_*` instructions push a literal (whose value is in
+        /// `d_value`, or is the string at `d_index` in the program) or the
+        /// value of a property (whose name is the string at `d_index`) on
+        /// the stack.  Operator instructions replace their operands, on top
+        /// of the stack, with the result.  `e_CHECK_BOOLEAN` fails unless
+        /// the top of the stack is a boolean.  `e_JUMP_IF_*_OR_POP`
+        /// instructions fail unless the top of the stack is a boolean, then
+        /// jump to `d_index` if it has the specified value, or pop it
+        /// otherwise.
+        enum Opcode {
+            e_PUSH_BOOLEAN,
+            e_PUSH_INTEGER,
+            e_PUSH_STRING,
+            e_PUSH_PROPERTY,
+            e_EQUAL,
+            e_NOT_EQUAL,
+            e_LESS,
+            e_LESS_EQUAL,
+            e_GREATER,
+            e_GREATER_EQUAL,
+            e_PLUS,
+            e_MINUS,
+            e_MULTIPLIES,
+            e_DIVIDES,
+            e_MODULUS,
+            e_NEGATE,
+            e_NOT,
+            e_CHECK_BOOLEAN,
+            e_JUMP_IF_FALSE_OR_POP,
+            e_JUMP_IF_TRUE_OR_POP
+        };
+
+        // DATA
+        Opcode d_opcode;
+
+        // Index of the string in the program, or target of the jump.
+        int d_index;
+
+        // Value of the boolean or integer to push.
+        bsls::Types::Int64 d_value;
+
+        // CLASS METHODS
+
+        /// Return the opcode of the instruction applying `Op`, one of the
+        /// standard comparison or binary arithmetic operation functors.
+        template <template <typename> class Op>
+        static Opcode fromOperator();
+    };
+
+    // -----
+    // Value
+    // -----
+
+    /// A value on the stack of a running `Program`.
+    struct Value {
+        // TYPES
+        enum Type { e_BOOLEAN, e_INTEGER, e_STRING, e_OTHER };
+
+        // DATA
+        Type d_type;
+
+        // Value of a boolean or an integer.
+        bsls::Types::Int64 d_integer;
+
+        // Value of a string.
+        bslstl::StringRef d_string;
+    };
+
+    // -------
+    // Program
+    // -------
+
+    /// Compiled form of an expression: a flat sequence of instructions for
+    /// a stack machine, emitted by a post-order walk of the Expression
+    /// tree.  Instructions applying an operator to literals are folded into
+    /// a single literal, and the right operand of `&&` and `||` is skipped
+    /// by a forward jump when the left operand determines the result.
+    class Program {
+      private:
+        // DATA
+
+        // The instructions.
+        bsl::vector<Instruction> d_code;
+
+        // The string literals and property names used by the instructions.
+        bsl::vector<bsl::string> d_strings;
+
+        // Number of values on the stack after the last instruction.
+        int d_stackSize;
+
+        // Maximum number of values on the stack at any point.
+        int d_maxStackSize;
+
+        // PRIVATE MANIPULATORS
+
+        /// Append an instruction having the specified `opcode`, `index`
+        /// and `value`, which pushes a value on the stack.
+        void emitPush(Instruction::Opcode opcode,
+                      int                 index,
+                      bsls::Types::Int64  value);
+
+        /// Replace the instructions from the specified `start` position
+        /// with an instruction pushing the specified `value`.
+        void replaceWithConstant(bsl::size_t start, const Value& value);
+
+        // PRIVATE ACCESSORS
+
+        /// Load into the specified `value` the value pushed by the
+        /// instructions from the specified `start` position, and return
+        /// `true`, if they consist in a single literal.  Return `false`
+        /// otherwise.
+        bool constantAt(Value* value, bsl::size_t start) const;
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Program, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create an empty program, using the optionally specified
+        /// `allocator` to supply memory.
+        explicit Program(bslma::Allocator* allocator = 0);
+
+        // MANIPULATORS
+
+        /// Append an instruction pushing the specified boolean `value`.
+        void emitBoolean(bool value);
+
+        /// Append an instruction pushing the specified integer `value`.
+        void emitInteger(bsls::Types::Int64 value);
+
+        /// Append an instruction pushing the specified string `value`.
+        void emitString(const bsl::string& value);
+
+        /// Append an instruction pushing the value of the property having
+        /// the specified `name`.
+        void emitProperty(const bsl::string& name);
+
+        /// Append an instruction applying the binary operator having the
+        /// specified `opcode` to the operands emitted from the specified
+        /// `left` and `right` positions.  If both operands are literals,
+        /// replace them with the result instead, unless applying the
+        /// operator fails.
+        void emitBinary(Instruction::Opcode opcode,
+                        bsl::size_t         left,
+                        bsl::size_t         right);
+
+        /// Append an instruction applying the unary operator having the
+        /// specified `opcode` to the operand emitted from the specified
+        /// `operand` position.  If the operand is a literal, replace it
+        /// with the result instead, unless applying the operator fails.
+        void emitUnary(Instruction::Opcode opcode, bsl::size_t operand);
+
+        /// Append the instructions evaluating the specified `left` and
+        /// `right` operands of a `&&` (if the specified `jump` is
+        /// `e_JUMP_IF_FALSE_OR_POP`) or `||` (if `jump` is
+        /// `e_JUMP_IF_TRUE_OR_POP`) operator.
+        void emitLogical(Instruction::Opcode jump,
+                         const Expression&   left,
+                         const Expression&   right);
+
+        // ACCESSORS
+
+        /// Return the number of instructions.
+        bsl::size_t size() const;
+
+        /// Return the maximum number of values on the stack while running
+        /// the program.
+        int maxStackSize() const;
+
+        /// Run the program, using the specified `context`, and return its
+        /// result.  If the evaluation fails, stop the `context`, set its
+        /// last error, and return `false`.
+        bool execute(EvaluationContext& context) const;
+
+        // CLASS METHODS
+
+        /// Load into the specified `result` the result of the binary
+        /// operator having the specified `opcode` applied to the specified
+        /// `left` and `right` operands.  Return `e_OK` on success, or
+        /// `e_TYPE` if the operands do not have the expected types.
+        static ErrorType::Enum apply(Value*              result,
+                                     Instruction::Opcode opcode,
+                                     const Value&        left,
+                                     const Value&        right);
+
+        /// Load into the specified `result` the result of the unary
+        /// operator having the specified `opcode` applied to the specified
+        /// `operand`.  Return `e_OK` on success, or `e_TYPE` if the operand
+        /// does not have the expected type.
+        static ErrorType::Enum apply(Value*              result,
+                                     Instruction::Opcode opcode,
+                                     const Value&        operand);
     };
 
   private:
@@ -479,6 +838,9 @@ class SimpleEvaluator {
     // The expression to evaluate.
     bsl::shared_ptr<Expression> d_expression;
 
+    // The compiled form of `d_expression`.
+    bsl::shared_ptr<Program> d_program;
+
     // The flag indicating that `compile` was called for this expression.
     bool d_isCompiled;
 
@@ -489,6 +851,16 @@ class SimpleEvaluator {
     static void parse(const bsl::string&  expression,
                       CompilationContext& context);
 
+    /// Load into the specified `constraint` the condition for the
+    /// comparison having the specified `opcode` of the specified `left` and
+    /// `right` operands to evaluate to `true`, and return `true`, if one
+    /// operand is a property and the other is a literal.  Return `false`
+    /// otherwise.
+    static bool loadComparisonConstraint(PropertyConstraint* constraint,
+                                         Instruction::Opcode opcode,
+                                         const Expression&   left,
+                                         const Expression&   right);
+
   public:
     // PUBLIC CONSTANTS
     enum {
@@ -516,9 +888,24 @@ class SimpleEvaluator {
     /// the constructor.
     bool evaluate(EvaluationContext& context) const;
 
+    /// Evaluate the expression like `evaluate` does, but by walking its
+    /// syntax tree instead of running its compiled form.  This method is
+    /// meant for testing and benchmarking `evaluate`.
+    bool evaluateTree(EvaluationContext& context) const;
+
     /// Return `true` if the `compile` was called for this object.
     bool isCompiled() const;
 
+    /// Load into the specified `constraint` a condition on the value of a
+    /// single property which is necessary for the expression to evaluate
+    /// to `true`, and return `true`.  Return `false` if the object is not
+    /// valid or if no such condition is found.  The condition is taken from
+    /// the comparisons of a property with a literal (e.g., `x == "foo"` or
+    /// `x > 42`) which are operands of the top level `&&` operators of the
+    /// expression.  Note that this can be used to index expressions, to
+    /// skip evaluating the ones which cannot match a set of properties.
+    bool loadPropertyConstraint(PropertyConstraint* constraint) const;
+
     /// Return `true` if the object contains an expression, resulting from
     /// the successful compilation of a string. `evaluate` can be called
     /// only if `isValid()` returns `true`.
@@ -722,6 +1109,15 @@ inline const char* ErrorType::toString(ErrorType::Enum value)
     }
 }
 
+// ------------------------
+// class PropertyConstraint
+// ------------------------
+
+inline bool PropertyConstraint::isEquality() const
+{
+    return d_type == e_STRING || d_min == d_max;
+}
+
 // ---------------------
 // class SimpleEvaluator
 // ---------------------
@@ -746,6 +1142,29 @@ inline SimpleEvaluator::IntegerLiteral::IntegerLiteral(
 {
 }
 
+inline bsls::Types::Int64 SimpleEvaluator::IntegerLiteral::value() const
+{
+    return d_value;
+}
+
+// ------------------------------------
+// class SimpleEvaluator::StringLiteral
+// ------------------------------------
+
+inline const bsl::string& SimpleEvaluator::StringLiteral::value() const
+{
+    return d_value;
+}
+
+// -------------------------------
+// class SimpleEvaluator::Property
+// -------------------------------
+
+inline const bsl::string& SimpleEvaluator::Property::name() const
+{
+    return d_name;
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -830,6 +1249,28 @@ SimpleEvaluator::Comparison<Op>::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::Comparison<Op>::emit(Program* program) const
+{
+    const bsl::size_t left = program->size();
+    d_left->emit(program);
+
+    const bsl::size_t right = program->size();
+    d_right->emit(program);
+
+    program->emitBinary(Instruction::fromOperator<Op>(), left, right);
+}
+
+template <template <typename> class Op>
+bool SimpleEvaluator::Comparison<Op>::loadConstraint(
+    PropertyConstraint* constraint) const
+{
+    return loadComparisonConstraint(constraint,
+                                    Instruction::fromOperator<Op>(),
+                                    *d_left,
+                                    *d_right);
+}
+
 // ----------------------------------
 // template class SimpleEvaluator::Or
 // ----------------------------------
@@ -911,6 +1352,80 @@ bdld::Datum SimpleEvaluator::NumBinaryOperation<Op>::evaluate(
     return bdld::Datum::createInteger64(result, context.d_allocator);
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::NumBinaryOperation<Op>::emit(Program* program) const
+{
+    const bsl::size_t left = program->size();
+    d_left->emit(program);
+
+    const bsl::size_t right = program->size();
+    d_right->emit(program);
+
+    program->emitBinary(Instruction::fromOperator<Op>(), left, right);
+}
+
+// -----------------------------------
+// struct SimpleEvaluator::Instruction
+// -----------------------------------
+
+template <template <typename> class Op>
+inline SimpleEvaluator::Instruction::Opcode
+SimpleEvaluator::Instruction::fromOperator()
+{
+    typedef bsls::Types::Int64 Int64;
+
+    if (bsl::is_same<Op<Int64>, bsl::equal_to<Int64> >::value) {
+        return e_EQUAL;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::not_equal_to<Int64> >::value) {
+        return e_NOT_EQUAL;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::less<Int64> >::value) {
+        return e_LESS;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::less_equal<Int64> >::value) {
+        return e_LESS_EQUAL;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::greater<Int64> >::value) {
+        return e_GREATER;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::greater_equal<Int64> >::value) {
+        return e_GREATER_EQUAL;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::plus<Int64> >::value) {
+        return e_PLUS;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::minus<Int64> >::value) {
+        return e_MINUS;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::multiplies<Int64> >::value) {
+        return e_MULTIPLIES;  // RETURN
+    }
+    if (bsl::is_same<Op<Int64>, bsl::divides<Int64> >::value) {
+        return e_DIVIDES;  // RETURN
+    }
+
+    // The only other operator used by the parser.
+    BSLS_ASSERT_SAFE(
+        (bsl::is_same<Op<Int64>, bsl::modulus<Int64> >::value));
+
+    return e_MODULUS;
+}
+
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+inline bsl::size_t SimpleEvaluator::Program::size() const
+{
+    return d_code.size();
+}
+
+inline int SimpleEvaluator::Program::maxStackSize() const
+{
+    return d_maxStackSize;
+}
+
 // ------------------------------------------
 // template class SimpleEvaluator::UnaryMinus
 // ------------------------------------------
@@ -29,6 +29,7 @@
 #include <mwctst_testhelper.h>
 
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_limits.h>
 #include <bsl_sstream.h>
 
 // CONVENIENCE
@@ -77,10 +78,11 @@ class MockPropertiesReader : public PropertiesReader {
 };
 
 #ifdef BSLS_PLATFORM_OS_LINUX
-static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
+/// Benchmark the evaluation of an expression, by running its compiled form
+/// if the specified `compiled` is `true`, and by walking its syntax tree
+/// otherwise.
+static void benchmarkEvaluation(benchmark::State& state, bool compiled)
 {
-    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: SimpleEvaluator");
-
     bdlma::LocalSequentialAllocator<2048> localAllocator;
     MockPropertiesReader                  reader(&localAllocator);
     EvaluationContext evaluationContext(&reader, &localAllocator);
@@ -92,19 +94,50 @@ static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
                              compilationContext) == 0);
 
     ASSERT_EQ(evaluator.evaluate(evaluationContext), true);
+    ASSERT_EQ(evaluator.evaluateTree(evaluationContext), true);
 
     // <time>
-    for (auto _ : state) {
-        evaluator.evaluate(evaluationContext);
+    if (compiled) {
+        for (auto _ : state) {
+            evaluator.evaluate(evaluationContext);
+        }
+    }
+    else {
+        for (auto _ : state) {
+            evaluator.evaluateTree(evaluationContext);
+        }
     }
     // </time>
 }
+
+static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: SimpleEvaluator");
+
+    benchmarkEvaluation(state, true);
+}
+
+static void
+testN1_SimpleEvaluatorTree_GoogleBenchmark(benchmark::State& state)
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator (syntax tree)");
+
+    benchmarkEvaluation(state, false);
+}
 #else
 static void testN1_SimpleEvaluator()
 {
     mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: SimpleEvaluator");
     PV("GoogleBenchmark is not supported on this platform, skipping...")
 }
+
+static void testN1_SimpleEvaluatorTree()
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator (syntax tree)");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
 #endif
 
 // ============================================================================
@@ -482,6 +515,197 @@ static void test3_evaluation()
     }
 }
 
+static void test4_compiledEvaluation()
+{
+    MockPropertiesReader reader(s_allocator_p);
+
+    const char* expressions[] = {
+        // literals folded into a single one
+        "i_1 == 2 * 3 - 5",
+        "i_1 == -(-1)",
+        "s_foo == \"foo\" && \"a\" < \"b\"",
+        "i_1 == 7 / 2 - 7 % 2 * 2",
+        "b_true && !false",
+        "b_true && 1 + 1 == 2",
+
+        // divisions by zero are not folded
+        "i_1 == 0 && 1 / 0 == 1",
+        "i_1 == 0 && 1 % 0 == 1",
+
+        // short-circuits
+        "false && i_0",
+        "true || i_0",
+        "true && b_false",
+        "false || b_true",
+        "b_false && unknown",
+        "b_true || unknown",
+        "b_true && b_false || i_1 == 1",
+        "(b_false || b_true) && (i_2 > 1 || unknown)",
+        "!(b_true && (b_false || i64_42 >= 42))",
+
+        // type errors
+        "true && i_0",
+        "false || i_0",
+        "1 && b_true",
+        "b_true && i_0",
+        "b_false || s_foo",
+        "i_1 == s_foo",
+        "s_foo == 1",
+        "s_foo < i_1",
+        "-s_foo == 0",
+        "!i_1",
+        "i_1 + b_true == 1",
+        "i_1 + 1",
+        "i_1 == 1 + true",
+        "s_foo == \"a\" + \"b\"",
+
+        // undefined properties
+        "unknown",
+        "unknown == 1",
+        "i_1 == unknown",
+        "b_true && unknown",
+        "b_false || unknown",
+        "i_1 + unknown > 0",
+
+        // mixed
+        "i_0 < i_1 && i_1 < i_2 && b_true",
+        "i_42 == i64_42 && s_foo >= \"foo\" && s_foo != \"bar\"",
+        "-i_3 * 2 + i64_42 % 5 == -4",
+        "(i_1 + i_2) * i_3 == 9 || unknown",
+    };
+    const char** expressionsEnd = expressions + sizeof(expressions) /
+                                                    sizeof(*expressions);
+
+    for (const char** expression = expressions; expression < expressionsEnd;
+         ++expression) {
+        PV(bsl::string("TESTING ") + *expression);
+
+        CompilationContext compilationContext(s_allocator_p);
+        SimpleEvaluator    evaluator;
+
+        ASSERT_EQ(evaluator.compile(*expression, compilationContext), 0);
+        ASSERT(evaluator.isValid());
+
+        if (!evaluator.isValid()) {
+            continue;  // CONTINUE
+        }
+
+        EvaluationContext compiledContext(&reader, s_allocator_p);
+        EvaluationContext treeContext(&reader, s_allocator_p);
+
+        const bool compiledResult = evaluator.evaluate(compiledContext);
+        const bool treeResult     = evaluator.evaluateTree(treeContext);
+
+        ASSERT_EQ_D(*expression, compiledResult, treeResult);
+        ASSERT_EQ_D(*expression,
+                    compiledContext.hasError(),
+                    treeContext.hasError());
+        ASSERT_EQ_D(*expression,
+                    compiledContext.lastError(),
+                    treeContext.lastError());
+    }
+}
+
+static void test5_propertyConstraint()
+{
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_MIN = bsl::numeric_limits<Int64>::min();
+    const Int64 k_MAX = bsl::numeric_limits<Int64>::max();
+
+    const PropertyConstraint::Type k_STRING  = PropertyConstraint::e_STRING;
+    const PropertyConstraint::Type k_INTEGER = PropertyConstraint::e_INTEGER;
+
+    struct TestParameters {
+        const char*              expression;
+        bool                     expected;
+        const char*              name;
+        PropertyConstraint::Type type;
+        const char*              string;
+        Int64                    min;
+        Int64                    max;
+    } testParameters[] = {
+        {"s_foo == \"foo\"", true, "s_foo", k_STRING, "foo", 0, 0},
+        {"\"foo\" == s_foo", true, "s_foo", k_STRING, "foo", 0, 0},
+        {"i_1 == 42", true, "i_1", k_INTEGER, "", 42, 42},
+        {"i_1 < 42", true, "i_1", k_INTEGER, "", k_MIN, 41},
+        {"i_1 <= 42", true, "i_1", k_INTEGER, "", k_MIN, 42},
+        {"i_1 > 42", true, "i_1", k_INTEGER, "", 43, k_MAX},
+        {"i_1 >= 42", true, "i_1", k_INTEGER, "", 42, k_MAX},
+        {"42 < i_1", true, "i_1", k_INTEGER, "", 43, k_MAX},
+        {"42 >= i_1", true, "i_1", k_INTEGER, "", k_MIN, 42},
+
+        // conjunctions
+        {"i_1 >= 0 && i_1 < 10", true, "i_1", k_INTEGER, "", 0, 9},
+        {"i_1 > 0 && s_foo == \"foo\"", true, "s_foo", k_STRING, "foo", 0, 0},
+        {"b_true && i_1 == 1", true, "i_1", k_INTEGER, "", 1, 1},
+        {"b_true && (i_1 > 1 && b_false)",
+         true,
+         "i_1",
+         k_INTEGER,
+         "",
+         2,
+         k_MAX},
+        {"i_1 == 1 && i_1 == 2", true, "i_1", k_INTEGER, "", 2, 1},
+
+        // no constraint
+        {"b_true", false},
+        {"s_foo != \"foo\"", false},
+        {"s_foo < \"foo\"", false},
+        {"i_1 != 42", false},
+        {"i_1 == i_2", false},
+        {"i_1 + 1 == 42", false},
+        {"i_1 == 42 || s_foo == \"foo\"", false},
+        {"!(i_1 == 42)", false},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(s_allocator_p);
+        SimpleEvaluator    evaluator;
+        PropertyConstraint constraint(s_allocator_p);
+
+        ASSERT(!evaluator.loadPropertyConstraint(&constraint));
+        ASSERT_EQ(evaluator.compile(parameters->expression,
+                                    compilationContext),
+                  0);
+        ASSERT_EQ_D(parameters->expression,
+                    evaluator.loadPropertyConstraint(&constraint),
+                    parameters->expected);
+
+        if (!parameters->expected) {
+            continue;  // CONTINUE
+        }
+
+        ASSERT_EQ_D(parameters->expression,
+                    constraint.d_name,
+                    parameters->name);
+        ASSERT_EQ_D(parameters->expression,
+                    constraint.d_type,
+                    parameters->type);
+
+        if (parameters->type == k_STRING) {
+            ASSERT_EQ_D(parameters->expression,
+                        constraint.d_string,
+                        parameters->string);
+        }
+        else {
+            ASSERT_EQ_D(parameters->expression,
+                        constraint.d_min,
+                        parameters->min);
+            ASSERT_EQ_D(parameters->expression,
+                        constraint.d_max,
+                        parameters->max);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -492,10 +716,15 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_propertyConstraint(); break;
+    case 4: test4_compiledEvaluation(); break;
     case 3: test3_evaluation(); break;
     case 2: test2_propertyNames(); break;
     case 1: test1_compilationErrors(); break;
-    case -1: MWC_BENCHMARK(testN1_SimpleEvaluator); break;
+    case -1:
+        MWC_BENCHMARK(testN1_SimpleEvaluator);
+        MWC_BENCHMARK(testN1_SimpleEvaluatorTree);
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -22,6 +22,7 @@
 #include <bmqimp_queue.h>
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_ackmessageiterator.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmeventbuilder.h>
 #include <bmqp_confirmmessageiterator.h>
 #include <bmqp_controlmessageutil.h>
@@ -398,6 +399,28 @@ void BrokerSession::SessionFsm::setStarted(
 
     d_session.d_channel_sp = channel;
 
+    // Compress whole PUT events only if the broker supports it, falling back
+    // to ZLIB if it does not support the configured algorithm.
+    int isEventCompressionSupported = 0;
+    int compressionAlgorithms       = 0;
+    d_session.d_putEventCompressionAlgorithm =
+        channel->properties().load(
+            &isEventCompressionSupported,
+            NegotiatedChannelFactory::k_CHANNEL_PROPERTY_EVENT_COMPRESSION)
+            ? d_session.d_sessionOptions.putEventCompressionAlgorithmType()
+            : bmqt::CompressionAlgorithmType::e_NONE;
+    if (d_session.d_putEventCompressionAlgorithm !=
+            bmqt::CompressionAlgorithmType::e_NONE &&
+        (!channel->properties().load(
+             &compressionAlgorithms,
+             NegotiatedChannelFactory::
+                 k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS) ||
+         !(compressionAlgorithms &
+           (1 << d_session.d_putEventCompressionAlgorithm)))) {
+        d_session.d_putEventCompressionAlgorithm =
+            bmqt::CompressionAlgorithmType::e_ZLIB;
+    }
+
     setState(State::e_STARTED, event);
     d_onceConnected            = true;
     d_session.d_acceptRequests = true;
@@ -1196,6 +1219,43 @@ void BrokerSession::QueueFsm::actionInitQueue(
             resp.deduplicationTimeMs();
     }
 
+    // Register the compression dictionaries of the queue, if any: the first
+    // one is used to compress the messages posted on the queue, and all of
+    // them may be needed to decompress the messages received from it.  The
+    // queue holds them so that they remain registered, and releasing the
+    // ones of a previous open unregisters them unless still used elsewhere.
+    bsl::shared_ptr<bmqp::CompressionDictionary> compressionDictionary;
+    Queue::CompressionDictionaries               compressionDictionaries(
+        d_session.d_allocator_p);
+    const bsl::vector<bsl::vector<char> >&       dictionaries =
+        resp.compressionDictionaries();
+    for (size_t i = 0; i < dictionaries.size(); ++i) {
+        bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+        mwcu::MemOutStream                           error;
+        const int rc = bmqp::CompressionDictionaryUtil::loadAndRegister(
+            &dictionary,
+            dictionaries[i].data(),
+            static_cast<int>(dictionaries[i].size()),
+            &error,
+            d_session.d_allocator_p);
+        if (rc != 0) {
+            BALL_LOG_WARN << "Unable to register compression dictionary of "
+                          << "queue '" << queue->uri() << "' [reason: '"
+                          << error.str() << "', rc: " << rc << "]";
+            continue;  // CONTINUE
+        }
+
+        if (i == 0) {
+            compressionDictionary = dictionary;
+        }
+        compressionDictionaries.push_back(dictionary);
+    }
+
+    if (queue->compressionDictionary() != compressionDictionary) {
+        queue->setCompressionDictionary(compressionDictionary);
+    }
+    queue->setCompressionDictionaries(compressionDictionaries);
+
     // Do not register queue stats if stats are disabled or queue is reopening
     if (!isReopenRequest && d_session.d_queuesStats.d_statContext_mp) {
         queue->registerStatContext(
@@ -3355,9 +3415,35 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
+        // Compress the whole event, if enabled, and only send the compressed
+        // event if it is smaller.  Note that messages are enabled for
+        // retransmission below out of the uncompressed 'event'.
+        const bdlbb::Blob* blob = event.blob();
+        bdlbb::Blob        compressedBlob(d_bufferFactory_p, d_allocator_p);
+        if (d_putEventCompressionAlgorithm !=
+                bmqt::CompressionAlgorithmType::e_NONE &&
+            blob->length() >= bmqp::Protocol::k_COMPRESSION_MIN_EVENT_SIZE) {
+            const int rc = bmqp::EventUtil::compressPutEvent(
+                &compressedBlob,
+                *blob,
+                d_putEventCompressionAlgorithm,
+                d_bufferFactory_p,
+                d_allocator_p);
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                BALL_LOG_WARN << "Failed to compress PUT event, sending it "
+                              << "uncompressed [rc: " << rc
+                              << ", algorithm: "
+                              << d_putEventCompressionAlgorithm << "]";
+            }
+            else if (compressedBlob.length() < blob->length()) {
+                blob = &compressedBlob;
+            }
+        }
+
         // Post the event.
         bmqt::GenericResult::Enum res = writeOrBuffer(
-            *event.blob(),
+            *blob,
             d_sessionOptions.channelHighWatermark());
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -3565,8 +3651,8 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
                 }
             }
 
-            // Add to event queue
-            d_eventQueue.pushBack(queueEvent);
+            // Deliver to the application
+            deliverMessageEvent(queueEvent);
         }
     }
 
@@ -3649,9 +3735,10 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(numAckMsgs == queueEvent->numCorrrelationIds());
 
-    // Add to event queue. Note that we are now forwarding an ACK event which
-    // may contain certain unset correlationIds with non-zero ack status.
-    d_eventQueue.pushBack(queueEvent);
+    // Deliver to the application.  Note that we are now forwarding an ACK
+    // event which may contain certain unset correlationIds with non-zero ack
+    // status.
+    deliverMessageEvent(queueEvent);
 
     // Update stats
     d_eventsStats.onEvent(EventsStatsEventType::e_ACK,
@@ -3659,6 +3746,27 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
                           numAckMsgs);
 }
 
+void BrokerSession::deliverMessageEvent(bsl::shared_ptr<Event>& event)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(event->type() == Event::EventType::e_MESSAGE);
+
+    if (!d_inlineMessageEventDelivery) {
+        d_eventQueue.pushBack(event);
+        return;  // RETURN
+    }
+
+    // Invoke the session event handler directly from this thread, saving
+    // the hand-off to (and the wake up of) an event handler thread.  This
+    // goes through 'eventHandlerCbWrapper' so that the handler is accounted
+    // for when stopping the session; note that the special DISCONNECTED
+    // event releasing the stop semaphore is enqueued from this thread, so it
+    // can only be processed after this handler returned.
+    d_eventQueue.dispatchInline(event);
+}
+
 bmqt::OpenQueueResult::Enum
 BrokerSession::openQueueImp(const bsl::shared_ptr<Queue>&  queue,
                             bsls::TimeInterval             timeout,
@@ -5579,6 +5687,7 @@ BrokerSession::BrokerSession(
 , d_scheduler_p(scheduler)
 , d_bufferFactory_p(bufferFactory)
 , d_channel_sp()
+, d_putEventCompressionAlgorithm(bmqt::CompressionAlgorithmType::e_NONE)
 , d_extensionBlobBuffer(allocator)
 , d_acceptRequests(false)
 , d_extensionBufferEmpty(true)
@@ -5587,6 +5696,8 @@ BrokerSession::BrokerSession(
 , d_eventsStats(allocator)
 , d_stateCb(bsl::allocator_arg, allocator, stateCb)
 , d_usingSessionEventHandler(eventHandlerCb)  // UnspecifiedBool operator ...
+, d_inlineMessageEventDelivery(eventHandlerCb &&
+                               sessionOptions.inlineMessageEventDelivery())
 , d_messageCorrelationIdContainer(
       d_allocators.get("messageCorrelationIdContainer"))
 , d_fsmThread(bslmt::ThreadUtil::invalidHandle())
@@ -5664,6 +5775,10 @@ BrokerSession::BrokerSession(
     }
 
     // Start user event queue
+    if (d_usingSessionEventHandler) {
+        d_eventQueue.setBusyPollDuration(
+            sessionOptions.eventQueueBusyPollDuration());
+    }
     if (d_eventQueue.start() != bmqt::GenericResult::e_SUCCESS) {
         BSLS_ASSERT_OPT(false && "Failed to start user event queue");
     }
@@ -5937,6 +6052,16 @@ void BrokerSession::onOpenQueueResponse(
             BSLS_ASSERT_SAFE(isMPsEx);
             queue->setOldStyle(false);
         }
+
+        // Messages posted on the queue may only be compressed with the
+        // algorithms supported by the broker (see 'packMessage').
+        int compressionAlgorithms;
+        if (d_channel_sp->properties().load(
+                &compressionAlgorithms,
+                NegotiatedChannelFactory::
+                    k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS)) {
+            queue->setCompressionAlgorithms(compressionAlgorithms);
+        }
     }
 
     handleQueueFsmEvent(context,
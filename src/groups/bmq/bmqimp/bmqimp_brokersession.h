@@ -701,6 +701,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Channel to use for communication,
     // held not owned
 
+    bmqt::CompressionAlgorithmType::Enum d_putEventCompressionAlgorithm;
+    // Compression algorithm to apply to
+    // the whole body of PUT events sent
+    // on 'd_channel_sp', or 'e_NONE' if
+    // disabled or not supported by the
+    // broker.
+
     bsl::deque<bdlbb::Blob> d_extensionBlobBuffer;
     // Buffer to store event blobs when
     // they cannot be sent due to the
@@ -752,6 +759,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     // false if the user didn't specify
     // one (and will use nextEvent).
 
+    bool d_inlineMessageEventDelivery;
+    // True if message events received
+    // from the broker are delivered to
+    // the session event handler from the
+    // FSM thread, bypassing the event
+    // queue.
+
     MessageCorrelationIdContainer d_messageCorrelationIdContainer;
     // Message correlationId container
 
@@ -963,6 +977,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// broker) is available on the channel.
     void processAckEvent(const bmqp::Event& event);
 
+    /// Deliver the specified message `event` (received from the broker) to
+    /// the application: invoke the session event handler with it from the
+    /// calling thread if the session was configured with the
+    /// `inlineMessageEventDelivery` option, or enqueue it to the event
+    /// queue otherwise.
+    void deliverMessageEvent(bsl::shared_ptr<Event>& event);
+
     /// Callback invoked in reply to a `disconnect` with the specified
     /// `context`.
     void onDisconnectResponse(const RequestManagerType::RequestSp& context);
@@ -60,6 +60,10 @@ enum {
     k_STAT_TIME = 1  // Event queued time
 };
 
+/// Number of back-to-back attempts made when busy-polling the queue before
+/// starting to yield the CPU in between attempts
+const int k_BUSY_POLL_NUM_SPINS = 64;
+
 }  // close unnamed namespace
 
 // ----------------------------
@@ -186,6 +190,32 @@ bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
     return false;
 }
 
+bool EventQueue::busyPollFront(QueueItem* item)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_busyPollDurationNs > 0);
+
+    const bsls::Types::Int64 deadline = mwcsys::Time::highResolutionTimer() +
+                                        d_busyPollDurationNs;
+    int numAttempts = 0;
+
+    do {
+        if (d_queue.tryPopFront(item) == 0) {
+            return true;  // RETURN
+        }
+
+        // Spin for a few attempts first, as the next item typically arrives
+        // very shortly after the previous one in a burst; then yield so that
+        // other threads (e.g., the one pushing to this queue) can make
+        // progress when there are fewer cores than busy threads.
+        if (++numAttempts > k_BUSY_POLL_NUM_SPINS) {
+            bslmt::ThreadUtil::yield();
+        }
+    } while (mwcsys::Time::highResolutionTimer() < deadline);
+
+    return false;
+}
+
 void EventQueue::afterEventPopped(const QueueItem& item)
 {
     const bsls::Types::Int64 popOutTime = mwcsys::Time::highResolutionTimer();
@@ -289,6 +319,7 @@ EventQueue::EventQueue(EventPool*                  eventPool,
 , d_statTip(&d_statTable, allocator)
 , d_statTipNoDelta(&d_statTable, allocator)
 , d_pushBackSpinlock(bsls::SpinLock::s_unlocked)
+, d_busyPollDurationNs(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT((eventHandler && numProcessingThreads > 0) ||
@@ -323,6 +354,15 @@ EventQueue::~EventQueue()
     stop();
 }
 
+void EventQueue::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0));
+    BSLS_ASSERT_OPT(!d_threadPool_mp && "Must be called before 'start'");
+
+    d_busyPollDurationNs = value.totalNanoseconds();
+}
+
 void EventQueue::initializeStats(
     mwcst::StatContext*                       rootStatContext,
     const mwcst::StatValue::SnapshotLocation& start,
@@ -546,9 +586,11 @@ bsl::shared_ptr<Event> EventQueue::popFront()
 
     // Look in the queue
     QueueItem item;
-    const int rc = d_queue.popFront(&item);
-    BSLS_ASSERT_SAFE(rc == 0);
-    (void)rc;
+    if (d_busyPollDurationNs == 0 || !busyPollFront(&item)) {
+        const int rc = d_queue.popFront(&item);
+        BSLS_ASSERT_SAFE(rc == 0);
+        (void)rc;
+    }
     event = item.d_event_sp;
     afterEventPopped(item);
     return event;
@@ -629,6 +671,17 @@ void EventQueue::enqueuePoisonPill()
     }
 }
 
+void EventQueue::dispatchInline(const bsl::shared_ptr<Event>& event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_eventHandler);
+    BSLS_ASSERT_SAFE(event);
+
+    BALL_LOG_TRACE << "Dispatching inline " << *event;
+
+    d_eventHandler(event);
+}
+
 void EventQueue::printStats(bsl::ostream& stream, bool includeDelta) const
 {
     // PRECONDITIONS
@@ -33,6 +33,19 @@
 // The queue has a built-in monitoring mechanism that will emit alarms when it
 // reaches certain user-customizable thresholds.
 //
+/// Busy-polling
+///------------
+// By default, a thread popping from an empty queue blocks until an item is
+// pushed, and must then be woken up by the OS, which adds a latency of
+// typically a few tens of microseconds (and much more in the tail) to the
+// delivery of that item.  Using 'setBusyPollDuration', the queue can be
+// configured so that 'popFront' (and therefore the processing threads) first
+// polls the queue for up to the specified duration, spinning for a small
+// number of attempts then yielding the CPU in between attempts, before
+// falling back to blocking.  This trades CPU usage of otherwise idle
+// threads for a lower and more predictable latency when items are pushed
+// shortly after one another.
+//
 /// Statistics
 ///----------
 // If configured for the queue can keep keep track of the following statistics:
@@ -284,6 +297,12 @@ class EventQueue {
     // SpinLock to synchronize
     // 'pushBack'
 
+    bsls::Types::Int64 d_busyPollDurationNs;
+    // Duration (in nanoseconds) during
+    // which 'popFront' polls the queue
+    // before blocking on it, or 0 to
+    // block immediately.
+
   private:
     // NOT IMPLEMENTED
     EventQueue(const EventQueue& other) BSLS_CPP11_DELETED;
@@ -304,6 +323,11 @@ class EventQueue {
     /// prioritized events was scheduled.
     bool hasPriorityEvents(bsl::shared_ptr<Event>* event);
 
+    /// Poll the queue for up to the configured busy-poll duration; return
+    /// true and load the front item into the specified `item` if one was
+    /// popped within that duration, and return false otherwise.
+    bool busyPollFront(QueueItem* item);
+
     /// Called after the specified `item` was successfully popped out from
     /// the queue, just before it being delivered to the caller.
     void afterEventPopped(const QueueItem& item);
@@ -341,6 +365,12 @@ class EventQueue {
 
     // MANIPULATORS
 
+    /// Set the duration during which `popFront` polls the queue before
+    /// blocking on it to the specified `value`; a value of 0 (the default)
+    /// disables busy-polling.  The behavior is undefined unless `value` is
+    /// non-negative and this method is called before `start`.
+    void setBusyPollDuration(const bsls::TimeInterval& value);
+
     /// Configure this component to keep track of statistics: create a
     /// sub-context from the specified `rootStatContext`, using the
     /// specified `start` and `end` snapshot location.
@@ -363,7 +393,8 @@ class EventQueue {
     int pushBack(bsl::shared_ptr<Event>& event);
 
     /// Return the front item of the queue, if the queue is not empty; or
-    /// block and wait until an item is being pushed to the queue.
+    /// busy-poll for up to the configured busy-poll duration, if any, and
+    /// then block and wait until an item is being pushed to the queue.
     bsl::shared_ptr<Event> popFront();
 
     /// Return the front item of the queue, if the queue is not empty; or
@@ -384,6 +415,14 @@ class EventQueue {
     /// condition for the thread reading items from the queue.
     void enqueuePoisonPill();
 
+    /// Invoke the `eventHandler` provided at construction with the
+    /// specified `event` from the calling thread, bypassing the queue
+    /// entirely: `event` is not accounted for in the statistics nor in the
+    /// watermarks of this queue, and is not ordered with respect to the
+    /// items of this queue.  The behavior is undefined unless an
+    /// `eventHandler` was provided at construction.
+    void dispatchInline(const bsl::shared_ptr<Event>& event);
+
     // ACCESSORS
 
     /// Return the event pool use by this object.
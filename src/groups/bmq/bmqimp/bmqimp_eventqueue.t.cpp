@@ -33,6 +33,7 @@
 #include <bdlt_timeunitratio.h>
 #include <bmqimp_stat.h>
 #include <bslma_managedptr.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
@@ -654,6 +655,131 @@ static void test6_workingStatsTest()
     ASSERT_EQ(valTime.max(), k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_busyPollTest()
+// ------------------------------------------------------------------------
+// BUSY POLL TEST
+//
+// Concerns:
+//   1. Check that bmqimp::EventQueue configured to busy-poll returns items
+//      pushed before, during and after the busy-poll duration.
+//   2. Check that processing threads busy-polling the queue deliver all the
+//      events to the event handler, and terminate on poison pills.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue without event handler, configure a
+//      busy-poll duration, push an item and check it is popped.  Then pop
+//      from another thread, and push an item while it is busy-polling and
+//      after the busy-poll duration has elapsed.
+//   2. Create bmqimp::EventQueue with several processing threads
+//      configured to busy-poll, enqueue 'k_NUM_EVENTS' events, stop the
+//      queue and check that the handler is called exactly 'k_NUM_EVENTS'
+//      times.
+//
+// Testing manipulators:
+//   - setBusyPollDuration
+//   - popFront
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BUSY POLL");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqimp::EventQueue::EventPool  eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        s_allocator_p);
+
+    const bsls::TimeInterval k_BUSY_POLL_DURATION(0.05);  // 50ms
+
+    {
+        PVV("No event handler");
+        bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+        bmqimp::EventQueue obj(&eventPool,
+                               100,  // initialCapacity
+                               3,    // lowWatermark
+                               90,   // highWatermark
+                               emptyEventHandler,
+                               0,  // numProcessingThreads
+                               s_allocator_p);
+
+        obj.setBusyPollDuration(k_BUSY_POLL_DURATION);
+        ASSERT_EQ(obj.start(), 0);
+
+        // Item already in the queue
+        bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED);
+        obj.pushBack(event);
+        ASSERT_EQ(obj.popFront(), event);
+
+        // Items pushed while the popping thread is busy-polling, and after
+        // it has fallen back to blocking
+        bdlmt::ThreadPool threadPool(bslmt::ThreadAttributes(),
+                                     1,  // minThreads
+                                     1,  // maxThreads
+                                     bsl::numeric_limits<int>::max(),
+                                     s_allocator_p);
+        ASSERT_EQ(threadPool.start(), 0);
+        threadPool.enqueueJob(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &performanceTestQueuePopper,
+                                  &obj,
+                                  2));
+
+        bslmt::ThreadUtil::microSleep(1000);  // within the busy-poll
+        event = eventPool.getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED);
+        obj.pushBack(event);
+
+        bslmt::ThreadUtil::microSleep(0, 1);  // past the busy-poll
+        event = eventPool.getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED);
+        obj.pushBack(event);
+
+        threadPool.drain();
+
+        // Both items were popped by the other thread
+        ASSERT_EQ(
+            obj.timedPopFront(bsls::TimeInterval(0.01))->sessionEventType(),
+            bmqt::SessionEventType::e_TIMEOUT);
+    }
+
+    {
+        PVV("Event handler");
+        const int       k_NUM_THREADS = 4;
+        const int       k_NUM_EVENTS  = 50;
+        bsls::AtomicInt eventCounter;
+
+        bmqimp::EventQueue obj(&eventPool,
+                               100,  // initialCapacity
+                               3,    // lowWatermark
+                               90,   // highWatermark
+                               bdlf::BindUtil::bind(&eventHandler,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bsl::ref(eventCounter)),
+                               k_NUM_THREADS,  // numProcessingThreads
+                               s_allocator_p);
+
+        obj.setBusyPollDuration(k_BUSY_POLL_DURATION);
+        ASSERT_EQ(obj.start(), 0);
+
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED);
+            obj.pushBack(event);
+            if (i % 10 == 0) {
+                bslmt::ThreadUtil::microSleep(100);
+            }
+        }
+
+        obj.stop();
+
+        ASSERT_EQ(eventCounter, k_NUM_EVENTS);
+    }
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -716,6 +842,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_busyPollTest(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
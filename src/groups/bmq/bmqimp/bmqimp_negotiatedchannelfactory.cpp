@@ -21,6 +21,7 @@
 #include <bmqp_event.h>
 #include <bmqp_protocol.h>
 #include <bmqp_schemaeventbuilder.h>
+#include <bmqt_compressionalgorithmtype.h>
 
 // MWC
 #include <mwcio_channelutil.h>
@@ -100,6 +101,13 @@ NegotiatedChannelFactoryConfig::NegotiatedChannelFactoryConfig(
 const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_MPS_EX =
     "broker.response.mps.ex";
 
+const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_EVENT_COMPRESSION =
+    "broker.response.cmp.event";
+
+const char*
+    NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS =
+        "broker.response.cmp.algorithms";
+
 // PRIVATE ACCESSORS
 void NegotiatedChannelFactory::baseResultCallback(
     const ResultCallback&                  userCb,
@@ -322,6 +330,32 @@ void NegotiatedChannelFactory::onBrokerNegotiationResponse(
         channel->properties().set(k_CHANNEL_PROPERTY_MPS_EX, 1);
     }
 
+    if (bmqp::ProtocolUtil::hasFeature(
+            bmqp::CompressionFeatures::k_FIELD_NAME,
+            bmqp::CompressionFeatures::k_EVENT,
+            response.brokerResponse().brokerIdentity().features())) {
+        channel->properties().set(k_CHANNEL_PROPERTY_EVENT_COMPRESSION, 1);
+    }
+
+    // Algorithms added after ZLIB are only supported by the brokers
+    // advertising them.
+    int compressionAlgorithms = (1 << bmqt::CompressionAlgorithmType::e_NONE) |
+                                (1 << bmqt::CompressionAlgorithmType::e_ZLIB);
+    if (bmqp::ProtocolUtil::hasFeature(
+            bmqp::CompressionFeatures::k_FIELD_NAME,
+            bmqp::CompressionFeatures::k_ZSTD,
+            response.brokerResponse().brokerIdentity().features())) {
+        compressionAlgorithms |= 1 << bmqt::CompressionAlgorithmType::e_ZSTD;
+    }
+    if (bmqp::ProtocolUtil::hasFeature(
+            bmqp::CompressionFeatures::k_FIELD_NAME,
+            bmqp::CompressionFeatures::k_LZ4,
+            response.brokerResponse().brokerIdentity().features())) {
+        compressionAlgorithms |= 1 << bmqt::CompressionAlgorithmType::e_LZ4;
+    }
+    channel->properties().set(k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS,
+                              compressionAlgorithms);
+
     cb(mwcio::ChannelFactoryEvent::e_CHANNEL_UP, mwcio::Status(), channel);
 }
 
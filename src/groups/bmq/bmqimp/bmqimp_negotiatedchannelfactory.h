@@ -107,6 +107,16 @@ class NegotiatedChannelFactory : public mwcio::ChannelFactory {
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     static const char* k_CHANNEL_PROPERTY_MPS_EX;
 
+    /// Name of a property set on the channel if the broker supports PUT
+    /// events having their whole body compressed.
+    static const char* k_CHANNEL_PROPERTY_EVENT_COMPRESSION;
+
+    /// Name of a property set on the channel to the compression algorithms
+    /// supported by the broker, where the algorithm having the
+    /// `bmqt::CompressionAlgorithmType::Enum` value `N` is supported if the
+    /// bit `N` is set.
+    static const char* k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS;
+
   private:
     // PRIVATE DATA
     Config d_config;
@@ -320,11 +320,15 @@ Queue::Queue(bslma::Allocator* allocator)
 , d_stats_mp(0)
 , d_isSuspended(false)
 , d_isOldStyle(true)
+, d_compressionAlgorithms((1 << bmqt::CompressionAlgorithmType::e_NONE) |
+                          (1 << bmqt::CompressionAlgorithmType::e_ZLIB))
 , d_isSuspendedWithBroker(false)
 , d_schemaGenerator(allocator)
 , d_schemaLearner(allocator)
 , d_schemaLearnerContext(d_schemaLearner.createContext())
 , d_config(allocator)
+, d_compressionDictionary_sp()
+, d_compressionDictionaries(allocator)
 , d_registeredInternalSubscriptionIds(allocator)
 {
     d_handleParameters.uri()   = "";
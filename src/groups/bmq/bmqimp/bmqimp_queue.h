@@ -31,10 +31,12 @@
 // BMQ
 #include <bmqimp_stat.h>
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemagenerator.h>
 #include <bmqp_schemalearner.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_queueoptions.h>
@@ -46,9 +48,11 @@
 
 // BDE
 #include <bsl_iosfwd.h>
+#include <bsl_memory.h>
 #include <bsl_optional.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -178,6 +182,9 @@ class Queue {
     typedef bsl::pair<unsigned int, bmqt::CorrelationId> SubscriptionHandle;
     // Not using private 'bmqt::SubscriptionHandle' ctor
 
+    typedef bsl::vector<bsl::shared_ptr<bmqp::CompressionDictionary> >
+        CompressionDictionaries;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -250,6 +257,13 @@ class Queue {
     // Temporary; shall remove after 2nd
     // roll out of "new style" brokers.
 
+    bsls::AtomicInt d_compressionAlgorithms;
+    // Compression algorithms supported by
+    // the broker for the messages posted
+    // on this queue, where the algorithm
+    // having the value 'N' is supported if
+    // the bit 'N' is set.
+
     bool d_isSuspendedWithBroker;
     // Whether the queue is suspended from
     // the perspective of the broker.
@@ -262,6 +276,19 @@ class Queue {
 
     bmqp_ctrlmsg::StreamParameters d_config;
 
+    bsl::shared_ptr<bmqp::CompressionDictionary> d_compressionDictionary_sp;
+    // Dictionary to compress the messages
+    // posted on this queue with, if any, as
+    // provided by the broker in the open
+    // queue response.
+
+    CompressionDictionaries d_compressionDictionaries;
+    // All the dictionaries provided by the
+    // broker in the open queue response,
+    // which remain registered to decompress
+    // the messages received from this queue
+    // as long as they are held.
+
     bsl::unordered_map<unsigned int, SubscriptionHandle>
         d_registeredInternalSubscriptionIds;
     // This keeps SubscriptionHandle (id and CorrelationId) for Configure
@@ -315,9 +342,30 @@ class Queue {
     /// and return a reference offering modifiable access to this object.
     Queue& setConfig(const bmqp_ctrlmsg::StreamParameters& value);
 
+    /// Set the compression dictionary of this queue to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  Note that this method is meant to be called while the queue
+    /// is being opened or reopened, prior to posting messages on it.
+    Queue& setCompressionDictionary(
+        const bsl::shared_ptr<bmqp::CompressionDictionary>& value);
+
+    /// Set the compression dictionaries of this queue, used to decompress
+    /// the messages received from it, to the specified `value` and return
+    /// a reference offering modifiable access to this object.  Note that
+    /// the dictionaries previously set are unregistered, unless they are
+    /// still used elsewhere.
+    Queue& setCompressionDictionaries(const CompressionDictionaries& value);
+
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     Queue& setOldStyle(bool value);
 
+    /// Set the compression algorithms supported by the broker for the
+    /// messages posted on this queue to the specified `value`, where the
+    /// algorithm having the value `N` is supported if the bit `N` of
+    /// `value` is set, and return a reference offering modifiable access to
+    /// this object.  Note that `e_NONE` and `e_ZLIB` are always supported.
+    Queue& setCompressionAlgorithms(int value);
+
     /// Create a new subcontext for this queue, out of the specified
     /// `parentStatContext`.  The behavior is undefined unless this method
     /// is called on valid queue in opened state.  The behavior is also
@@ -384,6 +432,15 @@ class Queue {
     bool                                  isOldStyle() const;
     const bmqp_ctrlmsg::StreamParameters& config() const;
 
+    /// Return true if the broker supports the messages posted on this queue
+    /// to be compressed with the specified `algorithm`, false otherwise.
+    bool isCompressionAlgorithmSupported(
+        bmqt::CompressionAlgorithmType::Enum algorithm) const;
+
+    /// Return the compression dictionary of this queue, if any.
+    const bsl::shared_ptr<bmqp::CompressionDictionary>&
+    compressionDictionary() const;
+
     bmqp::SchemaGenerator&        schemaGenerator();
     bmqp::SchemaLearner&          schemaLearner();
     bmqp::SchemaLearner::Context& schemaLearnerContext();
@@ -543,6 +600,14 @@ inline Queue& Queue::setOldStyle(bool value)
     return *this;
 }
 
+inline Queue& Queue::setCompressionAlgorithms(int value)
+{
+    d_compressionAlgorithms = value |
+                              (1 << bmqt::CompressionAlgorithmType::e_NONE) |
+                              (1 << bmqt::CompressionAlgorithmType::e_ZLIB);
+    return *this;
+}
+
 inline Queue& Queue::setIsSuspendedWithBroker(bool value)
 {
     d_isSuspendedWithBroker = value;
@@ -555,6 +620,20 @@ inline Queue& Queue::setConfig(const bmqp_ctrlmsg::StreamParameters& value)
     return *this;
 }
 
+inline Queue& Queue::setCompressionDictionary(
+    const bsl::shared_ptr<bmqp::CompressionDictionary>& value)
+{
+    d_compressionDictionary_sp = value;
+    return *this;
+}
+
+inline Queue&
+Queue::setCompressionDictionaries(const CompressionDictionaries& value)
+{
+    d_compressionDictionaries = value;
+    return *this;
+}
+
 inline void
 Queue::registerInternalSubscriptionId(unsigned int internalSubscriptionId,
                                       unsigned int subscriptionHandleId,
@@ -669,6 +748,12 @@ inline bool Queue::isOldStyle() const
     return d_isOldStyle;
 }
 
+inline bool Queue::isCompressionAlgorithmSupported(
+    bmqt::CompressionAlgorithmType::Enum algorithm) const
+{
+    return d_compressionAlgorithms & (1 << algorithm);
+}
+
 inline bool Queue::isSuspendedWithBroker() const
 {
     return d_isSuspendedWithBroker;
@@ -679,6 +764,12 @@ inline const bmqp_ctrlmsg::StreamParameters& Queue::config() const
     return d_config;
 }
 
+inline const bsl::shared_ptr<bmqp::CompressionDictionary>&
+Queue::compressionDictionary() const
+{
+    return d_compressionDictionary_sp;
+}
+
 inline bmqp::SchemaLearner& Queue::schemaLearner()
 {
     return d_schemaLearner;
@@ -22,6 +22,7 @@
 #include <bmqp_eventutil.h>
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_uri.h>
 
 // MWC
@@ -171,6 +172,26 @@ static void test2_settersTest()
     ASSERT_EQ(obj.handleParameters().adminCount(), 1);
 
     ASSERT(!obj.hasDefaultSubQueueId());
+
+    // Compression algorithms supported by the broker
+    typedef bmqt::CompressionAlgorithmType CAT;
+
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_NONE));
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_ZLIB));
+    ASSERT(!obj.isCompressionAlgorithmSupported(CAT::e_ZSTD));
+    ASSERT(!obj.isCompressionAlgorithmSupported(CAT::e_LZ4));
+
+    obj.setCompressionAlgorithms(1 << CAT::e_ZSTD);
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_NONE));
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_ZLIB));
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_ZSTD));
+    ASSERT(!obj.isCompressionAlgorithmSupported(CAT::e_LZ4));
+
+    obj.setCompressionAlgorithms(0);
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_NONE));
+    ASSERT(obj.isCompressionAlgorithmSupported(CAT::e_ZLIB));
+    ASSERT(!obj.isCompressionAlgorithmSupported(CAT::e_ZSTD));
+    ASSERT(!obj.isCompressionAlgorithmSupported(CAT::e_LZ4));
 }
 
 static void test3_printQueueStateTest()
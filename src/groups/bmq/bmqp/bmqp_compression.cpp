@@ -17,17 +17,36 @@
 #include <bmqp_compression.h>
 
 #include <bmqscm_version.h>
+// BMQ
+#include <bmqp_compressiondictionary.h>
+
 // MWC
 #include <mwcu_blob.h>
 
 // BDE
+#include <bdlb_scopeexit.h>
 #include <bdlbb_blobutil.h>
+#include <bdlf_bind.h>
 #include <bdlma_sequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
 
 // ZLIB
 #include <zlib.h>
 
+// ZSTD
+#include <zstd.h>
+
+// LZ4
+#include <lz4frame.h>
+
 // MemorySanitizer
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
@@ -112,18 +131,30 @@ struct ZLib {
                               bdlbb::BlobBufferFactory* factory,
                               z_stream*                 stream);
 
+    /// Return the number of bytes written to the specified `output`,
+    /// having initially the specified `initialLength`, and to the
+    /// specified `outBuffer` by the specified `stream`.
+    static bsls::Types::Int64
+    outputLength(const bdlbb::Blob&       output,
+                 int                      initialLength,
+                 const bdlbb::BlobBuffer& outBuffer,
+                 const z_stream&          stream);
+
     /// Apply the operation given by the specified `zlibMethod` and
     /// `zlibEndMethod` on the specified `input` using the specified
     /// `stream`, and write the result to the specified `output`.  Return 0
     /// on success and non-zero otherwise, in which case a message is
-    /// written to the specified `errorStream` if it is non-zero.
+    /// written to the specified `errorStream` if it is non-zero.  The
+    /// operation fails as soon as more than the specified `maxLength`
+    /// bytes are written.
     static int writeOutput(bdlbb::Blob*              output,
                            bdlbb::BlobBufferFactory* factory,
                            z_stream*                 stream,
                            bsl::ostream*             errorStream,
                            const bdlbb::Blob&        input,
                            ZlibStreamMethod          zlibMethod,
-                           ZlibEndStreamMethod       zlibEndMethod);
+                           ZlibEndStreamMethod       zlibEndMethod,
+                           int                       maxLength);
 };
 
 // ===========
@@ -220,21 +251,33 @@ void ZLib::advanceOutput(bdlbb::Blob*              output,
     }
 }
 
+bsls::Types::Int64 ZLib::outputLength(const bdlbb::Blob&       output,
+                                      int                      initialLength,
+                                      const bdlbb::BlobBuffer& outBuffer,
+                                      const z_stream&          stream)
+{
+    return static_cast<bsls::Types::Int64>(output.length()) - initialLength +
+           outBuffer.size() - stream.avail_out;
+}
+
 int ZLib::writeOutput(bdlbb::Blob*              output,
                       bdlbb::BlobBufferFactory* factory,
                       z_stream*                 stream,
                       bsl::ostream*             errorStream,
                       const bdlbb::Blob&        input,
                       ZlibStreamMethod          zlibMethod,
-                      ZlibEndStreamMethod       zlibEndMethod)
+                      ZlibEndStreamMethod       zlibEndMethod,
+                      int                       maxLength)
 {
     enum RcEnum {
         rc_SUCCESS                = 0,
         rc_STREAM_INIT_FAILURE    = -1,
         rc_STREAM_PROCESS_FAILURE = -2,
-        rc_STREAM_END_FAILURE     = -3
+        rc_STREAM_END_FAILURE     = -3,
+        rc_OUTPUT_TOO_LARGE       = -4
     };
 
+    const int         initialLength = output->length();
     bdlbb::BlobBuffer inBuffer;
     bdlbb::BlobBuffer outBuffer;
     int               index = -1;
@@ -257,6 +300,16 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
                      stream->msg);
             return rc_STREAM_PROCESS_FAILURE;  // RETURN
         }
+
+        if (outputLength(*output, initialLength, outBuffer, *stream) >
+            maxLength) {
+            zlibEndMethod(stream);
+            setError(errorStream,
+                     "Error processing stream",
+                     Z_BUF_ERROR,
+                     "output too large");
+            return rc_OUTPUT_TOO_LARGE;  // RETURN
+        }
     }
 
     // Continue to write output data until the stream reaches its end, or the
@@ -268,6 +321,16 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
         advanceOutput(output, &outBuffer, factory, stream);
         lastSize = stream->avail_out;
         result   = zlibMethod(stream, Z_FINISH);
+
+        if (outputLength(*output, initialLength, outBuffer, *stream) >
+            maxLength) {
+            zlibEndMethod(stream);
+            setError(errorStream,
+                     "Error finishing stream",
+                     Z_BUF_ERROR,
+                     "output too large");
+            return rc_OUTPUT_TOO_LARGE;  // RETURN
+        }
     } while ((Z_BUF_ERROR == result || Z_OK == result) &&
              lastSize != stream->avail_out);
 
@@ -298,6 +361,457 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
     return rc_SUCCESS;
 }
 
+// ================
+// class BlobWriter
+// ================
+
+/// Mechanism to sequentially fill data buffers, supplied by a blob buffer
+/// factory, with the output of a streaming (de)compressor and append them to
+/// an output blob.
+class BlobWriter {
+  private:
+    // DATA
+    bdlbb::Blob* d_output_p;
+
+    bdlbb::BlobBufferFactory* d_factory_p;
+
+    bdlbb::BlobBuffer d_buffer;
+    // Buffer currently being filled
+
+    int d_position;
+    // Offset of the first free byte in 'd_buffer'
+
+    bsl::size_t d_remaining;
+    // Number of bytes which may still be written
+
+  public:
+    // CREATORS
+
+    /// Create a `BlobWriter` appending to the specified `output` and using
+    /// the specified `factory` to supply data buffers.  Optionally specify
+    /// `maxLength`, the maximum number of bytes which may be written.
+    BlobWriter(bdlbb::Blob*              output,
+               bdlbb::BlobBufferFactory* factory,
+               bsl::size_t               maxLength =
+                   bsl::numeric_limits<bsl::size_t>::max());
+
+    // MANIPULATORS
+
+    /// Make sure the current buffer has free space, appending the current
+    /// buffer, if full, to the output blob and allocating a new one.
+    void reserve();
+
+    /// Mark the specified `numBytes` of free space as written.  The
+    /// behavior is undefined unless `numBytes <= available()`.
+    void advance(bsl::size_t numBytes);
+
+    /// Copy the specified `length` bytes starting at the specified `data`
+    /// into the free space, allocating new buffers as needed.  The
+    /// behavior is undefined unless `length` bytes may still be written.
+    void write(const char* data, bsl::size_t length);
+
+    /// Append the written part of the current buffer, if any, to the output
+    /// blob.  The behavior is undefined if this writer is used afterwards.
+    void commit();
+
+    /// Return a pointer to the first free byte of the current buffer.
+    char* data();
+
+    // ACCESSORS
+
+    /// Return the number of free bytes in the current buffer, bounded by
+    /// the number of bytes which may still be written.
+    bsl::size_t available() const;
+
+    /// Return `true` if the maximum number of bytes has been written, and
+    /// `false` otherwise.
+    bool isExhausted() const;
+};
+
+BlobWriter::BlobWriter(bdlbb::Blob*              output,
+                       bdlbb::BlobBufferFactory* factory,
+                       bsl::size_t               maxLength)
+: d_output_p(output)
+, d_factory_p(factory)
+, d_buffer()
+, d_position(0)
+, d_remaining(maxLength)
+{
+    // NOTHING
+}
+
+void BlobWriter::reserve()
+{
+    if (d_position < d_buffer.size()) {
+        return;  // RETURN
+    }
+
+    if (d_buffer.size()) {
+        d_output_p->appendDataBuffer(d_buffer);
+    }
+    d_factory_p->allocate(&d_buffer);
+    d_position = 0;
+}
+
+void BlobWriter::advance(bsl::size_t numBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numBytes <= available());
+
+    d_position += static_cast<int>(numBytes);
+    d_remaining -= numBytes;
+}
+
+void BlobWriter::write(const char* data, bsl::size_t length)
+{
+    while (length) {
+        reserve();
+
+        const bsl::size_t numBytes = bsl::min(length, available());
+        bsl::memcpy(this->data(), data, numBytes);
+        advance(numBytes);
+
+        data += numBytes;
+        length -= numBytes;
+    }
+}
+
+void BlobWriter::commit()
+{
+    if (d_position == 0) {
+        return;  // RETURN
+    }
+
+    d_buffer.setSize(d_position);
+    d_output_p->appendDataBuffer(d_buffer);
+    d_buffer.reset();
+    d_position = 0;
+}
+
+char* BlobWriter::data()
+{
+    return d_buffer.data() + d_position;
+}
+
+bsl::size_t BlobWriter::available() const
+{
+    return bsl::min(static_cast<bsl::size_t>(d_buffer.size() - d_position),
+                    d_remaining);
+}
+
+bool BlobWriter::isExhausted() const
+{
+    return d_remaining == 0;
+}
+
+/// Key of the zstd compression context of each thread.
+bslmt::ThreadUtil::Key g_zstdCompressionContextKey;
+
+/// Key of the lz4 compression context of each thread.
+bslmt::ThreadUtil::Key g_lz4CompressionContextKey;
+
+/// Free the specified zstd compression `context`.
+extern "C" void freeZstdCompressionContext(void* context)
+{
+    ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(context));
+}
+
+/// Free the specified lz4 compression `context`.
+extern "C" void freeLz4CompressionContext(void* context)
+{
+    LZ4F_freeCompressionContext(static_cast<LZ4F_cctx*>(context));
+}
+
+// ===========
+// struct Zstd
+// ===========
+
+/// This struct provides the utility functions for enabling compression
+/// using the Zstandard algorithm.
+struct Zstd {
+    // CONSTANTS
+
+    /// Compression level requesting the library default (currently 3).
+    static const int k_ZSTD_DEFAULT_LEVEL = 0;
+
+    /// Maximum size of a frame header.
+    static const int k_ZSTD_FRAME_HEADER_MAX_SIZE = 18;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the description of the specified zstd
+    /// error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         bsl::size_t              code);
+
+    /// Return the compression context of the calling thread, reset to its
+    /// default parameters, or 0 if it cannot be created.  The context is
+    /// created on first use by each thread, and freed when the thread
+    /// exits.
+    static ZSTD_CCtx* compressionContext();
+
+    /// Compress the specified `input` into a single frame at the specified
+    /// `level`, or using the specified digested `dictionary` if it is not
+    /// 0, and append it to the specified `output`, using the specified
+    /// `factory` to supply data buffers.  Return 0 on success, and non-zero
+    /// otherwise with details written to the specified `errorStream`.
+    static int compress(bdlbb::Blob*              output,
+                        bdlbb::BlobBufferFactory* factory,
+                        const bdlbb::Blob&        input,
+                        int                       level,
+                        const ZSTD_CDict*         dictionary,
+                        bsl::ostream*             errorStream);
+
+    /// Return the id of the dictionary the first frame of the specified
+    /// `input` was compressed with, or 0 if it was compressed without a
+    /// dictionary or if `input` does not start with a valid frame header.
+    static unsigned int dictionaryId(const bdlbb::Blob& input);
+};
+
+void Zstd::setError(bsl::ostream*            stream,
+                    const bslstl::StringRef& baseMessage,
+                    bsl::size_t              code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << ZSTD_getErrorName(code);
+    }
+}
+
+ZSTD_CCtx* Zstd::compressionContext()
+{
+    BSLMT_ONCE_DO
+    {
+        int rc = bslmt::ThreadUtil::createKey(&g_zstdCompressionContextKey,
+                                              &freeZstdCompressionContext);
+        BSLS_ASSERT_OPT(rc == 0);
+        (void)rc;  // Compiler happiness
+    }
+
+    ZSTD_CCtx* context = static_cast<ZSTD_CCtx*>(
+        bslmt::ThreadUtil::getSpecific(g_zstdCompressionContextKey));
+    if (context) {
+        // Discard the parameters, dictionary and any unfinished frame left by
+        // the previous use.
+        ZSTD_CCtx_reset(context, ZSTD_reset_session_and_parameters);
+        return context;  // RETURN
+    }
+
+    context = ZSTD_createCCtx();
+    if (context &&
+        0 != bslmt::ThreadUtil::setSpecific(g_zstdCompressionContextKey,
+                                            context)) {
+        ZSTD_freeCCtx(context);
+        context = 0;
+    }
+
+    return context;
+}
+
+unsigned int Zstd::dictionaryId(const bdlbb::Blob& input)
+{
+    // The frame header may span multiple buffers: copy it out.  Its maximum
+    // size is 'ZSTD_FRAMEHEADERSIZE_MAX', which is only exposed by the
+    // unstable API.
+    char      header[k_ZSTD_FRAME_HEADER_MAX_SIZE];
+    const int length = bsl::min(input.length(),
+                                static_cast<int>(sizeof(header)));
+    if (length == 0) {
+        return 0;  // RETURN
+    }
+
+    bdlbb::BlobUtil::copy(header, input, 0, length);
+
+    return ZSTD_getDictID_fromFrame(header, length);
+}
+
+int Zstd::compress(bdlbb::Blob*              output,
+                   bdlbb::BlobBufferFactory* factory,
+                   const bdlbb::Blob&        input,
+                   int                       level,
+                   const ZSTD_CDict*         dictionary,
+                   bsl::ostream*             errorStream)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    ZSTD_CCtx* context = compressionContext();
+    if (!context) {
+        if (errorStream) {
+            (*errorStream) << "Error creating zstd compression context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // Note that a digested dictionary carries its own compression level.
+    bsl::size_t result = dictionary
+                             ? ZSTD_CCtx_refCDict(context, dictionary)
+                             : ZSTD_CCtx_setParameter(context,
+                                                      ZSTD_c_compressionLevel,
+                                                      level);
+    if (!ZSTD_isError(result)) {
+        // Knowing the size upfront lets zstd pick smaller window and tables
+        // for small payloads, and records the size in the frame header.
+        result = ZSTD_CCtx_setPledgedSrcSize(context, input.length());
+    }
+    if (ZSTD_isError(result)) {
+        Zstd::setError(errorStream,
+                       "Error initializing zstd compression stream",
+                       result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobWriter writer(output, factory);
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer inBuffer = {input.buffer(i).data(),
+                                  static_cast<bsl::size_t>(
+                                      mwcu::BlobUtil::bufferSize(input, i)),
+                                  0};
+        while (inBuffer.pos < inBuffer.size) {
+            writer.reserve();
+            ZSTD_outBuffer outBuffer = {writer.data(), writer.available(), 0};
+
+            result = ZSTD_compressStream2(context,
+                                          &outBuffer,
+                                          &inBuffer,
+                                          ZSTD_e_continue);
+            if (ZSTD_isError(result)) {
+                Zstd::setError(errorStream,
+                               "Error processing zstd stream",
+                               result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.advance(outBuffer.pos);
+        }
+    }
+
+    // Flush the remaining data and write the frame epilogue.
+    // 'ZSTD_compressStream2' returns the number of bytes still to be flushed,
+    // so keep iterating until it reports 0.
+    ZSTD_inBuffer emptyBuffer = {0, 0, 0};
+    do {
+        writer.reserve();
+        ZSTD_outBuffer outBuffer = {writer.data(), writer.available(), 0};
+
+        result = ZSTD_compressStream2(context,
+                                      &outBuffer,
+                                      &emptyBuffer,
+                                      ZSTD_e_end);
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream,
+                           "Error finishing zstd stream",
+                           result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        writer.advance(outBuffer.pos);
+    } while (result != 0);
+
+    writer.commit();
+
+    return rc_SUCCESS;
+}
+
+// ==========
+// struct Lz4
+// ==========
+
+/// This struct provides the utility functions for enabling compression
+/// using the LZ4 frame format.
+struct Lz4 {
+    // CONSTANTS
+
+    /// Compression level selecting the default (fast) compressor.
+    static const int k_LZ4_DEFAULT_LEVEL = 0;
+
+    /// Maximum number of input bytes handed to the compressor in one call.
+    /// This bounds the size of the contiguous scratch area the compressor
+    /// writes into before it is copied to the output blob.
+    static const bsl::size_t k_LZ4_CHUNK_SIZE = 64 * 1024;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the description of the specified lz4
+    /// error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         bsl::size_t              code);
+
+    /// Return the compression context of the calling thread, or 0 if it
+    /// cannot be created, in which case the specified `errorStream` is
+    /// populated with details.  The context is created on first use by
+    /// each thread, and freed when the thread exits.  Note that
+    /// `LZ4F_compressBegin` resets the context.
+    static LZ4F_cctx* compressionContext(bsl::ostream* errorStream);
+};
+
+void Lz4::setError(bsl::ostream*            stream,
+                   const bslstl::StringRef& baseMessage,
+                   bsl::size_t              code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << LZ4F_getErrorName(code);
+    }
+}
+
+LZ4F_cctx* Lz4::compressionContext(bsl::ostream* errorStream)
+{
+    BSLMT_ONCE_DO
+    {
+        int rc = bslmt::ThreadUtil::createKey(&g_lz4CompressionContextKey,
+                                              &freeLz4CompressionContext);
+        BSLS_ASSERT_OPT(rc == 0);
+        (void)rc;  // Compiler happiness
+    }
+
+    LZ4F_cctx* context = static_cast<LZ4F_cctx*>(
+        bslmt::ThreadUtil::getSpecific(g_lz4CompressionContextKey));
+    if (context) {
+        return context;  // RETURN
+    }
+
+    bsl::size_t result = LZ4F_createCompressionContext(&context,
+                                                       LZ4F_VERSION);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error creating lz4 compression context",
+                      result);
+        return 0;  // RETURN
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(g_lz4CompressionContextKey,
+                                            context)) {
+        LZ4F_freeCompressionContext(context);
+        if (errorStream) {
+            (*errorStream) << "Error storing lz4 compression context";
+        }
+        return 0;  // RETURN
+    }
+
+    return context;
+}
+
+/// Return the default compression level of the specified `algorithm`.
+int defaultLevel(bmqt::CompressionAlgorithmType::Enum algorithm)
+{
+    switch (algorithm) {
+    case bmqt::CompressionAlgorithmType::e_ZLIB: return Z_DEFAULT_COMPRESSION;
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Zstd::k_ZSTD_DEFAULT_LEVEL;
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Lz4::k_LZ4_DEFAULT_LEVEL;
+    case bmqt::CompressionAlgorithmType::e_NONE:
+    case bmqt::CompressionAlgorithmType::e_UNKNOWN:
+    default: return 0;
+    }
+}
+
 }  // close unnamed namespace
 
 // ==================
@@ -310,6 +824,23 @@ int Compression::compress(bdlbb::Blob*                         output,
                           const bdlbb::Blob&                   input,
                           bsl::ostream*                        errorStream,
                           bslma::Allocator*                    allocator)
+{
+    return compress(output,
+                    factory,
+                    algorithm,
+                    defaultLevel(algorithm),
+                    input,
+                    errorStream,
+                    allocator);
+}
+
+int Compression::compress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          int                                  level,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream,
+                          bslma::Allocator*                    allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(output);
@@ -322,9 +853,22 @@ int Compression::compress(bdlbb::Blob*                         output,
         return Compression_Impl::compressZlib(output,
                                               factory,
                                               input,
-                                              Z_DEFAULT_COMPRESSION,
+                                              level,
                                               errorStream,
                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::compressZstd(output,
+                                              factory,
+                                              input,
+                                              level,
+                                              errorStream);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::compressLz4(output,
+                                             factory,
+                                             input,
+                                             level,
+                                             errorStream,
+                                             allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -338,6 +882,37 @@ int Compression::compress(bdlbb::Blob*                         output,
     }
 }
 
+int Compression::compress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          int                                  level,
+                          const CompressionDictionary*         dictionary,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream,
+                          bslma::Allocator*                    allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(factory);
+
+    if (dictionary && algorithm == bmqt::CompressionAlgorithmType::e_ZSTD) {
+        return Compression_Impl::compressZstd(output,
+                                              factory,
+                                              input,
+                                              level,
+                                              *dictionary,
+                                              errorStream);  // RETURN
+    }
+
+    return compress(output,
+                    factory,
+                    algorithm,
+                    level,
+                    input,
+                    errorStream,
+                    allocator);
+}
+
 int Compression::compress(bdlbb::Blob*                         output,
                           bdlbb::BlobBufferFactory*            factory,
                           bmqt::CompressionAlgorithmType::Enum algorithm,
@@ -355,7 +930,9 @@ int Compression::compress(bdlbb::Blob*                         output,
 
     bdlbb::Blob inputBlob(factory, allocator);
     switch (algorithm) {
-    case bmqt::CompressionAlgorithmType::e_ZLIB: {
+    case bmqt::CompressionAlgorithmType::e_ZLIB:
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+    case bmqt::CompressionAlgorithmType::e_LZ4: {
         bsl::shared_ptr<char> inputBufferSp(const_cast<char*>(input),
                                             bslstl::SharedPtrNilDeleter(),
                                             allocator);
@@ -365,12 +942,13 @@ int Compression::compress(bdlbb::Blob*                         output,
             inputBlob.appendDataBuffer(inputBlobBuffer);
         }
 
-        return Compression_Impl::compressZlib(output,
-                                              factory,
-                                              inputBlob,
-                                              Z_DEFAULT_COMPRESSION,
-                                              errorStream,
-                                              allocator);  // RETURN
+        return compress(output,
+                        factory,
+                        algorithm,
+                        defaultLevel(algorithm),
+                        inputBlob,
+                        errorStream,
+                        allocator);  // RETURN
     }
     case bmqt::CompressionAlgorithmType::e_NONE:
         // deep copy of input character array to output Blob
@@ -386,9 +964,17 @@ int Compression::decompress(bdlbb::Blob*                         output,
                             bmqt::CompressionAlgorithmType::Enum algorithm,
                             const bdlbb::Blob&                   input,
                             bsl::ostream*                        errorStream,
-                            bslma::Allocator*                    allocator)
+                            bslma::Allocator*                    allocator,
+                            int                                  maxLength)
 {
-    enum RcEnum { rc_SUCCESS = 0, rc_UNKNOWN_ALGORITHM = -1 };
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= maxLength);
+
+    enum RcEnum {
+        rc_SUCCESS           = 0,
+        rc_UNKNOWN_ALGORITHM = -1,
+        rc_OUTPUT_TOO_LARGE  = -2
+    };
 
     switch (algorithm) {
     case bmqt::CompressionAlgorithmType::e_ZLIB:
@@ -396,8 +982,28 @@ int Compression::decompress(bdlbb::Blob*                         output,
                                                 factory,
                                                 input,
                                                 errorStream,
-                                                allocator);  // RETURN
+                                                allocator,
+                                                maxLength);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::decompressZstd(output,
+                                                factory,
+                                                input,
+                                                errorStream,
+                                                maxLength);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::decompressLz4(output,
+                                               factory,
+                                               input,
+                                               errorStream,
+                                               maxLength);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
+        if (input.length() > maxLength) {
+            if (errorStream) {
+                (*errorStream) << "Error copying input, Message: output too "
+                               << "large";
+            }
+            return rc_OUTPUT_TOO_LARGE;  // RETURN
+        }
         if (output->length() == 0) {
             *output = input;
         }
@@ -448,14 +1054,16 @@ int Compression_Impl::compressZlib(bdlbb::Blob*              output,
                              errorStream,
                              input,
                              &::deflate,
-                             &::deflateEnd);
+                             &::deflateEnd,
+                             bsl::numeric_limits<int>::max());
 }
 
 int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                                      bdlbb::BlobBufferFactory* factory,
                                      const bdlbb::Blob&        input,
                                      bsl::ostream*             errorStream,
-                                     bslma::Allocator*         allocator)
+                                     bslma::Allocator*         allocator,
+                                     int                       maxLength)
 {
     enum RcEnum { rc_SUCCESS = 0, rc_STREAM_INIT_FAILURE = -1 };
 
@@ -480,7 +1088,389 @@ int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                              errorStream,
                              input,
                              &::inflate,
-                             &::inflateEnd);
+                             &::inflateEnd,
+                             maxLength);
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*              output,
+                                   bdlbb::BlobBufferFactory* factory,
+                                   const bdlbb::Blob&        input,
+                                   int                       level,
+                                   bsl::ostream*             errorStream)
+{
+    return Zstd::compress(output, factory, input, level, 0, errorStream);
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*                 output,
+                                   bdlbb::BlobBufferFactory*    factory,
+                                   const bdlbb::Blob&           input,
+                                   int                          level,
+                                   const CompressionDictionary& dictionary,
+                                   bsl::ostream*                errorStream)
+{
+    enum RcEnum { rc_SUCCESS = 0, rc_DICTIONARY_FAILURE = -4 };
+
+    const ZSTD_CDict* state = dictionary.compressionState(level);
+    if (!state) {
+        if (errorStream) {
+            (*errorStream) << "Error digesting zstd compression dictionary "
+                           << "[id: " << dictionary.id() << ", level: "
+                           << level << "]";
+        }
+        return rc_DICTIONARY_FAILURE;  // RETURN
+    }
+
+    return Zstd::compress(output, factory, input, level, state, errorStream);
+}
+
+int Compression_Impl::decompressZstd(bdlbb::Blob*              output,
+                                     bdlbb::BlobBufferFactory* factory,
+                                     const bdlbb::Blob&        input,
+                                     bsl::ostream*             errorStream,
+                                     int                       maxLength)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_OUTPUT_TOO_LARGE       = -4
+    };
+
+    ZSTD_DCtx* context = ZSTD_createDCtx();
+    if (!context) {
+        if (errorStream) {
+            (*errorStream) << "Error creating zstd decompression context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // Free the context on all exit paths.
+    bdlb::ScopeExitAny contextGuard(
+        bdlf::BindUtil::bind(&ZSTD_freeDCtx, context));
+
+    // Frames compressed with a dictionary record its id in their header.
+    // Keep a reference to the dictionary for the duration of the operation.
+    bsl::shared_ptr<CompressionDictionary> dictionary;
+    const unsigned int                     dictionaryId = Zstd::dictionaryId(
+        input);
+    if (dictionaryId != 0) {
+        dictionary = CompressionDictionaryUtil::lookup(dictionaryId);
+        if (!dictionary) {
+            if (errorStream) {
+                (*errorStream) << "Error initializing zstd decompression "
+                               << "stream, Message: unknown dictionary [id: "
+                               << dictionaryId << "]";
+            }
+            return rc_STREAM_INIT_FAILURE;  // RETURN
+        }
+
+        const bsl::size_t result = ZSTD_DCtx_refDDict(
+            context,
+            dictionary->decompressionState());
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream,
+                           "Error initializing zstd decompression stream",
+                           result);
+            return rc_STREAM_INIT_FAILURE;  // RETURN
+        }
+    }
+
+    // Allow one byte more than 'maxLength' to be written, so that the output
+    // being too large is detected without having to tell apart a decoder
+    // which is done from one which is out of output space.
+    BlobWriter writer(output,
+                      factory,
+                      static_cast<bsl::size_t>(maxLength) + 1);
+
+    // 'ZSTD_decompressStream' returns 0 once a frame is fully decoded and
+    // flushed; any other value means that more input or output space is
+    // needed.  Start with a non-zero value so that an empty 'input' is
+    // reported as a truncated frame.
+    bsl::size_t result = 1;
+    bool        isFull = false;
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer inBuffer = {input.buffer(i).data(),
+                                  static_cast<bsl::size_t>(
+                                      mwcu::BlobUtil::bufferSize(input, i)),
+                                  0};
+        while (inBuffer.pos < inBuffer.size) {
+            writer.reserve();
+            if (writer.isExhausted()) {
+                if (errorStream) {
+                    (*errorStream) << "Error processing zstd stream, "
+                                   << "Message: output too large";
+                }
+                return rc_OUTPUT_TOO_LARGE;  // RETURN
+            }
+            ZSTD_outBuffer outBuffer = {writer.data(), writer.available(), 0};
+
+            result = ZSTD_decompressStream(context, &outBuffer, &inBuffer);
+            if (ZSTD_isError(result)) {
+                Zstd::setError(errorStream,
+                               "Error processing zstd stream",
+                               result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.advance(outBuffer.pos);
+            isFull = (outBuffer.pos == outBuffer.size);
+        }
+    }
+
+    // If the last call filled up the output buffer, the decoder may still
+    // hold decoded data: drain it.
+    ZSTD_inBuffer emptyBuffer = {0, 0, 0};
+    while (result != 0 && isFull) {
+        writer.reserve();
+        if (writer.isExhausted()) {
+            if (errorStream) {
+                (*errorStream) << "Error processing zstd stream, Message: "
+                               << "output too large";
+            }
+            return rc_OUTPUT_TOO_LARGE;  // RETURN
+        }
+        ZSTD_outBuffer outBuffer = {writer.data(), writer.available(), 0};
+
+        result = ZSTD_decompressStream(context, &outBuffer, &emptyBuffer);
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream,
+                           "Error processing zstd stream",
+                           result);
+            return rc_STREAM_PROCESS_FAILURE;  // RETURN
+        }
+        writer.advance(outBuffer.pos);
+        isFull = (outBuffer.pos == outBuffer.size);
+    }
+
+    if (result != 0) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing zstd stream, Message: "
+                           << "truncated frame";
+        }
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+
+    if (writer.isExhausted()) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing zstd stream, Message: "
+                           << "output too large";
+        }
+        return rc_OUTPUT_TOO_LARGE;  // RETURN
+    }
+
+    writer.commit();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::compressLz4(bdlbb::Blob*              output,
+                                  bdlbb::BlobBufferFactory* factory,
+                                  const bdlbb::Blob&        input,
+                                  int                       level,
+                                  bsl::ostream*             errorStream,
+                                  bslma::Allocator*         allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    LZ4F_cctx* context = Lz4::compressionContext(errorStream);
+    if (!context) {
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    LZ4F_preferences_t preferences;
+    bsl::memset(&preferences, 0, sizeof(preferences));
+    preferences.compressionLevel      = level;
+    preferences.frameInfo.contentSize = input.length();
+
+    // Unlike zstd, the lz4 frame API requires the destination of each call
+    // to be large enough for the worst case, so compress into a contiguous
+    // scratch area sized for one chunk and copy it to the output blob.
+    const bsl::size_t scratchSize = LZ4F_compressBound(Lz4::k_LZ4_CHUNK_SIZE,
+                                                       &preferences);
+    bsl::vector<char> scratch(scratchSize, allocator);
+
+    BlobWriter writer(output, factory);
+
+    result = LZ4F_compressBegin(context,
+                                scratch.data(),
+                                scratch.size(),
+                                &preferences);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error initializing lz4 compression stream",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    writer.write(scratch.data(), result);
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* data      = input.buffer(i).data();
+        bsl::size_t remaining = static_cast<bsl::size_t>(
+            mwcu::BlobUtil::bufferSize(input, i));
+
+        while (remaining) {
+            const bsl::size_t chunkSize = remaining < Lz4::k_LZ4_CHUNK_SIZE
+                                              ? remaining
+                                              : Lz4::k_LZ4_CHUNK_SIZE;
+
+            result = LZ4F_compressUpdate(context,
+                                         scratch.data(),
+                                         scratch.size(),
+                                         data,
+                                         chunkSize,
+                                         0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream,
+                              "Error processing lz4 stream",
+                              result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.write(scratch.data(), result);
+
+            data += chunkSize;
+            remaining -= chunkSize;
+        }
+    }
+
+    result = LZ4F_compressEnd(context, scratch.data(), scratch.size(), 0);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream, "Error finishing lz4 stream", result);
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+    writer.write(scratch.data(), result);
+    writer.commit();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressLz4(bdlbb::Blob*              output,
+                                    bdlbb::BlobBufferFactory* factory,
+                                    const bdlbb::Blob&        input,
+                                    bsl::ostream*             errorStream,
+                                    int                       maxLength)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_OUTPUT_TOO_LARGE       = -4
+    };
+
+    LZ4F_dctx*  context = 0;
+    bsl::size_t result  = LZ4F_createDecompressionContext(&context,
+                                                         LZ4F_VERSION);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error creating lz4 decompression context",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // Free the context on all exit paths.
+    bdlb::ScopeExitAny contextGuard(
+        bdlf::BindUtil::bind(&LZ4F_freeDecompressionContext, context));
+
+    // Allow one byte more than 'maxLength' to be written, as for zstd.
+    BlobWriter writer(output,
+                      factory,
+                      static_cast<bsl::size_t>(maxLength) + 1);
+
+    // 'LZ4F_decompress' returns 0 once a frame is fully decoded and flushed.
+    // Start with a non-zero value so that an empty 'input' is reported as a
+    // truncated frame.
+    result      = 1;
+    bool isFull = false;
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* data      = input.buffer(i).data();
+        bsl::size_t remaining = static_cast<bsl::size_t>(
+            mwcu::BlobUtil::bufferSize(input, i));
+
+        while (remaining) {
+            writer.reserve();
+            if (writer.isExhausted()) {
+                if (errorStream) {
+                    (*errorStream) << "Error processing lz4 stream, "
+                                   << "Message: output too large";
+                }
+                return rc_OUTPUT_TOO_LARGE;  // RETURN
+            }
+            bsl::size_t outSize = writer.available();
+            bsl::size_t inSize  = remaining;
+
+            result = LZ4F_decompress(context,
+                                     writer.data(),
+                                     &outSize,
+                                     data,
+                                     &inSize,
+                                     0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream,
+                              "Error processing lz4 stream",
+                              result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            isFull = (outSize == writer.available());
+            writer.advance(outSize);
+            data += inSize;
+            remaining -= inSize;
+        }
+    }
+
+    // If the last call filled up the output buffer, the decoder may still
+    // hold decoded data: drain it.
+    while (result != 0 && isFull) {
+        writer.reserve();
+        if (writer.isExhausted()) {
+            if (errorStream) {
+                (*errorStream) << "Error processing lz4 stream, Message: "
+                               << "output too large";
+            }
+            return rc_OUTPUT_TOO_LARGE;  // RETURN
+        }
+        bsl::size_t outSize = writer.available();
+        bsl::size_t inSize  = 0;
+
+        result = LZ4F_decompress(context,
+                                 writer.data(),
+                                 &outSize,
+                                 0,
+                                 &inSize,
+                                 0);
+        if (LZ4F_isError(result)) {
+            Lz4::setError(errorStream, "Error processing lz4 stream", result);
+            return rc_STREAM_PROCESS_FAILURE;  // RETURN
+        }
+        isFull = (outSize == writer.available());
+        writer.advance(outSize);
+    }
+
+    if (result != 0) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing lz4 stream, Message: "
+                           << "truncated frame";
+        }
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+
+    if (writer.isExhausted()) {
+        if (errorStream) {
+            (*errorStream) << "Error finishing lz4 stream, Message: "
+                           << "output too large";
+        }
+        return rc_OUTPUT_TOO_LARGE;  // RETURN
+    }
+
+    writer.commit();
+
+    return rc_SUCCESS;
 }
 
 }  // close package namespace
@@ -29,6 +29,25 @@
 // provides implementation for compression and decompression for all supported
 // types of compression algorithms.
 //
+/// Supported Algorithms
+///--------------------
+//: o !ZLIB!: deflate stream with a zlib wrapper.  Good compression ratio but
+//:   comparatively expensive in CPU, both when compressing and decompressing.
+//: o !ZSTD!: Zstandard frame.  Typically a better ratio than ZLIB at a
+//:   fraction of its cost; the level (default 3) can be raised to trade
+//:   throughput for ratio.
+//: o !LZ4!: LZ4 frame.  Lowest ratio of the three but very cheap, especially
+//:   to decompress; levels 3 and above select the LZ4 HC compressor.
+//
+// The 'level' accepted by the 'compress' overload and by the
+// 'Compression_Impl' methods is algorithm specific; refer to the
+// documentation of each 'Compression_Impl::compress*' method for its range.
+//
+// Data compressed with 'e_ZSTD' may additionally use a dictionary (see
+// 'bmqp_compressiondictionary'), which substantially improves the ratio of
+// small inputs.  The id of the dictionary is recorded in the compressed
+// frame, so that 'decompress' locates the dictionary on its own.
+//
 
 // BMQ
 
@@ -36,6 +55,7 @@
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 #include <bslma_allocator.h>
 
@@ -43,6 +63,9 @@ namespace BloombergLP {
 
 namespace bmqp {
 
+// FORWARD DECLARATION
+class CompressionDictionary;
+
 // ==================
 // struct Compression
 // ==================
@@ -51,6 +74,47 @@ namespace bmqp {
 struct Compression {
     // CLASS METHODS
 
+    /// Compress the data within the specified `input` as per the specified
+    /// `algorithm` using the specified algorithm specific compression
+    /// `level`, and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Return 0 on
+    /// success, and non-zero otherwise.  Also, optionally specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation. Finally, as an option specify `allocator` which will
+    /// be used to supply memory.  The behavior is undefined unless `level`
+    /// is within the range supported by `algorithm`.  Note that `level` is
+    /// ignored if `algorithm` is `bmqt::CompressionAlgorithmType::e_NONE`.
+    /// Also note that any existing data in the specified `output` will be
+    /// preserved.
+    static int compress(bdlbb::Blob*                         output,
+                        bdlbb::BlobBufferFactory*            factory,
+                        bmqt::CompressionAlgorithmType::Enum algorithm,
+                        int                                  level,
+                        const bdlbb::Blob&                   input,
+                        bsl::ostream*                        errorStream = 0,
+                        bslma::Allocator*                    allocator   = 0);
+
+    /// Compress the data within the specified `input` as per the specified
+    /// `algorithm` using the specified algorithm specific compression
+    /// `level` and the specified `dictionary`, and load the compressed data
+    /// into the specified `output`, using the specified `factory` to supply
+    /// data buffers.  Return 0 on success, and non-zero otherwise.  Also,
+    /// optionally specify an `errorStream` to record details on any errors
+    /// that may occur during this operation.  Finally, as an option specify
+    /// `allocator` which will be used to supply memory.  If `dictionary` is
+    /// 0, or `algorithm` is not `bmqt::CompressionAlgorithmType::e_ZSTD`,
+    /// this method behaves as the overload without a `dictionary`.  Note
+    /// that decompressing the `output` requires `dictionary` to be
+    /// registered (see `bmqp::CompressionDictionaryUtil`).
+    static int compress(bdlbb::Blob*                         output,
+                        bdlbb::BlobBufferFactory*            factory,
+                        bmqt::CompressionAlgorithmType::Enum algorithm,
+                        int                                  level,
+                        const CompressionDictionary*         dictionary,
+                        const bdlbb::Blob&                   input,
+                        bsl::ostream*                        errorStream = 0,
+                        bslma::Allocator*                    allocator   = 0);
+
     /// Compress the data within the specified `input` as per the specified
     /// `algorithm`, and load the compressed data into the specified
     /// `output`, using the specified `factory` to supply data buffers.
@@ -92,13 +156,22 @@ struct Compression {
     /// specify an `errorStream` to record details on any errors that may
     /// occur during this operation. Also, optionally specify `allocator`
     /// which will be used to supply memory.  Also note, that any existing
-    /// data in the specified `output` will be preserved.
-    static int decompress(bdlbb::Blob*                         output,
-                          bdlbb::BlobBufferFactory*            factory,
-                          bmqt::CompressionAlgorithmType::Enum algorithm,
-                          const bdlbb::Blob&                   input,
-                          bsl::ostream*                        errorStream = 0,
-                          bslma::Allocator*                    allocator = 0);
+    /// data in the specified `output` will be preserved.  Finally,
+    /// optionally specify `maxLength`, the maximum number of bytes
+    /// decompression may append to `output`: decompression is aborted, and
+    /// a non-zero value returned, as soon as it is exceeded, in which case
+    /// a prefix of the decompressed data is appended to `output`.  Note
+    /// that data compressed with a dictionary can only be decompressed once
+    /// that dictionary has been registered.  The behavior is undefined
+    /// unless `0 <= maxLength`.
+    static int
+    decompress(bdlbb::Blob*                         output,
+               bdlbb::BlobBufferFactory*            factory,
+               bmqt::CompressionAlgorithmType::Enum algorithm,
+               const bdlbb::Blob&                   input,
+               bsl::ostream*                        errorStream = 0,
+               bslma::Allocator*                    allocator   = 0,
+               int maxLength = bsl::numeric_limits<int>::max());
 };
 
 // ======================
@@ -136,11 +209,99 @@ struct Compression_Impl {
     /// `errorStream` to record details on any errors that may occur during
     /// this operation. Also, specify `allocator` which will be used to
     /// supply memory. Return 0 on success, and non-zero otherwise.
-    static int decompressZlib(bdlbb::Blob*              output,
-                              bdlbb::BlobBufferFactory* factory,
-                              const bdlbb::Blob&        input,
-                              bsl::ostream*             errorStream,
-                              bslma::Allocator*         allocator);
+    /// Optionally specify `maxLength`, the maximum number of bytes appended
+    /// to `output`, beyond which the operation fails.
+    static int
+    decompressZlib(bdlbb::Blob*              output,
+                   bdlbb::BlobBufferFactory* factory,
+                   const bdlbb::Blob&        input,
+                   bsl::ostream*             errorStream,
+                   bslma::Allocator*         allocator,
+                   int maxLength = bsl::numeric_limits<int>::max());
+
+    /// Compress the data within the specified `input` into a single
+    /// Zstandard frame, and load the compressed data into the specified
+    /// `output`, using the specified `factory` to supply data buffers.
+    /// Specify a compression `level`, with negative values selecting the
+    /// fast modes, 1 indicating fast compression, and 22 indicating best
+    /// compression.  If level is 0, the default compression level (3) is
+    /// used.  Also, specify an `errorStream` to record details on any errors
+    /// that may occur during this operation.  Return 0 on success, and
+    /// non-zero otherwise.  The behavior is undefined unless `level` is
+    /// within the range `[ZSTD_minCLevel()..22]`.  Note that the
+    /// compression context is allocated by the Zstandard library, and kept
+    /// by the calling thread for its next uses.
+    static int compressZstd(bdlbb::Blob*              output,
+                            bdlbb::BlobBufferFactory* factory,
+                            const bdlbb::Blob&        input,
+                            int                       level,
+                            bsl::ostream*             errorStream);
+
+    /// Compress the data within the specified `input` into a single
+    /// Zstandard frame using the specified `dictionary` at the specified
+    /// compression `level` (having the same meaning as for `compressZstd`
+    /// above), and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Also, specify
+    /// an `errorStream` to record details on any errors that may occur
+    /// during this operation.  Return 0 on success, and non-zero otherwise.
+    /// The behavior is undefined unless `dictionary` is loaded.
+    static int compressZstd(bdlbb::Blob*                 output,
+                            bdlbb::BlobBufferFactory*    factory,
+                            const bdlbb::Blob&           input,
+                            int                          level,
+                            const CompressionDictionary& dictionary,
+                            bsl::ostream*                errorStream);
+
+    /// Decompress the data within the specified `input`, consisting of one
+    /// or more Zstandard frames, and load the uncompressed data into the
+    /// specified `output` blob, using the specified `factory` to supply
+    /// needed data buffers.  Specify an `errorStream` to record details on
+    /// any errors that may occur during this operation.  Return 0 on
+    /// success, and non-zero otherwise.  If the first frame of `input` was
+    /// compressed with a dictionary, that dictionary is looked up by id in
+    /// the registry of `bmqp::CompressionDictionaryUtil`, and all frames
+    /// are decompressed with it; the operation fails if it is not
+    /// registered.  Optionally specify `maxLength`, the maximum number of
+    /// bytes appended to `output`, beyond which the operation fails.
+    static int
+    decompressZstd(bdlbb::Blob*              output,
+                   bdlbb::BlobBufferFactory* factory,
+                   const bdlbb::Blob&        input,
+                   bsl::ostream*             errorStream,
+                   int maxLength = bsl::numeric_limits<int>::max());
+
+    /// Compress the data within the specified `input` into a single LZ4
+    /// frame, and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Specify a
+    /// compression `level`, with 0 indicating the default (fast)
+    /// compression, negative values indicating faster compression and
+    /// values in `[3..12]` selecting the high compression (HC) compressor,
+    /// 12 indicating best compression.  Also, specify an `errorStream` to
+    /// record details on any errors that may occur during this operation.
+    /// Finally, specify `allocator` which will be used to supply memory.
+    /// Return 0 on success, and non-zero otherwise.  Note that the
+    /// compression context is kept by the calling thread for its next uses.
+    static int compressLz4(bdlbb::Blob*              output,
+                           bdlbb::BlobBufferFactory* factory,
+                           const bdlbb::Blob&        input,
+                           int                       level,
+                           bsl::ostream*             errorStream,
+                           bslma::Allocator*         allocator);
+
+    /// Decompress the data within the specified `input`, consisting of one
+    /// or more LZ4 frames, and load the uncompressed data into the
+    /// specified `output` blob, using the specified `factory` to supply
+    /// needed data buffers.  Specify an `errorStream` to record details on
+    /// any errors that may occur during this operation.  Return 0 on
+    /// success, and non-zero otherwise.  Optionally specify `maxLength`,
+    /// the maximum number of bytes appended to `output`, beyond which the
+    /// operation fails.
+    static int
+    decompressLz4(bdlbb::Blob*              output,
+                  bdlbb::BlobBufferFactory* factory,
+                  const bdlbb::Blob&        input,
+                  bsl::ostream*             errorStream,
+                  int maxLength = bsl::numeric_limits<int>::max());
 };
 
 }  // close package namespace
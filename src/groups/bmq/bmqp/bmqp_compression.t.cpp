@@ -359,6 +359,69 @@ static void eZlibCompressionRatioHelper(bsls::Types::Int64* inputSize,
     ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
 }
 
+/// Load into the specified `str` a sequence of JSON-like records, of at
+/// least the specified `len` size, resembling typical application payloads
+/// (repeated keys with varying values).
+static void generateJsonLikeString(bsl::string* str, size_t len)
+{
+    static const char* k_SIDES[] = {"BUY", "SELL"};
+
+    for (int i = 0; str->length() < len; ++i) {
+        mwcu::MemOutStream record(s_allocator_p);
+        record << "{\"id\":" << i << ",\"ticker\":\"";
+        bsl::string ticker(s_allocator_p);
+        generateRandomString(&ticker, 4);
+        record << ticker << "\",\"side\":\"" << k_SIDES[rand() % 2]
+               << "\",\"price\":" << (rand() % 100000) / 100.0
+               << ",\"quantity\":" << rand() % 1000 << "}\n";
+        str->append(record.str().data(), record.str().length());
+    }
+}
+
+/// Compress the specified `input` with the specified `algorithm` at the
+/// specified `level`, decompress the result and verify it matches `input`.
+/// Load the size of the compressed data into the specified
+/// `compressedSize` and the time taken into the specified
+/// `compressionTime` and `decompressionTime`.
+static void
+roundTripHelper(bsls::Types::Int64*                  compressedSize,
+                bsls::Types::Int64*                  compressionTime,
+                bsls::Types::Int64*                  decompressionTime,
+                bdlbb::BlobBufferFactory*            bufferFactory,
+                const bdlbb::Blob&                   input,
+                bmqt::CompressionAlgorithmType::Enum algorithm,
+                int                                  level)
+{
+    mwcu::MemOutStream error(s_allocator_p);
+    bdlbb::Blob        compressed(bufferFactory, s_allocator_p);
+    bdlbb::Blob        decompressed(bufferFactory, s_allocator_p);
+
+    bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    int                rc        = bmqp::Compression::compress(&compressed,
+                                         bufferFactory,
+                                         algorithm,
+                                         level,
+                                         input,
+                                         &error,
+                                         s_allocator_p);
+    *compressionTime             = bsls::TimeUtil::getTimer() - startTime;
+
+    ASSERT_EQ_D(error.str(), rc, 0);
+    *compressedSize = compressed.length();
+
+    startTime          = bsls::TimeUtil::getTimer();
+    rc                 = bmqp::Compression::decompress(&decompressed,
+                                       bufferFactory,
+                                       algorithm,
+                                       compressed,
+                                       &error,
+                                       s_allocator_p);
+    *decompressionTime = bsls::TimeUtil::getTimer() - startTime;
+
+    ASSERT_EQ_D(error.str(), rc, 0);
+    ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -698,6 +761,205 @@ static void test3_compression_decompression_none()
     }
 }
 
+static void test4_compression_decompression_zstd_lz4()
+// ------------------------------------------------------------------------
+// TEST USING ZSTD AND LZ4 ALGORITHM TYPES
+//
+// Concerns:
+//   - Data compressed using `e_ZSTD` or `e_LZ4` decompresses to the
+//     original data, at the default level and at explicit levels.
+//   - Input and output spanning multiple blob buffers are handled.
+//   - Empty input is handled.
+//   - Truncated compressed input is reported as an error.
+//
+// Plan:
+//   - Round-trip inputs of various sizes and contents through
+//     `bmqp::Compression` using a small blob buffer size, and compare the
+//     decompressed data with the original data.
+//   - Decompress a truncated compressed blob and verify failure.
+//
+// Testing:
+//   bmqp::Compression::compress
+//   bmqp::Compression::decompress
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ZSTD AND LZ4 TYPE ALGORITHM TEST");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_LZ4};
+
+    struct Test {
+        int d_line;
+        int d_length;
+        int d_level;
+    } k_DATA[] = {{L_, 0, 0},
+                  {L_, 1, 0},
+                  {L_, 11, 0},
+                  {L_, 1024, 0},
+                  {L_, 1024, 1},
+                  {L_, 100 * 1024, 0},
+                  {L_, 100 * 1024, 9},
+                  {L_, 300 * 1024, 0}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    // Use small buffers to exercise multi-buffer input and output
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+
+    for (size_t a = 0; a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+         ++a) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[a];
+
+        PV("ALGORITHM: " << algorithm);
+
+        for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+            const Test& test = k_DATA[idx];
+
+            PVV(test.d_line << ": length " << test.d_length << ", level "
+                            << test.d_level);
+
+            bsl::string data(s_allocator_p);
+            generateJsonLikeString(&data, test.d_length);
+            data.resize(test.d_length);
+
+            bdlbb::Blob input(&bufferFactory, s_allocator_p);
+            bdlbb::BlobUtil::append(&input, data.data(), data.length());
+
+            bsls::Types::Int64 compressedSize    = 0;
+            bsls::Types::Int64 compressionTime   = 0;
+            bsls::Types::Int64 decompressionTime = 0;
+            roundTripHelper(&compressedSize,
+                            &compressionTime,
+                            &decompressionTime,
+                            &bufferFactory,
+                            input,
+                            algorithm,
+                            test.d_level);
+        }
+
+        PV("TRUNCATED INPUT");
+        {
+            bsl::string data(s_allocator_p);
+            generateJsonLikeString(&data, 10 * 1024);
+
+            mwcu::MemOutStream error(s_allocator_p);
+            bdlbb::Blob        compressed(&bufferFactory, s_allocator_p);
+            bdlbb::Blob        decompressed(&bufferFactory, s_allocator_p);
+
+            int rc = bmqp::Compression::compress(&compressed,
+                                                 &bufferFactory,
+                                                 algorithm,
+                                                 data.data(),
+                                                 data.length(),
+                                                 &error,
+                                                 s_allocator_p);
+            ASSERT_EQ(rc, 0);
+
+            compressed.setLength(compressed.length() / 2);
+            rc = bmqp::Compression::decompress(&decompressed,
+                                               &bufferFactory,
+                                               algorithm,
+                                               compressed,
+                                               &error,
+                                               s_allocator_p);
+            ASSERT_NE(rc, 0);
+        }
+    }
+}
+
+static void test5_decompressionMaxLength()
+// ------------------------------------------------------------------------
+// DECOMPRESSION MAXIMUM LENGTH
+//
+// Concerns:
+//   - Decompression of an input larger than the specified maximum length
+//     fails, for all algorithms, without decompressing the whole input.
+//   - Decompression of an input exactly as large as the specified maximum
+//     length succeeds.
+//
+// Plan:
+//   - Compress a large, highly compressible input, and decompress it with
+//     maximum lengths below, equal to and above its size.
+//
+// Testing:
+//   bmqp::Compression::decompress
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DECOMPRESSION MAXIMUM LENGTH");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_NONE,
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_LZ4};
+
+    const int k_LENGTH = 1024 * 1024;
+
+    struct Test {
+        int  d_line;
+        int  d_maxLength;
+        bool d_success;
+    } k_DATA[] = {{L_, 0, false},
+                  {L_, 1, false},
+                  {L_, 4096, false},
+                  {L_, k_LENGTH - 1, false},
+                  {L_, k_LENGTH, true},
+                  {L_, k_LENGTH + 1, true}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    // A large input made of zeroes compresses to a small blob.
+    const bsl::string data(k_LENGTH, '\0', s_allocator_p);
+
+    for (size_t a = 0; a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+         ++a) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[a];
+
+        PV("ALGORITHM: " << algorithm);
+
+        mwcu::MemOutStream error(s_allocator_p);
+        bdlbb::Blob        compressed(&bufferFactory, s_allocator_p);
+        int                rc = bmqp::Compression::compress(&compressed,
+                                                 &bufferFactory,
+                                                 algorithm,
+                                                 data.data(),
+                                                 data.length(),
+                                                 &error,
+                                                 s_allocator_p);
+        ASSERT_EQ(rc, 0);
+
+        for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+            const Test& test = k_DATA[idx];
+
+            PVV(test.d_line << ": maxLength " << test.d_maxLength);
+
+            bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+            rc = bmqp::Compression::decompress(&decompressed,
+                                               &bufferFactory,
+                                               algorithm,
+                                               compressed,
+                                               &error,
+                                               s_allocator_p,
+                                               test.d_maxLength);
+            ASSERT_EQ_D(test.d_line, rc == 0, test.d_success);
+            if (test.d_success) {
+                ASSERT_EQ_D(test.d_line, decompressed.length(), k_LENGTH);
+            }
+            else {
+                // Decompression stops shortly after exceeding the limit.
+                ASSERT_LE_D(test.d_line,
+                            decompressed.length(),
+                            test.d_maxLength + 1024);
+            }
+        }
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -963,6 +1225,99 @@ static void testN3_performanceCompressionRatio()
     }
 }
 
+static void testN4_performanceAlgorithmComparison()
+// ------------------------------------------------------------------------
+// BENCHMARK: ALGORITHM COMPARISON
+//
+// Concerns:
+//   Compare the compression ratio and the throughput of compression and
+//   decompression of each supported algorithm, at various levels, on
+//   payloads resembling typical application data.
+//
+// Plan:
+//   - For JSON-like payloads of increasing sizes, round-trip the payload
+//     through each algorithm and level a number of times, and report the
+//     compression ratio and average throughput.
+//
+// Testing:
+//   Compression ratio and throughput of all supported algorithms.
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // The default allocator check fails in this test case because the
+    // output utilizes the global allocator.
+
+    mwctst::TestHelper::printTestName("BENCHMARK: ALGORITHM COMPARISON");
+
+    struct Config {
+        bmqt::CompressionAlgorithmType::Enum d_algorithm;
+        int                                  d_level;
+    } k_CONFIGS[] = {{bmqt::CompressionAlgorithmType::e_ZLIB, 1},
+                     {bmqt::CompressionAlgorithmType::e_ZLIB, 6},
+                     {bmqt::CompressionAlgorithmType::e_ZSTD, -5},
+                     {bmqt::CompressionAlgorithmType::e_ZSTD, 1},
+                     {bmqt::CompressionAlgorithmType::e_ZSTD, 3},
+                     {bmqt::CompressionAlgorithmType::e_ZSTD, 9},
+                     {bmqt::CompressionAlgorithmType::e_LZ4, 0},
+                     {bmqt::CompressionAlgorithmType::e_LZ4, 9}};
+
+    const size_t k_NUM_CONFIGS = sizeof(k_CONFIGS) / sizeof(*k_CONFIGS);
+    const int    k_NUM_ITERS   = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+
+    for (int length = 1024; length <= 1024 * 1024; length *= 8) {
+        bsl::string data(s_allocator_p);
+        generateJsonLikeString(&data, length);
+        data.resize(length);
+
+        bdlbb::Blob input(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&input, data.data(), data.length());
+
+        bsl::cout << "---------------------\n"
+                  << " SIZE = " << mwcu::PrintUtil::prettyBytes(length)
+                  << '\n'
+                  << "---------------------\n";
+
+        for (size_t i = 0; i < k_NUM_CONFIGS; ++i) {
+            const Config& config = k_CONFIGS[i];
+
+            bsls::Types::Int64 compressedSize         = 0;
+            bsls::Types::Int64 compressionTotalTime   = 0;
+            bsls::Types::Int64 decompressionTotalTime = 0;
+            for (int l = 0; l < k_NUM_ITERS; ++l) {
+                bsls::Types::Int64 compressionTime   = 0;
+                bsls::Types::Int64 decompressionTime = 0;
+                roundTripHelper(&compressedSize,
+                                &compressionTime,
+                                &decompressionTime,
+                                &bufferFactory,
+                                input,
+                                config.d_algorithm,
+                                config.d_level);
+                compressionTotalTime += compressionTime;
+                decompressionTotalTime += decompressionTime;
+            }
+
+            bsl::cout
+                << config.d_algorithm << " (level " << config.d_level
+                << "): ratio "
+                << static_cast<double>(length) / compressedSize
+                << ", compression "
+                << mwcu::PrintUtil::prettyBytes(
+                       (k_NUM_ITERS * bdlt::TimeUnitRatio::k_NS_PER_S *
+                        static_cast<bsls::Types::Int64>(length)) /
+                       compressionTotalTime)
+                << "/s, decompression "
+                << mwcu::PrintUtil::prettyBytes(
+                       (k_NUM_ITERS * bdlt::TimeUnitRatio::k_NS_PER_S *
+                        static_cast<bsls::Types::Int64>(length)) /
+                       decompressionTotalTime)
+                << "/s\n";
+        }
+    }
+}
+
 // Begin Benchmarking Tests
 #ifdef BSLS_PLATFORM_OS_LINUX
 static void testN1_performanceCompressionDecompressionDefault_GoogleBenchmark(
@@ -1057,6 +1412,8 @@ int main(int argc, char* argv[])
     case 1: test1_breathingTest(); break;
     case 2: test2_compression_cluster_message(); break;
     case 3: test3_compression_decompression_none(); break;
+    case 4: test4_compression_decompression_zstd_lz4(); break;
+    case 5: test5_decompressionMaxLength(); break;
     case -1:
         MWC_BENCHMARK_WITH_ARGS(
             testN1_performanceCompressionDecompressionDefault,
@@ -1071,6 +1428,7 @@ int main(int argc, char* argv[])
                                     ->Unit(benchmark::kMillisecond));
         break;
     case -3: testN3_performanceCompressionRatio(); break;
+    case -4: testN4_performanceAlgorithmComparison(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
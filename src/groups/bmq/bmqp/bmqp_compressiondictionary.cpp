@@ -0,0 +1,458 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.cpp                                     -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+// BDE
+#include <bdlbb_blobutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_unordered_map.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_qlock.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+
+// ZSTD
+#include <zdict.h>
+#include <zstd.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+// ==============
+// class Registry
+// ==============
+
+/// Process-wide registry of the compression dictionaries, by id.  The
+/// registry does not own the dictionaries: a dictionary is registered until
+/// the last shared pointer to it is released.
+class Registry {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<unsigned int,
+                               bsl::weak_ptr<CompressionDictionary> >
+        DictionaryMap;
+
+    // DATA
+    bslmt::ReaderWriterMutex d_mutex;
+
+    DictionaryMap d_dictionaries;
+
+  public:
+    // CREATORS
+    explicit Registry(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_dictionaries(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Register the dictionary pointed to by the specified `dictionary`,
+    /// or load into `dictionary` the registered dictionary having the same
+    /// id and content, if any.  Return 0 on success, and non-zero if a
+    /// different dictionary having the same id is registered.
+    int add(bsl::shared_ptr<CompressionDictionary>* dictionary)
+    {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_mutex);
+
+        bsl::weak_ptr<CompressionDictionary>& entry =
+            d_dictionaries[(*dictionary)->id()];
+
+        bsl::shared_ptr<CompressionDictionary> registered = entry.lock();
+        if (!registered) {
+            // Not registered, or released by all its users
+            entry = *dictionary;
+            return 0;  // RETURN
+        }
+
+        if (registered->data() != (*dictionary)->data()) {
+            // A different dictionary is registered under the same id
+            return -1;  // RETURN
+        }
+
+        *dictionary = registered;
+        return 0;
+    }
+
+    /// Remove the dictionary having the specified `id` if it has been
+    /// released by all its users.
+    void purge(unsigned int id)
+    {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_mutex);
+
+        DictionaryMap::iterator it = d_dictionaries.find(id);
+        if (it != d_dictionaries.end() && it->second.expired()) {
+            d_dictionaries.erase(it);
+        }
+    }
+
+    /// Return the dictionary having the specified `id`, if any.
+    bsl::shared_ptr<CompressionDictionary> find(unsigned int id)
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_mutex);
+
+        DictionaryMap::const_iterator it = d_dictionaries.find(id);
+        if (it == d_dictionaries.end()) {
+            return bsl::shared_ptr<CompressionDictionary>();  // RETURN
+        }
+
+        return it->second.lock();
+    }
+};
+
+/// Process-wide registry of dictionaries.
+bsls::ObjectBuffer<Registry> g_registry;
+
+/// Integer to keep track of the number of calls to `initialize` for the
+/// `CompressionDictionaryUtil`.  Each call to `initialize` increments it by
+/// one and each call to `shutdown` decrements it by one.  If the
+/// decremented value is zero, then `g_registry` is destroyed.
+int g_initialized = 0;
+
+/// Lock used to provide thread-safe protection for accessing the
+/// `g_initialized` counter.
+bslmt::QLock g_initLock = BSLMT_QLOCK_INITIALIZER;
+
+}  // close unnamed namespace
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+// PRIVATE MANIPULATORS
+void CompressionDictionary::release()
+{
+    for (CompressionStates::iterator it = d_compressionStates.begin();
+         it != d_compressionStates.end();
+         ++it) {
+        ZSTD_freeCDict(it->second);
+    }
+    d_compressionStates.clear();
+
+    if (d_decompressionState_p) {
+        ZSTD_freeDDict(d_decompressionState_p);
+        d_decompressionState_p = 0;
+    }
+}
+
+// CREATORS
+CompressionDictionary::CompressionDictionary(bslma::Allocator* allocator)
+: d_data(allocator)
+, d_id(0)
+, d_decompressionState_p(0)
+, d_compressionStates(allocator)
+, d_mutex()
+{
+    // NOTHING
+}
+
+CompressionDictionary::~CompressionDictionary()
+{
+    release();
+}
+
+// MANIPULATORS
+int CompressionDictionary::load(const char*   data,
+                                int           length,
+                                bsl::ostream* errorStream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_id == 0 && "Dictionary already loaded");
+    BSLS_ASSERT_SAFE(data || length == 0);
+
+    enum RcEnum {
+        rc_SUCCESS            = 0,
+        rc_INVALID_DICTIONARY = -1,
+        rc_DIGEST_FAILURE     = -2
+    };
+
+    const unsigned int id = ZSTD_getDictID_fromDict(data, length);
+    if (id == 0) {
+        if (errorStream) {
+            (*errorStream) << "Invalid compression dictionary: not in the "
+                           << "Zstandard dictionary format";
+        }
+        return rc_INVALID_DICTIONARY;  // RETURN
+    }
+
+    d_data.assign(data, data + length);
+
+    // Digest the dictionary from 'd_data', which it references rather than
+    // copies.
+    d_decompressionState_p = ZSTD_createDDict(d_data.data(), d_data.size());
+    if (!d_decompressionState_p) {
+        if (errorStream) {
+            (*errorStream) << "Error digesting compression dictionary [id: "
+                           << id << "]";
+        }
+        d_data.clear();
+        return rc_DIGEST_FAILURE;  // RETURN
+    }
+
+    d_id = id;
+
+    return rc_SUCCESS;
+}
+
+// ACCESSORS
+const ZSTD_CDict_s* CompressionDictionary::compressionState(int level) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_id != 0 && "Dictionary not loaded");
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    CompressionStates::const_iterator it = d_compressionStates.find(level);
+    if (it != d_compressionStates.end()) {
+        return it->second;  // RETURN
+    }
+
+    // The compression level is a property of the digested state, hence one
+    // state per level in use.
+    ZSTD_CDict* state = ZSTD_createCDict(d_data.data(), d_data.size(), level);
+    if (state) {
+        d_compressionStates.insert(bsl::make_pair(level, state));
+    }
+
+    return state;
+}
+
+// --------------------------------
+// struct CompressionDictionaryUtil
+// --------------------------------
+
+void CompressionDictionaryUtil::initialize(bslma::Allocator* allocator)
+{
+    bslmt::QLockGuard qlockGuard(&g_initLock);
+
+    ++g_initialized;
+    if (g_initialized > 1) {
+        return;  // RETURN
+    }
+
+    new (g_registry.buffer())
+        Registry(bslma::Default::globalAllocator(allocator));
+}
+
+void CompressionDictionaryUtil::shutdown()
+{
+    bslmt::QLockGuard qlockGuard(&g_initLock);
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized > 0 && "Not initialized");
+
+    if (--g_initialized != 0) {
+        return;  // RETURN
+    }
+
+    g_registry.object().~Registry();
+}
+
+int CompressionDictionaryUtil::train(bsl::vector<char>* dictionary,
+                                     const bsl::vector<bdlbb::Blob>& samples,
+                                     unsigned int                    id,
+                                     int                             maxSize,
+                                     bsl::ostream* errorStream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dictionary);
+    BSLS_ASSERT_SAFE(id != 0);
+    BSLS_ASSERT_SAFE(maxSize > 0);
+
+    enum RcEnum {
+        rc_SUCCESS              = 0,
+        rc_TRAINING_FAILURE     = -1,
+        rc_FINALIZATION_FAILURE = -2
+    };
+
+    bslma::Allocator* allocator = dictionary->get_allocator().mechanism();
+
+    // Zstandard expects the samples concatenated into a single buffer.
+    bsl::vector<char>        buffer(allocator);
+    bsl::vector<bsl::size_t> sizes(allocator);
+    sizes.reserve(samples.size());
+    for (bsl::size_t i = 0; i < samples.size(); ++i) {
+        const bdlbb::Blob& sample = samples[i];
+        const bsl::size_t  offset = buffer.size();
+
+        buffer.resize(offset + sample.length());
+        if (sample.length() != 0) {
+            bdlbb::BlobUtil::copy(buffer.data() + offset,
+                                  sample,
+                                  0,
+                                  sample.length());
+        }
+        sizes.push_back(sample.length());
+    }
+
+    bsl::vector<char> content(maxSize, '\0', allocator);
+    bsl::size_t       result = ZDICT_trainFromBuffer(
+        content.data(),
+        content.size(),
+        buffer.data(),
+        sizes.data(),
+        static_cast<unsigned int>(sizes.size()));
+    if (ZDICT_isError(result)) {
+        if (errorStream) {
+            (*errorStream) << "Error training compression dictionary, "
+                           << "Message: " << ZDICT_getErrorName(result);
+        }
+        return rc_TRAINING_FAILURE;  // RETURN
+    }
+
+    // The trained dictionary has a random id; rebuild its header from its
+    // content to assign it the requested one.
+    const bsl::size_t headerSize = ZDICT_getDictHeaderSize(content.data(),
+                                                           result);
+    if (ZDICT_isError(headerSize)) {
+        if (errorStream) {
+            (*errorStream) << "Error finalizing compression dictionary, "
+                           << "Message: " << ZDICT_getErrorName(headerSize);
+        }
+        return rc_FINALIZATION_FAILURE;  // RETURN
+    }
+
+    ZDICT_params_t params = {};
+    params.dictID         = id;
+
+    dictionary->resize(maxSize);
+    result = ZDICT_finalizeDictionary(dictionary->data(),
+                                      dictionary->size(),
+                                      content.data() + headerSize,
+                                      result - headerSize,
+                                      buffer.data(),
+                                      sizes.data(),
+                                      static_cast<unsigned int>(sizes.size()),
+                                      params);
+    if (ZDICT_isError(result)) {
+        if (errorStream) {
+            (*errorStream) << "Error finalizing compression dictionary, "
+                           << "Message: " << ZDICT_getErrorName(result);
+        }
+        dictionary->clear();
+        return rc_FINALIZATION_FAILURE;  // RETURN
+    }
+
+    dictionary->resize(result);
+
+    return rc_SUCCESS;
+}
+
+int CompressionDictionaryUtil::registerDictionary(
+    bsl::shared_ptr<CompressionDictionary>* dictionary)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+    BSLS_ASSERT_SAFE(dictionary && *dictionary && (*dictionary)->id() != 0);
+
+    return g_registry.object().add(dictionary);
+}
+
+void CompressionDictionaryUtil::unregisterDictionary(
+    bsl::shared_ptr<CompressionDictionary>* dictionary)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+    BSLS_ASSERT_SAFE(dictionary);
+
+    if (!*dictionary) {
+        return;  // RETURN
+    }
+
+    const unsigned int id = (*dictionary)->id();
+    dictionary->reset();
+
+    g_registry.object().purge(id);
+}
+
+int CompressionDictionaryUtil::loadAndRegister(
+    bsl::shared_ptr<CompressionDictionary>* dictionary,
+    const char*                             data,
+    int                                     length,
+    bsl::ostream*                           errorStream,
+    bslma::Allocator*                       allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+    BSLS_ASSERT_SAFE(dictionary);
+
+    enum RcEnum {
+        rc_SUCCESS        = 0,
+        rc_LOAD_FAILURE   = -1,
+        rc_CONFLICTING_ID = -2
+    };
+
+    // Most of the time the dictionary is already registered (e.g., every
+    // queue of a domain shares the same dictionaries): avoid digesting it
+    // again.
+    const unsigned int id = ZSTD_getDictID_fromDict(data, length);
+    if (id != 0) {
+        bsl::shared_ptr<CompressionDictionary> registered =
+            g_registry.object().find(id);
+        if (registered &&
+            registered->data().size() == static_cast<bsl::size_t>(length) &&
+            bsl::equal(registered->data().begin(),
+                       registered->data().end(),
+                       data)) {
+            *dictionary = registered;
+            return rc_SUCCESS;  // RETURN
+        }
+    }
+
+    bslma::Allocator* alloc = bslma::Default::allocator(allocator);
+
+    bsl::shared_ptr<CompressionDictionary> loaded;
+    loaded.createInplace(alloc, alloc);
+
+    const int rc = loaded->load(data, length, errorStream);
+    if (rc != 0) {
+        return rc * 10 + rc_LOAD_FAILURE;  // RETURN
+    }
+
+    // Registration is idempotent: 'loaded' is replaced by the registered
+    // instance in case of a concurrent registration of the same dictionary.
+    if (g_registry.object().add(&loaded) != 0) {
+        if (errorStream) {
+            (*errorStream) << "A different compression dictionary is already "
+                           << "registered [id: " << loaded->id() << "]";
+        }
+        return rc_CONFLICTING_ID;  // RETURN
+    }
+
+    *dictionary = loaded;
+
+    return rc_SUCCESS;
+}
+
+bsl::shared_ptr<CompressionDictionary>
+CompressionDictionaryUtil::lookup(unsigned int id)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized && "Not initialized");
+
+    return g_registry.object().find(id);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
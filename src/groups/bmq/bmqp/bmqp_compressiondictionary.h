@@ -0,0 +1,304 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.h                                       -*-C++-*-
+#ifndef INCLUDED_BMQP_COMPRESSIONDICTIONARY
+#define INCLUDED_BMQP_COMPRESSIONDICTIONARY
+
+//@PURPOSE: Provide a versioned dictionary for compressing small messages.
+//
+//@CLASSES:
+//  bmqp::CompressionDictionary    : digested Zstandard dictionary and its id
+//  bmqp::CompressionDictionaryUtil: training and process-wide registration
+//
+//@DESCRIPTION: Small messages (a few hundred bytes) compress poorly because
+// each of them is compressed starting from an empty history.  A dictionary
+// trained from representative messages provides that history up front, and
+// typically improves the compression ratio of such messages several times.
+//
+// This component provides 'bmqp::CompressionDictionary', a Zstandard
+// dictionary along with its digested compression and decompression states,
+// and 'bmqp::CompressionDictionaryUtil', a utility to train dictionaries out
+// of sampled messages and to register them in a process-wide registry.
+//
+// Each dictionary carries a 32-bit id (its version) which Zstandard records
+// in the header of every frame compressed with it.  When decompressing a
+// frame, 'bmqp::Compression' extracts this id and looks the dictionary up in
+// the registry, so that no additional information needs to be carried in the
+// protocol headers.  A process must therefore register every dictionary it
+// may have to decompress with (e.g., the current and previous versions used
+// by a queue) before decompressing messages compressed with it.
+//
+// The registry does not own the dictionaries: a dictionary remains registered
+// as long as a shared pointer to it, as returned by the registration, is
+// held, and is unregistered once the last one is released (e.g., when the
+// queue or domain which registered it goes away).  A dictionary can be
+// registered by several users, provided that they all register the same
+// content under a given id; registering a different dictionary under the id
+// of a dictionary still in use fails.  Hence the id of a dictionary must
+// identify its content among all the dictionaries in use in a process, and
+// a new version of a dictionary must be given a new id.
+//
+// Note that the registry is shared by everything running in the process, and
+// is not scoped to a broker or a session.  In particular, when several
+// brokers (or a broker and SDK sessions) run in the same process, as in some
+// integration tests, they all share the same registry: the ids of the
+// dictionaries they use must then be unique across all of them, and a
+// dictionary registered by one of them can be used to decompress messages
+// received by any other.
+//
+// Dictionaries are distributed by the broker as part of the open-queue
+// response (see 'bmqp_ctrlmsg::OpenQueueResponse::compressionDictionaries').
+//
+/// Thread Safety
+///-------------
+// 'bmqp::CompressionDictionary' is thread safe once loaded: all its
+// accessors may be called concurrently.  'bmqp::CompressionDictionaryUtil'
+// is thread safe.
+//
+/// Usage
+///-----
+//..
+//  bsl::vector<bdlbb::Blob> samples;  // Representative payloads
+//  bsl::vector<char>        data;
+//  int rc = bmqp::CompressionDictionaryUtil::train(&data,
+//                                                  samples,
+//                                                  42,         // id
+//                                                  16 * 1024,  // max size
+//                                                  &errorStream);
+//
+//  bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+//  rc = bmqp::CompressionDictionaryUtil::loadAndRegister(&dictionary,
+//                                                        data.data(),
+//                                                        data.size(),
+//                                                        &errorStream);
+//
+//  // ... use 'dictionary' ...
+//
+//  // Unregister the dictionary, unless it is still used elsewhere.
+//  bmqp::CompressionDictionaryUtil::unregisterDictionary(&dictionary);
+//..
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_cpp11.h>
+
+// Forward declarations of the Zstandard dictionary types
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace BloombergLP {
+
+namespace bmqp {
+
+// ===========================
+// class CompressionDictionary
+// ===========================
+
+/// This class holds a Zstandard dictionary, its id, and the digested
+/// states used to compress and decompress with it.
+class CompressionDictionary {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::map<int, ZSTD_CDict_s*> CompressionStates;
+
+    // DATA
+    bsl::vector<char> d_data;
+    // Raw dictionary, in the Zstandard
+    // dictionary format.
+
+    unsigned int d_id;
+    // Id of the dictionary, or 0 if not
+    // loaded.
+
+    ZSTD_DDict_s* d_decompressionState_p;
+    // Digested decompression state.
+
+    mutable CompressionStates d_compressionStates;
+    // Digested compression states, created
+    // lazily, per compression level.
+
+    mutable bslmt::Mutex d_mutex;
+    // Mutex protecting
+    // 'd_compressionStates'.
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionDictionary(const CompressionDictionary&) BSLS_CPP11_DELETED;
+    CompressionDictionary&
+    operator=(const CompressionDictionary&) BSLS_CPP11_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Release all digested states.
+    void release();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressionDictionary,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty dictionary, using the optionally specified
+    /// `allocator` to supply memory.
+    explicit CompressionDictionary(bslma::Allocator* allocator = 0);
+
+    /// Destroy this object.
+    ~CompressionDictionary();
+
+    // MANIPULATORS
+
+    /// Load into this object the dictionary in the Zstandard dictionary
+    /// format contained in the specified `data` of the specified `length`.
+    /// Return 0 on success, and non-zero otherwise, with details written to
+    /// the optionally specified `errorStream`.  The behavior is undefined
+    /// unless this object is empty.  Note that a dictionary having an id of
+    /// 0 (i.e., a raw content dictionary) is rejected, as frames compressed
+    /// with it could not be associated with it.
+    int load(const char* data, int length, bsl::ostream* errorStream = 0);
+
+    // ACCESSORS
+
+    /// Return the id of this dictionary, or 0 if it is empty.
+    unsigned int id() const;
+
+    /// Return the raw dictionary.
+    const bsl::vector<char>& data() const;
+
+    /// Return the digested compression state of this dictionary for the
+    /// specified Zstandard compression `level`, creating it if needed, or 0
+    /// if it could not be created.  The behavior is undefined unless this
+    /// object is loaded.
+    const ZSTD_CDict_s* compressionState(int level) const;
+
+    /// Return the digested decompression state of this dictionary.  The
+    /// behavior is undefined unless this object is loaded.
+    const ZSTD_DDict_s* decompressionState() const;
+};
+
+// ================================
+// struct CompressionDictionaryUtil
+// ================================
+
+/// This struct provides utilities to train compression dictionaries and to
+/// register them for use when decompressing.
+struct CompressionDictionaryUtil {
+    // CLASS METHODS
+
+    /// Initialize the process-wide registry of dictionaries.  Use the
+    /// optionally specified `allocator` for any memory allocation, or the
+    /// `global` allocator if none is provided.  Calls to `initialize` are
+    /// reference counted and must each be balanced by a call to `shutdown`.
+    /// Note that `bmqp::ProtocolUtil::initialize` calls this method.
+    static void initialize(bslma::Allocator* allocator = 0);
+
+    /// Pendant operation of the `initialize` one, releasing all registered
+    /// dictionaries on the last call.  The behavior is undefined unless
+    /// `initialize` was called.
+    static void shutdown();
+
+    /// Train a dictionary having the specified `id` and a size of at most
+    /// the specified `maxSize` bytes out of the specified `samples`, and
+    /// load it into the specified `dictionary`.  Return 0 on success, and
+    /// non-zero otherwise, with details written to the optionally specified
+    /// `errorStream`.  The behavior is undefined unless `id` is not 0.
+    /// Note that training requires a reasonable number of samples (at least
+    /// a few hundreds, of a total size of about 100 times `maxSize`) and
+    /// fails if the samples are too few, too small, or all identical.
+    static int train(bsl::vector<char>*              dictionary,
+                     const bsl::vector<bdlbb::Blob>& samples,
+                     unsigned int                    id,
+                     int                             maxSize,
+                     bsl::ostream*                   errorStream = 0);
+
+    /// Register the dictionary pointed to by the specified `dictionary` so
+    /// that messages compressed with it can be decompressed, for as long as
+    /// a shared pointer to it is held.  If a dictionary having the same id
+    /// and content is already registered, load it into `dictionary`
+    /// instead.  Return 0 on success, and non-zero if a different
+    /// dictionary with the same id is already registered.  The behavior is
+    /// undefined unless `initialize` was called and `*dictionary` is
+    /// loaded.
+    static int
+    registerDictionary(bsl::shared_ptr<CompressionDictionary>* dictionary);
+
+    /// Release the specified `dictionary`, and unregister the dictionary it
+    /// points to, if any, unless it is still held by another user.  The
+    /// behavior is undefined unless `initialize` was called.  Note that
+    /// releasing `dictionary` in any other way has the same effect, except
+    /// that the registry reclaims the space of the entry lazily.
+    static void
+    unregisterDictionary(bsl::shared_ptr<CompressionDictionary>* dictionary);
+
+    /// Load into the specified `dictionary` the registered dictionary
+    /// equal to the one in the Zstandard dictionary format contained in the
+    /// specified `data` of the specified `length`, loading and registering
+    /// it first, using the optionally specified `allocator`, if it is not
+    /// registered yet.  The dictionary remains registered for as long as a
+    /// shared pointer to it is held.  Return 0 on success, and non-zero if
+    /// the dictionary is invalid or conflicts with a registered one, with
+    /// details written to the optionally specified `errorStream`.  The
+    /// behavior is undefined unless `initialize` was called.
+    static int loadAndRegister(
+        bsl::shared_ptr<CompressionDictionary>* dictionary,
+        const char*                             data,
+        int                                     length,
+        bsl::ostream*                           errorStream = 0,
+        bslma::Allocator*                       allocator   = 0);
+
+    /// Return the registered dictionary having the specified `id`, or an
+    /// empty pointer if there is no such dictionary.  The behavior is
+    /// undefined unless `initialize` was called.
+    static bsl::shared_ptr<CompressionDictionary> lookup(unsigned int id);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+// ACCESSORS
+inline unsigned int CompressionDictionary::id() const
+{
+    return d_id;
+}
+
+inline const bsl::vector<char>& CompressionDictionary::data() const
+{
+    return d_data;
+}
+
+inline const ZSTD_DDict_s* CompressionDictionary::decompressionState() const
+{
+    return d_decompressionState_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,385 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.t.cpp                                   -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+// BMQ
+#include <bmqp_compression.h>
+#include <bmqt_compressionalgorithmtype.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdlb_random.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Append to the specified `blob` a small JSON-like message, similar to
+/// the ones dictionaries are meant for, built using the specified `seed`.
+void appendMessage(bdlbb::Blob* blob, int* seed)
+{
+    mwcu::MemOutStream os(s_allocator_p);
+    for (int i = 0; i < 3; ++i) {
+        const int value = bdlb::Random::generate15(seed);
+        os << "{\"id\":" << value << ",\"ticker\":\""
+           << static_cast<char>('A' + value % 26)
+           << static_cast<char>('A' + (value / 26) % 26) << "\",\"side\":\""
+           << ((value % 2) ? "BUY" : "SELL")
+           << "\",\"price\":" << value % 1000 << "." << value % 100
+           << ",\"quantity\":" << value % 997 << ",\"account\":\"ACC-"
+           << value % 50 << "\"}";
+    }
+
+    bdlbb::BlobUtil::append(blob, os.str().data(), os.str().length());
+}
+
+/// Load into the specified `samples` the specified `numSamples` messages,
+/// created using the specified `bufferFactory`.
+void generateSamples(bsl::vector<bdlbb::Blob>* samples,
+                     int                       numSamples,
+                     bdlbb::BlobBufferFactory* bufferFactory)
+{
+    int seed = 1;
+    for (int i = 0; i < numSamples; ++i) {
+        bdlbb::Blob sample(bufferFactory, s_allocator_p);
+        appendMessage(&sample, &seed);
+        samples->push_back(sample);
+    }
+}
+
+/// Train a dictionary having the specified `id` and a maximum size of the
+/// specified `maxSize` from the specified `samples`, and load it into the
+/// specified `dictionary`.
+void makeDictionary(bsl::shared_ptr<bmqp::CompressionDictionary>* dictionary,
+                    const bsl::vector<bdlbb::Blob>&               samples,
+                    unsigned int                                  id,
+                    int                                           maxSize)
+{
+    mwcu::MemOutStream error(s_allocator_p);
+    bsl::vector<char>  data(s_allocator_p);
+
+    int rc = bmqp::CompressionDictionaryUtil::train(&data,
+                                                    samples,
+                                                    id,
+                                                    maxSize,
+                                                    &error);
+    ASSERT_EQ_D(error.str(), rc, 0);
+
+    dictionary->createInplace(s_allocator_p, s_allocator_p);
+    rc = (*dictionary)->load(data.data(), data.size(), &error);
+    ASSERT_EQ_D(error.str(), rc, 0);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component: a dictionary can be
+//   trained with a given id, loaded, and an invalid dictionary is
+//   rejected.
+//
+// Testing:
+//   CompressionDictionaryUtil::train
+//   CompressionDictionary::load
+//   CompressionDictionary::id
+//   CompressionDictionary::data
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::vector<bdlbb::Blob>       samples(s_allocator_p);
+    generateSamples(&samples, 2000, &bufferFactory);
+
+    {
+        PV("Empty dictionary");
+
+        bmqp::CompressionDictionary obj(s_allocator_p);
+        ASSERT_EQ(obj.id(), 0U);
+        ASSERT(obj.data().empty());
+    }
+
+    {
+        PV("Train and load");
+
+        const unsigned int k_ID       = 42;
+        const int          k_MAX_SIZE = 16 * 1024;
+
+        bsl::shared_ptr<bmqp::CompressionDictionary> obj;
+        makeDictionary(&obj, samples, k_ID, k_MAX_SIZE);
+
+        ASSERT_EQ(obj->id(), k_ID);
+        ASSERT(!obj->data().empty());
+        ASSERT_LE(obj->data().size(), static_cast<bsl::size_t>(k_MAX_SIZE));
+        ASSERT(obj->decompressionState() != 0);
+        ASSERT(obj->compressionState(0) != 0);
+        ASSERT(obj->compressionState(0) == obj->compressionState(0));
+    }
+
+    {
+        PV("Invalid dictionary");
+
+        const char k_DATA[] = "not a dictionary";
+
+        mwcu::MemOutStream          error(s_allocator_p);
+        bmqp::CompressionDictionary obj(s_allocator_p);
+        ASSERT_NE(obj.load(k_DATA, sizeof(k_DATA), &error), 0);
+        ASSERT_EQ(obj.id(), 0U);
+        ASSERT(!error.str().empty());
+    }
+
+    {
+        PV("Not enough samples");
+
+        mwcu::MemOutStream       error(s_allocator_p);
+        bsl::vector<char>        data(s_allocator_p);
+        bsl::vector<bdlbb::Blob> fewSamples(samples.begin(),
+                                            samples.begin() + 2,
+                                            s_allocator_p);
+
+        ASSERT_NE(bmqp::CompressionDictionaryUtil::train(&data,
+                                                         fewSamples,
+                                                         42,
+                                                         16 * 1024,
+                                                         &error),
+                  0);
+        ASSERT(!error.str().empty());
+    }
+}
+
+static void test2_registry()
+// ------------------------------------------------------------------------
+// REGISTRY
+//
+// Concerns:
+//   1. A registered dictionary can be looked up by its id.
+//   2. Registering the same dictionary again succeeds, and registering an
+//      identical dictionary yields the registered one.
+//   3. Registering a different dictionary with the same id fails, and
+//      leaves the registered one untouched.
+//   4. A dictionary is unregistered once released by all its users, after
+//      which a different dictionary can be registered with the same id.
+//
+// Testing:
+//   CompressionDictionaryUtil::registerDictionary
+//   CompressionDictionaryUtil::unregisterDictionary
+//   CompressionDictionaryUtil::lookup
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REGISTRY");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::vector<bdlbb::Blob>       samples(s_allocator_p);
+    generateSamples(&samples, 2000, &bufferFactory);
+
+    const unsigned int k_ID = 1234;
+
+    bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+    bsl::shared_ptr<bmqp::CompressionDictionary> identical;
+    bsl::shared_ptr<bmqp::CompressionDictionary> other;
+    makeDictionary(&dictionary, samples, k_ID, 16 * 1024);
+    makeDictionary(&identical, samples, k_ID, 16 * 1024);
+    makeDictionary(&other, samples, k_ID, 8 * 1024);
+    ASSERT(identical->data() == dictionary->data());
+
+    ASSERT(!bmqp::CompressionDictionaryUtil::lookup(k_ID));
+
+    bsl::shared_ptr<bmqp::CompressionDictionary> registered = dictionary;
+    ASSERT_EQ(bmqp::CompressionDictionaryUtil::registerDictionary(&registered),
+              0);
+    ASSERT(registered == dictionary);
+    ASSERT(bmqp::CompressionDictionaryUtil::lookup(k_ID) == dictionary);
+    ASSERT(!bmqp::CompressionDictionaryUtil::lookup(k_ID + 1));
+
+    PV("Same dictionary");
+    ASSERT_EQ(bmqp::CompressionDictionaryUtil::registerDictionary(&registered),
+              0);
+    ASSERT(registered == dictionary);
+
+    PV("Identical dictionary");
+    ASSERT_EQ(bmqp::CompressionDictionaryUtil::registerDictionary(&identical),
+              0);
+    ASSERT(identical == dictionary);
+
+    PV("Different dictionary, same id");
+    ASSERT_NE(bmqp::CompressionDictionaryUtil::registerDictionary(&other), 0);
+    ASSERT(bmqp::CompressionDictionaryUtil::lookup(k_ID) == dictionary);
+
+    PV("Unregistration");
+    bmqp::CompressionDictionaryUtil::unregisterDictionary(&registered);
+    bmqp::CompressionDictionaryUtil::unregisterDictionary(&identical);
+    ASSERT(!registered);
+    ASSERT(!identical);
+    ASSERT(bmqp::CompressionDictionaryUtil::lookup(k_ID) == dictionary);
+
+    dictionary.reset();
+    ASSERT(!bmqp::CompressionDictionaryUtil::lookup(k_ID));
+
+    ASSERT_EQ(bmqp::CompressionDictionaryUtil::registerDictionary(&other), 0);
+    ASSERT(bmqp::CompressionDictionaryUtil::lookup(k_ID) == other);
+
+    bmqp::CompressionDictionaryUtil::unregisterDictionary(&other);
+    ASSERT(!bmqp::CompressionDictionaryUtil::lookup(k_ID));
+
+    // Unregistering an empty pointer has no effect
+    bmqp::CompressionDictionaryUtil::unregisterDictionary(&other);
+}
+
+static void test3_compressDecompress()
+// ------------------------------------------------------------------------
+// COMPRESS DECOMPRESS
+//
+// Concerns:
+//   1. A message compressed with a dictionary is smaller than the same
+//      message compressed without.
+//   2. Decompressing a message compressed with a dictionary fails until the
+//      dictionary is registered, and succeeds afterwards.
+//
+// Testing:
+//   Compression::compress with a dictionary
+//   Compression::decompress of a message compressed with a dictionary
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPRESS DECOMPRESS");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::vector<bdlbb::Blob>       samples(s_allocator_p);
+    generateSamples(&samples, 2000, &bufferFactory);
+
+    bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+    makeDictionary(&dictionary, samples, 5678, 16 * 1024);
+
+    // A message that was not part of the samples
+    int         seed = 12345;
+    bdlbb::Blob input(&bufferFactory, s_allocator_p);
+    appendMessage(&input, &seed);
+
+    const int k_LEVELS[] = {-3, 0, 1, 9};
+
+    for (bsl::size_t i = 0; i < sizeof(k_LEVELS) / sizeof(*k_LEVELS); ++i) {
+        const int level = k_LEVELS[i];
+
+        PVV("Level: " << level);
+
+        mwcu::MemOutStream error(s_allocator_p);
+        bdlbb::Blob        withDictionary(&bufferFactory, s_allocator_p);
+        bdlbb::Blob        withoutDictionary(&bufferFactory, s_allocator_p);
+
+        int rc = bmqp::Compression::compress(
+            &withDictionary,
+            &bufferFactory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            level,
+            dictionary.get(),
+            input,
+            &error,
+            s_allocator_p);
+        ASSERT_EQ_D(error.str(), rc, 0);
+
+        rc = bmqp::Compression::compress(
+            &withoutDictionary,
+            &bufferFactory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            level,
+            input,
+            &error,
+            s_allocator_p);
+        ASSERT_EQ_D(error.str(), rc, 0);
+
+        PVV("Input: " << input.length()
+                      << ", with dictionary: " << withDictionary.length()
+                      << ", without: " << withoutDictionary.length());
+        ASSERT_LT(withDictionary.length(), withoutDictionary.length());
+
+        if (i == 0) {
+            // Not registered yet
+            bdlbb::Blob output(&bufferFactory, s_allocator_p);
+            rc = bmqp::Compression::decompress(
+                &output,
+                &bufferFactory,
+                bmqt::CompressionAlgorithmType::e_ZSTD,
+                withDictionary,
+                &error,
+                s_allocator_p);
+            ASSERT_NE(rc, 0);
+
+            ASSERT_EQ(
+                bmqp::CompressionDictionaryUtil::registerDictionary(
+                    &dictionary),
+                0);
+        }
+
+        bdlbb::Blob output(&bufferFactory, s_allocator_p);
+        rc = bmqp::Compression::decompress(
+            &output,
+            &bufferFactory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            withDictionary,
+            &error,
+            s_allocator_p);
+        ASSERT_EQ_D(error.str(), rc, 0);
+        ASSERT_EQ(bdlbb::BlobUtil::compare(output, input), 0);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    bmqp::CompressionDictionaryUtil::initialize(s_allocator_p);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_compressDecompress(); break;
+    case 2: test2_registry(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    bmqp::CompressionDictionaryUtil::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
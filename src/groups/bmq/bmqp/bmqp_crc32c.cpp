@@ -39,6 +39,23 @@
 // calculations in parallel (see 'C(i)' in 'crc32c1024SseInt' or refer to the
 // white paper linked in the implementation for 'crc32c1024SseInt').
 //
+/// Carry-less Multiplication
+///-------------------------
+// On CPUs supporting it, the 'crc32' instruction is only used for the tail
+// (less than 64 bytes) of the buffer and to reduce the final 128-bit block.
+// The bulk of the buffer is instead "folded" using carry-less multiplication
+// ('PCLMULQDQ', or its 512-bit AVX-512 counterpart 'VPCLMULQDQ'), following
+// the approach described in the Intel white paper "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction": several independent
+// accumulators are each multiplied by 'x^D mod P' (shifting them forward by
+// 'D' bits, modulo the CRC32-C polynomial 'P') and xor-ed with the next
+// blocks of data.  Unlike the 'triplet' implementation, this does not require
+// the buffer to be split in blocks of 1024 bytes, and the 512-bit flavor
+// processes 256 bytes per iteration.
+//
+// The same 'x^n mod P' arithmetic is used by 'Crc32c::combine', which shifts
+// the CRC32-C of a first buffer by the length of a second one.
+//
 /// Calculation Time
 ///----------------
 // In the table below:
@@ -102,6 +119,29 @@
 #include <cpuid.h>
 #endif
 
+// Carry-less multiplication kernels are compiled with a function-level target
+// attribute, hence do not require the whole component to be built with the
+// corresponding instruction set enabled.  They are only selected at runtime if
+// the CPU supports them.
+#if defined(BMQP_CRC32C_LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#define BMQP_CRC32C_PCLMUL
+#if (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000) || \
+    (defined(BSLS_PLATFORM_CMP_CLANG) && __clang_major__ >= 8)
+#define BMQP_CRC32C_VPCLMUL
+#endif
+#endif
+
+#ifdef BMQP_CRC32C_PCLMUL
+#include <immintrin.h>
+
+#define BMQP_CRC32C_TARGET_PCLMUL __attribute__((target("sse4.2,pclmul")))
+#endif
+
+#ifdef BMQP_CRC32C_VPCLMUL
+#define BMQP_CRC32C_TARGET_VPCLMUL                                            \
+    __attribute__((target("sse4.2,pclmul,avx512f,avx512vl,vpclmulqdq")))
+#endif
+
 namespace BloombergLP {
 namespace bmqp {
 
@@ -114,6 +154,32 @@ const char k_LOG_CATEGORY[] = "BMQP.CRC32C";
 /// platform-dependant implementation to compute CRC32-C checksums.
 Crc32c::Crc32cFn g_crc32cCalculator = 0;
 
+#ifdef BMQP_CRC32C_PCLMUL
+/// Whether the running CPU supports the `PCLMULQDQ` instruction.  Set by
+/// `initialize()`.
+bool g_hasPclmul = false;
+#endif
+
+#ifdef BMQP_CRC32C_VPCLMUL
+/// Whether the running CPU (and operating system) support the AVX-512
+/// `VPCLMULQDQ` instruction.  Set by `initialize()`.
+bool g_hasVpclmul = false;
+#endif
+
+/// Bit-reflected CRC32-C (Castagnoli) polynomial.
+const unsigned int k_CRC32C_POLY_REFLECTED = 0x82F63B78U;
+
+/// Table of `x^(2^k) mod P`, for `k` in `[0, 30]`, where `P` is the CRC32-C
+/// polynomial, in bit-reflected representation.  Note that `x^(2^31) mod P`
+/// is `x`, hence the table wraps around past its last entry.
+const unsigned int k_X2N_TABLE[31] = {
+    0x40000000, 0x20000000, 0x08000000, 0x00800000, 0x00008000, 0x82F63B78,
+    0x6EA2D55C, 0x18B8EA18, 0x510AC59A, 0xB82BE955, 0xB8FDB1E7, 0x88E56F72,
+    0x74C360A4, 0xE4172B16, 0x0D65762A, 0x35D73A62, 0x28461564, 0xBF455269,
+    0xE2EA32DC, 0xFE7740E6, 0xF946610B, 0x3C204F8F, 0x538586E3, 0x59726915,
+    0x734D5309, 0xBC1AC763, 0x7D0722CC, 0xD289CABE, 0xE94CA9BC, 0x05B74F3F,
+    0xA51E1F42};
+
 const unsigned int k_CRC_TABLE_IL8_O32[256] =
     // The following CRC lookup table was generated automagically using the
     // following model parameters:
@@ -685,6 +751,41 @@ static inline unsigned int crc32cSoftware(const unsigned char* data,
     return crc ^ ~0U;  // XOROUT = true: Do a final XOR on output
 }
 
+/// Return the product, modulo the CRC32-C polynomial, of the specified `a`
+/// and `b` polynomials, all in bit-reflected representation.
+static inline unsigned int multModP(unsigned int a, unsigned int b)
+{
+    unsigned int m = 1U << 31;
+    unsigned int p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;  // BREAK
+            }
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ k_CRC32C_POLY_REFLECTED : b >> 1;
+    }
+    return p;
+}
+
+/// Return `x^(8 * n) mod P`, where `P` is the CRC32-C polynomial, for the
+/// specified `n` number of bytes, in bit-reflected representation.
+static inline unsigned int x8nModP(bsls::Types::Uint64 n)
+{
+    unsigned int p = 1U << 31;  // x^0
+    unsigned int k = 3;         // x^8 = x^(2^3)
+    while (n) {
+        if (n & 1) {
+            p = multModP(k_X2N_TABLE[k], p);
+        }
+        n >>= 1;
+        k = (k + 1) % 31;
+    }
+    return p;
+}
+
 #ifdef BMQP_CRC32C_LIKE_X86_GCC
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
@@ -1044,6 +1145,277 @@ static inline unsigned int crc32c1024SseInt(const unsigned char* data,
 #undef C
 }
 
+#ifdef BMQP_CRC32C_PCLMUL
+
+// Fold constants for the carry-less multiplication kernels.  Folding a
+// 128-bit block 'X = L * x^64 + H' (where 'L' holds its first 8 bytes)
+// forward by 'D' bits amounts to multiplying 'L' by 'x^(D + 64 - 33) mod P'
+// and 'H' by 'x^(D - 33) mod P', the extra '- 33' accounting for the
+// bit-reflected representation of the operands of 'PCLMULQDQ'.  Each pair
+// below is '(x^(D + 31) mod P, x^(D - 33) mod P)' for the 'D' in its name.
+const long long k_FOLD_128_LO  = 0xF20C0DFE;
+const long long k_FOLD_128_HI  = 0x493C7D27;
+const long long k_FOLD_256_LO  = 0x3DA6D0CB;
+const long long k_FOLD_256_HI  = 0xBA4FC28E;
+const long long k_FOLD_384_LO  = 0x1C291D04;
+const long long k_FOLD_384_HI  = 0xDDC0152B;
+const long long k_FOLD_512_LO  = 0x740EEF02;
+const long long k_FOLD_512_HI  = 0x9E4ADDF8;
+const long long k_FOLD_2048_LO = 0xDCB17AA4;
+const long long k_FOLD_2048_HI = 0xB9E02B86;
+
+/// Return the specified 128-bit `block` folded forward using the specified
+/// `constants` pair (see `k_FOLD_*`).
+BMQP_CRC32C_TARGET_PCLMUL
+static inline __m128i fold128(__m128i block, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, constants, 0x00),
+                         _mm_clmulepi64_si128(block, constants, 0x11));
+}
+
+/// Return the CRC32-C register value after processing the specified
+/// 128-bit `block`, starting from a zero register.
+BMQP_CRC32C_TARGET_PCLMUL
+static inline unsigned int reduce128(__m128i block)
+{
+    unsigned int crc = static_cast<unsigned int>(
+        __builtin_ia32_crc32di(0, _mm_cvtsi128_si64(block)));
+    return static_cast<unsigned int>(
+        __builtin_ia32_crc32di(crc, _mm_extract_epi64(block, 1)));
+}
+
+/// Calculate the CRC32-C register value (using `PCLMULQDQ`) for the buffer
+/// pointed to by the specified `dataPtr` over the largest multiple of 64
+/// bytes not exceeding the length pointed to by the specified `lengthPtr`,
+/// using the specified `crc` register value as the starting point for the
+/// calculation.  The buffer pointed to by `dataPtr` is advanced, and the
+/// length pointed to by `lengthPtr` decremented, by the number of bytes
+/// processed.  Behavior is undefined unless the length pointed to by
+/// `lengthPtr` is at least 64.  Note that the buffer need not be at an
+/// alignment boundary.
+BMQP_CRC32C_TARGET_PCLMUL
+static unsigned int crc32cFold128(const unsigned char** dataPtr,
+                                  unsigned int*         lengthPtr,
+                                  unsigned int          crc)
+{
+    const __m128i* data   = reinterpret_cast<const __m128i*>(*dataPtr);
+    unsigned int   length = *lengthPtr;
+
+    // Four independent 128-bit accumulators, the register value being
+    // injected in the first 32 bits of the data.
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(data),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(data + 1);
+    __m128i x2 = _mm_loadu_si128(data + 2);
+    __m128i x3 = _mm_loadu_si128(data + 3);
+    data += 4;
+    length -= 64;
+
+    const __m128i k512 = _mm_set_epi64x(k_FOLD_512_HI, k_FOLD_512_LO);
+    while (length >= 64) {
+        x0 = _mm_xor_si128(fold128(x0, k512), _mm_loadu_si128(data));
+        x1 = _mm_xor_si128(fold128(x1, k512), _mm_loadu_si128(data + 1));
+        x2 = _mm_xor_si128(fold128(x2, k512), _mm_loadu_si128(data + 2));
+        x3 = _mm_xor_si128(fold128(x3, k512), _mm_loadu_si128(data + 3));
+        data += 4;
+        length -= 64;
+    }
+
+    // Fold the four accumulators into the last one
+    const __m128i k128 = _mm_set_epi64x(k_FOLD_128_HI, k_FOLD_128_LO);
+    x1                 = _mm_xor_si128(fold128(x0, k128), x1);
+    x2                 = _mm_xor_si128(fold128(x1, k128), x2);
+    x3                 = _mm_xor_si128(fold128(x2, k128), x3);
+
+    *dataPtr   = reinterpret_cast<const unsigned char*>(data);
+    *lengthPtr = length;
+
+    return reduce128(x3);
+}
+
+/// Calculate the CRC32-C value (using `PCLMULQDQ` and SSE intrinsics) for
+/// the specified `data` over the specified `length` number of bytes, using
+/// the specified `crc` value as the starting point for the calculation.
+/// Processing is 64 bytes at a time while at least 64 bytes remain, then 8
+/// bytes at a time.
+BMQP_CRC32C_TARGET_PCLMUL
+static unsigned int crc32cPclmul64bit(const unsigned char* data,
+                                      unsigned int         length,
+                                      unsigned int         crc)
+{
+    crc = crc ^ ~0U;  // INIT = 0xFFFFFFFF: Initial value of the register
+
+    if (length >= 64) {
+        crc = crc32cFold128(&data, &length, crc);
+    }
+    if (length) {
+        crc = crc32c8s(data, length, crc);
+    }
+
+    return crc ^ ~0U;  // XOROUT = true: Do a final XOR on output
+}
+
+#endif  // BMQP_CRC32C_PCLMUL
+
+#ifdef BMQP_CRC32C_VPCLMUL
+
+/// Return the specified 512-bit `block` folded forward using the specified
+/// per-lane `constants` pairs (see `k_FOLD_*`).
+BMQP_CRC32C_TARGET_VPCLMUL
+static inline __m512i fold512(__m512i block, __m512i constants)
+{
+    return _mm512_xor_si512(_mm512_clmulepi64_epi128(block, constants, 0x00),
+                            _mm512_clmulepi64_epi128(block, constants, 0x11));
+}
+
+/// Calculate the CRC32-C value (using AVX-512 `VPCLMULQDQ`, `PCLMULQDQ` and
+/// SSE intrinsics) for the specified `data` over the specified `length`
+/// number of bytes, using the specified `crc` value as the starting point
+/// for the calculation.  Processing is 256 bytes at a time while at least
+/// 256 bytes remain, then 64 bytes at a time, then 8 bytes at a time.
+BMQP_CRC32C_TARGET_VPCLMUL
+static unsigned int crc32cVpclmul64bit(const unsigned char* data,
+                                       unsigned int         length,
+                                       unsigned int         crc)
+{
+    crc = crc ^ ~0U;  // INIT = 0xFFFFFFFF: Initial value of the register
+
+    if (length >= 256) {
+        const __m512i* data512 = reinterpret_cast<const __m512i*>(data);
+
+        // Four independent 512-bit accumulators, the register value being
+        // injected in the first 32 bits of the data.
+        __m512i z0 = _mm512_xor_si512(
+            _mm512_loadu_si512(data512),
+            _mm512_castsi128_si512(_mm_cvtsi32_si128(static_cast<int>(crc))));
+        __m512i z1 = _mm512_loadu_si512(data512 + 1);
+        __m512i z2 = _mm512_loadu_si512(data512 + 2);
+        __m512i z3 = _mm512_loadu_si512(data512 + 3);
+        data512 += 4;
+        length -= 256;
+
+        const __m512i k2048 = _mm512_set_epi64(k_FOLD_2048_HI,
+                                               k_FOLD_2048_LO,
+                                               k_FOLD_2048_HI,
+                                               k_FOLD_2048_LO,
+                                               k_FOLD_2048_HI,
+                                               k_FOLD_2048_LO,
+                                               k_FOLD_2048_HI,
+                                               k_FOLD_2048_LO);
+        while (length >= 256) {
+            z0 = _mm512_xor_si512(fold512(z0, k2048),
+                                  _mm512_loadu_si512(data512));
+            z1 = _mm512_xor_si512(fold512(z1, k2048),
+                                  _mm512_loadu_si512(data512 + 1));
+            z2 = _mm512_xor_si512(fold512(z2, k2048),
+                                  _mm512_loadu_si512(data512 + 2));
+            z3 = _mm512_xor_si512(fold512(z3, k2048),
+                                  _mm512_loadu_si512(data512 + 3));
+            data512 += 4;
+            length -= 256;
+        }
+
+        // Fold the four accumulators into the last one, then keep folding
+        // the remaining 64-byte blocks into it.
+        const __m512i k512 = _mm512_set_epi64(k_FOLD_512_HI,
+                                              k_FOLD_512_LO,
+                                              k_FOLD_512_HI,
+                                              k_FOLD_512_LO,
+                                              k_FOLD_512_HI,
+                                              k_FOLD_512_LO,
+                                              k_FOLD_512_HI,
+                                              k_FOLD_512_LO);
+        z1 = _mm512_xor_si512(fold512(z0, k512), z1);
+        z2 = _mm512_xor_si512(fold512(z1, k512), z2);
+        z3 = _mm512_xor_si512(fold512(z2, k512), z3);
+        while (length >= 64) {
+            z3 = _mm512_xor_si512(fold512(z3, k512),
+                                  _mm512_loadu_si512(data512));
+            ++data512;
+            length -= 64;
+        }
+
+        // Fold the first three 128-bit lanes into the last one
+        const __m512i kLanes = _mm512_set_epi64(0,
+                                                0,
+                                                k_FOLD_128_HI,
+                                                k_FOLD_128_LO,
+                                                k_FOLD_256_HI,
+                                                k_FOLD_256_LO,
+                                                k_FOLD_384_HI,
+                                                k_FOLD_384_LO);
+        const __m512i folded = fold512(z3, kLanes);
+
+        // Note that the zero-masking flavor of the extraction is used to
+        // avoid spurious 'maybe-uninitialized' warnings from some compilers.
+        const __mmask8 k_ALL = 0xF;
+
+        __m128i x = _mm_xor_si128(
+            _mm512_maskz_extracti32x4_epi32(k_ALL, folded, 0),
+            _mm512_maskz_extracti32x4_epi32(k_ALL, folded, 1));
+        x = _mm_xor_si128(x,
+                          _mm512_maskz_extracti32x4_epi32(k_ALL, folded, 2));
+        x = _mm_xor_si128(x, _mm512_maskz_extracti32x4_epi32(k_ALL, z3, 3));
+
+        crc  = reduce128(x);
+        data = reinterpret_cast<const unsigned char*>(data512);
+    }
+
+    if (length >= 64) {
+        crc = crc32cFold128(&data, &length, crc);
+    }
+    if (length) {
+        crc = crc32c8s(data, length, crc);
+    }
+
+    return crc ^ ~0U;  // XOROUT = true: Do a final XOR on output
+}
+
+#endif  // BMQP_CRC32C_VPCLMUL
+
+#ifdef BMQP_CRC32C_PCLMUL
+
+/// Set `g_hasPclmul` and `g_hasVpclmul` according to the instruction sets
+/// supported by the running CPU and enabled by the operating system.
+static void detectCarrylessMultiplication()
+{
+    const unsigned int k_CPUID1_ECX_PCLMULQDQ = 1U << 1;
+
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid(1, eax, ebx, ecx, edx);
+
+    g_hasPclmul = 0 != (ecx & k_CPUID1_ECX_PCLMULQDQ);
+
+#ifdef BMQP_CRC32C_VPCLMUL
+    const unsigned int k_CPUID1_ECX_OSXSAVE    = 1U << 27;
+    const unsigned int k_CPUID7_EBX_AVX512F    = 1U << 16;
+    const unsigned int k_CPUID7_EBX_AVX512VL   = 1U << 31;
+    const unsigned int k_CPUID7_ECX_VPCLMULQDQ = 1U << 10;
+    const unsigned int k_XCR0_AVX512_STATE     = 0xE6;
+    // SSE, AVX, opmask and ZMM registers state
+
+    if (!g_hasPclmul || 0 == (ecx & k_CPUID1_ECX_OSXSAVE) ||
+        __get_cpuid_max(0, 0) < 7) {
+        return;  // RETURN
+    }
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if ((xcr0Low & k_XCR0_AVX512_STATE) != k_XCR0_AVX512_STATE) {
+        // ZMM registers state is not saved by the operating system
+        return;  // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    g_hasVpclmul = 0 != (ebx & k_CPUID7_EBX_AVX512F) &&
+                   0 != (ebx & k_CPUID7_EBX_AVX512VL) &&
+                   0 != (ecx & k_CPUID7_ECX_VPCLMULQDQ);
+#endif  // BMQP_CRC32C_VPCLMUL
+}
+
+#endif  // BMQP_CRC32C_PCLMUL
+
 #endif  // BSLS_PLATFORM_CPU_64_BIT
 
 /// Calculate the CRC32-C value (using SSE intrinsic) for the specified
@@ -1152,10 +1524,26 @@ void Crc32c::initialize()
         if (ecx & BMQP_SSE4_2) {  // SSE 4.2 Support for CRC32-C
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
-            BALL_LOG_INFO << "Using hardware version for CRC32-C computation "
-                             "(SSE4.2 instructions available, 64-bit mode)";
-
             g_crc32cCalculator = crc32cSse64bit;
+            const char* instructions = "SSE4.2";
+
+#ifdef BMQP_CRC32C_PCLMUL
+            detectCarrylessMultiplication();
+            if (g_hasPclmul) {
+                g_crc32cCalculator = crc32cPclmul64bit;
+                instructions       = "SSE4.2 and PCLMULQDQ";
+            }
+#endif
+#ifdef BMQP_CRC32C_VPCLMUL
+            if (g_hasVpclmul) {
+                g_crc32cCalculator = crc32cVpclmul64bit;
+                instructions       = "SSE4.2 and AVX-512 VPCLMULQDQ";
+            }
+#endif
+
+            BALL_LOG_INFO << "Using hardware version for CRC32-C computation "
+                          << "(" << instructions << " instructions available, "
+                          << "64-bit mode)";
 
 #else
             BALL_LOG_INFO << "Using hardware version (serial) for CRC32-C "
@@ -1228,6 +1616,17 @@ unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
     return crc;
 }
 
+unsigned int Crc32c::combine(unsigned int        crc1,
+                             unsigned int        crc2,
+                             bsls::Types::Uint64 length2)
+{
+    // Appending 'length2' bytes to the first buffer shifts its contribution
+    // to the CRC32-C by '8 * length2' bits, i.e. multiplies it by
+    // 'x^(8 * length2) mod P'.  Note that the INIT and XOROUT conditioning
+    // of both values cancel out.
+    return multModP(x8nModP(length2), crc1) ^ crc2;
+}
+
 // ------------------
 // struct Crc32c_Impl
 // ------------------
@@ -1294,5 +1693,72 @@ unsigned int Crc32c_Impl::calculateHardwareSerial(const void*  data,
 #endif  // BMQP_CRC32C_LIKE_X86_GCC
 }
 
+unsigned int Crc32c_Impl::calculateHardwareTriplet(const void*  data,
+                                                   unsigned int length,
+                                                   unsigned int crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE((data || !length) &&
+                     "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;  // RETURN
+    }
+
+    const unsigned char* dataUchar = static_cast<const unsigned char*>(data);
+#if defined(BMQP_CRC32C_LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    return crc32cSse64bit(dataUchar, length, crc);
+#else
+    return calculateHardwareSerial(dataUchar, length, crc);
+#endif
+}
+
+unsigned int Crc32c_Impl::calculateHardwarePclmul(const void*  data,
+                                                  unsigned int length,
+                                                  unsigned int crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE((data || !length) &&
+                     "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;  // RETURN
+    }
+
+#ifdef BMQP_CRC32C_PCLMUL
+    if (g_hasPclmul) {
+        return crc32cPclmul64bit(static_cast<const unsigned char*>(data),
+                                 length,
+                                 crc);  // RETURN
+    }
+#endif
+    return calculateHardwareTriplet(data, length, crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareVpclmul(const void*  data,
+                                                   unsigned int length,
+                                                   unsigned int crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE((data || !length) &&
+                     "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;  // RETURN
+    }
+
+#ifdef BMQP_CRC32C_VPCLMUL
+    if (g_hasVpclmul) {
+        return crc32cVpclmul64bit(static_cast<const unsigned char*>(data),
+                                  length,
+                                  crc);  // RETURN
+    }
+#endif
+    return calculateHardwarePclmul(data, length, crc);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -48,10 +48,22 @@
 // on a supported architecture with a compatible compiler.  In addition,
 // runtime checks are performed to detect whether the running platform has the
 // required hardware support:
-//: o x86:   SSE4.2 instructions are required
+//: o x86:   SSE4.2 instructions are required.  On 64-bit builds, buffers of
+//:   at least 64 bytes are additionally folded using carry-less
+//:   multiplication when the running CPU supports it: 512-bit
+//:   'VPCLMULQDQ' (along with AVX-512F and AVX-512VL) is preferred, then
+//:   128-bit 'PCLMULQDQ'.  The kernel is selected once, by 'initialize()'.
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+/// Combining Checksums
+///--------------------
+// 'bmqp::Crc32c::combine' computes the CRC32-C of the concatenation of two
+// buffers from the CRC32-C of each buffer and the length of the second one,
+// in time logarithmic in that length and without accessing the data.  This
+// allows, for instance, to calculate the CRC32-C of the chunks of a large
+// buffer in parallel and to merge the results.
+//
 /// Performance
 ///-----------
 // Below are performance comparisons of the hardware-accelerated and software
@@ -174,6 +186,23 @@
 //  SPARC T7: 10.1007 times faster, at 808,625 iterations per second
 //  SPARC T8: 7.66392 times faster, at 1,013,937 iterations per second
 //
+/// Throughput per Kernel (x86)
+///-----------------------------
+// Below is the throughput (in GB per second) of each x86 kernel exposed by
+// 'bmqp::Crc32c_Impl' for buffers of various sizes, as reported by case -7 of
+// the test driver on a CPU supporting AVX-512 'VPCLMULQDQ':
+//..
+//  ========================================================================
+//  | Size(B) | Software | HW Serial | HW Triplet | HW PCLMUL | HW VPCLMUL
+//  ========================================================================
+//  |       64|      1.6 |       5.0 |        4.7 |       5.1 |        5.1
+//  |      256|      1.5 |       5.2 |        5.2 |      13.0 |       16.3
+//  |     1 Ki|      1.5 |       5.3 |       17.9 |      18.3 |       46.6
+//  |     4 Ki|      1.5 |       5.4 |       18.0 |      20.1 |       78.4
+//  |    64 Ki|      1.5 |       5.4 |       18.9 |      18.8 |       75.9
+//  |     1 Mi|      1.5 |       5.2 |       18.5 |      20.7 |       84.6
+//..
+//
 /// Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -210,11 +239,29 @@
 //                                     checksum);
 //..
 //
+/// Example 2: Combining checksums of chunks
+///  - - - - - - - - - - - - - - - - - - - -
+// The following code illustrates how to calculate the CRC32-C checksum of a
+// buffer from the checksums of its chunks, which may have been calculated
+// independently (e.g., in different threads).
+//..
+//  const char         *data    = "Hello world";
+//  const unsigned int  length  = 11;
+//  const unsigned int  prefix  = 5;
+//
+//  unsigned int crc1 = bmqp::Crc32c::calculate(data, prefix);
+//  unsigned int crc2 = bmqp::Crc32c::calculate(data + prefix,
+//                                              length - prefix);
+//
+//  unsigned int checksum = bmqp::Crc32c::combine(crc1, crc2, length - prefix);
+//  assert(checksum == bmqp::Crc32c::calculate(data, length));
+//..
 
 // BMQ
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -268,6 +315,15 @@ struct Crc32c {
     /// at least once.
     static unsigned int calculate(const bdlbb::Blob& blob,
                                   unsigned int       crc = k_NULL_CRC32C);
+
+    /// Return the CRC32-C value of the concatenation of a first buffer
+    /// having the specified `crc1` CRC32-C value and a second buffer of
+    /// the specified `length2` number of bytes having the specified `crc2`
+    /// CRC32-C value.  Note that `crc2` must have been calculated starting
+    /// from `k_NULL_CRC32C`.  Also note that this method does not require
+    /// `initialize()` to have been called.
+    static unsigned int
+    combine(unsigned int crc1, unsigned int crc2, bsls::Types::Uint64 length2);
 };
 
 // ==================
@@ -313,6 +369,48 @@ struct Crc32c_Impl {
     calculateHardwareSerial(const void*  data,
                             unsigned int length,
                             unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes a hardware-based implementation that interleaves three
+    /// CRC32-C calculations over blocks of 1024 bytes.  Note that this
+    /// function will fall back to the serial hardware version when running
+    /// on unsupported platforms, and to the software version if that one is
+    /// unsupported as well.  Also note that if `data` is 0, then `length`
+    /// must also be 0.
+    static unsigned int
+    calculateHardwareTriplet(const void*  data,
+                             unsigned int length,
+                             unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes a hardware-based implementation that folds 128-bit
+    /// blocks using the `PCLMULQDQ` carry-less multiplication instruction.
+    /// Note that this function will fall back to the triplet hardware
+    /// version when running on unsupported platforms or if
+    /// `Crc32c::initialize()` has not been called.  Also note that if
+    /// `data` is 0, then `length` must also be 0.
+    static unsigned int
+    calculateHardwarePclmul(const void*  data,
+                            unsigned int length,
+                            unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes a hardware-based implementation that folds 512-bit
+    /// blocks using the AVX-512 `VPCLMULQDQ` carry-less multiplication
+    /// instruction.  Note that this function will fall back to the
+    /// `PCLMULQDQ` hardware version when running on unsupported platforms
+    /// or if `Crc32c::initialize()` has not been called.  Also note that if
+    /// `data` is 0, then `length` must also be 0.
+    static unsigned int
+    calculateHardwareVpclmul(const void*  data,
+                             unsigned int length,
+                             unsigned int crc = Crc32c::k_NULL_CRC32C);
 };
 
 }  // close package namespace
@@ -1287,6 +1287,183 @@ static void test8_calculateOnBlobWithPreviousCrc()
         ASSERT_EQ(crc32cSoftware, expectedCrc32c);
     }
 }
+static void test9_calculateHardwareKernels()
+// ------------------------------------------------------------------------
+// CALCULATE CRC32-C USING EACH HARDWARE KERNEL
+//
+// Concerns:
+//   Ensure that the triplet, 'PCLMULQDQ' and 'VPCLMULQDQ' kernels (or the
+//   flavor they fall back to on the running platform) calculate the same
+//   CRC32-C as the software flavor, for lengths around every block size
+//   they process (8, 64, 256 and 1024 bytes), at every alignment offset,
+//   and with a previous CRC.
+//
+// Plan:
+//   - For each length in a range covering several blocks of each kernel,
+//     each alignment offset in [0, 64) and a previous CRC, calculate the
+//     CRC32-C of a random buffer using each kernel and compare it to the
+//     result of the software flavor.
+//
+// Testing:
+//   bmqp::Crc32c_Impl::calculateHardwareTriplet
+//   bmqp::Crc32c_Impl::calculateHardwarePclmul
+//   bmqp::Crc32c_Impl::calculateHardwareVpclmul
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "CALCULATE CRC32-C USING EACH HARDWARE KERNEL");
+
+    const int k_MAX_OFFSET = 64;
+    const int k_MAX_LENGTH = 3 * 1024 + 2 * 256 + 64 + 8 + 7;
+
+    char* buffer = static_cast<char*>(
+        s_allocator_p->allocate(k_MAX_OFFSET + k_MAX_LENGTH));
+    bsl::generate_n(buffer, k_MAX_OFFSET + k_MAX_LENGTH, bsl::rand);
+
+    const unsigned int k_PREVIOUS_CRCS[]    = {0U, 0xA0EA6901U};
+    const int          k_NUM_PREVIOUS_CRCS = sizeof(k_PREVIOUS_CRCS) /
+                                    sizeof(*k_PREVIOUS_CRCS);
+
+    for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            // Only check a subset of the offsets for the larger lengths, to
+            // keep the running time of this test reasonable.
+            if (length > 300 && (offset % 8) != (length % 8)) {
+                continue;  // CONTINUE
+            }
+
+            const char* data = buffer + offset;
+
+            for (int i = 0; i < k_NUM_PREVIOUS_CRCS; ++i) {
+                const unsigned int prevCrc  = k_PREVIOUS_CRCS[i];
+                const unsigned int expected =
+                    bmqp::Crc32c_Impl::calculateSoftware(data,
+                                                         length,
+                                                         prevCrc);
+
+                ASSERT_EQ_D("length " << length << ", offset " << offset
+                                      << " (Triplet)",
+                            bmqp::Crc32c_Impl::calculateHardwareTriplet(
+                                data,
+                                length,
+                                prevCrc),
+                            expected);
+                ASSERT_EQ_D("length " << length << ", offset " << offset
+                                      << " (PCLMUL)",
+                            bmqp::Crc32c_Impl::calculateHardwarePclmul(
+                                data,
+                                length,
+                                prevCrc),
+                            expected);
+                ASSERT_EQ_D("length " << length << ", offset " << offset
+                                      << " (VPCLMUL)",
+                            bmqp::Crc32c_Impl::calculateHardwareVpclmul(
+                                data,
+                                length,
+                                prevCrc),
+                            expected);
+                ASSERT_EQ_D("length " << length << ", offset " << offset
+                                      << " (Default)",
+                            bmqp::Crc32c::calculate(data, length, prevCrc),
+                            expected);
+            }
+        }
+    }
+
+    s_allocator_p->deallocate(buffer);
+}
+
+static void test10_combine()
+// ------------------------------------------------------------------------
+// COMBINE
+//
+// Concerns:
+//   1. Combining the CRC32-C of two buffers yields the CRC32-C of their
+//      concatenation, whatever the split point.
+//   2. Combining with an empty second buffer yields the first CRC32-C.
+//   3. Combining is associative, including for lengths exceeding 32 bits.
+//
+// Plan:
+//   1. For each split point of a random buffer, combine the CRC32-C of both
+//      parts and compare with the CRC32-C of the whole buffer.
+//   2. Combine random CRC32-C values with a 0 length.
+//   3. Compare '(a + b) + c' with 'a + (b + c)' for random CRC32-C values
+//      and lengths of up to 2^40 bytes.
+//
+// Testing:
+//   bmqp::Crc32c::combine
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMBINE");
+
+    {
+        PV("Split points");
+
+        const int k_LENGTH = 1500;
+
+        char* buffer = static_cast<char*>(s_allocator_p->allocate(k_LENGTH));
+        bsl::generate_n(buffer, k_LENGTH, bsl::rand);
+
+        const unsigned int expected = bmqp::Crc32c::calculate(buffer,
+                                                              k_LENGTH);
+
+        for (int split = 0; split <= k_LENGTH; ++split) {
+            const unsigned int crc1 = bmqp::Crc32c::calculate(buffer, split);
+            const unsigned int crc2 = bmqp::Crc32c::calculate(buffer + split,
+                                                              k_LENGTH -
+                                                                  split);
+
+            ASSERT_EQ_D("split " << split,
+                        bmqp::Crc32c::combine(crc1, crc2, k_LENGTH - split),
+                        expected);
+        }
+
+        s_allocator_p->deallocate(buffer);
+    }
+
+    {
+        PV("Empty second buffer");
+
+        for (int i = 0; i < 100; ++i) {
+            const unsigned int crc = static_cast<unsigned int>(bsl::rand());
+
+            ASSERT_EQ(
+                bmqp::Crc32c::combine(crc, bmqp::Crc32c::k_NULL_CRC32C, 0),
+                crc);
+        }
+    }
+
+    {
+        PV("Associativity");
+
+        for (int i = 0; i < 1000; ++i) {
+            const unsigned int a = static_cast<unsigned int>(bsl::rand());
+            const unsigned int b = static_cast<unsigned int>(bsl::rand());
+            const unsigned int c = static_cast<unsigned int>(bsl::rand());
+
+            const bsls::Types::Uint64 lengthB =
+                static_cast<bsls::Types::Uint64>(bsl::rand())
+                << (bsl::rand() % 10);
+            const bsls::Types::Uint64 lengthC =
+                static_cast<bsls::Types::Uint64>(bsl::rand())
+                << (bsl::rand() % 10);
+
+            const unsigned int left = bmqp::Crc32c::combine(
+                bmqp::Crc32c::combine(a, b, lengthB),
+                c,
+                lengthC);
+            const unsigned int right = bmqp::Crc32c::combine(
+                a,
+                bmqp::Crc32c::combine(b, c, lengthC),
+                lengthB + lengthC);
+
+            ASSERT_EQ_D("lengthB " << lengthB << ", lengthC " << lengthC,
+                        left,
+                        right);
+        }
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -2174,6 +2351,91 @@ static void testN6_bdldPerformanceDefault()
     s_allocator_p->deallocate(buffer);
 }
 
+static void testN7_kernelsThroughput()
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C THROUGHPUT PER KERNEL
+//
+// Concerns:
+//   Compare the throughput (GB/s) of each CRC32-C kernel for buffers of
+//   various sizes.  Note that a hardware kernel which is not supported by
+//   the running platform falls back to the next best one, and hence reports
+//   the throughput of that one.
+//
+// Plan:
+//   - For each buffer size, time the CRC32-C calculation of 1 GiB of data
+//     using each kernel, and report the throughput in a table.
+//
+// Testing:
+//   Throughput (GB/s) of each CRC32-C kernel.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "BENCHMARK: CALCULATE CRC32-C THROUGHPUT PER KERNEL");
+
+    typedef unsigned int (*KernelFn)(const void*  data,
+                                     unsigned int length,
+                                     unsigned int crc);
+
+    struct Kernel {
+        const char* d_name;
+        KernelFn    d_function;
+    };
+
+    const Kernel k_KERNELS[] = {
+        {"Software", &bmqp::Crc32c_Impl::calculateSoftware},
+        {"HW Serial", &bmqp::Crc32c_Impl::calculateHardwareSerial},
+        {"HW Triplet", &bmqp::Crc32c_Impl::calculateHardwareTriplet},
+        {"HW PCLMUL", &bmqp::Crc32c_Impl::calculateHardwarePclmul},
+        {"HW VPCLMUL", &bmqp::Crc32c_Impl::calculateHardwareVpclmul}};
+    const int k_NUM_KERNELS = sizeof(k_KERNELS) / sizeof(*k_KERNELS);
+
+    const int k_SIZES[]   = {64, 256, 1024, 4096, 65536, 1048576};
+    const int k_NUM_SIZES = sizeof(k_SIZES) / sizeof(*k_SIZES);
+
+    const bsls::Types::Uint64 k_TOTAL_BYTES = 1024 * 1024 * 1024;  // 1 GiB
+
+    char* buffer = static_cast<char*>(
+        s_allocator_p->allocate(k_SIZES[k_NUM_SIZES - 1]));
+    bsl::generate_n(buffer, k_SIZES[k_NUM_SIZES - 1], bsl::rand);
+
+    bsl::cout << "\n| Size(B) ";
+    for (int k = 0; k < k_NUM_KERNELS; ++k) {
+        bsl::cout << "| " << bsl::setw(10) << k_KERNELS[k].d_name << ' ';
+    }
+    bsl::cout << "|\n";
+
+    unsigned int crc32c = 0;
+    for (int s = 0; s < k_NUM_SIZES; ++s) {
+        const int                 length  = k_SIZES[s];
+        const bsls::Types::Uint64 numIter = k_TOTAL_BYTES / length;
+
+        bsl::cout << "| " << bsl::setw(7) << length << ' ';
+        for (int k = 0; k < k_NUM_KERNELS; ++k) {
+            // <time>
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Uint64 i = 0; i < numIter; ++i) {
+                crc32c = k_KERNELS[k].d_function(buffer, length, crc32c);
+            }
+            const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() -
+                                               start;
+            // </time>
+
+            // Bytes per nanosecond is GB per second
+            const double throughput = static_cast<double>(numIter * length) /
+                                      static_cast<double>(elapsed);
+
+            mwcu::OutStreamFormatSaver fmtSaver(bsl::cout);
+            bsl::cout << "| " << bsl::setw(10) << bsl::fixed
+                      << bsl::setprecision(1) << throughput << ' ';
+        }
+        bsl::cout << "|\n";
+    }
+    bsl::cout << bsl::endl;
+
+    s_allocator_p->deallocate(buffer);
+    static_cast<void>(crc32c);
+}
+
 #ifdef BSLS_PLATFORM_OS_LINUX
 
 static void
@@ -2554,6 +2816,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 10: test10_combine(); break;
+    case 9: test9_calculateHardwareKernels(); break;
     case 8: test8_calculateOnBlobWithPreviousCrc(); break;
     case 7: test7_calculateOnBlob(); break;
     case 6: test6_multithreadedCrc32cSoftware(); break;
@@ -2602,6 +2866,7 @@ int main(int argc, char* argv[])
             testN6_bdldPerformanceDefault,
             Apply(populateBufferLengthsSorted_GoogleBenchmark_Large));
         break;
+    case -7: testN7_kernelsThroughput(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
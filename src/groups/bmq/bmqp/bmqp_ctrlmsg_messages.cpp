@@ -12695,14 +12695,19 @@ const bdlat_AttributeInfo OpenQueueResponse::ATTRIBUTE_INFO_ARRAY[] = {
      "deduplicationTimeMs",
      sizeof("deduplicationTimeMs") - 1,
      "",
-     bdlat_FormattingMode::e_DEC}};
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_COMPRESSION_DICTIONARIES,
+     "compressionDictionaries",
+     sizeof("compressionDictionaries") - 1,
+     "",
+     bdlat_FormattingMode::e_HEX}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 OpenQueueResponse::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             OpenQueueResponse::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -12724,6 +12729,8 @@ const bdlat_AttributeInfo* OpenQueueResponse::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROUTING_CONFIGURATION];
     case ATTRIBUTE_ID_DEDUPLICATION_TIME_MS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS];
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES];
     default: return 0;
     }
 }
@@ -12731,7 +12738,8 @@ const bdlat_AttributeInfo* OpenQueueResponse::lookupAttributeInfo(int id)
 // CREATORS
 
 OpenQueueResponse::OpenQueueResponse(bslma::Allocator* basicAllocator)
-: d_routingConfiguration()
+: d_compressionDictionaries(basicAllocator)
+, d_routingConfiguration()
 , d_originalRequest(basicAllocator)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
 {
@@ -12739,7 +12747,9 @@ OpenQueueResponse::OpenQueueResponse(bslma::Allocator* basicAllocator)
 
 OpenQueueResponse::OpenQueueResponse(const OpenQueueResponse& original,
                                      bslma::Allocator*        basicAllocator)
-: d_routingConfiguration(original.d_routingConfiguration)
+: d_compressionDictionaries(original.d_compressionDictionaries,
+                            basicAllocator)
+, d_routingConfiguration(original.d_routingConfiguration)
 , d_originalRequest(original.d_originalRequest, basicAllocator)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
 {
@@ -12748,7 +12758,8 @@ OpenQueueResponse::OpenQueueResponse(const OpenQueueResponse& original,
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original) noexcept
-: d_routingConfiguration(bsl::move(original.d_routingConfiguration)),
+: d_compressionDictionaries(bsl::move(original.d_compressionDictionaries)),
+  d_routingConfiguration(bsl::move(original.d_routingConfiguration)),
   d_originalRequest(bsl::move(original.d_originalRequest)),
   d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
 {
@@ -12756,7 +12767,9 @@ OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original) noexcept
 
 OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original,
                                      bslma::Allocator*   basicAllocator)
-: d_routingConfiguration(bsl::move(original.d_routingConfiguration))
+: d_compressionDictionaries(bsl::move(original.d_compressionDictionaries),
+                            basicAllocator)
+, d_routingConfiguration(bsl::move(original.d_routingConfiguration))
 , d_originalRequest(bsl::move(original.d_originalRequest), basicAllocator)
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
 {
@@ -12773,8 +12786,9 @@ OpenQueueResponse& OpenQueueResponse::operator=(const OpenQueueResponse& rhs)
 {
     if (this != &rhs) {
         d_originalRequest      = rhs.d_originalRequest;
-        d_routingConfiguration = rhs.d_routingConfiguration;
-        d_deduplicationTimeMs  = rhs.d_deduplicationTimeMs;
+        d_routingConfiguration    = rhs.d_routingConfiguration;
+        d_deduplicationTimeMs     = rhs.d_deduplicationTimeMs;
+        d_compressionDictionaries = rhs.d_compressionDictionaries;
     }
 
     return *this;
@@ -12786,8 +12800,9 @@ OpenQueueResponse& OpenQueueResponse::operator=(OpenQueueResponse&& rhs)
 {
     if (this != &rhs) {
         d_originalRequest      = bsl::move(rhs.d_originalRequest);
-        d_routingConfiguration = bsl::move(rhs.d_routingConfiguration);
-        d_deduplicationTimeMs  = bsl::move(rhs.d_deduplicationTimeMs);
+        d_routingConfiguration    = bsl::move(rhs.d_routingConfiguration);
+        d_deduplicationTimeMs     = bsl::move(rhs.d_deduplicationTimeMs);
+        d_compressionDictionaries = bsl::move(rhs.d_compressionDictionaries);
     }
 
     return *this;
@@ -12799,6 +12814,7 @@ void OpenQueueResponse::reset()
     bdlat_ValueTypeFunctions::reset(&d_originalRequest);
     bdlat_ValueTypeFunctions::reset(&d_routingConfiguration);
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
+    bdlat_ValueTypeFunctions::reset(&d_compressionDictionaries);
 }
 
 // ACCESSORS
@@ -12813,6 +12829,8 @@ bsl::ostream& OpenQueueResponse::print(bsl::ostream& stream,
     printer.printAttribute("routingConfiguration",
                            this->routingConfiguration());
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
+    printer.printAttribute("compressionDictionaries",
+                           this->compressionDictionaries());
     printer.end();
     return stream;
 }
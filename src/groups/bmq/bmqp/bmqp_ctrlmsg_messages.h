@@ -19289,26 +19289,33 @@ namespace bmqp_ctrlmsg {
 /// downstream node to distribute messages to consumers attached to it
 /// deduplicationTimeMs........: timeout, in milliseconds, to keep GUID of
 /// PUT message for the purpose of detecting duplicate PUTs.
+/// compressionDictionaries....: compression dictionaries of the queue, in
+/// the Zstandard dictionary format; the first one, if any, is the one to
+/// use to compress messages, and the following ones are older versions
+/// still needed to decompress messages compressed with them.
 class OpenQueueResponse {
     // INSTANCE DATA
-    RoutingConfiguration d_routingConfiguration;
-    OpenQueue            d_originalRequest;
-    int                  d_deduplicationTimeMs;
+    bsl::vector<bsl::vector<char> > d_compressionDictionaries;
+    RoutingConfiguration            d_routingConfiguration;
+    OpenQueue                       d_originalRequest;
+    int                             d_deduplicationTimeMs;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_ORIGINAL_REQUEST      = 0,
-        ATTRIBUTE_ID_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_ID_ORIGINAL_REQUEST         = 0,
+        ATTRIBUTE_ID_ROUTING_CONFIGURATION    = 1,
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS    = 2,
+        ATTRIBUTE_ID_COMPRESSION_DICTIONARIES = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
-        ATTRIBUTE_INDEX_ORIGINAL_REQUEST      = 0,
-        ATTRIBUTE_INDEX_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_INDEX_ORIGINAL_REQUEST         = 0,
+        ATTRIBUTE_INDEX_ROUTING_CONFIGURATION    = 1,
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS    = 2,
+        ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES = 3
     };
 
     // CONSTANTS
@@ -19424,6 +19431,10 @@ class OpenQueueResponse {
     /// of this object.
     int& deduplicationTimeMs();
 
+    /// Return a reference to the modifiable "CompressionDictionaries"
+    /// attribute of this object.
+    bsl::vector<bsl::vector<char> >& compressionDictionaries();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -19479,6 +19490,10 @@ class OpenQueueResponse {
     /// Return a reference to the non-modifiable "DeduplicationTimeMs"
     /// attribute of this object.
     int deduplicationTimeMs() const;
+
+    /// Return a reference to the non-modifiable "CompressionDictionaries"
+    /// attribute of this object.
+    const bsl::vector<bsl::vector<char> >& compressionDictionaries() const;
 };
 
 // FREE OPERATORS
@@ -36153,6 +36168,13 @@ int OpenQueueResponse::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_compressionDictionaries,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -36177,6 +36199,11 @@ int OpenQueueResponse::manipulateAttribute(MANIPULATOR& manipulator, int id)
             &d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES: {
+        return manipulator(
+            &d_compressionDictionaries,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36212,6 +36239,12 @@ inline int& OpenQueueResponse::deduplicationTimeMs()
     return d_deduplicationTimeMs;
 }
 
+inline bsl::vector<bsl::vector<char> >&
+OpenQueueResponse::compressionDictionaries()
+{
+    return d_compressionDictionaries;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int OpenQueueResponse::accessAttributes(ACCESSOR& accessor) const
@@ -36238,6 +36271,13 @@ int OpenQueueResponse::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_compressionDictionaries,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -36262,6 +36302,11 @@ int OpenQueueResponse::accessAttribute(ACCESSOR& accessor, int id) const
             d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES: {
+        return accessor(
+            d_compressionDictionaries,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36298,6 +36343,12 @@ inline int OpenQueueResponse::deduplicationTimeMs() const
     return d_deduplicationTimeMs;
 }
 
+inline const bsl::vector<bsl::vector<char> >&
+OpenQueueResponse::compressionDictionaries() const
+{
+    return d_compressionDictionaries;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                        hashAlg,
                 const bmqp_ctrlmsg::OpenQueueResponse& object)
@@ -36308,6 +36359,7 @@ void hashAppend(HASH_ALGORITHM&                        hashAlg,
     hashAppend(hashAlg, object.originalRequest());
     hashAppend(hashAlg, object.routingConfiguration());
     hashAppend(hashAlg, object.deduplicationTimeMs());
+    hashAppend(hashAlg, object.compressionDictionaries());
 }
 
 // ----------------------
@@ -40786,7 +40838,8 @@ bmqp_ctrlmsg::operator==(const bmqp_ctrlmsg::OpenQueueResponse& lhs,
 {
     return lhs.originalRequest() == rhs.originalRequest() &&
            lhs.routingConfiguration() == rhs.routingConfiguration() &&
-           lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs();
+           lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
+           lhs.compressionDictionaries() == rhs.compressionDictionaries();
 }
 
 inline bool
@@ -39,6 +39,7 @@
 #include <bmqp_recoverymessageiterator.h>
 #include <bmqp_rejectmessageiterator.h>
 #include <bmqp_storagemessageiterator.h>
+#include <bmqt_compressionalgorithmtype.h>
 
 // MWC
 #include <mwcu_blob.h>
@@ -184,6 +185,14 @@ class Event {
     /// behavior is undefined unless `isValid()` returns true.
     bool isReceiptEvent() const;
 
+    /// Return the compression algorithm applied to the whole body of this
+    /// event (see `bmqp::EventUtil::compressPutEvent`), or `e_NONE` if it
+    /// is not compressed.  The behavior is undefined unless `isPutEvent()`
+    /// returns true.  Note that the messages of a compressed event can only
+    /// be iterated over once it has been decompressed.
+    bmqt::CompressionAlgorithmType::Enum
+    putEventCompressionAlgorithmType() const;
+
     /// Load into the specified `message`, the decoded message contained in
     /// this event.  The behavior is undefined unless `isControlEvent()`
     /// returns true.  Return 0 on success, and a non-zero return code on
@@ -445,6 +454,15 @@ inline bool Event::isPutEvent() const
     return d_header->type() == EventType::e_PUT;
 }
 
+inline bmqt::CompressionAlgorithmType::Enum
+Event::putEventCompressionAlgorithmType() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPutEvent());
+
+    return EventHeaderUtil::putEventCompressionAlgorithmType(*d_header);
+}
+
 inline bool Event::isConfirmEvent() const
 {
     // PRECONDITIONS
@@ -18,6 +18,7 @@
 
 #include <bmqscm_version.h>
 // BMQ
+#include <bmqp_compression.h>
 #include <bmqp_event.h>
 #include <bmqp_optionsview.h>
 #include <bmqp_protocol.h>
@@ -27,8 +28,11 @@
 
 // MWC
 #include <mwcc_array.h>
+#include <mwcu_blob.h>
+#include <mwcu_blobobjectproxy.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
@@ -479,6 +483,108 @@ int Flattener::flattenPushEvent()
     return rc_SUCCESS;
 }
 
+/// Load into the specified `headerSize` the size of the header of the put
+/// event in the specified `event`, and into the specified `algorithm` the
+/// compression algorithm applied to its body.  Return 0 on success, or
+/// non-zero if `event` does not start with a valid put event header.
+int loadPutEventHeaderInfo(int*                                  headerSize,
+                           bmqt::CompressionAlgorithmType::Enum* algorithm,
+                           const bdlbb::Blob&                    event)
+{
+    mwcu::BlobObjectProxy<EventHeader> header(&event);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    *headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            header->type() != EventType::e_PUT ||
+            header->length() != event.length() ||
+            *headerSize < static_cast<int>(sizeof(EventHeader)) ||
+            *headerSize > event.length())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -2;  // RETURN
+    }
+
+    *algorithm = EventHeaderUtil::putEventCompressionAlgorithmType(*header);
+    return 0;
+}
+
+/// Append to the specified `output` a copy of the header of the specified
+/// `headerSize` of the specified `event`, followed by the result of the
+/// specified `transform` (compression or decompression) applied with the
+/// specified `algorithm` to the body of `event`, and update the length and
+/// compression algorithm of the header appended to `output` accordingly,
+/// setting the latter to the specified `outputAlgorithm`.  Use the
+/// specified `bufferFactory` and `allocator`.  Return 0 on success, or the
+/// non-zero return code of `transform` on failure.
+template <class TRANSFORM>
+int transformPutEventBody(
+    bdlbb::Blob*                         output,
+    const bdlbb::Blob&                   event,
+    int                                  headerSize,
+    bmqt::CompressionAlgorithmType::Enum algorithm,
+    bmqt::CompressionAlgorithmType::Enum outputAlgorithm,
+    TRANSFORM                            transform,
+    bdlbb::BlobBufferFactory*            bufferFactory,
+    bslma::Allocator*                    allocator)
+{
+    // Deep copy the header, since it is modified below
+    mwcu::BlobUtil::appendBlobFromIndex(output, event, 0, 0, headerSize);
+
+    bdlbb::Blob body(bufferFactory, allocator);
+    bdlbb::BlobUtil::append(&body,
+                            event,
+                            headerSize,
+                            event.length() - headerSize);
+
+    const int rc = transform(output,
+                             bufferFactory,
+                             algorithm,
+                             body,
+                             static_cast<bsl::ostream*>(0),
+                             allocator);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    mwcu::BlobObjectProxy<EventHeader> header(output,
+                                              true,   // read
+                                              true);  // write
+    BSLS_ASSERT_SAFE(header.isSet());
+    header->setLength(output->length());
+    EventHeaderUtil::setPutEventCompressionAlgorithmType(header.object(),
+                                                         outputAlgorithm);
+
+    return 0;
+}
+
+/// Append to the specified `output`, holding the header of a put event,
+/// the decompression of the specified `body` of that event, compressed with
+/// the specified `algorithm`, using the specified `bufferFactory` and
+/// `allocator`, and writing details of any error to the specified
+/// `errorStream`.  Return 0 on success, or non-zero error code in case of
+/// failure, including as soon as `output` would exceed
+/// `EventHeader::k_MAX_SIZE_SOFT`.
+int decompressPutEventBody(bdlbb::Blob*                         output,
+                           bdlbb::BlobBufferFactory*            bufferFactory,
+                           bmqt::CompressionAlgorithmType::Enum algorithm,
+                           const bdlbb::Blob&                   body,
+                           bsl::ostream*                        errorStream,
+                           bslma::Allocator*                    allocator)
+{
+    return Compression::decompress(output,
+                                   bufferFactory,
+                                   algorithm,
+                                   body,
+                                   errorStream,
+                                   allocator,
+                                   EventHeader::k_MAX_SIZE_SOFT -
+                                       output->length());
+}
+
 }  // close unnamed namespace
 
 // ----------------
@@ -500,5 +606,162 @@ int EventUtil::flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
     return flattener.flattenPushEvent();
 }
 
+int EventUtil::compressPutEvent(
+    bdlbb::Blob*                         output,
+    const bdlbb::Blob&                   event,
+    bmqt::CompressionAlgorithmType::Enum algorithm,
+    bdlbb::BlobBufferFactory*            bufferFactory,
+    bslma::Allocator*                    allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(output->length() == 0);
+    BSLS_ASSERT_SAFE(algorithm != bmqt::CompressionAlgorithmType::e_NONE &&
+                     algorithm != bmqt::CompressionAlgorithmType::e_UNKNOWN);
+    BSLS_ASSERT_SAFE(bufferFactory);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS             = 0,
+        rc_INVALID_EVENT       = -1,
+        rc_ALREADY_COMPRESSED  = -2,
+        rc_COMPRESSION_FAILURE = -3
+    };
+
+    int                                  headerSize = 0;
+    bmqt::CompressionAlgorithmType::Enum currentAlgorithm =
+        bmqt::CompressionAlgorithmType::e_UNKNOWN;
+    if (loadPutEventHeaderInfo(&headerSize, &currentAlgorithm, event) != 0) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    if (currentAlgorithm != bmqt::CompressionAlgorithmType::e_NONE) {
+        return rc_ALREADY_COMPRESSED;  // RETURN
+    }
+
+    typedef int (*CompressFn)(bdlbb::Blob*,
+                              bdlbb::BlobBufferFactory*,
+                              bmqt::CompressionAlgorithmType::Enum,
+                              const bdlbb::Blob&,
+                              bsl::ostream*,
+                              bslma::Allocator*);
+
+    const int rc = transformPutEventBody(
+        output,
+        event,
+        headerSize,
+        algorithm,
+        algorithm,
+        static_cast<CompressFn>(&Compression::compress),
+        bufferFactory,
+        allocator);
+    if (rc != 0) {
+        output->removeAll();
+        return rc * 10 + rc_COMPRESSION_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int EventUtil::decompressPutEvent(bdlbb::Blob*              output,
+                                  const bdlbb::Blob&        event,
+                                  bdlbb::BlobBufferFactory* bufferFactory,
+                                  bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(output->length() == 0);
+    BSLS_ASSERT_SAFE(bufferFactory);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS               = 0,
+        rc_INVALID_EVENT         = -1,
+        rc_INVALID_ALGORITHM     = -2,
+        rc_DECOMPRESSION_FAILURE = -3
+    };
+
+    int                                  headerSize = 0;
+    bmqt::CompressionAlgorithmType::Enum algorithm =
+        bmqt::CompressionAlgorithmType::e_UNKNOWN;
+    if (loadPutEventHeaderInfo(&headerSize, &algorithm, event) != 0) {
+        return rc_INVALID_EVENT;  // RETURN
+    }
+
+    if (algorithm == bmqt::CompressionAlgorithmType::e_NONE ||
+        algorithm > bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE) {
+        return rc_INVALID_ALGORITHM;  // RETURN
+    }
+
+    // Bound the size of the output while decompressing, rather than once
+    // done: a small event could otherwise decompress to an arbitrarily large
+    // one.
+    const int rc = transformPutEventBody(
+        output,
+        event,
+        headerSize,
+        algorithm,
+        bmqt::CompressionAlgorithmType::e_NONE,
+        &decompressPutEventBody,
+        bufferFactory,
+        allocator);
+    if (rc != 0) {
+        // Leave what was decompressed, so that the messages it holds can be
+        // identified by the caller (see 'loadPutHeaders').
+        return rc * 10 + rc_DECOMPRESSION_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int EventUtil::loadPutHeaders(bsl::vector<PutHeader>* headers,
+                              const bdlbb::Blob&      event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(headers);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_INVALID_EVENT = -1
+    };
+
+    int headerSize = 0;
+    {
+        mwcu::BlobObjectProxy<EventHeader> header(&event);
+        if (!header.isSet() || header->type() != EventType::e_PUT) {
+            return rc_INVALID_EVENT;  // RETURN
+        }
+
+        headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
+        if (headerSize < static_cast<int>(sizeof(EventHeader)) ||
+            headerSize > event.length()) {
+            return rc_INVALID_EVENT;  // RETURN
+        }
+    }
+
+    int offset = headerSize;
+    while (event.length() - offset >= static_cast<int>(sizeof(PutHeader))) {
+        PutHeader header;
+        bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&header),
+                              event,
+                              offset,
+                              sizeof(PutHeader));
+
+        const int putHeaderSize = header.headerWords() *
+                                  Protocol::k_WORD_SIZE;
+        const int messageSize = header.messageWords() * Protocol::k_WORD_SIZE;
+        if (putHeaderSize < static_cast<int>(sizeof(PutHeader)) ||
+            messageSize < putHeaderSize) {
+            // The next message cannot be located
+            break;  // BREAK
+        }
+
+        headers->push_back(header);
+        offset += messageSize;
+    }
+
+    return offset < event.length() ? event.length() - offset : 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
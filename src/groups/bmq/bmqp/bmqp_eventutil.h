@@ -33,6 +33,7 @@
 
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
+#include <bmqt_compressionalgorithmtype.h>
 
 // BDE
 #include <bdlbb_blob.h>
@@ -130,6 +131,54 @@ struct EventUtil {
                                 const Event&                     event,
                                 bdlbb::BlobBufferFactory*        bufferFactory,
                                 bslma::Allocator*                allocator);
+
+    /// PutEvent Utilities
+    ///------------------
+
+    /// Load into the specified `output` the put event in the specified
+    /// `event` having its whole body (i.e., all its messages, including
+    /// their headers) compressed with the specified `algorithm`, and the
+    /// algorithm recorded in its `EventHeader`, using the specified
+    /// `bufferFactory` and `allocator`.  Return 0 on success, or non-zero
+    /// error code in case of failure.  The behavior is undefined unless
+    /// `output` is empty and `algorithm` is not `e_NONE` or `e_UNKNOWN`.
+    /// Note that the resulting event is only understood by peers having
+    /// advertised support for `CompressionFeatures::k_EVENT`, and that it
+    /// may be larger than `event` if its body does not compress well.
+    static int
+    compressPutEvent(bdlbb::Blob*                         output,
+                     const bdlbb::Blob&                   event,
+                     bmqt::CompressionAlgorithmType::Enum algorithm,
+                     bdlbb::BlobBufferFactory*            bufferFactory,
+                     bslma::Allocator*                    allocator);
+
+    /// Load into the specified `output` the put event in the specified
+    /// `event`, whose body was compressed by `compressPutEvent`, after
+    /// decompressing its body and resetting the compression algorithm
+    /// recorded in its `EventHeader`, using the specified `bufferFactory`
+    /// and `allocator`.  Return 0 on success, or non-zero error code in
+    /// case of failure, including as soon as the decompressed event would
+    /// exceed `EventHeader::k_MAX_SIZE_SOFT`, in which case `output` is
+    /// loaded with the header of `event` followed by the part of its body
+    /// decompressed before the failure, which may end with an incomplete
+    /// message (see `loadPutHeaders`).  The behavior is undefined unless
+    /// `output` is empty.
+    static int decompressPutEvent(bdlbb::Blob*              output,
+                                  const bdlbb::Blob&        event,
+                                  bdlbb::BlobBufferFactory* bufferFactory,
+                                  bslma::Allocator*         allocator);
+
+    /// Append to the specified `headers` the header of each message of the
+    /// put event in the specified `event`, in order, stopping at the first
+    /// message whose header is incomplete or invalid.  Only the headers of
+    /// the messages are read, so that `event` may be truncated at any
+    /// point, e.g. by a failed `decompressPutEvent`, the length recorded in
+    /// its `EventHeader` is ignored, and a message is loaded as soon as its
+    /// header is complete.  Return the number of bytes at the end of
+    /// `event` which are not part of a message whose header was loaded, or
+    /// a negative value if `event` does not start with a put event header.
+    static int loadPutHeaders(bsl::vector<PutHeader>* headers,
+                              const bdlbb::Blob&      event);
 };
 
 // ============================================================================
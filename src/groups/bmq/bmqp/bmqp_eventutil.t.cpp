@@ -23,15 +23,25 @@
 #include <bmqp_protocolutil.h>
 #include <bmqp_pusheventbuilder.h>
 #include <bmqp_pushmessageiterator.h>
+#include <bmqp_puteventbuilder.h>
+#include <bmqp_putmessageiterator.h>
 #include <bmqp_queueid.h>
 #include <bmqt_messageguid.h>
 
+// MWC
+#include <mwcu_blob.h>
+#include <mwcu_blobobjectproxy.h>
+
 // BDE
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_ctime.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -807,6 +817,392 @@ static void test3_flattenWithMessageProperties()
     }
 }
 
+static void test4_compressPutEvent()
+// ------------------------------------------------------------------------
+// COMPRESS PUT EVENT
+//
+// Concerns:
+//   1. A put event whose body is compressed with any algorithm can be
+//      decompressed back into the original event.
+//   2. The compression algorithm is recorded in the 'EventHeader' of the
+//      compressed event, and reset in the decompressed one.
+//   3. The body of an event made of many similar small messages is
+//      significantly smaller once compressed.
+//   4. Invalid or uncompressed events are rejected.
+//
+// Plan:
+//   1. Build a put event made of many small similar messages.
+//   2. For each compression algorithm, compress and decompress it, and
+//      verify the headers, sizes and that the decompressed event is
+//      identical to the original one and can be iterated.
+//
+// Testing:
+//   compressPutEvent
+//   decompressPutEvent
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPRESS PUT EVENT");
+
+    const int k_NUM_MSGS = 1000;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        char payload[64];
+        bsl::snprintf(payload, sizeof(payload), "{\"price\":%d}", i);
+
+        bmqt::MessageGUID guid;
+        guid.fromHex("40000000000000000000000000000001");
+
+        builder.startMessage();
+        builder.setMessagePayload(payload, bsl::strlen(payload));
+        builder.setMessageGUID(guid);
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  builder.packMessage(i % 4));
+    }
+
+    const bdlbb::Blob& event = builder.blob();
+
+    struct Test {
+        int                                  d_line;
+        bmqt::CompressionAlgorithmType::Enum d_algorithm;
+    } k_DATA[] = {
+        {L_, bmqt::CompressionAlgorithmType::e_ZLIB},
+        {L_, bmqt::CompressionAlgorithmType::e_ZSTD},
+        {L_, bmqt::CompressionAlgorithmType::e_LZ4},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx != k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": " << test.d_algorithm);
+
+        bdlbb::Blob compressed(&bufferFactory, s_allocator_p);
+        int         rc = bmqp::EventUtil::compressPutEvent(&compressed,
+                                                           event,
+                                                           test.d_algorithm,
+                                                           &bufferFactory,
+                                                           s_allocator_p);
+        ASSERT_EQ_D(test.d_line, rc, 0);
+        ASSERT_LT_D(test.d_line, compressed.length() * 4, event.length());
+
+        bmqp::Event compressedEvent(&compressed, s_allocator_p);
+        ASSERT_EQ_D(test.d_line, compressedEvent.isValid(), true);
+        ASSERT_EQ_D(test.d_line, compressedEvent.isPutEvent(), true);
+        ASSERT_EQ_D(test.d_line,
+                    compressedEvent.putEventCompressionAlgorithmType(),
+                    test.d_algorithm);
+
+        // Compressing twice is rejected
+        bdlbb::Blob twice(&bufferFactory, s_allocator_p);
+        rc = bmqp::EventUtil::compressPutEvent(&twice,
+                                               compressed,
+                                               test.d_algorithm,
+                                               &bufferFactory,
+                                               s_allocator_p);
+        ASSERT_NE_D(test.d_line, rc, 0);
+        ASSERT_EQ_D(test.d_line, twice.length(), 0);
+
+        bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+        rc = bmqp::EventUtil::decompressPutEvent(&decompressed,
+                                                 compressed,
+                                                 &bufferFactory,
+                                                 s_allocator_p);
+        ASSERT_EQ_D(test.d_line, rc, 0);
+        ASSERT_EQ_D(test.d_line,
+                    bdlbb::BlobUtil::compare(decompressed, event),
+                    0);
+
+        // The decompressed event can be iterated
+        bmqp::Event rawEvent(&decompressed, s_allocator_p);
+        ASSERT_EQ_D(test.d_line,
+                    rawEvent.putEventCompressionAlgorithmType(),
+                    bmqt::CompressionAlgorithmType::e_NONE);
+
+        bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPutMessageIterator(&putIter, true);
+
+        int numMsgs = 0;
+        while (putIter.next() == 1) {
+            ASSERT_EQ_D(numMsgs, putIter.header().queueId(), numMsgs % 4);
+            ++numMsgs;
+        }
+        ASSERT_EQ_D(test.d_line, numMsgs, k_NUM_MSGS);
+    }
+
+    PV("Decompressing an uncompressed event fails");
+    {
+        bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+        ASSERT_NE(bmqp::EventUtil::decompressPutEvent(&decompressed,
+                                                      event,
+                                                      &bufferFactory,
+                                                      s_allocator_p),
+                  0);
+        ASSERT_EQ(decompressed.length(), 0);
+    }
+
+    PV("Compressing a non put event fails");
+    {
+        bdlbb::Blob notAnEvent(&bufferFactory, s_allocator_p);
+        bdlbb::Blob output(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&notAnEvent, "abcd", 4);
+        ASSERT_NE(bmqp::EventUtil::compressPutEvent(
+                      &output,
+                      notAnEvent,
+                      bmqt::CompressionAlgorithmType::e_ZSTD,
+                      &bufferFactory,
+                      s_allocator_p),
+                  0);
+    }
+}
+
+static void test5_decompressPutEventTooLarge()
+// ------------------------------------------------------------------------
+// DECOMPRESS PUT EVENT TOO LARGE
+//
+// Concerns:
+//   1. A small compressed put event whose body decompresses to more than
+//      'EventHeader::k_MAX_SIZE_SOFT' is rejected, without being fully
+//      decompressed.
+//   2. The headers of the messages decompressed before the limit is
+//      reached can be loaded, so that the messages can be NACKed.
+//
+// Plan:
+//   1. Build a put event larger than 'EventHeader::k_MAX_SIZE_SOFT' by
+//      repeating the body of a small one, sharing its buffers, and
+//      compress it.
+//   2. Decompress it, and verify failure, and that the output is within
+//      the limit and holds the headers of the leading messages.
+//
+// Testing:
+//   decompressPutEvent
+//   loadPutHeaders
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DECOMPRESS PUT EVENT TOO LARGE");
+
+    const int k_NUM_MSGS = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        char payload[64];
+        bsl::snprintf(payload, sizeof(payload), "{\"price\":%d}", i);
+
+        bmqt::MessageGUID guid;
+        guid.fromHex("40000000000000000000000000000001");
+
+        builder.startMessage();
+        builder.setMessagePayload(payload, bsl::strlen(payload));
+        builder.setMessageGUID(guid);
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  builder.packMessage(i % 4));
+    }
+
+    const bdlbb::Blob& event = builder.blob();
+
+    int headerSize = 0;
+    {
+        mwcu::BlobObjectProxy<bmqp::EventHeader> header(&event);
+        ASSERT(header.isSet());
+        headerSize = header->headerWords() * bmqp::Protocol::k_WORD_SIZE;
+    }
+    const int bodySize = event.length() - headerSize;
+
+    // Deep copy the header, which is modified below, and share the buffers
+    // of the body.
+    bsl::vector<char> headerData(headerSize, s_allocator_p);
+    bdlbb::BlobUtil::copy(headerData.data(), event, 0, headerSize);
+
+    bdlbb::Blob largeEvent(&bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&largeEvent, headerData.data(), headerSize);
+    while (largeEvent.length() <= bmqp::EventHeader::k_MAX_SIZE_SOFT) {
+        bdlbb::BlobUtil::append(&largeEvent, event, headerSize, bodySize);
+    }
+    {
+        mwcu::BlobObjectProxy<bmqp::EventHeader> header(&largeEvent,
+                                                        true,   // read
+                                                        true);  // write
+        header->setLength(largeEvent.length());
+    }
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_LZ4};
+
+    for (size_t a = 0; a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+         ++a) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[a];
+
+        PV("ALGORITHM: " << algorithm);
+
+        bdlbb::Blob compressed(&bufferFactory, s_allocator_p);
+        int         rc = bmqp::EventUtil::compressPutEvent(&compressed,
+                                                           largeEvent,
+                                                           algorithm,
+                                                           &bufferFactory,
+                                                           s_allocator_p);
+        ASSERT_EQ(rc, 0);
+        ASSERT_LT(compressed.length(), bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+        bdlbb::Blob decompressed(&bufferFactory, s_allocator_p);
+        rc = bmqp::EventUtil::decompressPutEvent(&decompressed,
+                                                 compressed,
+                                                 &bufferFactory,
+                                                 s_allocator_p);
+        ASSERT_NE(rc, 0);
+        ASSERT_GT(decompressed.length(), 0);
+        ASSERT_LE(decompressed.length(), bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+        // The headers of the messages decompressed before the limit can be
+        // loaded.
+        bsl::vector<bmqp::PutHeader> headers(s_allocator_p);
+        rc = bmqp::EventUtil::loadPutHeaders(&headers, decompressed);
+        ASSERT_EQ(rc, 0);
+        ASSERT_GT(headers.size(), static_cast<size_t>(k_NUM_MSGS));
+
+        for (size_t i = 0; i < headers.size(); ++i) {
+            ASSERT_EQ_D(i,
+                        headers[i].queueId(),
+                        static_cast<int>((i % k_NUM_MSGS) % 4));
+        }
+    }
+}
+
+static void test6_loadPutHeaders()
+// ------------------------------------------------------------------------
+// LOAD PUT HEADERS
+//
+// Concerns:
+//   1. The header of each message of a put event truncated at any point
+//      is loaded as soon as it is complete, even if the rest of the message
+//      is missing.
+//   2. Loading stops at the first invalid message header, and the number
+//      of bytes not covered by the loaded messages is returned.
+//   3. A blob not starting with a put event header is rejected.
+//
+// Plan:
+//   1. Build a put event, and load the headers of each of its prefixes.
+//   2. Corrupt the length of a message and load the headers.
+//   3. Load the headers of an empty blob.
+//
+// Testing:
+//   loadPutHeaders
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LOAD PUT HEADERS");
+
+    const int k_NUM_MSGS = 5;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        const bsl::string payload(100 * (i + 1), 'x', s_allocator_p);
+
+        bmqt::MessageGUID guid;
+        guid.fromHex("40000000000000000000000000000001");
+
+        builder.startMessage();
+        builder.setMessagePayload(payload.data(), payload.length());
+        builder.setMessageGUID(guid);
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  builder.packMessage(i));
+    }
+
+    const bdlbb::Blob& event = builder.blob();
+
+    // Offsets of the messages in the event
+    bsl::vector<int> offsets(s_allocator_p);
+    {
+        bsl::vector<bmqp::PutHeader> all(s_allocator_p);
+        ASSERT_EQ(0, bmqp::EventUtil::loadPutHeaders(&all, event));
+        ASSERT_EQ(static_cast<size_t>(k_NUM_MSGS), all.size());
+
+        mwcu::BlobObjectProxy<bmqp::EventHeader> header(&event);
+        ASSERT(header.isSet());
+
+        int offset = header->headerWords() * bmqp::Protocol::k_WORD_SIZE;
+        for (size_t i = 0; i < all.size(); ++i) {
+            offsets.push_back(offset);
+            offset += all[i].messageWords() * bmqp::Protocol::k_WORD_SIZE;
+        }
+        ASSERT_EQ(offset, event.length());
+    }
+
+    // 1. Each prefix of the event
+    for (int length = offsets[0]; length <= event.length(); ++length) {
+        bdlbb::Blob prefix(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&prefix, event, 0, length);
+
+        int expected = 0;
+        while (expected < k_NUM_MSGS &&
+               offsets[expected] + static_cast<int>(sizeof(bmqp::PutHeader)) <=
+                   length) {
+            ++expected;
+        }
+
+        bsl::vector<bmqp::PutHeader> headers(s_allocator_p);
+        const int rc = bmqp::EventUtil::loadPutHeaders(&headers, prefix);
+        ASSERT_EQ_D(length, static_cast<size_t>(expected), headers.size());
+        for (size_t i = 0; i < headers.size(); ++i) {
+            ASSERT_EQ_D(length, headers[i].queueId(), static_cast<int>(i));
+        }
+
+        // Only the trailing bytes of an incomplete header are not covered
+        const int lastOffset = expected < k_NUM_MSGS ? offsets[expected]
+                                                     : event.length();
+        ASSERT_EQ_D(length, rc, bsl::max(length - lastOffset, 0));
+    }
+
+    // 2. Invalid message length
+    {
+        bdlbb::Blob corrupted(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&corrupted, event, 0, event.length());
+
+        const int corruptedIndex = 2;
+        {
+            mwcu::BlobPosition position;
+            ASSERT_EQ(0,
+                      mwcu::BlobUtil::findOffsetSafe(&position,
+                                                     corrupted,
+                                                     mwcu::BlobPosition(),
+                                                     offsets[corruptedIndex]));
+
+            bmqp::PutHeader header;
+            bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&header),
+                                  corrupted,
+                                  offsets[corruptedIndex],
+                                  sizeof(header));
+            header.setMessageWords(0);
+            ASSERT_EQ(0,
+                      mwcu::BlobUtil::writeBytes(
+                          &corrupted,
+                          position,
+                          reinterpret_cast<const char*>(&header),
+                          sizeof(header)));
+        }
+
+        bsl::vector<bmqp::PutHeader> headers(s_allocator_p);
+        const int rc = bmqp::EventUtil::loadPutHeaders(&headers, corrupted);
+        ASSERT_EQ(static_cast<size_t>(corruptedIndex), headers.size());
+        ASSERT_EQ(rc, event.length() - offsets[corruptedIndex]);
+    }
+
+    // 3. Not a put event
+    {
+        bdlbb::Blob                  empty(&bufferFactory, s_allocator_p);
+        bsl::vector<bmqp::PutHeader> headers(s_allocator_p);
+        ASSERT_LT(bmqp::EventUtil::loadPutHeaders(&headers, empty), 0);
+        ASSERT(headers.empty());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -823,6 +1219,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_loadPutHeaders(); break;
+    case 5: test5_decompressPutEventTooLarge(); break;
+    case 4: test4_compressPutEvent(); break;
     case 3: test3_flattenWithMessageProperties(); break;
     case 2: test2_flattenExplodesEvent(); break;
     case 1: test1_breathingTest(); break;
@@ -184,6 +184,22 @@ MessageProperties_Schema::MessageProperties_Schema(
     }
 }
 
+MessageProperties_Schema::MessageProperties_Schema(
+    const MessagePropertiesView& view,
+    bslma::Allocator*            basicAllocator)
+: d_indices(basicAllocator)
+{
+    bsl::string name(basicAllocator);
+
+    for (int index = 0; index < view.numProperties(); ++index) {
+        int rc = view.loadName(&name, index);
+        BSLS_ASSERT_SAFE(rc == 0);
+        (void)rc;
+
+        d_indices.emplace(name, index);
+    }
+}
+
 MessageProperties_Schema::MessageProperties_Schema(
     const MessageProperties_Schema& other)
 : d_indices(other.d_indices)
@@ -860,18 +876,6 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
         return d_blob.object();  // RETURN
     }
 
-    // Make sure all Properties are read.
-    for (PropertyMapConstIter cit = d_properties.begin();
-         cit != d_properties.end();
-         ++cit) {
-        const Property& p = cit->second;
-        if (p.d_value.isUnset() && p.d_isValid) {
-            bool result = streamInPropertyValue(p);
-            BSLS_ASSERT(result);
-            (void)result;
-        }
-    }
-
     if (d_isBlobConstructed) {
         // This instance is dirty, which means it will have to be streamed out
         // to 'd_blob'.  Destroy the current instance of blob, which may be
@@ -885,30 +889,54 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
     new (d_blob.buffer()) bdlbb::Blob(bufferFactory, d_allocator_p);
     d_isBlobConstructed = true;
 
-    if (0 == numProperties()) {
-        BSLS_ASSERT(0 == totalSize());
+    streamOut(&d_blob.object(), info);
 
-        d_blob.object().removeAll();
+    d_isDirty = false;
 
-        d_isDirty = false;
-        return d_blob.object();  // RETURN
+    return d_blob.object();
+}
+
+void MessageProperties::streamOut(
+    bdlbb::Blob*                       blob,
+    const bmqp::MessagePropertiesInfo& info) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+
+    // Make sure all Properties are read.
+    for (PropertyMapConstIter cit = d_properties.begin();
+         cit != d_properties.end();
+         ++cit) {
+        const Property& p = cit->second;
+        if (p.d_value.isUnset() && p.d_isValid) {
+            bool result = streamInPropertyValue(p);
+            BSLS_ASSERT(result);
+            (void)result;
+        }
+    }
+
+    if (0 == numProperties()) {
+        BSLS_ASSERT(0 == totalSize());
+        return;  // RETURN
     }
 
     BSLS_ASSERT(k_MAX_NUM_PROPERTIES >= numProperties());
     BSLS_ASSERT(k_MAX_PROPERTIES_AREA_LENGTH >= totalSize());
 
-    bdlbb::Blob* blob = &(d_blob.object());
-
     // Add MessagePropertiesHeader.  Since the buffer factory being used by the
     // 'blob' could have been provided by the user, we cannot assume that
     // buffer size of the associated blob buffer factory is not less than the
     // sizeof(bmqp::MessagePropertiesHeader), otherwise we could have simply
     // invoked 'setLength' on the blob and reinterpret_casted first few bytes
-    // of the first buffer to 'bmqp::MessagePropertiesHeader'.
+    // of the first buffer to 'bmqp::MessagePropertiesHeader'.  Also note that
+    // 'blob' may already contain data, hence the header is accessed at its
+    // position rather than at the beginning of the blob.
 
-    mwcu::BlobUtil::reserve(blob, sizeof(MessagePropertiesHeader));
+    mwcu::BlobPosition headerPos;
+    mwcu::BlobUtil::reserve(&headerPos, blob, sizeof(MessagePropertiesHeader));
     mwcu::BlobObjectProxy<MessagePropertiesHeader> msgPropsHeader(
         blob,
+        headerPos,
         false,  // read flag
         true);  // write flag
     BSLS_ASSERT(msgPropsHeader.isSet());
@@ -994,14 +1022,12 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
 
     mwcu::BlobObjectProxy<MessagePropertiesHeader> msgPropsHdr(
         blob,
+        headerPos,
         false,  // read flag
         true);  // write flag
     BSLS_ASSERT(msgPropsHdr.isSet());
     msgPropsHdr->setMessagePropertiesAreaWords(numWords);
     msgPropsHdr.reset();
-    d_isDirty = false;
-
-    return d_blob.object();
 }
 
 bsl::ostream& MessageProperties::print(bsl::ostream& stream,
@@ -1116,5 +1142,633 @@ bool MessagePropertiesIterator::hasNext()
     return true;
 }
 
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// PRIVATE ACCESSORS
+int MessagePropertiesView::readHeader(bmqt::PropertyType::Enum* type,
+                                      int*                      nameLength,
+                                      int*                      field,
+                                      int                       index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_blob_p);
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numProps);
+
+    enum RcEnum {
+        rc_SUCCESS                        = 0,
+        rc_NO_MSG_PROPERTY_HEADER         = -1,
+        rc_INCOMPLETE_MSG_PROPERTY_HEADER = -2,
+        rc_INVALID_PROPERTY_TYPE          = -3,
+        rc_INVALID_PROPERTY_NAME_LENGTH   = -4
+    };
+
+    mwcu::BlobPosition position;
+    if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                       *d_blob_p,
+                                       d_mphOffset + index * d_mphSize)) {
+        return rc_NO_MSG_PROPERTY_HEADER;  // RETURN
+    }
+
+    // Note that the size specified in 'MessagePropertiesHeader' is used, not
+    // sizeof(MessagePropertyHeader).
+    mwcu::BlobObjectProxy<MessagePropertyHeader> mpHeader(
+        d_blob_p,
+        position,
+        d_mphSize,
+        true,    // read flag
+        false);  // write flag
+    if (!mpHeader.isSet()) {
+        return rc_INCOMPLETE_MSG_PROPERTY_HEADER;  // RETURN
+    }
+
+    *type = static_cast<bmqt::PropertyType::Enum>(mpHeader->propertyType());
+    if (bmqt::PropertyType::e_BOOL > *type ||
+        bmqt::PropertyType::e_BINARY < *type) {
+        return rc_INVALID_PROPERTY_TYPE;  // RETURN
+    }
+
+    // Like 'MessageProperties::streamInPropertyHeader', accept a zero-length
+    // name, so that the view and 'MessageProperties' accept the same input.
+    *nameLength = mpHeader->propertyNameLength();
+    if (MessageProperties::k_MAX_PROPERTY_NAME_LENGTH < *nameLength) {
+        return rc_INVALID_PROPERTY_NAME_LENGTH;  // RETURN
+    }
+
+    *field = mpHeader->propertyValueLength();
+
+    return rc_SUCCESS;
+}
+
+int MessagePropertiesView::loadLocation(Location* location,
+                                        int*      nameOffset,
+                                        int*      nameLength,
+                                        int       index,
+                                        int       start) const
+{
+    enum RcEnum {
+        rc_SUCCESS                       = 0,
+        rc_INVALID_PROPERTY_VALUE_LENGTH = -1,
+        rc_INVALID_HEADER                = -2
+    };
+
+    bmqt::PropertyType::Enum type;
+    int                      field;
+    int rc = readHeader(&type, nameLength, &field, index);
+    if (rc != 0) {
+        return 10 * rc + rc_INVALID_HEADER;  // RETURN
+    }
+
+    int length;
+    if (d_isNewStyleProperties) {
+        // The length of the value is the delta between the offsets of the
+        // names of this property and the next one, if any.
+        *nameOffset = d_dataOffset + field;
+
+        int end = d_totalSize;
+        if (index < d_numProps - 1) {
+            bmqt::PropertyType::Enum nextType;
+            int                      nextNameLength;
+            int                      nextField;
+            rc = readHeader(&nextType, &nextNameLength, &nextField, index + 1);
+            if (rc != 0) {
+                return 10 * rc + rc_INVALID_HEADER;  // RETURN
+            }
+            end = d_dataOffset + nextField;
+        }
+        length = end - *nameOffset - *nameLength;
+    }
+    else {
+        *nameOffset = start;
+        length      = field;
+    }
+
+    if (0 > length || *nameOffset < d_dataOffset ||
+        d_totalSize < *nameOffset + *nameLength + length ||
+        !validatePropertyLength(length, type)) {
+        return rc_INVALID_PROPERTY_VALUE_LENGTH;  // RETURN
+    }
+
+    location->d_type   = type;
+    location->d_offset = *nameOffset + *nameLength;
+    location->d_length = length;
+
+    return rc_SUCCESS;
+}
+
+bool MessagePropertiesView::findProperty(Location*          location,
+                                         const bsl::string& name) const
+{
+    if (0 == d_numProps) {
+        return false;  // RETURN
+    }
+
+    int nameOffset;
+    int nameLength;
+    int index;
+
+    if (d_schema && d_isNewStyleProperties &&
+        d_schema->loadIndex(&index, name) && index < d_numProps) {
+        if (0 == loadLocation(location, &nameOffset, &nameLength, index, 0) &&
+            isNamed(nameOffset, nameLength, name)) {
+            return true;  // RETURN
+        }
+
+        // The schema does not match the properties; fall back to scanning
+        // the headers.
+    }
+
+    int start = d_dataOffset;
+    for (index = 0; index < d_numProps; ++index) {
+        if (0 != loadLocation(location,
+                              &nameOffset,
+                              &nameLength,
+                              index,
+                              start)) {
+            return false;  // RETURN
+        }
+
+        if (isNamed(nameOffset, nameLength, name)) {
+            return true;  // RETURN
+        }
+
+        start = location->d_offset + location->d_length;
+    }
+
+    return false;
+}
+
+bool MessagePropertiesView::isNamed(int                nameOffset,
+                                    int                nameLength,
+                                    const bsl::string& name) const
+{
+    if (static_cast<int>(name.length()) != nameLength) {
+        return false;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    if (mwcu::BlobUtil::findOffsetSafe(&position, *d_blob_p, nameOffset)) {
+        return false;  // RETURN
+    }
+
+    int result;
+    int rc = mwcu::BlobUtil::compareSection(&result,
+                                            *d_blob_p,
+                                            position,
+                                            name.data(),
+                                            nameLength);
+
+    return rc == 0 && result == 0;
+}
+
+bool MessagePropertiesView::readValue(char*           buffer,
+                                      const Location& location) const
+{
+    mwcu::BlobPosition position;
+    if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                       *d_blob_p,
+                                       location.d_offset)) {
+        return false;  // RETURN
+    }
+
+    return 0 == mwcu::BlobUtil::readNBytes(buffer,
+                                           *d_blob_p,
+                                           position,
+                                           location.d_length);
+}
+
+bool MessagePropertiesView::loadFixedValue(char*                    buffer,
+                                           bmqt::PropertyType::Enum type,
+                                           const bsl::string&       name) const
+{
+    Location location;
+    if (!findProperty(&location, name) || location.d_type != type) {
+        return false;  // RETURN
+    }
+
+    return readValue(buffer, location);
+}
+
+// CREATORS
+MessagePropertiesView::MessagePropertiesView()
+: d_blob_p(0)
+, d_schema()
+, d_isNewStyleProperties(true)
+, d_totalSize(0)
+, d_mphSize(0)
+, d_mphOffset(0)
+, d_numProps(0)
+, d_dataOffset(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+int MessagePropertiesView::reset(const bdlbb::Blob* blob,
+                                 bool               isNewStyleProperties)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+
+    enum RcEnum {
+        rc_SUCCESS                          = 0,
+        rc_NO_MSG_PROPERTIES_HEADER         = -1,
+        rc_INCOMPLETE_MSG_PROPERTIES_HEADER = -2,
+        rc_INCORRECT_LENGTH                 = -3,
+        rc_INVALID_MPH_SIZE                 = -4,
+        rc_INVALID_NUM_PROPERTIES           = -5,
+        rc_MISSING_MSG_PROPERTY_HEADERS     = -6
+    };
+
+    clear();
+
+    d_isNewStyleProperties = isNewStyleProperties;
+
+    if (0 == blob->length()) {
+        // Empty blob implies no message properties.
+
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // Same validation as 'MessageProperties::streamInHeader'.
+    mwcu::BlobObjectProxy<MessagePropertiesHeader> msgPropsHeader(
+        blob,
+        -MessagePropertiesHeader::k_MIN_HEADER_SIZE,
+        true,    // read flag
+        false);  // write flag
+    if (!msgPropsHeader.isSet()) {
+        return rc_NO_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    msgPropsHeader.resize(msgPropsHeader->headerSize());
+    if (!msgPropsHeader.isSet()) {
+        return rc_INCOMPLETE_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    const int msgPropsAreaSize = msgPropsHeader->messagePropertiesAreaWords() *
+                                 Protocol::k_WORD_SIZE;
+    if (msgPropsAreaSize > blob->length()) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    const int mphSize    = msgPropsHeader->messagePropertyHeaderSize();
+    const int mphOffset  = msgPropsHeader->headerSize();
+    const int numProps   = msgPropsHeader->numProperties();
+    const int dataOffset = mphOffset + numProps * mphSize;
+    if (0 >= mphSize) {
+        return rc_INVALID_MPH_SIZE;  // RETURN
+    }
+
+    if (0 >= numProps || MessageProperties::k_MAX_NUM_PROPERTIES < numProps) {
+        return rc_INVALID_NUM_PROPERTIES;  // RETURN
+    }
+
+    const int totalSize = ProtocolUtil::calcUnpaddedLength(*blob,
+                                                           msgPropsAreaSize);
+    if (totalSize > blob->length()) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    if (totalSize < dataOffset) {
+        return rc_MISSING_MSG_PROPERTY_HEADERS;  // RETURN
+    }
+
+    d_blob_p     = blob;
+    d_totalSize  = totalSize;
+    d_mphSize    = mphSize;
+    d_mphOffset  = mphOffset;
+    d_numProps   = numProps;
+    d_dataOffset = dataOffset;
+
+    return rc_SUCCESS;
+}
+
+void MessagePropertiesView::clear()
+{
+    d_blob_p = 0;
+    d_schema.reset();
+    d_totalSize  = 0;
+    d_mphSize    = 0;
+    d_mphOffset  = 0;
+    d_numProps   = 0;
+    d_dataOffset = 0;
+}
+
+// ACCESSORS
+int MessagePropertiesView::makeSchema(SchemaPtr*        schema,
+                                      bslma::Allocator* allocator) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(schema);
+
+    // Make sure the name of each property can be loaded.
+    Location location;
+    int      nameOffset;
+    int      nameLength;
+    int      start = d_dataOffset;
+    for (int index = 0; index < d_numProps; ++index) {
+        int rc = loadLocation(&location,
+                              &nameOffset,
+                              &nameLength,
+                              index,
+                              start);
+        if (rc != 0) {
+            return rc;  // RETURN
+        }
+        start = location.d_offset + location.d_length;
+    }
+
+    schema->load(new (*allocator) MessageProperties_Schema(*this, allocator),
+                 allocator);
+
+    return 0;
+}
+
+int MessagePropertiesView::loadName(bsl::string* name, int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(name);
+
+    enum RcEnum {
+        rc_SUCCESS            = 0,
+        rc_INVALID_INDEX      = -1,
+        rc_MISSING_NAME       = -2,
+        rc_INVALID_PROPERTIES = -3
+    };
+
+    if (0 > index || d_numProps <= index) {
+        return rc_INVALID_INDEX;  // RETURN
+    }
+
+    // Old style headers carry lengths, hence all preceding properties have to
+    // be located to know where this one starts.
+    Location location;
+    int      nameOffset;
+    int      nameLength;
+    int      start = d_dataOffset;
+    for (int i = d_isNewStyleProperties ? index : 0; i <= index; ++i) {
+        int rc = loadLocation(&location, &nameOffset, &nameLength, i, start);
+        if (rc != 0) {
+            return 10 * rc + rc_INVALID_PROPERTIES;  // RETURN
+        }
+        start = location.d_offset + location.d_length;
+    }
+
+    mwcu::BlobPosition position;
+    if (mwcu::BlobUtil::findOffsetSafe(&position, *d_blob_p, nameOffset)) {
+        return rc_MISSING_NAME;  // RETURN
+    }
+
+    name->resize(nameLength);
+    if (mwcu::BlobUtil::readNBytes(name->begin(),
+                                   *d_blob_p,
+                                   position,
+                                   nameLength)) {
+        return rc_MISSING_NAME;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+bool MessagePropertiesView::hasProperty(const bsl::string&        name,
+                                        bmqt::PropertyType::Enum* type) const
+{
+    Location location;
+    if (!findProperty(&location, name)) {
+        return false;  // RETURN
+    }
+
+    if (type) {
+        *type = location.d_type;
+    }
+
+    return true;
+}
+
+bool MessagePropertiesView::getPropertyAsBoolOr(const bsl::string& name,
+                                                bool               value) const
+{
+    char result;
+    if (!loadFixedValue(&result, bmqt::PropertyType::e_BOOL, name)) {
+        return value;  // RETURN
+    }
+
+    return result == 1;
+}
+
+char MessagePropertiesView::getPropertyAsCharOr(const bsl::string& name,
+                                                char               value) const
+{
+    char result;
+    if (!loadFixedValue(&result, bmqt::PropertyType::e_CHAR, name)) {
+        return value;  // RETURN
+    }
+
+    return result;
+}
+
+short MessagePropertiesView::getPropertyAsShortOr(const bsl::string& name,
+                                                  short value) const
+{
+    bdlb::BigEndianInt16 result;
+    if (!loadFixedValue(reinterpret_cast<char*>(&result),
+                        bmqt::PropertyType::e_SHORT,
+                        name)) {
+        return value;  // RETURN
+    }
+
+    return static_cast<short>(result);
+}
+
+int MessagePropertiesView::getPropertyAsInt32Or(const bsl::string& name,
+                                                int                value) const
+{
+    bdlb::BigEndianInt32 result;
+    if (!loadFixedValue(reinterpret_cast<char*>(&result),
+                        bmqt::PropertyType::e_INT32,
+                        name)) {
+        return value;  // RETURN
+    }
+
+    return static_cast<int>(result);
+}
+
+bsls::Types::Int64
+MessagePropertiesView::getPropertyAsInt64Or(const bsl::string& name,
+                                            bsls::Types::Int64 value) const
+{
+    bdlb::BigEndianInt64 result;
+    if (!loadFixedValue(reinterpret_cast<char*>(&result),
+                        bmqt::PropertyType::e_INT64,
+                        name)) {
+        return value;  // RETURN
+    }
+
+    return static_cast<bsls::Types::Int64>(result);
+}
+
+int MessagePropertiesView::loadPropertyAsString(bsl::string*       value,
+                                                const bsl::string& name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    enum RcEnum {
+        rc_SUCCESS          = 0,
+        rc_NO_SUCH_PROPERTY = -1,
+        rc_TYPE_MISMATCH    = -2,
+        rc_INVALID_PROPERTY = -3
+    };
+
+    Location location;
+    if (!findProperty(&location, name)) {
+        return rc_NO_SUCH_PROPERTY;  // RETURN
+    }
+
+    if (location.d_type != bmqt::PropertyType::e_STRING) {
+        return rc_TYPE_MISMATCH;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    value->resize(location.d_length);
+    if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                       *d_blob_p,
+                                       location.d_offset) ||
+        mwcu::BlobUtil::readNBytes(value->begin(),
+                                   *d_blob_p,
+                                   position,
+                                   location.d_length)) {
+        return rc_INVALID_PROPERTY;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int MessagePropertiesView::loadPropertyAsBinary(bsl::vector<char>* value,
+                                                const bsl::string& name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    enum RcEnum {
+        rc_SUCCESS          = 0,
+        rc_NO_SUCH_PROPERTY = -1,
+        rc_TYPE_MISMATCH    = -2,
+        rc_INVALID_PROPERTY = -3
+    };
+
+    Location location;
+    if (!findProperty(&location, name)) {
+        return rc_NO_SUCH_PROPERTY;  // RETURN
+    }
+
+    if (location.d_type != bmqt::PropertyType::e_BINARY) {
+        return rc_TYPE_MISMATCH;  // RETURN
+    }
+
+    mwcu::BlobPosition position;
+    value->resize(location.d_length);
+    if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                       *d_blob_p,
+                                       location.d_offset) ||
+        mwcu::BlobUtil::readNBytes(value->data(),
+                                   *d_blob_p,
+                                   position,
+                                   location.d_length)) {
+        return rc_INVALID_PROPERTY;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+bdld::Datum
+MessagePropertiesView::getPropertyRef(const bsl::string& name,
+                                      bslma::Allocator*  basicAllocator) const
+{
+    Location location;
+    if (!findProperty(&location, name)) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    union {
+        char                 d_char;
+        bdlb::BigEndianInt16 d_short;
+        bdlb::BigEndianInt32 d_int;
+        bdlb::BigEndianInt64 d_int64;
+    } value;
+
+    switch (location.d_type) {
+    case bmqt::PropertyType::e_BOOL:
+        if (!readValue(&value.d_char, location)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+        return bdld::Datum::createBoolean(value.d_char == 1);  // RETURN
+    case bmqt::PropertyType::e_CHAR:
+        if (!readValue(&value.d_char, location)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+        return bdld::Datum::createInteger(value.d_char);  // RETURN
+    case bmqt::PropertyType::e_SHORT:
+        if (!readValue(reinterpret_cast<char*>(&value.d_short), location)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+        return bdld::Datum::createInteger(
+            static_cast<short>(value.d_short));  // RETURN
+    case bmqt::PropertyType::e_INT32:
+        if (!readValue(reinterpret_cast<char*>(&value.d_int), location)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+        return bdld::Datum::createInteger(
+            static_cast<int>(value.d_int));  // RETURN
+    case bmqt::PropertyType::e_INT64:
+        if (!readValue(reinterpret_cast<char*>(&value.d_int64), location)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+        return bdld::Datum::createInteger64(
+            static_cast<bsls::Types::Int64>(value.d_int64),
+            basicAllocator);  // RETURN
+    case bmqt::PropertyType::e_STRING: {
+        mwcu::BlobPosition position;
+        if (mwcu::BlobUtil::findOffsetSafe(&position,
+                                           *d_blob_p,
+                                           location.d_offset)) {
+            return bdld::Datum::createError(-3);  // RETURN
+        }
+
+        const bdlbb::BlobBuffer& buffer = d_blob_p->buffer(position.buffer());
+        const int                bufferLength =
+            position.buffer() == d_blob_p->numDataBuffers() - 1
+                ? d_blob_p->lastDataBufferLength()
+                : buffer.size();
+
+        if (location.d_length <= bufferLength - position.byte()) {
+            // The value is contiguous, refer to it.
+            return bdld::Datum::createStringRef(buffer.data() +
+                                                    position.byte(),
+                                                location.d_length,
+                                                basicAllocator);  // RETURN
+        }
+
+        // The value spans several buffers, copy it.
+        char*       data;
+        bdld::Datum result = bdld::Datum::createUninitializedString(
+            &data,
+            location.d_length,
+            basicAllocator);
+        mwcu::BlobUtil::readNBytes(data,
+                                   *d_blob_p,
+                                   position,
+                                   location.d_length);
+        return result;  // RETURN
+    }
+    case bmqt::PropertyType::e_BINARY:
+        // do not want to use binary
+        return bdld::Datum::createError(-2);
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: return bdld::Datum::createError(-3);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
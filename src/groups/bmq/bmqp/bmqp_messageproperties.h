@@ -21,6 +21,7 @@
 //
 //@CLASSES:
 //  bmqp::MessageProperties: VST representing message properties.
+//  bmqp::MessagePropertiesView: read-only view on encoded properties.
 //
 //@SEE ALSO: bmqt::PropertyType
 //
@@ -58,6 +59,7 @@ namespace bmqp {
 // FORWARD DECLARATION
 class MessageProperties;
 class MessagePropertiesIterator;
+class MessagePropertiesView;
 
 // ==============================
 // class MessageProperties_Schema
@@ -97,6 +99,14 @@ class MessageProperties_Schema {
     /// change
     MessageProperties_Schema(const MessageProperties& mps,
                              bslma::Allocator*        basicAllocator);
+
+    /// Create Schema from the names of the properties of the specified
+    /// `view`, in the order of their headers.  Once created, it cannot
+    /// change.  The behavior is undefined unless the name of each property
+    /// of `view` can be loaded.
+    MessageProperties_Schema(const MessagePropertiesView& view,
+                             bslma::Allocator*            basicAllocator);
+
     MessageProperties_Schema(const MessageProperties_Schema& other);
 
     // PUBLIC ACCESSORS
@@ -482,6 +492,16 @@ class MessageProperties {
     streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
               const bmqp::MessagePropertiesInfo& info) const;
 
+    /// Append the BlazingMQ wire protocol representation of this instance,
+    /// including padding, to the specified `blob`, encoded as specified by
+    /// `info`.  Unlike the other overload, this method does not cache the
+    /// representation in this object, and therefore does not allocate any
+    /// memory other than the buffers needed by `blob`.  Note that nothing
+    /// is appended if this instance is empty.  The behavior is undefined
+    /// unless `blob` is non-null.
+    void streamOut(bdlbb::Blob*                       blob,
+                   const bmqp::MessagePropertiesInfo& info) const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -580,6 +600,199 @@ class MessagePropertiesIterator {
     const bsl::vector<char>& getAsBinary() const;
 };
 
+// ===========================
+// class MessagePropertiesView
+// ===========================
+
+/// Provide a read-only view on the BlazingMQ wire protocol representation of
+/// message properties.  Unlike `MessageProperties`, the view does not parse
+/// the properties upfront: each access reads the `MessagePropertyHeader` of
+/// the requested property, and its value, directly from the blob, without
+/// copying the blob or allocating memory.  If a schema is associated with
+/// the view, the header of a property is located by the index of its name in
+/// the schema; otherwise, the headers are scanned.  The blob must not be
+/// modified or destroyed while it is associated with a view.
+class MessagePropertiesView {
+  public:
+    // PUBLIC TYPES
+    typedef MessageProperties::SchemaPtr SchemaPtr;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Location of the value of a property in the blob.
+    struct Location {
+        bmqt::PropertyType::Enum d_type;
+        // Type of the value
+
+        int d_offset;
+        // Offset of the value in the blob
+
+        int d_length;
+        // Length of the value
+    };
+
+  private:
+    // DATA
+    const bdlbb::Blob* d_blob_p;
+    // Blob holding the properties, or 0 if
+    // this view is empty
+
+    SchemaPtr d_schema;
+    // Schema of the properties, if known
+
+    bool d_isNewStyleProperties;
+    // Whether headers carry offsets of names
+    // (new style) or lengths of values (old
+    // style)
+
+    int d_totalSize;
+    // Size of the properties, excluding the
+    // padding
+
+    int d_mphSize;
+    // Size of a 'MessagePropertyHeader'
+
+    int d_mphOffset;
+    // Offset of the first
+    // 'MessagePropertyHeader'
+
+    int d_numProps;
+    // Number of properties
+
+    int d_dataOffset;
+    // Offset of the first property name
+
+  private:
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `type`, `nameLength` and `field` the fields
+    /// of the header of the property at the specified `index`, where
+    /// `field` is the offset of the name (new style) or the length of the
+    /// value (old style).  Return 0 on success, and non-zero if the header
+    /// is invalid.
+    int readHeader(bmqt::PropertyType::Enum* type,
+                   int*                      nameLength,
+                   int*                      field,
+                   int                       index) const;
+
+    /// Load into the specified `location`, `nameOffset` and `nameLength`
+    /// the position of the property at the specified `index`, using the
+    /// specified `start` offset at which the previous property ends if the
+    /// properties are old style.  Return 0 on success, and non-zero if the
+    /// headers are invalid.
+    int loadLocation(Location* location,
+                     int*      nameOffset,
+                     int*      nameLength,
+                     int       index,
+                     int       start) const;
+
+    /// Load into the specified `location` the position of the value of the
+    /// property having the specified `name`.  Return `true` on success, and
+    /// `false` if there is no such property.
+    bool findProperty(Location* location, const bsl::string& name) const;
+
+    /// Return `true` if the name of the specified `nameLength` at the
+    /// specified `nameOffset` is equal to the specified `name`.
+    bool isNamed(int nameOffset, int nameLength, const bsl::string& name) const;
+
+    /// Load into the specified `buffer` the value at the specified
+    /// `location`.  Return `true` on success, and `false` otherwise.
+    bool readValue(char* buffer, const Location& location) const;
+
+    /// Load into the specified `buffer` the value of the property having
+    /// the specified `name` if it exists and has the specified `type`, and
+    /// return `true`.  Return `false` otherwise.  The behavior is undefined
+    /// unless `buffer` can hold a value of `type`, which is of fixed size.
+    bool loadFixedValue(char*                    buffer,
+                        bmqt::PropertyType::Enum type,
+                        const bsl::string&       name) const;
+
+  public:
+    // CREATORS
+
+    /// Create an empty view.
+    MessagePropertiesView();
+
+    // MANIPULATORS
+
+    /// Associate this view with the properties at the beginning of the
+    /// specified `blob`, encoded in the new style (offsets) if the
+    /// specified `isNewStyleProperties` is `true`, and in the old style
+    /// (lengths) otherwise, and dissociate it from its schema, if any.
+    /// Return 0 on success, and non-zero if the header of the properties is
+    /// invalid, in which case this view is empty.  Note that an empty
+    /// `blob` represents an empty instance.
+    int reset(const bdlbb::Blob* blob, bool isNewStyleProperties);
+
+    /// Associate this view with the specified `schema`, which is expected
+    /// to be the schema of the properties this view is associated with.
+    /// Note that if `schema` does not match the properties, accessing a
+    /// property falls back to scanning the headers.
+    void setSchema(const SchemaPtr& schema);
+
+    /// Reset this view to an empty view.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of properties.
+    int numProperties() const;
+
+    /// Return `true` if the properties of this view are encoded in the new
+    /// style.
+    bool isNewStyleProperties() const;
+
+    /// Return the schema associated with this view, if any.
+    const SchemaPtr& schema() const;
+
+    /// Load into the specified `schema` a newly created schema of the
+    /// properties of this view, using the specified `allocator`.  Return 0
+    /// on success, and non-zero if the headers of the properties are
+    /// invalid.
+    int makeSchema(SchemaPtr* schema, bslma::Allocator* allocator) const;
+
+    /// Load into the specified `name` the name of the property at the
+    /// specified `index`, in the order of the headers.  Return 0 on success
+    /// and non-zero if `index` is out of range or the headers are invalid.
+    int loadName(bsl::string* name, int index) const;
+
+    /// Return `true` if a property with the specified `name` exists, and
+    /// load its type into the optionally specified `type`.  Return `false`
+    /// otherwise.
+    bool hasProperty(const bsl::string&        name,
+                     bmqt::PropertyType::Enum* type = 0) const;
+
+    bool  getPropertyAsBoolOr(const bsl::string& name, bool value) const;
+    char  getPropertyAsCharOr(const bsl::string& name, char value) const;
+    short getPropertyAsShortOr(const bsl::string& name, short value) const;
+    int   getPropertyAsInt32Or(const bsl::string& name, int value) const;
+
+    /// Return the value of the property having the specified `name` if it
+    /// exists and has the corresponding type, and the specified `value`
+    /// otherwise.
+    bsls::Types::Int64 getPropertyAsInt64Or(const bsl::string& name,
+                                            bsls::Types::Int64 value) const;
+
+    int loadPropertyAsString(bsl::string*       value,
+                             const bsl::string& name) const;
+
+    /// Load into the specified `value` the value of the property having
+    /// the specified `name`.  Return 0 on success, and non-zero if there is
+    /// no such property or it has a different type.  Note that `value` is
+    /// assigned, so its capacity can be reused from one call to the next.
+    int loadPropertyAsBinary(bsl::vector<char>* value,
+                             const bsl::string& name) const;
+
+    /// Return the value of the property having the specified `name` as a
+    /// `bdld::Datum`, with the same conventions as
+    /// `MessageProperties::getPropertyRef`.  A string value refers to the
+    /// blob, unless it spans several buffers of the blob, in which case it
+    /// is copied using the specified `basicAllocator`.
+    bdld::Datum getPropertyRef(const bsl::string& name,
+                               bslma::Allocator*  basicAllocator) const;
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
@@ -1094,6 +1307,33 @@ inline const bsl::vector<char>& MessagePropertiesIterator::getAsBinary() const
         .the<bsl::vector<char> >();
 }
 
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// MANIPULATORS
+inline void MessagePropertiesView::setSchema(const SchemaPtr& schema)
+{
+    d_schema = schema;
+}
+
+// ACCESSORS
+inline int MessagePropertiesView::numProperties() const
+{
+    return d_numProps;
+}
+
+inline bool MessagePropertiesView::isNewStyleProperties() const
+{
+    return d_isNewStyleProperties;
+}
+
+inline const MessagePropertiesView::SchemaPtr&
+MessagePropertiesView::schema() const
+{
+    return d_schema;
+}
+
 }  // close package namespace
 
 // -----------------------
@@ -1167,6 +1167,189 @@ static void test10_empty()
     ASSERT(!p.hasProperty("z"));
 }
 
+static void test11_view()
+{
+    // Ensure 'MessagePropertiesView' reads the same values as
+    // 'MessageProperties', in both encodings, with and without schema.
+
+    mwctst::TestHelper::printTestName("'MessagePropertiesView' TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::MessageProperties        p(s_allocator_p);
+    bmqp::MessagePropertiesInfo    logic(true, 1, false);
+    bmqp::MessagePropertiesView    view;
+
+    const bsl::string longString(300, 'x', s_allocator_p);
+    bsl::vector<char> binary(s_allocator_p);
+    binary.push_back('a');
+    binary.push_back('\0');
+
+    ASSERT_EQ(0, p.setPropertyAsBool("bool", true));
+    ASSERT_EQ(0, p.setPropertyAsChar("char", 'c'));
+    ASSERT_EQ(0, p.setPropertyAsShort("short", -3));
+    ASSERT_EQ(0, p.setPropertyAsInt32("int", 123456));
+    ASSERT_EQ(0, p.setPropertyAsInt64("int64", -1234567890123LL));
+    ASSERT_EQ(0, p.setPropertyAsString("string", "value"));
+    ASSERT_EQ(0, p.setPropertyAsString("long", longString));
+    ASSERT_EQ(0, p.setPropertyAsBinary("binary", binary));
+
+    const bdlbb::Blob& newStyle = p.streamOut(&bufferFactory, logic);
+
+    bdlbb::Blob oldStyle(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(0,
+              bmqp::ProtocolUtil::convertToOld(
+                  &oldStyle,
+                  &newStyle,
+                  bmqt::CompressionAlgorithmType::e_NONE,
+                  &bufferFactory,
+                  s_allocator_p));
+
+    bmqp::MessagePropertiesView::SchemaPtr schema;
+
+    for (int i = 0; i < 3; ++i) {
+        PVV("Iteration " << i);
+
+        if (i == 0) {
+            ASSERT_EQ(0, view.reset(&newStyle, true));
+            ASSERT(!view.schema());
+        }
+        else if (i == 1) {
+            ASSERT_EQ(0, view.reset(&newStyle, true));
+            ASSERT_EQ(0, view.makeSchema(&schema, s_allocator_p));
+            view.setSchema(schema);
+        }
+        else {
+            ASSERT_EQ(0, view.reset(&oldStyle, false));
+        }
+
+        ASSERT_EQ(p.numProperties(), view.numProperties());
+
+        bmqt::PropertyType::Enum type;
+        ASSERT(view.hasProperty("short", &type));
+        ASSERT_EQ(bmqt::PropertyType::e_SHORT, type);
+        ASSERT(!view.hasProperty("missing"));
+
+        ASSERT_EQ(true, view.getPropertyAsBoolOr("bool", false));
+        ASSERT_EQ('c', view.getPropertyAsCharOr("char", 'z'));
+        ASSERT_EQ(-3, view.getPropertyAsShortOr("short", 0));
+        ASSERT_EQ(123456, view.getPropertyAsInt32Or("int", 0));
+        ASSERT_EQ(-1234567890123LL, view.getPropertyAsInt64Or("int64", 0));
+
+        // Missing property, and type mismatch
+        ASSERT_EQ(7, view.getPropertyAsInt32Or("missing", 7));
+        ASSERT_EQ(7, view.getPropertyAsInt32Or("short", 7));
+
+        bsl::string string(s_allocator_p);
+        ASSERT_EQ(0, view.loadPropertyAsString(&string, "string"));
+        ASSERT_EQ("value", string);
+        ASSERT_EQ(0, view.loadPropertyAsString(&string, "long"));
+        ASSERT_EQ(longString, string);
+        ASSERT_NE(0, view.loadPropertyAsString(&string, "int"));
+
+        bsl::vector<char> buffer(s_allocator_p);
+        ASSERT_EQ(0, view.loadPropertyAsBinary(&buffer, "binary"));
+        ASSERT(binary == buffer);
+
+        bdld::Datum datum = view.getPropertyRef("int64", s_allocator_p);
+        ASSERT(datum.isInteger64());
+        ASSERT_EQ(-1234567890123LL, datum.theInteger64());
+        bdld::Datum::destroy(datum, s_allocator_p);
+
+        datum = view.getPropertyRef("string", s_allocator_p);
+        ASSERT(datum.isString());
+        ASSERT_EQ("value", datum.theString());
+        bdld::Datum::destroy(datum, s_allocator_p);
+
+        // Spanning several buffers
+        datum = view.getPropertyRef("long", s_allocator_p);
+        ASSERT(datum.isString());
+        ASSERT_EQ(longString, datum.theString());
+        bdld::Datum::destroy(datum, s_allocator_p);
+
+        ASSERT(view.getPropertyRef("missing", s_allocator_p).isError());
+
+        bsl::string name(s_allocator_p);
+        for (int index = 0; index < view.numProperties(); ++index) {
+            ASSERT_EQ(0, view.loadName(&name, index));
+            ASSERT(p.hasProperty(name));
+        }
+        ASSERT_NE(0, view.loadName(&name, view.numProperties()));
+    }
+
+    // Schema which does not match the properties: the view falls back to
+    // scanning the headers.
+    {
+        bmqp::MessageProperties other(s_allocator_p);
+        ASSERT_EQ(0, other.setPropertyAsInt32("missing", 1));
+        ASSERT_EQ(0, other.setPropertyAsString("int", "not an int"));
+        ASSERT_EQ(0, other.setPropertyAsShort("short", 1));
+
+        bmqp::MessagePropertiesView otherView;
+        ASSERT_EQ(0,
+                  otherView.reset(&other.streamOut(&bufferFactory, logic),
+                                  true));
+
+        bmqp::MessagePropertiesView::SchemaPtr mismatched;
+        ASSERT_EQ(0, otherView.makeSchema(&mismatched, s_allocator_p));
+
+        ASSERT_EQ(0, view.reset(&newStyle, true));
+        view.setSchema(mismatched);
+
+        ASSERT_EQ(p.numProperties(), view.numProperties());
+        ASSERT(!view.hasProperty("missing"));
+        ASSERT_EQ(7, view.getPropertyAsInt32Or("missing", 7));
+        ASSERT_EQ(123456, view.getPropertyAsInt32Or("int", 0));
+        ASSERT_EQ(-3, view.getPropertyAsShortOr("short", 0));
+        ASSERT_EQ(true, view.getPropertyAsBoolOr("bool", false));
+
+        bsl::string string(s_allocator_p);
+        ASSERT_EQ(0, view.loadPropertyAsString(&string, "string"));
+        ASSERT_EQ("value", string);
+        ASSERT_EQ(0, view.loadPropertyAsString(&string, "long"));
+        ASSERT_EQ(longString, string);
+    }
+
+    // A zero-length name is accepted by the view as by 'streamIn'.
+    {
+        PropertyMap pmap(s_allocator_p);
+        pmap.insert(bsl::make_pair(
+            bsl::string("", s_allocator_p),
+            bsl::make_pair(PropertyTypeSizePair(bmqt::PropertyType::e_INT32,
+                                                sizeof(int)),
+                           PropertyVariant(17))));
+        pmap.insert(bsl::make_pair(
+            bsl::string("n", s_allocator_p),
+            bsl::make_pair(PropertyTypeSizePair(bmqt::PropertyType::e_SHORT,
+                                                sizeof(short)),
+                           PropertyVariant(static_cast<short>(5)))));
+
+        bdlbb::Blob wireRep(&bufferFactory, s_allocator_p);
+        encode(&wireRep, pmap);
+
+        bmqp::MessageProperties in(s_allocator_p);
+        ASSERT_EQ(0, in.streamIn(wireRep, false));
+        ASSERT_EQ(0, view.reset(&wireRep, false));
+
+        ASSERT_EQ(in.numProperties(), view.numProperties());
+        ASSERT_EQ(in.hasProperty(""), view.hasProperty(""));
+        ASSERT_EQ(17, view.getPropertyAsInt32Or("", 0));
+        ASSERT_EQ(5, view.getPropertyAsShortOr("n", 0));
+
+        bsl::string name(s_allocator_p);
+        ASSERT_EQ(0, view.loadName(&name, 0));
+        ASSERT(name.empty());
+    }
+
+    // Empty blob implies no properties
+    bdlbb::Blob empty(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(0, view.reset(&empty, true));
+    ASSERT_EQ(0, view.numProperties());
+    ASSERT(!view.hasProperty("bool"));
+
+    view.clear();
+    ASSERT_EQ(0, view.numProperties());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1179,6 +1362,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 11: test11_view(); break;
     case 10: test10_empty(); break;
     case 9: test9_copyAssignTest(); break;
     case 8: test8_printTest(); break;
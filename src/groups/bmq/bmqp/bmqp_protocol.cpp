@@ -273,6 +273,15 @@ const char MessagePropertiesFeatures::k_FIELD_NAME[] = "MPS";
 const char MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX[] =
     "MESSAGE_PROPERTIES_EX";
 
+// --------------------------
+// struct CompressionFeatures
+// --------------------------
+
+const char CompressionFeatures::k_FIELD_NAME[] = "CMP";
+const char CompressionFeatures::k_ZSTD[]       = "ZSTD";
+const char CompressionFeatures::k_LZ4[]        = "LZ4";
+const char CompressionFeatures::k_EVENT[]      = "EVENT";
+
 // -----------------
 // struct OptionType
 // -----------------
@@ -336,6 +345,10 @@ const int EventHeaderUtil::k_CONTROL_EVENT_ENCODING_MASK =
     bdlb::BitMaskUtil::one(EventHeaderUtil::k_CONTROL_EVENT_ENCODING_START_IDX,
                            EventHeaderUtil::k_CONTROL_EVENT_ENCODING_NUM_BITS);
 
+const int EventHeaderUtil::k_PUT_EVENT_COMPRESSION_MASK =
+    bdlb::BitMaskUtil::one(EventHeaderUtil::k_PUT_EVENT_COMPRESSION_START_IDX,
+                           EventHeaderUtil::k_PUT_EVENT_COMPRESSION_NUM_BITS);
+
 // -------------------
 // struct OptionHeader
 // -------------------
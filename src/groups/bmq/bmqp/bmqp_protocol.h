@@ -384,6 +384,16 @@ struct Protocol {
     // will not be compressed regardless of the compression
     // algorithm type set to the PutEventBuilder.
 
+    static const int k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE = 64;
+    // Threshold below which PUT's message payload will not be
+    // compressed when a compression dictionary is available
+    // for the queue.
+
+    static const int k_COMPRESSION_MIN_EVENT_SIZE = 4 * 1024;
+    // Threshold below which the body of a PUT event will not
+    // be compressed as a whole, regardless of the event
+    // compression algorithm configured on the session.
+
     static const int k_CONSUMER_PRIORITY_INVALID;
     // Constant representing the invalid consumer priority
     // (e.g. of a non-consumer client).
@@ -644,6 +654,23 @@ struct MessagePropertiesFeatures {
     static const char k_MESSAGE_PROPERTIES_EX[];
 };
 
+/// This struct defines feature names related to compression algorithms
+/// which were added after `ZLIB`.  A peer not advertising one of these must
+/// not be sent messages compressed with the corresponding algorithm.
+struct CompressionFeatures {
+    /// Field name of the compression features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+    static const char k_ZSTD[];
+
+    static const char k_LZ4[];
+
+    /// Support for PUT events whose whole body is compressed (see
+    /// `EventHeaderUtil::putEventCompressionAlgorithmType`).
+    static const char k_EVENT[];
+};
+
 // =================
 // struct OptionType
 // =================
@@ -753,6 +780,19 @@ struct EventHeader {
     //      +---------------+
     //      |CODEC| Reserved|
     //
+    //: o Put: represent the compression algorithm applied to the whole event
+    //:   body (i.e., everything following this header), if any
+    //      |0|1|2|3|4|5|6|7|
+    //      +---------------+
+    //      | CAT | Reserved|
+    //
+    //      CAT: CompressionAlgorithmType
+    //
+    //   A value other than 'NONE' is only set if the receiving peer
+    //   advertised support for event-level compression (see
+    //   'CompressionFeatures::k_EVENT'), so that older peers always receive
+    //   a zero 'TypeSpecific' for PUT events, as before.
+    //
     // NOTE: The HeaderWords allows to eventually put event level options
     //       (either by extending the EventHeader struct, or putting new struct
     //       after the EventHeader).  For now, this is left up for future
@@ -902,6 +942,10 @@ struct EventHeaderUtil {
     static const int k_CONTROL_EVENT_ENCODING_START_IDX = 5;
     static const int k_CONTROL_EVENT_ENCODING_MASK;
 
+    static const int k_PUT_EVENT_COMPRESSION_NUM_BITS  = 3;
+    static const int k_PUT_EVENT_COMPRESSION_START_IDX = 5;
+    static const int k_PUT_EVENT_COMPRESSION_MASK;
+
   public:
     // CLASS METHODS
 
@@ -914,6 +958,18 @@ struct EventHeaderUtil {
     /// appropriate bits in the specified `eventHeader`.
     static EncodingType::Enum
     controlEventEncodingType(const EventHeader& eventHeader);
+
+    /// Set the appropriate bits in the specified `eventHeader` to represent
+    /// the specified compression algorithm `type` applied to the body of a
+    /// put event.
+    static void setPutEventCompressionAlgorithmType(
+        EventHeader*                         eventHeader,
+        bmqt::CompressionAlgorithmType::Enum type);
+
+    /// Return the compression algorithm applied to the body of a put event
+    /// represented by the appropriate bits in the specified `eventHeader`.
+    static bmqt::CompressionAlgorithmType::Enum
+    putEventCompressionAlgorithmType(const EventHeader& eventHeader);
 };
 
 // ===================
@@ -3855,6 +3911,40 @@ EventHeaderUtil::controlEventEncodingType(const EventHeader& eventHeader)
     return static_cast<EncodingType::Enum>(encodingType);
 }
 
+inline void EventHeaderUtil::setPutEventCompressionAlgorithmType(
+    EventHeader*                         eventHeader,
+    bmqt::CompressionAlgorithmType::Enum type)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventHeader->type() == EventType::e_PUT);
+    BSLS_ASSERT_SAFE(
+        type >= bmqt::CompressionAlgorithmType::k_LOWEST_SUPPORTED_TYPE &&
+        type <= bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE);
+
+    unsigned char typeSpecific = eventHeader->typeSpecific();
+
+    // Reset the bits for compression algorithm type
+    typeSpecific &= ~k_PUT_EVENT_COMPRESSION_MASK;
+
+    // Set those bits to represent 'type'
+    typeSpecific |= (type << k_PUT_EVENT_COMPRESSION_START_IDX);
+
+    eventHeader->setTypeSpecific(typeSpecific);
+}
+
+inline bmqt::CompressionAlgorithmType::Enum
+EventHeaderUtil::putEventCompressionAlgorithmType(
+    const EventHeader& eventHeader)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventHeader.type() == EventType::e_PUT);
+
+    const unsigned char typeSpecific = eventHeader.typeSpecific();
+    const int type = (typeSpecific & k_PUT_EVENT_COMPRESSION_MASK) >>
+                     k_PUT_EVENT_COMPRESSION_START_IDX;
+    return static_cast<bmqt::CompressionAlgorithmType::Enum>(type);
+}
+
 // -------------------
 // struct OptionHeader
 // -------------------
@@ -1706,6 +1706,8 @@ static void test7_eventHeaderUtil()
 // Testing:
 //   EventHeaderUtil::setControlEventEncodingType
 //   EventHeaderUtil::controlEventEncodingType
+//   EventHeaderUtil::setPutEventCompressionAlgorithmType
+//   EventHeaderUtil::putEventCompressionAlgorithmType
 // --------------------------------------------------------------------
 {
     mwctst::TestHelper::printTestName("EVENT HEADER UTIL");
@@ -1741,6 +1743,47 @@ static void test7_eventHeaderUtil()
                 bmqp::EventHeaderUtil::controlEventEncodingType(eventHeader));
         }
     }
+
+    PV("Test bmqp::EventHeaderUtil setPutEventCompressionAlgorithmType");
+    {
+        struct Test {
+            int                                  d_line;
+            bmqt::CompressionAlgorithmType::Enum d_value;
+        } k_DATA[] = {
+            {L_, bmqt::CompressionAlgorithmType::e_ZSTD},
+            {L_, bmqt::CompressionAlgorithmType::e_LZ4},
+            {L_, bmqt::CompressionAlgorithmType::e_ZLIB},
+            {L_, bmqt::CompressionAlgorithmType::e_NONE},
+        };
+
+        const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+        bmqp::EventHeader eventHeader(bmqp::EventType::e_PUT);
+        ASSERT_EQ(bmqt::CompressionAlgorithmType::e_NONE,
+                  bmqp::EventHeaderUtil::putEventCompressionAlgorithmType(
+                      eventHeader));
+
+        // Set each compression algorithm type in succession, and ensure that
+        // the type returned is always the one last set
+        for (size_t idx = 0; idx != k_NUM_DATA; ++idx) {
+            const Test& test = k_DATA[idx];
+
+            // 1. Set the compression algorithm type
+            PVV(test.d_line << ": Testing: "
+                            << "EventHeaderUtil::"
+                            << "setPutEventCompressionAlgorithmType("
+                            << test.d_value << ")");
+            bmqp::EventHeaderUtil::setPutEventCompressionAlgorithmType(
+                &eventHeader,
+                test.d_value);
+
+            // 2. Verify that the intended compression algorithm type is set
+            ASSERT_EQ_D(test.d_line,
+                        test.d_value,
+                        bmqp::EventHeaderUtil::
+                            putEventCompressionAlgorithmType(eventHeader));
+        }
+    }
 }
 // ============================================================================
 //                                 MAIN PROGRAM
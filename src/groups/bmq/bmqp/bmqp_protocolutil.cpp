@@ -19,6 +19,7 @@
 #include <bmqscm_version.h>
 // BMQ
 #include <bmqp_compression.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_queueid.h>
 #include <bmqt_queueflags.h>
 
@@ -175,6 +176,9 @@ void ProtocolUtil::initialize(bslma::Allocator* allocator)
         1,
         SubQueueInfo(Protocol::k_DEFAULT_SUBSCRIPTION_ID),
         alloc);
+
+    // Create the registry of compression dictionaries
+    CompressionDictionaryUtil::initialize(alloc);
 }
 
 void ProtocolUtil::shutdown()
@@ -188,6 +192,8 @@ void ProtocolUtil::shutdown()
         return;  // RETURN
     }
 
+    CompressionDictionaryUtil::shutdown();
+
     g_defaultSubQueueInfoArray.object()
         .mwcc::Array<SubQueueInfo, 16>::Array::~Array();
     // Above expression, particularly the 'Array::' before '~Array()' is
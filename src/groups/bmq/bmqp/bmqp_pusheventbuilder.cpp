@@ -25,6 +25,7 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstring.h>
+#include <bsl_memory.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslmf_assert.h>
@@ -113,11 +114,36 @@ bmqt::EventBuilderResult::Enum PushEventBuilder::packMessageImp(
 
     d_currPushHeader.reset();  // i.e., flush writing to blob..
 
-    // Add the payload
+    // Set aside the capacity left in the buffer holding the headers, so that
+    // it can be reused for the padding and the headers of the next message.
+    bdlbb::BlobBuffer spareBuffer;
+    const bdlbb::BlobBuffer& headerBuffer = d_blob.buffer(
+        d_blob.numDataBuffers() - 1);
+    const int headerBufferLength = d_blob.lastDataBufferLength();
+    if (headerBuffer.size() > headerBufferLength) {
+        spareBuffer.reset(
+            bsl::shared_ptr<char>(headerBuffer.buffer(),
+                                  headerBuffer.data() + headerBufferLength),
+            headerBuffer.size() - headerBufferLength);
+    }
+
+    // Add the payload.  Its buffers are appended by reference, and the same
+    // payload may concurrently be packed in other events (one per consumer
+    // of the message) or alias a read-only mapped file: the builder must
+    // therefore never write to them, including to their spare capacity.
     bdlbb::BlobUtil::append(&d_blob, payload);
+    d_blob.trimLastDataBuffer();
+    if (spareBuffer.size() != 0) {
+        d_blob.appendBuffer(spareBuffer);
+    }
 
-    // Add padding
-    ProtocolUtil::appendPadding(&d_blob, payloadLen);
+    // Add padding, which lands in the spare buffer (or in a new one from the
+    // factory) since the last data buffer has been trimmed.
+    char               padding[Protocol::k_WORD_SIZE];
+    mwcu::BlobPosition paddingPos;
+    ProtocolUtil::appendPaddingRaw(padding, numPaddingBytes);
+    mwcu::BlobUtil::reserve(&paddingPos, &d_blob, numPaddingBytes);
+    mwcu::BlobUtil::writeBytes(&d_blob, paddingPos, padding, numPaddingBytes);
 
     d_options.reset();
     ++d_msgCount;
@@ -33,6 +33,17 @@
 // Each message added to the PushEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Payload Sharing
+///---------------
+// The payload of a message is not copied into the event: the event refers to
+// the buffers of the payload blob, so that the same payload can be packed in
+// many events (e.g., one per consumer of a message) at no extra cost.  The
+// builder never writes to those buffers, not even to the capacity left past
+// the end of the payload, which makes it safe to pack concurrently (from
+// different builders) the same payload, or a payload aliasing a read-only
+// region such as a memory-mapped file.  Padding and the headers of the next
+// message are written to buffers owned by the builder.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
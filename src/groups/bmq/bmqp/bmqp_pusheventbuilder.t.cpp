@@ -1088,6 +1088,98 @@ static void test8_buildEventTooBig()
     ASSERT_EQ(1, peb.messageCount());
 }
 
+static void test9_buildEventSharesPayload()
+// --------------------------------------------------------------------
+// BUILD EVENT SHARES PAYLOAD
+//
+// Concerns:
+//   - The payload packed in an event is not copied: the event refers to
+//     the buffers of the payload blob.
+//   - The builder never writes to the payload buffers, including to the
+//     capacity left past the end of the payload, so that the same payload
+//     can be packed in several events (e.g., one per consumer of a
+//     message).
+//
+// Testing:
+//   packMessage(const bdlbb::Blob& payload, ...)
+// --------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BUILD EVENT SHARES PAYLOAD");
+
+    const char k_PAYLOAD[]   = "hello world!!";
+    const int  k_PAYLOAD_LEN = sizeof(k_PAYLOAD) - 1;
+    const int  k_BUFFER_SIZE = 64;
+    const char k_FILLER      = 'X';
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bdlbb::PooledBlobBufferFactory payloadFactory(k_BUFFER_SIZE,
+                                                  s_allocator_p);
+
+    // Payload occupying the beginning of a single buffer, with the rest of
+    // the buffer set to a known value.
+    bdlbb::Blob payload(&payloadFactory, s_allocator_p);
+    payload.setLength(k_PAYLOAD_LEN);
+    ASSERT_EQ(1, payload.numDataBuffers());
+    char* payloadData = payload.buffer(0).data();
+    bsl::memset(payloadData, k_FILLER, k_BUFFER_SIZE);
+    bsl::memcpy(payloadData, k_PAYLOAD, k_PAYLOAD_LEN);
+
+    // Pack the same payload, several times, in several events
+    bmqp::PushEventBuilder peb1(&bufferFactory, s_allocator_p);
+    bmqp::PushEventBuilder peb2(&bufferFactory, s_allocator_p);
+    bmqp::PushEventBuilder* builders[] = {&peb1, &peb2};
+    const int               k_NUM_MSGS = 3;
+
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < k_NUM_MSGS; ++j) {
+            ASSERT_EQ_D(j,
+                        bmqt::EventBuilderResult::e_SUCCESS,
+                        builders[i]->packMessage(
+                            payload,
+                            j,
+                            bmqt::MessageGUID(),
+                            0,
+                            bmqt::CompressionAlgorithmType::e_NONE));
+        }
+    }
+
+    // The buffer of the payload is untouched past the payload
+    for (int k = k_PAYLOAD_LEN; k < k_BUFFER_SIZE; ++k) {
+        ASSERT_EQ_D(k, k_FILLER, payloadData[k]);
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        const bdlbb::Blob& eventBlob = builders[i]->blob();
+
+        // The payload buffer is referred to, not copied
+        int numAliases = 0;
+        for (int k = 0; k < eventBlob.numDataBuffers(); ++k) {
+            if (eventBlob.buffer(k).data() == payloadData) {
+                ++numAliases;
+            }
+        }
+        ASSERT_EQ_D(i, k_NUM_MSGS, numAliases);
+
+        bmqp::Event rawEvent(&eventBlob, s_allocator_p);
+        ASSERT_EQ_D(i, true, rawEvent.isPushEvent());
+
+        bmqp::PushMessageIterator pushIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPushMessageIterator(&pushIter, true);
+        ASSERT_EQ_D(i, true, pushIter.isValid());
+
+        int msgCount = 0;
+        while (pushIter.next() == 1) {
+            ASSERT_EQ_D(i, msgCount, pushIter.header().queueId());
+
+            bdlbb::Blob payloadBlob(s_allocator_p);
+            ASSERT_EQ_D(i, 0, pushIter.loadMessagePayload(&payloadBlob));
+            ASSERT_EQ_D(i, 0, bdlbb::BlobUtil::compare(payloadBlob, payload));
+            ++msgCount;
+        }
+        ASSERT_EQ_D(i, k_NUM_MSGS, msgCount);
+    }
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -1232,6 +1324,7 @@ int main(int argc, char* argv[])
     //                  encoding RDA counters.
     switch (_testCase) {
     case 0:
+    case 9: test9_buildEventSharesPayload(); break;
     case 8: test8_buildEventTooBig(); break;
     case 7: test7_buildEventOptionTooBig(); break;
     case 6: test6_buildEventWithImplicitPayload(); break;
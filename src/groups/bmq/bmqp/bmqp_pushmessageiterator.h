@@ -297,6 +297,15 @@ class PushMessageIterator {
     /// return size of compressed application data without padding.
     int applicationDataSize() const;
 
+    /// Return a reference offering non-modifiable access to the application
+    /// data of the message currently pointed to by this iterator, starting
+    /// with its message properties, if any, at offset 0.  Behavior is
+    /// undefined unless latest call to `next()` returned 1 and
+    /// `d_decompressFlag` is true.  Note that the returned blob is valid
+    /// until the next call to `next()`, and allows reading properties in
+    /// place (see `MessagePropertiesView`).
+    const bdlbb::Blob& applicationData() const;
+
     /// Load into the specified `position` the position of the application
     /// data for the message currently pointed to by this iterator.  Return
     /// zero on success, non-zero value in case of error or if application
@@ -533,6 +542,15 @@ inline bool PushMessageIterator::hasOptions() const
     return d_optionsSize > 0;
 }
 
+inline const bdlbb::Blob& PushMessageIterator::applicationData() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_decompressFlag);
+
+    return d_applicationData;
+}
+
 inline int PushMessageIterator::messagePropertiesSize() const
 {
     // PRECONDITIONS
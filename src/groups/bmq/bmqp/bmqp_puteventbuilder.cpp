@@ -29,6 +29,7 @@
 #include <mwcu_memoutstream.h>
 
 // BDE
+#include <ball_log.h>
 #include <bdlb_scopeexit.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
@@ -42,6 +43,9 @@ namespace BloombergLP {
 namespace bmqp {
 
 namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("BMQP.PUTEVENTBUILDER");
+
 #ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
 bool isWordAligned(const bdlbb::Blob& blob)
 {
@@ -60,6 +64,11 @@ void PutEventBuilder::resetFields(void* ptr)
     builder->d_flags         = 0;
     builder->d_messageGUID   = bmqt::MessageGUID();
     builder->d_crc32c        = 0;
+
+    // Only the storage of the scratch blobs is meant to be reused, not the
+    // buffers they refer to.
+    builder->d_payload.removeAll();
+    builder->d_applicationData.removeAll();
 }
 
 bmqt::EventBuilderResult::Enum
@@ -157,6 +166,41 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     return Result::e_SUCCESS;
 }
 
+int PutEventBuilder::compressPayload(bdlbb::Blob*       output,
+                                     const bdlbb::Blob& input,
+                                     bsl::ostream*      errorStream)
+{
+    if (d_compressionDictionary_p &&
+        d_compressionAlgorithmType == bmqt::CompressionAlgorithmType::e_ZSTD) {
+        // A null level selects the default zstd level (0)
+        return Compression::compress(output,
+                                     d_bufferFactory_p,
+                                     d_compressionAlgorithmType,
+                                     d_compressionLevel.valueOr(0),
+                                     d_compressionDictionary_p,
+                                     input,
+                                     errorStream,
+                                     d_allocator_p);  // RETURN
+    }
+
+    if (d_compressionLevel.isNull()) {
+        return Compression::compress(output,
+                                     d_bufferFactory_p,
+                                     d_compressionAlgorithmType,
+                                     input,
+                                     errorStream,
+                                     d_allocator_p);  // RETURN
+    }
+
+    return Compression::compress(output,
+                                 d_bufferFactory_p,
+                                 d_compressionAlgorithmType,
+                                 d_compressionLevel.value(),
+                                 input,
+                                 errorStream,
+                                 d_allocator_p);
+}
+
 PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
                                  bslma::Allocator*         allocator)
 : d_bufferFactory_p(bufferFactory)
@@ -172,8 +216,12 @@ PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 , d_msgCount(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_compressionLevel()
+, d_compressionDictionary_p(0)
 , d_lastPackedMessageCompressionRatio(-1)
 , d_messagePropertiesInfo()
+, d_payload(bufferFactory, allocator)
+, d_applicationData(bufferFactory, allocator)
 , d_allocator_p(allocator)
 {
     reset();
@@ -194,6 +242,8 @@ int PutEventBuilder::reset()
     d_crc32c                            = 0;
     d_lastPackedMessageCompressionRatio = -1;
     d_messagePropertiesInfo             = MessagePropertiesInfo();
+    d_payload.removeAll();
+    d_applicationData.removeAll();
 
     // NOTE: Since PutEventBuilder owns the blob and we just reset it, we have
     //       guarantee that buffer(0) will contain the entire header (unless
@@ -226,7 +276,8 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
 
     // Calculate length of entire application data (includes payload, message
     // properties and padding, if any).
-    bdlbb::Blob applicationData(d_bufferFactory_p, d_allocator_p);
+    bdlbb::Blob& applicationData = d_applicationData;
+    BSLS_ASSERT_SAFE(0 == applicationData.length());
 
     const bdlbb::Blob* propertiesBlob = 0;
     if (d_properties_p && 0 != d_properties_p->numProperties()) {
@@ -264,12 +315,16 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
                                               d_allocator_p);
         mwcu::MemOutStream error(d_allocator_p);
 
-        int rc = Compression::compress(&compressedApplicationData,
-                                       d_bufferFactory_p,
-                                       d_compressionAlgorithmType,
-                                       applicationData,
-                                       &error,
-                                       d_allocator_p);
+        int rc = compressPayload(&compressedApplicationData,
+                                 applicationData,
+                                 &error);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_WARN << "Failed to compress message with '"
+                          << d_compressionAlgorithmType
+                          << "', sending it uncompressed [rc: " << rc
+                          << ", error: '" << error.str() << "']";
+        }
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
                 rc == Result::e_SUCCESS && compressedApplicationData.length() <
                                                applicationData.length())) {
@@ -313,10 +368,14 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
     bdlb::ScopeExitAny resetter(f);
 
     // Calculate length of entire application data (includes payload, message
-    // properties and padding, if any).
-    bdlbb::Blob        bufferBlob(d_bufferFactory_p, d_allocator_p);
-    bdlbb::Blob        resultBlob(d_bufferFactory_p, d_allocator_p);
+    // properties and padding, if any).  The scratch blobs are reused from one
+    // message to the next, so that packing a message doesn't allocate once
+    // their storage has grown to fit.
+    bdlbb::Blob&       bufferBlob  = d_payload;
+    bdlbb::Blob&       resultBlob  = d_applicationData;
     const bdlbb::Blob* payloadBlob = d_blobPayload_p;
+    BSLS_ASSERT_SAFE(0 == bufferBlob.length());
+    BSLS_ASSERT_SAFE(0 == resultBlob.length());
 
     if (d_properties_p && 0 != d_properties_p->numProperties()) {
         // Note that '0 != d_properties_p->numProperties()' check is required
@@ -329,12 +388,10 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
                 MessagePropertiesInfo::makeInvalidSchema();
         }
 
-        // propertiesBlob include 6 byte mph along with properties
-        const bdlbb::Blob& propertiesBlob = d_properties_p->streamOut(
-            d_bufferFactory_p,
-            d_messagePropertiesInfo);
-
-        bdlbb::BlobUtil::append(&resultBlob, propertiesBlob);
+        // Encode the properties, including the 6 byte mph, directly into the
+        // application data instead of into the cache of 'd_properties_p',
+        // which would have to be rebuilt each time the properties change.
+        d_properties_p->streamOut(&resultBlob, d_messagePropertiesInfo);
     }
     else {
         BSLS_ASSERT_SAFE(!d_messagePropertiesInfo.isPresent());
@@ -351,18 +408,32 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
         payloadBlob = d_blobPayload_p;
     }
 
-    // Compress
-    if (payloadBlob->length() >= Protocol::k_COMPRESSION_MIN_APPDATA_SIZE &&
+    // Compress.  A compression dictionary makes compressing small payloads
+    // worthwhile; use it unless another algorithm was explicitly requested.
+    int minCompressionSize = Protocol::k_COMPRESSION_MIN_APPDATA_SIZE;
+    if (d_compressionDictionary_p &&
+        (d_compressionAlgorithmType ==
+             bmqt::CompressionAlgorithmType::e_NONE ||
+         d_compressionAlgorithmType ==
+             bmqt::CompressionAlgorithmType::e_ZSTD)) {
+        d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_ZSTD;
+        minCompressionSize =
+            Protocol::k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE;
+    }
+
+    if (payloadBlob->length() >= minCompressionSize &&
         d_compressionAlgorithmType != bmqt::CompressionAlgorithmType::e_NONE) {
         bdlbb::Blob compressedPayloadBlob(d_bufferFactory_p, d_allocator_p);
         mwcu::MemOutStream error(d_allocator_p);
 
-        int rc = Compression::compress(&compressedPayloadBlob,
-                                       d_bufferFactory_p,
-                                       d_compressionAlgorithmType,
-                                       *payloadBlob,
-                                       &error,
-                                       d_allocator_p);
+        int rc = compressPayload(&compressedPayloadBlob, *payloadBlob, &error);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_WARN << "Failed to compress message with '"
+                          << d_compressionAlgorithmType
+                          << "', sending it uncompressed [rc: " << rc
+                          << ", error: '" << error.str() << "']";
+        }
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
                 rc == Result::e_SUCCESS &&
                 compressedPayloadBlob.length() < payloadBlob->length())) {
@@ -62,6 +62,7 @@
 
 // BMQ
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
 #include <bmqt_compressionalgorithmtype.h>
@@ -71,6 +72,7 @@
 // BDE
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
+#include <bsl_ostream.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -150,6 +152,17 @@ class PutEventBuilder {
     // current message's payload (the
     // user sets it explicitly)
 
+    bdlb::NullableValue<int> d_compressionLevel;
+    // Algorithm specific compression
+    // level of the current message's
+    // payload, or null to use the
+    // default level of the algorithm
+
+    const CompressionDictionary* d_compressionDictionary_p;
+    // Compression dictionary of the
+    // queue of the current message, if
+    // any.
+
     double d_lastPackedMessageCompressionRatio;
     // Compression ratio of the last
     // packed message, or -1 if no
@@ -159,6 +172,21 @@ class PutEventBuilder {
 
     MessagePropertiesInfo d_messagePropertiesInfo;
 
+    bdlbb::Blob d_payload;
+    // Scratch blob holding a copy of the
+    // raw payload of the current message
+    // while it is packed.  Kept as a member
+    // so that its storage is reused across
+    // messages.
+
+    bdlbb::Blob d_applicationData;
+    // Scratch blob holding the
+    // application data (properties and
+    // payload) of the current message
+    // while it is packed.  Kept as a member
+    // so that its storage is reused across
+    // messages.
+
     bslma::Allocator* d_allocator_p;
 
   private:
@@ -172,13 +200,22 @@ class PutEventBuilder {
     // CLASS LEVEL METHODS
 
     /// Reset flags and message guid of PutEventBuilder instance pointed by
-    /// the specified `ptr`.
+    /// the specified `ptr`, and release the buffers held by its scratch
+    /// blobs.
     static void resetFields(void* ptr);
 
     // PRIVATE MANIPULATORS
     bmqt::EventBuilderResult::Enum
     packMessageInternal(const bdlbb::Blob& appData, int queueId);
 
+    /// Compress the specified `input` into the specified `output` using the
+    /// compression algorithm type and level of the current message.  Return
+    /// 0 on success and non-zero otherwise, in which case details are
+    /// written to the specified `errorStream`.
+    int compressPayload(bdlbb::Blob*       output,
+                        const bdlbb::Blob& input,
+                        bsl::ostream*      errorStream);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(PutEventBuilder, bslma::UsesBslmaAllocator)
@@ -246,6 +283,31 @@ class PutEventBuilder {
     PutEventBuilder&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
 
+    /// Set the algorithm specific compression level of the current message
+    /// to the specified `value` and return a reference offering modifiable
+    /// access to this object.  The behavior is undefined at `packMessage`
+    /// time unless `value` is within the range supported by the compression
+    /// algorithm type of the current message (see `bmqp::Compression_Impl`).
+    /// Note that if this method is not invoked, the default level of the
+    /// algorithm is used.
+    PutEventBuilder& setCompressionLevel(int value);
+
+    /// Reset the compression level of the current message, so that the
+    /// default level of its compression algorithm type is used, and return
+    /// a reference offering modifiable access to this object.
+    PutEventBuilder& resetCompressionLevel();
+
+    /// Set the compression dictionary of the current message to the
+    /// specified `value` and return a reference offering modifiable access
+    /// to this object.  If `value` is not 0, and the compression algorithm
+    /// type of the current message is either `e_NONE` or `e_ZSTD`, its
+    /// payload is compressed with `e_ZSTD` using `value` when it is at
+    /// least `Protocol::k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE` bytes
+    /// long.  The behavior is undefined unless `value`, if not 0, is loaded
+    /// and remains valid until the current message is packed.
+    PutEventBuilder&
+    setCompressionDictionary(const CompressionDictionary* value);
+
     /// Set the knowledge about MessageProperties presence and their Schema
     /// Id in the current message to the specified `value` and return a
     /// reference offering modifiable access to this object.
@@ -322,6 +384,14 @@ class PutEventBuilder {
     /// bmqt::CompressionAlgorithmType::e_NONE will be returned.
     bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
 
+    /// Return the compression level of the current message, or a null value
+    /// if `setCompressionLevel` has not been invoked.
+    const bdlb::NullableValue<int>& compressionLevel() const;
+
+    /// Return the compression dictionary of the current message, or 0 if
+    /// none was set.
+    const CompressionDictionary* compressionDictionary() const;
+
     /// Return the compression ratio of the last packed message, or -1 if no
     /// message was yet packed.  Note that compression ratio is computed by
     /// dividing the original message size, by its compressed one.  If the
@@ -436,6 +506,25 @@ inline PutEventBuilder& PutEventBuilder::setCompressionAlgorithmType(
     return *this;
 }
 
+inline PutEventBuilder& PutEventBuilder::setCompressionLevel(int value)
+{
+    d_compressionLevel.makeValue(value);
+    return *this;
+}
+
+inline PutEventBuilder& PutEventBuilder::resetCompressionLevel()
+{
+    d_compressionLevel.reset();
+    return *this;
+}
+
+inline PutEventBuilder&
+PutEventBuilder::setCompressionDictionary(const CompressionDictionary* value)
+{
+    d_compressionDictionary_p = value;
+    return *this;
+}
+
 inline PutEventBuilder&
 PutEventBuilder::setMessagePropertiesInfo(const MessagePropertiesInfo& value)
 {
@@ -468,6 +557,8 @@ inline void PutEventBuilder::startMessage()
     d_flags                    = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
     d_messageGUID              = bmqt::MessageGUID();
+    d_compressionLevel.reset();
+    d_compressionDictionary_p = 0;
     d_msgGroupId.reset();
     d_crc32c                = 0;
     d_messagePropertiesInfo = MessagePropertiesInfo();
@@ -520,6 +611,18 @@ PutEventBuilder::compressionAlgorithmType() const
     return d_compressionAlgorithmType;
 }
 
+inline const bdlb::NullableValue<int>&
+PutEventBuilder::compressionLevel() const
+{
+    return d_compressionLevel;
+}
+
+inline const CompressionDictionary*
+PutEventBuilder::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
 inline double PutEventBuilder::lastPackedMesageCompressionRatio() const
 {
     return d_lastPackedMessageCompressionRatio;
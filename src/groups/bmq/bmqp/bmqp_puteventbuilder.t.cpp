@@ -18,6 +18,7 @@
 
 // BMQ
 #include <bmqp_compression.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_crc32c.h>
 #include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
@@ -46,6 +47,7 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bslma_default.h>
+#include <bslma_testallocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -2247,6 +2249,278 @@ static void test7_multiplePackMessage()
     ASSERT_EQ(false, putIter.isValid());
 }
 
+static void test8_packMessageWithCompressionDictionary()
+// ------------------------------------------------------------------------
+// PACK MESSAGE WITH COMPRESSION DICTIONARY
+//
+// Concerns:
+//   1. A small message, below 'k_COMPRESSION_MIN_APPDATA_SIZE', is
+//      compressed with 'e_ZSTD' when a compression dictionary is set and
+//      no compression algorithm was requested.
+//   2. An explicitly requested algorithm other than 'e_ZSTD' is honored.
+//   3. The compressed message can be decompressed once the dictionary is
+//      registered.
+//
+// Testing:
+//   bmqp::PutEventBuilder::setCompressionDictionary()
+//   bmqp::PutEventBuilder::packMessage()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "PACK MESSAGE WITH COMPRESSION DICTIONARY");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    const int                      k_QID = 1;
+
+    // Small, similar, messages.
+    bsl::vector<bdlbb::Blob> samples(s_allocator_p);
+    int                      seed = 1;
+    for (int i = 0; i < 2000; ++i) {
+        const int          value = bdlb::Random::generate15(&seed);
+        mwcu::MemOutStream os(s_allocator_p);
+        os << "{\"id\":" << value << ",\"side\":\""
+           << ((value % 2) ? "BUY" : "SELL") << "\",\"price\":" << value % 1000
+           << ",\"quantity\":" << value % 997 << ",\"account\":\"ACC-"
+           << value % 50 << "\"}";
+
+        bdlbb::Blob sample(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&sample, os.str().data(), os.str().length());
+        samples.push_back(sample);
+    }
+
+    mwcu::MemOutStream error(s_allocator_p);
+    bsl::vector<char>  data(s_allocator_p);
+    int rc = bmqp::CompressionDictionaryUtil::train(&data,
+                                                    samples,
+                                                    1,
+                                                    4 * 1024,
+                                                    &error);
+    ASSERT_EQ_D(error.str(), rc, 0);
+
+    bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+    dictionary.createInplace(s_allocator_p, s_allocator_p);
+    rc = dictionary->load(data.data(), data.size(), &error);
+    ASSERT_EQ_D(error.str(), rc, 0);
+    ASSERT_EQ(bmqp::CompressionDictionaryUtil::registerDictionary(&dictionary),
+              0);
+
+    // Payload of four samples, too small to be compressed without a
+    // dictionary.
+    bdlbb::Blob payload(&bufferFactory, s_allocator_p);
+    for (int i = 0; i < 4; ++i) {
+        bdlbb::BlobUtil::append(&payload, samples[i]);
+    }
+    BSLS_ASSERT_OPT(payload.length() <
+                    bmqp::Protocol::k_COMPRESSION_MIN_APPDATA_SIZE);
+    BSLS_ASSERT_OPT(payload.length() >=
+                    bmqp::Protocol::k_COMPRESSION_DICTIONARY_MIN_APPDATA_SIZE);
+
+    struct Test {
+        int                                  d_line;
+        bmqt::CompressionAlgorithmType::Enum d_requested;
+        bool                                 d_hasDictionary;
+        bmqt::CompressionAlgorithmType::Enum d_expected;
+    } k_DATA[] = {
+        {L_,
+         bmqt::CompressionAlgorithmType::e_NONE,
+         false,
+         bmqt::CompressionAlgorithmType::e_NONE},
+        {L_,
+         bmqt::CompressionAlgorithmType::e_NONE,
+         true,
+         bmqt::CompressionAlgorithmType::e_ZSTD},
+        {L_,
+         bmqt::CompressionAlgorithmType::e_ZSTD,
+         true,
+         bmqt::CompressionAlgorithmType::e_ZSTD},
+        {L_,
+         bmqt::CompressionAlgorithmType::e_ZLIB,
+         true,
+         bmqt::CompressionAlgorithmType::e_NONE},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": requested: " << test.d_requested
+                        << ", dictionary: " << test.d_hasDictionary);
+
+        bmqp::PutEventBuilder obj(&bufferFactory, s_allocator_p);
+
+        obj.startMessage();
+        obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        obj.setMessagePayload(&payload);
+        obj.setCompressionAlgorithmType(test.d_requested);
+        if (test.d_hasDictionary) {
+            obj.setCompressionDictionary(dictionary.get());
+        }
+
+        ASSERT_EQ_D(test.d_line,
+                    obj.packMessage(k_QID),
+                    bmqt::EventBuilderResult::e_SUCCESS);
+
+        bmqp::Event rawEvent(&obj.blob(), s_allocator_p);
+        BSLS_ASSERT_OPT(rawEvent.isPutEvent());
+
+        bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPutMessageIterator(&putIter, true);
+
+        ASSERT_EQ_D(test.d_line, putIter.next(), 1);
+        ASSERT_EQ_D(test.d_line,
+                    putIter.header().compressionAlgorithmType(),
+                    test.d_expected);
+
+        bdlbb::Blob payloadBlob(&bufferFactory, s_allocator_p);
+        ASSERT_EQ_D(test.d_line, putIter.loadMessagePayload(&payloadBlob), 0);
+        ASSERT_EQ_D(test.d_line,
+                    bdlbb::BlobUtil::compare(payloadBlob, payload),
+                    0);
+    }
+}
+
+static void test9_steadyStateAllocations()
+// ------------------------------------------------------------------------
+// STEADY STATE ALLOCATIONS
+//
+// Concerns:
+//   1. Once warmed up, building events of messages having a raw payload
+//      and properties, and resetting the builder between events, does not
+//      allocate memory.
+//   2. The properties of the messages are correctly encoded.
+//
+// Plan:
+//   1. Build a few events to warm up the builder and its buffer factory.
+//   2. Build more events, and verify that neither the builder nor the
+//      buffer factory allocated memory.
+//
+// Testing:
+//   bmqp::PutEventBuilder::packMessage()
+//   bmqp::PutEventBuilder::reset()
+//   bmqp::MessageProperties::streamOut(bdlbb::Blob *, ...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("STEADY STATE ALLOCATIONS");
+
+    const int  k_QID            = 1;
+    const int  k_NUM_MESSAGES   = 16;
+    const int  k_NUM_WARMUP     = 4;
+    const int  k_NUM_EVENTS     = 64;
+    const char k_PAYLOAD[]      = "abcdefghijklmnopqrstuvwxyz";
+    const int  k_PAYLOAD_LENGTH = bsl::strlen(k_PAYLOAD);
+
+    bslma::TestAllocator testAllocator("test");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, &testAllocator);
+    bmqp::PutEventBuilder          obj(&bufferFactory, &testAllocator);
+
+    bmqp::MessageProperties properties(s_allocator_p);
+    ASSERT_EQ(0, properties.setPropertyAsInt32("encoding", 3));
+    ASSERT_EQ(0, properties.setPropertyAsString("id", "foo"));
+
+    bsls::Types::Int64 numAllocations = 0;
+
+    for (int evt = 0; evt < k_NUM_WARMUP + k_NUM_EVENTS; ++evt) {
+        if (evt == k_NUM_WARMUP) {
+            numAllocations = testAllocator.numAllocations();
+        }
+
+        obj.reset();
+
+        for (int msg = 0; msg < k_NUM_MESSAGES; ++msg) {
+            obj.startMessage();
+            obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+            obj.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LENGTH);
+            obj.setMessageProperties(&properties);
+
+            ASSERT_EQ(obj.packMessage(k_QID),
+                      bmqt::EventBuilderResult::e_SUCCESS);
+        }
+
+        ASSERT_EQ(obj.messageCount(), k_NUM_MESSAGES);
+        ASSERT_LT(0, obj.blob().length());
+    }
+
+    ASSERT_EQ(testAllocator.numAllocations(), numAllocations);
+
+    // Verify the content of the last event
+    bmqp::Event rawEvent(&obj.blob(), s_allocator_p);
+    BSLS_ASSERT_OPT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    rawEvent.loadPutMessageIterator(&putIter, true);
+
+    int count = 0;
+    while (putIter.next() == 1) {
+        ++count;
+
+        bmqp::MessageProperties decoded(s_allocator_p);
+        ASSERT_EQ(putIter.hasMessageProperties(), true);
+        ASSERT_EQ(putIter.loadMessageProperties(&decoded), 0);
+        ASSERT_EQ(decoded.numProperties(), 2);
+        ASSERT_EQ(decoded.getPropertyAsInt32("encoding"), 3);
+        ASSERT_EQ(decoded.getPropertyAsString("id"), "foo");
+
+        bdlbb::Blob payloadBlob(&bufferFactory, s_allocator_p);
+        ASSERT_EQ(putIter.loadMessagePayload(&payloadBlob), 0);
+        ASSERT_EQ(payloadBlob.length(), k_PAYLOAD_LENGTH);
+    }
+    ASSERT_EQ(count, k_NUM_MESSAGES);
+}
+
+static void test10_resetCompressionLevel()
+// ------------------------------------------------------------------------
+// RESET COMPRESSION LEVEL
+//
+// Concerns:
+//   1. 'resetCompressionLevel' clears the level set for the current
+//      message.
+//   2. A message whose algorithm was changed to 'e_ZLIB', and whose level
+//      (set for another algorithm) was reset, is compressed with 'e_ZLIB'
+//      at its default level.
+//
+// Testing:
+//   bmqp::PutEventBuilder::resetCompressionLevel()
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RESET COMPRESSION LEVEL");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    const int                      k_QID = 1;
+
+    const bsl::string payload(4096, 'x', s_allocator_p);
+
+    bmqp::PutEventBuilder obj(&bufferFactory, s_allocator_p);
+
+    obj.startMessage();
+    obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    obj.setMessagePayload(payload.data(), static_cast<int>(payload.length()));
+    obj.setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::e_ZSTD);
+    obj.setCompressionLevel(19);  // Out of the range of 'e_ZLIB'
+    ASSERT(!obj.compressionLevel().isNull());
+
+    obj.setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::e_ZLIB);
+    obj.resetCompressionLevel();
+    ASSERT(obj.compressionLevel().isNull());
+
+    ASSERT_EQ(obj.packMessage(k_QID), bmqt::EventBuilderResult::e_SUCCESS);
+
+    bmqp::Event rawEvent(&obj.blob(), s_allocator_p);
+    BSLS_ASSERT_OPT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    rawEvent.loadPutMessageIterator(&putIter, true);
+
+    ASSERT_EQ(putIter.next(), 1);
+    ASSERT_EQ(putIter.header().compressionAlgorithmType(),
+              bmqt::CompressionAlgorithmType::e_ZLIB);
+
+    bdlbb::Blob payloadBlob(&bufferFactory, s_allocator_p);
+    ASSERT_EQ(putIter.loadMessagePayload(&payloadBlob), 0);
+    ASSERT_EQ(payloadBlob.length(), static_cast<int>(payload.length()));
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -2442,6 +2716,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 10: test10_resetCompressionLevel(); break;
+    case 9: test9_steadyStateAllocations(); break;
+    case 8: test8_packMessageWithCompressionDictionary(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
     case 5: test5_putEventWithZeroLengthMessage(); break;
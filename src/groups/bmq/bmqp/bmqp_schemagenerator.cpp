@@ -88,14 +88,21 @@ SchemaGenerator::getSchemaId(const MessageProperties* mps)
     bsl::string                           key(&localAllocator);
 
     while (it.hasNext()) {
-        key += "_" + it.name();
+        // Append piecewise, as a temporary would use the default allocator.
+        key += '_';
+        key += it.name();
     }
 
     typedef bsl::pair<ContextMap::iterator, bool> InsertOrLookup;
 
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
-    InsertOrLookup insertOrLookup = d_contextMap.emplace(key, d_lru.end());
+    // Look the 'key' up before inserting it since, in the steady state, it is
+    // already present, and 'emplace' would first construct a new element.
+    InsertOrLookup insertOrLookup(d_contextMap.find(key), false);
+    if (insertOrLookup.first == d_contextMap.end()) {
+        insertOrLookup = d_contextMap.emplace(key, d_lru.end());
+    }
     const Context& context        = insertOrLookup.first->second;
     SchemaIdType   result         = context.d_id;
     bool           isNew          = insertOrLookup.second;
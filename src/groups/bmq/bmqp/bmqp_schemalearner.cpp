@@ -392,6 +392,52 @@ int SchemaLearner::read(Context&                     context,
     return rc;
 }
 
+int SchemaLearner::read(Context&                     context,
+                        MessagePropertiesView*       view,
+                        const MessagePropertiesInfo& messagePropertiesInfo,
+                        const bdlbb::Blob&           blob)
+{
+    enum RcEnum { rc_SUCCESS = 0, rc_PARSING_ERROR = -1 };
+
+    BSLS_ASSERT_SAFE(view);
+
+    int rc = view->reset(&blob, messagePropertiesInfo.isExtended());
+    if (rc != 0) {
+        return 10 * rc + rc_PARSING_ERROR;  // RETURN
+    }
+
+    SchemaIdType inputSchemaId = messagePropertiesInfo.schemaId();
+
+    if (!isPresentAndValid(inputSchemaId) || view->numProperties() == 0) {
+        // Invalid schema, old style, or nothing to learn
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // Lookup the schema within this source
+    HandlePtr& schemaHandle = context->d_handles[inputSchemaId];
+
+    if (!schemaHandle) {
+        schemaHandle.load(new (*d_allocator_p) SchemaHandle(inputSchemaId),
+                          d_allocator_p);
+    }
+    else if (messagePropertiesInfo.isRecycled()) {
+        // forget the schema
+        schemaHandle->d_schema_sp.reset();
+    }
+
+    if (!schemaHandle->d_schema_sp) {
+        // Learn new schema.
+        rc = view->makeSchema(&schemaHandle->d_schema_sp, d_allocator_p);
+        if (rc != 0) {
+            return 10 * rc + rc_PARSING_ERROR;  // RETURN
+        }
+    }
+
+    view->setSchema(schemaHandle->d_schema_sp);
+
+    return rc_SUCCESS;
+}
+
 // CLASS METHODS
 bool SchemaLearner::isPresentAndValid(SchemaIdType schemaId)
 {
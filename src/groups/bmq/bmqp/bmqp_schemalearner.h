@@ -213,6 +213,18 @@ class SchemaLearner {
              const MessagePropertiesInfo& messagePropertiesInfo,
              const bdlbb::Blob&           blob);
 
+    /// Set up the specified `view` to read Message Properties from the
+    /// specified `blob` in place.  If the sequence of Properties denoted by
+    /// the specified `messagePropertiesInfo` is known, the `view` keeps a
+    /// reference to the schema to locate Properties by index.  Otherwise,
+    /// learn the schema from the `blob`.  Note that, unlike the overload
+    /// above, the Properties are not parsed and the `blob` must outlive the
+    /// use of the `view`.
+    int read(Context&                     context,
+             MessagePropertiesView*       view,
+             const MessagePropertiesInfo& messagePropertiesInfo,
+             const bdlbb::Blob&           blob);
+
     /// Reset previously learned schema accumulated with the specified
     /// `context` and associated with the id in specified `input` if the
     /// `input` indicates recycling.
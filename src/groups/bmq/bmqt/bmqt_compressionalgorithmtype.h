@@ -27,6 +27,8 @@
 //
 //: o !NONE!: No compression algorithm was specified
 //: o !ZLIB!: The compression algorithm is ZLIB
+//: o !ZSTD!: The compression algorithm is Zstandard
+//: o !LZ4!:  The compression algorithm is LZ4 (frame format)
 
 // BMQ
 
@@ -44,7 +46,13 @@ namespace bmqt {
 /// This struct defines various types of compression algorithms.
 struct CompressionAlgorithmType {
     // TYPES
-    enum Enum { e_UNKNOWN = -1, e_NONE = 0, e_ZLIB = 1 };
+    enum Enum {
+        e_UNKNOWN = -1,
+        e_NONE    = 0,
+        e_ZLIB    = 1,
+        e_ZSTD    = 2,
+        e_LZ4     = 3
+    };
 
     // CONSTANTS
 
@@ -56,7 +64,7 @@ struct CompressionAlgorithmType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify that a
     /// header's `CompressionAlgorithmType` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_TYPE = e_ZLIB;
+    static const int k_HIGHEST_SUPPORTED_TYPE = e_LZ4;
 
     // CLASS METHODS
 
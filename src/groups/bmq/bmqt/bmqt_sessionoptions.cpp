@@ -36,6 +36,7 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_numProcessingThreads(1)
 , d_blobBufferSize(4 * 1024)
 , d_channelHighWatermark(128 * 1024 * 1024)
+, d_putEventCompressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
 , d_statsDumpInterval(5 * 60.0)
 , d_connectTimeout(60)
 , d_disconnectTimeout(30)
@@ -45,6 +46,8 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_eventQueueLowWatermark(50)
 , d_eventQueueHighWatermark(2 * 1000)
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueBusyPollDuration(0)
+, d_inlineMessageEventDelivery(false)
 , d_hostHealthMonitor_sp(NULL)
 , d_dtContext_sp(NULL)
 , d_dtTracer_sp(NULL)
@@ -59,6 +62,7 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_numProcessingThreads(other.numProcessingThreads())
 , d_blobBufferSize(other.blobBufferSize())
 , d_channelHighWatermark(other.channelHighWatermark())
+, d_putEventCompressionAlgorithmType(other.putEventCompressionAlgorithmType())
 , d_statsDumpInterval(other.statsDumpInterval())
 , d_connectTimeout(other.connectTimeout())
 , d_disconnectTimeout(other.disconnectTimeout())
@@ -68,6 +72,8 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_eventQueueLowWatermark(other.eventQueueLowWatermark())
 , d_eventQueueHighWatermark(other.eventQueueHighWatermark())
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueBusyPollDuration(other.eventQueueBusyPollDuration())
+, d_inlineMessageEventDelivery(other.inlineMessageEventDelivery())
 , d_hostHealthMonitor_sp(other.hostHealthMonitor())
 , d_dtContext_sp(other.traceContext())
 , d_dtTracer_sp(other.tracer())
@@ -90,6 +96,8 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("numProcessingThreads", d_numProcessingThreads);
     printer.printAttribute("blobBufferSize", d_blobBufferSize);
     printer.printAttribute("channelHighWatermark", d_channelHighWatermark);
+    printer.printAttribute("putEventCompressionAlgorithmType",
+                           d_putEventCompressionAlgorithmType);
     printer.printAttribute("statsDumpInterval",
                            d_statsDumpInterval.totalSecondsAsDouble());
     printer.printAttribute("connectTimeout",
@@ -105,6 +113,11 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("eventQueueLowWatermark", d_eventQueueLowWatermark);
     printer.printAttribute("eventQueueHighWatermark",
                            d_eventQueueHighWatermark);
+    printer.printAttribute(
+        "eventQueueBusyPollDuration",
+        d_eventQueueBusyPollDuration.totalSecondsAsDouble());
+    printer.printAttribute("inlineMessageEventDelivery",
+                           d_inlineMessageEventDelivery);
     printer.printAttribute("hasHostHealthMonitor",
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
@@ -67,6 +67,17 @@
 //:      of this value for control message, so the actual watermark for data
 //:      published is 'channelHighWatermark - 4MB'.
 //:
+//: o !putEventCompressionAlgorithmType!:
+//:      Compression algorithm to apply to the whole body of each PUT event
+//:      sent to the broker (i.e., to all the messages it contains, at
+//:      once), on top of any per-message compression.  Compressing a batch of
+//:      many small messages at once takes advantage of the redundancy across
+//:      these messages, which per-message compression can't, and is
+//:      therefore beneficial to producers posting many small messages over
+//:      bandwidth-limited links.  Default is 'NONE' (i.e., disabled).  Note
+//:      that events are only compressed if the broker supports it, and if
+//:      they are large enough.
+//:
 //: o !statsDumpInterval!:
 //:      Interval (in seconds) at which to dump stats in the logs. Set to 0 to
 //:      disable recurring dump of stats (final stats are always dumped at end
@@ -101,6 +112,39 @@
 //:      'lowWatermark' values to avoid a constant back and forth toggling of
 //:      state resulting from push pop of events.
 //:
+//: o !eventQueueBusyPollDuration!:
+//:      Duration during which each event processing thread keeps polling the
+//:      EventQueue for a new event, first spinning then yielding the CPU in
+//:      between attempts, before blocking on it.  Busy-polling saves the
+//:      cost of waking up a blocked thread (typically a few tens of
+//:      microseconds, and much more in the tail) when events arrive shortly
+//:      after one another, at the expense of keeping the processing threads
+//:      on CPU while idle.  Default is 0 (i.e., processing threads block
+//:      immediately when the EventQueue is empty).  Note that this setting
+//:      has an effect only if providing a 'SessionEventHandler' to the
+//:      session.
+//:
+//: o !inlineMessageEventDelivery!:
+//:      If 'true', PUSH and ACK message events are delivered to the
+//:      'SessionEventHandler' directly from the internal thread decoding
+//:      them, bypassing the EventQueue and the processing threads entirely,
+//:      which removes one thread hand-off from the delivery path.  This mode
+//:      is intended for latency sensitive applications and comes with
+//:      important caveats: the application's 'onMessageEvent' is invoked
+//:      from a thread other than the processing threads, concurrently with
+//:      session events being delivered by these; message events are no
+//:      longer ordered with respect to session and queue events (e.g., a
+//:      PUSH may be delivered before the 'e_QUEUE_OPEN_RESULT' of its
+//:      queue); and, because the internal thread is blocked while the
+//:      handler runs, a slow handler delays all processing of the session,
+//:      including the detection of a slow consumer (the EventQueue
+//:      watermarks do not apply to such events).  Synchronous session
+//:      operations (e.g., 'openQueueSync') must not be invoked from
+//:      'onMessageEvent' in this mode, as they would wait on the very thread
+//:      executing the handler.  Default is 'false'.  Note that this setting
+//:      has an effect only if providing a 'SessionEventHandler' to the
+//:      session.
+//:
 //: o !hostHealthMonitor!:
 //:      Optional instance of a class derived from 'bmqpi::HostHealthMonitor',
 //:      responsible for notifying the 'Session' when the health of the host
@@ -118,6 +162,7 @@
 //
 
 // BMQ
+#include <bmqt_compressionalgorithmtype.h>
 
 // BDE
 #include <bdlt_timeunitratio.h>
@@ -192,6 +237,10 @@ class SessionOptions {
     // Write cache high watermark to use on
     // the channel
 
+    bmqt::CompressionAlgorithmType::Enum d_putEventCompressionAlgorithmType;
+    // Compression algorithm to apply to
+    // the whole body of PUT events.
+
     bsls::TimeInterval d_statsDumpInterval;
     // Interval at which to dump stats to
     // log file (0 to disable dump)
@@ -219,6 +268,15 @@ class SessionOptions {
     // longer relevant and will be removed
     // in future release of libbmq.
 
+    bsls::TimeInterval d_eventQueueBusyPollDuration;
+    // Duration during which processing
+    // threads busy-poll the EventQueue
+    // before blocking on it.
+
+    bool d_inlineMessageEventDelivery;
+    // Whether message events bypass the
+    // EventQueue.
+
     bsl::shared_ptr<bmqpi::HostHealthMonitor> d_hostHealthMonitor_sp;
 
     bsl::shared_ptr<bmqpi::DTContext> d_dtContext_sp;
@@ -258,6 +316,12 @@ class SessionOptions {
     /// `8 * 1024 * 1024 < value`.
     SessionOptions& setChannelHighWatermark(bsls::Types::Int64 value);
 
+    /// Set the compression algorithm to apply to the whole body of PUT
+    /// events to the specified `value`.  The behavior is undefined unless
+    /// `value` is not `e_UNKNOWN`.
+    SessionOptions& setPutEventCompressionAlgorithmType(
+        bmqt::CompressionAlgorithmType::Enum value);
+
     /// Set the statsDumpInterval to the specified `value`. The behavior is
     /// undefined unless `value` is a multiple of 30s and less than 60
     /// minutes.
@@ -307,6 +371,18 @@ class SessionOptions {
     /// The behavior is undefined unless `lowWatermark < highWatermark`.
     SessionOptions& configureEventQueue(int lowWatermark, int highWatermark);
 
+    /// Set the duration during which processing threads busy-poll the
+    /// EventQueue before blocking on it to the specified `value`.  The
+    /// behavior is undefined unless `value` is non-negative.
+    SessionOptions&
+    setEventQueueBusyPollDuration(const bsls::TimeInterval& value);
+
+    /// Set whether message events are delivered to the `SessionEventHandler`
+    /// directly from the internal thread decoding them, bypassing the
+    /// EventQueue, to the specified `value`.  Refer to the component level
+    /// documentation for the caveats of this mode.
+    SessionOptions& setInlineMessageEventDelivery(bool value);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -324,6 +400,11 @@ class SessionOptions {
     /// Get the channel high watermark.
     bsls::Types::Int64 channelHighWatermark() const;
 
+    /// Get the compression algorithm to apply to the whole body of PUT
+    /// events.
+    bmqt::CompressionAlgorithmType::Enum
+    putEventCompressionAlgorithmType() const;
+
     /// Get the stats dump interval.
     const bsls::TimeInterval& statsDumpInterval() const;
 
@@ -357,6 +438,13 @@ class SessionOptions {
     /// in future release of libbmq.
     int eventQueueSize() const;
 
+    /// Get the duration during which processing threads busy-poll the
+    /// EventQueue before blocking on it.
+    const bsls::TimeInterval& eventQueueBusyPollDuration() const;
+
+    /// Get whether message events bypass the EventQueue.
+    bool inlineMessageEventDelivery() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -434,6 +522,16 @@ SessionOptions::setChannelHighWatermark(bsls::Types::Int64 value)
     return *this;
 }
 
+inline SessionOptions& SessionOptions::setPutEventCompressionAlgorithmType(
+    bmqt::CompressionAlgorithmType::Enum value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value != bmqt::CompressionAlgorithmType::e_UNKNOWN);
+
+    d_putEventCompressionAlgorithmType = value;
+    return *this;
+}
+
 inline SessionOptions&
 SessionOptions::setStatsDumpInterval(const bsls::TimeInterval& value)
 {
@@ -521,6 +619,23 @@ inline SessionOptions& SessionOptions::configureEventQueue(int lowWatermark,
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::setEventQueueBusyPollDuration(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0));
+
+    d_eventQueueBusyPollDuration = value;
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::setInlineMessageEventDelivery(bool value)
+{
+    d_inlineMessageEventDelivery = value;
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -547,6 +662,12 @@ inline bsls::Types::Int64 SessionOptions::channelHighWatermark() const
     return d_channelHighWatermark;
 }
 
+inline bmqt::CompressionAlgorithmType::Enum
+SessionOptions::putEventCompressionAlgorithmType() const
+{
+    return d_putEventCompressionAlgorithmType;
+}
+
 inline const bsls::TimeInterval& SessionOptions::statsDumpInterval() const
 {
     return d_statsDumpInterval;
@@ -609,6 +730,17 @@ inline int SessionOptions::eventQueueSize() const
     return d_eventQueueSize;
 }
 
+inline const bsls::TimeInterval&
+SessionOptions::eventQueueBusyPollDuration() const
+{
+    return d_eventQueueBusyPollDuration;
+}
+
+inline bool SessionOptions::inlineMessageEventDelivery() const
+{
+    return d_inlineMessageEventDelivery;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -622,6 +754,8 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.numProcessingThreads() == rhs.numProcessingThreads() &&
            lhs.blobBufferSize() == rhs.blobBufferSize() &&
            lhs.channelHighWatermark() == rhs.channelHighWatermark() &&
+           lhs.putEventCompressionAlgorithmType() ==
+               rhs.putEventCompressionAlgorithmType() &&
            lhs.statsDumpInterval() == rhs.statsDumpInterval() &&
            lhs.connectTimeout() == rhs.connectTimeout() &&
            lhs.openQueueTimeout() == rhs.openQueueTimeout() &&
@@ -629,6 +763,10 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() == rhs.closeQueueTimeout() &&
            lhs.eventQueueLowWatermark() == rhs.eventQueueLowWatermark() &&
            lhs.eventQueueHighWatermark() == rhs.eventQueueHighWatermark() &&
+           lhs.eventQueueBusyPollDuration() ==
+               rhs.eventQueueBusyPollDuration() &&
+           lhs.inlineMessageEventDelivery() ==
+               rhs.inlineMessageEventDelivery() &&
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer();
@@ -641,6 +779,8 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.numProcessingThreads() != rhs.numProcessingThreads() ||
            lhs.blobBufferSize() != rhs.blobBufferSize() ||
            lhs.channelHighWatermark() != rhs.channelHighWatermark() ||
+           lhs.putEventCompressionAlgorithmType() !=
+               rhs.putEventCompressionAlgorithmType() ||
            lhs.statsDumpInterval() != rhs.statsDumpInterval() ||
            lhs.connectTimeout() != rhs.connectTimeout() ||
            lhs.openQueueTimeout() != rhs.openQueueTimeout() ||
@@ -648,6 +788,10 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() != rhs.closeQueueTimeout() ||
            lhs.eventQueueLowWatermark() != rhs.eventQueueLowWatermark() ||
            lhs.eventQueueHighWatermark() != rhs.eventQueueHighWatermark() ||
+           lhs.eventQueueBusyPollDuration() !=
+               rhs.eventQueueBusyPollDuration() ||
+           lhs.inlineMessageEventDelivery() !=
+               rhs.inlineMessageEventDelivery() ||
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer();
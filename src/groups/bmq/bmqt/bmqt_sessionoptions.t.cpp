@@ -57,10 +57,12 @@ static void test2_printTest()
         "[ brokerUri = \"tcp://localhost:30114\" processNameOverride = \"\" "
         "numProcessingThreads = 1 "
         "blobBufferSize = 4096 channelHighWatermark = 134217728 "
+        "putEventCompressionAlgorithmType = NONE "
         "statsDumpInterval = 300 connectTimeout = 60 disconnectTimeout = 30 "
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
-        "eventQueueHighWatermark = 2000 hasHostHealthMonitor = false "
+        "eventQueueHighWatermark = 2000 eventQueueBusyPollDuration = 0 "
+        "inlineMessageEventDelivery = false hasHostHealthMonitor = false "
         "hasDistributedTracing = false ]";
     mwctst::TestHelper::printTestName("PRINT");
     PV("Testing print");
@@ -108,6 +110,15 @@ static void test3_setterGetterAndCopyTest()
     obj.setChannelHighWatermark(channelHighWatermark);
     ASSERT_EQ(obj.channelHighWatermark(), channelHighWatermark);
 
+    PVV("Checking setter and getter for putEventCompressionAlgorithmType");
+    const bmqt::CompressionAlgorithmType::Enum putEventCompressionAlgorithm =
+        bmqt::CompressionAlgorithmType::e_ZSTD;
+    ASSERT_NE(obj.putEventCompressionAlgorithmType(),
+              putEventCompressionAlgorithm);
+    obj.setPutEventCompressionAlgorithmType(putEventCompressionAlgorithm);
+    ASSERT_EQ(obj.putEventCompressionAlgorithmType(),
+              putEventCompressionAlgorithm);
+
     PVV("Checking setter and getter for statsDumpInterval");
     const bsls::TimeInterval statsDumpInterval(6 * 60.0);
     obj.setStatsDumpInterval(statsDumpInterval);
@@ -150,12 +161,25 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(obj.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(obj.eventQueueHighWatermark(), eventQueueHighWatermark);
 
+    PVV("Checking setter and getter for eventQueueBusyPollDuration");
+    const bsls::TimeInterval eventQueueBusyPollDuration(0, 50 * 1000);
+    ASSERT_NE(obj.eventQueueBusyPollDuration(), eventQueueBusyPollDuration);
+    obj.setEventQueueBusyPollDuration(eventQueueBusyPollDuration);
+    ASSERT_EQ(obj.eventQueueBusyPollDuration(), eventQueueBusyPollDuration);
+
+    PVV("Checking setter and getter for inlineMessageEventDelivery");
+    ASSERT(!obj.inlineMessageEventDelivery());
+    obj.setInlineMessageEventDelivery(true);
+    ASSERT(obj.inlineMessageEventDelivery());
+
     PVV("Copy constructor test");
     bmqt::SessionOptions objCopy(obj);
     ASSERT_EQ(objCopy.brokerUri(), brokerUri);
     ASSERT_EQ(objCopy.numProcessingThreads(), numProcessingThreads);
     ASSERT_EQ(objCopy.blobBufferSize(), blobBufferSize);
     ASSERT_EQ(objCopy.channelHighWatermark(), channelHighWatermark);
+    ASSERT_EQ(objCopy.putEventCompressionAlgorithmType(),
+              putEventCompressionAlgorithm);
     ASSERT_EQ(objCopy.statsDumpInterval(), statsDumpInterval);
     ASSERT_EQ(objCopy.connectTimeout(), connectTimeout);
     ASSERT_EQ(objCopy.openQueueTimeout(), openQueueTimeout);
@@ -163,6 +187,10 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(objCopy.closeQueueTimeout(), closeQueueTimeout);
     ASSERT_EQ(objCopy.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(objCopy.eventQueueHighWatermark(), eventQueueHighWatermark);
+    ASSERT_EQ(objCopy.eventQueueBusyPollDuration(),
+              eventQueueBusyPollDuration);
+    ASSERT(objCopy.inlineMessageEventDelivery());
+    ASSERT_EQ(objCopy, obj);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
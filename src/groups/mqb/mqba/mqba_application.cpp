@@ -44,6 +44,7 @@
 // MWC
 #include <mwcscm_version.h>
 #include <mwcst_statcontext.h>
+#include <mwcsys_threadutil.h>
 #include <mwcsys_time.h>
 #include <mwcu_memoutstream.h>
 
@@ -56,11 +57,16 @@
 #include <bdls_memoryutil.h>
 #include <bdls_osutil.h>
 #include <bdls_processutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_ctime.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslmt_latch.h>
 #include <bslmt_lockguard.h>
@@ -85,6 +91,52 @@ void createBlob(bdlbb::BlobBufferFactory* bufferFactory,
     new (arena) bdlbb::Blob(bufferFactory, allocator);
 }
 
+/// Replace the specified `cpuList` by the description of the effective
+/// placement of the threads restricted to it: the CPUs of `cpuList` in the
+/// specified `allowedCpus` (all of them if `allowedCpus` is empty),
+/// followed by the NUMA nodes of these CPUs.  Leave `cpuList` unchanged if
+/// it is empty or invalid.
+void loadEffectivePlacement(bsl::string*            cpuList,
+                            const bsl::vector<int>& allowedCpus)
+{
+    bsl::vector<int> cpus;
+    if (mwcsys::ThreadUtil::parseCpuList(&cpus, *cpuList) != 0 ||
+        cpus.empty()) {
+        return;  // RETURN
+    }
+
+    if (!allowedCpus.empty()) {
+        bsl::vector<int> effectiveCpus;
+        bsl::set_intersection(cpus.begin(),
+                              cpus.end(),
+                              allowedCpus.begin(),
+                              allowedCpus.end(),
+                              bsl::back_inserter(effectiveCpus));
+        cpus.swap(effectiveCpus);
+    }
+
+    bsl::set<int> nodes;
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        nodes.insert(mwcsys::ThreadUtil::numaNodeOfCpu(cpus[i]));
+    }
+
+    mwcu::MemOutStream os;
+    mwcsys::ThreadUtil::printCpuList(os, cpus) << " (NUMA nodes: ";
+    for (bsl::set<int>::const_iterator it = nodes.begin(); it != nodes.end();
+         ++it) {
+        os << (it == nodes.begin() ? "" : ", ");
+        if (*it < 0) {
+            os << "unknown";
+        }
+        else {
+            os << *it;
+        }
+    }
+    os << ")";
+
+    cpuList->assign(os.str().data(), os.str().length());
+}
+
 }  // close unnamed namespace
 
 // -----------
@@ -241,11 +293,37 @@ int Application::start(bsl::ostream& errorDescription)
         rc_TRANSPORTMANAGER_LISTEN            = -9,
         rc_CLUSTER_REVERSECONNECTIONS_FAILURE = -10,
         rc_ADMIN_POOL_START_FAILURE           = -11,
-        rc_PLUGINMANAGER                      = -12
+        rc_PLUGINMANAGER                      = -12,
+        rc_THREAD_PLACEMENT                   = -13
     };
 
     int rc = rc_SUCCESS;
 
+    const mqbcfg::ThreadPlacementConfig& threadPlacement =
+        mqbcfg::BrokerConfig::get().threadPlacement();
+
+    // Pin the scheduler thread: it is already running, so it has to restrict
+    // itself.
+    {
+        bsl::vector<int> cpus(d_allocator_p);
+        rc = mwcsys::ThreadUtil::parseCpuList(&cpus,
+                                              threadPlacement.scheduler());
+        if (rc != 0) {
+            errorDescription << "Invalid CPU list '"
+                             << threadPlacement.scheduler()
+                             << "' for the scheduler [rc: " << rc << "]";
+            return (rc * 100) + rc_THREAD_PLACEMENT;  // RETURN
+        }
+
+        if (!cpus.empty()) {
+            d_scheduler_p->scheduleEvent(
+                bsls::TimeInterval(0, 0),  // now
+                bdlf::BindUtil::bind(
+                    &mwcsys::ThreadUtil::setCurrentThreadAffinity,
+                    cpus));
+        }
+    }
+
     // Start the PluginManager
     {
         d_pluginManager_mp.load(new (*d_allocator_p)
@@ -292,6 +370,7 @@ int Application::start(bsl::ostream& errorDescription)
                              d_scheduler_p,
                              d_allocators.get("Dispatcher")),
                          d_allocator_p);
+    d_dispatcher_mp->setThreadPlacement(threadPlacement);
     rc = d_dispatcher_mp->start(errorDescription);
     if (0 != rc) {
         return (rc * 100) + rc_DISPATCHER;  // RETURN
@@ -546,7 +625,12 @@ int Application::processCommand(const bslstl::StringRef& source,
     }
     else if (command.isStatValue()) {
         mqbcmd::StatResult statResult;
-        d_statController_mp->processCommand(&statResult, command.stat());
+        if (command.stat().isDispatcherValue()) {
+            d_dispatcher_mp->processCommand(&statResult, command.stat());
+        }
+        else {
+            d_statController_mp->processCommand(&statResult, command.stat());
+        }
         if (statResult.isErrorValue()) {
             cmdResult.makeError(statResult.error());
         }
@@ -589,10 +673,22 @@ int Application::processCommand(const bslstl::StringRef& source,
             options.setInitialIndentLevel(1);
             options.setSpacesPerLevel(4);
 
+            // Report the effective placement of the threads rather than the
+            // configured one.
+            mqbcfg::AppConfig brokerConfig(mqbcfg::BrokerConfig::get(),
+                                           d_allocator_p);
+            mqbcfg::ThreadPlacementConfig& placement =
+                brokerConfig.threadPlacement();
+            bsl::vector<int> allowedCpus(d_allocator_p);
+            mwcsys::ThreadUtil::loadCurrentThreadAffinity(&allowedCpus);
+            loadEffectivePlacement(&placement.sessions(), allowedCpus);
+            loadEffectivePlacement(&placement.queues(), allowedCpus);
+            loadEffectivePlacement(&placement.clusters(), allowedCpus);
+            loadEffectivePlacement(&placement.ioThreads(), allowedCpus);
+            loadEffectivePlacement(&placement.scheduler(), allowedCpus);
+
             mwcu::MemOutStream brokerConfigOs;
-            rc = encoder.encode(brokerConfigOs,
-                                mqbcfg::BrokerConfig::get(),
-                                options);
+            rc = encoder.encode(brokerConfigOs, brokerConfig, options);
             if (rc != 0) {
                 cmdResult.makeError();
                 cmdResult.error().message() = brokerConfigOs.str();
@@ -155,13 +155,16 @@
 #include <mqbi_queue.h>
 #include <mqbnet_tcpsessionfactory.h>
 #include <mqbstat_brokerstats.h>
+#include <mqbu_flushpolicy.h>
 #include <mqbu_messageguidutil.h>
 
 // BMQ
 #include <bmqp_compression.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmmessageiterator.h>
 #include <bmqp_controlmessageutil.h>
 #include <bmqp_event.h>
+#include <bmqp_eventutil.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_putmessageiterator.h>
@@ -175,6 +178,7 @@
 // MWC
 #include <mwcio_status.h>
 #include <mwcst_statcontext.h>
+#include <mwcsys_time.h>
 #include <mwctsk_alarmlog.h>
 #include <mwcu_blob.h>
 #include <mwcu_printutil.h>
@@ -191,6 +195,7 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_memory.h>
@@ -210,6 +215,47 @@ BALL_LOG_SET_NAMESPACE_CATEGORY("MQBA.CLIENTSESSION");
 
 const int k_NAGLE_PACKET_SIZE = 1024 * 1024;  // 1MB
 
+/// Return the policy deciding when a client session flushes the PUSH and
+/// ACK messages pending in its builders, as configured for the TCP
+/// interface of the broker, or a policy flushing at every opportunity if
+/// there is no such configuration.  Note that the byte budget is capped to
+/// `k_NAGLE_PACKET_SIZE`, beyond which builders are always flushed.
+mqbu::FlushPolicy makeFlushPolicy()
+{
+    const bdlb::NullableValue<mqbcfg::TcpInterfaceConfig>& tcpConfig =
+        mqbcfg::BrokerConfig::get().networkInterfaces().tcpInterface();
+
+    if (tcpConfig.isNull()) {
+        return mqbu::FlushPolicy(mqbu::FlushPolicyMode::e_LATENCY,
+                                 k_NAGLE_PACKET_SIZE,
+                                 0,
+                                 0);  // RETURN
+    }
+
+    const mqbcfg::TcpInterfaceConfig& config = tcpConfig.value();
+
+    mqbu::FlushPolicyMode::Enum mode = mqbu::FlushPolicyMode::e_LATENCY;
+    switch (config.flushPolicy()) {
+    case mqbcfg::ClientFlushPolicy::E_THROUGHPUT: {
+        mode = mqbu::FlushPolicyMode::e_THROUGHPUT;
+    } break;
+    case mqbcfg::ClientFlushPolicy::E_ADAPTIVE: {
+        mode = mqbu::FlushPolicyMode::e_ADAPTIVE;
+    } break;
+    case mqbcfg::ClientFlushPolicy::E_LATENCY:
+    default: {
+        mode = mqbu::FlushPolicyMode::e_LATENCY;
+    } break;
+    }
+
+    return mqbu::FlushPolicy(
+        mode,
+        bsl::min(bsl::max(config.flushMaxBytes(), 1), k_NAGLE_PACKET_SIZE),
+        bsl::max(config.flushMaxDelayUs(), 0) *
+            bdlt::TimeUnitRatio::k_NS_PER_US,
+        bsl::max(config.flushRateThreshold(), 0));
+}
+
 /// This method does nothing other than calling the 'initiateShutdown' callback
 /// if it is present; it is just used so that we can control when the session
 /// can be destroyed, during the shutdown flow, by binding the specified
@@ -274,6 +320,52 @@ bool isClientGeneratingGUIDs(
     return !clientIdentity.guidInfo().clientId().empty();  // RETURN
 }
 
+/// Return true if the specified `features` advertise support for the
+/// specified compression algorithm `cat`, and false otherwise.  `NONE` and
+/// `ZLIB` are supported by every client.
+bool hasCompressionFeature(bmqt::CompressionAlgorithmType::Enum cat,
+                           const bsl::string&                   features)
+{
+    switch (cat) {
+    case bmqt::CompressionAlgorithmType::e_ZSTD: {
+        return bmqp::ProtocolUtil::hasFeature(
+            bmqp::CompressionFeatures::k_FIELD_NAME,
+            bmqp::CompressionFeatures::k_ZSTD,
+            features);  // RETURN
+    }
+    case bmqt::CompressionAlgorithmType::e_LZ4: {
+        return bmqp::ProtocolUtil::hasFeature(
+            bmqp::CompressionFeatures::k_FIELD_NAME,
+            bmqp::CompressionFeatures::k_LZ4,
+            features);  // RETURN
+    }
+    case bmqt::CompressionAlgorithmType::e_UNKNOWN:
+    case bmqt::CompressionAlgorithmType::e_NONE:
+    case bmqt::CompressionAlgorithmType::e_ZLIB:
+    default: return true;  // RETURN
+    }
+}
+
+/// Return true if PUT message iterators should decompress old style (v1)
+/// message properties, and false otherwise.  The value of this flag is
+/// derived from broker config as well as broker version, with this logic:
+///
+/// - If brokerVersion is 999999 (developer workflow, CI, Jenkins, etc), use
+///   true, irrespective of flag's value specified in the configuration.
+///
+/// - If brokerVersion is not 999999 (dev and non-dev deployments), use the
+///   value from configuration.
+bool isDecompressingOldMPs()
+{
+    if (mqbcfg::BrokerConfig::get().brokerVersion() == 999999) {
+        return true;  // RETURN
+    }
+
+    return mqbcfg::BrokerConfig::get()
+        .messagePropertiesV2()
+        .advertiseV2Support();
+}
+
 // Finalize the specified 'handle' associated with the specified 'description'
 void finalizeClosedHandle(bsl::string description,
                           const bsl::shared_ptr<mqbi::QueueHandle>& handle)
@@ -311,6 +403,7 @@ ClientSessionState::ClientSessionState(
 , d_ackBuilder(bufferFactory, allocator)
 , d_throttledFailedAckMessages()
 , d_throttledFailedPutMessages()
+, d_compressionDictionaries(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(encodingType != bmqp::EncodingType::e_UNKNOWN);
@@ -410,7 +503,7 @@ void ClientSession::sendPacket(const bdlbb::Blob& blob, bool flushBuilders)
         // 'flushBuilders' should only be used when sending control messages,
         // so not on the likely path.
 
-        flush();
+        flushBuilders();
         // If 'flush' wasn't able to send all the data, some might now be
         // buffered in the 'channelBufferQueue', so check for it again.
         if (!d_state.d_channelBufferQueue.empty()) {
@@ -555,7 +648,7 @@ void ClientSession::sendAck(bmqt::AckResult::Enum    status,
                              correlationId,
                              messageGUID,
                              queueId),
-        bdlf::BindUtil::bind(&ClientSession::flush, this));
+        bdlf::BindUtil::bind(&ClientSession::flushBuilders, this));
 
     if (rc != bmqt::EventBuilderResult::e_SUCCESS) {
         BALL_LOG_ERROR << "Failed to append ACK [rc: " << rc << ", source: '"
@@ -564,9 +657,12 @@ void ClientSession::sendAck(bmqt::AckResult::Enum    status,
                        << ", GUID: " << messageGUID << ", queue: '" << uri
                        << "' (id: " << queueId << ")]";
     }
+    else {
+        d_flushPolicy.onItem(mwcsys::Time::highResolutionTimer());
+    }
 
-    if (d_state.d_ackBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
-        flush();
+    if (d_state.d_ackBuilder.eventSize() >= d_flushPolicy.maxBytes()) {
+        flushBuilders();
     }
 
     mqbstat::QueueStatsClient* queueStats = 0;
@@ -631,6 +727,12 @@ void ClientSession::tearDownImpl(bslmt::Semaphore*            semaphore,
         d_scheduler_p->cancelEventAndWait(d_periodicUnconfirmedCheckHandler);
     }
 
+    // The channel is going away, there is no point flushing the messages
+    // held by the flush policy anymore.
+    if (d_flushTimerHandle) {
+        d_scheduler_p->cancelEventAndWait(d_flushTimerHandle);
+    }
+
     d_self.invalidate();
     // Invalidating this CS in CS thread for the sake of synchronization
     // with `finishCheckUnconfirmed / finishCheckUnconfirmedDispatched` and
@@ -1126,6 +1228,16 @@ void ClientSession::processDisconnectAllQueues(
         d_scheduler_p->cancelEventAndWait(d_periodicUnconfirmedCheckHandler);
     }
 
+    // Send the messages held by the flush policy now instead of when their
+    // delay budget is exhausted: the client is about to stop reading from the
+    // channel once it gets the disconnect response.  Messages held from now
+    // on are sent ahead of the disconnect response (see
+    // 'processDisconnect').
+    if (d_flushTimerHandle) {
+        d_scheduler_p->cancelEventAndWait(d_flushTimerHandle);
+    }
+    flushBuilders();
+
     // Step 1/3 of disconnect request processing: executed following an enqueue
     // to the client dispatcher from the IO thread.  Drops all applicable
     // queues, and provides synchronisation with all the queues thread.
@@ -1229,6 +1341,11 @@ void ClientSession::processDisconnect(
     BALL_LOG_INFO << description()
                   << ": Sending disconnect response: " << response;
 
+    // Send the messages held by the flush policy, if any, ahead of the
+    // response.  Note that 'sendPacket' doesn't flush them itself if some
+    // data is already waiting in the channel buffer queue.
+    flushBuilders();
+
     // Send the response
     sendPacket(d_state.d_schemaEventBuilder.blob(), true);
 
@@ -1297,6 +1414,34 @@ void ClientSession::openQueueCb(
         bmqp_ctrlmsg::OpenQueueResponse& res =
             response.choice().makeOpenQueueResponse(openQueueResponse);
         res.originalRequest() = handleParamsCtrlMsg.choice().openQueue();
+
+        // Register the compression dictionaries of the queue, if any, to be
+        // able to decompress messages for consumers not supporting zstd.
+        // They are usually registered already, unless this broker is a
+        // proxy.  They remain registered at least until this session goes
+        // away.
+        const bsl::vector<bsl::vector<char> >& dictionaries =
+            res.compressionDictionaries();
+        for (size_t i = 0; i < dictionaries.size(); ++i) {
+            bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+            mwcu::MemOutStream                           error;
+            const int rc = bmqp::CompressionDictionaryUtil::loadAndRegister(
+                &dictionary,
+                dictionaries[i].data(),
+                static_cast<int>(dictionaries[i].size()),
+                &error,
+                d_state.d_allocator_p);
+            if (rc != 0) {
+                BALL_LOG_WARN << description()
+                              << ": Unable to register compression "
+                              << "dictionary [reason: '" << error.str()
+                              << "', rc: " << rc
+                              << ", request: " << handleParamsCtrlMsg << "]";
+                continue;  // CONTINUE
+            }
+
+            d_state.d_compressionDictionaries[dictionary->id()] = dictionary;
+        }
     }
 
     d_state.d_schemaEventBuilder.reset();
@@ -1598,23 +1743,35 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
 
+    bmqp::ConfirmMessageIterator         confIt;
+    bdlma::LocalSequentialAllocator<256> localAllocator(d_state.d_allocator_p);
+    mwcu::MemOutStream                   errorStream(&localAllocator);
+
+    onConfirmEventImp(event, &confIt, &errorStream);
+}
+
+void ClientSession::onConfirmEventImp(
+    const mqbi::DispatcherConfirmEvent& event,
+    bmqp::ConfirmMessageIterator*       confIt,
+    mwcu::MemOutStream*                 errorStream)
+{
+    // executed by the *CLIENT* dispatcher thread
+
     // NOTE: Refer to implementation notes at the top of this file, section
     //       'onConfirmEvent/onPutEvent' for why we do not check for
     //       'd_operationState' here.
 
     bmqp::Event rawEvent(event.blob().get(), d_state.d_allocator_p);
+    rawEvent.loadConfirmMessageIterator(confIt);
 
-    bmqp::ConfirmMessageIterator confIt;
-    rawEvent.loadConfirmMessageIterator(&confIt);
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!confIt.isValid())) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!confIt->isValid())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         BALL_LOG_ERROR_BLOCK
         {
             BALL_LOG_OUTPUT_STREAM << "#CORRUPTED_EVENT " << description()
                                    << ": received an invalid CONFIRM event\n";
-            confIt.dumpBlob(BALL_LOG_OUTPUT_STREAM);
+            confIt->dumpBlob(BALL_LOG_OUTPUT_STREAM);
         }
         return;  // RETURN
     }
@@ -1622,18 +1779,15 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
     int msgNum = 0;
     int rc     = 0;
 
-    bdlma::LocalSequentialAllocator<256> localAllocator(d_state.d_allocator_p);
-    mwcu::MemOutStream                   errorStream(&localAllocator);
-
-    while ((rc = confIt.next()) == 1) {
-        const int          id    = confIt.message().queueId();
+    while ((rc = confIt->next()) == 1) {
+        const int          id    = confIt->message().queueId();
         const unsigned int subId = static_cast<unsigned int>(
-            confIt.message().subQueueId());
+            confIt->message().subQueueId());
         const bmqp::QueueId queueId(id, subId);
         mqbi::QueueHandle*  queueHandle = 0;
 
         bool isValid = validateMessage(&queueHandle,
-                                       &errorStream,
+                                       errorStream,
                                        queueId,
                                        bmqp::EventType::e_CONFIRM);
 
@@ -1643,21 +1797,22 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
             BALL_LOG_TRACE << description() << ": Confirm message #"
                            << ++msgNum << " [queue: '"
                            << queueHandle->queue()->uri()
-                           << "' GUID: " << confIt.message().messageGUID()
+                           << "' GUID: " << confIt->message().messageGUID()
                            << "]";
 
-            queueHandle->confirmMessage(confIt.message().messageGUID(), subId);
+            queueHandle->confirmMessage(confIt->message().messageGUID(),
+                                        subId);
         }
         else {
             BALL_LOG_WARN << "#CLIENT_IMPROPER_BEHAVIOR " << description()
-                          << ": Received CONFIRM message " << errorStream.str()
-                          << " [queue: '"
+                          << ": Received CONFIRM message "
+                          << errorStream->str() << " [queue: '"
                           << (queueHandle ? queueHandle->queue()->uri()
                                           : "<UNKNOWN>")
                           << "', queueId: " << queueId
-                          << ", GUID: " << confIt.message().messageGUID()
+                          << ", GUID: " << confIt->message().messageGUID()
                           << "].";
-            errorStream.reset();
+            errorStream->reset();
         }
     }
 
@@ -1669,7 +1824,7 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
             BALL_LOG_OUTPUT_STREAM
                 << "#CORRUPTED_EVENT " << description()
                 << ": Invalid ConfirmMessage event [rc: " << rc << "]\n";
-            confIt.dumpBlob(BALL_LOG_OUTPUT_STREAM);
+            confIt->dumpBlob(BALL_LOG_OUTPUT_STREAM);
         }
     }
 }
@@ -1947,6 +2102,34 @@ void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
         }
     }
 
+    if (convertingRc == 0 && cat > bmqt::CompressionAlgorithmType::e_ZLIB &&
+        !hasCompressionFeature(cat, d_clientIdentity_p->features())) {
+        // The client does not support the compression algorithm of this
+        // message; de-compress the payload (past the MessageProperties area,
+        // if any) before sending it.
+        bdlbb::Blob decompressed(d_state.d_bufferFactory_p,
+                                 d_state.d_allocator_p);
+        int         messagePropertiesSize = 0;
+
+        convertingRc = bmqp::ProtocolUtil::parse(0,
+                                                 &messagePropertiesSize,
+                                                 &decompressed,
+                                                 *blob,
+                                                 blob->length(),
+                                                 true,
+                                                 mwcu::BlobPosition(),
+                                                 pushProperties.isPresent(),
+                                                 pushProperties.isExtended(),
+                                                 cat,
+                                                 d_state.d_bufferFactory_p,
+                                                 d_state.d_allocator_p);
+        if (convertingRc == 0) {
+            cat = bmqt::CompressionAlgorithmType::e_NONE;
+            buffer.swap(decompressed);
+            blob = &buffer;
+        }
+    }
+
     if (convertingRc == 0) {
         d_state.d_pushBuilder.packMessage(*blob,
                                           event.queueId(),
@@ -1955,9 +2138,11 @@ void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
                                           cat,
                                           pushProperties);
 
+        d_flushPolicy.onItem(mwcsys::Time::highResolutionTimer());
+
         // Flush if the builder is 'full'
-        if (d_state.d_pushBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
-            flush();
+        if (d_state.d_pushBuilder.eventSize() >= d_flushPolicy.maxBytes()) {
+            flushBuilders();
         }
 
         // Finally, Update stats
@@ -2030,6 +2215,62 @@ void ClientSession::onPushEvent(const mqbi::DispatcherPushEvent& event)
     }
 }
 
+void ClientSession::nackPutEvent(const bdlbb::Blob&       event,
+                                 bool                     isFirstHop,
+                                 const bslstl::StringRef& source)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    // Only the headers of the messages are needed to NACK them, so read them
+    // directly rather than with a 'bmqp::PutMessageIterator', which stops at
+    // the first invalid or incomplete message.
+    bsl::vector<bmqp::PutHeader> headers(d_state.d_allocator_p);
+    const int remaining = bmqp::EventUtil::loadPutHeaders(&headers, event);
+
+    for (bsl::vector<bmqp::PutHeader>::const_iterator it = headers.begin();
+         it != headers.end();
+         ++it) {
+        const int queueId = it->queueId();
+
+        const QueueState*  queueState = 0;
+        QueueStateMapCIter queueStateIter =
+            d_queueSessionManager.queues().find(queueId);
+        if (queueStateIter != d_queueSessionManager.queues().end() &&
+            queueStateIter->second.d_handle_p) {
+            queueState = &(queueStateIter->second);
+        }
+
+        if (isFirstHop && !d_isClientGeneratingGUIDs) {
+            sendAck(bmqt::AckResult::e_INVALID_ARGUMENT,
+                    it->correlationId(),
+                    bmqt::MessageGUID(),
+                    queueState,
+                    queueId,
+                    true,  // isSelfGenerated
+                    source);
+        }
+        else {
+            sendAck(bmqt::AckResult::e_INVALID_ARGUMENT,
+                    bmqp::AckMessage::k_NULL_CORRELATION_ID,
+                    it->messageGUID(),
+                    queueState,
+                    queueId,
+                    true,  // isSelfGenerated
+                    source);
+        }
+    }
+
+    if (remaining != 0) {
+        BALL_LOG_ERROR << "#CORRUPTED_EVENT " << description() << ": NACKed "
+                       << headers.size() << " PUT messages, the messages in "
+                       << "the remaining " << remaining << " bytes of the "
+                       << "event cannot be identified";
+    }
+}
+
 void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
 {
     // executed by the *CLIENT* dispatcher thread
@@ -2037,6 +2278,29 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
 
+    bdlbb::Blob decompressedBlob(d_state.d_bufferFactory_p,
+                                 d_state.d_allocator_p);
+
+    // Third argument in PutMsgIterator below conveys if the iterator should
+    // decompress old style (v1) msg properties.
+    bmqp::PutMessageIterator putIt(d_state.d_bufferFactory_p,
+                                   d_state.d_allocator_p,
+                                   isDecompressingOldMPs());
+
+    onPutEventImp(event,
+                  &putIt,
+                  &decompressedBlob,
+                  handleRequesterContext()->isFirstHop());
+}
+
+void ClientSession::onPutEventImp(
+    const mqbi::DispatcherPutEvent& event,
+    bmqp::PutMessageIterator*       putIt,
+    bdlbb::Blob*                    decompressedBlob,
+    bool                            isFirstHop)
+{
+    // executed by the *CLIENT* dispatcher thread
+
     // IMPLEMENTATION NOTES:
     //
     /// ACKs
@@ -2065,52 +2329,63 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
     // 3. No effect.
     bmqp::Event rawEvent(event.blob().get(), d_state.d_allocator_p);
 
-    // Third argument in PutMsgIterator below conveys if the iterator should
-    // decomperss old style (v1) msg properties.  The value of this flag is
-    // derived from broker config as well as broker version, with this logic:
-    //
-    // - If brokerVersion is 999999 (developer workflow, CI, Jenkins, etc),
-    //   use true, irrespective of flag's value specified in the configuration.
-    //
-    // - If brokerVersion is not 999999 (dev and non-dev deployments), use the
-    //   value from configuration.
-
-    bool isDecompressingOldMPs = false;
+    // The client may have compressed the whole body of the event, if this
+    // broker advertised support for it (see
+    // 'bmqp::CompressionFeatures::k_EVENT'), in which case it must be
+    // decompressed before iterating over its messages.
+    BSLS_ASSERT_SAFE(rawEvent.isPutEvent());
+    const bmqt::CompressionAlgorithmType::Enum eventCompressionAlgorithm =
+        rawEvent.putEventCompressionAlgorithmType();
+    if (eventCompressionAlgorithm != bmqt::CompressionAlgorithmType::e_NONE) {
+        decompressedBlob->removeAll();
+        const int rc = bmqp::EventUtil::decompressPutEvent(
+            decompressedBlob,
+            *event.blob(),
+            d_state.d_bufferFactory_p,
+            d_state.d_allocator_p);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_ERROR << "#CORRUPTED_EVENT " << description()
+                           << ": failed to decompress PUT event [rc: " << rc
+                           << ", algorithm: " << eventCompressionAlgorithm
+                           << ", size: " << event.blob()->length()
+                           << ", decompressed size: "
+                           << decompressedBlob->length() << "]";
+
+            // NACK every message whose header was decompressed before the
+            // failure (e.g., because the event would exceed the maximum
+            // event size), so that the client does not wait for their ACKs
+            // forever.  Note that the messages after that point cannot be
+            // identified.
+            nackPutEvent(*decompressedBlob,
+                         isFirstHop,
+                         "putEvent::failedDecompression");
+            return;  // RETURN
+        }
 
-    if (mqbcfg::BrokerConfig::get().brokerVersion() == 999999) {
-        isDecompressingOldMPs = true;
-    }
-    else if (mqbcfg::BrokerConfig::get()
-                 .messagePropertiesV2()
-                 .advertiseV2Support()) {
-        isDecompressingOldMPs = true;
+        rawEvent.reset(decompressedBlob);
     }
 
-    bmqp::PutMessageIterator putIt(d_state.d_bufferFactory_p,
-                                   d_state.d_allocator_p,
-                                   isDecompressingOldMPs);
-
     BSLS_ASSERT_SAFE(rawEvent.isPutEvent());
-    rawEvent.loadPutMessageIterator(&putIt);
+    rawEvent.loadPutMessageIterator(putIt);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!putIt.isValid())) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!putIt->isValid())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         BALL_LOG_ERROR_BLOCK
         {
             BALL_LOG_OUTPUT_STREAM << "#CORRUPTED_EVENT " << description()
                                    << ": received an invalid PUT event\n";
-            putIt.dumpBlob(BALL_LOG_OUTPUT_STREAM);
+            putIt->dumpBlob(BALL_LOG_OUTPUT_STREAM);
         }
         return;  // RETURN
     }
 
-    int        rc         = 0;
-    int        msgNum     = 0;
-    const bool isFirstHop = handleRequesterContext()->isFirstHop();
-    while ((rc = putIt.next()) == 1) {
+    int rc     = 0;
+    int msgNum = 0;
+    while ((rc = putIt->next()) == 1) {
         bmqp::PutHeader& putHeader = const_cast<bmqp::PutHeader&>(
-            putIt.header());
+            putIt->header());
         const bmqp::QueueId queueId(putHeader.queueId(),
                                     bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID);
 
@@ -2126,7 +2401,7 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
                                     &subQueueInfoPtr,
                                     &appDataSp,
                                     &optionsSp,
-                                    putIt))) {
+                                    *putIt))) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
             // Update invalid queue stats
@@ -2162,7 +2437,7 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
             // A message will only go once through a first hop, so on
             // average, this is the unlikely case (except for localQueues).
 
-            correlationId = putIt.header().correlationId();
+            correlationId = putIt->header().correlationId();
             // Must read the correlationId before over-writting it with a
             // GUID since they share the bytes in the putHeader.
 
@@ -2257,7 +2532,7 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
                         << "for a PUT message at first hop for queue ["
                         << queueStatePtr->d_handle_p->queue()->uri()
                         << "], correlationId: " << correlationId
-                        << ", message size: " << putIt.applicationDataSize()
+                        << ", message size: " << putIt->applicationDataSize()
                         << ", GUID: " << insertRc.first->first << ". "
                         << "This could be due to retransmitted PUT "
                         << "message.";
@@ -2268,13 +2543,13 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
         BALL_LOG_TRACE << description() << ": PUT message #" << ++msgNum
                        << " [queue: "
                        << queueStatePtr->d_handle_p->queue()->uri()
-                       << ", GUID: " << putIt.header().messageGUID()
-                       << ", flags: " << putIt.header().flags()
-                       << ", message size: " << putIt.applicationDataSize()
+                       << ", GUID: " << putIt->header().messageGUID()
+                       << ", flags: " << putIt->header().flags()
+                       << ", message size: " << putIt->applicationDataSize()
                        << "]:\n"
                        << mwcu::BlobStartHexDumper(appDataSp.get(), 64);
 
-        queueStatePtr->d_handle_p->postMessage(putIt.header(),
+        queueStatePtr->d_handle_p->postMessage(putIt->header(),
                                                appDataSp,
                                                optionsSp);
     }
@@ -2289,7 +2564,7 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
                 BALL_LOG_OUTPUT_STREAM << "#CORRUPTED_EVENT " << description()
                                        << ": Invalid Put event [rc: " << rc
                                        << "]\n";
-                putIt.dumpBlob(BALL_LOG_OUTPUT_STREAM);
+                putIt->dumpBlob(BALL_LOG_OUTPUT_STREAM);
             }
         }
     }
@@ -2545,6 +2820,8 @@ ClientSession::ClientSession(
 , d_clusterCatalog_p(clusterCatalog)
 , d_scheduler_p(scheduler)
 , d_periodicUnconfirmedCheckHandler()
+, d_flushPolicy(makeFlushPolicy())
+, d_flushTimerHandle()
 , d_shutdownChain(allocator)
 , d_shutdownCallback()
 {
@@ -2919,7 +3196,8 @@ void ClientSession::onDispatcherEvent(const mqbi::DispatcherEvent& event)
             event.asCallbackEvent();
 
         BSLS_ASSERT_SAFE(realEvent->callback());
-        flush();  // Flush any pending messages to guarantee ordering of events
+        flushBuilders();  // Flush any pending messages to guarantee ordering
+                          // of events
         realEvent->callback()(dispatcherClientData().processorHandle());
     } break;
     case mqbi::DispatcherEventType::e_CONTROL_MSG: {
@@ -2964,6 +3242,83 @@ void ClientSession::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     };
 }
 
+void ClientSession::onDispatcherEvents(
+    const mqbi::DispatcherEvent* const* events,
+    int                                 numEvents)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+    BSLS_ASSERT_SAFE(numEvents > 0);
+
+    // The objects needed to process a CONFIRM or a PUT event are created once
+    // and reused for all events of the batch.
+    switch (events[0]->type()) {
+    case mqbi::DispatcherEventType::e_CONFIRM: {
+        bmqp::ConfirmMessageIterator         confIt;
+        bdlma::LocalSequentialAllocator<256> localAllocator(
+            d_state.d_allocator_p);
+        mwcu::MemOutStream errorStream(&localAllocator);
+
+        for (int i = 0; i < numEvents; ++i) {
+            BALL_LOG_TRACE << description()
+                           << ": processing dispatcher event '" << *events[i]
+                           << "'";
+
+            onConfirmEventImp(*(events[i]->asConfirmEvent()),
+                              &confIt,
+                              &errorStream);
+        }
+    } break;
+    case mqbi::DispatcherEventType::e_PUT: {
+        bdlbb::Blob              decompressedBlob(d_state.d_bufferFactory_p,
+                                                  d_state.d_allocator_p);
+        bmqp::PutMessageIterator putIt(d_state.d_bufferFactory_p,
+                                       d_state.d_allocator_p,
+                                       isDecompressingOldMPs());
+        const bool isFirstHop = handleRequesterContext()->isFirstHop();
+
+        for (int i = 0; i < numEvents; ++i) {
+            BALL_LOG_TRACE << description()
+                           << ": processing dispatcher event '" << *events[i]
+                           << "'";
+
+            onPutEventImp(*(events[i]->asPutEvent()),
+                          &putIt,
+                          &decompressedBlob,
+                          isFirstHop);
+        }
+    } break;
+    default: {
+        mqbi::DispatcherClient::onDispatcherEvents(events, numEvents);
+    } break;
+    }
+}
+
+void ClientSession::onFlushTimer()
+{
+    // executed by the *SCHEDULER* thread
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(&ClientSession::onFlushTimerDispatched, this),
+        this);
+}
+
+void ClientSession::onFlushTimerDispatched()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    d_flushTimerHandle.release();
+
+    // Note that the builders have usually already been flushed when
+    // dispatching the callback event, for ordering purposes.
+    flushBuilders();
+}
+
 void ClientSession::flush()
 {
     // executed by the *CLIENT* dispatcher thread
@@ -2971,6 +3326,42 @@ void ClientSession::flush()
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
 
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    const int pendingBytes       = d_state.d_pushBuilder.eventSize() +
+                             d_state.d_ackBuilder.eventSize();
+
+    if (d_flushPolicy.shouldFlush(pendingBytes, now)) {
+        flushBuilders();
+        return;  // RETURN
+    }
+
+    // Hold the pending messages so that they get coalesced with the ones to
+    // come, and make sure they are sent when their delay budget is exhausted
+    // even if no more messages come.  Note that the session is not in the
+    // dispatcher's flush list anymore, so the timer is the only thing that
+    // guarantees these messages are eventually sent.
+    if (!d_flushTimerHandle) {
+        bsls::TimeInterval deadline = mwcsys::Time::nowMonotonicClock();
+        deadline.addNanoseconds(d_flushPolicy.deadline() - now);
+
+        d_scheduler_p->scheduleEvent(
+            &d_flushTimerHandle,
+            deadline,
+            bdlf::BindUtil::bind(
+                mwcu::WeakMemFnUtil::weakMemFn(&ClientSession::onFlushTimer,
+                                               d_self.acquireWeak())));
+    }
+}
+
+void ClientSession::flushBuilders()
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    d_flushPolicy.onFlushed();
+
     // Start by flushing the data ('PUSH') messages.
     if (d_state.d_pushBuilder.messageCount() != 0) {
         BALL_LOG_TRACE << description() << ": Flushing "
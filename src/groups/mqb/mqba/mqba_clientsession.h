@@ -38,9 +38,11 @@
 #include <mqbi_queue.h>
 #include <mqbnet_session.h>
 #include <mqbstat_queuestats.h>
+#include <mqbu_flushpolicy.h>
 
 // BMQ
 #include <bmqp_ackeventbuilder.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_protocol.h>
 #include <bmqp_pusheventbuilder.h>
@@ -80,8 +82,14 @@ namespace bslmt {
 class Semaphore;
 }
 namespace bmqp {
+class ConfirmMessageIterator;
+}
+namespace bmqp {
 class Event;
 }
+namespace bmqp {
+class PutMessageIterator;
+}
 namespace bmqt {
 class MessageGUID;
 }
@@ -94,6 +102,9 @@ class ClusterCatalog;
 namespace mwcst {
 class StatContext;
 }
+namespace mwcu {
+class MemOutStream;
+}
 
 namespace mqba {
 
@@ -151,6 +162,11 @@ struct ClientSessionState {
 
     typedef bslma::ManagedPtr<mwcst::StatContext> StatContextMp;
 
+    /// Map of dictionary id -> compression dictionary
+    typedef bsl::unordered_map<unsigned int,
+                               bsl::shared_ptr<bmqp::CompressionDictionary> >
+        CompressionDictionaryMap;
+
   public:
     // PUBLIC DATA
     bslma::Allocator* d_allocator_p;
@@ -218,6 +234,13 @@ struct ClientSessionState {
     // usage of an unknown queue is
     // encountered
 
+    CompressionDictionaryMap d_compressionDictionaries;
+    // Compression dictionaries of the
+    // queues opened by the client, which
+    // remain registered as long as this
+    // session holds them.  To be used only
+    // in client dispatcher thread.
+
   private:
     // NOT IMPLEMENTED
 
@@ -381,6 +404,19 @@ class ClientSession : public mqbnet::Session,
     // the unconfirmed messages during the
     // session shutdown.
 
+    mqbu::FlushPolicy d_flushPolicy;
+    // Policy deciding whether the PUSH and
+    // ACK messages pending in the builders
+    // are sent when the dispatcher flushes
+    // this session, or held to be coalesced
+    // with the messages to come.
+
+    bdlmt::EventSchedulerEventHandle d_flushTimerHandle;
+    // Handler to manage the scheduled
+    // event that flushes the messages held
+    // by 'd_flushPolicy' once their delay
+    // budget is exhausted.
+
     mwcu::OperationChain d_shutdownChain;
     // Mechanism used for the session
     // graceful shutdown to serialize
@@ -422,6 +458,17 @@ class ClientSession : public mqbnet::Session,
     /// `channelBufferQueue`.
     void flushChannelBufferQueue();
 
+    /// Send the PUSH and ACK messages pending in the builders, regardless
+    /// of the flush policy.
+    void flushBuilders();
+
+    /// Invoked by the scheduler when the delay budget of the messages held
+    /// by the flush policy is exhausted.
+    void onFlushTimer();
+
+    /// Send the messages held by the flush policy.
+    void onFlushTimerDispatched();
+
     /// Append an ack message to the session's ack builder, with the
     /// specified `status`, and the specified `correlationId`, `messageGUID`
     /// and `queueId`, associated with the queue having the specified
@@ -438,6 +485,16 @@ class ClientSession : public mqbnet::Session,
                  bool                     isSelfGenerated,
                  const bslstl::StringRef& source);
 
+    /// NACK with `bmqt::AckResult::e_INVALID_ARGUMENT` each message of the
+    /// specified put `event` whose header is complete and valid, `event`
+    /// being possibly truncated (see `bmqp::EventUtil::loadPutHeaders`),
+    /// using the specified `isFirstHop` flag to identify them by
+    /// correlationId or GUID.  The specified `source` is used when logging,
+    /// to indicate the origin of the NACKs.
+    void nackPutEvent(const bdlbb::Blob&       event,
+                      bool                     isFirstHop,
+                      const bslstl::StringRef& source);
+
     /// Implementation of the teardown process, with the specified `session`
     /// representing this session and posting on the specified `semaphore`
     /// once processing is done. The specified `isBrokerShutdown` is set to
@@ -547,6 +604,13 @@ class ClientSession : public mqbnet::Session,
     /// Process the specified confirm `event`.
     void onConfirmEvent(const mqbi::DispatcherConfirmEvent& event);
 
+    /// Process the specified confirm `event` using the specified `confIt`
+    /// to iterate over its messages and the specified `errorStream` to
+    /// report invalid ones.  Note that both may be reused across events.
+    void onConfirmEventImp(const mqbi::DispatcherConfirmEvent& event,
+                           bmqp::ConfirmMessageIterator*       confIt,
+                           mwcu::MemOutStream*                 errorStream);
+
     /// Process the specified reject `event`.
     void onRejectEvent(const mqbi::DispatcherRejectEvent& event);
 
@@ -556,6 +620,17 @@ class ClientSession : public mqbnet::Session,
     /// Process the specified put `event`.
     void onPutEvent(const mqbi::DispatcherPutEvent& event);
 
+    /// Process the specified put `event` using the specified `putIt` to
+    /// iterate over its messages and the specified `decompressedBlob` to
+    /// hold its decompressed content, if needed, and the specified
+    /// `isFirstHop` flag indicating whether this broker is the first hop of
+    /// the messages.  Note that `putIt` and `decompressedBlob` may be
+    /// reused across events.
+    void onPutEventImp(const mqbi::DispatcherPutEvent& event,
+                       bmqp::PutMessageIterator*       putIt,
+                       bdlbb::Blob*                    decompressedBlob,
+                       bool                            isFirstHop);
+
     /// Validate a message of the specified `eventType` using the specified
     /// `queueId`. Return true if the message is valid and false otherwise.
     /// Populate the specified `queueHandle` if the queue is found and load
@@ -686,8 +761,17 @@ class ClientSession : public mqbnet::Session,
     void onDispatcherEvent(const mqbi::DispatcherEvent& event)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Process the specified `numEvents` consecutive `events` of the same
+    /// type routed by the dispatcher to this instance, amortizing the setup
+    /// of CONFIRM and PUT events processing over the batch.
+    void onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                            int numEvents) BSLS_KEYWORD_OVERRIDE;
+
     /// Called by the dispatcher to flush any pending operation.. mainly
-    /// used to provide batch and nagling mechanism.
+    /// used to provide batch and nagling mechanism.  The PUSH and ACK
+    /// messages pending in the builders are sent unless the flush policy
+    /// decides to hold them, in which case they are sent at the latest when
+    /// their delay budget is exhausted.
     void flush() BSLS_KEYWORD_OVERRIDE;
 
     // MANIPULATORS
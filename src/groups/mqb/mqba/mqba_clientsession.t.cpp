@@ -33,6 +33,7 @@
 // BMQ
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_eventutil.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_pushmessageiterator.h>
@@ -2342,6 +2343,136 @@ static void test11_initiateShutdown()
     }
 }
 
+static void test12_failedPutEventDecompression()
+// ------------------------------------------------------------------------
+// TESTS FAILED PUT EVENT DECOMPRESSION
+//
+// Concerns:
+//   - Every message of a compressed PUT event which fails to decompress
+//     is NACKed, as far as its header could be decompressed, and none is
+//     posted.
+//
+// Plan:
+//   Instantiate a testbench, open a queue, send a compressed PUT event
+//   truncated in the middle of its body, and observe the NACKs.
+//
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "TESTS FAILED PUT EVENT DECOMPRESSION");
+
+    const bsl::string uri("bmq://my.domain/queue-foo-bar", s_allocator_p);
+    const int         queueId      = 4;  // A queue number
+    const bool        isAtMostOnce = false;
+    const int         k_NUM_MSGS   = 4;
+
+    TestBench tb(client(e_FirstHop), isAtMostOnce, s_allocator_p);
+
+    // Send an 'OpenQueue` request.
+    tb.openQueue(uri, queueId);
+
+    // Confirm that the OpenQueue response has been sent downstream.
+    tb.d_cs.flush();
+    tb.assertOpenQueueResponse();
+
+    // Build a PUT event and compress its body.
+    bmqp::PutEventBuilder          peb(&tb.d_bufferFactory, s_allocator_p);
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        bdlbb::Blob payload(&tb.d_bufferFactory, s_allocator_p);
+        bmqp::PutTester::populateBlob(&payload, 2048);
+
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+        guids.push_back(guid);
+
+        peb.startMessage();
+        peb.setMessagePayload(&payload);
+        peb.setMessageGUID(guid);
+        peb.setFlag(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+        ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                  peb.packMessage(queueId));
+    }
+
+    bdlbb::Blob compressed(&tb.d_bufferFactory, s_allocator_p);
+    ASSERT_EQ(0,
+              bmqp::EventUtil::compressPutEvent(
+                  &compressed,
+                  peb.blob(),
+                  bmqt::CompressionAlgorithmType::e_ZLIB,
+                  &tb.d_bufferFactory,
+                  s_allocator_p));
+
+    // Truncate the compressed body in its middle.
+    bsl::shared_ptr<bdlbb::Blob> blobSp;
+    blobSp.createInplace(s_allocator_p, &tb.d_bufferFactory, s_allocator_p);
+    mwcu::BlobUtil::appendBlobFromIndex(blobSp.get(),
+                                        compressed,
+                                        0,
+                                        0,
+                                        compressed.length() / 2);
+    {
+        mwcu::BlobObjectProxy<bmqp::EventHeader> header(blobSp.get(),
+                                                        true,   // read
+                                                        true);  // write
+        header->setLength(blobSp->length());
+    }
+
+    // The messages whose header is decompressed before the failure are
+    // expected to be NACKed.
+    bsl::vector<bmqp::PutHeader> expected(s_allocator_p);
+    {
+        bdlbb::Blob decompressed(&tb.d_bufferFactory, s_allocator_p);
+        ASSERT_NE(0,
+                  bmqp::EventUtil::decompressPutEvent(&decompressed,
+                                                      *blobSp,
+                                                      &tb.d_bufferFactory,
+                                                      s_allocator_p));
+        ASSERT_LE(0,
+                  bmqp::EventUtil::loadPutHeaders(&expected, decompressed));
+    }
+    ASSERT_LE(1u, expected.size());
+    ASSERT_GT(static_cast<size_t>(k_NUM_MSGS), expected.size());
+
+    mqbi::DispatcherEvent putEvent(s_allocator_p);
+    putEvent.setType(mqbi::DispatcherEventType::e_PUT)
+        .setIsRelay(true)     // Relay message
+        .setSource(&tb.d_cs)  // DispatcherClient *value
+        .setBlob(blobSp);     // const bsl::shared_ptr<bdlbb::Blob>& value
+
+    tb.dispatch(putEvent);
+    tb.d_cs.flush();
+
+    // Check that no message was posted
+    ASSERT(tb.d_domain.d_queueHandle->postedMessages().empty());
+
+    // Check that the NACKs were sent, in order
+    ASSERT(tb.d_channel->waitFor(2, false));
+
+    size_t numNacks = 0;
+    for (size_t i = 1; i < tb.d_channel->writeCalls().size(); ++i) {
+        bmqp::Event ackEvent(&tb.d_channel->writeCalls()[i].d_blob,
+                             s_allocator_p);
+        ASSERT(ackEvent.isAckEvent());
+
+        bmqp::AckMessageIterator iter;
+        ackEvent.loadAckMessageIterator(&iter);
+        while (iter.next() == 1) {
+            const bmqp::AckMessage& ack = iter.message();
+            ASSERT_EQ_D(numNacks, ack.queueId(), queueId);
+            ASSERT_EQ_D(numNacks,
+                        bmqp::ProtocolUtil::ackResultFromCode(ack.status()),
+                        bmqt::AckResult::e_INVALID_ARGUMENT);
+            ASSERT_GT(expected.size(), numNacks);
+            if (numNacks < expected.size()) {
+                ASSERT_EQ_D(numNacks, ack.messageGUID(), guids[numNacks]);
+            }
+            ++numNacks;
+        }
+    }
+    ASSERT_EQ(expected.size(), numNacks);
+}
+
 static void testN1_ackConfiguration()
 // ------------------------------------------------------------------------
 // TESTS ACK CONFIGURATION FOR CLIENT SESSION
@@ -2596,6 +2727,7 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 12: test12_failedPutEventDecompression(); break;
         case 11: test11_initiateShutdown(); break;
         case 10: test10_newStyleCompressedPush(); break;
         case 9: test9_newStylePush(); break;
@@ -17,6 +17,10 @@
 #include <mqba_dispatcher.h>
 
 #include <mqbscm_version.h>
+// MQB
+#include <mqbcmd_messages.h>
+#include <mqbstat_brokerstats.h>
+
 // BMQ
 #include <mwcu_memoutstream.h>
 
@@ -27,21 +31,65 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_currenttime.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_semaphore.h>
 #include <bsls_annotation.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 namespace BloombergLP {
 namespace mqba {
 
 namespace {
 const double k_QUEUE_STUCK_INTERVAL = 3 * 60.0;
+
+/// Maximum number of migrations reported by the `STAT DISPATCHER` command.
+const size_t k_MAX_RECENT_MIGRATIONS = 16;
+
+/// Maximum number of events delivered at once to a client (see
+/// `mqbi::DispatcherClient::onDispatcherEvents`).
+const int k_MAX_EVENTS_PER_CLIENT_BATCH = 32;
+
+/// Create, using the specified `allocator`, a processor queue of the
+/// parameterized `QUEUE` type with the specified `capacity`, for the
+/// specified `processorId` of the clients of the specified `type`, and set
+/// it up to report its state according to the watermarks in the specified
+/// `config`.
+template <class QUEUE>
+QUEUE* createProcessorQueue(
+    mqbi::DispatcherClientType::Enum             type,
+    const mqbcfg::DispatcherProcessorParameters& config,
+    int                                          processorId,
+    int                                          capacity,
+    bslma::Allocator*                            allocator)
+{
+    mwcu::MemOutStream os;
+    os << "ProcessorQueue " << processorId << " for '" << type << "'";
+    bsl::string queueName(os.str().data(), os.str().length());
+
+    QUEUE* queue = new (*allocator) QUEUE(capacity, allocator);
+
+    queue->setWatermarks(config.queueSizeLowWatermark(),
+                         config.queueSizeHighWatermark());
+    queue->setStateCallback(
+        bdlf::BindUtil::bind(&mwcc::MonitoredQueueUtil::stateLogCallback,
+                             queueName,
+                             "ALARM [DISPATCHER]",  // warning string
+                             config.queueSizeLowWatermark(),
+                             config.queueSizeHighWatermark(),
+                             config.queueSize(),
+                             config.queueSize(),
+                             bdlf::PlaceHolders::_1));  // state
+
+    return queue;
+}
 }  // close unnamed namespace
 
 // -------------------------
@@ -178,18 +226,21 @@ void Dispatcher_ClientExecutor::post(const bsl::function<void()>& f) const
     BSLS_ASSERT(f);
     BSLS_ASSERT(processorPool()->isStarted());
 
+    mqbi::DispatcherClient* client = const_cast<mqbi::DispatcherClient*>(
+        d_client_p);
+
     // create an event containing the function to be invoked on the processor
     mwcc::MultiQueueThreadPool<mqbi::DispatcherEvent>::Event* event =
         processorPool()->getUnmanagedEvent();
 
     event->object()
         .setType(mqbi::DispatcherEventType::e_CALLBACK)
-        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(f))
-        .setDestination(const_cast<mqbi::DispatcherClient*>(d_client_p));
+        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(f));
 
-    // submit the event
-    int rc = processorPool()->enqueueEvent(event, processorHandle());
-    BSLS_ASSERT_OPT(rc == 0);
+    // submit the event through the dispatcher, which accounts for the client
+    // being migrated to another processor
+    static_cast<mqba::Dispatcher*>(client->dispatcher())
+        ->dispatchEvent(&event->object(), client);
 
     // TODO: We should call 'releaseUnmanagedEvent' on the
     //      'mwcc::MultiQueueThreadPool' in case of exception to prevent the
@@ -216,6 +267,54 @@ void Dispatcher_ClientExecutor::dispatch(const bsl::function<void()>& f) const
     }
 }
 
+// ---------------------------------
+// struct Dispatcher::ProcessorState
+// ---------------------------------
+
+Dispatcher::ProcessorState::ProcessorState(bslma::Allocator* allocator)
+: d_busyTime(0)
+, d_numEvents(0)
+, d_intervalStartTime(bsls::TimeUtil::getTimer())
+, d_clientLoads(allocator)
+, d_lastBusyTime(0)
+, d_lastInterval(0)
+, d_lastNumEvents(0)
+, d_lastClientLoads(allocator)
+, d_parkedEvents(allocator)
+{
+    // NOTHING
+}
+
+Dispatcher::ProcessorState::ProcessorState(const ProcessorState& original,
+                                           bslma::Allocator*     allocator)
+: d_busyTime(original.d_busyTime)
+, d_numEvents(original.d_numEvents)
+, d_intervalStartTime(original.d_intervalStartTime)
+, d_clientLoads(original.d_clientLoads, allocator)
+, d_lastBusyTime(original.d_lastBusyTime)
+, d_lastInterval(original.d_lastInterval)
+, d_lastNumEvents(original.d_lastNumEvents)
+, d_lastClientLoads(original.d_lastClientLoads, allocator)
+, d_parkedEvents(original.d_parkedEvents, allocator)
+{
+    // NOTHING
+}
+
+// ----------------------------
+// struct Dispatcher::Migration
+// ----------------------------
+
+Dispatcher::Migration::Migration()
+: d_client_p(0)
+, d_sourceProcessor(-1)
+, d_targetProcessor(-1)
+, d_isStarted(false)
+, d_isDrained(false)
+, d_isCancelled(false)
+{
+    // NOTHING
+}
+
 // ------------------------------------
 // struct Dispatcher::DispatcherContext
 // ------------------------------------
@@ -229,6 +328,14 @@ Dispatcher::DispatcherContext::DispatcherContext(
 , d_flushList(config.numProcessors(),
               DispatcherClientPtrVector(allocator),
               allocator)
+, d_isRebalancingEnabled(false)
+, d_rebalanceThresholdPercent(config.rebalanceThresholdPercent())
+, d_processorStates(config.numProcessors(),
+                    ProcessorState(allocator),
+                    allocator)
+, d_processorLoads(config.numProcessors(), ProcessorLoad(), allocator)
+, d_migration()
+, d_rebalanceEventHandle()
 {
     // NOTHING
 }
@@ -239,23 +346,46 @@ Dispatcher::DispatcherContext::DispatcherContext(
 
 int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                              mqbi::DispatcherClientType::Enum type,
-                             const mqbcfg::DispatcherProcessorConfig& config)
+                             const mqbcfg::DispatcherProcessorConfig& config,
+                             const bsl::string& cpuList)
 {
     enum RcEnum {
         // Value for the various RC error categories
         rc_SUCCESS                     = 0,
         rc_THREAD_POOL_START_FAILED    = -1,
-        rc_PROCESSOR_POOL_START_FAILED = -2
+        rc_PROCESSOR_POOL_START_FAILED = -2,
+        rc_INVALID_CPU_LIST            = -3
     };
 
     int rc = rc_SUCCESS;
 
+    bsl::vector<int> cpus(d_allocator_p);
+    rc = mwcsys::ThreadUtil::parseCpuList(&cpus, cpuList);
+    if (rc != 0) {
+        errorDescription << "Invalid CPU list '" << cpuList << "' for '"
+                         << type << "' dispatcher [rc: " << rc << "]";
+        return rc_INVALID_CPU_LIST;  // RETURN
+    }
+
     DispatcherContextSp& context = d_contexts[type];
 
     context.reset(new (*d_allocator_p)
                       DispatcherContext(config, d_allocator_p),
                   d_allocator_p);
 
+    // Clusters are always associated to a specific processor, and cache
+    // executors bound to that processor, so they are never rebalanced.
+    if (config.rebalanceIntervalMs() > 0) {
+        if (type == mqbi::DispatcherClientType::e_CLUSTER) {
+            BALL_LOG_WARN << "Ignoring 'rebalanceIntervalMs' for '" << type
+                          << "' dispatcher: clients of this type can not be "
+                          << "migrated between processors";
+        }
+        else {
+            context->d_isRebalancingEnabled = true;
+        }
+    }
+
     // Create and start the threadPool
     context->d_threadPool_mp.load(
         new (*d_allocator_p)
@@ -266,7 +396,20 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                               d_allocator_p),
         d_allocator_p);
 
-    rc = context->d_threadPool_mp->start();
+    {
+        // Threads inherit the affinity of the thread creating them, and the
+        // memory they first touch is allocated on their NUMA node, so
+        // pinning the threads while they are spawned is enough to keep the
+        // processors, and the state they allocate, on the configured CPUs.
+        mwcsys::ThreadAffinityGuard affinityGuard(cpus, d_allocator_p);
+        if (!cpus.empty() && !affinityGuard.isEngaged()) {
+            BALL_LOG_WARN << "Unable to restrict '" << type
+                          << "' dispatcher threads to CPUs '" << cpuList
+                          << "'";
+        }
+
+        rc = context->d_threadPool_mp->start();
+    }
     if (rc != 0) {
         context->d_threadPool_mp.clear();
         errorDescription << "Failed to start thread pool for '" << type
@@ -293,6 +436,26 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                              bdlf::PlaceHolders::_3),  // allocator*
         d_allocator_p);
 
+    processorPoolConfig.setEventBatchCallback(
+        bdlf::BindUtil::bind(&Dispatcher::queueEventsCb,
+                             this,
+                             type,
+                             bdlf::PlaceHolders::_1,    // processorId
+                             bdlf::PlaceHolders::_2,    // context*
+                             bdlf::PlaceHolders::_3,    // events**
+                             bdlf::PlaceHolders::_4));  // numEvents
+
+    if (config.processorConfig().useLockFreeQueue()) {
+        processorPoolConfig.setRingQueueCreator(
+            bdlf::BindUtil::bind(&Dispatcher::ringQueueCreator,
+                                 this,
+                                 type,
+                                 config.processorConfig(),
+                                 bdlf::PlaceHolders::_1,    // qCreatorRet*
+                                 bdlf::PlaceHolders::_2,    // processorId
+                                 bdlf::PlaceHolders::_3));  // allocator*
+    }
+
     processorPoolConfig.setName(mqbi::DispatcherClientType::toAscii(type))
         .setEventScheduler(d_scheduler_p)
         .setFinalizeEvents(ProcessorPool::Config::MWCC_FINALIZE_MULTI_QUEUE)
@@ -317,6 +480,13 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         return rc_PROCESSOR_POOL_START_FAILED;  // RETURN
     }
 
+    if (context->d_isRebalancingEnabled) {
+        d_scheduler_p->scheduleRecurringEvent(
+            &context->d_rebalanceEventHandle,
+            bsls::TimeInterval().addMilliseconds(config.rebalanceIntervalMs()),
+            bdlf::BindUtil::bind(&Dispatcher::rebalance, this, type));
+    }
+
     return rc_SUCCESS;
 }
 
@@ -327,26 +497,31 @@ Dispatcher::ProcessorPool::Queue* Dispatcher::queueCreator(
     int                                                    processorId,
     bslma::Allocator*                                      allocator)
 {
-    mwcu::MemOutStream os;
-    os << "ProcessorQueue " << processorId << " for '" << type << "'";
-    bsl::string queueName(os.str().data(), os.str().length());
-
-    ProcessorPool::Queue* queue = new (*allocator)
-        ProcessorPool::Queue(config.queueSizeLowWatermark(), allocator);
-
-    queue->setWatermarks(config.queueSizeLowWatermark(),
-                         config.queueSizeHighWatermark());
-    queue->setStateCallback(
-        bdlf::BindUtil::bind(&mwcc::MonitoredQueueUtil::stateLogCallback,
-                             queueName,
-                             "ALARM [DISPATCHER]",  // warning string
-                             config.queueSizeLowWatermark(),
-                             config.queueSizeHighWatermark(),
-                             config.queueSize(),
-                             config.queueSize(),
-                             bdlf::PlaceHolders::_1));  // state
+    // The default queue is unbounded: 'queueSizeLowWatermark' is only its
+    // initial capacity.
+    return createProcessorQueue<ProcessorPool::Queue>(
+        type,
+        config,
+        processorId,
+        config.queueSizeLowWatermark(),
+        allocator);
+}
 
-    return queue;
+Dispatcher::ProcessorPool::RingQueue* Dispatcher::ringQueueCreator(
+    mqbi::DispatcherClientType::Enum             type,
+    const mqbcfg::DispatcherProcessorParameters& config,
+    BSLS_ANNOTATION_UNUSED ProcessorPool::QueueCreatorRet* ret,
+    int                                                    processorId,
+    bslma::Allocator*                                      allocator)
+{
+    // The ring holds 'queueSize' events; beyond that, events spill to an
+    // unbounded overflow list so that a processor enqueuing on itself never
+    // waits for itself.  The usual 'queueSize' watermarks still apply.
+    return createProcessorQueue<ProcessorPool::RingQueue>(type,
+                                                          config,
+                                                          processorId,
+                                                          config.queueSize(),
+                                                          allocator);
 }
 
 void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
@@ -354,47 +529,26 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
                               BSLS_ANNOTATION_UNUSED void*     context,
                               const ProcessorPool::Event*      event)
 {
+    DispatcherContext& dispatcherContext = *(d_contexts[type]);
+
     switch (event->type()) {
     case ProcessorPool::Event::MWCC_USER: {
         BALL_LOG_TRACE << "Dispatching Event to queue " << processorId
                        << " of " << type << " dispatcher: " << event->object();
-        if (event->object().type() ==
-            mqbi::DispatcherEventType::e_DISPATCHER) {
-            const mqbi::DispatcherDispatcherEvent* realEvent =
-                event->object().asDispatcherEvent();
-
-            // We must flush now (and irrespective of a callback actually being
-            // set on the event) to ensure the flushList is empty before
-            // executing the callback: this dispatcher event may correspond to
-            // the destruction of the Client, and guaranteeing this client is
-            // not (and will not be added) to the flushList is actually the
-            // whole purpose of the 'e_DISPATCHER' event type.
-            flushClients(type, processorId);
 
-            if (realEvent->callback()) {
-                // A callback may not have been set if all we wanted was to
-                // execute the 'finalizeCallback' of the event.
-                realEvent->callback()(processorId);
-            }
-        }
-        else {
-            DispatcherContext& dispatcherContext = *(d_contexts[type]);
-            event->object().destination()->onDispatcherEvent(event->object());
-            if (!event->object()
-                     .destination()
-                     ->dispatcherClientData()
-                     .addedToFlushList()) {
-                dispatcherContext.d_flushList[processorId].emplace_back(
-                    event->object().destination());
-                event->object()
-                    .destination()
-                    ->dispatcherClientData()
-                    .setAddedToFlushList(true);
-            }
-        }
+        const mqbi::DispatcherEvent* dispatcherEvent = &event->object();
+        processEvents(type, processorId, &dispatcherEvent, 1);
     } break;
     case ProcessorPool::Event::MWCC_QUEUE_EMPTY: {
+        if (!dispatcherContext.d_isRebalancingEnabled) {
+            flushClients(type, processorId);
+            break;  // BREAK
+        }
+
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
         flushClients(type, processorId);
+        dispatcherContext.d_processorStates[processorId].d_busyTime +=
+            bsls::TimeUtil::getTimer() - startTime;
     } break;
     case ProcessorPool::Event::MWCC_FINALIZE_EVENT: {
         // We only set finalizeCallback on e_DISPATCHER events
@@ -414,6 +568,163 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
     }
 }
 
+void Dispatcher::queueEventsCb(mqbi::DispatcherClientType::Enum type,
+                               int                              processorId,
+                               BSLS_ANNOTATION_UNUSED void*     context,
+                               ProcessorPool::Event**           events,
+                               int                              numEvents)
+{
+    // executed by the *DISPATCHER* thread
+
+    const mqbi::DispatcherEvent* batch[k_MAX_EVENTS_PER_CLIENT_BATCH];
+
+    int i = 0;
+    while (i < numEvents) {
+        const mqbi::DispatcherEvent& first = events[i]->object();
+
+        BALL_LOG_TRACE << "Dispatching Event to queue " << processorId
+                       << " of " << type << " dispatcher: " << first;
+
+        batch[0] = &first;
+        ++i;
+
+        int numBatchEvents = 1;
+
+        // Gather the following events of the same type destined to the same
+        // client.  'e_DISPATCHER' events are always processed on their own,
+        // as they may act on the flush list or on the client itself.
+        if (first.type() != mqbi::DispatcherEventType::e_DISPATCHER) {
+            while (i < numEvents &&
+                   numBatchEvents < k_MAX_EVENTS_PER_CLIENT_BATCH) {
+                const mqbi::DispatcherEvent& next = events[i]->object();
+                if (next.type() != first.type() ||
+                    next.destination() != first.destination()) {
+                    break;  // BREAK
+                }
+
+                BALL_LOG_TRACE << "Dispatching Event to queue " << processorId
+                               << " of " << type << " dispatcher: " << next;
+
+                batch[numBatchEvents++] = &next;
+                ++i;
+            }
+        }
+
+        processEvents(type, processorId, batch, numBatchEvents);
+    }
+}
+
+void Dispatcher::processEvents(mqbi::DispatcherClientType::Enum    type,
+                               int                                 processorId,
+                               const mqbi::DispatcherEvent* const* events,
+                               int                                 numEvents)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numEvents > 0);
+
+    DispatcherContext& dispatcherContext = *(d_contexts[type]);
+
+    if (!dispatcherContext.d_isRebalancingEnabled) {
+        deliverEvents(type, processorId, events, numEvents);
+        return;  // RETURN
+    }
+
+    mqbi::DispatcherClient* destination = events[0]->destination();
+    const bool              isMigratable =
+        destination && destination->dispatcherClientData().isMigratable();
+    ProcessorState& state = dispatcherContext.d_processorStates[processorId];
+
+    if (isMigratable &&
+        destination->dispatcherClientData().processorHandle() !=
+            processorId) {
+        // The destination is being migrated to this processor, but is still
+        // owned by its previous processor: hold the events aside until the
+        // migration completes (see 'completeMigration').
+        DispatcherEventSpVector& parkedEvents =
+            state.d_parkedEvents[destination];
+        for (int i = 0; i < numEvents; ++i) {
+            bsl::shared_ptr<mqbi::DispatcherEvent> parkedEvent =
+                bsl::allocate_shared<mqbi::DispatcherEvent>(d_allocator_p);
+            *parkedEvent = *events[i];
+            parkedEvents.push_back(parkedEvent);
+        }
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    deliverEvents(type, processorId, events, numEvents);
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - startTime;
+
+    // Note that 'destination' may have been destroyed while processing the
+    // events, hence it is only used as a key from now on.
+    state.d_busyTime += elapsed;
+    state.d_numEvents += numEvents;
+    if (isMigratable) {
+        state.d_clientLoads[destination] += elapsed;
+    }
+}
+
+void Dispatcher::deliverEvents(mqbi::DispatcherClientType::Enum    type,
+                               int                                 processorId,
+                               const mqbi::DispatcherEvent* const* events,
+                               int                                 numEvents)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (numEvents == 1) {
+        processEvent(type, processorId, *events[0]);
+        return;  // RETURN
+    }
+
+    mqbi::DispatcherClient* destination = events[0]->destination();
+    destination->onDispatcherEvents(events, numEvents);
+    addToFlushList(type, processorId, destination);
+}
+
+void Dispatcher::addToFlushList(mqbi::DispatcherClientType::Enum type,
+                                int                              processorId,
+                                mqbi::DispatcherClient*          client)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!client->dispatcherClientData().addedToFlushList()) {
+        d_contexts[type]->d_flushList[processorId].emplace_back(client);
+        client->dispatcherClientData().setAddedToFlushList(true);
+    }
+}
+
+void Dispatcher::processEvent(mqbi::DispatcherClientType::Enum type,
+                              int                              processorId,
+                              const mqbi::DispatcherEvent&     event)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (event.type() == mqbi::DispatcherEventType::e_DISPATCHER) {
+        const mqbi::DispatcherDispatcherEvent* realEvent =
+            event.asDispatcherEvent();
+
+        // We must flush now (and irrespective of a callback actually being
+        // set on the event) to ensure the flushList is empty before executing
+        // the callback: this dispatcher event may correspond to the
+        // destruction of the Client, and guaranteeing this client is not (and
+        // will not be added) to the flushList is actually the whole purpose of
+        // the 'e_DISPATCHER' event type.
+        flushClients(type, processorId);
+
+        if (realEvent->callback()) {
+            // A callback may not have been set if all we wanted was to
+            // execute the 'finalizeCallback' of the event.
+            realEvent->callback()(processorId);
+        }
+    }
+    else {
+        event.destination()->onDispatcherEvent(event);
+        addToFlushList(type, processorId, event.destination());
+    }
+}
+
 void Dispatcher::flushClients(mqbi::DispatcherClientType::Enum type,
                               int                              processorId)
 {
@@ -446,14 +757,348 @@ void Dispatcher::onNewClient(mqbi::DispatcherClientType::Enum type,
     }
 }
 
+void Dispatcher::executeOnProcessor(
+    mqbi::DispatcherClientType::Enum          type,
+    int                                       processorId,
+    const mqbi::Dispatcher::ProcessorFunctor& functor)
+{
+    mqbi::DispatcherEvent* event = getEvent(type);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_DISPATCHER)
+        .setCallback(functor);
+    dispatchEvent(event, type, processorId);
+}
+
+void Dispatcher::rebalance(mqbi::DispatcherClientType::Enum type)
+{
+    // executed by the *SCHEDULER* thread
+
+    execute(bdlf::BindUtil::bind(&Dispatcher::snapshotLoad,
+                                 this,
+                                 type,
+                                 bdlf::PlaceHolders::_1),  // processor
+            type,
+            bdlf::BindUtil::bind(&Dispatcher::onLoadSnapshot, this, type));
+}
+
+void Dispatcher::snapshotLoad(mqbi::DispatcherClientType::Enum type,
+                              int                              processorId)
+{
+    // executed by the *DISPATCHER* thread
+
+    ProcessorState& state = d_contexts[type]->d_processorStates[processorId];
+
+    // The 'd_last...' members are read by 'onLoadSnapshot', once all
+    // processors executed this method.
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+    state.d_lastBusyTime         = state.d_busyTime;
+    state.d_lastInterval         = now - state.d_intervalStartTime;
+    state.d_lastNumEvents        = state.d_numEvents;
+    state.d_lastClientLoads.swap(state.d_clientLoads);
+
+    state.d_busyTime          = 0;
+    state.d_numEvents         = 0;
+    state.d_intervalStartTime = now;
+    state.d_clientLoads.clear();
+}
+
+void Dispatcher::onLoadSnapshot(mqbi::DispatcherClientType::Enum type)
+{
+    // executed by *ANY* DISPATCHER thread of the 'type', once all of them
+    // executed 'snapshotLoad'
+
+    DispatcherContext& context       = *(d_contexts[type]);
+    const int          numProcessors = context.d_processorStates.size();
+
+    int busiestProcessor = 0;
+    int idlestProcessor  = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+        for (int i = 0; i < numProcessors; ++i) {
+            const ProcessorState& state = context.d_processorStates[i];
+            ProcessorLoad&        load  = context.d_processorLoads[i];
+
+            load.d_busyPercent = state.d_lastInterval > 0
+                                     ? bsl::min(100LL,
+                                                state.d_lastBusyTime * 100 /
+                                                    state.d_lastInterval)
+                                     : 0;
+            load.d_numEvents   = state.d_lastNumEvents;
+
+            if (load.d_busyPercent >
+                context.d_processorLoads[busiestProcessor].d_busyPercent) {
+                busiestProcessor = i;
+            }
+            if (load.d_busyPercent <
+                context.d_processorLoads[idlestProcessor].d_busyPercent) {
+                idlestProcessor = i;
+            }
+        }
+
+        if (context.d_migration.d_client_p) {
+            // Wait for the migration in progress to complete before
+            // measuring its effect.
+            return;  // RETURN
+        }
+    }
+
+    const int gapPercent =
+        context.d_processorLoads[busiestProcessor].d_busyPercent -
+        context.d_processorLoads[idlestProcessor].d_busyPercent;
+    if (gapPercent < context.d_rebalanceThresholdPercent ||
+        gapPercent == 0) {
+        return;  // RETURN
+    }
+
+    // Pick the hottest client of the busiest processor whose load is at most
+    // half of the gap: moving it to the idlest processor reduces the gap
+    // without making the idlest processor the busiest one, which would cause
+    // the client to bounce back and forth between the two processors.
+    const ProcessorState& busiestState =
+        context.d_processorStates[busiestProcessor];
+    mqbi::DispatcherClient* candidate     = 0;
+    bsls::Types::Int64      candidateLoad = 0;
+    for (ClientLoadMap::const_iterator it =
+             busiestState.d_lastClientLoads.begin();
+         it != busiestState.d_lastClientLoads.end();
+         ++it) {
+        const bsls::Types::Int64 loadPercent = it->second * 100 /
+                                               busiestState.d_lastInterval;
+        if (loadPercent * 2 <= gapPercent && it->second > candidateLoad) {
+            candidate     = it->first;
+            candidateLoad = it->second;
+        }
+    }
+
+    if (!candidate) {
+        BALL_LOG_DEBUG << "No client of '" << type << "' processor "
+                       << busiestProcessor << " can be migrated to processor "
+                       << idlestProcessor << " [gap: " << gapPercent << "%]";
+        return;  // RETURN
+    }
+
+    BALL_LOG_DEBUG << "Requesting migration of a '" << type << "' client "
+                   << "from processor " << busiestProcessor
+                   << " to processor " << idlestProcessor
+                   << " [gap: " << gapPercent << "%, client load: "
+                   << candidateLoad * 100 / busiestState.d_lastInterval
+                   << "%]";
+
+    requestMigration(type, candidate, busiestProcessor, idlestProcessor);
+}
+
+int Dispatcher::requestMigration(
+    mqbi::DispatcherClientType::Enum type,
+    mqbi::DispatcherClient*          client,
+    int                              sourceProcessor,
+    int                              targetProcessor)
+{
+    // executed by *ANY* thread
+
+    DispatcherContext& context = *(d_contexts[type]);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+        if (context.d_migration.d_client_p) {
+            return -1;  // RETURN
+        }
+
+        context.d_migration.d_client_p        = client;
+        context.d_migration.d_sourceProcessor = sourceProcessor;
+        context.d_migration.d_targetProcessor = targetProcessor;
+    }
+
+    executeOnProcessor(type,
+                       sourceProcessor,
+                       bdlf::BindUtil::bind(&Dispatcher::startMigration,
+                                            this,
+                                            type,
+                                            bdlf::PlaceHolders::_1));
+    return 0;
+}
+
+void Dispatcher::startMigration(mqbi::DispatcherClientType::Enum type,
+                                int                              processorId)
+{
+    // executed by the *DISPATCHER* thread of the source processor
+
+    DispatcherContext& context = *(d_contexts[type]);
+    int                targetProcessor;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+        Migration& migration = context.d_migration;
+        BSLS_ASSERT_SAFE(migration.d_client_p && !migration.d_isStarted);
+        BSLS_ASSERT_SAFE(migration.d_sourceProcessor == processorId);
+
+        // The client may have been unregistered, and destroyed, since the
+        // migration was requested: only access it if it is still registered
+        // to this processor (unregistering a client locks
+        // 'd_rebalanceMutex').
+        mqbi::DispatcherClient* client = migration.d_client_p;
+        if (migration.d_isCancelled ||
+            context.d_loadBalancer.processorForClient(client) != processorId ||
+            !client->dispatcherClientData().isMigratable() ||
+            client->dispatcherClientData().processorHandle() != processorId) {
+            migration = Migration();
+            return;  // RETURN
+        }
+
+        // From now on, new events for the client are enqueued to the target
+        // processor, which holds them aside until the client is handed over.
+        targetProcessor = migration.d_targetProcessor;
+        context.d_loadBalancer.moveClient(client, targetProcessor);
+        client->dispatcherClientData().setDestinationProcessorHandle(
+            targetProcessor);
+        migration.d_isStarted = true;
+
+        mwcu::MemOutStream os;
+        os << bdlt::CurrentTime::utc() << " " << type << " '"
+           << client->description() << "': processor " << processorId
+           << " -> " << targetProcessor;
+        d_recentMigrations.emplace_back(os.str().data(), os.str().length());
+        if (d_recentMigrations.size() > k_MAX_RECENT_MIGRATIONS) {
+            d_recentMigrations.pop_front();
+        }
+
+        BALL_LOG_INFO << "Migrating '" << type << "' client '"
+                      << client->description() << "' from processor "
+                      << processorId << " to processor " << targetProcessor;
+    }
+
+    executeOnProcessor(type,
+                       processorId,
+                       bdlf::BindUtil::bind(&Dispatcher::drainMigration,
+                                            this,
+                                            type,
+                                            bdlf::PlaceHolders::_1));
+}
+
+void Dispatcher::drainMigration(mqbi::DispatcherClientType::Enum type,
+                                int                              processorId)
+{
+    // executed by the *DISPATCHER* thread of the source processor
+
+    DispatcherContext& context = *(d_contexts[type]);
+    bool               isDone  = false;
+    int                targetProcessor;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+        Migration& migration = context.d_migration;
+        BSLS_ASSERT_SAFE(migration.d_client_p && migration.d_isStarted);
+        BSLS_ASSERT_SAFE(migration.d_sourceProcessor == processorId);
+
+        targetProcessor = migration.d_targetProcessor;
+        if (migration.d_isCancelled || migration.d_isDrained) {
+            // All events enqueued for the client to this processor have been
+            // processed, since they were enqueued before this event.
+            isDone = true;
+        }
+        else if (0 == migration.d_client_p->dispatcherClientData()
+                          .numDispatchesInFlight()) {
+            // Any thread enqueuing an event for the client from now on
+            // enqueues it to the target processor, and all threads which
+            // enqueued an event to this processor are done: their events are
+            // ahead of the next event enqueued to this processor.
+            migration.d_isDrained = true;
+        }
+    }
+
+    if (isDone) {
+        executeOnProcessor(type,
+                           targetProcessor,
+                           bdlf::BindUtil::bind(&Dispatcher::completeMigration,
+                                                this,
+                                                type,
+                                                bdlf::PlaceHolders::_1));
+    }
+    else {
+        executeOnProcessor(type,
+                           processorId,
+                           bdlf::BindUtil::bind(&Dispatcher::drainMigration,
+                                                this,
+                                                type,
+                                                bdlf::PlaceHolders::_1));
+    }
+}
+
+void Dispatcher::completeMigration(
+    mqbi::DispatcherClientType::Enum type,
+    int                              processorId)
+{
+    // executed by the *DISPATCHER* thread of the target processor
+
+    DispatcherContext&            context = *(d_contexts[type]);
+    const mqbi::DispatcherClient* client;
+    bool                          isCancelled;
+    int                           sourceProcessor;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+        Migration& migration = context.d_migration;
+        BSLS_ASSERT_SAFE(migration.d_client_p && migration.d_isStarted);
+        BSLS_ASSERT_SAFE(migration.d_targetProcessor == processorId);
+
+        client          = migration.d_client_p;
+        isCancelled     = migration.d_isCancelled;
+        sourceProcessor = migration.d_sourceProcessor;
+        if (!isCancelled) {
+            migration.d_client_p->dispatcherClientData().setProcessorHandle(
+                processorId);
+        }
+        migration = Migration();
+    }
+
+    // Process the events held aside for the client, before any event enqueued
+    // after this one.  If the client was unregistered, only the
+    // 'e_DISPATCHER' events (such as the ones of 'synchronize') are processed.
+    ProcessorState& state         = context.d_processorStates[processorId];
+    size_t          numParked     = 0;
+    ParkedEventsMap::iterator it  = state.d_parkedEvents.find(client);
+    if (it != state.d_parkedEvents.end()) {
+        DispatcherEventSpVector events(d_allocator_p);
+        events.swap(it->second);
+        state.d_parkedEvents.erase(it);
+
+        numParked = events.size();
+        for (size_t i = 0; i < events.size(); ++i) {
+            if (isCancelled && events[i]->type() !=
+                                   mqbi::DispatcherEventType::e_DISPATCHER) {
+                continue;  // CONTINUE
+            }
+            processEvent(type, processorId, *events[i]);
+        }
+    }
+
+    if (isCancelled) {
+        BALL_LOG_INFO << "Cancelled migration of unregistered '" << type
+                      << "' client from processor " << sourceProcessor
+                      << " to processor " << processorId
+                      << " [numHeldEvents: " << numParked << "]";
+        return;  // RETURN
+    }
+
+    mqbstat::BrokerStats::instance().onEvent(
+        mqbstat::BrokerStats::EventType::e_DISPATCHER_CLIENT_MIGRATED);
+
+    BALL_LOG_INFO << "Migrated '" << type << "' client from processor "
+                  << sourceProcessor << " to processor " << processorId
+                  << " [numHeldEvents: " << numParked << "]";
+}
+
 Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
                        bdlmt::EventScheduler*          scheduler,
                        bslma::Allocator*               allocator)
 : d_allocator_p(allocator)
 , d_isStarted(false)
 , d_config(config)
+, d_threadPlacement(allocator)
 , d_scheduler_p(scheduler)
 , d_contexts(allocator)
+, d_rebalanceMutex()
+, d_recentMigrations(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(scheduler->clockType() ==
@@ -467,6 +1112,15 @@ Dispatcher::~Dispatcher()
                     "stop() must be called before destroying this object");
 }
 
+void Dispatcher::setThreadPlacement(
+    const mqbcfg::ThreadPlacementConfig& placement)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(!d_isStarted);
+
+    d_threadPlacement = placement;
+}
+
 int Dispatcher::start(bsl::ostream& errorDescription)
 {
     // PRECONDITIONS
@@ -482,7 +1136,8 @@ int Dispatcher::start(bsl::ostream& errorDescription)
     // SESSION
     rc = startContext(errorDescription,
                       mqbi::DispatcherClientType::e_SESSION,
-                      d_config.sessions());
+                      d_config.sessions(),
+                      d_threadPlacement.sessions());
     if (rc != 0) {
         return rc;  // RETURN
     }
@@ -490,7 +1145,8 @@ int Dispatcher::start(bsl::ostream& errorDescription)
     // QUEUE
     rc = startContext(errorDescription,
                       mqbi::DispatcherClientType::e_QUEUE,
-                      d_config.queues());
+                      d_config.queues(),
+                      d_threadPlacement.queues());
     if (rc != 0) {
         return rc;  // RETURN
     }
@@ -498,7 +1154,8 @@ int Dispatcher::start(bsl::ostream& errorDescription)
     // CLUSTER
     rc = startContext(errorDescription,
                       mqbi::DispatcherClientType::e_CLUSTER,
-                      d_config.clusters());
+                      d_config.clusters(),
+                      d_threadPlacement.clusters());
     if (rc != 0) {
         return rc;  // RETURN
     }
@@ -528,6 +1185,14 @@ void Dispatcher::stop()
 
     d_isStarted = false;
 
+    // Stop rebalancing before stopping the processors it relies on
+    for (size_t i = 0; i < d_contexts.size(); ++i) {
+        if (d_contexts[i]->d_isRebalancingEnabled) {
+            d_scheduler_p->cancelEventAndWait(
+                &d_contexts[i]->d_rebalanceEventHandle);
+        }
+    }
+
 #define STOP_AND_CLEAR(OBJ)                                                   \
     if (OBJ) {                                                                \
         OBJ->stop();                                                          \
@@ -575,9 +1240,16 @@ Dispatcher::registerClient(mqbi::DispatcherClient*           client,
         else {
             context.d_loadBalancer.setProcessorForClient(client, processor);
         }
+
+        // Only clients which were not associated to a specific processor
+        // can be migrated to another processor.
+        const bool isMigratable =
+            context.d_isRebalancingEnabled &&
+            handle == mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE;
         client->dispatcherClientData()
             .setDispatcher(this)
             .setClientType(type)
+            .setMigratable(isMigratable)
             .setProcessorHandle(processor);
 
         BALL_LOG_DEBUG << "Registered a new client to the dispatcher "
@@ -598,8 +1270,7 @@ Dispatcher::registerClient(mqbi::DispatcherClient*           client,
                 bdlf::BindUtil::bind(&Dispatcher::onNewClient,
                                      this,
                                      type,
-                                     bdlf::PlaceHolders::_1))  // processor
-            .setDestination(client);                           // not needed
+                                     bdlf::PlaceHolders::_1));  // processor
         context.d_processorPool_mp->enqueueEvent(event, processor);
         return processor;  // RETURN
     }                      // break;
@@ -625,7 +1296,15 @@ void Dispatcher::unregisterClient(mqbi::DispatcherClient* client)
     case mqbi::DispatcherClientType::e_SESSION:
     case mqbi::DispatcherClientType::e_QUEUE:
     case mqbi::DispatcherClientType::e_CLUSTER: {
-        d_contexts[type]->d_loadBalancer.removeClient(client);
+        DispatcherContext& context = *(d_contexts[type]);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+        if (context.d_migration.d_client_p == client) {
+            // Prevent the migration in progress from accessing the client
+            // once it is destroyed.
+            context.d_migration.d_isCancelled = true;
+        }
+        context.d_loadBalancer.removeClient(client);
     } break;
     case mqbi::DispatcherClientType::e_UNDEFINED:
     case mqbi::DispatcherClientType::e_ALL:
@@ -700,8 +1379,23 @@ void Dispatcher::execute(const mqbi::Dispatcher::ProcessorFunctor& functor,
 
 void Dispatcher::synchronize(mqbi::DispatcherClient* client)
 {
-    synchronize(client->dispatcherClientData().clientType(),
-                client->dispatcherClientData().processorHandle());
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!inDispatcherThread(client));  // Deadlock detection
+
+    typedef void (bslmt::Semaphore::*PostFn)();
+
+    // Dispatch the event to the client, rather than to its processor, so that
+    // it is processed after all the events previously dispatched to the
+    // client, even if the client is being migrated to another processor.
+    bslmt::Semaphore       semaphore;
+    mqbi::DispatcherEvent* event = getEvent(client);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_DISPATCHER)
+        .setCallback(
+            bdlf::BindUtil::bind(static_cast<PostFn>(&bslmt::Semaphore::post),
+                                 &semaphore));
+    dispatchEvent(event, client);
+    semaphore.wait();
 }
 
 void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
@@ -725,6 +1419,86 @@ void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
     semaphore.wait();
 }
 
+int Dispatcher::migrateClient(mqbi::DispatcherClient*           client,
+                              mqbi::Dispatcher::ProcessorHandle handle)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS               = 0,
+        rc_NOT_MIGRATABLE        = -1,
+        rc_INVALID_PROCESSOR     = -2,
+        rc_MIGRATION_IN_PROGRESS = -3
+    };
+
+    const mqbi::DispatcherClientData& data = client->dispatcherClientData();
+    if (!data.isMigratable()) {
+        return rc_NOT_MIGRATABLE;  // RETURN
+    }
+
+    const mqbi::DispatcherClientType::Enum type = data.clientType();
+    if (handle < 0 || handle >= numProcessors(type) ||
+        handle == data.processorHandle()) {
+        return rc_INVALID_PROCESSOR;  // RETURN
+    }
+
+    if (requestMigration(type, client, data.processorHandle(), handle) != 0) {
+        return rc_MIGRATION_IN_PROGRESS;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int Dispatcher::processCommand(mqbcmd::StatResult*        result,
+                               const mqbcmd::StatCommand& command)
+{
+    if (!command.isDispatcherValue()) {
+        mwcu::MemOutStream os;
+        os << "Unknown command '" << command << "'";
+        result->makeError();
+        result->error().message() = os.str();
+        return -1;  // RETURN
+    }
+
+    static const mqbi::DispatcherClientType::Enum k_TYPES[] = {
+        mqbi::DispatcherClientType::e_SESSION,
+        mqbi::DispatcherClientType::e_QUEUE,
+        mqbi::DispatcherClientType::e_CLUSTER};
+
+    mwcu::MemOutStream             os;
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceMutex);  // LOCK
+
+    for (size_t t = 0; t < sizeof(k_TYPES) / sizeof(k_TYPES[0]); ++t) {
+        const DispatcherContext& context = *(d_contexts[k_TYPES[t]]);
+
+        os << k_TYPES[t] << " processors (rebalancing "
+           << (context.d_isRebalancingEnabled ? "enabled" : "disabled")
+           << "):\n";
+        for (int i = 0; i < context.d_processorPool_mp->numQueues(); ++i) {
+            os << "  processor " << i << ": clients "
+               << context.d_loadBalancer.clientsCountForProcessor(i)
+               << ", queue depth "
+               << context.d_processorPool_mp->numElements(i);
+            if (context.d_isRebalancingEnabled) {
+                os << ", events " << context.d_processorLoads[i].d_numEvents
+                   << ", busy " << context.d_processorLoads[i].d_busyPercent
+                   << "%";
+            }
+            os << "\n";
+        }
+    }
+
+    os << "Recent migrations:\n";
+    if (d_recentMigrations.empty()) {
+        os << "  none\n";
+    }
+    for (size_t i = 0; i < d_recentMigrations.size(); ++i) {
+        os << "  " << d_recentMigrations[i] << "\n";
+    }
+
+    result->makeStats(os.str());
+    return 0;
+}
+
 mwcex::Executor
 Dispatcher::executor(const mqbi::DispatcherClient* client) const
 {
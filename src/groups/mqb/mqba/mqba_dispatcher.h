@@ -47,6 +47,46 @@
 // the submitted functor to be executed in-place.  A call to 'dispatch' from
 // outside of the executor's associated processor thread is equivalent to a
 // call to 'post'.
+//
+// Note that executors returned by 'executor' are bound to the processor in
+// charge of the client at the time they are created: clients which may be
+// migrated (see below) must use 'clientExecutor' instead.
+//
+/// Load rebalancing
+///----------------
+// Clients are initially associated to the processor having the lowest number
+// of clients, which does not account for the amount of work each client
+// actually generates.  When 'rebalanceIntervalMs' is set in the configuration
+// of a client type, the dispatcher measures the time each processor of that
+// type spends processing events, as well as the share of that time spent on
+// each migratable client, and every 'rebalanceIntervalMs' compares the busy
+// ratio of its processors.  If the difference between the busiest and the
+// least busy processor exceeds 'rebalanceThresholdPercent', the hottest client
+// of the busiest processor whose load is at most half of that difference is
+// migrated to the least busy processor.  At most one migration per client type
+// is in progress at any time.
+//
+// Only clients of type 'e_SESSION' or 'e_QUEUE' which were registered without
+// an explicit processor handle are migratable: clients registered with a
+// specific handle (such as queues of a cluster, which must be processed by the
+// processor of their partition) are pinned to that processor.
+//
+// A migration preserves the order and the single-threaded processing of the
+// events of the client, as follows:
+//: 1 In the thread of the source processor, new events for the client start
+//:   being enqueued to the target processor, which holds them aside since the
+//:   client is still owned by the source processor.
+//: 2 The source processor then waits (by re-enqueuing a marker event to
+//:   itself) until no thread is in the middle of enqueuing an event for the
+//:   client to the source processor, and processes all events previously
+//:   enqueued for the client.
+//: 3 The source processor hands the client over to the target processor,
+//:   which becomes its owner and processes the events it held aside, in
+//:   order, before any subsequent event.
+//
+// The load of each processor and the most recent migrations are reported by
+// the 'STAT DISPATCHER' admin command, and the number of migrations is
+// published as a broker statistic.
 
 // MQB
 
@@ -60,22 +100,29 @@
 
 // BDE
 #include <ball_log.h>
+#include <bdlmt_eventscheduler.h>
 #include <bdlmt_threadpool.h>
+#include <bsl_deque.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
 // FORWARD DECLARATION
-namespace bdlmt {
-class EventScheduler;
+namespace mqbcmd {
+class StatCommand;
+class StatResult;
 }
 
 namespace mqba {
@@ -222,6 +269,123 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
 
     typedef bsl::vector<mqbi::DispatcherClient*> DispatcherClientPtrVector;
 
+    typedef bsl::vector<bsl::shared_ptr<mqbi::DispatcherEvent> >
+        DispatcherEventSpVector;
+
+    /// Map of the events held aside by a processor for each client being
+    /// migrated to it, in the order they were received.
+    typedef bsl::unordered_map<const mqbi::DispatcherClient*,
+                               DispatcherEventSpVector>
+        ParkedEventsMap;
+
+    /// Map of the time, in nanoseconds, spent by a processor processing
+    /// the events of each migratable client.
+    typedef bsl::unordered_map<mqbi::DispatcherClient*, bsls::Types::Int64>
+        ClientLoadMap;
+
+    /// State of a processor used to measure its load and to migrate
+    /// clients, only manipulated from the thread of that processor (except
+    /// for the `d_last...` members, see `snapshotLoad`).
+    struct ProcessorState {
+        // PUBLIC DATA
+        bsls::Types::Int64 d_busyTime;
+        // Time, in nanoseconds, spent processing
+        // events since the start of the current
+        // interval
+
+        bsls::Types::Int64 d_numEvents;
+        // Number of events processed since the
+        // start of the current interval
+
+        bsls::Types::Int64 d_intervalStartTime;
+        // Start time of the current interval, as
+        // returned by 'bsls::TimeUtil::getTimer'
+
+        ClientLoadMap d_clientLoads;
+        // Time spent on each migratable client
+        // since the start of the current interval
+
+        bsls::Types::Int64 d_lastBusyTime;
+        // 'd_busyTime' of the last complete
+        // interval
+
+        bsls::Types::Int64 d_lastInterval;
+        // Duration, in nanoseconds, of the last
+        // complete interval
+
+        bsls::Types::Int64 d_lastNumEvents;
+        // 'd_numEvents' of the last complete
+        // interval
+
+        ClientLoadMap d_lastClientLoads;
+        // 'd_clientLoads' of the last complete
+        // interval
+
+        ParkedEventsMap d_parkedEvents;
+        // Events held aside for clients being
+        // migrated to this processor
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(ProcessorState,
+                                       bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create a new object using the specified `allocator`.
+        explicit ProcessorState(bslma::Allocator* allocator);
+
+        /// Create a new object having the same value as the specified
+        /// `original` object, using the specified `allocator`.
+        ProcessorState(const ProcessorState& original,
+                       bslma::Allocator*     allocator);
+    };
+
+    /// Load of a processor over the last complete interval, as reported by
+    /// the `STAT DISPATCHER` command.
+    struct ProcessorLoad {
+        // PUBLIC DATA
+        int d_busyPercent;
+        // Percentage of the interval spent
+        // processing events
+
+        bsls::Types::Int64 d_numEvents;
+        // Number of events processed during the
+        // interval
+    };
+
+    /// State of the migration of a client from one processor to another.
+    /// A migration is pending until it is started by the source processor.
+    struct Migration {
+        // PUBLIC DATA
+        mqbi::DispatcherClient* d_client_p;
+        // Client being migrated, or null if no
+        // migration is in progress
+
+        int d_sourceProcessor;
+        // Processor the client is migrated from
+
+        int d_targetProcessor;
+        // Processor the client is migrated to
+
+        bool d_isStarted;
+        // Whether events for the client are
+        // enqueued to the target processor
+
+        bool d_isDrained;
+        // Whether no thread was enqueuing an
+        // event for the client to the source
+        // processor after the migration started
+
+        bool d_isCancelled;
+        // Whether the client was unregistered
+        // while being migrated
+
+        // CREATORS
+
+        /// Create an object representing no migration.
+        Migration();
+    };
+
     /// Context for a dispatcher, with threads and pools
     struct DispatcherContext {
       private:
@@ -256,6 +420,35 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
         // corresponds to the
         // processor.
 
+        bool d_isRebalancingEnabled;
+        // Whether the load of the
+        // processors is measured
+        // and clients are migrated
+        // between processors
+
+        int d_rebalanceThresholdPercent;
+        // Minimum difference of busy
+        // ratio between processors
+        // triggering a migration
+
+        bsl::vector<ProcessorState> d_processorStates;
+        // State of each processor,
+        // indexed by processor
+
+        bsl::vector<ProcessorLoad> d_processorLoads;
+        // Last reported load of each
+        // processor, protected by
+        // 'Dispatcher::d_rebalanceMutex'
+
+        Migration d_migration;
+        // Migration in progress, if
+        // any, protected by
+        // 'Dispatcher::d_rebalanceMutex'
+
+        bdlmt::EventScheduler::RecurringEventHandle d_rebalanceEventHandle;
+        // Handle to the recurring
+        // rebalancing event
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(DispatcherContext,
                                        bslma::UsesBslmaAllocator)
@@ -286,6 +479,10 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     mqbcfg::DispatcherConfig d_config;
     // Configuration for the dispatcher
 
+    mqbcfg::ThreadPlacementConfig d_threadPlacement;
+    // CPUs the processors of each client type
+    // are restricted to
+
     bdlmt::EventScheduler* d_scheduler_p;
     // Event scheduler to use
 
@@ -293,6 +490,15 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     // The various context, one for each
     // ClientType
 
+    mutable bslmt::Mutex d_rebalanceMutex;
+    // Mutex protecting the migration state and
+    // the reported load of the contexts, as
+    // well as 'd_recentMigrations'
+
+    bsl::deque<bsl::string> d_recentMigrations;
+    // Description of the most recently started
+    // migrations, most recent last
+
     // FRIENDS
     friend class Dispatcher_ClientExecutor;
     friend class Dispatcher_Executor;
@@ -301,12 +507,15 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     // PRIVATE MANIPULATORS
 
     /// Start the dispatcher context associated to clients of the specified
-    /// `type`, using the specified `config` and return 0 on success, or
-    /// return a non-zero value and populate the specified
-    /// `errorDescription` on error.
+    /// `type`, using the specified `config` and restricting its processors
+    /// to the CPUs in the specified `cpuList` (in the `cpulist` format of
+    /// `mwcsys::ThreadUtil::parseCpuList`, empty for no restriction), and
+    /// return 0 on success, or return a non-zero value and populate the
+    /// specified `errorDescription` on error.
     int startContext(bsl::ostream&                            errorDescription,
                      mqbi::DispatcherClientType::Enum         type,
-                     const mqbcfg::DispatcherProcessorConfig& config);
+                     const mqbcfg::DispatcherProcessorConfig& config,
+                     const bsl::string&                       cpuList);
 
     /// Create a queue for the multi-fixed queue thread pool in charge of
     /// dispatcher client of the specified `type` and using the specified
@@ -320,6 +529,21 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
                  int                                          processorId,
                  bslma::Allocator*                            allocator);
 
+    /// Create a lock-free queue for the multi-fixed queue thread pool in
+    /// charge of dispatcher client of the specified `type` and using the
+    /// specified `config`, for the specified `processorId`, using the
+    /// specified `allocator`.  The specified `ret` can be used to set a
+    /// context for the queue.  This creator is used instead of
+    /// `queueCreator` when `config.useLockFreeQueue()` is true.  Note that
+    /// the ring of the queue holds `config.queueSize()` events, but that
+    /// the queue itself is unbounded.
+    ProcessorPool::RingQueue*
+    ringQueueCreator(mqbi::DispatcherClientType::Enum             type,
+                     const mqbcfg::DispatcherProcessorParameters& config,
+                     ProcessorPool::QueueCreatorRet*              ret,
+                     int                                          processorId,
+                     bslma::Allocator*                            allocator);
+
     /// Callback when a new object in the specified `event` and having the
     /// associated specified `context` is dispatched for the queue in charge
     /// of dispatcher client of the specified `type`, having the specified
@@ -329,15 +553,113 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
                       void*                            context,
                       const ProcessorPool::Event*      event);
 
+    /// Callback when the specified `numEvents` consecutive `events` having
+    /// the associated specified `context` are dispatched for the queue in
+    /// charge of dispatcher clients of the specified `type`, having the
+    /// specified `processorId`.  Consecutive events of the same type
+    /// destined to the same client are delivered to it at once.
+    void queueEventsCb(mqbi::DispatcherClientType::Enum type,
+                       int                              processorId,
+                       void*                            context,
+                       ProcessorPool::Event**           events,
+                       int                              numEvents);
+
+    /// Process the specified `numEvents` `events`, which are either a
+    /// single event or events of the same type destined to the same client,
+    /// dispatched to the processor having the specified `processorId` in
+    /// charge of clients of the specified `type`, accounting for the load
+    /// of the processor and holding the events aside if their destination
+    /// is being migrated, when rebalancing is enabled.
+    void processEvents(mqbi::DispatcherClientType::Enum    type,
+                       int                                 processorId,
+                       const mqbi::DispatcherEvent* const* events,
+                       int                                 numEvents);
+
+    /// Deliver the specified `numEvents` `events`, which are either a
+    /// single event or events of the same type destined to the same client,
+    /// to their destination from the processor having the specified
+    /// `processorId` in charge of clients of the specified `type`.
+    void deliverEvents(mqbi::DispatcherClientType::Enum    type,
+                       int                                 processorId,
+                       const mqbi::DispatcherEvent* const* events,
+                       int                                 numEvents);
+
+    /// Add the specified `client` to the flush list of the processor having
+    /// the specified `processorId` in charge of clients of the specified
+    /// `type`, unless it is already there.
+    void addToFlushList(mqbi::DispatcherClientType::Enum type,
+                        int                              processorId,
+                        mqbi::DispatcherClient*          client);
+
     /// Flush clients of the specified `type` for the specified
     /// `processorId`.
     void flushClients(mqbi::DispatcherClientType::Enum type, int processorId);
 
+    /// Process the specified `event` dispatched to the processor having the
+    /// specified `processorId` in charge of clients of the specified
+    /// `type`.
+    void processEvent(mqbi::DispatcherClientType::Enum type,
+                      int                              processorId,
+                      const mqbi::DispatcherEvent&     event);
+
     /// This method is invoked when a new client of the specified `type` is
     /// registered to the dispatcher, from the thread associated to that new
     /// client that is mapped to the specified `processorId`.
     void onNewClient(mqbi::DispatcherClientType::Enum type, int processorId);
 
+    /// Enqueue an `e_DISPATCHER` event executing the specified `functor` to
+    /// the processor having the specified `processorId` in charge of
+    /// clients of the specified `type`.
+    void
+    executeOnProcessor(mqbi::DispatcherClientType::Enum          type,
+                       int                                       processorId,
+                       const mqbi::Dispatcher::ProcessorFunctor& functor);
+
+    /// Measure the load of the processors in charge of clients of the
+    /// specified `type` and, if needed, migrate a client between them.
+    /// This method is invoked every `rebalanceIntervalMs` by the scheduler.
+    void rebalance(mqbi::DispatcherClientType::Enum type);
+
+    /// Close the current load measurement interval of the processor having
+    /// the specified `processorId` in charge of clients of the specified
+    /// `type`.
+    void snapshotLoad(mqbi::DispatcherClientType::Enum type, int processorId);
+
+    /// Report the load of all processors in charge of clients of the
+    /// specified `type`, once they all closed their load measurement
+    /// interval, and decide whether a client must be migrated.
+    void onLoadSnapshot(mqbi::DispatcherClientType::Enum type);
+
+    /// Request the migration of the specified `client` of the specified
+    /// `type` from the processor having the specified `sourceProcessor` to
+    /// the one having the specified `targetProcessor`, by enqueuing the
+    /// start of the migration to `sourceProcessor`.  Return 0 on success,
+    /// or a non-zero value if another migration is in progress for clients
+    /// of that type.  Note that `client` is validated by `startMigration`,
+    /// since it may have been unregistered in the meantime.
+    int requestMigration(mqbi::DispatcherClientType::Enum type,
+                         mqbi::DispatcherClient*          client,
+                         int                              sourceProcessor,
+                         int                              targetProcessor);
+
+    /// Start the pending migration of a client of the specified `type` from
+    /// the processor having the specified `processorId`.
+    void startMigration(mqbi::DispatcherClientType::Enum type,
+                        int                              processorId);
+
+    /// Wait, from the processor having the specified `processorId`, for all
+    /// events of the client of the specified `type` being migrated from
+    /// that processor to be processed, and hand the client over to the
+    /// target processor once done.
+    void drainMigration(mqbi::DispatcherClientType::Enum type,
+                        int                              processorId);
+
+    /// Complete the migration of a client of the specified `type` to the
+    /// processor having the specified `processorId`, processing all events
+    /// for that client held aside by that processor.
+    void completeMigration(mqbi::DispatcherClientType::Enum type,
+                           int                              processorId);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Dispatcher, bslma::UsesBslmaAllocator)
@@ -356,6 +678,11 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
 
     // MANIPULATORS
 
+    /// Restrict the processors of each client type to the CPUs specified
+    /// for that type in the specified `placement`.  The behavior is
+    /// undefined unless this `Dispatcher` is not started.
+    void setThreadPlacement(const mqbcfg::ThreadPlacementConfig& placement);
+
     /// Start the `Dispatcher`.  Return 0 on success and non-zero otherwise
     /// populating the specified `errorDescription` with the reason of the
     /// error.
@@ -364,6 +691,21 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     /// Stop the `Dispatcher`.
     void stop();
 
+    /// Migrate the specified `client` to the processor having the specified
+    /// `handle`.  Return 0 if the migration was requested, or a non-zero
+    /// value if `client` is not migratable, is already associated to
+    /// `handle`, or another client of the same type is being migrated.
+    /// Note that the migration completes asynchronously, after all events
+    /// already dispatched to `client` have been processed.
+    int migrateClient(mqbi::DispatcherClient*           client,
+                      mqbi::Dispatcher::ProcessorHandle handle);
+
+    /// Process the specified `command`, and write the result to the
+    /// specified `result` object.  Return zero on success or a nonzero
+    /// value otherwise.
+    int processCommand(mqbcmd::StatResult*        result,
+                       const mqbcmd::StatCommand& command);
+
     /// Based on the specified `type`, associate the specified `client` to
     /// one of the processors of the dispatcher if the optionally specified
     /// `handle` is invalid, or to the provided `handle` if it is valid, and
@@ -529,9 +871,21 @@ inline void Dispatcher::dispatchEvent(mqbi::DispatcherEvent*  event,
 
     event->setDestination(destination);
 
+    mqbi::DispatcherClientData& data = destination->dispatcherClientData();
+    if (!data.isMigratable()) {
+        dispatchEvent(event, data.clientType(), data.processorHandle());
+        return;  // RETURN
+    }
+
+    // The client may be migrated concurrently: advertise this thread is
+    // enqueuing an event for it, so that the migration waits for the event to
+    // be enqueued before handing the client over to its new processor (see
+    // 'drainMigration').
+    ++data.numDispatchesInFlight();
     dispatchEvent(event,
-                  destination->dispatcherClientData().clientType(),
-                  destination->dispatcherClientData().processorHandle());
+                  data.clientType(),
+                  data.destinationProcessorHandle());
+    --data.numDispatchesInFlight();
 }
 
 inline void Dispatcher::dispatchEvent(mqbi::DispatcherEvent*            event,
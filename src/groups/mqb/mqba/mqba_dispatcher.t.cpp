@@ -19,6 +19,7 @@
 // MQB
 #include <mqbcfg_messages.h>
 #include <mqbmock_dispatcher.h>
+#include <mqbstat_brokerstats.h>
 
 // MWC
 #include <mwcex_bindutil.h>
@@ -30,11 +31,14 @@
 // BDE
 #include <bdlf_bind.h>
 #include <bdlmt_eventscheduler.h>
+#include <bsl_algorithm.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -89,6 +93,61 @@ struct LoadSelfThreadId {
     }
 };
 
+// =======================
+// struct RecordInvocation
+// =======================
+
+/// Provides a functor that appends the specified `value` to the specified
+/// `values`, and the id of the current thread to the specified `threadIds`.
+struct RecordInvocation {
+    // TYPES
+
+    /// Defines the result type of the call operator.
+    typedef void ResultType;
+
+    // ACCESSORS
+    void operator()(bsl::vector<int>*                   values,
+                    bsl::vector<bslmt::ThreadUtil::Id>* threadIds,
+                    int                                 value) const
+    {
+        values->push_back(value);
+        threadIds->push_back(bslmt::ThreadUtil::selfId());
+    }
+};
+
+// ===========================
+// class BatchRecordingClient
+// ===========================
+
+/// Mock dispatcher client recording the size of each batch of events
+/// delivered to it through `onDispatcherEvents`.
+class BatchRecordingClient : public mqbmock::DispatcherClient {
+  public:
+    // PUBLIC DATA
+    bsl::vector<int> d_batchSizes;
+
+    // CREATORS
+    explicit BatchRecordingClient(bslma::Allocator* allocator)
+    : mqbmock::DispatcherClient(allocator)
+    , d_batchSizes(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    void onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                            int numEvents) BSLS_KEYWORD_OVERRIDE
+    {
+        d_batchSizes.push_back(numEvents);
+        for (int i = 0; i < numEvents; ++i) {
+            ASSERT_EQ(events[i]->type(), events[0]->type());
+            ASSERT_EQ(events[i]->destination(), this);
+        }
+
+        mqbmock::DispatcherClient::onDispatcherEvents(events, numEvents);
+    }
+};
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -484,6 +543,252 @@ static void test3_executorsSupport()
     eventScheduler.stop();
 }
 
+static void test4_clientMigration()
+// ------------------------------------------------------------------------
+// CLIENT MIGRATION
+//
+// Concerns:
+//   Test that a client can be migrated from one processor to another
+//   while events are being dispatched to it, without reordering them nor
+//   processing them concurrently, and that pinned clients can not be
+//   migrated.
+//
+// Plan:
+//   - Create and start a dispatcher having two session processors, with
+//     rebalancing enabled but a rebalancing interval large enough for no
+//     migration to be triggered automatically.
+//   - Register a client without specifying a processor, and another one
+//     pinned to a specific processor.
+//   - Post functors to the first client through its client executor,
+//     request its migration to the other processor half way through, and
+//     check that all functors were invoked in order, and that the last
+//     ones were invoked by the thread of the new processor.
+//   - Check that the migration of the pinned client, or to the processor
+//     already in charge of the client, is rejected.
+//
+// Testing:
+//   migrateClient
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CLIENT MIGRATION");
+
+    bsl::shared_ptr<mwcst::StatContext> statContext =
+        mqbstat::BrokerStatsUtil::initializeStatContext(30, s_allocator_p);
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    // create the dispatcher, with two processors for sessions
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 2;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 1000;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        1000;
+    dispatcherConfig.sessions().rebalanceIntervalMs() = 3600 * 1000;
+
+    dispatcherConfig.queues().numProcessors()                            = 1;
+    dispatcherConfig.queues().processorConfig().queueSize()              = 100;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark()  = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() = 100;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    mqbmock::DispatcherClient client1(s_allocator_p);
+    dispatcher.registerClient(&client1, mqbi::DispatcherClientType::e_SESSION);
+    ASSERT(client1.dispatcherClientData().isMigratable());
+
+    mqbmock::DispatcherClient client2(s_allocator_p);
+    dispatcher.registerClient(&client2,
+                              mqbi::DispatcherClientType::e_SESSION,
+                              0);
+    ASSERT(!client2.dispatcherClientData().isMigratable());
+
+    const int sourceProcessor =
+        client1.dispatcherClientData().processorHandle();
+    const int targetProcessor = 1 - sourceProcessor;
+
+    // Pinned clients, and migration to the current processor, are rejected
+    ASSERT_NE(dispatcher.migrateClient(&client2, 1), 0);
+    ASSERT_NE(dispatcher.migrateClient(&client1, sourceProcessor), 0);
+
+    const int                          k_NUM_EVENTS = 200;
+    bsl::vector<int>                   values(s_allocator_p);
+    bsl::vector<bslmt::ThreadUtil::Id> threadIds(s_allocator_p);
+    mwcex::Executor executor = dispatcher.clientExecutor(&client1);
+
+    for (int i = 0; i < k_NUM_EVENTS / 2; ++i) {
+        executor.post(bdlf::BindUtil::bind(RecordInvocation(),
+                                           &values,
+                                           &threadIds,
+                                           i));
+    }
+
+    ASSERT_EQ(dispatcher.migrateClient(&client1, targetProcessor), 0);
+
+    for (int i = k_NUM_EVENTS / 2; i < k_NUM_EVENTS; ++i) {
+        executor.post(bdlf::BindUtil::bind(RecordInvocation(),
+                                           &values,
+                                           &threadIds,
+                                           i));
+    }
+
+    // Wait for the migration to complete
+    bsls::TimeInterval timeout = mwcsys::Time::nowMonotonicClock() +
+                                 bsls::TimeInterval(10);
+    while (client1.dispatcherClientData().processorHandle() !=
+               targetProcessor &&
+           mwcsys::Time::nowMonotonicClock() < timeout) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    ASSERT_EQ(client1.dispatcherClientData().processorHandle(),
+              targetProcessor);
+
+    // Events dispatched after the migration are processed by the new
+    // processor, after all previous events
+    executor.post(bdlf::BindUtil::bind(RecordInvocation(),
+                                       &values,
+                                       &threadIds,
+                                       static_cast<int>(k_NUM_EVENTS)));
+    dispatcher.synchronize(&client1);
+
+    ASSERT_EQ(values.size(), static_cast<size_t>(k_NUM_EVENTS + 1));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ_D(i, values[i], static_cast<int>(i));
+    }
+    ASSERT(threadIds.front() != threadIds.back());
+    ASSERT(threadIds.back() != bslmt::ThreadUtil::selfId());
+
+    dispatcher.unregisterClient(&client1);
+    dispatcher.unregisterClient(&client2);
+
+    dispatcher.stop();
+    eventScheduler.stop();
+}
+
+static void test5_eventBatching()
+// ------------------------------------------------------------------------
+// EVENT BATCHING
+//
+// Concerns:
+//   Test that consecutive events of the same type destined to the same
+//   client are delivered to it at once, in order, through
+//   'onDispatcherEvents'.
+//
+// Plan:
+//   - Create and start a dispatcher having one processor per client type.
+//   - Register a client recording the batches of events delivered to it.
+//   - Block the processor of the client, post functors to the client
+//     through its client executor, unblock the processor, and check that
+//     all functors were invoked in order, and that some were delivered in
+//     batches.
+//
+// Testing:
+//   Event batching
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("EVENT BATCHING");
+
+    // create / start a scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         s_allocator_p);
+    int                   rc = eventScheduler.start();
+    BSLS_ASSERT_OPT(rc == 0);
+
+    // create the dispatcher, with one processor per client type
+    mqbcfg::DispatcherConfig dispatcherConfig;
+
+    dispatcherConfig.sessions().numProcessors()               = 1;
+    dispatcherConfig.sessions().processorConfig().queueSize() = 1000;
+    dispatcherConfig.sessions().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.sessions().processorConfig().queueSizeHighWatermark() =
+        1000;
+
+    dispatcherConfig.queues().numProcessors()                            = 1;
+    dispatcherConfig.queues().processorConfig().queueSize()              = 100;
+    dispatcherConfig.queues().processorConfig().queueSizeLowWatermark()  = 0;
+    dispatcherConfig.queues().processorConfig().queueSizeHighWatermark() = 100;
+
+    dispatcherConfig.clusters().numProcessors()               = 1;
+    dispatcherConfig.clusters().processorConfig().queueSize() = 100;
+    dispatcherConfig.clusters().processorConfig().queueSizeLowWatermark() = 0;
+    dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
+        100;
+
+    mqba::Dispatcher dispatcher(dispatcherConfig,
+                                &eventScheduler,
+                                s_allocator_p);
+
+    bsl::stringstream startErr(s_allocator_p);
+    rc = dispatcher.start(startErr);
+    ASSERT_EQ(rc, 0);
+
+    BatchRecordingClient client(s_allocator_p);
+    dispatcher.registerClient(&client, mqbi::DispatcherClientType::e_SESSION);
+
+    const int                          k_NUM_EVENTS = 200;
+    bsl::vector<int>                   values(s_allocator_p);
+    bsl::vector<bslmt::ThreadUtil::Id> threadIds(s_allocator_p);
+
+    mwcex::Executor  executor = dispatcher.clientExecutor(&client);
+    bslmt::Semaphore startedSignal;
+    bslmt::Semaphore continueSignal;
+
+    // Block the processor, so that the following events pile up
+    executor.post(bdlf::BindUtil::bind(Synchronize(),
+                                       &startedSignal,
+                                       &continueSignal));
+    startedSignal.wait();
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        executor.post(bdlf::BindUtil::bind(RecordInvocation(),
+                                           &values,
+                                           &threadIds,
+                                           i));
+    }
+
+    continueSignal.post();
+    dispatcher.synchronize(&client);
+
+    ASSERT_EQ(values.size(), static_cast<size_t>(k_NUM_EVENTS));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ_D(i, values[i], static_cast<int>(i));
+    }
+
+    // The events posted while the processor was blocked were delivered in
+    // batches
+    int numBatchedEvents = 0;
+    int maxBatchSize     = 0;
+    for (size_t i = 0; i < client.d_batchSizes.size(); ++i) {
+        numBatchedEvents += client.d_batchSizes[i];
+        maxBatchSize = bsl::max(maxBatchSize, client.d_batchSizes[i]);
+    }
+    ASSERT_GT(numBatchedEvents, 0);
+    ASSERT_GT(maxBatchSize, 1);
+    ASSERT_LE(numBatchedEvents, k_NUM_EVENTS);
+
+    dispatcher.unregisterClient(&client);
+
+    dispatcher.stop();
+    eventScheduler.stop();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -496,6 +801,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_eventBatching(); break;
+    case 4: test4_clientMigration(); break;
     case 3: test3_executorsSupport(); break;
     case 2: test2_clientTypeEnumValues(); break;
     case 1: test1_breathingTest(); break;
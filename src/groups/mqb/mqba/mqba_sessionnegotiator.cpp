@@ -148,6 +148,17 @@ void loadBrokerIdentity(bmqp_ctrlmsg::ClientIdentity* identity,
             .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX);
     }
 
+    // Advertise support for compression algorithms added after 'ZLIB', and
+    // for PUT events compressed as a whole
+    features.append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_ZSTD)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_LZ4)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_EVENT);
+
     identity->protocolVersion() = bmqp::Protocol::k_VERSION;
     identity->sdkVersion()      = bmqscm::Version::versionAsInt();
     identity->clientType()      = bmqp_ctrlmsg::ClientType::E_TCPBROKER;
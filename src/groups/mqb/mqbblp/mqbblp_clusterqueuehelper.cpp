@@ -987,6 +987,8 @@ void ClusterQueueHelper::processOpenQueueRequest(
 
             openQueueResp.deduplicationTimeMs() =
                 context.d_domain_p->config().deduplicationTimeMs();
+            openQueueResp.compressionDictionaries() =
+                context.d_domain_p->config().compressionDictionaries();
             openQueueResp.originalRequest().handleParameters() =
                 context.d_handleParameters;
             openQueueResp.originalRequest().handleParameters().qId() =
@@ -26,6 +26,7 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_queueid.h>
 #include <bmqp_queueutil.h>
 #include <bmqp_routingconfigurationutils.h>
@@ -362,6 +363,7 @@ Domain::Domain(const bsl::string&                     name,
 , d_state(e_STOPPED)
 , d_name(name, d_allocator_p)
 , d_config(d_allocator_p)
+, d_compressionDictionaries(d_allocator_p)
 , d_cluster_sp(cluster)
 , d_dispatcher_p(dispatcher)
 , d_blobBufferFactory_p(blobBufferFactory)
@@ -400,7 +402,8 @@ int Domain::configure(bsl::ostream&           errorDescription,
         rc_VALIDATION_FAILED        = -1,
         rc_NOT_IMPLEMENTED          = -2,
         rc_QUEUE_RECONFIGURE_FAILED = -3,
-        rc_APPID_RECONFIGURE_FAILED = -4
+        rc_APPID_RECONFIGURE_FAILED = -4,
+        rc_INVALID_DICTIONARY       = -5
     };
 
     // Store a copy of the old configuration.
@@ -433,8 +436,48 @@ int Domain::configure(bsl::ostream&           errorDescription,
         return (rc * 10 + rc_VALIDATION_FAILED);  // RETURN
     }
 
+    // Register the compression dictionaries, so that they are known to be
+    // valid before being sent to producers, and so that this broker can
+    // decompress messages for consumers not supporting zstd.  The registry
+    // is process-wide, i.e., shared by all the domains of every broker
+    // running in this process, and a dictionary id identifies the content
+    // of the dictionary in the frames compressed with it, hence the
+    // registration fails if another domain, or the previous configuration
+    // of this domain, uses a different dictionary with the same id.  The
+    // dictionaries of the previous configuration are unregistered once
+    // released, unless still used elsewhere.
+    const bsl::vector<bsl::vector<char> >& dictionaries =
+        finalConfig.compressionDictionaries();
+    CompressionDictionaries compressionDictionaries(d_allocator_p);
+    compressionDictionaries.reserve(dictionaries.size());
+    for (size_t i = 0; i < dictionaries.size(); ++i) {
+        const bsl::vector<char>& data = dictionaries[i];
+
+        bsl::shared_ptr<bmqp::CompressionDictionary> dictionary;
+        mwcu::MemOutStream                           error;
+        if (int rc = bmqp::CompressionDictionaryUtil::loadAndRegister(
+                &dictionary,
+                data.data(),
+                static_cast<int>(data.size()),
+                &error,
+                d_allocator_p)) {
+            errorDescription << "Invalid compression dictionary #" << i
+                             << " of domain '" << d_name << "': "
+                             << error.str()
+                             << ". Note that dictionary ids must be unique "
+                             << "across the domains of all the brokers of "
+                             << "this process, and that "
+                             << "a new version of a dictionary must have a "
+                             << "new id.";
+            return (rc * 10 + rc_INVALID_DICTIONARY);  // RETURN
+        }
+
+        compressionDictionaries.push_back(dictionary);
+    }
+
     // Adopt the updated domain configuration.
     d_config.makeValue(finalConfig);
+    d_compressionDictionaries.swap(compressionDictionaries);
 
     // Configure domain limits.
     const mqbconfm::Limits& limits = d_config.value().storage().domainLimits();
@@ -36,6 +36,7 @@
 #include <mqbu_capacitymeter.h>
 
 // BMQ
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqt_uri.h>
 
@@ -107,6 +108,9 @@ class Domain : public mqbi::Domain, public mqbc::ClusterStateObserver {
     typedef mqbi::Storage::AppIdKeyPairs  AppIdKeyPairs;
     typedef AppIdKeyPairs::const_iterator AppIdKeyPairsCIter;
 
+    typedef bsl::vector<bsl::shared_ptr<bmqp::CompressionDictionary> >
+        CompressionDictionaries;
+
     enum DomainState { e_STARTED = 0, e_STOPPING = 1, e_STOPPED = 2 };
 
   private:
@@ -128,6 +132,12 @@ class Domain : public mqbi::Domain, public mqbc::ClusterStateObserver {
     bdlb::NullableValue<mqbconfm::Domain> d_config;
     // Configuration for the domain
 
+    CompressionDictionaries d_compressionDictionaries;
+    // Compression dictionaries of the
+    // configuration, which remain
+    // registered as long as they are
+    // held.
+
     bsl::shared_ptr<mqbi::Cluster> d_cluster_sp;
     // Cluster to use by this domain.
 
@@ -357,6 +357,42 @@ void LocalQueue::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     }
 }
 
+void LocalQueue::onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                                    int numEvents)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state_p->queue()->dispatcher()->inDispatcherThread(
+        d_state_p->queue()));
+    BSLS_ASSERT_SAFE(numEvents > 0);
+
+    if (events[0]->type() != mqbi::DispatcherEventType::e_PUT) {
+        for (int i = 0; i < numEvents; ++i) {
+            onDispatcherEvent(*events[i]);
+        }
+        return;  // RETURN
+    }
+
+    // Post all messages of the batch with the same arrival time, and only
+    // then flush the storage (see 'postMessage').
+    const bsls::Types::Int64 arrivalTime = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    for (int i = 0; i < numEvents; ++i) {
+        BSLS_ASSERT_SAFE(events[i]->type() ==
+                         mqbi::DispatcherEventType::e_PUT);
+
+        const mqbi::DispatcherPutEvent* realEvent = events[i]->asPutEvent();
+        postMessageImp(realEvent->putHeader(),
+                       realEvent->blob(),
+                       realEvent->options(),
+                       realEvent->queueHandle(),
+                       arrivalTime);
+    }
+
+    d_state_p->storage()->dispatcherFlush(false, true);
+}
+
 void LocalQueue::flush()
 {
     // executed by the *DISPATCHER* thread
@@ -384,6 +420,24 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
 {
     // executed by the *DISPATCHER* thread
 
+    const bsls::Types::Int64 arrivalTime = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    postMessageImp(putHeader, appData, options, source, arrivalTime);
+
+    // If 'FileStore::d_storageEventBuilder' is flushed, flush all relevant
+    // queues (call 'afterNewMessage' to deliver accumulated data)
+    d_state_p->storage()->dispatcherFlush(false, true);
+}
+
+void LocalQueue::postMessageImp(
+    const bmqp::PutHeader&              putHeader,
+    const bsl::shared_ptr<bdlbb::Blob>& appData,
+    const bsl::shared_ptr<bdlbb::Blob>& options,
+    mqbi::QueueHandle*                  source,
+    bsls::Types::Int64                  arrivalTime)
+{
+    // executed by the *DISPATCHER* thread
+
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_state_p->queue()->dispatcher()->inDispatcherThread(
         d_state_p->queue()));
@@ -436,7 +490,7 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
     // calculating and reporting the time interval for which a message
     // stays in the queue.
     mqbi::StorageMessageAttributes attributes(
-        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        arrivalTime,
         d_queueEngine_mp->messageReferenceCount(),
         translation,
         putHeader.compressionAlgorithmType(),
@@ -509,10 +563,6 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
                 1);
         }
     }
-
-    // If 'FileStore::d_storageEventBuilder' is flushed, flush all relevant
-    // queues (call 'afterNewMessage' to deliver accumulated data)
-    d_state_p->storage()->dispatcherFlush(false, true);
 }
 
 void LocalQueue::onPushMessage(
@@ -91,6 +91,20 @@ class LocalQueue BSLS_CPP11_FINAL {
     // Throttler for duplicates.
     bool d_haveStrongConsistency;
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Add the message described by the specified `putHeader`, `appData`
+    /// and `options` and produced by the specified `source` to this queue,
+    /// as `postMessage` does, using the specified `arrivalTime` as the
+    /// arrival time of the message.  Note that, unlike `postMessage`, this
+    /// method does not flush the storage.
+    void postMessageImp(const bmqp::PutHeader&              putHeader,
+                        const bsl::shared_ptr<bdlbb::Blob>& appData,
+                        const bsl::shared_ptr<bdlbb::Blob>& options,
+                        mqbi::QueueHandle*                  source,
+                        bsls::Types::Int64                  arrivalTime);
+
   private:
     // NOT IMPLEMENTED
     LocalQueue(const LocalQueue& other) BSLS_CPP11_DELETED;
@@ -160,6 +174,13 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// deliver to the client.
     void onDispatcherEvent(const mqbi::DispatcherEvent& event);
 
+    /// Called by the `Dispatcher` when it has the specified `numEvents`
+    /// consecutive `events` of the same type to deliver to the client.  A
+    /// batch of `e_PUT` events is posted with a single storage flush at the
+    /// end (see `postMessage`).
+    void onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                            int                                 numEvents);
+
     /// Called by the dispatcher to flush any pending operation; mainly used
     /// to provide batch and nagling mechanism.
     void flush();
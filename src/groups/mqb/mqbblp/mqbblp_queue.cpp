@@ -943,6 +943,22 @@ void Queue::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     }
 }
 
+void Queue::onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                               int                                 numEvents)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dispatcher()->inDispatcherThread(this));
+
+    if (d_localQueue_mp) {
+        d_localQueue_mp->onDispatcherEvents(events, numEvents);
+    }
+    else {
+        mqbi::DispatcherClient::onDispatcherEvents(events, numEvents);
+    }
+}
+
 void Queue::flush()
 {
     // executed by the *QUEUE* dispatcher thread
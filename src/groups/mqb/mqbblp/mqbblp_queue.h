@@ -425,6 +425,11 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     void onDispatcherEvent(const mqbi::DispatcherEvent& event)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Called by the `Dispatcher` when it has the specified `numEvents`
+    /// consecutive `events` of the same type to deliver to the client.
+    void onDispatcherEvents(const mqbi::DispatcherEvent* const* events,
+                            int numEvents) BSLS_KEYWORD_OVERRIDE;
+
     /// Called by the dispatcher to flush any pending operation.. mainly
     /// used to provide batch and nagling mechanism.
     void flush() BSLS_KEYWORD_OVERRIDE;
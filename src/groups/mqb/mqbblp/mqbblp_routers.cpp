@@ -34,6 +34,8 @@
 #include <mwcu_printutil.h>
 
 // BDE
+#include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bsls_performancehint.h>
@@ -95,7 +97,7 @@ Routers::MessagePropertiesReader::MessagePropertiesReader(
     bslma::Allocator*    allocator)
 : d_schemaLearner(schemaLearner)
 , d_schemaLearnerContext(schemaLearner.createContext())
-, d_properties(allocator)
+, d_view()
 , d_currentMessage_p(0)
 , d_isDirty(false)
 {
@@ -107,20 +109,20 @@ Routers::MessagePropertiesReader::~MessagePropertiesReader()
     // NOTHING
 }
 
-void Routers::MessagePropertiesReader::_set(
-    bmqp::MessageProperties& properties)
-{
-    d_properties = properties;
-}
-
 bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
                                                   bslma::Allocator*  allocator)
 {
     if (d_isDirty) {
-        if (d_currentMessage_p && d_currentMessage_p->appData()) {
+        // Properties are read directly from the stored application data,
+        // without parsing them all nor copying any value but the ones
+        // spanning several buffers.
+        if (d_currentMessage_p && d_currentMessage_p->appData() &&
+            d_currentMessage_p->attributes()
+                .messagePropertiesInfo()
+                .isPresent()) {
             int rc = d_schemaLearner.read(
                 d_schemaLearnerContext,
-                &d_properties,
+                &d_view,
                 d_currentMessage_p->attributes().messagePropertiesInfo(),
                 *d_currentMessage_p->appData());
             if (rc != 0) {
@@ -131,7 +133,7 @@ bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
         d_isDirty = false;
     }
 
-    return d_properties.getPropertyRef(name, allocator);
+    return d_view.getPropertyRef(name, allocator);
 }
 
 void Routers::MessagePropertiesReader::next(
@@ -141,7 +143,7 @@ void Routers::MessagePropertiesReader::next(
         return;  // RETURN
     }
 
-    d_properties.clear();
+    d_view.clear();
 
     d_currentMessage_p = currentMessage;
     d_isDirty          = true;
@@ -186,6 +188,164 @@ unsigned int Routers::PriorityGroup::sId() const
     return d_itId->key();
 }
 
+// --------------------------------
+// class Routers::SubscriptionIndex
+// --------------------------------
+
+Routers::SubscriptionIndex::Property::Property(const bsl::string& name,
+                                               bslma::Allocator*  allocator)
+: d_name(name, allocator)
+, d_strings(allocator)
+, d_integers(allocator)
+, d_ranges(allocator)
+{
+    // NOTHING
+}
+
+Routers::SubscriptionIndex::Property::Property(const Property&   other,
+                                               bslma::Allocator* allocator)
+: d_name(other.d_name, allocator)
+, d_strings(other.d_strings, allocator)
+, d_integers(other.d_integers, allocator)
+, d_ranges(other.d_ranges, allocator)
+{
+    // NOTHING
+}
+
+Routers::SubscriptionIndex::SubscriptionIndex(bslma::Allocator* allocator)
+: d_properties(allocator)
+, d_round(0)
+, d_allocator_p(allocator)
+{
+    // NOTHING
+}
+
+void Routers::SubscriptionIndex::mark(const Groups& groups)
+{
+    for (Groups::const_iterator it = groups.begin(); it != groups.end();
+         ++it) {
+        (*it)->d_matchRound = d_round;
+    }
+}
+
+void Routers::SubscriptionIndex::add(PriorityGroup* group)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(group);
+
+    const Expression& expression =
+        group->d_itId->value().d_itExpression->value();
+    bmqeval::PropertyConstraint constraint(d_allocator_p);
+
+    // Groups without a valid expression always match (see
+    // 'Expression::evaluate').
+    group->d_isIndexed = expression.d_evaluator.isValid() &&
+                         expression.d_evaluator.loadPropertyConstraint(
+                             &constraint);
+
+    if (!group->d_isIndexed) {
+        return;  // RETURN
+    }
+
+    Properties::iterator itProperty = d_properties.begin();
+    while (itProperty != d_properties.end() &&
+           itProperty->d_name != constraint.d_name) {
+        ++itProperty;
+    }
+    if (itProperty == d_properties.end()) {
+        d_properties.emplace_back(constraint.d_name);
+        itProperty = d_properties.end() - 1;
+    }
+
+    Property& property = *itProperty;
+
+    if (constraint.d_type == bmqeval::PropertyConstraint::e_STRING) {
+        property.d_strings[constraint.d_string].push_back(group);
+    }
+    else if (constraint.d_min == constraint.d_max) {
+        property.d_integers[constraint.d_min].push_back(group);
+    }
+    else if (constraint.d_min < constraint.d_max) {
+        const Range range = {constraint.d_min, constraint.d_max, group};
+        property.d_ranges.push_back(range);
+    }
+    // else the expression can never match, so the group is never a
+    // candidate.
+}
+
+void Routers::SubscriptionIndex::finalize()
+{
+    for (Properties::iterator itProperty = d_properties.begin();
+         itProperty != d_properties.end();
+         ++itProperty) {
+        bsl::sort(itProperty->d_ranges.begin(), itProperty->d_ranges.end());
+    }
+}
+
+void Routers::SubscriptionIndex::clear()
+{
+    d_properties.clear();
+}
+
+void Routers::SubscriptionIndex::match(bmqeval::PropertiesReader* reader)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(reader);
+
+    ++d_round;
+
+    for (Properties::const_iterator itProperty = d_properties.begin();
+         itProperty != d_properties.end();
+         ++itProperty) {
+        const Property& property = *itProperty;
+        bdld::Datum     value    = reader->get(property.d_name,
+                                            d_allocator_p);
+
+        // A group whose expression requires a property which the message
+        // does not have, or which has another type, is not a candidate.
+
+        if (value.isString()) {
+            if (!property.d_strings.empty()) {
+                bdlma::LocalSequentialAllocator<128> localAllocator(
+                    d_allocator_p);
+                const bslstl::StringRef string = value.theString();
+                const bsl::string       key(string.data(),
+                                      string.length(),
+                                      &localAllocator);
+
+                bsl::unordered_map<bsl::string, Groups>::const_iterator it =
+                    property.d_strings.find(key);
+                if (it != property.d_strings.end()) {
+                    mark(it->second);
+                }
+            }
+        }
+        else if (value.isInteger() || value.isInteger64()) {
+            const bsls::Types::Int64 integer = value.isInteger()
+                                                   ? value.theInteger()
+                                                   : value.theInteger64();
+
+            bsl::unordered_map<bsls::Types::Int64, Groups>::const_iterator
+                it = property.d_integers.find(integer);
+            if (it != property.d_integers.end()) {
+                mark(it->second);
+            }
+
+            for (bsl::vector<Range>::const_iterator itRange =
+                     property.d_ranges.begin();
+                 itRange != property.d_ranges.end() &&
+                 itRange->d_min <= integer;
+                 ++itRange) {
+                if (integer <= itRange->d_max) {
+                    itRange->d_group_p->d_matchRound = d_round;
+                }
+            }
+        }
+
+        bdld::Datum::destroy(value, d_allocator_p);
+    }
+}
+
 void Routers::AppContext::loadApp(const char*        appId,
                                   mqbi::QueueHandle* handle,
                                   bsl::ostream*      errorStream,
@@ -434,6 +594,21 @@ size_t Routers::AppContext::finalize()
         }
     }
 
+    // Index the groups to route to.
+    for (Priorities::iterator itPriority = d_priorities.begin();
+         itPriority != d_priorities.end();
+         ++itPriority) {
+        Priority::PriorityGroupList& groups =
+            itPriority->second.d_highestGroups;
+
+        for (Priority::PriorityGroupList::iterator itGroup = groups.begin();
+             itGroup != groups.end();
+             ++itGroup) {
+            d_index.add(&(*itGroup)->value());
+        }
+    }
+    d_index.finalize();
+
     return count;
 }
 
@@ -451,6 +626,8 @@ void Routers::AppContext::registerSubscriptions()
 void Routers::AppContext::clean()
 {
     // Clear processing results which 'finalize' will re-populate
+    d_index.clear();
+
     for (PriorityGroups::const_iterator itGroup = d_groups.begin();
          itGroup != d_groups.end();
          ++itGroup) {
@@ -551,6 +728,8 @@ void Routers::AppContext::generate(bmqp_ctrlmsg::StreamParameters* out) const
 
 void Routers::AppContext::reset()
 {
+    d_index.clear();
+
     // Break circular dependency - Subscriber <-> Subscription
     Subscriber::Subscriptions temp(d_allocator_p);
 
@@ -600,6 +779,9 @@ Routers::Result Routers::AppContext::selectConsumer(
                    : e_NO_CAPACITY;  // RETURN
     }
     else {
+        if (!d_index.empty()) {
+            d_index.match(d_queue.d_preader.get());
+        }
         return d_router.iterateGroups(visitor, currentMessage);  // RETURN
     }
 }
@@ -632,7 +814,10 @@ Routers::RoundRobin::iterateGroups(const Visitor&               visitor,
             BSLS_ASSERT_SAFE(!group.d_highestSubscriptions.empty());
 
             if (group.d_canDeliver) {
-                if (group.evaluate(message->appData())) {
+                // Skip evaluating the expressions which the index rules
+                // out.
+                if ((!d_index_p || d_index_p->isCandidate(group)) &&
+                    group.evaluate(message->appData())) {
                     if (iterateSubscriptions(visitor, group)) {
                         return e_SUCCESS;  // RETURN
                     }
@@ -126,6 +126,12 @@
 //  is in our example [priority2: ['group1', 'group2'], priority1: ['group3']].
 //  The order of ['group1', 'group2'] evaluation is implementation-specific
 //  (influenced by optimizations).
+//  In order not to evaluate every expression for every message, the
+//  'SubscriptionIndex' of each App indexes the groups which expression
+//  requires a property to have specific values (e.g., 'region == "X"' or
+//  'x > 42') by those values.  The index reads these properties once per
+//  message, and looks up the groups which can match.  The expressions of the
+//  other indexed groups are not evaluated.
 //
 //  Another order is by highest-priority subscribers:
 //  [consumer1: 'subscription2'], consumer2: ['subscription3', 'subscription4',
@@ -154,12 +160,15 @@
 #include <bsl_list.h>
 #include <bsl_map.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_managedptr.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -423,6 +432,14 @@ class Routers {
 
         bool d_canDeliver;
 
+        bool d_isIndexed;
+        // Whether the Expression is indexed by the
+        // 'SubscriptionIndex' of the App.
+
+        bsls::Types::Uint64 d_matchRound;
+        // Last 'SubscriptionIndex::match' round in
+        // which this group was a candidate.
+
         PriorityGroup(const SubscriptionIds::SharedItem itId,
                       bslma::Allocator*                 allocator);
         PriorityGroup(const PriorityGroup& other, bslma::Allocator* allocator);
@@ -535,6 +552,107 @@ class Routers {
 
     typedef bsl::map<int, Priority, std::greater<int> > Priorities;
 
+    /// Mechanism to skip evaluating the `Expression`s of `PriorityGroup`s
+    /// which cannot match a message.  A group which `Expression` requires
+    /// a property to be equal to a string, or to be an integer in a range
+    /// (see `bmqeval::SimpleEvaluator::loadPropertyConstraint`) is indexed
+    /// by that property, so that reading the property once per message and
+    /// looking its value up finds all such groups which can match the
+    /// message.  Groups which are not indexed can always match.
+    /// One per App.
+    class SubscriptionIndex {
+      private:
+        // PRIVATE TYPES
+        typedef bsl::vector<PriorityGroup*> Groups;
+
+        /// Group which `Expression` requires an integer property to be in
+        /// the `[d_min, d_max]` range.
+        struct Range {
+            bsls::Types::Int64 d_min;
+            bsls::Types::Int64 d_max;
+            PriorityGroup*     d_group_p;
+
+            bool operator<(const Range& other) const;
+        };
+
+        /// Groups indexed by the value of one property.
+        struct Property {
+            // TRAITS
+            BSLMF_NESTED_TRAIT_DECLARATION(Property,
+                                           bslma::UsesBslmaAllocator)
+
+            // DATA
+            bsl::string d_name;
+
+            bsl::unordered_map<bsl::string, Groups> d_strings;
+            // Groups requiring the property to be equal
+            // to a string.
+
+            bsl::unordered_map<bsls::Types::Int64, Groups> d_integers;
+            // Groups requiring the property to be equal
+            // to an integer.
+
+            bsl::vector<Range> d_ranges;
+            // Groups requiring the property to be in a
+            // range of integers, sorted by lowest value.
+
+            Property(const bsl::string& name, bslma::Allocator* allocator);
+            Property(const Property& other, bslma::Allocator* allocator);
+        };
+
+        typedef bsl::vector<Property> Properties;
+
+        // PRIVATE DATA
+        Properties d_properties;
+
+        bsls::Types::Uint64 d_round;
+        // Incremented by each call to 'match'.
+
+        bslma::Allocator* d_allocator_p;
+
+        // PRIVATE MANIPULATORS
+
+        /// Mark the specified `groups` as candidates in the current round.
+        void mark(const Groups& groups);
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(SubscriptionIndex,
+                                       bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit SubscriptionIndex(bslma::Allocator* allocator);
+
+        // MANIPULATORS
+
+        /// Index the specified `group` if its `Expression` requires a
+        /// property to have specific values.  Otherwise, make the `group`
+        /// a candidate for every message.
+        void add(PriorityGroup* group);
+
+        /// Prepare the index for `match`, once all groups are added.
+        void finalize();
+
+        /// Remove all groups from the index.
+        void clear();
+
+        /// Read the indexed properties using the specified `reader` and
+        /// mark as candidates the indexed groups which `Expression` can
+        /// match the values read.
+        void match(bmqeval::PropertiesReader* reader);
+
+        // ACCESSORS
+
+        /// Return `true` if the index has no group.
+        bool empty() const;
+
+        /// Return `true` unless the specified `group` is indexed and was
+        /// not marked as a candidate by the last call to `match`.  Note
+        /// that the `Expression` of a group for which this method returns
+        /// `false` would not match the message passed to the last `match`.
+        bool isCandidate(const PriorityGroup& group) const;
+    };
+
     struct MessagePropertiesReader : public bmqeval::PropertiesReader {
       private:
         // CLASS-SCOPE CATEGORY
@@ -546,7 +664,10 @@ class Routers {
 
         bmqp::SchemaLearner::Context d_schemaLearnerContext;
 
-        bmqp::MessageProperties      d_properties;
+        bmqp::MessagePropertiesView d_view;
+        // Reads properties of the current
+        // message in place.
+
         const mqbi::StorageIterator* d_currentMessage_p;
         bool                         d_isDirty;
 
@@ -556,8 +677,6 @@ class Routers {
 
         ~MessagePropertiesReader() BSLS_KEYWORD_OVERRIDE;
 
-        void _set(bmqp::MessageProperties& properties);
-
         bdld::Datum get(const bsl::string& name,
                         bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
 
@@ -622,13 +741,20 @@ class Routers {
         // PRIVATE DATA
         Priorities& d_priorities;
 
+        const SubscriptionIndex* d_index_p;
+        // Index to skip 'PriorityGroup's which
+        // cannot match, or 0.
+
       public:
         // CREATORS
 
         /// Creates a new `RoundRobin` using the specified `consumers`. See
         /// `d_context` for further information regarding the ownership
-        /// semantics for `consumers`.
-        explicit RoundRobin(Priorities& priorities);
+        /// semantics for `consumers`.  Skip evaluating the `Expression`s
+        /// of the groups which are not candidates in the optionally
+        /// specified `index`.
+        explicit RoundRobin(Priorities&              priorities,
+                            const SubscriptionIndex* index = 0);
 
         // MANIPULATORS
 
@@ -671,6 +797,10 @@ class Routers {
 
         QueueRoutingContext& d_queue;
 
+        SubscriptionIndex d_index;
+        // Index of the highest priority groups by
+        // the values of properties they require.
+
         RoundRobin d_router;
         // Round-robin routing policy.
 
@@ -700,8 +830,9 @@ class Routers {
                   const bmqp_ctrlmsg::StreamParameters& streamParameters,
                   const AppContext*                     previous);
 
-        /// Make a pass on results of previous parsing and build round-robin
-        /// lists of highest priority `Subscription`s.
+        /// Make a pass on results of previous parsing, build round-robin
+        /// lists of highest priority `Subscription`s, and index their
+        /// `PriorityGroup`s.
         size_t finalize();
 
         void registerSubscriptions();
@@ -804,7 +935,8 @@ inline Routers::AppContext::AppContext(QueueRoutingContext& queue,
 , d_priorities(allocator)
 , d_consumers(allocator)
 , d_queue(queue)
-, d_router(d_priorities)
+, d_index(allocator)
+, d_router(d_priorities, &d_index)
 , d_compilationContext(allocator)
 , d_allocator_p(allocator)
 {
@@ -977,6 +1109,8 @@ inline Routers::PriorityGroup::PriorityGroup(
 , d_itId(itId)
 , d_ci(allocator)
 , d_canDeliver(true)
+, d_isIndexed(false)
+, d_matchRound(0)
 {
     // NOTHING
 }
@@ -987,6 +1121,8 @@ inline Routers::PriorityGroup::PriorityGroup(const PriorityGroup& other,
 , d_itId(other.d_itId)
 , d_ci(other.d_ci, allocator)
 , d_canDeliver(other.d_canDeliver)
+, d_isIndexed(other.d_isIndexed)
+, d_matchRound(other.d_matchRound)
 {
     // NOTHING
 }
@@ -1093,12 +1229,35 @@ inline Routers::Priority::~Priority()
 {
     // NOTHING
 }
+// --------------------------------
+// class Routers::SubscriptionIndex
+// --------------------------------
+
+inline bool Routers::SubscriptionIndex::Range::operator<(
+    const Range& other) const
+{
+    return d_min < other.d_min;
+}
+
+inline bool Routers::SubscriptionIndex::empty() const
+{
+    return d_properties.empty();
+}
+
+inline bool
+Routers::SubscriptionIndex::isCandidate(const PriorityGroup& group) const
+{
+    return !group.d_isIndexed || group.d_matchRound == d_round;
+}
+
 // -----------------------------
 // struct Routers::RoundRobin
 // -----------------------------
 
-inline Routers::RoundRobin::RoundRobin(Priorities& priorities)
+inline Routers::RoundRobin::RoundRobin(Priorities&              priorities,
+                                       const SubscriptionIndex* index)
 : d_priorities(priorities)
+, d_index_p(index)
 {
     // NOTHING
 }
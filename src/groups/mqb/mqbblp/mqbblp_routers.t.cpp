@@ -141,6 +141,31 @@ struct Visitor {
     }
 };
 
+/// Mechanism to provide the properties of a message to `Routers`.
+struct TestPropertiesReader : public bmqeval::PropertiesReader {
+    bsl::unordered_map<bsl::string, bdld::Datum> d_properties;
+
+    explicit TestPropertiesReader(bslma::Allocator* allocator)
+    : d_properties(allocator)
+    {
+        // NOTHING
+    }
+
+    bdld::Datum get(const bsl::string&                       name,
+                    BSLS_ANNOTATION_UNUSED bslma::Allocator* allocator)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        bsl::unordered_map<bsl::string, bdld::Datum>::const_iterator it =
+            d_properties.find(name);
+
+        if (it == d_properties.end()) {
+            return bdld::Datum::createError(-1);  // RETURN
+        }
+
+        return it->second;
+    }
+};
+
 struct Item {
     int d_i;
 
@@ -510,6 +535,110 @@ static void test4_generate()
     }
 }
 
+static void test5_subscriptionIndex()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::SubscriptionIndex
+//
+//  1. Groups which expression requires a property to be equal to a string,
+//     to an integer, or to be in a range of integers are candidates only
+//     for the messages having such a value.
+//  2. Groups which expression does not require specific values are
+//     always candidates.
+//  3. Groups which expression requires a property the message does not
+//     have are not candidates.
+//  4. Only one property of an expression is indexed, so the index may
+//     keep candidates which expression does not match.
+// ------------------------------------------------------------------------
+{
+    bmqp::SchemaLearner                  schemaLearner(s_allocator_p);
+    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
+                                                      s_allocator_p);
+    mqbblp::Routers::AppContext appContext(queueContext, s_allocator_p);
+    mwcu::MemOutStream          errorStream(s_allocator_p);
+    bmqp_ctrlmsg::StreamParameters in(s_allocator_p);
+    mqbmock::QueueHandle*          handle = 0;
+
+    const char* expressions[] = {
+        "region == \"X\"",
+        "region == \"Y\" && n > 0",
+        "n == 42",
+        "n >= 10 && n < 20",
+        "n > 100 || region == \"X\"",
+        "n < 0 && n > 0",
+    };
+    const size_t k_NUM_EXPRESSIONS = sizeof(expressions) /
+                                     sizeof(*expressions);
+
+    in.appId() = "foo";
+    in.subscriptions().resize(k_NUM_EXPRESSIONS);
+
+    for (size_t i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        bmqp_ctrlmsg::Subscription& subscription = in.subscriptions()[i];
+
+        subscription.sId()                  = static_cast<unsigned int>(i);
+        subscription.expression().version() =
+            bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+        subscription.expression().text() = expressions[i];
+        subscription.consumers().resize(1);
+
+        bmqp_ctrlmsg::ConsumerInfo& ci = subscription.consumers()[0];
+        ci.consumerPriority()          = 1;
+        ci.consumerPriorityCount()     = 1;
+    }
+
+    appContext.load(++handle, &errorStream, 13, 1, in, 0);
+    ASSERT_EQ(errorStream.str(), "");
+    ASSERT_EQ(appContext.finalize(), k_NUM_EXPRESSIONS);
+    ASSERT(!appContext.d_index.empty());
+
+    struct TestParameters {
+        int         d_line;
+        const char* d_region;     // 0 if none
+        int         d_n;          // no property if negative
+        bool        d_expected[k_NUM_EXPRESSIONS];
+    } k_DATA[] = {
+        {L_, "X", -1, {true, false, false, false, true, false}},
+        {L_, "Y", -1, {false, true, false, false, true, false}},
+        {L_, "Y", 1, {false, true, false, false, true, false}},
+        {L_, "Z", 42, {false, false, true, false, true, false}},
+        {L_, 0, 15, {false, false, false, true, true, false}},
+        {L_, 0, 20, {false, false, false, false, true, false}},
+        {L_, 0, -1, {false, false, false, false, true, false}},
+    };
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    TestPropertiesReader reader(s_allocator_p);
+
+    for (size_t i = 0; i < k_NUM_DATA; ++i) {
+        const TestParameters& test = k_DATA[i];
+
+        PVV(test.d_line << ": region: " << (test.d_region ? test.d_region : "")
+                        << ", n: " << test.d_n);
+
+        reader.d_properties.clear();
+        if (test.d_region) {
+            reader.d_properties["region"] = bdld::Datum::createStringRef(
+                test.d_region,
+                s_allocator_p);
+        }
+        if (test.d_n >= 0) {
+            reader.d_properties["n"] = bdld::Datum::createInteger(test.d_n);
+        }
+
+        appContext.d_index.match(&reader);
+
+        for (size_t j = 0; j < k_NUM_EXPRESSIONS; ++j) {
+            mqbblp::Routers::PriorityGroups::SharedItem itGroup =
+                appContext.d_groups.find(in.subscriptions()[j].expression());
+
+            ASSERT(itGroup);
+            ASSERT_EQ_D(test.d_line << ": " << expressions[j],
+                        appContext.d_index.isCandidate(itGroup->value()),
+                        test.d_expected[j]);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -533,6 +662,7 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_subscriptionIndex(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -2103,7 +2103,8 @@ int StorageManager::start(bsl::ostream& errorDescription)
         rc_RECOVERY_MANAGER_FAILURE       = -2,
         rc_FILE_STORE_OPEN_FAILURE        = -3,
         rc_FILE_STORE_RECOVERY_FAILURE    = -4,
-        rc_NOT_ENOUGH_DISK_SPACE          = -5
+        rc_NOT_ENOUGH_DISK_SPACE          = -5,
+        rc_COLD_TIER_UNSUPPORTED          = -6
     };
 
     BALL_LOG_INFO << d_clusterData_p->identity().description()
@@ -2119,6 +2120,12 @@ int StorageManager::start(bsl::ostream& errorDescription)
         return rc * 10 + rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
     }
 
+    rc = mqbc::StorageUtil::validateColdTier(d_clusterConfig,
+                                             errorDescription);
+    if (rc != rc_SUCCESS) {
+        return rc * 10 + rc_COLD_TIER_UNSUPPORTED;  // RETURN
+    }
+
     rc = mqbc::StorageUtil::validateDiskSpace(partitionCfg,
                                               *d_clusterData_p,
                                               d_minimumRequiredDiskSpace);
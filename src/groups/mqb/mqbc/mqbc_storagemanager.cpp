@@ -2585,7 +2585,8 @@ int StorageManager::start(bsl::ostream& errorDescription)
         rc_PARTITION_LOCATION_NONEXISTENT = -1,
         rc_NOT_ENOUGH_DISK_SPACE          = -2,
         rc_THREAD_POOL_START_FAILURE      = -3,
-        rc_RECOVERY_MANAGER_FAILURE       = -4
+        rc_RECOVERY_MANAGER_FAILURE       = -4,
+        rc_COLD_TIER_UNSUPPORTED          = -5
     };
 
     BALL_LOG_INFO << d_clusterData_p->identity().description()
@@ -2601,6 +2602,11 @@ int StorageManager::start(bsl::ostream& errorDescription)
         return rc * 10 + rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
     }
 
+    rc = StorageUtil::validateColdTier(d_clusterConfig, errorDescription);
+    if (rc != rc_SUCCESS) {
+        return rc * 10 + rc_COLD_TIER_UNSUPPORTED;  // RETURN
+    }
+
     rc = StorageUtil::validateDiskSpace(partitionCfg,
                                         *d_clusterData_p,
                                         d_minimumRequiredDiskSpace);
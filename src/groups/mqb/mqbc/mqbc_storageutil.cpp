@@ -231,9 +231,10 @@ void StorageUtil::registerQueueDispatched(
     // 'd_partitionInfoVec'), when a LocalQueue is being created.  If this
     // storage belongs to the first instance of LocalQueue mapped to this
     // partition, we want to make sure that queue creation record written to
-    // the partition above is sent to the replicas as soon as possible.
+    // the partition above is sent to the replicas as soon as possible, even
+    // if the replication window is full.
 
-    fs->dispatcherFlush(true, false);
+    fs->flushStorage();
 
     BALL_LOG_INFO << clusterDescription << ": PartitionId [" << partitionId
                   << "] registered [" << storage->queueUri() << "], queueKey ["
@@ -409,8 +410,8 @@ int StorageUtil::updateQueueRaw(mqbs::ReplicatedStorage* storage,
     }
 
     // Flush the partition for records written above to reach replicas right
-    // away.
-    fs->dispatcherFlush(true, false);
+    // away, even if the replication window is full.
+    fs->flushStorage();
 
     mwcu::Printer<AppIdKeyPairs> printer1(&addedIdKeyPairs);
     mwcu::Printer<AppIdKeyPairs> printer2(&removedIdKeyPairs);
@@ -953,6 +954,47 @@ int StorageUtil::validatePartitionDirectory(
         return rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
     }
 
+    // Ensure partition's cold tier directory exist, if one is configured
+    const bsl::string& clusterFileStoreColdTierLocation =
+        config.coldTierLocation();
+
+    if (!clusterFileStoreColdTierLocation.empty() &&
+        !bdls::FilesystemUtil::isDirectory(clusterFileStoreColdTierLocation,
+                                           true)) {
+        errorDescription << "Cluster's cold tier partition location ('"
+                         << clusterFileStoreColdTierLocation
+                         << "') doesn't exist !";
+        return rc_PARTITION_LOCATION_NONEXISTENT;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int StorageUtil::validateColdTier(
+    const mqbcfg::ClusterDefinition& clusterConfig,
+    bsl::ostream&                    errorDescription)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                 = 0,
+        rc_COLD_TIER_WITH_REPLICAS = -1
+    };
+
+    const bsl::string& coldTierLocation =
+        clusterConfig.partitionConfig().coldTierLocation();
+
+    // A peer recovering a partition from this node would receive MESSAGE
+    // records referring to payloads in the cold tier data file, without the
+    // file itself, and fail to recover.
+
+    if (!coldTierLocation.empty() && 1 < clusterConfig.nodes().size()) {
+        errorDescription << "Cluster's cold tier partition location ('"
+                         << coldTierLocation << "') is not supported by a "
+                         << "cluster of " << clusterConfig.nodes().size()
+                         << " nodes !";
+        return rc_COLD_TIER_WITH_REPLICAS;  // RETURN
+    }
+
     return rc_SUCCESS;
 }
 
@@ -1252,8 +1294,18 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setBufferFactory(clusterData->bufferFactory())
             .setPreallocate(config.preallocate())
             .setPrefaultPages(config.prefaultPages())
+            .setWriteBackend(config.writeBackend())
+            .setSyncBeforeReceipt(config.syncBeforeReceipt())
+            .setGroupCommitMaxDelayMs(config.groupCommitMaxDelayMs())
+            .setGroupCommitMaxBytes(config.groupCommitMaxBytes())
+            .setIndexSnapshotIntervalMs(config.indexSnapshotIntervalMs())
             .setLocation(config.location())
             .setArchiveLocation(config.archiveLocation())
+            .setColdTierLocation(config.coldTierLocation())
+            .setColdTierMinAgeSeconds(config.coldTierMinAgeSeconds())
+            .setReplicationBatchSize(config.replicationBatchSize())
+            .setReplicationBatchingThreshold(
+                config.replicationBatchingThreshold())
             .setNodeId(clusterData->membership().selfNode()->nodeId())
             .setPartitionId(i)
             .setMaxDataFileSize(config.maxDataFileSize())
@@ -1895,9 +1947,10 @@ void StorageUtil::unregisterQueueDispatched(
     // invoked only at the primary when a LocalQueue is deleted.  In case it
     // was the last instance of LocalQueue at this node, we need to make sure
     // that the partition is flushed and the QueueDeletion record reaches
-    // replicas.
+    // replicas before the queue is unassigned, even if the replication
+    // window is full.
 
-    fs->dispatcherFlush(true, false);
+    fs->flushStorage();
 }
 
 int StorageUtil::updateQueue(StorageSpMap*           storageMap,
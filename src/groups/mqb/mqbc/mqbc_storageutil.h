@@ -369,6 +369,14 @@ struct StorageUtil {
     validatePartitionDirectory(const mqbcfg::PartitionConfig& config,
                                bsl::ostream& errorDescription);
 
+    /// Validate that the cold tier, if one is configured in the specified
+    /// `clusterConfig`, is supported by the cluster, and use the specified
+    /// `errorDescription` for emitting errors.  Note that the cold tier
+    /// data files are not part of the file sets sent to a recovering peer,
+    /// hence the cold tier is only supported by clusters having one node.
+    static int validateColdTier(const mqbcfg::ClusterDefinition& clusterConfig,
+                                bsl::ostream& errorDescription);
+
     /// Validate the disk space required for storing partitions as per the
     /// specified `config` for the specified `clusterData` by comparing it
     /// with the specified `minDiskSpace`.
@@ -204,6 +204,76 @@ BmqconfConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     return stream;
 }
 
+// -----------------------
+// class ClientFlushPolicy
+// -----------------------
+
+// CONSTANTS
+
+const char ClientFlushPolicy::CLASS_NAME[] = "ClientFlushPolicy";
+
+const bdlat_EnumeratorInfo ClientFlushPolicy::ENUMERATOR_INFO_ARRAY[] = {
+    {ClientFlushPolicy::E_LATENCY, "E_LATENCY", sizeof("E_LATENCY") - 1, ""},
+    {ClientFlushPolicy::E_THROUGHPUT,
+     "E_THROUGHPUT",
+     sizeof("E_THROUGHPUT") - 1,
+     ""},
+    {ClientFlushPolicy::E_ADAPTIVE,
+     "E_ADAPTIVE",
+     sizeof("E_ADAPTIVE") - 1,
+     ""}};
+
+// CLASS METHODS
+
+int ClientFlushPolicy::fromInt(ClientFlushPolicy::Value* result, int number)
+{
+    switch (number) {
+    case ClientFlushPolicy::E_LATENCY:
+    case ClientFlushPolicy::E_THROUGHPUT:
+    case ClientFlushPolicy::E_ADAPTIVE:
+        *result = static_cast<ClientFlushPolicy::Value>(number);
+        return 0;
+    default: return -1;
+    }
+}
+
+int ClientFlushPolicy::fromString(ClientFlushPolicy::Value* result,
+                                  const char*               string,
+                                  int                       stringLength)
+{
+    for (int i = 0; i < 3; ++i) {
+        const bdlat_EnumeratorInfo& enumeratorInfo =
+            ClientFlushPolicy::ENUMERATOR_INFO_ARRAY[i];
+
+        if (stringLength == enumeratorInfo.d_nameLength &&
+            0 == bsl::memcmp(enumeratorInfo.d_name_p, string, stringLength)) {
+            *result = static_cast<ClientFlushPolicy::Value>(
+                enumeratorInfo.d_value);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+const char* ClientFlushPolicy::toString(ClientFlushPolicy::Value value)
+{
+    switch (value) {
+    case E_LATENCY: {
+        return "E_LATENCY";
+    }
+    case E_THROUGHPUT: {
+        return "E_THROUGHPUT";
+    }
+    case E_ADAPTIVE: {
+        return "E_ADAPTIVE";
+    }
+    }
+
+    BSLS_ASSERT(!"invalid enumerator");
+    return 0;
+}
+
 // -----------------------
 // class ClusterAttributes
 // -----------------------
@@ -539,6 +609,10 @@ bsl::ostream& ClusterMonitorConfig::print(bsl::ostream& stream,
 const char DispatcherProcessorParameters::CLASS_NAME[] =
     "DispatcherProcessorParameters";
 
+const bool
+    DispatcherProcessorParameters::DEFAULT_INITIALIZER_USE_LOCK_FREE_QUEUE =
+        false;
+
 const bdlat_AttributeInfo
     DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[] = {
         {ATTRIBUTE_ID_QUEUE_SIZE,
@@ -555,7 +629,12 @@ const bdlat_AttributeInfo
          "queueSizeHighWatermark",
          sizeof("queueSizeHighWatermark") - 1,
          "",
-         bdlat_FormattingMode::e_DEC}};
+         bdlat_FormattingMode::e_DEC},
+        {ATTRIBUTE_ID_USE_LOCK_FREE_QUEUE,
+         "useLockFreeQueue",
+         sizeof("useLockFreeQueue") - 1,
+         "",
+         bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
@@ -563,7 +642,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorParameters::lookupAttributeInfo(const char* name,
                                                    int         nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -587,6 +666,8 @@ DispatcherProcessorParameters::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK];
+    case ATTRIBUTE_ID_USE_LOCK_FREE_QUEUE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE];
     default: return 0;
     }
 }
@@ -597,6 +678,7 @@ DispatcherProcessorParameters::DispatcherProcessorParameters()
 : d_queueSize()
 , d_queueSizeLowWatermark()
 , d_queueSizeHighWatermark()
+, d_useLockFreeQueue(DEFAULT_INITIALIZER_USE_LOCK_FREE_QUEUE)
 {
 }
 
@@ -605,6 +687,7 @@ DispatcherProcessorParameters::DispatcherProcessorParameters(
 : d_queueSize(original.d_queueSize)
 , d_queueSizeLowWatermark(original.d_queueSizeLowWatermark)
 , d_queueSizeHighWatermark(original.d_queueSizeHighWatermark)
+, d_useLockFreeQueue(original.d_useLockFreeQueue)
 {
 }
 
@@ -621,6 +704,7 @@ DispatcherProcessorParameters& DispatcherProcessorParameters::operator=(
         d_queueSize              = rhs.d_queueSize;
         d_queueSizeLowWatermark  = rhs.d_queueSizeLowWatermark;
         d_queueSizeHighWatermark = rhs.d_queueSizeHighWatermark;
+        d_useLockFreeQueue       = rhs.d_useLockFreeQueue;
     }
 
     return *this;
@@ -635,6 +719,7 @@ DispatcherProcessorParameters::operator=(DispatcherProcessorParameters&& rhs)
         d_queueSize              = bsl::move(rhs.d_queueSize);
         d_queueSizeLowWatermark  = bsl::move(rhs.d_queueSizeLowWatermark);
         d_queueSizeHighWatermark = bsl::move(rhs.d_queueSizeHighWatermark);
+        d_useLockFreeQueue       = bsl::move(rhs.d_useLockFreeQueue);
     }
 
     return *this;
@@ -646,6 +731,7 @@ void DispatcherProcessorParameters::reset()
     bdlat_ValueTypeFunctions::reset(&d_queueSize);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeLowWatermark);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeHighWatermark);
+    d_useLockFreeQueue = DEFAULT_INITIALIZER_USE_LOCK_FREE_QUEUE;
 }
 
 // ACCESSORS
@@ -661,6 +747,7 @@ bsl::ostream& DispatcherProcessorParameters::print(bsl::ostream& stream,
                            this->queueSizeLowWatermark());
     printer.printAttribute("queueSizeHighWatermark",
                            this->queueSizeHighWatermark());
+    printer.printAttribute("useLockFreeQueue", this->useLockFreeQueue());
     printer.end();
     return stream;
 }
@@ -2434,6 +2521,69 @@ bsl::ostream& StorageSyncConfig::print(bsl::ostream& stream,
     return stream;
 }
 
+// -------------------------
+// class StorageWriteBackend
+// -------------------------
+
+// CONSTANTS
+
+const char StorageWriteBackend::CLASS_NAME[] = "StorageWriteBackend";
+
+const bdlat_EnumeratorInfo StorageWriteBackend::ENUMERATOR_INFO_ARRAY[] = {
+    {StorageWriteBackend::E_MMAP, "E_MMAP", sizeof("E_MMAP") - 1, ""},
+    {StorageWriteBackend::E_ASYNC_WRITEBACK,
+     "E_ASYNC_WRITEBACK",
+     sizeof("E_ASYNC_WRITEBACK") - 1,
+     ""}};
+
+// CLASS METHODS
+
+int StorageWriteBackend::fromInt(StorageWriteBackend::Value* result,
+                                 int                         number)
+{
+    switch (number) {
+    case StorageWriteBackend::E_MMAP:
+    case StorageWriteBackend::E_ASYNC_WRITEBACK:
+        *result = static_cast<StorageWriteBackend::Value>(number);
+        return 0;
+    default: return -1;
+    }
+}
+
+int StorageWriteBackend::fromString(StorageWriteBackend::Value* result,
+                                    const char*                 string,
+                                    int                         stringLength)
+{
+    for (int i = 0; i < 2; ++i) {
+        const bdlat_EnumeratorInfo& enumeratorInfo =
+            StorageWriteBackend::ENUMERATOR_INFO_ARRAY[i];
+
+        if (stringLength == enumeratorInfo.d_nameLength &&
+            0 == bsl::memcmp(enumeratorInfo.d_name_p, string, stringLength)) {
+            *result = static_cast<StorageWriteBackend::Value>(
+                enumeratorInfo.d_value);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+const char* StorageWriteBackend::toString(StorageWriteBackend::Value value)
+{
+    switch (value) {
+    case E_MMAP: {
+        return "E_MMAP";
+    }
+    case E_ASYNC_WRITEBACK: {
+        return "E_ASYNC_WRITEBACK";
+    }
+    }
+
+    BSLS_ASSERT(!"invalid enumerator");
+    return 0;
+}
+
 // ------------------
 // class SyslogConfig
 // ------------------
@@ -2735,6 +2885,19 @@ const int TcpInterfaceConfig::DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS = 3000;
 
 const bool TcpInterfaceConfig::DEFAULT_INITIALIZER_USE_NTF = false;
 
+const bsls::Types::Int64
+    TcpInterfaceConfig::DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD = 0;
+
+const ClientFlushPolicy::Value
+    TcpInterfaceConfig::DEFAULT_INITIALIZER_FLUSH_POLICY =
+        ClientFlushPolicy::E_LATENCY;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_FLUSH_MAX_BYTES = 1048576;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_FLUSH_MAX_DELAY_US = 1000;
+
+const int TcpInterfaceConfig::DEFAULT_INITIALIZER_FLUSH_RATE_THRESHOLD = 10000;
+
 const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -2785,14 +2948,39 @@ const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "useNtf",
      sizeof("useNtf") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT}};
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_ZERO_COPY_THRESHOLD,
+     "zeroCopyThreshold",
+     sizeof("zeroCopyThreshold") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_FLUSH_POLICY,
+     "flushPolicy",
+     sizeof("flushPolicy") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_FLUSH_MAX_BYTES,
+     "flushMaxBytes",
+     sizeof("flushMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_FLUSH_MAX_DELAY_US,
+     "flushMaxDelayUs",
+     sizeof("flushMaxDelayUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_FLUSH_RATE_THRESHOLD,
+     "flushRateThreshold",
+     sizeof("flushRateThreshold") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 TcpInterfaceConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 10; ++i) {
+    for (int i = 0; i < 15; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2826,6 +3014,16 @@ const bdlat_AttributeInfo* TcpInterfaceConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS];
     case ATTRIBUTE_ID_USE_NTF:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF];
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+    case ATTRIBUTE_ID_FLUSH_POLICY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_POLICY];
+    case ATTRIBUTE_ID_FLUSH_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_BYTES];
+    case ATTRIBUTE_ID_FLUSH_MAX_DELAY_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US];
+    case ATTRIBUTE_ID_FLUSH_RATE_THRESHOLD:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD];
     default: return 0;
     }
 }
@@ -2837,11 +3035,16 @@ TcpInterfaceConfig::TcpInterfaceConfig(bslma::Allocator* basicAllocator)
 , d_highWatermark()
 , d_nodeLowWatermark(DEFAULT_INITIALIZER_NODE_LOW_WATERMARK)
 , d_nodeHighWatermark(DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK)
+, d_zeroCopyThreshold(DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD)
 , d_name(basicAllocator)
 , d_port()
 , d_ioThreads()
 , d_maxConnections(DEFAULT_INITIALIZER_MAX_CONNECTIONS)
 , d_heartbeatIntervalMs(DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS)
+, d_flushPolicy(DEFAULT_INITIALIZER_FLUSH_POLICY)
+, d_flushMaxBytes(DEFAULT_INITIALIZER_FLUSH_MAX_BYTES)
+, d_flushMaxDelayUs(DEFAULT_INITIALIZER_FLUSH_MAX_DELAY_US)
+, d_flushRateThreshold(DEFAULT_INITIALIZER_FLUSH_RATE_THRESHOLD)
 , d_useNtf(DEFAULT_INITIALIZER_USE_NTF)
 {
 }
@@ -2852,11 +3055,16 @@ TcpInterfaceConfig::TcpInterfaceConfig(const TcpInterfaceConfig& original,
 , d_highWatermark(original.d_highWatermark)
 , d_nodeLowWatermark(original.d_nodeLowWatermark)
 , d_nodeHighWatermark(original.d_nodeHighWatermark)
+, d_zeroCopyThreshold(original.d_zeroCopyThreshold)
 , d_name(original.d_name, basicAllocator)
 , d_port(original.d_port)
 , d_ioThreads(original.d_ioThreads)
 , d_maxConnections(original.d_maxConnections)
 , d_heartbeatIntervalMs(original.d_heartbeatIntervalMs)
+, d_flushPolicy(original.d_flushPolicy)
+, d_flushMaxBytes(original.d_flushMaxBytes)
+, d_flushMaxDelayUs(original.d_flushMaxDelayUs)
+, d_flushRateThreshold(original.d_flushRateThreshold)
 , d_useNtf(original.d_useNtf)
 {
 }
@@ -2868,11 +3076,16 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original) noexcept
   d_highWatermark(bsl::move(original.d_highWatermark)),
   d_nodeLowWatermark(bsl::move(original.d_nodeLowWatermark)),
   d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark)),
+  d_zeroCopyThreshold(bsl::move(original.d_zeroCopyThreshold)),
   d_name(bsl::move(original.d_name)),
   d_port(bsl::move(original.d_port)),
   d_ioThreads(bsl::move(original.d_ioThreads)),
   d_maxConnections(bsl::move(original.d_maxConnections)),
   d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs)),
+  d_flushPolicy(bsl::move(original.d_flushPolicy)),
+  d_flushMaxBytes(bsl::move(original.d_flushMaxBytes)),
+  d_flushMaxDelayUs(bsl::move(original.d_flushMaxDelayUs)),
+  d_flushRateThreshold(bsl::move(original.d_flushRateThreshold)),
   d_useNtf(bsl::move(original.d_useNtf))
 {
 }
@@ -2883,11 +3096,16 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original,
 , d_highWatermark(bsl::move(original.d_highWatermark))
 , d_nodeLowWatermark(bsl::move(original.d_nodeLowWatermark))
 , d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark))
+, d_zeroCopyThreshold(bsl::move(original.d_zeroCopyThreshold))
 , d_name(bsl::move(original.d_name), basicAllocator)
 , d_port(bsl::move(original.d_port))
 , d_ioThreads(bsl::move(original.d_ioThreads))
 , d_maxConnections(bsl::move(original.d_maxConnections))
 , d_heartbeatIntervalMs(bsl::move(original.d_heartbeatIntervalMs))
+, d_flushPolicy(bsl::move(original.d_flushPolicy))
+, d_flushMaxBytes(bsl::move(original.d_flushMaxBytes))
+, d_flushMaxDelayUs(bsl::move(original.d_flushMaxDelayUs))
+, d_flushRateThreshold(bsl::move(original.d_flushRateThreshold))
 , d_useNtf(bsl::move(original.d_useNtf))
 {
 }
@@ -2913,6 +3131,11 @@ TcpInterfaceConfig::operator=(const TcpInterfaceConfig& rhs)
         d_nodeHighWatermark   = rhs.d_nodeHighWatermark;
         d_heartbeatIntervalMs = rhs.d_heartbeatIntervalMs;
         d_useNtf              = rhs.d_useNtf;
+        d_zeroCopyThreshold   = rhs.d_zeroCopyThreshold;
+        d_flushPolicy         = rhs.d_flushPolicy;
+        d_flushMaxBytes       = rhs.d_flushMaxBytes;
+        d_flushMaxDelayUs     = rhs.d_flushMaxDelayUs;
+        d_flushRateThreshold  = rhs.d_flushRateThreshold;
     }
 
     return *this;
@@ -2933,6 +3156,11 @@ TcpInterfaceConfig& TcpInterfaceConfig::operator=(TcpInterfaceConfig&& rhs)
         d_nodeHighWatermark   = bsl::move(rhs.d_nodeHighWatermark);
         d_heartbeatIntervalMs = bsl::move(rhs.d_heartbeatIntervalMs);
         d_useNtf              = bsl::move(rhs.d_useNtf);
+        d_zeroCopyThreshold   = bsl::move(rhs.d_zeroCopyThreshold);
+        d_flushPolicy         = bsl::move(rhs.d_flushPolicy);
+        d_flushMaxBytes       = bsl::move(rhs.d_flushMaxBytes);
+        d_flushMaxDelayUs     = bsl::move(rhs.d_flushMaxDelayUs);
+        d_flushRateThreshold  = bsl::move(rhs.d_flushRateThreshold);
     }
 
     return *this;
@@ -2951,6 +3179,11 @@ void TcpInterfaceConfig::reset()
     d_nodeHighWatermark   = DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK;
     d_heartbeatIntervalMs = DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
     d_useNtf              = DEFAULT_INITIALIZER_USE_NTF;
+    d_zeroCopyThreshold   = DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD;
+    d_flushPolicy         = DEFAULT_INITIALIZER_FLUSH_POLICY;
+    d_flushMaxBytes       = DEFAULT_INITIALIZER_FLUSH_MAX_BYTES;
+    d_flushMaxDelayUs     = DEFAULT_INITIALIZER_FLUSH_MAX_DELAY_US;
+    d_flushRateThreshold  = DEFAULT_INITIALIZER_FLUSH_RATE_THRESHOLD;
 }
 
 // ACCESSORS
@@ -2971,10 +3204,193 @@ bsl::ostream& TcpInterfaceConfig::print(bsl::ostream& stream,
     printer.printAttribute("nodeHighWatermark", this->nodeHighWatermark());
     printer.printAttribute("heartbeatIntervalMs", this->heartbeatIntervalMs());
     printer.printAttribute("useNtf", this->useNtf());
+    printer.printAttribute("zeroCopyThreshold", this->zeroCopyThreshold());
+    printer.printAttribute("flushPolicy", this->flushPolicy());
+    printer.printAttribute("flushMaxBytes", this->flushMaxBytes());
+    printer.printAttribute("flushMaxDelayUs", this->flushMaxDelayUs());
+    printer.printAttribute("flushRateThreshold", this->flushRateThreshold());
     printer.end();
     return stream;
 }
 
+// ---------------------------
+// class ThreadPlacementConfig
+// ---------------------------
+
+// CONSTANTS
+
+const char ThreadPlacementConfig::CLASS_NAME[] = "ThreadPlacementConfig";
+
+const bdlat_AttributeInfo ThreadPlacementConfig::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_SESSIONS,
+     "sessions",
+     sizeof("sessions") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_QUEUES,
+     "queues",
+     sizeof("queues") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_CLUSTERS,
+     "clusters",
+     sizeof("clusters") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_IO_THREADS,
+     "ioThreads",
+     sizeof("ioThreads") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_SCHEDULER,
+     "scheduler",
+     sizeof("scheduler") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+ThreadPlacementConfig::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 5; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            ThreadPlacementConfig::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* ThreadPlacementConfig::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_SESSIONS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SESSIONS];
+    case ATTRIBUTE_ID_QUEUES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES];
+    case ATTRIBUTE_ID_CLUSTERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTERS];
+    case ATTRIBUTE_ID_IO_THREADS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_THREADS];
+    case ATTRIBUTE_ID_SCHEDULER:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCHEDULER];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+ThreadPlacementConfig::ThreadPlacementConfig(bslma::Allocator* basicAllocator)
+: d_sessions(basicAllocator)
+, d_queues(basicAllocator)
+, d_clusters(basicAllocator)
+, d_ioThreads(basicAllocator)
+, d_scheduler(basicAllocator)
+{
+}
+
+ThreadPlacementConfig::ThreadPlacementConfig(
+    const ThreadPlacementConfig& original,
+    bslma::Allocator*            basicAllocator)
+: d_sessions(original.d_sessions, basicAllocator)
+, d_queues(original.d_queues, basicAllocator)
+, d_clusters(original.d_clusters, basicAllocator)
+, d_ioThreads(original.d_ioThreads, basicAllocator)
+, d_scheduler(original.d_scheduler, basicAllocator)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ThreadPlacementConfig::ThreadPlacementConfig(
+    ThreadPlacementConfig&& original) noexcept
+: d_sessions(bsl::move(original.d_sessions)),
+  d_queues(bsl::move(original.d_queues)),
+  d_clusters(bsl::move(original.d_clusters)),
+  d_ioThreads(bsl::move(original.d_ioThreads)),
+  d_scheduler(bsl::move(original.d_scheduler))
+{
+}
+
+ThreadPlacementConfig::ThreadPlacementConfig(
+    ThreadPlacementConfig&& original,
+    bslma::Allocator*       basicAllocator)
+: d_sessions(bsl::move(original.d_sessions), basicAllocator)
+, d_queues(bsl::move(original.d_queues), basicAllocator)
+, d_clusters(bsl::move(original.d_clusters), basicAllocator)
+, d_ioThreads(bsl::move(original.d_ioThreads), basicAllocator)
+, d_scheduler(bsl::move(original.d_scheduler), basicAllocator)
+{
+}
+#endif
+
+ThreadPlacementConfig::~ThreadPlacementConfig()
+{
+}
+
+// MANIPULATORS
+
+ThreadPlacementConfig&
+ThreadPlacementConfig::operator=(const ThreadPlacementConfig& rhs)
+{
+    if (this != &rhs) {
+        d_sessions  = rhs.d_sessions;
+        d_queues    = rhs.d_queues;
+        d_clusters  = rhs.d_clusters;
+        d_ioThreads = rhs.d_ioThreads;
+        d_scheduler = rhs.d_scheduler;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ThreadPlacementConfig&
+ThreadPlacementConfig::operator=(ThreadPlacementConfig&& rhs)
+{
+    if (this != &rhs) {
+        d_sessions  = bsl::move(rhs.d_sessions);
+        d_queues    = bsl::move(rhs.d_queues);
+        d_clusters  = bsl::move(rhs.d_clusters);
+        d_ioThreads = bsl::move(rhs.d_ioThreads);
+        d_scheduler = bsl::move(rhs.d_scheduler);
+    }
+
+    return *this;
+}
+#endif
+
+void ThreadPlacementConfig::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_sessions);
+    bdlat_ValueTypeFunctions::reset(&d_queues);
+    bdlat_ValueTypeFunctions::reset(&d_clusters);
+    bdlat_ValueTypeFunctions::reset(&d_ioThreads);
+    bdlat_ValueTypeFunctions::reset(&d_scheduler);
+}
+
+// ACCESSORS
+
+bsl::ostream& ThreadPlacementConfig::print(bsl::ostream& stream,
+                                          int           level,
+                                          int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("sessions", this->sessions());
+    printer.printAttribute("queues", this->queues());
+    printer.printAttribute("clusters", this->clusters());
+    printer.printAttribute("ioThreads", this->ioThreads());
+    printer.printAttribute("scheduler", this->scheduler());
+    printer.end();
+    return stream;
+}
 // -------------------------------
 // class VirtualClusterInformation
 // -------------------------------
@@ -3364,6 +3780,12 @@ const char* ClusterNodeConnection::selectionName() const
 const char DispatcherProcessorConfig::CLASS_NAME[] =
     "DispatcherProcessorConfig";
 
+const int
+    DispatcherProcessorConfig::DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS = 0;
+
+const int DispatcherProcessorConfig::
+    DEFAULT_INITIALIZER_REBALANCE_THRESHOLD_PERCENT = 20;
+
 const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PROCESSORS,
      "numProcessors",
@@ -3374,7 +3796,17 @@ const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "processorConfig",
      sizeof("processorConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_REBALANCE_INTERVAL_MS,
+     "rebalanceIntervalMs",
+     sizeof("rebalanceIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REBALANCE_THRESHOLD_PERCENT,
+     "rebalanceThresholdPercent",
+     sizeof("rebalanceThresholdPercent") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
@@ -3382,7 +3814,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorConfig::lookupAttributeInfo(const char* name,
                                                int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3403,6 +3835,11 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROCESSORS];
     case ATTRIBUTE_ID_PROCESSOR_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG];
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS];
+    case ATTRIBUTE_ID_REBALANCE_THRESHOLD_PERCENT:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT];
     default: return 0;
     }
 }
@@ -3412,6 +3849,8 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
 DispatcherProcessorConfig::DispatcherProcessorConfig()
 : d_processorConfig()
 , d_numProcessors()
+, d_rebalanceIntervalMs(DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS)
+, d_rebalanceThresholdPercent(DEFAULT_INITIALIZER_REBALANCE_THRESHOLD_PERCENT)
 {
 }
 
@@ -3419,6 +3858,8 @@ DispatcherProcessorConfig::DispatcherProcessorConfig(
     const DispatcherProcessorConfig& original)
 : d_processorConfig(original.d_processorConfig)
 , d_numProcessors(original.d_numProcessors)
+, d_rebalanceIntervalMs(original.d_rebalanceIntervalMs)
+, d_rebalanceThresholdPercent(original.d_rebalanceThresholdPercent)
 {
 }
 
@@ -3432,8 +3873,10 @@ DispatcherProcessorConfig&
 DispatcherProcessorConfig::operator=(const DispatcherProcessorConfig& rhs)
 {
     if (this != &rhs) {
-        d_numProcessors   = rhs.d_numProcessors;
-        d_processorConfig = rhs.d_processorConfig;
+        d_numProcessors             = rhs.d_numProcessors;
+        d_processorConfig           = rhs.d_processorConfig;
+        d_rebalanceIntervalMs       = rhs.d_rebalanceIntervalMs;
+        d_rebalanceThresholdPercent = rhs.d_rebalanceThresholdPercent;
     }
 
     return *this;
@@ -3445,8 +3888,11 @@ DispatcherProcessorConfig&
 DispatcherProcessorConfig::operator=(DispatcherProcessorConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numProcessors   = bsl::move(rhs.d_numProcessors);
-        d_processorConfig = bsl::move(rhs.d_processorConfig);
+        d_numProcessors             = bsl::move(rhs.d_numProcessors);
+        d_processorConfig           = bsl::move(rhs.d_processorConfig);
+        d_rebalanceIntervalMs       = bsl::move(rhs.d_rebalanceIntervalMs);
+        d_rebalanceThresholdPercent = bsl::move(
+            rhs.d_rebalanceThresholdPercent);
     }
 
     return *this;
@@ -3457,6 +3903,9 @@ void DispatcherProcessorConfig::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_numProcessors);
     bdlat_ValueTypeFunctions::reset(&d_processorConfig);
+    d_rebalanceIntervalMs       = DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS;
+    d_rebalanceThresholdPercent =
+        DEFAULT_INITIALIZER_REBALANCE_THRESHOLD_PERCENT;
 }
 
 // ACCESSORS
@@ -3469,6 +3918,9 @@ bsl::ostream& DispatcherProcessorConfig::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("numProcessors", this->numProcessors());
     printer.printAttribute("processorConfig", this->processorConfig());
+    printer.printAttribute("rebalanceIntervalMs", this->rebalanceIntervalMs());
+    printer.printAttribute("rebalanceThresholdPercent",
+                           this->rebalanceThresholdPercent());
     printer.end();
     return stream;
 }
@@ -3877,6 +4329,28 @@ const bool PartitionConfig::DEFAULT_INITIALIZER_PREFAULT_PAGES = false;
 
 const bool PartitionConfig::DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN = true;
 
+const StorageWriteBackend::Value
+    PartitionConfig::DEFAULT_INITIALIZER_WRITE_BACKEND =
+        StorageWriteBackend::E_MMAP;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_SYNC_BEFORE_RECEIPT = false;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_MS = 0;
+
+const bsls::Types::Uint64
+    PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES = 1048576;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_INDEX_SNAPSHOT_INTERVAL_MS = 0;
+
+const char PartitionConfig::DEFAULT_INITIALIZER_COLD_TIER_LOCATION[] = "";
+
+const int PartitionConfig::DEFAULT_INITIALIZER_COLD_TIER_MIN_AGE_SECONDS = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_REPLICATION_BATCH_SIZE = 0;
+
+const int
+    PartitionConfig::DEFAULT_INITIALIZER_REPLICATION_BATCHING_THRESHOLD = 0;
+
 const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PARTITIONS,
      "numPartitions",
@@ -3932,14 +4406,59 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_WRITE_BACKEND,
+     "writeBackend",
+     sizeof("writeBackend") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_SYNC_BEFORE_RECEIPT,
+     "syncBeforeReceipt",
+     sizeof("syncBeforeReceipt") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_MS,
+     "groupCommitMaxDelayMs",
+     sizeof("groupCommitMaxDelayMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES,
+     "groupCommitMaxBytes",
+     sizeof("groupCommitMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_INDEX_SNAPSHOT_INTERVAL_MS,
+     "indexSnapshotIntervalMs",
+     sizeof("indexSnapshotIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_COLD_TIER_LOCATION,
+     "coldTierLocation",
+     sizeof("coldTierLocation") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_COLD_TIER_MIN_AGE_SECONDS,
+     "coldTierMinAgeSeconds",
+     sizeof("coldTierMinAgeSeconds") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REPLICATION_BATCH_SIZE,
+     "replicationBatchSize",
+     sizeof("replicationBatchSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_REPLICATION_BATCHING_THRESHOLD,
+     "replicationBatchingThreshold",
+     sizeof("replicationBatchingThreshold") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 11; ++i) {
+    for (int i = 0; i < 20; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3977,6 +4496,28 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_WRITE_BACKEND:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITE_BACKEND];
+    case ATTRIBUTE_ID_SYNC_BEFORE_RECEIPT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_MS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES];
+    case ATTRIBUTE_ID_INDEX_SNAPSHOT_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS];
+    case ATTRIBUTE_ID_COLD_TIER_LOCATION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_LOCATION];
+    case ATTRIBUTE_ID_COLD_TIER_MIN_AGE_SECONDS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS];
+    case ATTRIBUTE_ID_REPLICATION_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE];
+    case ATTRIBUTE_ID_REPLICATION_BATCHING_THRESHOLD:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD];
     default: return 0;
     }
 }
@@ -3987,14 +4528,24 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 : d_maxDataFileSize()
 , d_maxJournalFileSize()
 , d_maxQlistFileSize()
+, d_groupCommitMaxBytes(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES)
 , d_location(basicAllocator)
 , d_archiveLocation(basicAllocator)
+, d_coldTierLocation(DEFAULT_INITIALIZER_COLD_TIER_LOCATION, basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
+, d_writeBackend(DEFAULT_INITIALIZER_WRITE_BACKEND)
+, d_groupCommitMaxDelayMs(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_MS)
+, d_indexSnapshotIntervalMs(DEFAULT_INITIALIZER_INDEX_SNAPSHOT_INTERVAL_MS)
+, d_coldTierMinAgeSeconds(DEFAULT_INITIALIZER_COLD_TIER_MIN_AGE_SECONDS)
+, d_replicationBatchSize(DEFAULT_INITIALIZER_REPLICATION_BATCH_SIZE)
+, d_replicationBatchingThreshold(
+      DEFAULT_INITIALIZER_REPLICATION_BATCHING_THRESHOLD)
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
+, d_syncBeforeReceipt(DEFAULT_INITIALIZER_SYNC_BEFORE_RECEIPT)
 {
 }
 
@@ -4003,14 +4554,23 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 : d_maxDataFileSize(original.d_maxDataFileSize)
 , d_maxJournalFileSize(original.d_maxJournalFileSize)
 , d_maxQlistFileSize(original.d_maxQlistFileSize)
+, d_groupCommitMaxBytes(original.d_groupCommitMaxBytes)
 , d_location(original.d_location, basicAllocator)
 , d_archiveLocation(original.d_archiveLocation, basicAllocator)
+, d_coldTierLocation(original.d_coldTierLocation, basicAllocator)
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
+, d_writeBackend(original.d_writeBackend)
+, d_groupCommitMaxDelayMs(original.d_groupCommitMaxDelayMs)
+, d_indexSnapshotIntervalMs(original.d_indexSnapshotIntervalMs)
+, d_coldTierMinAgeSeconds(original.d_coldTierMinAgeSeconds)
+, d_replicationBatchSize(original.d_replicationBatchSize)
+, d_replicationBatchingThreshold(original.d_replicationBatchingThreshold)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
+, d_syncBeforeReceipt(original.d_syncBeforeReceipt)
 {
 }
 
@@ -4020,14 +4580,24 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
 : d_maxDataFileSize(bsl::move(original.d_maxDataFileSize)),
   d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize)),
   d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize)),
+  d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes)),
   d_location(bsl::move(original.d_location)),
   d_archiveLocation(bsl::move(original.d_archiveLocation)),
+  d_coldTierLocation(bsl::move(original.d_coldTierLocation)),
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
+  d_writeBackend(bsl::move(original.d_writeBackend)),
+  d_groupCommitMaxDelayMs(bsl::move(original.d_groupCommitMaxDelayMs)),
+  d_indexSnapshotIntervalMs(bsl::move(original.d_indexSnapshotIntervalMs)),
+  d_coldTierMinAgeSeconds(bsl::move(original.d_coldTierMinAgeSeconds)),
+  d_replicationBatchSize(bsl::move(original.d_replicationBatchSize)),
+  d_replicationBatchingThreshold(
+      bsl::move(original.d_replicationBatchingThreshold)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
-  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown)),
+  d_syncBeforeReceipt(bsl::move(original.d_syncBeforeReceipt))
 {
 }
 
@@ -4036,14 +4606,24 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 : d_maxDataFileSize(bsl::move(original.d_maxDataFileSize))
 , d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize))
 , d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize))
+, d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes))
 , d_location(bsl::move(original.d_location), basicAllocator)
 , d_archiveLocation(bsl::move(original.d_archiveLocation), basicAllocator)
+, d_coldTierLocation(bsl::move(original.d_coldTierLocation), basicAllocator)
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
+, d_writeBackend(bsl::move(original.d_writeBackend))
+, d_groupCommitMaxDelayMs(bsl::move(original.d_groupCommitMaxDelayMs))
+, d_indexSnapshotIntervalMs(bsl::move(original.d_indexSnapshotIntervalMs))
+, d_coldTierMinAgeSeconds(bsl::move(original.d_coldTierMinAgeSeconds))
+, d_replicationBatchSize(bsl::move(original.d_replicationBatchSize))
+, d_replicationBatchingThreshold(
+      bsl::move(original.d_replicationBatchingThreshold))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+, d_syncBeforeReceipt(bsl::move(original.d_syncBeforeReceipt))
 {
 }
 #endif
@@ -4057,17 +4637,26 @@ PartitionConfig::~PartitionConfig()
 PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = rhs.d_numPartitions;
-        d_location            = rhs.d_location;
-        d_archiveLocation     = rhs.d_archiveLocation;
-        d_maxDataFileSize     = rhs.d_maxDataFileSize;
-        d_maxJournalFileSize  = rhs.d_maxJournalFileSize;
-        d_maxQlistFileSize    = rhs.d_maxQlistFileSize;
-        d_preallocate         = rhs.d_preallocate;
-        d_maxArchivedFileSets = rhs.d_maxArchivedFileSets;
-        d_prefaultPages       = rhs.d_prefaultPages;
-        d_flushAtShutdown     = rhs.d_flushAtShutdown;
-        d_syncConfig          = rhs.d_syncConfig;
+        d_numPartitions                = rhs.d_numPartitions;
+        d_location                     = rhs.d_location;
+        d_archiveLocation              = rhs.d_archiveLocation;
+        d_maxDataFileSize              = rhs.d_maxDataFileSize;
+        d_maxJournalFileSize           = rhs.d_maxJournalFileSize;
+        d_maxQlistFileSize             = rhs.d_maxQlistFileSize;
+        d_preallocate                  = rhs.d_preallocate;
+        d_maxArchivedFileSets          = rhs.d_maxArchivedFileSets;
+        d_prefaultPages                = rhs.d_prefaultPages;
+        d_flushAtShutdown              = rhs.d_flushAtShutdown;
+        d_syncConfig                   = rhs.d_syncConfig;
+        d_writeBackend                 = rhs.d_writeBackend;
+        d_syncBeforeReceipt            = rhs.d_syncBeforeReceipt;
+        d_groupCommitMaxDelayMs        = rhs.d_groupCommitMaxDelayMs;
+        d_groupCommitMaxBytes          = rhs.d_groupCommitMaxBytes;
+        d_indexSnapshotIntervalMs      = rhs.d_indexSnapshotIntervalMs;
+        d_coldTierLocation             = rhs.d_coldTierLocation;
+        d_coldTierMinAgeSeconds        = rhs.d_coldTierMinAgeSeconds;
+        d_replicationBatchSize         = rhs.d_replicationBatchSize;
+        d_replicationBatchingThreshold = rhs.d_replicationBatchingThreshold;
     }
 
     return *this;
@@ -4078,17 +4667,30 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = bsl::move(rhs.d_numPartitions);
-        d_location            = bsl::move(rhs.d_location);
-        d_archiveLocation     = bsl::move(rhs.d_archiveLocation);
-        d_maxDataFileSize     = bsl::move(rhs.d_maxDataFileSize);
-        d_maxJournalFileSize  = bsl::move(rhs.d_maxJournalFileSize);
-        d_maxQlistFileSize    = bsl::move(rhs.d_maxQlistFileSize);
-        d_preallocate         = bsl::move(rhs.d_preallocate);
-        d_maxArchivedFileSets = bsl::move(rhs.d_maxArchivedFileSets);
-        d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
-        d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
-        d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_numPartitions                = bsl::move(rhs.d_numPartitions);
+        d_location                     = bsl::move(rhs.d_location);
+        d_archiveLocation              = bsl::move(rhs.d_archiveLocation);
+        d_maxDataFileSize              = bsl::move(rhs.d_maxDataFileSize);
+        d_maxJournalFileSize           = bsl::move(rhs.d_maxJournalFileSize);
+        d_maxQlistFileSize             = bsl::move(rhs.d_maxQlistFileSize);
+        d_preallocate                  = bsl::move(rhs.d_preallocate);
+        d_maxArchivedFileSets          = bsl::move(rhs.d_maxArchivedFileSets);
+        d_prefaultPages                = bsl::move(rhs.d_prefaultPages);
+        d_flushAtShutdown              = bsl::move(rhs.d_flushAtShutdown);
+        d_syncConfig                   = bsl::move(rhs.d_syncConfig);
+        d_writeBackend                 = bsl::move(rhs.d_writeBackend);
+        d_syncBeforeReceipt            = bsl::move(rhs.d_syncBeforeReceipt);
+        d_groupCommitMaxDelayMs        =
+            bsl::move(rhs.d_groupCommitMaxDelayMs);
+        d_groupCommitMaxBytes          = bsl::move(rhs.d_groupCommitMaxBytes);
+        d_indexSnapshotIntervalMs      =
+            bsl::move(rhs.d_indexSnapshotIntervalMs);
+        d_coldTierLocation             = bsl::move(rhs.d_coldTierLocation);
+        d_coldTierMinAgeSeconds        =
+            bsl::move(rhs.d_coldTierMinAgeSeconds);
+        d_replicationBatchSize         = bsl::move(rhs.d_replicationBatchSize);
+        d_replicationBatchingThreshold =
+            bsl::move(rhs.d_replicationBatchingThreshold);
     }
 
     return *this;
@@ -4108,6 +4710,21 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_writeBackend                 = DEFAULT_INITIALIZER_WRITE_BACKEND;
+    d_syncBeforeReceipt            = DEFAULT_INITIALIZER_SYNC_BEFORE_RECEIPT;
+    d_groupCommitMaxDelayMs        =
+        DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_MS;
+    d_groupCommitMaxBytes          =
+        DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+    d_indexSnapshotIntervalMs      =
+        DEFAULT_INITIALIZER_INDEX_SNAPSHOT_INTERVAL_MS;
+    d_coldTierLocation             = DEFAULT_INITIALIZER_COLD_TIER_LOCATION;
+    d_coldTierMinAgeSeconds        =
+        DEFAULT_INITIALIZER_COLD_TIER_MIN_AGE_SECONDS;
+    d_replicationBatchSize         =
+        DEFAULT_INITIALIZER_REPLICATION_BATCH_SIZE;
+    d_replicationBatchingThreshold =
+        DEFAULT_INITIALIZER_REPLICATION_BATCHING_THRESHOLD;
 }
 
 // ACCESSORS
@@ -4129,6 +4746,20 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("writeBackend", this->writeBackend());
+    printer.printAttribute("syncBeforeReceipt", this->syncBeforeReceipt());
+    printer.printAttribute("groupCommitMaxDelayMs",
+                           this->groupCommitMaxDelayMs());
+    printer.printAttribute("groupCommitMaxBytes", this->groupCommitMaxBytes());
+    printer.printAttribute("indexSnapshotIntervalMs",
+                           this->indexSnapshotIntervalMs());
+    printer.printAttribute("coldTierLocation", this->coldTierLocation());
+    printer.printAttribute("coldTierMinAgeSeconds",
+                           this->coldTierMinAgeSeconds());
+    printer.printAttribute("replicationBatchSize",
+                           this->replicationBatchSize());
+    printer.printAttribute("replicationBatchingThreshold",
+                           this->replicationBatchingThreshold());
     printer.end();
     return stream;
 }
@@ -5754,14 +6385,19 @@ const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "configureStream",
      sizeof("configureStream") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT}};
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_THREAD_PLACEMENT,
+     "threadPlacement",
+     sizeof("threadPlacement") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(const char* name,
                                                           int nameLength)
 {
-    for (int i = 0; i < 17; ++i) {
+    for (int i = 0; i < 18; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             AppConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5811,6 +6447,8 @@ const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2];
     case ATTRIBUTE_ID_CONFIGURE_STREAM:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM];
+    case ATTRIBUTE_ID_THREAD_PLACEMENT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THREAD_PLACEMENT];
     default: return 0;
     }
 }
@@ -5829,6 +6467,7 @@ AppConfig::AppConfig(bslma::Allocator* basicAllocator)
 , d_plugins(basicAllocator)
 , d_networkInterfaces(basicAllocator)
 , d_messagePropertiesV2()
+, d_threadPlacement(basicAllocator)
 , d_dispatcherConfig()
 , d_bmqconfConfig()
 , d_brokerVersion()
@@ -5851,6 +6490,7 @@ AppConfig::AppConfig(const AppConfig&  original,
 , d_plugins(original.d_plugins, basicAllocator)
 , d_networkInterfaces(original.d_networkInterfaces, basicAllocator)
 , d_messagePropertiesV2(original.d_messagePropertiesV2)
+, d_threadPlacement(original.d_threadPlacement, basicAllocator)
 , d_dispatcherConfig(original.d_dispatcherConfig)
 , d_bmqconfConfig(original.d_bmqconfConfig)
 , d_brokerVersion(original.d_brokerVersion)
@@ -5874,6 +6514,7 @@ AppConfig::AppConfig(AppConfig&& original) noexcept
   d_plugins(bsl::move(original.d_plugins)),
   d_networkInterfaces(bsl::move(original.d_networkInterfaces)),
   d_messagePropertiesV2(bsl::move(original.d_messagePropertiesV2)),
+  d_threadPlacement(bsl::move(original.d_threadPlacement)),
   d_dispatcherConfig(bsl::move(original.d_dispatcherConfig)),
   d_bmqconfConfig(bsl::move(original.d_bmqconfConfig)),
   d_brokerVersion(bsl::move(original.d_brokerVersion)),
@@ -5897,6 +6538,7 @@ AppConfig::AppConfig(AppConfig&& original, bslma::Allocator* basicAllocator)
 , d_plugins(bsl::move(original.d_plugins), basicAllocator)
 , d_networkInterfaces(bsl::move(original.d_networkInterfaces), basicAllocator)
 , d_messagePropertiesV2(bsl::move(original.d_messagePropertiesV2))
+, d_threadPlacement(bsl::move(original.d_threadPlacement), basicAllocator)
 , d_dispatcherConfig(bsl::move(original.d_dispatcherConfig))
 , d_bmqconfConfig(bsl::move(original.d_bmqconfConfig))
 , d_brokerVersion(bsl::move(original.d_brokerVersion))
@@ -5934,6 +6576,7 @@ AppConfig& AppConfig::operator=(const AppConfig& rhs)
         d_plugins              = rhs.d_plugins;
         d_messagePropertiesV2  = rhs.d_messagePropertiesV2;
         d_configureStream      = rhs.d_configureStream;
+        d_threadPlacement      = rhs.d_threadPlacement;
     }
 
     return *this;
@@ -5961,6 +6604,7 @@ AppConfig& AppConfig::operator=(AppConfig&& rhs)
         d_plugins              = bsl::move(rhs.d_plugins);
         d_messagePropertiesV2  = bsl::move(rhs.d_messagePropertiesV2);
         d_configureStream      = bsl::move(rhs.d_configureStream);
+        d_threadPlacement      = bsl::move(rhs.d_threadPlacement);
     }
 
     return *this;
@@ -5986,6 +6630,7 @@ void AppConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_plugins);
     bdlat_ValueTypeFunctions::reset(&d_messagePropertiesV2);
     d_configureStream = DEFAULT_INITIALIZER_CONFIGURE_STREAM;
+    bdlat_ValueTypeFunctions::reset(&d_threadPlacement);
 }
 
 // ACCESSORS
@@ -6013,6 +6658,7 @@ AppConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("plugins", this->plugins());
     printer.printAttribute("messagePropertiesV2", this->messagePropertiesV2());
     printer.printAttribute("configureStream", this->configureStream());
+    printer.printAttribute("threadPlacement", this->threadPlacement());
     printer.end();
     return stream;
 }
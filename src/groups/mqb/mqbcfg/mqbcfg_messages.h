@@ -105,6 +105,9 @@ namespace mqbcfg {
 class TcpInterfaceConfig;
 }
 namespace mqbcfg {
+class ThreadPlacementConfig;
+}
+namespace mqbcfg {
 class VirtualClusterInformation;
 }
 namespace mqbcfg {
@@ -398,6 +401,76 @@ BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(mqbcfg::BmqconfConfig)
 
 namespace mqbcfg {
 
+// =======================
+// class ClientFlushPolicy
+// =======================
+
+struct ClientFlushPolicy {
+    // Enumeration of the policies used by a client session to decide when
+    // to flush the PUSH and ACK messages it coalesces.
+    // E_LATENCY............: flush as soon as the session has no more events
+    // to process
+    // E_THROUGHPUT.........: coalesce messages until 'flushMaxBytes' are
+    // pending or the oldest pending message has waited for
+    // 'flushMaxDelayUs'
+    // E_ADAPTIVE...........: behave as 'E_LATENCY' at low message rates, and
+    // as 'E_THROUGHPUT' once the rate of messages reaches
+    // 'flushRateThreshold' per second
+
+  public:
+    // TYPES
+    enum Value { E_LATENCY = 0, E_THROUGHPUT = 1, E_ADAPTIVE = 2 };
+
+    enum { NUM_ENUMERATORS = 3 };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_EnumeratorInfo ENUMERATOR_INFO_ARRAY[];
+
+    // CLASS METHODS
+    static const char* toString(Value value);
+    // Return the string representation exactly matching the enumerator
+    // name corresponding to the specified enumeration 'value'.
+
+    static int fromString(Value* result, const char* string, int stringLength);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'string' of the specified 'stringLength'.  Return 0 on
+    // success, and a non-zero value with no effect on 'result' otherwise
+    // (i.e., 'string' does not match any enumerator).
+
+    static int fromString(Value* result, const bsl::string& string);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'string'.  Return 0 on success, and a non-zero value with
+    // no effect on 'result' otherwise (i.e., 'string' does not match any
+    // enumerator).
+
+    static int fromInt(Value* result, int number);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'number'.  Return 0 on success, and a non-zero value with
+    // no effect on 'result' otherwise (i.e., 'number' does not match any
+    // enumerator).
+
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+    // Write to the specified 'stream' the string representation of
+    // the specified enumeration 'value'.  Return a reference to
+    // the modifiable 'stream'.
+};
+
+// FREE OPERATORS
+inline bsl::ostream& operator<<(bsl::ostream&            stream,
+                                ClientFlushPolicy::Value rhs);
+// Format the specified 'rhs' to the specified output 'stream' and
+// return a reference to the modifiable 'stream'.
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_ENUMERATION_TRAITS(mqbcfg::ClientFlushPolicy)
+
+namespace mqbcfg {
+
 // =======================
 // class ClusterAttributes
 // =======================
@@ -903,30 +976,45 @@ namespace mqbcfg {
 // ===================================
 
 class DispatcherProcessorParameters {
+    // queueSize..................: capacity of the queue of each processor
+    // queueSizeLowWatermark......: queue size below which the queue is
+    // considered back to normal queueSizeHighWatermark.....: queue size
+    // above which an alarm is raised useLockFreeQueue...........: use a
+    // lock-free ring buffer as the queue of each processor instead of the
+    // default queue.  The ring holds 'queueSize' events, rounded up to a
+    // power of two; beyond that, events spill to an unbounded overflow list,
+    // so that, like the default queue, the queue is not bounded by
+    // 'queueSize'
+
     // INSTANCE DATA
-    int d_queueSize;
-    int d_queueSizeLowWatermark;
-    int d_queueSizeHighWatermark;
+    int  d_queueSize;
+    int  d_queueSizeLowWatermark;
+    int  d_queueSizeHighWatermark;
+    bool d_useLockFreeQueue;
 
   public:
     // TYPES
     enum {
         ATTRIBUTE_ID_QUEUE_SIZE                = 0,
         ATTRIBUTE_ID_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_ID_USE_LOCK_FREE_QUEUE       = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
         ATTRIBUTE_INDEX_QUEUE_SIZE                = 0,
         ATTRIBUTE_INDEX_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE       = 3
     };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const bool DEFAULT_INITIALIZER_USE_LOCK_FREE_QUEUE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -1023,6 +1111,10 @@ class DispatcherProcessorParameters {
     // Return a reference to the modifiable "QueueSizeHighWatermark"
     // attribute of this object.
 
+    bool& useLockFreeQueue();
+    // Return a reference to the modifiable "UseLockFreeQueue" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -1076,6 +1168,9 @@ class DispatcherProcessorParameters {
     int queueSizeHighWatermark() const;
     // Return the value of the "QueueSizeHighWatermark" attribute of this
     // object.
+
+    bool useLockFreeQueue() const;
+    // Return the value of the "UseLockFreeQueue" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -3613,6 +3708,72 @@ BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(mqbcfg::StorageSyncConfig)
 
 namespace mqbcfg {
 
+// =========================
+// class StorageWriteBackend
+// =========================
+
+struct StorageWriteBackend {
+    // Enumeration of the mechanisms used to write back the partition files.
+    // E_MMAP...............: records are written to the memory mapped files
+    // and written back to disk by the kernel's page cache writeback
+    // E_ASYNC_WRITEBACK....: records are written to the memory mapped files
+    // and the dirty ranges are proactively written back to disk by a
+    // dedicated thread, with completions delivered to the partition thread
+
+  public:
+    // TYPES
+    enum Value { E_MMAP = 0, E_ASYNC_WRITEBACK = 1 };
+
+    enum { NUM_ENUMERATORS = 2 };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_EnumeratorInfo ENUMERATOR_INFO_ARRAY[];
+
+    // CLASS METHODS
+    static const char* toString(Value value);
+    // Return the string representation exactly matching the enumerator
+    // name corresponding to the specified enumeration 'value'.
+
+    static int fromString(Value* result, const char* string, int stringLength);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'string' of the specified 'stringLength'.  Return 0 on
+    // success, and a non-zero value with no effect on 'result' otherwise
+    // (i.e., 'string' does not match any enumerator).
+
+    static int fromString(Value* result, const bsl::string& string);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'string'.  Return 0 on success, and a non-zero value with
+    // no effect on 'result' otherwise (i.e., 'string' does not match any
+    // enumerator).
+
+    static int fromInt(Value* result, int number);
+    // Load into the specified 'result' the enumerator matching the
+    // specified 'number'.  Return 0 on success, and a non-zero value with
+    // no effect on 'result' otherwise (i.e., 'number' does not match any
+    // enumerator).
+
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+    // Write to the specified 'stream' the string representation of
+    // the specified enumeration 'value'.  Return a reference to
+    // the modifiable 'stream'.
+};
+
+// FREE OPERATORS
+inline bsl::ostream& operator<<(bsl::ostream&              stream,
+                                StorageWriteBackend::Value rhs);
+// Format the specified 'rhs' to the specified output 'stream' and
+// return a reference to the modifiable 'stream'.
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_ENUMERATION_TRAITS(mqbcfg::StorageWriteBackend)
+
+namespace mqbcfg {
+
 // ==================
 // class SyslogConfig
 // ==================
@@ -4059,19 +4220,33 @@ class TcpInterfaceConfig {
     // heartbeatIntervalMs..: How often (in milliseconds) to check if the
     // channel received data, and emit heartbeat.  0 to globally disable.
     // useNtf...............: Use the new NTF based TCP transport library
-    // instead of the existing one based on BTE
+    // instead of the existing one based on BTE zeroCopyThreshold....:
+    // Minimum size (in bytes) of a write for it to be sent using zero-copy
+    // ('MSG_ZEROCOPY'), if supported by the platform.  0 to disable.
+    // flushPolicy..........: Policy used by client sessions to decide when to
+    // flush the PUSH and ACK messages they coalesce flushMaxBytes........:
+    // Number of bytes of pending messages triggering a flush when
+    // coalescing flushMaxDelayUs......: Maximum time (in microseconds) a
+    // message is held when coalescing flushRateThreshold...: Rate of
+    // messages (per second) above which the 'E_ADAPTIVE' policy starts
+    // coalescing
 
     // INSTANCE DATA
-    bsls::Types::Int64 d_lowWatermark;
-    bsls::Types::Int64 d_highWatermark;
-    bsls::Types::Int64 d_nodeLowWatermark;
-    bsls::Types::Int64 d_nodeHighWatermark;
-    bsl::string        d_name;
-    int                d_port;
-    int                d_ioThreads;
-    int                d_maxConnections;
-    int                d_heartbeatIntervalMs;
-    bool               d_useNtf;
+    bsls::Types::Int64       d_lowWatermark;
+    bsls::Types::Int64       d_highWatermark;
+    bsls::Types::Int64       d_nodeLowWatermark;
+    bsls::Types::Int64       d_nodeHighWatermark;
+    bsls::Types::Int64       d_zeroCopyThreshold;
+    bsl::string              d_name;
+    int                      d_port;
+    int                      d_ioThreads;
+    int                      d_maxConnections;
+    int                      d_heartbeatIntervalMs;
+    ClientFlushPolicy::Value d_flushPolicy;
+    int                      d_flushMaxBytes;
+    int                      d_flushMaxDelayUs;
+    int                      d_flushRateThreshold;
+    bool                     d_useNtf;
 
   public:
     // TYPES
@@ -4085,10 +4260,15 @@ class TcpInterfaceConfig {
         ATTRIBUTE_ID_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_ID_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_ID_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_ID_USE_NTF               = 9
+        ATTRIBUTE_ID_USE_NTF               = 9,
+        ATTRIBUTE_ID_ZERO_COPY_THRESHOLD   = 10,
+        ATTRIBUTE_ID_FLUSH_POLICY          = 11,
+        ATTRIBUTE_ID_FLUSH_MAX_BYTES       = 12,
+        ATTRIBUTE_ID_FLUSH_MAX_DELAY_US    = 13,
+        ATTRIBUTE_ID_FLUSH_RATE_THRESHOLD  = 14
     };
 
-    enum { NUM_ATTRIBUTES = 10 };
+    enum { NUM_ATTRIBUTES = 15 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -4100,7 +4280,12 @@ class TcpInterfaceConfig {
         ATTRIBUTE_INDEX_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_INDEX_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_INDEX_USE_NTF               = 9
+        ATTRIBUTE_INDEX_USE_NTF               = 9,
+        ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD   = 10,
+        ATTRIBUTE_INDEX_FLUSH_POLICY          = 11,
+        ATTRIBUTE_INDEX_FLUSH_MAX_BYTES       = 12,
+        ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US    = 13,
+        ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD  = 14
     };
 
     // CONSTANTS
@@ -4116,6 +4301,16 @@ class TcpInterfaceConfig {
 
     static const bool DEFAULT_INITIALIZER_USE_NTF;
 
+    static const bsls::Types::Int64 DEFAULT_INITIALIZER_ZERO_COPY_THRESHOLD;
+
+    static const ClientFlushPolicy::Value DEFAULT_INITIALIZER_FLUSH_POLICY;
+
+    static const int DEFAULT_INITIALIZER_FLUSH_MAX_BYTES;
+
+    static const int DEFAULT_INITIALIZER_FLUSH_MAX_DELAY_US;
+
+    static const int DEFAULT_INITIALIZER_FLUSH_RATE_THRESHOLD;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4249,6 +4444,26 @@ class TcpInterfaceConfig {
     // Return a reference to the modifiable "UseNtf" attribute of this
     // object.
 
+    bsls::Types::Int64& zeroCopyThreshold();
+    // Return a reference to the modifiable "ZeroCopyThreshold" attribute
+    // of this object.
+
+    ClientFlushPolicy::Value& flushPolicy();
+    // Return a reference to the modifiable "FlushPolicy" attribute of this
+    // object.
+
+    int& flushMaxBytes();
+    // Return a reference to the modifiable "FlushMaxBytes" attribute of
+    // this object.
+
+    int& flushMaxDelayUs();
+    // Return a reference to the modifiable "FlushMaxDelayUs" attribute of
+    // this object.
+
+    int& flushRateThreshold();
+    // Return a reference to the modifiable "FlushRateThreshold" attribute
+    // of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -4324,6 +4539,23 @@ class TcpInterfaceConfig {
 
     bool useNtf() const;
     // Return the value of the "UseNtf" attribute of this object.
+
+    bsls::Types::Int64 zeroCopyThreshold() const;
+    // Return the value of the "ZeroCopyThreshold" attribute of this
+    // object.
+
+    ClientFlushPolicy::Value flushPolicy() const;
+    // Return the value of the "FlushPolicy" attribute of this object.
+
+    int flushMaxBytes() const;
+    // Return the value of the "FlushMaxBytes" attribute of this object.
+
+    int flushMaxDelayUs() const;
+    // Return the value of the "FlushMaxDelayUs" attribute of this object.
+
+    int flushRateThreshold() const;
+    // Return the value of the "FlushRateThreshold" attribute of this
+    // object.
 };
 
 // FREE OPERATORS
@@ -4360,27 +4592,51 @@ BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
 
 namespace mqbcfg {
 
-// ===============================
-// class VirtualClusterInformation
-// ===============================
+// ===========================
+// class ThreadPlacementConfig
+// ===========================
 
-class VirtualClusterInformation {
-    // Type representing the information about the current node with regards to
-    // virtual cluster.
-    // name.............: name of the cluster selfNodeId.......: id of the
-    // current node in that virtual cluster
+class ThreadPlacementConfig {
+    // Placement of the broker threads on the CPUs of the host.  Each
+    // element is a set of CPUs, in the Linux 'cpulist' format (e.g.,
+    // '0-3,8'), the corresponding threads are restricted to; an empty
+    // value leaves the threads unpinned.  Memory being allocated on the
+    // NUMA node of the thread first touching it, the CPUs of a set should
+    // belong to a single NUMA node.  The effective placement, and the NUMA
+    // nodes it spans, is reported by the 'BROKERCONFIG DUMP' command.
+    //
+    // sessions..: dispatcher processors of the client sessions
+    // queues....: dispatcher processors of the queues
+    // clusters..: dispatcher processors of the clusters
+    // ioThreads.: IO threads of the network channel factories
+    // scheduler.: thread of the event scheduler
 
     // INSTANCE DATA
-    bsl::string d_name;
-    int         d_selfNodeId;
+    bsl::string d_sessions;
+    bsl::string d_queues;
+    bsl::string d_clusters;
+    bsl::string d_ioThreads;
+    bsl::string d_scheduler;
 
   public:
     // TYPES
-    enum { ATTRIBUTE_ID_NAME = 0, ATTRIBUTE_ID_SELF_NODE_ID = 1 };
+    enum {
+        ATTRIBUTE_ID_SESSIONS   = 0,
+        ATTRIBUTE_ID_QUEUES     = 1,
+        ATTRIBUTE_ID_CLUSTERS   = 2,
+        ATTRIBUTE_ID_IO_THREADS = 3,
+        ATTRIBUTE_ID_SCHEDULER  = 4
+    };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 5 };
 
-    enum { ATTRIBUTE_INDEX_NAME = 0, ATTRIBUTE_INDEX_SELF_NODE_ID = 1 };
+    enum {
+        ATTRIBUTE_INDEX_SESSIONS   = 0,
+        ATTRIBUTE_INDEX_QUEUES     = 1,
+        ATTRIBUTE_INDEX_CLUSTERS   = 2,
+        ATTRIBUTE_INDEX_IO_THREADS = 3,
+        ATTRIBUTE_INDEX_SCHEDULER  = 4
+    };
 
     // CONSTANTS
     static const char CLASS_NAME[];
@@ -4400,47 +4656,46 @@ class VirtualClusterInformation {
     // exists, and 0 otherwise.
 
     // CREATORS
-    explicit VirtualClusterInformation(bslma::Allocator* basicAllocator = 0);
-    // Create an object of type 'VirtualClusterInformation' having the
-    // default value.  Use the optionally specified 'basicAllocator' to
-    // supply memory.  If 'basicAllocator' is 0, the currently installed
-    // default allocator is used.
+    explicit ThreadPlacementConfig(bslma::Allocator* basicAllocator = 0);
+    // Create an object of type 'ThreadPlacementConfig' having the default
+    // value.  Use the optionally specified 'basicAllocator' to supply
+    // memory.  If 'basicAllocator' is 0, the currently installed default
+    // allocator is used.
 
-    VirtualClusterInformation(const VirtualClusterInformation& original,
-                              bslma::Allocator* basicAllocator = 0);
-    // Create an object of type 'VirtualClusterInformation' having the
-    // value of the specified 'original' object.  Use the optionally
-    // specified 'basicAllocator' to supply memory.  If 'basicAllocator' is
-    // 0, the currently installed default allocator is used.
+    ThreadPlacementConfig(const ThreadPlacementConfig& original,
+                          bslma::Allocator*            basicAllocator = 0);
+    // Create an object of type 'ThreadPlacementConfig' having the value of the
+    // specified 'original' object.  Use the optionally specified
+    // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+    // currently installed default allocator is used.
 
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
-    VirtualClusterInformation(VirtualClusterInformation&& original) noexcept;
-    // Create an object of type 'VirtualClusterInformation' having the
-    // value of the specified 'original' object.  After performing this
-    // action, the 'original' object will be left in a valid, but
-    // unspecified state.
+    ThreadPlacementConfig(ThreadPlacementConfig&& original) noexcept;
+    // Create an object of type 'ThreadPlacementConfig' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
 
-    VirtualClusterInformation(VirtualClusterInformation&& original,
-                              bslma::Allocator*           basicAllocator);
-    // Create an object of type 'VirtualClusterInformation' having the
-    // value of the specified 'original' object.  After performing this
-    // action, the 'original' object will be left in a valid, but
-    // unspecified state.  Use the optionally specified 'basicAllocator' to
-    // supply memory.  If 'basicAllocator' is 0, the currently installed
-    // default allocator is used.
+    ThreadPlacementConfig(ThreadPlacementConfig&& original,
+                          bslma::Allocator*       basicAllocator);
+    // Create an object of type 'ThreadPlacementConfig' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
+    // Use the optionally specified 'basicAllocator' to supply memory.  If
+    // 'basicAllocator' is 0, the currently installed default allocator is
+    // used.
 #endif
 
-    ~VirtualClusterInformation();
+    ~ThreadPlacementConfig();
     // Destroy this object.
 
     // MANIPULATORS
-    VirtualClusterInformation& operator=(const VirtualClusterInformation& rhs);
+    ThreadPlacementConfig& operator=(const ThreadPlacementConfig& rhs);
     // Assign to this object the value of the specified 'rhs' object.
 
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
-    VirtualClusterInformation& operator=(VirtualClusterInformation&& rhs);
+    ThreadPlacementConfig& operator=(ThreadPlacementConfig&& rhs);
     // Assign to this object the value of the specified 'rhs' object.
     // After performing this action, the 'rhs' object will be left in a
     // valid, but unspecified state.
@@ -4479,12 +4734,24 @@ class VirtualClusterInformation {
     // returned from the invocation of 'manipulator' if 'name' identifies
     // an attribute of this class, and -1 otherwise.
 
-    bsl::string& name();
-    // Return a reference to the modifiable "Name" attribute of this
+    bsl::string& sessions();
+    // Return a reference to the modifiable "Sessions" attribute of this
     // object.
 
-    int& selfNodeId();
-    // Return a reference to the modifiable "SelfNodeId" attribute of this
+    bsl::string& queues();
+    // Return a reference to the modifiable "Queues" attribute of this
+    // object.
+
+    bsl::string& clusters();
+    // Return a reference to the modifiable "Clusters" attribute of this
+    // object.
+
+    bsl::string& ioThreads();
+    // Return a reference to the modifiable "IoThreads" attribute of this
+    // object.
+
+    bsl::string& scheduler();
+    // Return a reference to the modifiable "Scheduler" attribute of this
     // object.
 
     // ACCESSORS
@@ -4530,56 +4797,281 @@ class VirtualClusterInformation {
     // invocation of 'accessor' if 'name' identifies an attribute of this
     // class, and -1 otherwise.
 
-    const bsl::string& name() const;
-    // Return a reference offering non-modifiable access to the "Name"
+    const bsl::string& sessions() const;
+    // Return a reference offering non-modifiable access to the "Sessions"
     // attribute of this object.
 
-    int selfNodeId() const;
-    // Return the value of the "SelfNodeId" attribute of this object.
+    const bsl::string& queues() const;
+    // Return a reference offering non-modifiable access to the "Queues"
+    // attribute of this object.
+
+    const bsl::string& clusters() const;
+    // Return a reference offering non-modifiable access to the "Clusters"
+    // attribute of this object.
+
+    const bsl::string& ioThreads() const;
+    // Return a reference offering non-modifiable access to the "IoThreads"
+    // attribute of this object.
+
+    const bsl::string& scheduler() const;
+    // Return a reference offering non-modifiable access to the "Scheduler"
+    // attribute of this object.
 };
 
 // FREE OPERATORS
-inline bool operator==(const VirtualClusterInformation& lhs,
-                       const VirtualClusterInformation& rhs);
+inline bool operator==(const ThreadPlacementConfig& lhs,
+                       const ThreadPlacementConfig& rhs);
 // Return 'true' if the specified 'lhs' and 'rhs' attribute objects have
 // the same value, and 'false' otherwise.  Two attribute objects have the
 // same value if each respective attribute has the same value.
 
-inline bool operator!=(const VirtualClusterInformation& lhs,
-                       const VirtualClusterInformation& rhs);
+inline bool operator!=(const ThreadPlacementConfig& lhs,
+                       const ThreadPlacementConfig& rhs);
 // Return 'true' if the specified 'lhs' and 'rhs' attribute objects do not
 // have the same value, and 'false' otherwise.  Two attribute objects do
 // not have the same value if one or more respective attributes differ in
 // values.
 
-inline bsl::ostream& operator<<(bsl::ostream&                    stream,
-                                const VirtualClusterInformation& rhs);
+inline bsl::ostream& operator<<(bsl::ostream&                stream,
+                                const ThreadPlacementConfig& rhs);
 // Format the specified 'rhs' to the specified output 'stream' and
 // return a reference to the modifiable 'stream'.
 
 template <typename t_HASH_ALGORITHM>
-void hashAppend(t_HASH_ALGORITHM&                hashAlg,
-                const VirtualClusterInformation& object);
+void hashAppend(t_HASH_ALGORITHM&            hashAlg,
+                const ThreadPlacementConfig& object);
 // Pass the specified 'object' to the specified 'hashAlg'.  This function
 // integrates with the 'bslh' modular hashing system and effectively
-// provides a 'bsl::hash' specialization for 'VirtualClusterInformation'.
+// provides a 'bsl::hash' specialization for 'ThreadPlacementConfig'.
 
 }  // close package namespace
 
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
-    mqbcfg::VirtualClusterInformation)
+    mqbcfg::ThreadPlacementConfig)
 
 namespace mqbcfg {
+// ===============================
+// class VirtualClusterInformation
+// ===============================
 
-// ===========================
-// class ClusterNodeConnection
-// ===========================
-
-class ClusterNodeConnection {
-    // Choice of all the various transport mode available to establish
-    // connectivity with a node.
+class VirtualClusterInformation {
+    // Type representing the information about the current node with regards to
+    // virtual cluster.
+    // name.............: name of the cluster selfNodeId.......: id of the
+    // current node in that virtual cluster
+
+    // INSTANCE DATA
+    bsl::string d_name;
+    int         d_selfNodeId;
+
+  public:
+    // TYPES
+    enum { ATTRIBUTE_ID_NAME = 0, ATTRIBUTE_ID_SELF_NODE_ID = 1 };
+
+    enum { NUM_ATTRIBUTES = 2 };
+
+    enum { ATTRIBUTE_INDEX_NAME = 0, ATTRIBUTE_INDEX_SELF_NODE_ID = 1 };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+    // Return attribute information for the attribute indicated by the
+    // specified 'id' if the attribute exists, and 0 otherwise.
+
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+    // Return attribute information for the attribute indicated by the
+    // specified 'name' of the specified 'nameLength' if the attribute
+    // exists, and 0 otherwise.
+
+    // CREATORS
+    explicit VirtualClusterInformation(bslma::Allocator* basicAllocator = 0);
+    // Create an object of type 'VirtualClusterInformation' having the
+    // default value.  Use the optionally specified 'basicAllocator' to
+    // supply memory.  If 'basicAllocator' is 0, the currently installed
+    // default allocator is used.
+
+    VirtualClusterInformation(const VirtualClusterInformation& original,
+                              bslma::Allocator* basicAllocator = 0);
+    // Create an object of type 'VirtualClusterInformation' having the
+    // value of the specified 'original' object.  Use the optionally
+    // specified 'basicAllocator' to supply memory.  If 'basicAllocator' is
+    // 0, the currently installed default allocator is used.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    VirtualClusterInformation(VirtualClusterInformation&& original) noexcept;
+    // Create an object of type 'VirtualClusterInformation' having the
+    // value of the specified 'original' object.  After performing this
+    // action, the 'original' object will be left in a valid, but
+    // unspecified state.
+
+    VirtualClusterInformation(VirtualClusterInformation&& original,
+                              bslma::Allocator*           basicAllocator);
+    // Create an object of type 'VirtualClusterInformation' having the
+    // value of the specified 'original' object.  After performing this
+    // action, the 'original' object will be left in a valid, but
+    // unspecified state.  Use the optionally specified 'basicAllocator' to
+    // supply memory.  If 'basicAllocator' is 0, the currently installed
+    // default allocator is used.
+#endif
+
+    ~VirtualClusterInformation();
+    // Destroy this object.
+
+    // MANIPULATORS
+    VirtualClusterInformation& operator=(const VirtualClusterInformation& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    VirtualClusterInformation& operator=(VirtualClusterInformation&& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+    // After performing this action, the 'rhs' object will be left in a
+    // valid, but unspecified state.
+#endif
+
+    void reset();
+    // Reset this object to the default value (i.e., its value upon
+    // default construction).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttributes(t_MANIPULATOR& manipulator);
+    // Invoke the specified 'manipulator' sequentially on the address of
+    // each (modifiable) attribute of this object, supplying 'manipulator'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'manipulator' (i.e., the invocation that
+    // terminated the sequence).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator, int id);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'id',
+    // supplying 'manipulator' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'manipulator' if 'id' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator,
+                            const char*    name,
+                            int            nameLength);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'name' of the
+    // specified 'nameLength', supplying 'manipulator' with the
+    // corresponding attribute information structure.  Return the value
+    // returned from the invocation of 'manipulator' if 'name' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    bsl::string& name();
+    // Return a reference to the modifiable "Name" attribute of this
+    // object.
+
+    int& selfNodeId();
+    // Return a reference to the modifiable "SelfNodeId" attribute of this
+    // object.
+
+    // ACCESSORS
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+    // Format this object to the specified output 'stream' at the
+    // optionally specified indentation 'level' and return a reference to
+    // the modifiable 'stream'.  If 'level' is specified, optionally
+    // specify 'spacesPerLevel', the number of spaces per indentation level
+    // for this and all of its nested objects.  Each line is indented by
+    // the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    // negative, suppress indentation of the first line.  If
+    // 'spacesPerLevel' is negative, suppress line breaks and format the
+    // entire output on one line.  If 'stream' is initially invalid, this
+    // operation has no effect.  Note that a trailing newline is provided
+    // in multiline mode only.
+
+    template <typename t_ACCESSOR>
+    int accessAttributes(t_ACCESSOR& accessor) const;
+    // Invoke the specified 'accessor' sequentially on each
+    // (non-modifiable) attribute of this object, supplying 'accessor'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'accessor' (i.e., the invocation that terminated
+    // the sequence).
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor, int id) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'id', supplying 'accessor'
+    // with the corresponding attribute information structure.  Return the
+    // value returned from the invocation of 'accessor' if 'id' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor,
+                        const char* name,
+                        int         nameLength) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'name' of the specified
+    // 'nameLength', supplying 'accessor' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'accessor' if 'name' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    const bsl::string& name() const;
+    // Return a reference offering non-modifiable access to the "Name"
+    // attribute of this object.
+
+    int selfNodeId() const;
+    // Return the value of the "SelfNodeId" attribute of this object.
+};
+
+// FREE OPERATORS
+inline bool operator==(const VirtualClusterInformation& lhs,
+                       const VirtualClusterInformation& rhs);
+// Return 'true' if the specified 'lhs' and 'rhs' attribute objects have
+// the same value, and 'false' otherwise.  Two attribute objects have the
+// same value if each respective attribute has the same value.
+
+inline bool operator!=(const VirtualClusterInformation& lhs,
+                       const VirtualClusterInformation& rhs);
+// Return 'true' if the specified 'lhs' and 'rhs' attribute objects do not
+// have the same value, and 'false' otherwise.  Two attribute objects do
+// not have the same value if one or more respective attributes differ in
+// values.
+
+inline bsl::ostream& operator<<(bsl::ostream&                    stream,
+                                const VirtualClusterInformation& rhs);
+// Format the specified 'rhs' to the specified output 'stream' and
+// return a reference to the modifiable 'stream'.
+
+template <typename t_HASH_ALGORITHM>
+void hashAppend(t_HASH_ALGORITHM&                hashAlg,
+                const VirtualClusterInformation& object);
+// Pass the specified 'object' to the specified 'hashAlg'.  This function
+// integrates with the 'bslh' modular hashing system and effectively
+// provides a 'bsl::hash' specialization for 'VirtualClusterInformation'.
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
+    mqbcfg::VirtualClusterInformation)
+
+namespace mqbcfg {
+
+// ===========================
+// class ClusterNodeConnection
+// ===========================
+
+class ClusterNodeConnection {
+    // Choice of all the various transport mode available to establish
+    // connectivity with a node.
     // tcp.: TCP connectivity
 
     // INSTANCE DATA
@@ -4784,24 +5276,34 @@ class DispatcherProcessorConfig {
     // INSTANCE DATA
     DispatcherProcessorParameters d_processorConfig;
     int                           d_numProcessors;
+    int                           d_rebalanceIntervalMs;
+    int                           d_rebalanceThresholdPercent;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_ID_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_ID_NUM_PROCESSORS              = 0,
+        ATTRIBUTE_ID_PROCESSOR_CONFIG            = 1,
+        ATTRIBUTE_ID_REBALANCE_INTERVAL_MS       = 2,
+        ATTRIBUTE_ID_REBALANCE_THRESHOLD_PERCENT = 3
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_INDEX_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_INDEX_NUM_PROCESSORS              = 0,
+        ATTRIBUTE_INDEX_PROCESSOR_CONFIG            = 1,
+        ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS       = 2,
+        ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT = 3
     };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS;
+
+    static const int DEFAULT_INITIALIZER_REBALANCE_THRESHOLD_PERCENT;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4890,6 +5392,14 @@ class DispatcherProcessorConfig {
     // Return a reference to the modifiable "ProcessorConfig" attribute of
     // this object.
 
+    int& rebalanceIntervalMs();
+    // Return a reference to the modifiable "RebalanceIntervalMs" attribute
+    // of this object.
+
+    int& rebalanceThresholdPercent();
+    // Return a reference to the modifiable "RebalanceThresholdPercent"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -4939,6 +5449,14 @@ class DispatcherProcessorConfig {
     const DispatcherProcessorParameters& processorConfig() const;
     // Return a reference offering non-modifiable access to the
     // "ProcessorConfig" attribute of this object.
+
+    int rebalanceIntervalMs() const;
+    // Return the value of the "RebalanceIntervalMs" attribute of this
+    // object.
+
+    int rebalanceThresholdPercent() const;
+    // Return the value of the "RebalanceThresholdPercent" attribute of this
+    // object.
 };
 
 // FREE OPERATORS
@@ -5500,51 +6018,103 @@ class PartitionConfig {
     // whether to populate (prefault) page tables for a mapping.
     // flushAtShutdown......: flag to indicate whether broker should flush
     // storage files to disk at shutdown syncConfig...........: configuration
-    // for storage synchronization and recovery
+    // for storage synchronization and recovery writeBackend.........:
+    // mechanism used to write back dirty pages of the partition files to
+    // disk syncBeforeReceipt....: flag to indicate whether a message is
+    // receipted only after its record has been durably synced to disk
+    // (requires 'E_ASYNC_WRITEBACK' write backend) groupCommitMaxDelayMs:
+    // maximum time, in milliseconds, a durable sync is delayed in order to
+    // batch more records into it (0 means no delay) groupCommitMaxBytes..:
+    // number of unsynced bytes which triggers a durable sync without waiting
+    // for 'groupCommitMaxDelayMs' indexSnapshotIntervalMs: minimum interval,
+    // in milliseconds, between two snapshots of the in-memory index of a
+    // partition, used to only replay the tail of the journal at startup (0
+    // means no snapshot) coldTierLocation.....: location of the cold tier
+    // files, to which the payloads of old messages are offloaded from the
+    // data file at rollover (empty means no cold tier; a cold tier is only
+    // supported by a cluster having one node)
+    // coldTierMinAgeSeconds: minimum age, in seconds, of a message for its
+    // payload to be offloaded to the cold tier at rollover (0 means that
+    // payloads are offloaded only when the data file would otherwise be too
+    // full to roll over) replicationBatchSize.: number of records batched
+    // into one storage event replicated to the replicas (0 means that the
+    // batch size adapts to the load of the cluster channels, 1 favors latency
+    // and larger values favor throughput) replicationBatchingThreshold: number
+    // of records replicated since the oldest message still waiting for its
+    // Receipts beyond which records are batched, up to the largest batch,
+    // until Receipts arrive (this is not a bound on the records in flight, as
+    // full batches and SyncPts are still replicated; 0 means no threshold)
 
     // INSTANCE DATA
-    bsls::Types::Uint64 d_maxDataFileSize;
-    bsls::Types::Uint64 d_maxJournalFileSize;
-    bsls::Types::Uint64 d_maxQlistFileSize;
-    bsl::string         d_location;
-    bsl::string         d_archiveLocation;
-    StorageSyncConfig   d_syncConfig;
-    int                 d_numPartitions;
-    int                 d_maxArchivedFileSets;
-    bool                d_preallocate;
-    bool                d_prefaultPages;
-    bool                d_flushAtShutdown;
+    bsls::Types::Uint64        d_maxDataFileSize;
+    bsls::Types::Uint64        d_maxJournalFileSize;
+    bsls::Types::Uint64        d_maxQlistFileSize;
+    bsls::Types::Uint64        d_groupCommitMaxBytes;
+    bsl::string                d_location;
+    bsl::string                d_archiveLocation;
+    bsl::string                d_coldTierLocation;
+    StorageSyncConfig          d_syncConfig;
+    int                        d_numPartitions;
+    int                        d_maxArchivedFileSets;
+    StorageWriteBackend::Value d_writeBackend;
+    int                        d_groupCommitMaxDelayMs;
+    int                        d_indexSnapshotIntervalMs;
+    int                        d_coldTierMinAgeSeconds;
+    int                        d_replicationBatchSize;
+    int                        d_replicationBatchingThreshold;
+    bool                       d_preallocate;
+    bool                       d_prefaultPages;
+    bool                       d_flushAtShutdown;
+    bool                       d_syncBeforeReceipt;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_ID_LOCATION               = 1,
-        ATTRIBUTE_ID_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_ID_PREALLOCATE            = 6,
-        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 7,
-        ATTRIBUTE_ID_PREFAULT_PAGES         = 8,
-        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 9,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 10
+        ATTRIBUTE_ID_NUM_PARTITIONS                 = 0,
+        ATTRIBUTE_ID_LOCATION                       = 1,
+        ATTRIBUTE_ID_ARCHIVE_LOCATION               = 2,
+        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE             = 3,
+        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE          = 4,
+        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE            = 5,
+        ATTRIBUTE_ID_PREALLOCATE                    = 6,
+        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS         = 7,
+        ATTRIBUTE_ID_PREFAULT_PAGES                 = 8,
+        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN              = 9,
+        ATTRIBUTE_ID_SYNC_CONFIG                    = 10,
+        ATTRIBUTE_ID_WRITE_BACKEND                  = 11,
+        ATTRIBUTE_ID_SYNC_BEFORE_RECEIPT            = 12,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_MS      = 13,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES         = 14,
+        ATTRIBUTE_ID_INDEX_SNAPSHOT_INTERVAL_MS     = 15,
+        ATTRIBUTE_ID_COLD_TIER_LOCATION             = 16,
+        ATTRIBUTE_ID_COLD_TIER_MIN_AGE_SECONDS      = 17,
+        ATTRIBUTE_ID_REPLICATION_BATCH_SIZE         = 18,
+        ATTRIBUTE_ID_REPLICATION_BATCHING_THRESHOLD = 19
     };
 
-    enum { NUM_ATTRIBUTES = 11 };
+    enum { NUM_ATTRIBUTES = 20 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_INDEX_LOCATION               = 1,
-        ATTRIBUTE_INDEX_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_INDEX_PREALLOCATE            = 6,
-        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 7,
-        ATTRIBUTE_INDEX_PREFAULT_PAGES         = 8,
-        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 9,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 10
+        ATTRIBUTE_INDEX_NUM_PARTITIONS                 = 0,
+        ATTRIBUTE_INDEX_LOCATION                       = 1,
+        ATTRIBUTE_INDEX_ARCHIVE_LOCATION               = 2,
+        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE             = 3,
+        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE          = 4,
+        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE            = 5,
+        ATTRIBUTE_INDEX_PREALLOCATE                    = 6,
+        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS         = 7,
+        ATTRIBUTE_INDEX_PREFAULT_PAGES                 = 8,
+        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN              = 9,
+        ATTRIBUTE_INDEX_SYNC_CONFIG                    = 10,
+        ATTRIBUTE_INDEX_WRITE_BACKEND                  = 11,
+        ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT            = 12,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS      = 13,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES         = 14,
+        ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS     = 15,
+        ATTRIBUTE_INDEX_COLD_TIER_LOCATION             = 16,
+        ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS      = 17,
+        ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE         = 18,
+        ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD = 19
     };
 
     // CONSTANTS
@@ -5556,6 +6126,25 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const StorageWriteBackend::Value DEFAULT_INITIALIZER_WRITE_BACKEND;
+
+    static const bool DEFAULT_INITIALIZER_SYNC_BEFORE_RECEIPT;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_MS;
+
+    static const bsls::Types::Uint64
+        DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+
+    static const int DEFAULT_INITIALIZER_INDEX_SNAPSHOT_INTERVAL_MS;
+
+    static const char DEFAULT_INITIALIZER_COLD_TIER_LOCATION[];
+
+    static const int DEFAULT_INITIALIZER_COLD_TIER_MIN_AGE_SECONDS;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_BATCH_SIZE;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_BATCHING_THRESHOLD;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5693,6 +6282,42 @@ class PartitionConfig {
     // Return a reference to the modifiable "SyncConfig" attribute of this
     // object.
 
+    StorageWriteBackend::Value& writeBackend();
+    // Return a reference to the modifiable "WriteBackend" attribute of
+    // this object.
+
+    bool& syncBeforeReceipt();
+    // Return a reference to the modifiable "SyncBeforeReceipt" attribute
+    // of this object.
+
+    int& groupCommitMaxDelayMs();
+    // Return a reference to the modifiable "GroupCommitMaxDelayMs"
+    // attribute of this object.
+
+    bsls::Types::Uint64& groupCommitMaxBytes();
+    // Return a reference to the modifiable "GroupCommitMaxBytes" attribute
+    // of this object.
+
+    int& indexSnapshotIntervalMs();
+    // Return a reference to the modifiable "IndexSnapshotIntervalMs"
+    // attribute of this object.
+
+    bsl::string& coldTierLocation();
+    // Return a reference to the modifiable "ColdTierLocation" attribute of
+    // this object.
+
+    int& coldTierMinAgeSeconds();
+    // Return a reference to the modifiable "ColdTierMinAgeSeconds"
+    // attribute of this object.
+
+    int& replicationBatchSize();
+    // Return a reference to the modifiable "ReplicationBatchSize" attribute
+    // of this object.
+
+    int& replicationBatchingThreshold();
+    // Return a reference to the modifiable "ReplicationBatchingThreshold"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -5773,7 +6398,42 @@ class PartitionConfig {
     const StorageSyncConfig& syncConfig() const;
     // Return a reference offering non-modifiable access to the
     // "SyncConfig" attribute of this object.
-};
+
+    StorageWriteBackend::Value writeBackend() const;
+    // Return the value of the "WriteBackend" attribute of this object.
+
+    bool syncBeforeReceipt() const;
+    // Return the value of the "SyncBeforeReceipt" attribute of this
+    // object.
+
+    int groupCommitMaxDelayMs() const;
+    // Return the value of the "GroupCommitMaxDelayMs" attribute of this
+    // object.
+
+    bsls::Types::Uint64 groupCommitMaxBytes() const;
+    // Return the value of the "GroupCommitMaxBytes" attribute of this
+    // object.
+
+    int indexSnapshotIntervalMs() const;
+    // Return the value of the "IndexSnapshotIntervalMs" attribute of this
+    // object.
+
+    const bsl::string& coldTierLocation() const;
+    // Return a reference offering non-modifiable access to the
+    // "ColdTierLocation" attribute of this object.
+
+    int coldTierMinAgeSeconds() const;
+    // Return the value of the "ColdTierMinAgeSeconds" attribute of this
+    // object.
+
+    int replicationBatchSize() const;
+    // Return the value of the "ReplicationBatchSize" attribute of this
+    // object.
+
+    int replicationBatchingThreshold() const;
+    // Return the value of the "ReplicationBatchingThreshold" attribute of this
+    // object.
+};
 
 // FREE OPERATORS
 inline bool operator==(const PartitionConfig& lhs, const PartitionConfig& rhs);
@@ -8010,26 +8670,28 @@ class AppConfig {
     // configuration for the plugins msgPropertiesSupport.: information about
     // if/how to advertise support for v2 message properties
     // configureStream......: send new ConfigureStream instead of old
-    // ConfigureQueue/>
+    // ConfigureQueue threadPlacement......: placement of the broker threads
+    // on the CPUs of the host/>
 
     // INSTANCE DATA
-    bsl::string         d_brokerInstanceName;
-    bsl::string         d_etcDir;
-    bsl::string         d_hostName;
-    bsl::string         d_hostTags;
-    bsl::string         d_hostDataCenter;
-    bsl::string         d_latencyMonitorDomain;
-    StatsConfig         d_stats;
-    Plugins             d_plugins;
-    NetworkInterfaces   d_networkInterfaces;
-    MessagePropertiesV2 d_messagePropertiesV2;
-    DispatcherConfig    d_dispatcherConfig;
-    BmqconfConfig       d_bmqconfConfig;
-    int                 d_brokerVersion;
-    int                 d_configVersion;
-    int                 d_logsObserverMaxSize;
-    bool                d_isRunningOnDev;
-    bool                d_configureStream;
+    bsl::string           d_brokerInstanceName;
+    bsl::string           d_etcDir;
+    bsl::string           d_hostName;
+    bsl::string           d_hostTags;
+    bsl::string           d_hostDataCenter;
+    bsl::string           d_latencyMonitorDomain;
+    StatsConfig           d_stats;
+    Plugins               d_plugins;
+    NetworkInterfaces     d_networkInterfaces;
+    MessagePropertiesV2   d_messagePropertiesV2;
+    ThreadPlacementConfig d_threadPlacement;
+    DispatcherConfig      d_dispatcherConfig;
+    BmqconfConfig         d_bmqconfConfig;
+    int                   d_brokerVersion;
+    int                   d_configVersion;
+    int                   d_logsObserverMaxSize;
+    bool                  d_isRunningOnDev;
+    bool                  d_configureStream;
 
   public:
     // TYPES
@@ -8050,10 +8712,11 @@ class AppConfig {
         ATTRIBUTE_ID_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_ID_PLUGINS                = 14,
         ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2  = 15,
-        ATTRIBUTE_ID_CONFIGURE_STREAM       = 16
+        ATTRIBUTE_ID_CONFIGURE_STREAM       = 16,
+        ATTRIBUTE_ID_THREAD_PLACEMENT       = 17
     };
 
-    enum { NUM_ATTRIBUTES = 17 };
+    enum { NUM_ATTRIBUTES = 18 };
 
     enum {
         ATTRIBUTE_INDEX_BROKER_INSTANCE_NAME   = 0,
@@ -8072,7 +8735,8 @@ class AppConfig {
         ATTRIBUTE_INDEX_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_INDEX_PLUGINS                = 14,
         ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2  = 15,
-        ATTRIBUTE_INDEX_CONFIGURE_STREAM       = 16
+        ATTRIBUTE_INDEX_CONFIGURE_STREAM       = 16,
+        ATTRIBUTE_INDEX_THREAD_PLACEMENT       = 17
     };
 
     // CONSTANTS
@@ -8241,6 +8905,10 @@ class AppConfig {
     // Return a reference to the modifiable "ConfigureStream" attribute of
     // this object.
 
+    ThreadPlacementConfig& threadPlacement();
+    // Return a reference to the modifiable "ThreadPlacement" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -8347,6 +9015,10 @@ class AppConfig {
 
     bool configureStream() const;
     // Return the value of the "ConfigureStream" attribute of this object.
+
+    const ThreadPlacementConfig& threadPlacement() const;
+    // Return a reference offering non-modifiable access to the
+    // "ThreadPlacement" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -8972,6 +9644,25 @@ inline int BmqconfConfig::cacheTTLSeconds() const
     return d_cacheTTLSeconds;
 }
 
+// -----------------------
+// class ClientFlushPolicy
+// -----------------------
+
+// CLASS METHODS
+inline int ClientFlushPolicy::fromString(Value*             result,
+                                         const bsl::string& string)
+{
+    return fromString(result,
+                      string.c_str(),
+                      static_cast<int>(string.length()));
+}
+
+inline bsl::ostream& ClientFlushPolicy::print(bsl::ostream&            stream,
+                                              ClientFlushPolicy::Value value)
+{
+    return stream << toString(value);
+}
+
 // -----------------------
 // class ClusterAttributes
 // -----------------------
@@ -9474,6 +10165,13 @@ int DispatcherProcessorParameters::manipulateAttributes(
         return ret;
     }
 
+    ret = manipulator(
+        &d_useLockFreeQueue,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -9499,6 +10197,11 @@ int DispatcherProcessorParameters::manipulateAttribute(
             &d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_USE_LOCK_FREE_QUEUE: {
+        return manipulator(
+            &d_useLockFreeQueue,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -9535,6 +10238,11 @@ inline int& DispatcherProcessorParameters::queueSizeHighWatermark()
     return d_queueSizeHighWatermark;
 }
 
+inline bool& DispatcherProcessorParameters::useLockFreeQueue()
+{
+    return d_useLockFreeQueue;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -9561,6 +10269,12 @@ int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_useLockFreeQueue,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -9585,6 +10299,11 @@ int DispatcherProcessorParameters::accessAttribute(t_ACCESSOR& accessor,
             d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_USE_LOCK_FREE_QUEUE: {
+        return accessor(
+            d_useLockFreeQueue,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_LOCK_FREE_QUEUE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -9620,6 +10339,11 @@ inline int DispatcherProcessorParameters::queueSizeHighWatermark() const
     return d_queueSizeHighWatermark;
 }
 
+inline bool DispatcherProcessorParameters::useLockFreeQueue() const
+{
+    return d_useLockFreeQueue;
+}
+
 // -------------------
 // class ElectorConfig
 // -------------------
@@ -11950,6 +12674,26 @@ inline int StorageSyncConfig::partitionSyncEventSize() const
     return d_partitionSyncEventSize;
 }
 
+// -------------------------
+// class StorageWriteBackend
+// -------------------------
+
+// CLASS METHODS
+inline int StorageWriteBackend::fromString(Value*             result,
+                                           const bsl::string& string)
+{
+    return fromString(result,
+                      string.c_str(),
+                      static_cast<int>(string.length()));
+}
+
+inline bsl::ostream&
+StorageWriteBackend::print(bsl::ostream&              stream,
+                           StorageWriteBackend::Value value)
+{
+    return stream << toString(value);
+}
+
 // ------------------
 // class SyslogConfig
 // ------------------
@@ -12321,6 +13065,39 @@ int TcpInterfaceConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_zeroCopyThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_flushPolicy,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_POLICY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_flushMaxBytes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_flushMaxDelayUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_flushRateThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12376,6 +13153,30 @@ int TcpInterfaceConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_useNtf,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF]);
     }
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return manipulator(
+            &d_zeroCopyThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_FLUSH_POLICY: {
+        return manipulator(&d_flushPolicy,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_POLICY]);
+    }
+    case ATTRIBUTE_ID_FLUSH_MAX_BYTES: {
+        return manipulator(
+            &d_flushMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_FLUSH_MAX_DELAY_US: {
+        return manipulator(
+            &d_flushMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US]);
+    }
+    case ATTRIBUTE_ID_FLUSH_RATE_THRESHOLD: {
+        return manipulator(
+            &d_flushRateThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12446,6 +13247,31 @@ inline bool& TcpInterfaceConfig::useNtf()
     return d_useNtf;
 }
 
+inline bsls::Types::Int64& TcpInterfaceConfig::zeroCopyThreshold()
+{
+    return d_zeroCopyThreshold;
+}
+
+inline ClientFlushPolicy::Value& TcpInterfaceConfig::flushPolicy()
+{
+    return d_flushPolicy;
+}
+
+inline int& TcpInterfaceConfig::flushMaxBytes()
+{
+    return d_flushMaxBytes;
+}
+
+inline int& TcpInterfaceConfig::flushMaxDelayUs()
+{
+    return d_flushMaxDelayUs;
+}
+
+inline int& TcpInterfaceConfig::flushRateThreshold()
+{
+    return d_flushRateThreshold;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -12510,6 +13336,36 @@ int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_zeroCopyThreshold,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_flushPolicy,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_POLICY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_flushMaxBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_flushMaxDelayUs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_flushRateThreshold,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12560,6 +13416,29 @@ int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_useNtf,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_USE_NTF]);
     }
+    case ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return accessor(
+            d_zeroCopyThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_FLUSH_POLICY: {
+        return accessor(d_flushPolicy,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_POLICY]);
+    }
+    case ATTRIBUTE_ID_FLUSH_MAX_BYTES: {
+        return accessor(d_flushMaxBytes,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_FLUSH_MAX_DELAY_US: {
+        return accessor(
+            d_flushMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_MAX_DELAY_US]);
+    }
+    case ATTRIBUTE_ID_FLUSH_RATE_THRESHOLD: {
+        return accessor(
+            d_flushRateThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_RATE_THRESHOLD]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12630,6 +13509,253 @@ inline bool TcpInterfaceConfig::useNtf() const
     return d_useNtf;
 }
 
+inline bsls::Types::Int64 TcpInterfaceConfig::zeroCopyThreshold() const
+{
+    return d_zeroCopyThreshold;
+}
+
+inline ClientFlushPolicy::Value TcpInterfaceConfig::flushPolicy() const
+{
+    return d_flushPolicy;
+}
+
+inline int TcpInterfaceConfig::flushMaxBytes() const
+{
+    return d_flushMaxBytes;
+}
+
+inline int TcpInterfaceConfig::flushMaxDelayUs() const
+{
+    return d_flushMaxDelayUs;
+}
+
+inline int TcpInterfaceConfig::flushRateThreshold() const
+{
+    return d_flushRateThreshold;
+}
+
+// ---------------------------
+// class ThreadPlacementConfig
+// ---------------------------
+
+// CLASS METHODS
+// MANIPULATORS
+template <typename t_MANIPULATOR>
+int ThreadPlacementConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_sessions,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SESSIONS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_queues,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_clusters,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_ioThreads,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_scheduler,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCHEDULER]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_MANIPULATOR>
+int ThreadPlacementConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                              int            id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_SESSIONS: {
+        return manipulator(&d_sessions,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SESSIONS]);
+    }
+    case ATTRIBUTE_ID_QUEUES: {
+        return manipulator(&d_queues,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    }
+    case ATTRIBUTE_ID_CLUSTERS: {
+        return manipulator(&d_clusters,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTERS]);
+    }
+    case ATTRIBUTE_ID_IO_THREADS: {
+        return manipulator(&d_ioThreads,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_THREADS]);
+    }
+    case ATTRIBUTE_ID_SCHEDULER: {
+        return manipulator(&d_scheduler,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCHEDULER]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_MANIPULATOR>
+int ThreadPlacementConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                              const char*    name,
+                                              int            nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bsl::string& ThreadPlacementConfig::sessions()
+{
+    return d_sessions;
+}
+
+inline bsl::string& ThreadPlacementConfig::queues()
+{
+    return d_queues;
+}
+
+inline bsl::string& ThreadPlacementConfig::clusters()
+{
+    return d_clusters;
+}
+
+inline bsl::string& ThreadPlacementConfig::ioThreads()
+{
+    return d_ioThreads;
+}
+
+inline bsl::string& ThreadPlacementConfig::scheduler()
+{
+    return d_scheduler;
+}
+
+// ACCESSORS
+template <typename t_ACCESSOR>
+int ThreadPlacementConfig::accessAttributes(t_ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_sessions, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SESSIONS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_queues, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_clusters, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_ioThreads,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_scheduler,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCHEDULER]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_ACCESSOR>
+int ThreadPlacementConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_SESSIONS: {
+        return accessor(d_sessions,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SESSIONS]);
+    }
+    case ATTRIBUTE_ID_QUEUES: {
+        return accessor(d_queues,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    }
+    case ATTRIBUTE_ID_CLUSTERS: {
+        return accessor(d_clusters,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTERS]);
+    }
+    case ATTRIBUTE_ID_IO_THREADS: {
+        return accessor(d_ioThreads,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_IO_THREADS]);
+    }
+    case ATTRIBUTE_ID_SCHEDULER: {
+        return accessor(d_scheduler,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCHEDULER]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_ACCESSOR>
+int ThreadPlacementConfig::accessAttribute(t_ACCESSOR& accessor,
+                                          const char* name,
+                                          int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline const bsl::string& ThreadPlacementConfig::sessions() const
+{
+    return d_sessions;
+}
+
+inline const bsl::string& ThreadPlacementConfig::queues() const
+{
+    return d_queues;
+}
+
+inline const bsl::string& ThreadPlacementConfig::clusters() const
+{
+    return d_clusters;
+}
+
+inline const bsl::string& ThreadPlacementConfig::ioThreads() const
+{
+    return d_ioThreads;
+}
+
+inline const bsl::string& ThreadPlacementConfig::scheduler() const
+{
+    return d_scheduler;
+}
 // -------------------------------
 // class VirtualClusterInformation
 // -------------------------------
@@ -12859,6 +13985,20 @@ int DispatcherProcessorConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_rebalanceIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_rebalanceThresholdPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12879,6 +14019,16 @@ int DispatcherProcessorConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS: {
+        return manipulator(
+            &d_rebalanceIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_REBALANCE_THRESHOLD_PERCENT: {
+        return manipulator(
+            &d_rebalanceThresholdPercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12910,6 +14060,16 @@ DispatcherProcessorConfig::processorConfig()
     return d_processorConfig;
 }
 
+inline int& DispatcherProcessorConfig::rebalanceIntervalMs()
+{
+    return d_rebalanceIntervalMs;
+}
+
+inline int& DispatcherProcessorConfig::rebalanceThresholdPercent()
+{
+    return d_rebalanceThresholdPercent;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -12928,6 +14088,20 @@ int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_rebalanceIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_rebalanceThresholdPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12947,6 +14121,16 @@ int DispatcherProcessorConfig::accessAttribute(t_ACCESSOR& accessor,
             d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS: {
+        return accessor(
+            d_rebalanceIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_REBALANCE_THRESHOLD_PERCENT: {
+        return accessor(
+            d_rebalanceThresholdPercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_THRESHOLD_PERCENT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12978,6 +14162,16 @@ DispatcherProcessorConfig::processorConfig() const
     return d_processorConfig;
 }
 
+inline int DispatcherProcessorConfig::rebalanceIntervalMs() const
+{
+    return d_rebalanceIntervalMs;
+}
+
+inline int DispatcherProcessorConfig::rebalanceThresholdPercent() const
+{
+    return d_rebalanceThresholdPercent;
+}
+
 // -------------------
 // class LogController
 // -------------------
@@ -13585,6 +14779,68 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_writeBackend,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITE_BACKEND]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_syncBeforeReceipt,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitMaxDelayMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_indexSnapshotIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_coldTierLocation,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_coldTierMinAgeSeconds,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationBatchSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationBatchingThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13646,6 +14902,52 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_WRITE_BACKEND: {
+        return manipulator(
+            &d_writeBackend,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITE_BACKEND]);
+    }
+    case ATTRIBUTE_ID_SYNC_BEFORE_RECEIPT: {
+        return manipulator(
+            &d_syncBeforeReceipt,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_MS: {
+        return manipulator(
+            &d_groupCommitMaxDelayMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return manipulator(
+            &d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_INDEX_SNAPSHOT_INTERVAL_MS: {
+        return manipulator(
+            &d_indexSnapshotIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_COLD_TIER_LOCATION: {
+        return manipulator(
+            &d_coldTierLocation,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_LOCATION]);
+    }
+    case ATTRIBUTE_ID_COLD_TIER_MIN_AGE_SECONDS: {
+        return manipulator(
+            &d_coldTierMinAgeSeconds,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_SIZE: {
+        return manipulator(
+            &d_replicationBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCHING_THRESHOLD: {
+        return manipulator(
+            &d_replicationBatchingThreshold,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13721,6 +15023,51 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline StorageWriteBackend::Value& PartitionConfig::writeBackend()
+{
+    return d_writeBackend;
+}
+
+inline bool& PartitionConfig::syncBeforeReceipt()
+{
+    return d_syncBeforeReceipt;
+}
+
+inline int& PartitionConfig::groupCommitMaxDelayMs()
+{
+    return d_groupCommitMaxDelayMs;
+}
+
+inline bsls::Types::Uint64& PartitionConfig::groupCommitMaxBytes()
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int& PartitionConfig::indexSnapshotIntervalMs()
+{
+    return d_indexSnapshotIntervalMs;
+}
+
+inline bsl::string& PartitionConfig::coldTierLocation()
+{
+    return d_coldTierLocation;
+}
+
+inline int& PartitionConfig::coldTierMinAgeSeconds()
+{
+    return d_coldTierMinAgeSeconds;
+}
+
+inline int& PartitionConfig::replicationBatchSize()
+{
+    return d_replicationBatchSize;
+}
+
+inline int& PartitionConfig::replicationBatchingThreshold()
+{
+    return d_replicationBatchingThreshold;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -13794,6 +15141,66 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_writeBackend,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITE_BACKEND]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_syncBeforeReceipt,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxDelayMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_indexSnapshotIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_coldTierLocation,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_LOCATION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_coldTierMinAgeSeconds,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_replicationBatchSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_replicationBatchingThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13853,6 +15260,51 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_WRITE_BACKEND: {
+        return accessor(d_writeBackend,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITE_BACKEND]);
+    }
+    case ATTRIBUTE_ID_SYNC_BEFORE_RECEIPT: {
+        return accessor(
+            d_syncBeforeReceipt,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_RECEIPT]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_MS: {
+        return accessor(
+            d_groupCommitMaxDelayMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_MS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return accessor(
+            d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_INDEX_SNAPSHOT_INTERVAL_MS: {
+        return accessor(
+            d_indexSnapshotIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_INDEX_SNAPSHOT_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_COLD_TIER_LOCATION: {
+        return accessor(
+            d_coldTierLocation,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_LOCATION]);
+    }
+    case ATTRIBUTE_ID_COLD_TIER_MIN_AGE_SECONDS: {
+        return accessor(
+            d_coldTierMinAgeSeconds,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COLD_TIER_MIN_AGE_SECONDS]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCH_SIZE: {
+        return accessor(
+            d_replicationBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_BATCHING_THRESHOLD: {
+        return accessor(
+            d_replicationBatchingThreshold,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_BATCHING_THRESHOLD]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13928,6 +15380,51 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline StorageWriteBackend::Value PartitionConfig::writeBackend() const
+{
+    return d_writeBackend;
+}
+
+inline bool PartitionConfig::syncBeforeReceipt() const
+{
+    return d_syncBeforeReceipt;
+}
+
+inline int PartitionConfig::groupCommitMaxDelayMs() const
+{
+    return d_groupCommitMaxDelayMs;
+}
+
+inline bsls::Types::Uint64 PartitionConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int PartitionConfig::indexSnapshotIntervalMs() const
+{
+    return d_indexSnapshotIntervalMs;
+}
+
+inline const bsl::string& PartitionConfig::coldTierLocation() const
+{
+    return d_coldTierLocation;
+}
+
+inline int PartitionConfig::coldTierMinAgeSeconds() const
+{
+    return d_coldTierMinAgeSeconds;
+}
+
+inline int PartitionConfig::replicationBatchSize() const
+{
+    return d_replicationBatchSize;
+}
+
+inline int PartitionConfig::replicationBatchingThreshold() const
+{
+    return d_replicationBatchingThreshold;
+}
+
 // --------------------------------
 // class StatPluginConfigPrometheus
 // --------------------------------
@@ -15968,6 +17465,12 @@ int AppConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_threadPlacement,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THREAD_PLACEMENT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16057,6 +17560,11 @@ int AppConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_configureStream,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM]);
     }
+    case ATTRIBUTE_ID_THREAD_PLACEMENT: {
+        return manipulator(
+            &d_threadPlacement,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THREAD_PLACEMENT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16162,6 +17670,11 @@ inline bool& AppConfig::configureStream()
     return d_configureStream;
 }
 
+inline ThreadPlacementConfig& AppConfig::threadPlacement()
+{
+    return d_threadPlacement;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -16270,6 +17783,12 @@ int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_threadPlacement,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THREAD_PLACEMENT]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16355,6 +17874,11 @@ int AppConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_configureStream,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM]);
     }
+    case ATTRIBUTE_ID_THREAD_PLACEMENT: {
+        return accessor(
+            d_threadPlacement,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_THREAD_PLACEMENT]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16460,6 +17984,11 @@ inline bool AppConfig::configureStream() const
     return d_configureStream;
 }
 
+inline const ThreadPlacementConfig& AppConfig::threadPlacement() const
+{
+    return d_threadPlacement;
+}
+
 // ------------------------
 // class ClustersDefinition
 // ------------------------
@@ -16874,6 +18403,13 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&            hashAlg,
     hashAppend(hashAlg, object.cacheTTLSeconds());
 }
 
+inline bsl::ostream&
+mqbcfg::operator<<(bsl::ostream&                    stream,
+                   mqbcfg::ClientFlushPolicy::Value rhs)
+{
+    return mqbcfg::ClientFlushPolicy::print(stream, rhs);
+}
+
 inline bool mqbcfg::operator==(const mqbcfg::ClusterAttributes& lhs,
                                const mqbcfg::ClusterAttributes& rhs)
 {
@@ -16949,7 +18485,8 @@ mqbcfg::operator==(const mqbcfg::DispatcherProcessorParameters& lhs,
 {
     return lhs.queueSize() == rhs.queueSize() &&
            lhs.queueSizeLowWatermark() == rhs.queueSizeLowWatermark() &&
-           lhs.queueSizeHighWatermark() == rhs.queueSizeHighWatermark();
+           lhs.queueSizeHighWatermark() == rhs.queueSizeHighWatermark() &&
+           lhs.useLockFreeQueue() == rhs.useLockFreeQueue();
 }
 
 inline bool
@@ -16974,6 +18511,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                            hashAlg,
     hashAppend(hashAlg, object.queueSize());
     hashAppend(hashAlg, object.queueSizeLowWatermark());
     hashAppend(hashAlg, object.queueSizeHighWatermark());
+    hashAppend(hashAlg, object.useLockFreeQueue());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::ElectorConfig& lhs,
@@ -17311,6 +18849,13 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                hashAlg,
     hashAppend(hashAlg, object.partitionSyncEventSize());
 }
 
+inline bsl::ostream&
+mqbcfg::operator<<(bsl::ostream&                      stream,
+                   mqbcfg::StorageWriteBackend::Value rhs)
+{
+    return mqbcfg::StorageWriteBackend::print(stream, rhs);
+}
+
 inline bool mqbcfg::operator==(const mqbcfg::SyslogConfig& lhs,
                                const mqbcfg::SyslogConfig& rhs)
 {
@@ -17380,7 +18925,12 @@ inline bool mqbcfg::operator==(const mqbcfg::TcpInterfaceConfig& lhs,
            lhs.nodeLowWatermark() == rhs.nodeLowWatermark() &&
            lhs.nodeHighWatermark() == rhs.nodeHighWatermark() &&
            lhs.heartbeatIntervalMs() == rhs.heartbeatIntervalMs() &&
-           lhs.useNtf() == rhs.useNtf();
+           lhs.useNtf() == rhs.useNtf() &&
+           lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.flushPolicy() == rhs.flushPolicy() &&
+           lhs.flushMaxBytes() == rhs.flushMaxBytes() &&
+           lhs.flushMaxDelayUs() == rhs.flushMaxDelayUs() &&
+           lhs.flushRateThreshold() == rhs.flushRateThreshold();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::TcpInterfaceConfig& lhs,
@@ -17410,8 +18960,47 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                 hashAlg,
     hashAppend(hashAlg, object.nodeHighWatermark());
     hashAppend(hashAlg, object.heartbeatIntervalMs());
     hashAppend(hashAlg, object.useNtf());
+    hashAppend(hashAlg, object.zeroCopyThreshold());
+    hashAppend(hashAlg, object.flushPolicy());
+    hashAppend(hashAlg, object.flushMaxBytes());
+    hashAppend(hashAlg, object.flushMaxDelayUs());
+    hashAppend(hashAlg, object.flushRateThreshold());
+}
+
+inline bool mqbcfg::operator==(const mqbcfg::ThreadPlacementConfig& lhs,
+                               const mqbcfg::ThreadPlacementConfig& rhs)
+{
+    return lhs.sessions() == rhs.sessions() &&
+           lhs.queues() == rhs.queues() &&
+           lhs.clusters() == rhs.clusters() &&
+           lhs.ioThreads() == rhs.ioThreads() &&
+           lhs.scheduler() == rhs.scheduler();
+}
+
+inline bool mqbcfg::operator!=(const mqbcfg::ThreadPlacementConfig& lhs,
+                               const mqbcfg::ThreadPlacementConfig& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream&
+mqbcfg::operator<<(bsl::ostream&                        stream,
+                   const mqbcfg::ThreadPlacementConfig& rhs)
+{
+    return rhs.print(stream, 0, -1);
 }
 
+template <typename t_HASH_ALGORITHM>
+void mqbcfg::hashAppend(t_HASH_ALGORITHM&                    hashAlg,
+                        const mqbcfg::ThreadPlacementConfig& object)
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.sessions());
+    hashAppend(hashAlg, object.queues());
+    hashAppend(hashAlg, object.clusters());
+    hashAppend(hashAlg, object.ioThreads());
+    hashAppend(hashAlg, object.scheduler());
+}
 inline bool mqbcfg::operator==(const mqbcfg::VirtualClusterInformation& lhs,
                                const mqbcfg::VirtualClusterInformation& rhs)
 {
@@ -17488,7 +19077,10 @@ inline bool mqbcfg::operator==(const mqbcfg::DispatcherProcessorConfig& lhs,
                                const mqbcfg::DispatcherProcessorConfig& rhs)
 {
     return lhs.numProcessors() == rhs.numProcessors() &&
-           lhs.processorConfig() == rhs.processorConfig();
+           lhs.processorConfig() == rhs.processorConfig() &&
+           lhs.rebalanceIntervalMs() == rhs.rebalanceIntervalMs() &&
+           lhs.rebalanceThresholdPercent() ==
+               rhs.rebalanceThresholdPercent();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::DispatcherProcessorConfig& lhs,
@@ -17511,6 +19103,8 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&                        hashAlg,
     using bslh::hashAppend;
     hashAppend(hashAlg, object.numProcessors());
     hashAppend(hashAlg, object.processorConfig());
+    hashAppend(hashAlg, object.rebalanceIntervalMs());
+    hashAppend(hashAlg, object.rebalanceThresholdPercent());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::LogController& lhs,
@@ -17598,7 +19192,17 @@ inline bool mqbcfg::operator==(const mqbcfg::PartitionConfig& lhs,
            lhs.maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            lhs.prefaultPages() == rhs.prefaultPages() &&
            lhs.flushAtShutdown() == rhs.flushAtShutdown() &&
-           lhs.syncConfig() == rhs.syncConfig();
+           lhs.syncConfig() == rhs.syncConfig() &&
+           lhs.writeBackend() == rhs.writeBackend() &&
+           lhs.syncBeforeReceipt() == rhs.syncBeforeReceipt() &&
+           lhs.groupCommitMaxDelayMs() == rhs.groupCommitMaxDelayMs() &&
+           lhs.groupCommitMaxBytes() == rhs.groupCommitMaxBytes() &&
+           lhs.indexSnapshotIntervalMs() == rhs.indexSnapshotIntervalMs() &&
+           lhs.coldTierLocation() == rhs.coldTierLocation() &&
+           lhs.coldTierMinAgeSeconds() == rhs.coldTierMinAgeSeconds() &&
+           lhs.replicationBatchSize() == rhs.replicationBatchSize() &&
+           lhs.replicationBatchingThreshold() ==
+               rhs.replicationBatchingThreshold();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::PartitionConfig& lhs,
@@ -17629,6 +19233,15 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&              hashAlg,
     hashAppend(hashAlg, object.prefaultPages());
     hashAppend(hashAlg, object.flushAtShutdown());
     hashAppend(hashAlg, object.syncConfig());
+    hashAppend(hashAlg, object.writeBackend());
+    hashAppend(hashAlg, object.syncBeforeReceipt());
+    hashAppend(hashAlg, object.groupCommitMaxDelayMs());
+    hashAppend(hashAlg, object.groupCommitMaxBytes());
+    hashAppend(hashAlg, object.indexSnapshotIntervalMs());
+    hashAppend(hashAlg, object.coldTierLocation());
+    hashAppend(hashAlg, object.coldTierMinAgeSeconds());
+    hashAppend(hashAlg, object.replicationBatchSize());
+    hashAppend(hashAlg, object.replicationBatchingThreshold());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::StatPluginConfigPrometheus& lhs,
@@ -17942,7 +19555,8 @@ inline bool mqbcfg::operator==(const mqbcfg::AppConfig& lhs,
            lhs.bmqconfConfig() == rhs.bmqconfConfig() &&
            lhs.plugins() == rhs.plugins() &&
            lhs.messagePropertiesV2() == rhs.messagePropertiesV2() &&
-           lhs.configureStream() == rhs.configureStream();
+           lhs.configureStream() == rhs.configureStream() &&
+           lhs.threadPlacement() == rhs.threadPlacement();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::AppConfig& lhs,
@@ -17979,6 +19593,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&        hashAlg,
     hashAppend(hashAlg, object.plugins());
     hashAppend(hashAlg, object.messagePropertiesV2());
     hashAppend(hashAlg, object.configureStream());
+    hashAppend(hashAlg, object.threadPlacement());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::ClustersDefinition& lhs,
@@ -90,6 +90,10 @@ struct CommandDefinition {
     {"STAT LIST_TUNABLES",
      "Get the supported settable parameters for the stat controller",
      "Get the supported settable parameters for the stat controller"},
+    {"STAT DISPATCHER",
+     "Show the load of the dispatcher processors",
+     "Show the load of each dispatcher processor and the most recent "
+     "migrations of clients between processors"},
     // ClusterCatalog
     {"CLUSTERS LIST", "List all active clusters", "List all active clusters"},
     {"CLUSTERS ADDREVERSE <clusterName> <remotePeer>",
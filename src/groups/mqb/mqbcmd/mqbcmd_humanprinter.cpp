@@ -467,6 +467,9 @@ void printFileStoreSummary(bsl::ostream&           os,
        << "Current Nagle count: "
        << prettyNumber(
               static_cast<bsls::Types::Int64>(summary.naglePacketCount()))
+       << newlineAndIndent(level + 1, spacesPerLevel)
+       << "Rollover pending copy  : "
+       << prettyBytes(summary.rolloverPendingBytes())
        << '\n'
        << newlineAndIndent(level + 1, spacesPerLevel)
        << "Number of assigned queue-storages: "
@@ -10446,14 +10446,19 @@ const bdlat_AttributeInfo FileStoreSummary::ATTRIBUTE_INFO_ARRAY[] = {
      "storageContent",
      sizeof("storageContent") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_ROLLOVER_PENDING_BYTES,
+     "rolloverPendingBytes",
+     sizeof("rolloverPendingBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 FileStoreSummary::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 11; ++i) {
+    for (int i = 0; i < 12; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             FileStoreSummary::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -10491,6 +10496,8 @@ const bdlat_AttributeInfo* FileStoreSummary::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NAGLE_PACKET_COUNT];
     case ATTRIBUTE_ID_STORAGE_CONTENT:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT];
+    case ATTRIBUTE_ID_ROLLOVER_PENDING_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES];
     default: return 0;
     }
 }
@@ -10500,6 +10507,7 @@ const bdlat_AttributeInfo* FileStoreSummary::lookupAttributeInfo(int id)
 FileStoreSummary::FileStoreSummary(bslma::Allocator* basicAllocator)
 : d_sequenceNum()
 , d_totalMappedBytes()
+, d_rolloverPendingBytes()
 , d_fileSets(basicAllocator)
 , d_primaryNodeDescription(basicAllocator)
 , d_storageContent(basicAllocator)
@@ -10516,6 +10524,7 @@ FileStoreSummary::FileStoreSummary(const FileStoreSummary& original,
                                    bslma::Allocator*       basicAllocator)
 : d_sequenceNum(original.d_sequenceNum)
 , d_totalMappedBytes(original.d_totalMappedBytes)
+, d_rolloverPendingBytes(original.d_rolloverPendingBytes)
 , d_fileSets(original.d_fileSets, basicAllocator)
 , d_primaryNodeDescription(original.d_primaryNodeDescription, basicAllocator)
 , d_storageContent(original.d_storageContent, basicAllocator)
@@ -10533,6 +10542,7 @@ FileStoreSummary::FileStoreSummary(const FileStoreSummary& original,
 FileStoreSummary::FileStoreSummary(FileStoreSummary&& original) noexcept
 : d_sequenceNum(bsl::move(original.d_sequenceNum)),
   d_totalMappedBytes(bsl::move(original.d_totalMappedBytes)),
+  d_rolloverPendingBytes(bsl::move(original.d_rolloverPendingBytes)),
   d_fileSets(bsl::move(original.d_fileSets)),
   d_primaryNodeDescription(bsl::move(original.d_primaryNodeDescription)),
   d_storageContent(bsl::move(original.d_storageContent)),
@@ -10549,6 +10559,7 @@ FileStoreSummary::FileStoreSummary(FileStoreSummary&& original,
                                    bslma::Allocator*  basicAllocator)
 : d_sequenceNum(bsl::move(original.d_sequenceNum))
 , d_totalMappedBytes(bsl::move(original.d_totalMappedBytes))
+, d_rolloverPendingBytes(bsl::move(original.d_rolloverPendingBytes))
 , d_fileSets(bsl::move(original.d_fileSets), basicAllocator)
 , d_primaryNodeDescription(bsl::move(original.d_primaryNodeDescription),
                            basicAllocator)
@@ -10583,6 +10594,7 @@ FileStoreSummary& FileStoreSummary::operator=(const FileStoreSummary& rhs)
         d_numUnreceiptedMessages = rhs.d_numUnreceiptedMessages;
         d_naglePacketCount       = rhs.d_naglePacketCount;
         d_storageContent         = rhs.d_storageContent;
+        d_rolloverPendingBytes   = rhs.d_rolloverPendingBytes;
     }
 
     return *this;
@@ -10604,6 +10616,7 @@ FileStoreSummary& FileStoreSummary::operator=(FileStoreSummary&& rhs)
         d_numUnreceiptedMessages = bsl::move(rhs.d_numUnreceiptedMessages);
         d_naglePacketCount       = bsl::move(rhs.d_naglePacketCount);
         d_storageContent         = bsl::move(rhs.d_storageContent);
+        d_rolloverPendingBytes   = bsl::move(rhs.d_rolloverPendingBytes);
     }
 
     return *this;
@@ -10623,6 +10636,7 @@ void FileStoreSummary::reset()
     bdlat_ValueTypeFunctions::reset(&d_numUnreceiptedMessages);
     bdlat_ValueTypeFunctions::reset(&d_naglePacketCount);
     bdlat_ValueTypeFunctions::reset(&d_storageContent);
+    bdlat_ValueTypeFunctions::reset(&d_rolloverPendingBytes);
 }
 
 // ACCESSORS
@@ -10647,6 +10661,8 @@ bsl::ostream& FileStoreSummary::print(bsl::ostream& stream,
                            this->numUnreceiptedMessages());
     printer.printAttribute("naglePacketCount", this->naglePacketCount());
     printer.printAttribute("storageContent", this->storageContent());
+    printer.printAttribute("rolloverPendingBytes",
+                           this->rolloverPendingBytes());
     printer.end();
     return stream;
 }
@@ -14048,6 +14064,11 @@ const bdlat_SelectionInfo StatCommand::SELECTION_INFO_ARRAY[] = {
      "listTunables",
      sizeof("listTunables") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_DISPATCHER,
+     "dispatcher",
+     sizeof("dispatcher") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -14055,7 +14076,7 @@ const bdlat_SelectionInfo StatCommand::SELECTION_INFO_ARRAY[] = {
 const bdlat_SelectionInfo* StatCommand::lookupSelectionInfo(const char* name,
                                                             int nameLength)
 {
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 5; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             StatCommand::SELECTION_INFO_ARRAY[i];
 
@@ -14078,6 +14099,8 @@ const bdlat_SelectionInfo* StatCommand::lookupSelectionInfo(int id)
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_GET_TUNABLE];
     case SELECTION_ID_LIST_TUNABLES:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES];
+    case SELECTION_ID_DISPATCHER:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_DISPATCHER];
     default: return 0;
     }
 }
@@ -14104,6 +14127,9 @@ StatCommand::StatCommand(const StatCommand& original,
     case SELECTION_ID_LIST_TUNABLES: {
         new (d_listTunables.buffer()) Void(original.d_listTunables.object());
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        new (d_dispatcher.buffer()) Void(original.d_dispatcher.object());
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14132,6 +14158,10 @@ StatCommand::StatCommand(StatCommand&& original) noexcept
         new (d_listTunables.buffer())
             Void(bsl::move(original.d_listTunables.object()));
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        new (d_dispatcher.buffer())
+            Void(bsl::move(original.d_dispatcher.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14159,6 +14189,10 @@ StatCommand::StatCommand(StatCommand&&     original,
         new (d_listTunables.buffer())
             Void(bsl::move(original.d_listTunables.object()));
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        new (d_dispatcher.buffer())
+            Void(bsl::move(original.d_dispatcher.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14182,6 +14216,9 @@ StatCommand& StatCommand::operator=(const StatCommand& rhs)
         case SELECTION_ID_LIST_TUNABLES: {
             makeListTunables(rhs.d_listTunables.object());
         } break;
+        case SELECTION_ID_DISPATCHER: {
+            makeDispatcher(rhs.d_dispatcher.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -14209,6 +14246,9 @@ StatCommand& StatCommand::operator=(StatCommand&& rhs)
         case SELECTION_ID_LIST_TUNABLES: {
             makeListTunables(bsl::move(rhs.d_listTunables.object()));
         } break;
+        case SELECTION_ID_DISPATCHER: {
+            makeDispatcher(bsl::move(rhs.d_dispatcher.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -14235,6 +14275,9 @@ void StatCommand::reset()
     case SELECTION_ID_LIST_TUNABLES: {
         d_listTunables.object().~Void();
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        d_dispatcher.object().~Void();
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -14256,6 +14299,9 @@ int StatCommand::makeSelection(int selectionId)
     case SELECTION_ID_LIST_TUNABLES: {
         makeListTunables();
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        makeDispatcher();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -14457,6 +14503,51 @@ Void& StatCommand::makeListTunables(Void&& value)
 }
 #endif
 
+Void& StatCommand::makeDispatcher()
+{
+    if (SELECTION_ID_DISPATCHER == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_dispatcher.object());
+    }
+    else {
+        reset();
+        new (d_dispatcher.buffer()) Void();
+        d_selectionId = SELECTION_ID_DISPATCHER;
+    }
+
+    return d_dispatcher.object();
+}
+
+Void& StatCommand::makeDispatcher(const Void& value)
+{
+    if (SELECTION_ID_DISPATCHER == d_selectionId) {
+        d_dispatcher.object() = value;
+    }
+    else {
+        reset();
+        new (d_dispatcher.buffer()) Void(value);
+        d_selectionId = SELECTION_ID_DISPATCHER;
+    }
+
+    return d_dispatcher.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+Void& StatCommand::makeDispatcher(Void&& value)
+{
+    if (SELECTION_ID_DISPATCHER == d_selectionId) {
+        d_dispatcher.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_dispatcher.buffer()) Void(bsl::move(value));
+        d_selectionId = SELECTION_ID_DISPATCHER;
+    }
+
+    return d_dispatcher.object();
+}
+#endif
+
 // ACCESSORS
 
 bsl::ostream&
@@ -14477,6 +14568,9 @@ StatCommand::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     case SELECTION_ID_LIST_TUNABLES: {
         printer.printAttribute("listTunables", d_listTunables.object());
     } break;
+    case SELECTION_ID_DISPATCHER: {
+        printer.printAttribute("dispatcher", d_dispatcher.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -14494,6 +14588,8 @@ const char* StatCommand::selectionName() const
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_GET_TUNABLE].name();
     case SELECTION_ID_LIST_TUNABLES:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES].name();
+    case SELECTION_ID_DISPATCHER:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_DISPATCHER].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
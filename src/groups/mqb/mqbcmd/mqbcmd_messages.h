@@ -13067,6 +13067,7 @@ class FileStoreSummary {
     // INSTANCE DATA
     bsls::Types::Uint64  d_sequenceNum;
     bsls::Types::Uint64  d_totalMappedBytes;
+    bsls::Types::Uint64  d_rolloverPendingBytes;
     bsl::vector<FileSet> d_fileSets;
     bsl::string          d_primaryNodeDescription;
     StorageContent       d_storageContent;
@@ -13090,10 +13091,11 @@ class FileStoreSummary {
         ATTRIBUTE_ID_NUM_OUTSTANDING_RECORDS  = 7,
         ATTRIBUTE_ID_NUM_UNRECEIPTED_MESSAGES = 8,
         ATTRIBUTE_ID_NAGLE_PACKET_COUNT       = 9,
-        ATTRIBUTE_ID_STORAGE_CONTENT          = 10
+        ATTRIBUTE_ID_STORAGE_CONTENT          = 10,
+        ATTRIBUTE_ID_ROLLOVER_PENDING_BYTES   = 11
     };
 
-    enum { NUM_ATTRIBUTES = 11 };
+    enum { NUM_ATTRIBUTES = 12 };
 
     enum {
         ATTRIBUTE_INDEX_PRIMARY_NODE_DESCRIPTION = 0,
@@ -13106,7 +13108,8 @@ class FileStoreSummary {
         ATTRIBUTE_INDEX_NUM_OUTSTANDING_RECORDS  = 7,
         ATTRIBUTE_INDEX_NUM_UNRECEIPTED_MESSAGES = 8,
         ATTRIBUTE_INDEX_NAGLE_PACKET_COUNT       = 9,
-        ATTRIBUTE_INDEX_STORAGE_CONTENT          = 10
+        ATTRIBUTE_INDEX_STORAGE_CONTENT          = 10,
+        ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES   = 11
     };
 
     // CONSTANTS
@@ -13252,6 +13255,10 @@ class FileStoreSummary {
     /// this object.
     StorageContent& storageContent();
 
+    /// Return a reference to the modifiable "RolloverPendingBytes"
+    /// attribute of this object.
+    bsls::Types::Uint64& rolloverPendingBytes();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -13339,6 +13346,10 @@ class FileStoreSummary {
     /// Return a reference to the non-modifiable "StorageContent" attribute
     /// of this object.
     const StorageContent& storageContent() const;
+
+    /// Return the value of the "RolloverPendingBytes" attribute of this
+    /// object.
+    bsls::Types::Uint64 rolloverPendingBytes() const;
 };
 
 // FREE OPERATORS
@@ -17654,6 +17665,7 @@ class StatCommand {
         bsls::ObjectBuffer<SetTunable>  d_setTunable;
         bsls::ObjectBuffer<bsl::string> d_getTunable;
         bsls::ObjectBuffer<Void>        d_listTunables;
+        bsls::ObjectBuffer<Void>        d_dispatcher;
     };
 
     int               d_selectionId;
@@ -17667,16 +17679,18 @@ class StatCommand {
         SELECTION_ID_SHOW          = 0,
         SELECTION_ID_SET_TUNABLE   = 1,
         SELECTION_ID_GET_TUNABLE   = 2,
-        SELECTION_ID_LIST_TUNABLES = 3
+        SELECTION_ID_LIST_TUNABLES = 3,
+        SELECTION_ID_DISPATCHER    = 4
     };
 
-    enum { NUM_SELECTIONS = 4 };
+    enum { NUM_SELECTIONS = 5 };
 
     enum {
         SELECTION_INDEX_SHOW          = 0,
         SELECTION_INDEX_SET_TUNABLE   = 1,
         SELECTION_INDEX_GET_TUNABLE   = 2,
-        SELECTION_INDEX_LIST_TUNABLES = 3
+        SELECTION_INDEX_LIST_TUNABLES = 3,
+        SELECTION_INDEX_DISPATCHER    = 4
     };
 
     // CONSTANTS
@@ -17798,6 +17812,16 @@ class StatCommand {
     // Optionally specify the 'value' of the "ListTunables".  If 'value' is
     // not specified, the default "ListTunables" value is used.
 
+    Void& makeDispatcher();
+    Void& makeDispatcher(const Void& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    Void& makeDispatcher(Void&& value);
+#endif
+    // Set the value of this object to be a "Dispatcher" value.  Optionally
+    // specify the 'value' of the "Dispatcher".  If 'value' is not
+    // specified, the default "Dispatcher" value is used.
+
     /// Invoke the specified `manipulator` on the address of the modifiable
     /// selection, supplying `manipulator` with the corresponding selection
     /// information structure.  Return the value returned from the
@@ -17827,6 +17851,11 @@ class StatCommand {
     /// object.
     Void& listTunables();
 
+    /// Return a reference to the modifiable "Dispatcher" selection of this
+    /// object if "Dispatcher" is the current selection.  The behavior is
+    /// undefined unless "Dispatcher" is the selection of this object.
+    Void& dispatcher();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -17875,6 +17904,11 @@ class StatCommand {
     /// object.
     const Void& listTunables() const;
 
+    /// Return a reference to the non-modifiable "Dispatcher" selection of
+    /// this object if "Dispatcher" is the current selection.  The behavior
+    /// is undefined unless "Dispatcher" is the selection of this object.
+    const Void& dispatcher() const;
+
     /// Return `true` if the value of this object is a "Show" value, and
     /// return `false` otherwise.
     bool isShowValue() const;
@@ -17891,6 +17925,10 @@ class StatCommand {
     /// and return `false` otherwise.
     bool isListTunablesValue() const;
 
+    /// Return `true` if the value of this object is a "Dispatcher" value,
+    /// and return `false` otherwise.
+    bool isDispatcherValue() const;
+
     /// Return `true` if the value of this object is undefined, and `false`
     /// otherwise.
     bool isUndefinedValue() const;
@@ -37721,6 +37759,13 @@ int FileStoreSummary::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_rolloverPendingBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -37782,6 +37827,11 @@ int FileStoreSummary::manipulateAttribute(MANIPULATOR& manipulator, int id)
             &d_storageContent,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT]);
     }
+    case ATTRIBUTE_ID_ROLLOVER_PENDING_BYTES: {
+        return manipulator(
+            &d_rolloverPendingBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -37857,6 +37907,11 @@ inline StorageContent& FileStoreSummary::storageContent()
     return d_storageContent;
 }
 
+inline bsls::Types::Uint64& FileStoreSummary::rolloverPendingBytes()
+{
+    return d_rolloverPendingBytes;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int FileStoreSummary::accessAttributes(ACCESSOR& accessor) const
@@ -37932,6 +37987,13 @@ int FileStoreSummary::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_rolloverPendingBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -37991,6 +38053,11 @@ int FileStoreSummary::accessAttribute(ACCESSOR& accessor, int id) const
         return accessor(d_storageContent,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT]);
     }
+    case ATTRIBUTE_ID_ROLLOVER_PENDING_BYTES: {
+        return accessor(
+            d_rolloverPendingBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_PENDING_BYTES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -38066,6 +38133,11 @@ inline const StorageContent& FileStoreSummary::storageContent() const
     return d_storageContent;
 }
 
+inline bsls::Types::Uint64 FileStoreSummary::rolloverPendingBytes() const
+{
+    return d_rolloverPendingBytes;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                 hashAlg,
                 const mqbcmd::FileStoreSummary& object)
@@ -38084,6 +38156,7 @@ void hashAppend(HASH_ALGORITHM&                 hashAlg,
     hashAppend(hashAlg, object.numUnreceiptedMessages());
     hashAppend(hashAlg, object.naglePacketCount());
     hashAppend(hashAlg, object.storageContent());
+    hashAppend(hashAlg, object.rolloverPendingBytes());
 }
 
 // --------------------------
@@ -41106,6 +41179,9 @@ int StatCommand::manipulateSelection(MANIPULATOR& manipulator)
         return manipulator(
             &d_listTunables.object(),
             SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES]);
+    case StatCommand::SELECTION_ID_DISPATCHER:
+        return manipulator(&d_dispatcher.object(),
+                           SELECTION_INFO_ARRAY[SELECTION_INDEX_DISPATCHER]);
     default:
         BSLS_ASSERT(StatCommand::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -41136,6 +41212,12 @@ inline Void& StatCommand::listTunables()
     return d_listTunables.object();
 }
 
+inline Void& StatCommand::dispatcher()
+{
+    BSLS_ASSERT(SELECTION_ID_DISPATCHER == d_selectionId);
+    return d_dispatcher.object();
+}
+
 // ACCESSORS
 inline int StatCommand::selectionId() const
 {
@@ -41158,6 +41240,9 @@ int StatCommand::accessSelection(ACCESSOR& accessor) const
     case SELECTION_ID_LIST_TUNABLES:
         return accessor(d_listTunables.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES]);
+    case SELECTION_ID_DISPATCHER:
+        return accessor(d_dispatcher.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_DISPATCHER]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -41186,6 +41271,12 @@ inline const Void& StatCommand::listTunables() const
     return d_listTunables.object();
 }
 
+inline const Void& StatCommand::dispatcher() const
+{
+    BSLS_ASSERT(SELECTION_ID_DISPATCHER == d_selectionId);
+    return d_dispatcher.object();
+}
+
 inline bool StatCommand::isShowValue() const
 {
     return SELECTION_ID_SHOW == d_selectionId;
@@ -41206,6 +41297,11 @@ inline bool StatCommand::isListTunablesValue() const
     return SELECTION_ID_LIST_TUNABLES == d_selectionId;
 }
 
+inline bool StatCommand::isDispatcherValue() const
+{
+    return SELECTION_ID_DISPATCHER == d_selectionId;
+}
+
 inline bool StatCommand::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -41228,6 +41324,9 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::StatCommand& object)
     case Class::SELECTION_ID_LIST_TUNABLES:
         hashAppend(hashAlg, object.listTunables());
         break;
+    case Class::SELECTION_ID_DISPATCHER:
+        hashAppend(hashAlg, object.dispatcher());
+        break;
     default:
         BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == object.selectionId());
     }
@@ -49717,7 +49816,8 @@ inline bool mqbcmd::operator==(const mqbcmd::FileStoreSummary& lhs,
            lhs.numOutstandingRecords() == rhs.numOutstandingRecords() &&
            lhs.numUnreceiptedMessages() == rhs.numUnreceiptedMessages() &&
            lhs.naglePacketCount() == rhs.naglePacketCount() &&
-           lhs.storageContent() == rhs.storageContent();
+           lhs.storageContent() == rhs.storageContent() &&
+           lhs.rolloverPendingBytes() == rhs.rolloverPendingBytes();
 }
 
 inline bool mqbcmd::operator!=(const mqbcmd::FileStoreSummary& lhs,
@@ -50153,6 +50253,8 @@ inline bool mqbcmd::operator==(const mqbcmd::StatCommand& lhs,
             return lhs.getTunable() == rhs.getTunable();
         case Class::SELECTION_ID_LIST_TUNABLES:
             return lhs.listTunables() == rhs.listTunables();
+        case Class::SELECTION_ID_DISPATCHER:
+            return lhs.dispatcher() == rhs.dispatcher();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
@@ -607,6 +607,10 @@ int parseStat(StatCommand* stats, bsl::string* error, WordGenerator next)
         stats->makeListTunables();
         return expectEnd(error, next);  // RETURN
     }
+    else if (equalCaseless(subcommand, "DISPATCHER")) {
+        stats->makeDispatcher();
+        return expectEnd(error, next);  // RETURN
+    }
 
     *error = "Unexpected STAT subcommand: " + subcommand;
     return -1;
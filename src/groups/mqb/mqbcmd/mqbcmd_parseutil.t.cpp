@@ -207,6 +207,10 @@ const Test k_TESTS[] = {
      "CONFIGPROVIDER CACHE_CLEAR",
      0},
     {__LINE__, "show statistics", "STAT SHOW", "{\"stat\": {\"show\": {}}}"},
+    {__LINE__,
+     "show dispatcher load",
+     "STAT DISPATCHER",
+     "{\"stat\": {\"dispatcher\": {}}}"},
     {__LINE__,
      "list all active clusters",
      "CLUSTERS LIST",
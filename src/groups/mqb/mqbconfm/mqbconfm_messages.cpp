@@ -3255,14 +3255,19 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "consistency",
      sizeof("consistency") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_COMPRESSION_DICTIONARIES,
+     "compressionDictionaries",
+     sizeof("compressionDictionaries") - 1,
+     "",
+     bdlat_FormattingMode::e_HEX}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 13; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3300,6 +3305,8 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS];
     case ATTRIBUTE_ID_CONSISTENCY:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES];
     default: return 0;
     }
 }
@@ -3307,7 +3314,8 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
 // CREATORS
 
 Domain::Domain(bslma::Allocator* basicAllocator)
-: d_messageTtl()
+: d_compressionDictionaries(basicAllocator)
+, d_messageTtl()
 , d_name(basicAllocator)
 , d_msgGroupIdConfig()
 , d_storage()
@@ -3323,7 +3331,9 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 }
 
 Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
-: d_messageTtl(original.d_messageTtl)
+: d_compressionDictionaries(original.d_compressionDictionaries,
+                            basicAllocator)
+, d_messageTtl(original.d_messageTtl)
 , d_name(original.d_name, basicAllocator)
 , d_msgGroupIdConfig(original.d_msgGroupIdConfig)
 , d_storage(original.d_storage)
@@ -3341,7 +3351,8 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 Domain::Domain(Domain&& original) noexcept
-: d_messageTtl(bsl::move(original.d_messageTtl)),
+: d_compressionDictionaries(bsl::move(original.d_compressionDictionaries)),
+  d_messageTtl(bsl::move(original.d_messageTtl)),
   d_name(bsl::move(original.d_name)),
   d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig)),
   d_storage(bsl::move(original.d_storage)),
@@ -3357,7 +3368,9 @@ Domain::Domain(Domain&& original) noexcept
 }
 
 Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
-: d_messageTtl(bsl::move(original.d_messageTtl))
+: d_compressionDictionaries(bsl::move(original.d_compressionDictionaries),
+                            basicAllocator)
+, d_messageTtl(bsl::move(original.d_messageTtl))
 , d_name(bsl::move(original.d_name), basicAllocator)
 , d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig))
 , d_storage(bsl::move(original.d_storage))
@@ -3382,18 +3395,19 @@ Domain::~Domain()
 Domain& Domain::operator=(const Domain& rhs)
 {
     if (this != &rhs) {
-        d_name                = rhs.d_name;
-        d_mode                = rhs.d_mode;
-        d_storage             = rhs.d_storage;
-        d_maxConsumers        = rhs.d_maxConsumers;
-        d_maxProducers        = rhs.d_maxProducers;
-        d_maxQueues           = rhs.d_maxQueues;
-        d_msgGroupIdConfig    = rhs.d_msgGroupIdConfig;
-        d_maxIdleTime         = rhs.d_maxIdleTime;
-        d_messageTtl          = rhs.d_messageTtl;
-        d_maxDeliveryAttempts = rhs.d_maxDeliveryAttempts;
-        d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
-        d_consistency         = rhs.d_consistency;
+        d_name                    = rhs.d_name;
+        d_mode                    = rhs.d_mode;
+        d_storage                 = rhs.d_storage;
+        d_maxConsumers            = rhs.d_maxConsumers;
+        d_maxProducers            = rhs.d_maxProducers;
+        d_maxQueues               = rhs.d_maxQueues;
+        d_msgGroupIdConfig        = rhs.d_msgGroupIdConfig;
+        d_maxIdleTime             = rhs.d_maxIdleTime;
+        d_messageTtl              = rhs.d_messageTtl;
+        d_maxDeliveryAttempts     = rhs.d_maxDeliveryAttempts;
+        d_deduplicationTimeMs     = rhs.d_deduplicationTimeMs;
+        d_consistency             = rhs.d_consistency;
+        d_compressionDictionaries = rhs.d_compressionDictionaries;
     }
 
     return *this;
@@ -3404,18 +3418,19 @@ Domain& Domain::operator=(const Domain& rhs)
 Domain& Domain::operator=(Domain&& rhs)
 {
     if (this != &rhs) {
-        d_name                = bsl::move(rhs.d_name);
-        d_mode                = bsl::move(rhs.d_mode);
-        d_storage             = bsl::move(rhs.d_storage);
-        d_maxConsumers        = bsl::move(rhs.d_maxConsumers);
-        d_maxProducers        = bsl::move(rhs.d_maxProducers);
-        d_maxQueues           = bsl::move(rhs.d_maxQueues);
-        d_msgGroupIdConfig    = bsl::move(rhs.d_msgGroupIdConfig);
-        d_maxIdleTime         = bsl::move(rhs.d_maxIdleTime);
-        d_messageTtl          = bsl::move(rhs.d_messageTtl);
-        d_maxDeliveryAttempts = bsl::move(rhs.d_maxDeliveryAttempts);
-        d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
-        d_consistency         = bsl::move(rhs.d_consistency);
+        d_name                    = bsl::move(rhs.d_name);
+        d_mode                    = bsl::move(rhs.d_mode);
+        d_storage                 = bsl::move(rhs.d_storage);
+        d_maxConsumers            = bsl::move(rhs.d_maxConsumers);
+        d_maxProducers            = bsl::move(rhs.d_maxProducers);
+        d_maxQueues               = bsl::move(rhs.d_maxQueues);
+        d_msgGroupIdConfig        = bsl::move(rhs.d_msgGroupIdConfig);
+        d_maxIdleTime             = bsl::move(rhs.d_maxIdleTime);
+        d_messageTtl              = bsl::move(rhs.d_messageTtl);
+        d_maxDeliveryAttempts     = bsl::move(rhs.d_maxDeliveryAttempts);
+        d_deduplicationTimeMs     = bsl::move(rhs.d_deduplicationTimeMs);
+        d_consistency             = bsl::move(rhs.d_consistency);
+        d_compressionDictionaries = bsl::move(rhs.d_compressionDictionaries);
     }
 
     return *this;
@@ -3436,6 +3451,7 @@ void Domain::reset()
     d_maxDeliveryAttempts = DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS;
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
+    bdlat_ValueTypeFunctions::reset(&d_compressionDictionaries);
 }
 
 // ACCESSORS
@@ -3457,6 +3473,8 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("maxDeliveryAttempts", this->maxDeliveryAttempts());
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
+    printer.printAttribute("compressionDictionaries",
+                           this->compressionDictionaries());
     printer.end();
     return stream;
 }
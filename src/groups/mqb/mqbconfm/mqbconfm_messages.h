@@ -4199,9 +4199,14 @@ class Domain {
     // queue.  Zero (the default) means unlimited deduplicationTimeMs.:
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
-    // mode.
+    // mode.  compressionDictionaries: compression dictionaries, in the
+    // Zstandard dictionary format, with which producers compress small
+    // messages; the first one is the current one, and the following ones are
+    // older versions still needed to decompress messages compressed with
+    // them.  Each dictionary must have a distinct, non-zero, id
 
     // INSTANCE DATA
+    bsl::vector<bsl::vector<char> >       d_compressionDictionaries;
     bsls::Types::Int64                    d_messageTtl;
     bsl::string                           d_name;
     bdlb::NullableValue<MsgGroupIdConfig> d_msgGroupIdConfig;
@@ -4228,11 +4233,12 @@ class Domain {
         ATTRIBUTE_ID_MAX_IDLE_TIME         = 7,
         ATTRIBUTE_ID_MESSAGE_TTL           = 8,
         ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_ID_CONSISTENCY           = 11
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS    = 10,
+        ATTRIBUTE_ID_CONSISTENCY              = 11,
+        ATTRIBUTE_ID_COMPRESSION_DICTIONARIES = 12
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 13 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -4245,8 +4251,9 @@ class Domain {
         ATTRIBUTE_INDEX_MAX_IDLE_TIME         = 7,
         ATTRIBUTE_INDEX_MESSAGE_TTL           = 8,
         ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_INDEX_CONSISTENCY           = 11
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS    = 10,
+        ATTRIBUTE_INDEX_CONSISTENCY              = 11,
+        ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES = 12
     };
 
     // CONSTANTS
@@ -4403,6 +4410,10 @@ class Domain {
     // Return a reference to the modifiable "Consistency" attribute of this
     // object.
 
+    bsl::vector<bsl::vector<char> >& compressionDictionaries();
+    // Return a reference to the modifiable "CompressionDictionaries"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -4488,6 +4499,10 @@ class Domain {
     const Consistency& consistency() const;
     // Return a reference offering non-modifiable access to the
     // "Consistency" attribute of this object.
+
+    const bsl::vector<bsl::vector<char> >& compressionDictionaries() const;
+    // Return a reference offering non-modifiable access to the
+    // "CompressionDictionaries" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -7297,6 +7312,13 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_compressionDictionaries,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7360,6 +7382,11 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_consistency,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES: {
+        return manipulator(
+            &d_compressionDictionaries,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7440,6 +7467,11 @@ inline Consistency& Domain::consistency()
     return d_consistency;
 }
 
+inline bsl::vector<bsl::vector<char> >& Domain::compressionDictionaries()
+{
+    return d_compressionDictionaries;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -7517,6 +7549,13 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_compressionDictionaries,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7575,6 +7614,11 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_consistency,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARIES: {
+        return accessor(
+            d_compressionDictionaries,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARIES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7656,6 +7700,12 @@ inline const Consistency& Domain::consistency() const
     return d_consistency;
 }
 
+inline const bsl::vector<bsl::vector<char> >&
+Domain::compressionDictionaries() const
+{
+    return d_compressionDictionaries;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -8574,7 +8624,8 @@ inline bool mqbconfm::operator==(const mqbconfm::Domain& lhs,
            lhs.messageTtl() == rhs.messageTtl() &&
            lhs.maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
-           lhs.consistency() == rhs.consistency();
+           lhs.consistency() == rhs.consistency() &&
+           lhs.compressionDictionaries() == rhs.compressionDictionaries();
 }
 
 inline bool mqbconfm::operator!=(const mqbconfm::Domain& lhs,
@@ -8606,6 +8657,7 @@ void mqbconfm::hashAppend(t_HASH_ALGORITHM&       hashAlg,
     hashAppend(hashAlg, object.maxDeliveryAttempts());
     hashAppend(hashAlg, object.deduplicationTimeMs());
     hashAppend(hashAlg, object.consistency());
+    hashAppend(hashAlg, object.compressionDictionaries());
 }
 
 inline bool mqbconfm::operator==(const mqbconfm::DomainDefinition& lhs,
@@ -28,6 +28,7 @@
 #include <bsl_ostream.h>
 #include <bslim_printer.h>
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 
 namespace BloombergLP {
 namespace mqbi {
@@ -442,7 +443,8 @@ bsl::ostream& DispatcherClientData::print(bsl::ostream& stream,
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start();
     printer.printAttribute("clientType", d_clientType);
-    printer.printAttribute("processorHandle", d_processorHandle);
+    printer.printAttribute("processorHandle", processorHandle());
+    printer.printAttribute("isMigratable", (d_isMigratable ? "yes" : "no"));
     printer.printAttribute("addedToFlushList",
                            (d_addedToFlushList ? "yes" : "no"));
     printer.end();
@@ -459,5 +461,18 @@ DispatcherClient::~DispatcherClient()
     // NOTHING
 }
 
+// MANIPULATORS
+void DispatcherClient::onDispatcherEvents(const DispatcherEvent* const* events,
+                                          int numEvents)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(events);
+    BSLS_ASSERT_SAFE(numEvents > 0);
+
+    for (int i = 0; i < numEvents; ++i) {
+        onDispatcherEvent(*events[i]);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -129,6 +129,7 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_nullptr.h>
 
 namespace BloombergLP {
@@ -1157,9 +1158,45 @@ class DispatcherClientData {
     DispatcherClientType::Enum d_clientType;
     // Type of dispatcher client.
 
-    Dispatcher::ProcessorHandle d_processorHandle;
+    bsls::AtomicInt d_processorHandle;
     // Processor handle to which the client is
-    // associated with.
+    // associated with, i.e., the processor
+    // executing the events of the client.
+    // Updated by the target processor when
+    // the client is migrated, while read from
+    // any thread (e.g., to check whether a
+    // thread is the one of the client).
+
+    bsls::AtomicInt d_destinationProcessorHandle;
+    // Processor handle to which events for the
+    // client are enqueued.  This is always equal
+    // to 'd_processorHandle', except while the
+    // client is being migrated from one
+    // processor to another -- this is a
+    // Dispatcher internal member that should
+    // only be manipulated by the dispatcher, and
+    // not the clients.  Accessed with
+    // sequentially consistent operations: the
+    // migration handshake with
+    // 'd_numDispatchesInFlight' requires the
+    // store of one side to be ordered before
+    // its subsequent load (StoreLoad), which
+    // acquire/release does not provide.
+
+    bsls::AtomicInt d_numDispatchesInFlight;
+    // Number of threads currently enqueuing an
+    // event for the client, only maintained if
+    // 'd_isMigratable' is true -- this is a
+    // Dispatcher internal member that should
+    // only be manipulated by the dispatcher, and
+    // not the clients.
+
+    bool d_isMigratable;
+    // Flag indicating whether the dispatcher is
+    // allowed to migrate the client to another
+    // processor -- this is a Dispatcher internal
+    // member that should only be manipulated by
+    // the dispatcher, and not the clients.
 
     bool d_addedToFlushList;
     // Flag indicating whether the dispatcher
@@ -1178,16 +1215,45 @@ class DispatcherClientData {
     /// Default constructor
     explicit DispatcherClientData();
 
+    /// Create a `DispatcherClientData` having the same value as the
+    /// specified `original` object.
+    DispatcherClientData(const DispatcherClientData& original);
+
     // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference offering modifiable access to this object.
+    DispatcherClientData& operator=(const DispatcherClientData& rhs);
+
     DispatcherClientData& setClientType(DispatcherClientType::Enum value);
+
+    /// Set the processor handle of the client, and the processor handle
+    /// events for the client are enqueued to, to the specified `value` and
+    /// return a reference offering modifiable access to this object.  The
+    /// behavior is undefined unless the processor handle is currently
+    /// invalid, `value` is invalid, or the client is migratable.
     DispatcherClientData&
     setProcessorHandle(Dispatcher::ProcessorHandle value);
+
+    /// Set the processor handle events for the client are enqueued to,
+    /// without changing the processor handle of the client, to the
+    /// specified `value` and return a reference offering modifiable access
+    /// to this object.  The behavior is undefined unless the client is
+    /// migratable.
+    DispatcherClientData&
+    setDestinationProcessorHandle(Dispatcher::ProcessorHandle value);
+
+    DispatcherClientData& setMigratable(bool value);
     DispatcherClientData& setAddedToFlushList(bool value);
 
     /// Set the corresponding member to the specified `value` and return a
     /// reference offering modifiable access to this object.
     DispatcherClientData& setDispatcher(Dispatcher* value);
 
+    /// Return a reference offering modifiable access to the number of
+    /// threads currently enqueuing an event for the client.
+    bsls::AtomicInt& numDispatchesInFlight();
+
     /// Return a pointer to the dispatcher associated with this object; or
     /// null is this client is not (yet) registered to a dispatcher.
     Dispatcher* dispatcher();
@@ -1195,6 +1261,9 @@ class DispatcherClientData {
     // ACCESSORS
     DispatcherClientType::Enum  clientType() const;
     Dispatcher::ProcessorHandle processorHandle() const;
+    Dispatcher::ProcessorHandle destinationProcessorHandle() const;
+    int                         numDispatchesInFlight() const;
+    bool                        isMigratable() const;
     bool                        addedToFlushList() const;
 
     /// Return the value of the corresponding member.
@@ -1245,6 +1314,16 @@ class DispatcherClient {
     /// deliver to the client.
     virtual void onDispatcherEvent(const DispatcherEvent& event) = 0;
 
+    /// Called by the `Dispatcher` when it has the specified `numEvents`
+    /// `events` to deliver to the client at once.  All `events` are of the
+    /// same type, are destined to this client and were dequeued
+    /// consecutively; they must be processed in order.  The default
+    /// implementation calls `onDispatcherEvent` on each of the `events`;
+    /// clients can override it to amortize per-event work over the batch.
+    /// Note that `flush` is called once the whole batch was processed.
+    virtual void onDispatcherEvents(const DispatcherEvent* const* events,
+                                    int                           numEvents);
+
     /// Called by the dispatcher to flush any pending operation; mainly
     /// used to provide batch and nagling mechanism.
     virtual void flush() = 0;
@@ -1723,12 +1802,43 @@ inline const DispatcherReceiptEvent* DispatcherEvent::asReceiptEvent() const
 inline DispatcherClientData::DispatcherClientData()
 : d_clientType(DispatcherClientType::e_UNDEFINED)
 , d_processorHandle(Dispatcher::k_INVALID_PROCESSOR_HANDLE)
+, d_destinationProcessorHandle(Dispatcher::k_INVALID_PROCESSOR_HANDLE)
+, d_numDispatchesInFlight(0)
+, d_isMigratable(false)
 , d_addedToFlushList(false)
 , d_dispatcher_p(0)
 {
     // NOTHING
 }
 
+inline DispatcherClientData::DispatcherClientData(
+    const DispatcherClientData& original)
+: d_clientType(original.d_clientType)
+, d_processorHandle(original.d_processorHandle.load())
+, d_destinationProcessorHandle(original.d_destinationProcessorHandle.load())
+, d_numDispatchesInFlight(0)
+, d_isMigratable(original.d_isMigratable)
+, d_addedToFlushList(original.d_addedToFlushList)
+, d_dispatcher_p(original.d_dispatcher_p)
+{
+    // NOTHING
+}
+
+inline DispatcherClientData&
+DispatcherClientData::operator=(const DispatcherClientData& rhs)
+{
+    if (this != &rhs) {
+        d_clientType                 = rhs.d_clientType;
+        d_processorHandle            = rhs.d_processorHandle.load();
+        d_destinationProcessorHandle = rhs.d_destinationProcessorHandle.load();
+        d_isMigratable               = rhs.d_isMigratable;
+        d_addedToFlushList           = rhs.d_addedToFlushList;
+        d_dispatcher_p               = rhs.d_dispatcher_p;
+    }
+
+    return *this;
+}
+
 inline DispatcherClientData&
 DispatcherClientData::setClientType(DispatcherClientType::Enum value)
 {
@@ -1746,10 +1856,28 @@ DispatcherClientData::setProcessorHandle(Dispatcher::ProcessorHandle value)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(
         (d_processorHandle == Dispatcher::k_INVALID_PROCESSOR_HANDLE ||
-         value == Dispatcher::k_INVALID_PROCESSOR_HANDLE) &&
+         value == Dispatcher::k_INVALID_PROCESSOR_HANDLE || d_isMigratable) &&
         "Processor handle can only be set once");
 
-    d_processorHandle = value;
+    d_processorHandle            = value;
+    d_destinationProcessorHandle = value;
+    return *this;
+}
+
+inline DispatcherClientData&
+DispatcherClientData::setDestinationProcessorHandle(
+    Dispatcher::ProcessorHandle value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isMigratable);
+
+    d_destinationProcessorHandle = value;
+    return *this;
+}
+
+inline DispatcherClientData& DispatcherClientData::setMigratable(bool value)
+{
+    d_isMigratable = value;
     return *this;
 }
 
@@ -1767,6 +1895,11 @@ DispatcherClientData::setDispatcher(Dispatcher* value)
     return *this;
 }
 
+inline bsls::AtomicInt& DispatcherClientData::numDispatchesInFlight()
+{
+    return d_numDispatchesInFlight;
+}
+
 inline Dispatcher* DispatcherClientData::dispatcher()
 {
     return d_dispatcher_p;
@@ -1783,6 +1916,22 @@ DispatcherClientData::processorHandle() const
     return d_processorHandle;
 }
 
+inline Dispatcher::ProcessorHandle
+DispatcherClientData::destinationProcessorHandle() const
+{
+    return d_destinationProcessorHandle;
+}
+
+inline int DispatcherClientData::numDispatchesInFlight() const
+{
+    return d_numDispatchesInFlight;
+}
+
+inline bool DispatcherClientData::isMigratable() const
+{
+    return d_isMigratable;
+}
+
 inline bool DispatcherClientData::addedToFlushList() const
 {
     return d_addedToFlushList;
@@ -65,6 +65,7 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslalg_swaputil.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_once.h>
@@ -196,6 +197,15 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
     config.setKeepAlive(true);
     config.setKeepHalfOpen(false);
 
+    if (tcpConfig.zeroCopyThreshold() > 0) {
+        // Writes of at least that size are sent with 'MSG_ZEROCOPY' (if
+        // supported by the platform), NTF keeping a reference to the blob
+        // buffers until the kernel notifies, through the socket error queue,
+        // that it is done with them.
+        config.setZeroCopyThreshold(
+            static_cast<bsl::size_t>(tcpConfig.zeroCopyThreshold()));
+    }
+
     return config;
 }
 
@@ -956,7 +966,15 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
 
     BALL_LOG_INFO << "Starting TCPSessionFactory '" << d_config.name() << "'";
 
-    int rc = 0;
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                      = 0,
+        rc_INVALID_IO_CPU_LIST          = -1,
+        rc_CHANNEL_FACTORY              = -2,
+        rc_RECONNECTING_CHANNEL_FACTORY = -3
+    };
+
+    int rc = rc_SUCCESS;
 
     const mqbcfg::AppConfig& appConfig = mqbcfg::BrokerConfig::get();
 
@@ -978,12 +996,33 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
                                                   bdlf::PlaceHolders::_1,
                                                   bdlf::PlaceHolders::_2));
 
-    rc = channelFactory->start();
+    const bsl::string& ioCpuList = appConfig.threadPlacement().ioThreads();
+    bsl::vector<int>   ioCpus(d_allocator_p);
+    rc = mwcsys::ThreadUtil::parseCpuList(&ioCpus, ioCpuList);
+    if (rc != 0) {
+        errorDescription << "Invalid IO threads CPU list '" << ioCpuList
+                         << "' for TCPSessionFactory '" << d_config.name()
+                         << "' [rc: " << rc << "]";
+        return (rc * 10) + rc_INVALID_IO_CPU_LIST;  // RETURN
+    }
+
+    {
+        // The IO threads are created when starting the channel factory, and
+        // inherit the affinity of this thread.
+        mwcsys::ThreadAffinityGuard affinityGuard(ioCpus, d_allocator_p);
+        if (!ioCpus.empty() && !affinityGuard.isEngaged()) {
+            BALL_LOG_WARN << "Unable to restrict IO threads of "
+                          << "TCPSessionFactory '" << d_config.name()
+                          << "' to CPUs '" << ioCpuList << "'";
+        }
+
+        rc = channelFactory->start();
+    }
     if (rc != 0) {
         errorDescription << "Failed starting channel pool for "
                          << "TCPSessionFactory '" << d_config.name()
                          << "' [rc: " << rc << "]";
-        return rc;  // RETURN
+        return (rc * 10) + rc_CHANNEL_FACTORY;  // RETURN
     }
 
     d_tcpChannelFactory_mp = channelFactory;
@@ -1035,25 +1074,28 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
         errorDescription << "Failed starting reconnecting channel factory for "
                          << "TCPSessionFactory '" << d_config.name()
                          << "' [rc: " << rc << "]";
-        return rc;  // RETURN
+        return (rc * 10) + rc_RECONNECTING_CHANNEL_FACTORY;  // RETURN
     }
 
     bdlb::ScopeExitAny reconnectingScopeGuard(
         bdlf::BindUtil::bind(&mwcio::ReconnectingChannelFactory::stop,
                              d_reconnectingChannelFactory_mp.get()));
 
-    d_statChannelFactory_mp.load(
-        new (*d_allocator_p) mwcio::StatChannelFactory(
-            mwcio::StatChannelFactoryConfig(
-                d_reconnectingChannelFactory_mp.get(),
-                bdlf::BindUtil::bind(
-                    &TCPSessionFactory::channelStatContextCreator,
-                    this,
-                    bdlf::PlaceHolders::_1,   // channel
-                    bdlf::PlaceHolders::_2),  // handle
-                d_allocator_p),
-            d_allocator_p),
+    mwcio::StatChannelFactoryConfig statChannelFactoryConfig(
+        d_reconnectingChannelFactory_mp.get(),
+        bdlf::BindUtil::bind(&TCPSessionFactory::channelStatContextCreator,
+                             this,
+                             bdlf::PlaceHolders::_1,   // channel
+                             bdlf::PlaceHolders::_2),  // handle
         d_allocator_p);
+    statChannelFactoryConfig.setZeroCopyThreshold(
+        d_config.zeroCopyThreshold());
+
+    d_statChannelFactory_mp.load(new (*d_allocator_p)
+                                     mwcio::StatChannelFactory(
+                                         statChannelFactoryConfig,
+                                         d_allocator_p),
+                                 d_allocator_p);
 
     if (d_config.heartbeatIntervalMs() != 0) {
         BALL_LOG_INFO
@@ -1087,7 +1129,7 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
     reconnectingScopeGuard.release();
     tcpScopeGuard.release();
 
-    return 0;
+    return rc_SUCCESS;
 }
 
 int TCPSessionFactory::startListening(bsl::ostream&         errorDescription,
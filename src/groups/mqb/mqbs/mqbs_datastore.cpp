@@ -42,8 +42,17 @@ DataStoreConfig::DataStoreConfig()
 , d_scheduler_p(0)
 , d_preallocate(false)
 , d_prefaultPages(false)
+, d_writeBackend(mqbcfg::StorageWriteBackend::E_MMAP)
+, d_syncBeforeReceipt(false)
+, d_groupCommitMaxDelayMs(0)
+, d_groupCommitMaxBytes(0)
+, d_indexSnapshotIntervalMs(0)
 , d_location()
 , d_archiveLocation()
+, d_coldTierLocation()
+, d_coldTierMinAgeSeconds(0)
+, d_replicationBatchSize(0)
+, d_replicationBatchingThreshold(0)
 , d_nodeId(-1)
 , d_partitionId(-1)
 , d_maxDataFileSize(0)
@@ -70,11 +79,23 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("partitionId", partitionId());
     printer.printAttribute("location", location());
     printer.printAttribute("archiveLocation", archiveLocation());
+    printer.printAttribute("coldTierLocation", coldTierLocation());
+    printer.printAttribute("coldTierMinAgeSeconds", coldTierMinAgeSeconds());
+    printer.printAttribute("replicationBatchSize", replicationBatchSize());
+    printer.printAttribute("replicationBatchingThreshold",
+                           replicationBatchingThreshold());
     printer.printAttribute("clusterName", clusterName());
     printer.printAttribute("preallocate",
                            (hasPreallocate() ? "true" : "false"));
     printer.printAttribute("prefaultPages",
                            (hasPrefaultPages() ? "true" : "false"));
+    printer.printAttribute("writeBackend", writeBackend());
+    printer.printAttribute("syncBeforeReceipt",
+                           (hasSyncBeforeReceipt() ? "true" : "false"));
+    printer.printAttribute("groupCommitMaxDelayMs", groupCommitMaxDelayMs());
+    printer.printAttribute("groupCommitMaxBytes", groupCommitMaxBytes());
+    printer.printAttribute("indexSnapshotIntervalMs",
+                           indexSnapshotIntervalMs());
     printer.printAttribute("maxDataFileSize", maxDataFileSize());
     printer.printAttribute("maxQlistFileSize", maxQlistFileSize());
     printer.printAttribute("maxJournalFileSize", maxJournalFileSize());
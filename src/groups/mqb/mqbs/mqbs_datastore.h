@@ -35,6 +35,7 @@
 
 // MQB
 
+#include <mqbcfg_messages.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_storage.h>
 #include <mqbs_filestoreprotocol.h>
@@ -143,6 +144,14 @@ struct DataStoreRecord {
     bool d_hasReceipt;
     // Strong consistency receipt.
 
+    bool d_isCold;
+    // Whether the message resides in the
+    // cold tier data file of the file set
+    // instead of its DATA file, in which
+    // case `d_messageOffset` is an offset
+    // in the cold tier data file.  Used
+    // only if d_recordType == e_MESSAGE.
+
     bsls::Types::Int64 d_arrivalTimepoint;
     // Arrival timepoint of the message, in
     // nanoseconds from an arbitrary but
@@ -378,10 +387,68 @@ class DataStoreConfig {
     // (prefault) page tables for a
     // mapping.
 
+    mqbcfg::StorageWriteBackend::Value d_writeBackend;
+    // Mechanism used to write back dirty
+    // pages of the files to disk.
+
+    bool d_syncBeforeReceipt;
+    // Flag to indicate whether a record
+    // must be durably synced to disk
+    // before being receipted.  Only
+    // honored by the 'E_ASYNC_WRITEBACK'
+    // write backend.
+
+    int d_groupCommitMaxDelayMs;
+    // Maximum time, in milliseconds, a
+    // durable sync is delayed in order to
+    // batch more records into it.  Zero
+    // means that a sync is issued as soon
+    // as the previous one completes.
+
+    bsls::Types::Uint64 d_groupCommitMaxBytes;
+    // Number of unsynced bytes which
+    // triggers a durable sync without
+    // waiting for the group commit delay.
+
+    int d_indexSnapshotIntervalMs;
+    // Minimum interval, in milliseconds,
+    // between two snapshots of the
+    // in-memory index of the partition.
+    // Zero means that no snapshot is
+    // taken.
+
     bslstl::StringRef d_location;
 
     bslstl::StringRef d_archiveLocation;
 
+    bslstl::StringRef d_coldTierLocation;
+    // Location of the cold tier files.
+    // Empty means that the partition has
+    // no cold tier.
+
+    int d_coldTierMinAgeSeconds;
+    // Minimum age, in seconds, of a
+    // message for its payload to be
+    // offloaded to the cold tier at
+    // rollover.
+
+    int d_replicationBatchSize;
+    // Number of records batched into one
+    // storage event replicated to the
+    // replicas.  Zero means that the batch
+    // size adapts to the load of the
+    // cluster channels.
+
+    int d_replicationBatchingThreshold;
+    // Number of records replicated since
+    // the oldest message still waiting for
+    // its Receipts beyond which records
+    // are batched, up to the largest
+    // batch, until Receipts arrive.  Zero
+    // means no threshold.  Note that this
+    // does not bound the records in
+    // flight.
+
     bslstl::StringRef d_clusterName;
 
     int d_nodeId;
@@ -411,8 +478,17 @@ class DataStoreConfig {
     DataStoreConfig& setScheduler(bdlmt::EventScheduler* value);
     DataStoreConfig& setPreallocate(bool value);
     DataStoreConfig& setPrefaultPages(bool value);
+    DataStoreConfig& setWriteBackend(mqbcfg::StorageWriteBackend::Value value);
+    DataStoreConfig& setSyncBeforeReceipt(bool value);
+    DataStoreConfig& setGroupCommitMaxDelayMs(int value);
+    DataStoreConfig& setGroupCommitMaxBytes(bsls::Types::Uint64 value);
+    DataStoreConfig& setIndexSnapshotIntervalMs(int value);
     DataStoreConfig& setLocation(const bslstl::StringRef& value);
     DataStoreConfig& setArchiveLocation(const bslstl::StringRef& value);
+    DataStoreConfig& setColdTierLocation(const bslstl::StringRef& value);
+    DataStoreConfig& setColdTierMinAgeSeconds(int value);
+    DataStoreConfig& setReplicationBatchSize(int value);
+    DataStoreConfig& setReplicationBatchingThreshold(int value);
     DataStoreConfig& setClusterName(const bslstl::StringRef& value);
     DataStoreConfig& setNodeId(int value);
     DataStoreConfig& setPartitionId(int value);
@@ -432,8 +508,17 @@ class DataStoreConfig {
     bdlmt::EventScheduler*    scheduler() const;
     bool                      hasPreallocate() const;
     bool                      hasPrefaultPages() const;
+    mqbcfg::StorageWriteBackend::Value writeBackend() const;
+    bool                               hasSyncBeforeReceipt() const;
+    int                                groupCommitMaxDelayMs() const;
+    bsls::Types::Uint64                groupCommitMaxBytes() const;
+    int                                indexSnapshotIntervalMs() const;
     const bslstl::StringRef&  location() const;
     const bslstl::StringRef&  archiveLocation() const;
+    const bslstl::StringRef&  coldTierLocation() const;
+    int                       coldTierMinAgeSeconds() const;
+    int                       replicationBatchSize() const;
+    int                       replicationBatchingThreshold() const;
     const bslstl::StringRef&  clusterName() const;
     int                       nodeId() const;
     int                       partitionId() const;
@@ -756,6 +841,7 @@ inline DataStoreRecord::DataStoreRecord()
 , d_dataOrQlistRecordPaddedLen(0)
 , d_messagePropertiesInfo()
 , d_hasReceipt(true)
+, d_isCold(false)
 , d_arrivalTimepoint(0LL)
 , d_arrivalTimestamp(0LL)
 {
@@ -771,6 +857,7 @@ inline DataStoreRecord::DataStoreRecord(RecordType::Enum    recordType,
 , d_dataOrQlistRecordPaddedLen(0)
 , d_messagePropertiesInfo()
 , d_hasReceipt(true)
+, d_isCold(false)
 , d_arrivalTimepoint(0LL)
 , d_arrivalTimestamp(0LL)
 {
@@ -788,6 +875,7 @@ inline DataStoreRecord::DataStoreRecord(
 , d_dataOrQlistRecordPaddedLen(dataOrQlistRecordPaddedLen)
 , d_messagePropertiesInfo()
 , d_hasReceipt(true)
+, d_isCold(false)
 , d_arrivalTimepoint(0LL)
 , d_arrivalTimestamp(0LL)
 {
@@ -948,6 +1036,38 @@ inline DataStoreConfig& DataStoreConfig::setPrefaultPages(bool value)
     return *this;
 }
 
+inline DataStoreConfig&
+DataStoreConfig::setWriteBackend(mqbcfg::StorageWriteBackend::Value value)
+{
+    d_writeBackend = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setSyncBeforeReceipt(bool value)
+{
+    d_syncBeforeReceipt = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitMaxDelayMs(int value)
+{
+    d_groupCommitMaxDelayMs = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setGroupCommitMaxBytes(bsls::Types::Uint64 value)
+{
+    d_groupCommitMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setIndexSnapshotIntervalMs(int value)
+{
+    d_indexSnapshotIntervalMs = value;
+    return *this;
+}
+
 inline DataStoreConfig&
 DataStoreConfig::setLocation(const bslstl::StringRef& value)
 {
@@ -962,6 +1082,32 @@ DataStoreConfig::setArchiveLocation(const bslstl::StringRef& value)
     return *this;
 }
 
+inline DataStoreConfig&
+DataStoreConfig::setColdTierLocation(const bslstl::StringRef& value)
+{
+    d_coldTierLocation = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setColdTierMinAgeSeconds(int value)
+{
+    d_coldTierMinAgeSeconds = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setReplicationBatchSize(int value)
+{
+    d_replicationBatchSize = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setReplicationBatchingThreshold(int value)
+{
+    d_replicationBatchingThreshold = value;
+    return *this;
+}
+
 inline DataStoreConfig&
 DataStoreConfig::setClusterName(const bslstl::StringRef& value)
 {
@@ -1050,6 +1196,31 @@ inline bool DataStoreConfig::hasPrefaultPages() const
     return d_prefaultPages;
 }
 
+inline mqbcfg::StorageWriteBackend::Value DataStoreConfig::writeBackend() const
+{
+    return d_writeBackend;
+}
+
+inline bool DataStoreConfig::hasSyncBeforeReceipt() const
+{
+    return d_syncBeforeReceipt;
+}
+
+inline int DataStoreConfig::groupCommitMaxDelayMs() const
+{
+    return d_groupCommitMaxDelayMs;
+}
+
+inline bsls::Types::Uint64 DataStoreConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int DataStoreConfig::indexSnapshotIntervalMs() const
+{
+    return d_indexSnapshotIntervalMs;
+}
+
 inline const bslstl::StringRef& DataStoreConfig::location() const
 {
     return d_location;
@@ -1060,6 +1231,26 @@ inline const bslstl::StringRef& DataStoreConfig::archiveLocation() const
     return d_archiveLocation;
 }
 
+inline const bslstl::StringRef& DataStoreConfig::coldTierLocation() const
+{
+    return d_coldTierLocation;
+}
+
+inline int DataStoreConfig::coldTierMinAgeSeconds() const
+{
+    return d_coldTierMinAgeSeconds;
+}
+
+inline int DataStoreConfig::replicationBatchSize() const
+{
+    return d_replicationBatchSize;
+}
+
+inline int DataStoreConfig::replicationBatchingThreshold() const
+{
+    return d_replicationBatchingThreshold;
+}
+
 inline const bslstl::StringRef& DataStoreConfig::clusterName() const
 {
     return d_clusterName;
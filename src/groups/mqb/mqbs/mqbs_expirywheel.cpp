@@ -0,0 +1,163 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_expirywheel.cpp                                               -*-C++-*-
+#include <mqbs_expirywheel.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// -----------------
+// class ExpiryWheel
+// -----------------
+
+// PRIVATE MANIPULATORS
+ExpiryWheel::Node* ExpiryWheel::detach(int index)
+{
+    List& list = d_lists[index];
+    Node* head = list.d_head_p;
+
+    list.d_head_p = 0;
+    list.d_tail_p = 0;
+
+    return head;
+}
+
+void ExpiryWheel::cascade(int level)
+{
+    const int index = level * k_NUM_SLOTS +
+                      static_cast<int>((d_now >> (k_SLOT_BITS * level)) &
+                                       k_SLOT_MASK);
+
+    Node* node = detach(index);
+    while (node) {
+        Node* next = node->d_next_p;
+
+        --d_numScheduled[level];
+        schedule(node);
+
+        node = next;
+    }
+}
+
+void ExpiryWheel::expireCurrentSlot()
+{
+    Node* node = detach(static_cast<int>(d_now & k_SLOT_MASK));
+    while (node) {
+        Node* next = node->d_next_p;
+
+        --d_numScheduled[0];
+        link(node, k_EXPIRED_LIST);
+
+        node = next;
+    }
+}
+
+// CREATORS
+ExpiryWheel::ExpiryWheel(bslma::Allocator* allocator)
+: d_nodePool(sizeof(Node), allocator)
+, d_numExpired(0)
+, d_size(0)
+, d_now(0)
+, d_isStarted(false)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(allocator);
+
+    bsl::memset(d_lists, 0, sizeof(d_lists));
+    bsl::memset(d_numScheduled, 0, sizeof(d_numScheduled));
+}
+
+// MANIPULATORS
+int ExpiryWheel::advance(bsls::Types::Uint64 time)
+{
+    if (!d_isStarted) {
+        // Start the wheel at 'time' and schedule the entries inserted so
+        // far.
+        d_isStarted = true;
+        d_now       = time;
+
+        Node* node = detach(k_PENDING_LIST);
+        while (node) {
+            Node* next = node->d_next_p;
+            schedule(node);
+            node = next;
+        }
+
+        return 0;  // RETURN
+    }
+
+    int numSlots = 0;
+    while (d_now < time) {
+        int level = 0;
+        while (level < k_NUM_LEVELS && d_numScheduled[level] == 0) {
+            ++level;
+        }
+
+        if (level == k_NUM_LEVELS) {
+            // Nothing scheduled.
+            d_now = time;
+            break;  // BREAK
+        }
+
+        if (level > 0) {
+            // Nothing can expire before the next cascade of the lowest
+            // populated level, so skip to it.
+            const bsls::Types::Uint64 period = 1ULL << (k_SLOT_BITS * level);
+            const bsls::Types::Uint64 next   = (d_now + period - 1) &
+                                             ~(period - 1);
+            if (next >= time) {
+                d_now = time;
+                break;  // BREAK
+            }
+            d_now = next;
+        }
+
+        // Cascade the levels whose slot starts at 'd_now', the lower levels
+        // first, then expire the entries at 'd_now'.
+        for (int l = 1; l < k_NUM_LEVELS; ++l) {
+            if ((d_now & ((1ULL << (k_SLOT_BITS * l)) - 1)) != 0) {
+                break;  // BREAK
+            }
+            cascade(l);
+            ++numSlots;
+        }
+
+        expireCurrentSlot();
+        ++numSlots;
+        ++d_now;
+    }
+
+    return numSlots;
+}
+
+void ExpiryWheel::clear()
+{
+    d_nodePool.release();
+
+    bsl::memset(d_lists, 0, sizeof(d_lists));
+    bsl::memset(d_numScheduled, 0, sizeof(d_numScheduled));
+    d_numExpired = 0;
+    d_size       = 0;
+    d_now        = 0;
+    d_isStarted  = false;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
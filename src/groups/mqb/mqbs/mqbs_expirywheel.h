@@ -0,0 +1,405 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_expirywheel.h                                                 -*-C++-*-
+#ifndef INCLUDED_MQBS_EXPIRYWHEEL
+#define INCLUDED_MQBS_EXPIRYWHEEL
+
+//@PURPOSE: Provide a hierarchical timing wheel indexing messages by time.
+//
+//@CLASSES:
+//  mqbs::ExpiryWheel: Hierarchical timing wheel of message GUIDs
+//
+//@DESCRIPTION: 'mqbs::ExpiryWheel' indexes message GUIDs by a time in
+// seconds, so that a storage can find its expired messages without walking
+// its items.  Entries are kept in the slots of a hierarchy of wheels, the
+// first level having one slot per second, and each following level having
+// one slot per revolution of the previous level.  Entries of a higher level
+// slot are redistributed (*cascaded*) to the lower levels when the time of
+// the wheel reaches the start of that slot.  Advancing the wheel to a time
+// moves the entries whose time is before it to the list of expired entries,
+// touching only the slots in between, and skipping the seconds for which no
+// lower level slot can be populated.  Entries can be removed in constant
+// time through the handle returned when they were inserted.
+//
+// The time of the wheel starts at the first call to 'advance' (following
+// construction or 'clear'), entries inserted before then being scheduled at
+// that point.  It never goes back:
+// advancing the wheel to an earlier time has no effect, and an entry
+// inserted with a time before the time of the wheel is immediately
+// expired.  Note that storages index messages by their arrival time and
+// advance the wheel to the current time minus the TTL, so that the index
+// only needs to be rebuilt when the TTL is increased.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+// This section illustrates intended use of this component.
+//..
+//  mqbs::ExpiryWheel wheel(allocator);
+//
+//  mqbs::ExpiryWheel::Handle handle = wheel.insert(guid, arrivalTime);
+//
+//  // Later, on GC.
+//  wheel.advance(now - ttl);
+//  while (wheel.hasExpired()) {
+//      const bmqt::MessageGUID& guid = wheel.firstExpired();
+//
+//      // Remove the message having 'guid', along with its entry, using the
+//      // handle kept with the message.
+//      wheel.remove(items[guid].d_expiryHandle);
+//  }
+//..
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlma_pool.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// =================
+// class ExpiryWheel
+// =================
+
+/// Hierarchical timing wheel of message GUIDs keyed by time in seconds.
+class ExpiryWheel {
+  private:
+    // PRIVATE TYPES
+
+    /// An entry of the wheel.
+    struct Node {
+        Node* d_prev_p;
+        // Previous node in the list
+
+        Node* d_next_p;
+        // Next node in the list
+
+        bmqt::MessageGUID d_guid;
+
+        bsls::Types::Uint64 d_time;
+
+        int d_list;
+        // Index of the list the node belongs to
+    };
+
+    /// A doubly linked list of nodes.
+    struct List {
+        Node* d_head_p;
+
+        Node* d_tail_p;
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        // Each level has 2^k_SLOT_BITS slots, and the wheel spans
+        // 2^(k_SLOT_BITS * k_NUM_LEVELS) seconds (about 194 days).
+        k_SLOT_BITS       = 6,
+        k_NUM_SLOTS       = 1 << k_SLOT_BITS,
+        k_SLOT_MASK       = k_NUM_SLOTS - 1,
+        k_NUM_LEVELS      = 4,
+        k_NUM_WHEEL_LISTS = k_NUM_LEVELS * k_NUM_SLOTS,
+        k_EXPIRED_LIST    = k_NUM_WHEEL_LISTS,
+        k_PENDING_LIST    = k_NUM_WHEEL_LISTS + 1,
+        k_NUM_LISTS       = k_NUM_WHEEL_LISTS + 2
+    };
+
+  public:
+    // TYPES
+
+    /// Handle to an entry of the wheel, valid until the entry is removed.
+    typedef Node* Handle;
+
+  private:
+    // DATA
+    bdlma::Pool d_nodePool;
+    // Owns all nodes
+
+    List d_lists[k_NUM_LISTS];
+    // Slots of each level, followed by the expired
+    // and the pending lists
+
+    bsls::Types::Int64 d_numScheduled[k_NUM_LEVELS];
+    // Number of entries in the slots of each level
+
+    bsls::Types::Int64 d_numExpired;
+    // Number of entries in the expired list
+
+    bsls::Types::Int64 d_size;
+    // Number of entries
+
+    bsls::Types::Uint64 d_now;
+    // Time of the wheel: all entries before it are
+    // expired
+
+    bool d_isStarted;
+    // Whether 'advance' was called
+
+  private:
+    // NOT IMPLEMENTED
+    ExpiryWheel(const ExpiryWheel&);             // = delete
+    ExpiryWheel& operator=(const ExpiryWheel&);  // = delete
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Append the specified `node` to the list having the specified
+    /// `index`.
+    void link(Node* node, int index);
+
+    /// Remove the specified `node` from its list.
+    void unlink(Node* node);
+
+    /// Detach and return the nodes of the list having the specified
+    /// `index`.
+    Node* detach(int index);
+
+    /// Append the specified `node` to the list matching its time.
+    void schedule(Node* node);
+
+    /// Redistribute the entries of the current slot of the specified
+    /// `level` to the lower levels.
+    void cascade(int level);
+
+    /// Move the entries of the current slot of the first level to the
+    /// expired list.
+    void expireCurrentSlot();
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the list an entry having the specified `time`
+    /// belongs to.
+    int listIndex(bsls::Types::Uint64 time) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ExpiryWheel, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty wheel using the specified `allocator`.
+    explicit ExpiryWheel(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Insert an entry for the specified `guid` at the specified `time`
+    /// and return its handle.
+    Handle insert(const bmqt::MessageGUID& guid, bsls::Types::Uint64 time);
+
+    /// Remove the entry having the specified `handle`.  The behavior is
+    /// undefined unless `handle` was returned by `insert` and not removed
+    /// since.
+    void remove(Handle handle);
+
+    /// Advance the time of the wheel to the specified `time`, expiring all
+    /// entries before it, and return the number of slots visited.  Do
+    /// nothing if `time` is before the time of the wheel.
+    int advance(bsls::Types::Uint64 time);
+
+    /// Remove all entries, and reset the time of the wheel so that it
+    /// starts again at the next call to `advance`.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return `true` if there are expired entries, and `false` otherwise.
+    bool hasExpired() const;
+
+    /// Return the GUID of the first expired entry.  The behavior is
+    /// undefined unless `hasExpired()`.
+    const bmqt::MessageGUID& firstExpired() const;
+
+    /// Return the time of the first expired entry.  The behavior is
+    /// undefined unless `hasExpired()`.
+    bsls::Types::Uint64 firstExpiredTime() const;
+
+    /// Return the number of expired entries.
+    bsls::Types::Int64 numExpired() const;
+
+    /// Return the number of entries.
+    bsls::Types::Int64 size() const;
+
+    /// Return the time of the wheel.
+    bsls::Types::Uint64 now() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------
+// class ExpiryWheel
+// -----------------
+
+// PRIVATE MANIPULATORS
+inline void ExpiryWheel::link(Node* node, int index)
+{
+    List& list = d_lists[index];
+
+    node->d_list   = index;
+    node->d_next_p = 0;
+    node->d_prev_p = list.d_tail_p;
+    if (list.d_tail_p) {
+        list.d_tail_p->d_next_p = node;
+    }
+    else {
+        list.d_head_p = node;
+    }
+    list.d_tail_p = node;
+
+    if (index < k_NUM_WHEEL_LISTS) {
+        ++d_numScheduled[index / k_NUM_SLOTS];
+    }
+    else if (index == k_EXPIRED_LIST) {
+        ++d_numExpired;
+    }
+}
+
+inline void ExpiryWheel::unlink(Node* node)
+{
+    List& list = d_lists[node->d_list];
+
+    if (node->d_prev_p) {
+        node->d_prev_p->d_next_p = node->d_next_p;
+    }
+    else {
+        list.d_head_p = node->d_next_p;
+    }
+    if (node->d_next_p) {
+        node->d_next_p->d_prev_p = node->d_prev_p;
+    }
+    else {
+        list.d_tail_p = node->d_prev_p;
+    }
+
+    if (node->d_list < k_NUM_WHEEL_LISTS) {
+        --d_numScheduled[node->d_list / k_NUM_SLOTS];
+    }
+    else if (node->d_list == k_EXPIRED_LIST) {
+        --d_numExpired;
+    }
+}
+
+inline void ExpiryWheel::schedule(Node* node)
+{
+    link(node, listIndex(node->d_time));
+}
+
+// PRIVATE ACCESSORS
+inline int ExpiryWheel::listIndex(bsls::Types::Uint64 time) const
+{
+    if (!d_isStarted) {
+        return k_PENDING_LIST;  // RETURN
+    }
+
+    if (time < d_now) {
+        return k_EXPIRED_LIST;  // RETURN
+    }
+
+    const bsls::Types::Uint64 k_RANGE = 1ULL
+                                        << (k_SLOT_BITS * k_NUM_LEVELS);
+
+    bsls::Types::Uint64 delta = time - d_now;
+    if (delta >= k_RANGE) {
+        // Park the entry in the last slot of the wheel; it is rescheduled
+        // when that slot is cascaded.
+        delta = k_RANGE - 1;
+        time  = d_now + delta;
+    }
+
+    int level = 0;
+    while (delta >= (1ULL << (k_SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+
+    return level * k_NUM_SLOTS +
+           static_cast<int>((time >> (k_SLOT_BITS * level)) & k_SLOT_MASK);
+}
+
+// MANIPULATORS
+inline ExpiryWheel::Handle ExpiryWheel::insert(const bmqt::MessageGUID& guid,
+                                               bsls::Types::Uint64      time)
+{
+    Node* node   = static_cast<Node*>(d_nodePool.allocate());
+    node->d_guid = guid;
+    node->d_time = time;
+
+    schedule(node);
+    ++d_size;
+
+    return node;
+}
+
+inline void ExpiryWheel::remove(Handle handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(handle);
+
+    unlink(handle);
+    d_nodePool.deallocate(handle);
+    --d_size;
+}
+
+// ACCESSORS
+inline bool ExpiryWheel::hasExpired() const
+{
+    return d_lists[k_EXPIRED_LIST].d_head_p != 0;
+}
+
+inline const bmqt::MessageGUID& ExpiryWheel::firstExpired() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(hasExpired());
+
+    return d_lists[k_EXPIRED_LIST].d_head_p->d_guid;
+}
+
+inline bsls::Types::Uint64 ExpiryWheel::firstExpiredTime() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(hasExpired());
+
+    return d_lists[k_EXPIRED_LIST].d_head_p->d_time;
+}
+
+inline bsls::Types::Int64 ExpiryWheel::numExpired() const
+{
+    return d_numExpired;
+}
+
+inline bsls::Types::Int64 ExpiryWheel::size() const
+{
+    return d_size;
+}
+
+inline bsls::Types::Uint64 ExpiryWheel::now() const
+{
+    return d_now;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,264 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_expirywheel.t.cpp                                             -*-C++-*-
+#include <mqbs_expirywheel.h>
+
+// MQB
+#include <mqbu_messageguidutil.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_cstdlib.h>
+#include <bsl_vector.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// An entry inserted in the wheel by the tests.
+struct Entry {
+    bmqt::MessageGUID d_guid;
+
+    bsls::Types::Uint64 d_time;
+
+    mqbs::ExpiryWheel::Handle d_handle;
+
+    bool d_isRemoved;
+};
+
+/// Insert into the specified `wheel` an entry at the specified `time`, and
+/// append it to the specified `entries`.
+void insert(bsl::vector<Entry>* entries,
+            mqbs::ExpiryWheel*  wheel,
+            bsls::Types::Uint64 time)
+{
+    Entry entry;
+    mqbu::MessageGUIDUtil::generateGUID(&entry.d_guid);
+    entry.d_time      = time;
+    entry.d_handle    = wheel->insert(entry.d_guid, time);
+    entry.d_isRemoved = false;
+
+    entries->push_back(entry);
+}
+
+/// Remove from the specified `wheel` all its expired entries, marking them
+/// as removed in the specified `entries`, and return their number.  Verify
+/// that each of them is before the time of `wheel`.
+int removeExpired(bsl::vector<Entry>* entries, mqbs::ExpiryWheel* wheel)
+{
+    int numRemoved = 0;
+    while (wheel->hasExpired()) {
+        ASSERT(wheel->firstExpiredTime() < wheel->now());
+
+        for (size_t i = 0; i < entries->size(); ++i) {
+            Entry& entry = (*entries)[i];
+            if (!entry.d_isRemoved && entry.d_guid == wheel->firstExpired()) {
+                wheel->remove(entry.d_handle);
+                entry.d_isRemoved = true;
+                ++numRemoved;
+                break;  // BREAK
+            }
+        }
+    }
+
+    return numRemoved;
+}
+
+/// Return the number of entries in the specified `entries` which are not
+/// removed and are before the specified `time`.
+int numBefore(const bsl::vector<Entry>& entries, bsls::Types::Uint64 time)
+{
+    int result = 0;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].d_isRemoved && entries[i].d_time < time) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   1. Insert entries before starting the wheel, start it and verify the
+//      entries before the start are expired.
+//   2. Advance the wheel and verify the entries expire when the time of the
+//      wheel passes theirs.
+//   3. Remove an entry before it expires.
+//
+// Testing:
+//   Basic functionality
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbs::ExpiryWheel  wheel(s_allocator_p);
+    bsl::vector<Entry> entries(s_allocator_p);
+
+    insert(&entries, &wheel, 90);
+    insert(&entries, &wheel, 110);
+    insert(&entries, &wheel, 120);
+    insert(&entries, &wheel, 120);
+    ASSERT_EQ(wheel.size(), 4);
+    ASSERT(!wheel.hasExpired());
+
+    // Start the wheel.
+    wheel.advance(100);
+    ASSERT_EQ(wheel.now(), 100U);
+    ASSERT_EQ(wheel.numExpired(), 1);
+    ASSERT_EQ(wheel.firstExpiredTime(), 90U);
+    ASSERT_EQ(removeExpired(&entries, &wheel), 1);
+
+    // Going back has no effect.
+    wheel.advance(50);
+    ASSERT_EQ(wheel.now(), 100U);
+
+    wheel.advance(110);
+    ASSERT(!wheel.hasExpired());
+
+    wheel.advance(111);
+    ASSERT_EQ(wheel.numExpired(), 1);
+    ASSERT_EQ(wheel.firstExpiredTime(), 110U);
+    ASSERT_EQ(removeExpired(&entries, &wheel), 1);
+
+    // Remove one of the two entries at 120 before it expires.
+    wheel.remove(entries[3].d_handle);
+    entries[3].d_isRemoved = true;
+
+    wheel.advance(1000);
+    ASSERT_EQ(removeExpired(&entries, &wheel), 1);
+    ASSERT_EQ(wheel.size(), 0);
+
+    // An entry before the time of the wheel is expired immediately.
+    insert(&entries, &wheel, 999);
+    ASSERT(wheel.hasExpired());
+
+    wheel.clear();
+    ASSERT_EQ(wheel.size(), 0);
+    ASSERT(!wheel.hasExpired());
+}
+
+static void test2_cascade()
+// ------------------------------------------------------------------------
+// CASCADE
+//
+// Concerns:
+//   Entries in any level of the wheel, including those beyond its span,
+//   expire exactly when the time of the wheel passes theirs, and advancing
+//   the wheel over a large interval visits few slots.
+//
+// Plan:
+//   1. Insert entries at random times spanning all levels and beyond, and
+//      advance the wheel by random steps, verifying after each step that
+//      the expired entries are exactly those before the time of the wheel.
+//   2. Advance an almost empty wheel over a large interval and verify the
+//      number of visited slots.
+//
+// Testing:
+//   advance
+{
+    mwctst::TestHelper::printTestName("CASCADE");
+
+    bsl::srand(42);
+
+    const bsls::Types::Uint64 k_START = 1700000000ULL;
+
+    mqbs::ExpiryWheel  wheel(s_allocator_p);
+    bsl::vector<Entry> entries(s_allocator_p);
+
+    wheel.advance(k_START);
+
+    const bsls::Types::Uint64 k_SPANS[] = {10ULL,
+                                           1000ULL,
+                                           100000ULL,
+                                           10000000ULL,
+                                           100000000ULL};
+    const int k_NUM_SPANS = sizeof(k_SPANS) / sizeof(*k_SPANS);
+
+    for (int i = 0; i < 500; ++i) {
+        const bsls::Types::Uint64 span = k_SPANS[i % k_NUM_SPANS];
+        insert(&entries,
+               &wheel,
+               k_START + static_cast<bsls::Types::Uint64>(bsl::rand()) % span);
+    }
+
+    bsls::Types::Uint64 now = k_START;
+    while (wheel.size() != 0) {
+        const bsls::Types::Uint64 step =
+            k_SPANS[bsl::rand() % k_NUM_SPANS] / 10 +
+            static_cast<bsls::Types::Uint64>(bsl::rand()) % 7;
+        now += step;
+
+        const int expected = numBefore(entries, now);
+        wheel.advance(now);
+        ASSERT_EQ(wheel.now(), now);
+        ASSERT_EQ(wheel.numExpired(), expected);
+        ASSERT_EQ(removeExpired(&entries, &wheel), expected);
+    }
+
+    // A single entry a day from now.
+    const bsls::Types::Uint64 k_DAY = 86400;
+    insert(&entries, &wheel, now + k_DAY);
+
+    const int numSlots = wheel.advance(now + k_DAY + 1);
+    PV("Visited " << numSlots << " slots");
+    ASSERT_LT(numSlots, 4 * 64);
+    ASSERT_EQ(removeExpired(&entries, &wheel), 1);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mqbu::MessageGUIDUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_cascade(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
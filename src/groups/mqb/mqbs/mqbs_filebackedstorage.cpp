@@ -86,6 +86,7 @@ void FileBackedStorage::purgeCommon(const mqbu::StorageKey& appKey)
         }
 
         d_handles.clear();
+        d_expiryWheel.clear();
 
         // Update stats
         d_capacityMeter.clear();
@@ -98,6 +99,58 @@ void FileBackedStorage::purgeCommon(const mqbu::StorageKey& appKey)
     }
 }
 
+int FileBackedStorage::gcMessage(RecordHandleMapIter      it,
+                                 DeletionRecordFlag::Enum deletionFlag,
+                                 bsls::Types::Uint64      secondsFromEpoch,
+                                 bsls::Types::Int64       now)
+{
+    const RecordHandlesArray& handles = it->second.d_array;
+    BSLS_ASSERT_SAFE(!handles.empty());
+
+    int msgLen = static_cast<int>(d_store_p->getMessageLenRaw(handles[0]));
+    int rc     = d_store_p->writeDeletionRecord(it->first,
+                                            d_queueKey,
+                                            deletionFlag,
+                                            secondsFromEpoch);
+    if (0 != rc) {
+        MWCTSK_ALARMLOG_ALARM("FILE_IO")
+            << "PartitionId [" << partitionId() << "]"
+            << " failed to write DELETION record for "
+            << "GUID: " << it->first << ", for queue '" << d_queueUri
+            << "', queueKey '" << d_queueKey << "' while attempting to GC "
+            << "the message due to TTL/ACK expiration, rc: " << rc
+            << MWCTSK_ALARMLOG_END;
+        return rc;  // RETURN
+    }
+
+    // If a queue is associated, inform it about the message being deleted,
+    // and update queue stats.
+
+    // The same 'e_DEL_MESSAGE' is about 3 cases: TTL, no SC quorum, purge.
+    if (d_queue_p) {
+        d_queue_p->queueEngine()->beforeMessageRemoved(it->first);
+        d_queue_p->stats()->onEvent(
+            mqbstat::QueueStatsDomain::EventType::e_DEL_MESSAGE,
+            msgLen);
+    }
+
+    // Remove message from all virtual storages.
+    d_virtualStorageCatalog.remove(it->first, mqbu::StorageKey::k_NULL_KEY);
+
+    // Delete all items pointed by all handles for this GUID (i.e., delete
+    // message from the underlying storage).
+
+    for (unsigned int i = 0; i < handles.size(); ++i) {
+        d_store_p->removeRecordRaw(handles[i]);
+    }
+
+    d_capacityMeter.remove(1, msgLen);
+    d_expiryWheel.remove(it->second.d_expiryHandle);
+    d_handles.erase(it, now);
+
+    return 0;
+}
+
 // CREATORS
 FileBackedStorage::FileBackedStorage(
     DataStore*                     dataStore,
@@ -125,6 +178,8 @@ FileBackedStorage::FileBackedStorage(
                 .addMilliseconds(config.deduplicationTimeMs())
                 .totalNanoseconds(),
             allocatorStore ? allocatorStore->get("Handles") : d_allocator_p)
+, d_expiryWheel(allocatorStore ? allocatorStore->get("Handles")
+                               : d_allocator_p)
 , d_queueOpRecordHandles(allocator)
 , d_emptyAppId(allocator)
 , d_nullAppKey()
@@ -241,6 +296,18 @@ int FileBackedStorage::configure(
     d_capacityMeter.setLimits(limits.messages(), limits.bytes())
         .setWatermarkThresholds(limits.messagesWatermarkRatio(),
                                 limits.bytesWatermarkRatio());
+
+    if (messageTtl > d_ttlSeconds) {
+        // The expiry wheel may have been advanced past the arrival time of
+        // messages which have not expired with the new TTL, so reindex them.
+        d_expiryWheel.clear();
+        for (RecordHandleMapIter it = d_handles.begin(); it != d_handles.end();
+             ++it) {
+            it->second.d_expiryHandle = d_expiryWheel.insert(
+                it->first,
+                it->second.d_array[0].timestamp());
+        }
+    }
     d_ttlSeconds = messageTtl;
 
     if (maxDeliveryAttempts > 0) {
@@ -331,7 +398,10 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
                                         attributes->arrivalTimepoint());
 
         irc.first->second.d_array.push_back(handle);
-        irc.first->second.d_refCount = attributes->refCount();
+        irc.first->second.d_refCount     = attributes->refCount();
+        irc.first->second.d_expiryHandle = d_expiryWheel.insert(
+            msgGUID,
+            attributes->arrivalTimestamp());
 
         // Looks like extra lookup in
         // VirtualStorageIterator::loadMessageAndAttributes() can be avoided
@@ -492,6 +562,7 @@ FileBackedStorage::remove(const bmqt::MessageGUID& msgGUID,
 
     // Erase entry from 'd_handles' now that all records for the GUID have been
     // deleted.
+    d_expiryWheel.remove(it->second.d_expiryHandle);
     d_handles.erase(it);
 
     // Update stats
@@ -627,6 +698,7 @@ FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
             }
 
             d_capacityMeter.remove(1, msgLen);
+            d_expiryWheel.remove(it->second.d_expiryHandle);
             d_handles.erase(it);
         }
 
@@ -669,84 +741,67 @@ int FileBackedStorage::gcExpiredMessages(
                         bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND
                   : 0;
 
-    for (RecordHandleMapIter next = d_handles.begin(), cit;
-         next != d_handles.end() && --limit;) {
-        cit = next++;
+    // Messages arrived before 'secondsFromEpoch - d_ttlSeconds' have
+    // expired.  The expiry wheel yields them without walking the handles.
+    if (secondsFromEpoch > static_cast<bsls::Types::Uint64>(d_ttlSeconds)) {
+        d_expiryWheel.advance(secondsFromEpoch - d_ttlSeconds);
+    }
 
-        const RecordHandlesArray& handles = cit->second.d_array;
-        BSLS_ASSERT_SAFE(!handles.empty());
+    int rc = 0;
+    while (--limit > 0 && d_expiryWheel.hasExpired()) {
+        RecordHandleMapIter it = d_handles.find(d_expiryWheel.firstExpired());
+        BSLS_ASSERT_SAFE(it != d_handles.end());
 
-        const DataStoreRecordHandle& handle       = handles[0];
-        DeletionRecordFlag::Enum     deletionFlag = DeletionRecordFlag::e_NONE;
+        const DataStoreRecordHandle& handle = it->second.d_array[0];
 
         *latestMsgTimestampEpoch = handle.timestamp();
         if ((secondsFromEpoch - handle.timestamp()) <=
             static_cast<bsls::Types::Uint64>(d_ttlSeconds)) {
-            // Current message hasn't expired and subsequent messages are only
-            // "younger" (have a larger timestamp), so we can check if the SC
-            // waiting for Receipts has exceeded the deduplicationTimeNs.
-
-            // Expire if we have no quorum Receipts for longer time than
-            // deduplicationTimeUs
-            if (handle.hasReceipt() || deduplicationTimeNs == 0 ||
-                (handle.timepoint() + deduplicationTimeNs) > now) {
-                break;  // BREAK
-            }
-            ++numMsgsUnreceipted;
-            deletionFlag = DeletionRecordFlag::e_NO_SC_QUORUM;
-            // else do the same as for TTL expiration including calling
-            // 'FileStore::removeRecordRaw' which will NACK if this is
-            // unReceipted GUID
-        }
-        else {
-            deletionFlag = DeletionRecordFlag::e_TTL_EXPIRATION;
+            // The clock went back.
+            break;  // BREAK
         }
 
-        int msgLen = static_cast<int>(d_store_p->getMessageLenRaw(handles[0]));
-        int rc     = d_store_p->writeDeletionRecord(cit->first,
-                                                d_queueKey,
-                                                deletionFlag,
-                                                secondsFromEpoch);
+        rc = gcMessage(it,
+                       DeletionRecordFlag::e_TTL_EXPIRATION,
+                       secondsFromEpoch,
+                       now);
         if (0 != rc) {
-            MWCTSK_ALARMLOG_ALARM("FILE_IO")
-                << "PartitionId [" << partitionId() << "]"
-                << " failed to write DELETION record for "
-                << "GUID: " << cit->first << ", for queue '" << d_queueUri
-                << "', queueKey '" << d_queueKey << "' while attempting to GC "
-                << "the message due to TTL/ACK expiration, rc: " << rc
-                << MWCTSK_ALARMLOG_END;
             // Do NOT remove the expired record without replicating Deletion.
-            return numMsgsDeleted;  // RETURN
-        }
-
-        // If a queue is associated, inform it about the message being deleted,
-        // and update queue stats.
-
-        // The same 'e_DEL_MESSAGE' is about 3 cases: TTL, no SC quorum, purge.
-        if (d_queue_p) {
-            d_queue_p->queueEngine()->beforeMessageRemoved(cit->first);
-            d_queue_p->stats()->onEvent(
-                mqbstat::QueueStatsDomain::EventType::e_DEL_MESSAGE,
-                msgLen);
+            break;  // BREAK
         }
+        ++numMsgsDeleted;
+    }
 
-        // Remove message from all virtual storages.
-        d_virtualStorageCatalog.remove(cit->first,
-                                       mqbu::StorageKey::k_NULL_KEY);
+    // Expire the oldest messages which have not received quorum Receipts for
+    // longer than 'deduplicationTimeNs'.  Subsequent messages are only
+    // "younger", so stop at the first one which has a Receipt or is recent
+    // enough.
+    for (RecordHandleMapIter next = d_handles.begin(), cit;
+         0 == rc && next != d_handles.end() && --limit > 0;) {
+        cit = next++;
 
-        // Delete all items pointed by all handles for this GUID (i.e., delete
-        // message from the underlying storage).
+        const DataStoreRecordHandle& handle = cit->second.d_array[0];
 
-        for (unsigned int i = 0; i < handles.size(); ++i) {
-            d_store_p->removeRecordRaw(handles[i]);
+        *latestMsgTimestampEpoch = handle.timestamp();
+        if (handle.hasReceipt() || deduplicationTimeNs == 0 ||
+            (handle.timepoint() + deduplicationTimeNs) > now) {
+            break;  // BREAK
         }
 
-        d_capacityMeter.remove(1, msgLen);
-        d_handles.erase(cit, now);
-        ++numMsgsDeleted;
+        // Do the same as for TTL expiration including calling
+        // 'FileStore::removeRecordRaw' which will NACK if this is unReceipted
+        // GUID.
+        rc = gcMessage(cit,
+                       DeletionRecordFlag::e_NO_SC_QUORUM,
+                       secondsFromEpoch,
+                       now);
+        if (0 == rc) {
+            ++numMsgsDeleted;
+            ++numMsgsUnreceipted;
+        }
     }
 
-    if (d_queue_p && numMsgsDeleted > 0) {
+    if (d_queue_p) {
         if (numMsgsDeleted > numMsgsUnreceipted) {
             d_queue_p->stats()->onEvent(
                 mqbstat::QueueStatsDomain::EventType::e_GC_MESSAGE,
@@ -757,6 +812,9 @@ int FileBackedStorage::gcExpiredMessages(
                 mqbstat::QueueStatsDomain::EventType::e_NO_SC_MESSAGE,
                 numMsgsUnreceipted);
         }
+        d_queue_p->stats()->onEvent(
+            mqbstat::QueueStatsDomain::EventType::e_GC_TIME,
+            mwcsys::Time::highResolutionTimer() - now);
     }
 
     if (d_handles.empty()) {
@@ -786,7 +844,10 @@ void FileBackedStorage::processMessageRecord(
         InsertRc irc = d_handles.insert(bsl::make_pair(guid, Item()),
                                         mwcsys::Time::highResolutionTimer());
         irc.first->second.d_array.push_back(handle);
-        irc.first->second.d_refCount = refCount;
+        irc.first->second.d_refCount     = refCount;
+        irc.first->second.d_expiryHandle = d_expiryWheel.insert(
+            guid,
+            handle.timestamp());
 
         // Add 'guid' to all virtual storages, if any.
         d_virtualStorageCatalog.put(guid,
@@ -925,6 +986,7 @@ void FileBackedStorage::processDeletionRecord(const bmqt::MessageGUID& guid)
     // Finally erase entry from 'd_handles' now that all records for the GUID
     // have been deleted.
 
+    d_expiryWheel.remove(it->second.d_expiryHandle);
     d_handles.erase(it);
 
     if (d_handles.empty()) {
@@ -32,6 +32,7 @@
 #include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
 #include <mqbs_datastore.h>
+#include <mqbs_expirywheel.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_virtualstoragecatalog.h>
@@ -107,8 +108,9 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
         RecordHandlesArray;
 
     struct Item {
-        RecordHandlesArray d_array;
-        unsigned int       d_refCount;  // Outstanding reference count
+        RecordHandlesArray  d_array;
+        unsigned int        d_refCount;  // Outstanding reference count
+        ExpiryWheel::Handle d_expiryHandle;
 
         void reset();
     };
@@ -170,6 +172,10 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // First handle in this vector *always*
     // points to the message record.
 
+    ExpiryWheel d_expiryWheel;
+    // Index of the messages by arrival
+    // timestamp, used to find the expired ones.
+
     RecordHandles d_queueOpRecordHandles;
     // List of handles to all QueueOpRecord
     // events associated with queue of this
@@ -216,6 +222,17 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // PRIVATE MANIPULATORS
     void purgeCommon(const mqbu::StorageKey& appKey);
 
+    /// Delete the message at the specified `it` for the reason indicated by
+    /// the specified `deletionFlag`, writing a deletion record having the
+    /// specified `secondsFromEpoch` timestamp and erasing it from the
+    /// history at the specified `now` high resolution time.  Return 0 on
+    /// success, and a non-zero value, leaving the message untouched, if the
+    /// deletion record could not be written.
+    int gcMessage(RecordHandleMapIter      it,
+                  DeletionRecordFlag::Enum deletionFlag,
+                  bsls::Types::Uint64      secondsFromEpoch,
+                  bsls::Types::Int64       now);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileBackedStorage,
@@ -625,7 +642,8 @@ class FileBackedStorageIterator : public mqbi::StorageIterator {
 inline void FileBackedStorage::Item::reset()
 {
     d_array.clear();
-    d_refCount = 0;
+    d_refCount     = 0;
+    d_expiryHandle = 0;
 }
 
 // -----------------
@@ -66,24 +66,58 @@ struct FileSet BSLS_CPP11_FINAL {
 
     MappedFileDescriptor d_qlistFile;
 
+    MappedFileDescriptor d_coldFile;
+    // Cold tier data file holding the
+    // payloads offloaded from the DATA
+    // file at rollover.  Not mapped if
+    // the cold tier is disabled.
+
     bsls::Types::Uint64 d_dataFilePosition;
 
     bsls::Types::Uint64 d_journalFilePosition;
 
     bsls::Types::Uint64 d_qlistFilePosition;
 
+    bsls::Types::Uint64 d_coldFilePosition;
+
+    bsls::Types::Uint64 d_coldFileReadAheadPosition;
+    // Position in the cold file up to
+    // which read-ahead has been requested
+    // from the kernel.
+
+    bsls::Types::Uint64 d_dataFileWritebackPosition;
+    // Position in the data file up to
+    // which write back to disk has been
+    // initiated.  Only maintained when
+    // the 'E_ASYNC_WRITEBACK' write
+    // backend is in use.
+
+    bsls::Types::Uint64 d_journalFileWritebackPosition;
+    // Position in the journal file up to
+    // which write back to disk has been
+    // initiated.
+
+    bsls::Types::Uint64 d_qlistFileWritebackPosition;
+    // Position in the qlist file up to
+    // which write back to disk has been
+    // initiated.
+
     bsl::string d_dataFileName;
 
     bsl::string d_journalFileName;
 
     bsl::string d_qlistFileName;
 
+    bsl::string d_coldFileName;
+
     bsls::Types::Uint64 d_outstandingBytesJournal;
 
     bsls::Types::Uint64 d_outstandingBytesData;
 
     bsls::Types::Uint64 d_outstandingBytesQlist;
 
+    bsls::Types::Uint64 d_outstandingBytesCold;
+
     bool d_journalFileAvailable;
 
     bool d_fileSetRolloverPolicyAlarm;
@@ -125,15 +159,23 @@ inline FileSet::FileSet(FileStore* store, bslma::Allocator* allocator)
 , d_dataFile()
 , d_journalFile()
 , d_qlistFile()
+, d_coldFile()
 , d_dataFilePosition(0)
 , d_journalFilePosition(0)
 , d_qlistFilePosition(0)
+, d_coldFilePosition(0)
+, d_coldFileReadAheadPosition(0)
+, d_dataFileWritebackPosition(0)
+, d_journalFileWritebackPosition(0)
+, d_qlistFileWritebackPosition(0)
 , d_dataFileName(allocator)
 , d_journalFileName(allocator)
 , d_qlistFileName(allocator)
+, d_coldFileName(allocator)
 , d_outstandingBytesJournal(0)
 , d_outstandingBytesData(0)
 , d_outstandingBytesQlist(0)
+, d_outstandingBytesCold(0)
 , d_journalFileAvailable(true)
 , d_fileSetRolloverPolicyAlarm(false)
 , d_aliasedBlobBufferCount(1)  // See note below explaining value of '1'
@@ -30,6 +30,7 @@
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoreutil.h>
 #include <mqbs_filesystemutil.h>
+#include <mqbs_indexsnapshotutil.h>
 #include <mqbs_inmemorystorage.h>
 #include <mqbs_journalfileiterator.h>
 #include <mqbs_memoryblock.h>
@@ -50,6 +51,7 @@
 
 // MWC
 #include <mwcsys_statmonitorsnapshotrecorder.h>
+#include <mwcsys_threadutil.h>
 #include <mwcsys_time.h>
 #include <mwctsk_alarmlog.h>
 #include <mwcu_blobobjectproxy.h>
@@ -80,10 +82,12 @@
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
 #include <bslim_printer.h>
+#include <bslmt_latch.h>
 #include <bsls_annotation.h>
 #include <bsls_timeinterval.h>
 
 // SYS
+#include <sys/mman.h>
 #include <unistd.h>
 
 namespace BloombergLP {
@@ -104,6 +108,47 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Minimum number of dirty bytes in the active file set to initiate an
+/// asynchronous write back when the 'E_ASYNC_WRITEBACK' write backend is in
+/// use (unless records are pending durable sync, or the partition is idle).
+const bsls::Types::Uint64 k_WRITEBACK_MIN_BYTES = 1024 * 1024;
+
+/// Capacity of the queue of the write back thread.  Note that at most one
+/// write back job is in flight at any time.
+const int k_WRITEBACK_MAX_PENDING_JOBS = 16;
+
+/// Number of recovered messages whose payload CRC32-C is validated by a
+/// single job during recovery.
+const size_t k_RECOVERY_CRC_CHUNK_SIZE = 4096;
+
+/// Maximum number of threads, in addition to the partition thread,
+/// validating the CRC32-C of recovered messages.
+const int k_RECOVERY_CRC_MAX_THREADS = 4;
+
+/// Maximum percentage of the DATA file size that outstanding payloads may
+/// occupy in the DATA file of a newly rolled over file set when the cold
+/// tier is enabled.  Oldest payloads in excess of this ratio are offloaded
+/// to the cold tier data file at rollover.
+const bsls::Types::Uint64 k_COLD_TIER_MAX_HOT_DATA_PERCENT = 50;
+
+/// Number of bytes of the cold tier data file for which read-ahead is
+/// requested from the kernel when a message beyond the current read-ahead
+/// window is read.
+const bsls::Types::Uint64 k_COLD_TIER_READ_AHEAD_BYTES = 1024 * 1024;
+
+/// Minimum number of outstanding bytes in the DATA file of the active file
+/// set for the payloads carried over by a rollover to be copied by a worker
+/// thread instead of the partition thread.
+const bsls::Types::Uint64 k_ROLLOVER_COPY_MIN_BYTES = 16 * 1024 * 1024;
+
+/// Maximum number of bytes copied, and written back, by the worker thread
+/// between two updates of the copy watermark.
+const bsls::Types::Uint64 k_ROLLOVER_COPY_CHUNK_BYTES = 4 * 1024 * 1024;
+
+/// Maximum number of outstanding records copied into a snapshot of the
+/// in-memory index by the partition thread in a single dispatcher event.
+const size_t k_INDEX_SNAPSHOT_BATCH_SIZE = 10000;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 const unsigned int k_REQUESTED_JOURNAL_SPACE =
@@ -253,6 +298,47 @@ void noOp()
     // NOTHING
 }
 
+/// Append to the specified `records` an entry for the specified `record`
+/// having the specified `key`, with only the fields of `record` which are
+/// populated by the recovery and not read from the JOURNAL file.
+void copyIndexSnapshotRecord(IndexSnapshot::Records*   records,
+                             const DataStoreRecordKey& key,
+                             const DataStoreRecord&    record)
+{
+    records->resize(records->size() + 1);
+    IndexSnapshot::Record& entry = records->back();
+    entry.d_key                  = key;
+
+    entry.d_record.d_recordType   = record.d_recordType;
+    entry.d_record.d_recordOffset = record.d_recordOffset;
+    entry.d_record.d_dataOrQlistRecordPaddedLen =
+        record.d_dataOrQlistRecordPaddedLen;
+
+    if (RecordType::e_MESSAGE == record.d_recordType) {
+        entry.d_record.d_messageOffset      = record.d_messageOffset;
+        entry.d_record.d_appDataUnpaddedLen = record.d_appDataUnpaddedLen;
+        entry.d_record.d_messagePropertiesInfo =
+            record.d_messagePropertiesInfo;
+        entry.d_record.d_isCold = record.d_isCold;
+    }
+}
+
+/// Return true if the specified `lhs` precedes the specified `rhs` in the
+/// journal, and false otherwise.
+bool isIndexSnapshotRecordLess(const IndexSnapshot::Record& lhs,
+                               const IndexSnapshot::Record& rhs)
+{
+    return lhs.d_key < rhs.d_key;
+}
+
+/// Return true if the specified `lhs` does not precede the specified `rhs`
+/// in the journal, and false otherwise.
+bool isIndexSnapshotRecordNotLess(const IndexSnapshot::Record& lhs,
+                                  const IndexSnapshot::Record& rhs)
+{
+    return !isIndexSnapshotRecordLess(lhs, rhs);
+}
+
 }  // close unnamed namespace
 
 // -------------------------------------
@@ -343,11 +429,17 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         rc_CONFIGURATION_ERROR                 = -7,
         rc_PARTITION_FULL                      = -8,
         rc_OPEN_FAILURE                        = -9,
-        rc_SYNC_POINT_FAILURE                  = -10
+        rc_SYNC_POINT_FAILURE                  = -10,
+        rc_COLD_FILE_OPEN_FAILURE              = -11
     };
 
     const bool needQList = !d_isFSMWorkflow;
 
+    // Start a StatMonitorSnapshotRecorder to track the time spent in each
+    // step of the recovery.
+    mwcsys::StatMonitorSnapshotRecorder statRecorder(partitionDesc(),
+                                                     d_allocator_p);
+
     MappedFileDescriptor journalFd;
     MappedFileDescriptor dataFd;
     MappedFileDescriptor qlistFd;
@@ -722,6 +814,11 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
     BALL_LOG_INFO << partitionDesc() << "Retrieved primaryLeaseId and sequence"
                   << " number: (" << d_primaryLeaseId << ", " << d_sequenceNum
                   << ")";
+    BALL_LOG_INFO_BLOCK
+    {
+        statRecorder.print(BALL_LOG_OUTPUT_STREAM,
+                           "RECOVERY - STEP 1 (OPEN FILE SET)");
+    }
 
     // Create file set.
     FileSetSp fileSetSp;
@@ -764,6 +861,18 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
                                               bmqp::Protocol::k_WORD_SIZE;
     }
 
+    // Payloads offloaded to the cold tier at the last rollover are recovered
+    // from the cold tier data file of the file set.
+
+    rc = openColdFile(fileSetSp.get());
+    if (0 != rc) {
+        return 100 * rc + rc_COLD_FILE_OPEN_FAILURE;  // RETURN
+    }
+    if (fileSetSp->d_coldFile.isValid()) {
+        fileSetSp->d_outstandingBytesCold +=
+            FileStoreUtil::coldFileHeaderSize();
+    }
+
     // Offsets where files should be written from (in other words, the offset
     // of the *end* of last valid record in each file).
 
@@ -780,6 +889,20 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
     bsls::Types::Uint64 qlistFileOffset   = 0;
     bsls::Types::Uint64 dataFileOffset    = 0;
 
+    // Load the index snapshot of the file set, if any, so that only the
+    // records appended to the journal after it was taken are replayed.
+
+    IndexSnapshot  indexSnapshot(d_allocator_p);
+    IndexSnapshot* indexSnapshot_p = 0;
+    if (0 != d_indexSnapshotIntervalNs &&
+        0 == loadIndexSnapshot(&indexSnapshot,
+                               recoveryFileSet,
+                               journalFd,
+                               dataFd,
+                               qlistFd)) {
+        indexSnapshot_p = &indexSnapshot;
+    }
+
     BALL_LOG_INFO << partitionDesc()
                   << "Attempting to recover messages from the local storage.";
 
@@ -791,7 +914,9 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
                          &dataFileOffset,
                          &jit,
                          &qit,
-                         &dit);
+                         &dit,
+                         &statRecorder,
+                         indexSnapshot_p);
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to recover messages from"
                        << " storage, rc: " << rc;
@@ -930,6 +1055,11 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         return rc * 100 + rc_OPEN_FAILURE;  // RETURN
     }
 
+    rc = openColdFile(fileSetSp.get());
+    if (0 != rc) {
+        return 100 * rc + rc_COLD_FILE_OPEN_FAILURE;  // RETURN
+    }
+
     // Update file positions to point to the offsets retrieved in
     // 'recoverMessages' call above.
 
@@ -997,6 +1127,12 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
                       << journalFileOffset << ", " << dataFileOffset;
     }
 
+    BALL_LOG_INFO_BLOCK
+    {
+        statRecorder.print(BALL_LOG_OUTPUT_STREAM,
+                           "RECOVERY - STEP 5 (REOPEN FILE SET)");
+    }
+
     // Hand over recovered queues to the storage manager *after* files have
     // been successfully opened.
 
@@ -1005,16 +1141,29 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
                                      *queueKeyInfoMap_p);
     }
 
+    BALL_LOG_INFO_BLOCK
+    {
+        statRecorder.print(BALL_LOG_OUTPUT_STREAM, "RECOVERY COMPLETE");
+    }
+
+    d_clusterStats_p->onPartitionEvent(
+        mqbstat::ClusterStats::PartitionEventType::e_PARTITION_RECOVERY,
+        d_config.partitionId(),
+        statRecorder.totalElapsed());
+
     return rc_SUCCESS;
 }
 
-int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
-                               bsls::Types::Uint64* journalOffset,
-                               bsls::Types::Uint64* qlistOffset,
-                               bsls::Types::Uint64* dataOffset,
-                               JournalFileIterator* jit,
-                               QlistFileIterator*   qit,
-                               DataFileIterator*    dit)
+int FileStore::recoverMessages(
+    QueueKeyInfoMap*                     queueKeyInfoMap,
+    bsls::Types::Uint64*                 journalOffset,
+    bsls::Types::Uint64*                 qlistOffset,
+    bsls::Types::Uint64*                 dataOffset,
+    JournalFileIterator*                 jit,
+    QlistFileIterator*                   qit,
+    DataFileIterator*                    dit,
+    mwcsys::StatMonitorSnapshotRecorder* statRecorder,
+    const IndexSnapshot*                 snapshot)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(queueKeyInfoMap);
@@ -1025,9 +1174,11 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     BSLS_ASSERT_SAFE(dataOffset);
     BSLS_ASSERT_SAFE(jit);
     BSLS_ASSERT_SAFE(dit);
+    BSLS_ASSERT_SAFE(statRecorder);
     BSLS_ASSERT_SAFE(jit->isReverseMode());
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
     BSLS_ASSERT_SAFE(d_fileSets[0].get());
+    BSLS_ASSERT_SAFE(!snapshot || !snapshot->d_syncPoints.empty());
 
     const bool needQList = !d_isFSMWorkflow;
     if (needQList) {
@@ -1111,6 +1262,13 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     // First pass.
     int rc = 0;
     while ((rc = journalIt.nextRecord()) == 1) {
+        if (snapshot &&
+            journalIt.recordOffset() <= snapshot->d_syncPointOffset) {
+            // Records up to the sync point of the snapshot are not replayed.
+
+            break;  // BREAK
+        }
+
         const RecordHeader& recHeader = journalIt.recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         if (rt == RecordType::e_UNDEFINED) {
@@ -1427,9 +1585,61 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         }
     }
 
+    if (snapshot) {
+        // The sync points up to the one of the snapshot have not been
+        // visited.  Also add the queues recorded in the snapshot, unless they
+        // have been deleted afterwards, so that the records of the tail of
+        // the journal referring to them can be validated in the 2nd pass.
+
+        firstSyncPtOffset = snapshot->d_syncPoints.front().offset();
+
+        if (!d_isFSMWorkflow) {
+            for (QueueKeyInfoMapConstIter queueIt =
+                     snapshot->d_queues.begin();
+                 queueIt != snapshot->d_queues.end();
+                 ++queueIt) {
+                const mqbu::StorageKey& queueKey = queueIt->first;
+                if (1 == deletedQueueKeysOffsets.count(queueKey)) {
+                    continue;  // CONTINUE
+                }
+
+                QueueKeyInfoMapInsertRc insertRc = queueKeyInfoMap->insert(
+                    bsl::make_pair(queueKey, DataStoreConfigQueueInfo()));
+                if (false == insertRc.second) {
+                    MWCTSK_ALARMLOG_ALARM("RECOVERY")
+                        << partitionDesc()
+                        << "Encountered a QueueOp.CREATION record for "
+                        << "queueKey [" << queueKey << "] after the index "
+                        << "snapshot, which already contains that queue."
+                        << MWCTSK_ALARMLOG_END;
+                    return rc_DUPLICATE_QUEUE_KEY;  // RETURN
+                }
+
+                DataStoreConfigQueueInfo& qinfo = insertRc.first->second;
+                qinfo.setPartitionId(d_config.partitionId());
+                qinfo.setCanonicalQueueUri(
+                    queueIt->second.canonicalQueueUri());
+
+                const AppIdKeyPairs& appIdKeyPairs =
+                    queueIt->second.appIdKeyPairs();
+                for (size_t n = 0; n < appIdKeyPairs.size(); ++n) {
+                    if (0 == deletedAppKeysOffsets.count(
+                                 appIdKeyPairs[n].second)) {
+                        qinfo.addAppIdKeyPair(appIdKeyPairs[n]);
+                    }
+                }
+            }
+        }
+    }
+
     BALL_LOG_INFO << partitionDesc() << "Completed first pass over the journal"
                   << " with rc: " << rc
                   << ". Offset of 1st SyncPt: " << firstSyncPtOffset << ".";
+    BALL_LOG_INFO_BLOCK
+    {
+        statRecorder->print(BALL_LOG_OUTPUT_STREAM,
+                            "RECOVERY - STEP 2 (JOURNAL FIRST PASS)");
+    }
 
     typedef bsl::unordered_set<bmqt::MessageGUID,
                                bslh::Hash<bmqt::MessageGUIDHashAlgo> >
@@ -1448,8 +1658,17 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     // correctly.
     bsls::Types::Uint64 sequenceNum = d_sequenceNum + 1;
 
+    // Messages whose payload CRC32-C must be validated.  Validation touches
+    // the payload of every outstanding message in the DATA file, so it is
+    // deferred until after the second pass and performed in parallel.
+    RecoveredMessages recoveredMessages(d_allocator_p);
+
     // Second pass.
     while (1 == (rc = jit->nextRecord())) {
+        if (snapshot && jit->recordOffset() <= snapshot->d_syncPointOffset) {
+            break;  // BREAK
+        }
+
         const RecordHeader& recHeader = jit->recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != rt);
@@ -2292,14 +2511,39 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                 return rc_INVALID_DATA_OFFSET;  // RETURN
             }
 
-            if (dataHeaderOffset > dataFd->fileSize()) {
+            // The payload of a message offloaded to the cold tier at rollover
+            // resides in the cold tier data file of the file set, as flagged
+            // by the file key of the record.
+
+            const bool isCold = mqbu::StorageKey(
+                                    FileStoreProtocol::k_COLD_FILE_KEY) ==
+                                rec.fileKey();
+            const MappedFileDescriptor* payloadFd =
+                isCold ? &activeFileSet->d_coldFile : dataFd;
+
+            if (isCold && !payloadFd->isValid()) {
                 BALL_LOG_ERROR
                     << partitionDesc()
                     << "Encountered a MESSAGE record with GUID ["
                     << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "], but out-of-bound DATA file offset field: "
-                    << dataHeaderOffset
-                    << ", DATA file size: " << dataFd->fileSize()
+                    << "] in the cold tier, but the cold tier data file of "
+                    << "the partition is missing or the cold tier is not "
+                    << "configured. Journal record offset: "
+                    << jit->recordOffset()
+                    << ", journal record index: " << jit->recordIndex() << ".";
+
+                return rc_INVALID_DATA_OFFSET;  // RETURN
+            }
+
+            if (dataHeaderOffset > payloadFd->fileSize()) {
+                BALL_LOG_ERROR
+                    << partitionDesc()
+                    << "Encountered a MESSAGE record with GUID ["
+                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
+                    << "], but out-of-bound " << (isCold ? "COLD" : "DATA")
+                    << " file offset field: " << dataHeaderOffset << ", "
+                    << (isCold ? "COLD" : "DATA")
+                    << " file size: " << payloadFd->fileSize()
                     << ". Journal record offset: " << jit->recordOffset()
                     << ", journal record index: " << jit->recordIndex() << ".";
 
@@ -2307,9 +2551,10 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             }
 
             // Update 'dataOffset' if its the last message record (ie, first in
-            // the iteration since we are iterating backwards).
+            // the iteration since we are iterating backwards) with a payload
+            // in the DATA file.
 
-            if (isLastMessageRecord) {
+            if (isLastMessageRecord && !isCold) {
                 OffsetPtr<const DataHeader> dataHeader(dataFd->block(),
                                                        dataHeaderOffset);
                 const unsigned int totalLen = dataHeader->messageWords() *
@@ -2352,7 +2597,7 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             // Check various fields in the message header etc as well as the
             // CRC32C.
 
-            OffsetPtr<const DataHeader> dataHeader(dataFd->block(),
+            OffsetPtr<const DataHeader> dataHeader(payloadFd->block(),
                                                    dataHeaderOffset);
 
             const unsigned int headerSize = dataHeader->headerWords() *
@@ -2403,8 +2648,8 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                 return rc_INVALID_DATA_RECORD;  // RETURN
             }
 
-            const char* begin    = dataFd->block().base() + dataHeaderOffset;
-            const int   lastByte = static_cast<int>(begin[totalLen - 1]);
+            const char* begin = payloadFd->block().base() + dataHeaderOffset;
+            const int lastByte = static_cast<int>(begin[totalLen - 1]);
 
             if (lastByte < 1 || lastByte > bmqp::Protocol::k_DWORD_SIZE) {
                 BALL_LOG_ERROR
@@ -2466,26 +2711,18 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                                       lastByte;
 
             if (!d_ignoreCrc32c) {
-                // Check CRC32C
-                unsigned int checksum = bmqp::Crc32c::calculate(
-                    dataFd->block().base() + appDataOffset,
-                    appDataLen);
-
-                if (rec.crc32c() != checksum) {
-                    MWCTSK_ALARMLOG_ALARM("RECOVERY")
-                        << partitionDesc()
-                        << "Recovery: CRC mismatch for guid ["
-                        << rec.messageGUID() << "] for queueKey ["
-                        << rec.queueKey() << "] in journal file ["
-                        << activeFileSet->d_journalFileName
-                        << "], offset: " << jit->recordOffset()
-                        << ", index: " << jit->recordIndex()
-                        << ". CRC32-C in JOURNAL record: " << rec.crc32c()
-                        << ". CRC32-C of payload in DATA file: " << checksum
-                        << ". Payload offset in DATA file: " << appDataOffset
-                        << MWCTSK_ALARMLOG_END;
-                    continue;  // CONTINUE
-                }
+                // CRC32C is checked once the second pass is complete.  A
+                // message failing the check is then removed from 'd_records'.
+                // Note that this is equivalent to not inserting it, since any
+                // record referring to it has already been visited.
+                RecoveredMessage recoveredMessage;
+                recoveredMessage.d_journalOffset = jit->recordOffset();
+                recoveredMessage.d_appDataOffset = appDataOffset;
+                recoveredMessage.d_appDataLen    = appDataLen;
+                recoveredMessage.d_crc32c        = rec.crc32c();
+                recoveredMessage.d_isCold        = isCold;
+                recoveredMessage.d_isValid       = false;
+                recoveredMessages.push_back(recoveredMessage);
             }
 
             DataStoreRecordKey key(sequenceNum, primaryLeaseId);
@@ -2494,6 +2731,7 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             record.d_appDataUnpaddedLen         = appDataLen;
             record.d_dataOrQlistRecordPaddedLen = totalLen;
             record.d_hasReceipt                 = true;
+            record.d_isCold                     = isCold;
             record.d_arrivalTimestamp           = recHeader.timestamp();
             record.d_messagePropertiesInfo      = bmqp::MessagePropertiesInfo(
                 *dataHeader);
@@ -2501,16 +2739,448 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             // Update in-memory record mapping.
             d_records.rinsert(bsl::make_pair(key, record));
 
-            // Update outstanding JOURNAL and DATA bytes.
+            // Update outstanding JOURNAL and DATA (or COLD) bytes.
 
             activeFileSet->d_outstandingBytesJournal +=
                 FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
-            activeFileSet->d_outstandingBytesData += totalLen;
+            if (isCold) {
+                activeFileSet->d_outstandingBytesCold += totalLen;
+            }
+            else {
+                activeFileSet->d_outstandingBytesData += totalLen;
+            }
         }
     }
 
     BALL_LOG_INFO << partitionDesc() << "Completed second pass over the "
                   << "journal with rc: " << rc;
+    BALL_LOG_INFO_BLOCK
+    {
+        statRecorder->print(BALL_LOG_OUTPUT_STREAM,
+                            "RECOVERY - STEP 3 (JOURNAL SECOND PASS)");
+    }
+
+    if (snapshot) {
+        // Ensure that the tail of the journal directly follows the sync point
+        // of the snapshot.
+
+        if (snapshot->d_primaryLeaseId > primaryLeaseId ||
+            (snapshot->d_primaryLeaseId == primaryLeaseId &&
+             snapshot->d_sequenceNum != (sequenceNum - 1))) {
+            BALL_LOG_ERROR << partitionDesc() << "Index snapshot taken at "
+                           << "(leaseId, seqNum): ("
+                           << snapshot->d_primaryLeaseId << ", "
+                           << snapshot->d_sequenceNum << ") is not followed "
+                           << "by the first replayed record: ("
+                           << primaryLeaseId << ", " << sequenceNum << ").";
+            return rc_INVALID_SEQ_NUMBER;  // RETURN
+        }
+
+        // Offsets of the files which have not been written after the sync
+        // point of the snapshot are the ones as of that sync point.
+
+        if (isLastJournalRecord) {
+            *journalOffset = snapshot->d_syncPointOffset +
+                             FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        }
+
+        if (isLastMessageRecord) {
+            *dataOffset = snapshot->d_dataFileOffset;
+        }
+
+        if (needQList && isLastQlistRecord) {
+            *qlistOffset = snapshot->d_qlistFileOffset;
+        }
+
+        for (IndexSnapshot::SyncPoints::const_reverse_iterator spIt =
+                 snapshot->d_syncPoints.rbegin();
+             spIt != snapshot->d_syncPoints.rend();
+             ++spIt) {
+            d_syncPoints.push_front(*spIt);
+        }
+
+        // Insert the records of the snapshot which have not been deleted by
+        // the tail of the journal, in the reverse order as in the 2nd pass.
+        // Their payload was validated when they were first recovered or
+        // written, and is not validated again.
+
+        const MemoryBlock& journalBlock = jit->mappedFileDescriptor()->block();
+        bsls::Types::Uint64 numSnapshotRecords = 0;
+
+        for (IndexSnapshot::Records::const_reverse_iterator recIt =
+                 snapshot->d_records.rbegin();
+             recIt != snapshot->d_records.rend();
+             ++recIt) {
+            const DataStoreRecord&  record   = recIt->d_record;
+            const mqbu::StorageKey& queueKey = recIt->d_queueKey;
+
+            if (1 == deletedQueueKeysOffsets.count(queueKey)) {
+                // Queue has been deleted after the snapshot.
+
+                continue;  // CONTINUE
+            }
+
+            if (RecordType::e_MESSAGE == record.d_recordType ||
+                RecordType::e_CONFIRM == record.d_recordType) {
+                if (1 == purgedQueueKeys.count(queueKey)) {
+                    // Queue has been purged after the snapshot.
+
+                    continue;  // CONTINUE
+                }
+
+                Guids::iterator delGuidIter = deletedGuids.find(
+                    recIt->d_guid);
+                if (delGuidIter != deletedGuids.end()) {
+                    // Message has been deleted after the snapshot.
+
+                    if (RecordType::e_MESSAGE == record.d_recordType) {
+                        deletedGuids.erase(delGuidIter);
+                    }
+                    continue;  // CONTINUE
+                }
+            }
+            else if (RecordType::e_QUEUE_OP == record.d_recordType &&
+                     !recIt->d_appKey.isNull() &&
+                     1 == deletedAppKeysOffsets.count(recIt->d_appKey)) {
+                const OffsetPtr<const QueueOpRecord> rec(
+                    journalBlock,
+                    record.d_recordOffset);
+                if (QueueOpType::e_PURGE == rec->type()) {
+                    // AppKey has been deleted after being purged.
+
+                    continue;  // CONTINUE
+                }
+            }
+
+            if (0 == queueKeyInfoMap->count(queueKey)) {
+                BALL_LOG_ERROR << partitionDesc() << "Encountered a record "
+                               << "of type [" << record.d_recordType
+                               << "] in the index snapshot for queueKey ["
+                               << queueKey << "], offset: "
+                               << record.d_recordOffset << ", but the "
+                               << "queueKey is not "
+                               << (d_isFSMWorkflow ? "present in cluster "
+                                                     "state."
+                                                   : "alive.");
+                return rc_INVALID_QUEUE_KEY;  // RETURN
+            }
+
+            d_records.rinsert(bsl::make_pair(recIt->d_key, record));
+            ++numSnapshotRecords;
+
+            // Update outstanding JOURNAL, DATA and QLIST bytes.
+
+            activeFileSet->d_outstandingBytesJournal +=
+                FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+            if (RecordType::e_MESSAGE == record.d_recordType) {
+                bsls::Types::Uint64& outstandingBytes =
+                    record.d_isCold ? activeFileSet->d_outstandingBytesCold
+                                    : activeFileSet->d_outstandingBytesData;
+                outstandingBytes += record.d_dataOrQlistRecordPaddedLen;
+            }
+            else if (RecordType::e_QUEUE_OP == record.d_recordType &&
+                     needQList) {
+                activeFileSet->d_outstandingBytesQlist +=
+                    record.d_dataOrQlistRecordPaddedLen;
+            }
+        }
+
+        BALL_LOG_INFO << partitionDesc() << "Recovered " << numSnapshotRecords
+                      << " out of " << snapshot->d_records.size()
+                      << " records from the index snapshot taken at journal "
+                      << "offset " << snapshot->d_syncPointOffset << ".";
+        BALL_LOG_INFO_BLOCK
+        {
+            statRecorder->print(BALL_LOG_OUTPUT_STREAM,
+                                "RECOVERY - STEP 3 (INDEX SNAPSHOT MERGE)");
+        }
+    }
+
+    if (!recoveredMessages.empty()) {
+        validateRecoveredMessages(&recoveredMessages,
+                                  *jit->mappedFileDescriptor(),
+                                  *dataFd);
+        BALL_LOG_INFO_BLOCK
+        {
+            statRecorder->print(BALL_LOG_OUTPUT_STREAM,
+                                "RECOVERY - STEP 4 (CRC32-C VALIDATION)");
+        }
+    }
+
+    return rc_SUCCESS;
+}
+
+void FileStore::validateRecoveredMessages(
+    RecoveredMessages*          messages,
+    const MappedFileDescriptor& journalFd,
+    const MappedFileDescriptor& dataFd)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(messages && !messages->empty());
+
+    const MappedFileDescriptor& coldFd = d_fileSets[0]->d_coldFile;
+
+    const char*  dataFileBase = dataFd.block().base();
+    const char*  coldFileBase = coldFd.isValid() ? coldFd.block().base() : 0;
+    const size_t numMessages  = messages->size();
+    const size_t numChunks    = (numMessages + k_RECOVERY_CRC_CHUNK_SIZE - 1) /
+                             k_RECOVERY_CRC_CHUNK_SIZE;
+    RecoveredMessage* begin = &messages->front();
+    RecoveredMessage* end   = begin + numMessages;
+
+    // The partition thread validates the last chunk itself, while the other
+    // chunks are spread over a pool of threads dedicated to this recovery.
+    // If the pool can't be started, everything is validated in this thread.
+
+    const int numThreads = static_cast<int>(
+        bsl::min(numChunks - 1,
+                 static_cast<size_t>(k_RECOVERY_CRC_MAX_THREADS)));
+    bool isValidated = false;
+    if (0 < numThreads) {
+        bdlmt::FixedThreadPool threadPool(
+            mwcsys::ThreadUtil::defaultAttributes().setThreadName(
+                "bmqRecoveryCrc"),
+            numThreads,
+            static_cast<int>(numChunks),
+            d_allocator_p);
+        if (0 == threadPool.start()) {
+            bslmt::Latch      latch(static_cast<int>(numChunks - 1));
+            RecoveredMessage* chunkBegin = begin;
+            for (size_t i = 0; i < numChunks - 1; ++i) {
+                RecoveredMessage* chunkEnd = chunkBegin +
+                                             k_RECOVERY_CRC_CHUNK_SIZE;
+                if (0 != threadPool.enqueueJob(bdlf::BindUtil::bind(
+                             &FileStore::validateRecoveredMessagesChunk,
+                             chunkBegin,
+                             chunkEnd,
+                             dataFileBase,
+                             coldFileBase,
+                             &latch))) {
+                    validateRecoveredMessagesChunk(chunkBegin,
+                                                   chunkEnd,
+                                                   dataFileBase,
+                                                   coldFileBase,
+                                                   &latch);
+                }
+                chunkBegin = chunkEnd;
+            }
+            validateRecoveredMessagesChunk(chunkBegin,
+                                           end,
+                                           dataFileBase,
+                                           coldFileBase,
+                                           0);
+            latch.wait();
+            threadPool.stop();
+            isValidated = true;
+        }
+        else {
+            BALL_LOG_WARN << partitionDesc() << "Failed to start the CRC32-C "
+                          << "validation thread pool, validating recovered "
+                          << "messages in the partition thread.";
+        }
+    }
+
+    if (!isValidated) {
+        validateRecoveredMessagesChunk(begin,
+                                       end,
+                                       dataFileBase,
+                                       coldFileBase,
+                                       0);
+    }
+
+    // Merge the results in the order in which messages were recovered, so
+    // that the outcome does not depend on the scheduling of the chunks.
+
+    FileSet*     activeFileSet = d_fileSets[0].get();
+    unsigned int numInvalid    = 0;
+    for (RecoveredMessage* it = begin; it != end; ++it) {
+        if (it->d_isValid) {
+            continue;  // CONTINUE
+        }
+
+        OffsetPtr<const MessageRecord> rec(journalFd.block(),
+                                           it->d_journalOffset);
+        const DataStoreRecordKey       key(rec->header().sequenceNumber(),
+                                     rec->header().primaryLeaseId());
+        const RecordIterator           recordIt = d_records.find(key);
+        BSLS_ASSERT_SAFE(recordIt != d_records.end());
+
+        MWCTSK_ALARMLOG_ALARM("RECOVERY")
+            << partitionDesc() << "Recovery: CRC mismatch for guid ["
+            << rec->messageGUID() << "] for queueKey [" << rec->queueKey()
+            << "] in journal file [" << activeFileSet->d_journalFileName
+            << "], offset: " << it->d_journalOffset
+            << ". CRC32-C in JOURNAL record: " << rec->crc32c()
+            << ". CRC32-C of payload in " << (it->d_isCold ? "COLD" : "DATA")
+            << " file: "
+            << bmqp::Crc32c::calculate((it->d_isCold ? coldFileBase
+                                                     : dataFileBase) +
+                                           it->d_appDataOffset,
+                                       it->d_appDataLen)
+            << ". Payload offset in " << (it->d_isCold ? "COLD" : "DATA")
+            << " file: " << it->d_appDataOffset << MWCTSK_ALARMLOG_END;
+
+        activeFileSet->d_outstandingBytesJournal -=
+            FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        bsls::Types::Uint64& outstandingBytes =
+            recordIt->second.d_isCold ? activeFileSet->d_outstandingBytesCold
+                                      : activeFileSet->d_outstandingBytesData;
+        outstandingBytes -= recordIt->second.d_dataOrQlistRecordPaddedLen;
+        d_records.erase(recordIt);
+        ++numInvalid;
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Validated CRC32-C of " << numMessages
+                  << " recovered messages in " << numChunks
+                  << " chunk(s) using " << (isValidated ? numThreads : 0)
+                  << " additional thread(s), " << numInvalid
+                  << " message(s) dropped.";
+}
+
+void FileStore::validateRecoveredMessagesChunk(RecoveredMessage* begin,
+                                               RecoveredMessage* end,
+                                               const char*       dataFileBase,
+                                               const char*       coldFileBase,
+                                               bslmt::Latch*     latch)
+{
+    // executed by *ANY* thread
+
+    for (; begin != end; ++begin) {
+        const char* base = begin->d_isCold ? coldFileBase : dataFileBase;
+        BSLS_ASSERT_SAFE(base);
+
+        const unsigned int checksum = bmqp::Crc32c::calculate(
+            base + begin->d_appDataOffset,
+            begin->d_appDataLen);
+        begin->d_isValid = (checksum == begin->d_crc32c);
+    }
+
+    if (latch) {
+        latch->arrive();
+    }
+}
+
+int FileStore::loadIndexSnapshot(IndexSnapshot*              snapshot,
+                                 const FileStoreSet&         recoveryFileSet,
+                                 const MappedFileDescriptor& journalFd,
+                                 const MappedFileDescriptor& dataFd,
+                                 const MappedFileDescriptor& qlistFd)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(snapshot);
+
+    enum {
+        rc_SUCCESS                = 0,
+        rc_NO_SNAPSHOT            = -1,
+        rc_LOAD_FAILURE           = -2,
+        rc_PARTITION_ID_MISMATCH  = -3,
+        rc_INVALID_SYNC_PT_OFFSET = -4,
+        rc_SYNC_PT_MISMATCH       = -5,
+        rc_INVALID_FILE_OFFSET    = -6,
+        rc_INVALID_RECORD         = -7
+    };
+
+    bsl::string path(d_allocator_p);
+    FileStoreUtil::createIndexSnapshotFileName(&path,
+                                               recoveryFileSet.journalFile());
+    if (!bdls::FilesystemUtil::exists(path)) {
+        BALL_LOG_INFO << partitionDesc() << "No index snapshot [" << path
+                      << "], the whole journal will be replayed.";
+        return rc_NO_SNAPSHOT;  // RETURN
+    }
+
+    mwcu::MemOutStream errorDesc;
+    int                rc = IndexSnapshotUtil::load(errorDesc, snapshot, path);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring index snapshot ["
+                      << path << "], rc: " << rc
+                      << ", reason: " << errorDesc.str()
+                      << ". The whole journal will be replayed.";
+        return 10 * rc + rc_LOAD_FAILURE;  // RETURN
+    }
+
+    // The snapshot must have been taken at a sync point which is still
+    // present in the journal.  Any mismatch means that the journal was
+    // truncated or rewritten since then.
+
+    rc = rc_SUCCESS;
+    if (snapshot->d_partitionId != d_config.partitionId()) {
+        rc = rc_PARTITION_ID_MISMATCH;
+    }
+    else if (snapshot->d_syncPoints.empty() ||
+             snapshot->d_syncPoints.back().offset() !=
+                 snapshot->d_syncPointOffset ||
+             snapshot->d_syncPointOffset < sizeof(FileHeader) ||
+             journalFd.fileSize() <
+                 (snapshot->d_syncPointOffset +
+                  FileStoreProtocol::k_JOURNAL_RECORD_SIZE)) {
+        rc = rc_INVALID_SYNC_PT_OFFSET;
+    }
+    else {
+        const OffsetPtr<const JournalOpRecord> rec(
+            journalFd.block(),
+            snapshot->d_syncPointOffset);
+        const bmqp_ctrlmsg::SyncPoint& syncPoint =
+            snapshot->d_syncPoints.back().syncPoint();
+
+        if (RecordType::e_JOURNAL_OP != rec->header().type() ||
+            RecordHeader::k_MAGIC != rec->magic() ||
+            JournalOpType::e_SYNCPOINT != rec->type() ||
+            rec->header().primaryLeaseId() != snapshot->d_primaryLeaseId ||
+            rec->header().sequenceNumber() != snapshot->d_sequenceNum ||
+            rec->header().timestamp() != snapshot->d_timestamp ||
+            rec->primaryLeaseId() != syncPoint.primaryLeaseId() ||
+            rec->sequenceNum() != syncPoint.sequenceNum() ||
+            rec->dataFileOffsetDwords() != syncPoint.dataFileOffsetDwords()) {
+            rc = rc_SYNC_PT_MISMATCH;
+        }
+        else if (dataFd.fileSize() < snapshot->d_dataFileOffset ||
+                 (!d_isFSMWorkflow &&
+                  qlistFd.fileSize() < snapshot->d_qlistFileOffset)) {
+            rc = rc_INVALID_FILE_OFFSET;
+        }
+    }
+
+    // Payloads in the cold tier are bound by the cold tier data file of the
+    // file set, which is opened before the snapshot is loaded.
+
+    const MappedFileDescriptor& coldFd = d_fileSets[0]->d_coldFile;
+    const bsls::Types::Uint64   coldFileSize = coldFd.isValid()
+                                                   ? coldFd.fileSize()
+                                                   : 0;
+
+    for (IndexSnapshot::Records::const_iterator it =
+             snapshot->d_records.begin();
+         rc_SUCCESS == rc && it != snapshot->d_records.end();
+         ++it) {
+        const DataStoreRecord& record = it->d_record;
+        if (snapshot->d_syncPointOffset <
+                (record.d_recordOffset +
+                 FileStoreProtocol::k_JOURNAL_RECORD_SIZE) ||
+            (RecordType::e_MESSAGE == record.d_recordType &&
+             (record.d_isCold ? coldFileSize : snapshot->d_dataFileOffset) <
+                 (record.d_messageOffset +
+                  record.d_dataOrQlistRecordPaddedLen))) {
+            rc = rc_INVALID_RECORD;
+        }
+    }
+
+    if (rc_SUCCESS != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring index snapshot ["
+                      << path << "] taken at journal offset "
+                      << snapshot->d_syncPointOffset
+                      << " which does not match the file set, rc: " << rc
+                      << ". The whole journal will be replayed.";
+        return rc;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Loaded index snapshot [" << path
+                  << "] taken at journal offset "
+                  << snapshot->d_syncPointOffset << ", (leaseId, seqNum): ("
+                  << snapshot->d_primaryLeaseId << ", "
+                  << snapshot->d_sequenceNum << "), with "
+                  << snapshot->d_records.size() << " records and "
+                  << snapshot->d_queues.size() << " queues.";
 
     return rc_SUCCESS;
 }
@@ -2531,11 +3201,44 @@ int FileStore::create(FileSetSp* fileSetSp)
                                  d_allocator_p);
 }
 
+bsls::Types::Uint64
+FileStore::selectColdMessages(bsl::vector<char>*  offloads,
+                              bsls::Types::Uint64 timestamp) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offloads);
+    BSLS_ASSERT_SAFE(!d_config.coldTierLocation().isEmpty());
+
+    const int                 minAgeSeconds = d_config.coldTierMinAgeSeconds();
+    const bsls::Types::Uint64 minAge =
+        0 < minAgeSeconds ? static_cast<bsls::Types::Uint64>(minAgeSeconds)
+                          : 0;
+
+    return FileStoreUtil::selectColdMessages(
+        offloads,
+        d_records.begin(),
+        d_records.end(),
+        timestamp,
+        minAge,
+        (d_config.maxDataFileSize() * k_COLD_TIER_MAX_HOT_DATA_PERCENT) /
+            100);
+}
+
 int FileStore::rollover(bsls::Types::Uint64 timestamp)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
 
+    // The payloads carried over by the previous rollover, if any, must all be
+    // in the active file set before it is rolled over in turn.
+
+    completeRolloverCopy();
+
+    // The records are moved to the new file set, so the snapshot of the
+    // in-memory index being taken, if any, would be of no use.
+
+    cancelIndexSnapshot();
+
     FileSet* activeFileSet = d_fileSets[0].get();
     BSLS_ASSERT_SAFE(activeFileSet);
 
@@ -2564,30 +3267,132 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
         return rc;  // RETURN
     }
 
+    // If the cold tier is enabled, select the payloads to write to the cold
+    // tier data file of the new file set.  The age of the messages is
+    // computed against the timestamp of the rollover sync point, which is
+    // the same on every node, instead of the current time, so that every
+    // node lays out the payloads identically.
+
+    bsl::vector<char> offloads(d_allocator_p);
+    if (!d_config.coldTierLocation().isEmpty()) {
+        BSLS_ASSERT_SAFE(!d_syncPoints.empty());
+
+        OffsetPtr<const JournalOpRecord> rolloverSpRec(
+            activeFileSet->d_journalFile.block(),
+            d_syncPoints.back().offset());
+
+        const bsls::Types::Uint64 coldBytes = selectColdMessages(
+            &offloads,
+            rolloverSpRec->header().timestamp());
+
+        if (0 != coldBytes) {
+            mwcu::MemOutStream errorDesc;
+            rc = FileStoreUtil::createColdFile(errorDesc,
+                                               newActiveFileSetSp.get(),
+                                               d_config.partitionId(),
+                                               d_config,
+                                               coldBytes);
+            if (0 != rc) {
+                MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                    << partitionDesc() << "Failed to create cold tier data "
+                    << "file for rollover, rc: " << rc
+                    << ", reason: " << errorDesc.str()
+                    << MWCTSK_ALARMLOG_END;
+
+                close(*newActiveFileSetSp, false);  // flush
+                bdls::FilesystemUtil::remove(
+                    newActiveFileSetSp->d_dataFileName);
+                bdls::FilesystemUtil::remove(
+                    newActiveFileSetSp->d_journalFileName);
+                if (!d_isFSMWorkflow) {
+                    bdls::FilesystemUtil::remove(
+                        newActiveFileSetSp->d_qlistFileName);
+                }
+                return rc;  // RETURN
+            }
+        }
+    }
+
+    // In non-FSM workflow, if there are enough outstanding payloads for the
+    // copy to stall the partition, only reserve the space of the payloads
+    // carried over to the new DATA file, and have them copied by a worker
+    // thread once all records have been rolled over.  New records are written
+    // to the new file set meanwhile.  The copy is recorded in a rollover copy
+    // file before the new file set accepts any record, so that recovery
+    // completes it from the old file set if the broker stops in between.
+    // The FSM workflow has its own recovery, which does not look at that
+    // file, hence payloads are always copied right away in that case.
+
+    BSLS_ASSERT_SAFE(!d_rolloverCopyFromFileSet);
+    BSLS_ASSERT_SAFE(d_rolloverCopySlices.empty());
+    const bool deferCopy = !d_isFSMWorkflow &&
+                           activeFileSet->d_outstandingBytesData >=
+                               k_ROLLOVER_COPY_MIN_BYTES;
+
     // Iterate over outstanding records in the active set, and copy them to the
     // rollover set.
 
     QueueKeyCounterMap queueKeyCounterMap;
+    size_t             index = 0;
     for (RecordIterator recordIt = d_records.begin();
          recordIt != d_records.end();
-         ++recordIt) {
+         ++recordIt, ++index) {
         writeRolledOverRecord(&(recordIt->second),
                               &queueKeyCounterMap,
                               activeFileSet,
-                              newActiveFileSetSp.get());
+                              newActiveFileSetSp.get(),
+                              !offloads.empty() && offloads[index],
+                              deferCopy ? &d_rolloverCopySlices : 0);
     }
 
-    // Print summary of rolled over queues.
-    mwcu::MemOutStream outStream;
-    outStream << partitionDesc() << "Queue rollover summary:"
-              << "\n      QueueKey    NumMsgs   NumBytes      QueueUri";
+    const bool isCopyDeferred = !d_rolloverCopySlices.empty();
 
-    QueueKeyCounterList queueKeyCounters;
-    queueKeyCounters.reserve(queueKeyCounterMap.size());
-    for (QueueKeyCounterMapCIter queueKeyCounterCIter =
-             queueKeyCounterMap.cbegin();
-         queueKeyCounterCIter != queueKeyCounterMap.cend();
-         ++queueKeyCounterCIter) {
+    if (newActiveFileSetSp->d_coldFile.isValid()) {
+        // Nothing else is ever written to the cold tier data file of a file
+        // set, so make it durable and release the unused space right away.
+
+        MappedFileDescriptor& coldFile = newActiveFileSetSp->d_coldFile;
+        mwcu::MemOutStream    errorDesc;
+        rc = FileSystemUtil::flush(coldFile.mapping(),
+                                   newActiveFileSetSp->d_coldFilePosition,
+                                   errorDesc);
+        if (0 != rc) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to flush cold tier data file ["
+                << newActiveFileSetSp->d_coldFileName << "], rc: " << rc
+                << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+            errorDesc.reset();
+        }
+
+        rc = FileSystemUtil::truncate(&coldFile,
+                                      newActiveFileSetSp->d_coldFilePosition,
+                                      errorDesc);
+        if (0 != rc) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc()
+                << "Failed to truncate cold tier data file ["
+                << newActiveFileSetSp->d_coldFileName << "], rc: " << rc
+                << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+        }
+
+        BALL_LOG_INFO << partitionDesc() << "Offloaded "
+                      << mwcu::PrintUtil::prettyBytes(
+                             newActiveFileSetSp->d_outstandingBytesCold)
+                      << " to cold tier data file ["
+                      << newActiveFileSetSp->d_coldFileName << "].";
+    }
+
+    // Print summary of rolled over queues.
+    mwcu::MemOutStream outStream;
+    outStream << partitionDesc() << "Queue rollover summary:"
+              << "\n      QueueKey    NumMsgs   NumBytes      QueueUri";
+
+    QueueKeyCounterList queueKeyCounters;
+    queueKeyCounters.reserve(queueKeyCounterMap.size());
+    for (QueueKeyCounterMapCIter queueKeyCounterCIter =
+             queueKeyCounterMap.cbegin();
+         queueKeyCounterCIter != queueKeyCounterMap.cend();
+         ++queueKeyCounterCIter) {
         queueKeyCounters.push_back(*queueKeyCounterCIter);
     }
     bsl::sort(queueKeyCounters.begin(), queueKeyCounters.end(), compareByByte);
@@ -2695,15 +3500,49 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
     // implies that rollover was successfully finished (this may help during
     // recovery after crash) ** NOTE ** Updating
     // JournalFileHeader.d_firstSyncPointOffset must be the last operation to
-    // occur in rolling over file store.
+    // occur in rolling over file store.  If the payloads are copied by a
+    // worker thread, the rollover copy file makes the new file set complete
+    // as far as recovery is concerned, so the marker can be written right
+    // away.  If that file cannot be written, the payloads are copied in this
+    // thread instead, and the marker is written by 'completeRolloverCopy'.
+
+    bool isCopyRecorded = false;
+    if (isCopyDeferred) {
+        RolloverCopy copy(d_allocator_p);
+        copy.d_fromDataFileName = activeFileSet->d_dataFileName;
+        copy.d_slices           = d_rolloverCopySlices;
+
+        FileStoreUtil::createRolloverCopyFileName(
+            &d_rolloverCopyFileName,
+            newActiveFileSetSp->d_dataFileName);
+
+        mwcu::MemOutStream errorDesc;
+        rc = RolloverCopyUtil::save(errorDesc, d_rolloverCopyFileName, copy);
+        if (0 == rc) {
+            isCopyRecorded = true;
+        }
+        else {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to write rollover copy file ["
+                << d_rolloverCopyFileName << "], rc: " << rc
+                << ", error: " << errorDesc.str()
+                << ". Copying rolled over payloads in this thread."
+                << MWCTSK_ALARMLOG_END;
+            d_rolloverCopyFileName.clear();
+        }
 
-    OffsetPtr<const FileHeader>  fhJ(rJournalFile.block(), 0);
-    OffsetPtr<JournalFileHeader> jfh(rJournalFile.block(),
-                                     fhJ->headerWords() *
-                                         bmqp::Protocol::k_WORD_SIZE);
+        d_rolloverCopySyncPointOffset = spoPair.offset();
+    }
 
-    jfh->setFirstSyncPointOffsetWords(spoPair.offset() /
-                                      bmqp::Protocol::k_WORD_SIZE);
+    if (!isCopyDeferred || isCopyRecorded) {
+        OffsetPtr<const FileHeader>  fhJ(rJournalFile.block(), 0);
+        OffsetPtr<JournalFileHeader> jfh(rJournalFile.block(),
+                                         fhJ->headerWords() *
+                                             bmqp::Protocol::k_WORD_SIZE);
+
+        jfh->setFirstSyncPointOffsetWords(spoPair.offset() /
+                                          bmqp::Protocol::k_WORD_SIZE);
+    }
 
     // Now clear the 'd_syncPoints' as the rollover is complete, and make the
     // previous newest sync point the first new sync point.
@@ -2763,8 +3602,11 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
     // too.  Old file set can be archived as well after that.
 
     // Irrespective of the aliased blob buffer counter, file set can be
-    // truncated because nothing else will be written to the file.
+    // truncated because nothing else will be written to the file.  Write back
+    // whatever is left dirty in it first, as the write back thread only
+    // looks at the active file set.
 
+    writebackSync();
     truncate(activeFileSet);
     BALL_LOG_INFO_BLOCK
     {
@@ -2772,6 +3614,13 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
                            "ROLLOVER - STEP 2 (TRUNCATE)");
     }
 
+    if (isCopyDeferred) {
+        // The copy holds an alias on the old file set until it completes.
+
+        d_rolloverCopyFromFileSet = d_fileSets[0];
+        ++activeFileSet->d_aliasedBlobBufferCount;
+    }
+
     if (0 == --activeFileSet->d_aliasedBlobBufferCount) {
         BALL_LOG_INFO_BLOCK
         {
@@ -2815,6 +3664,39 @@ int FileStore::rollover(bsls::Types::Uint64 timestamp)
     // Add 'newActiveFileSetSp' as the first element of 'd_fileSets'.
     d_fileSets.insert(d_fileSets.begin(), newActiveFileSetSp);
 
+    if (isCopyDeferred) {
+        d_rolloverCopyWatermark.storeRelease(
+            d_rolloverCopySlices.front().d_toOffset);
+        d_rolloverCopyStartTime = mwcsys::Time::highResolutionTimer();
+        ++d_rolloverCopyGeneration;
+
+        BALL_LOG_INFO << partitionDesc() << "Copying "
+                      << mwcu::PrintUtil::prettyBytes(
+                             rolloverCopyPendingBytes())
+                      << " of rolled over payloads in "
+                      << d_rolloverCopySlices.size()
+                      << " ranges in the background.";
+
+        rc = isCopyRecorded
+                 ? d_miscWorkThreadPool_p->enqueueJob(bdlf::BindUtil::bind(
+                       &FileStore::rolloverCopyWorkerDispatched,
+                       this,
+                       d_rolloverCopyFromFileSet,
+                       newActiveFileSetSp,
+                       d_rolloverCopyGeneration))
+                 : -1;
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to start the copy "
+                          << "of rolled over payloads, rc: " << rc
+                          << ". Copying them in this thread.";
+
+            rolloverCopyWorkerDispatched(d_rolloverCopyFromFileSet,
+                                         newActiveFileSetSp,
+                                         d_rolloverCopyGeneration);
+            completeRolloverCopy();
+        }
+    }
+
     BALL_LOG_INFO_BLOCK
     {
         BALL_LOG_OUTPUT_STREAM << partitionDesc()
@@ -2917,6 +3799,11 @@ int FileStore::rolloverIfNeeded(FileType::Enum              fileType,
         << "\nDATA: "
         << mwcu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
                activeFileSet->d_outstandingBytesData));
+    if (activeFileSet->d_coldFile.isValid()) {
+        out << "\nCOLD: "
+            << mwcu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
+                   activeFileSet->d_outstandingBytesCold));
+    }
     if (!d_isFSMWorkflow) {
         out << "\nQLIST: "
             << mwcu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
@@ -2965,8 +3852,11 @@ int FileStore::rolloverIfNeeded(FileType::Enum              fileType,
             d_config.maxDataFileSize();
     }
 
-    if (availableSpacePercentData < k_MIN_AVAILABLE_SPACE_PERCENT) {
-        // DATA file can't be rolled over.
+    if (availableSpacePercentData < k_MIN_AVAILABLE_SPACE_PERCENT &&
+        d_config.coldTierLocation().isEmpty()) {
+        // DATA file can't be rolled over.  Note that the DATA file can always
+        // be rolled over when the cold tier is enabled, as the oldest
+        // payloads are then offloaded to it.
 
         canRollover            = false;
         cannotRolloverFileType = FileType::e_DATA;
@@ -3114,6 +4004,174 @@ int FileStore::rolloverIfNeeded(FileType::Enum              fileType,
     return rc_SUCCESS;
 }
 
+void FileStore::rolloverCopyWorkerDispatched(const FileSetSp& fromFileSet,
+                                             const FileSetSp& toFileSet,
+                                             unsigned int     generation)
+{
+    // executed by a *WORKER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fromFileSet);
+    BSLS_ASSERT_SAFE(toFileSet);
+    BSLS_ASSERT_SAFE(!d_rolloverCopySlices.empty());
+
+    const char* fromBase  = fromFileSet->d_dataFile.block().base();
+    char*       toBase    = toFileSet->d_dataFile.block().base();
+    bool        writeback = true;
+
+    for (RolloverCopySlices::const_iterator it = d_rolloverCopySlices.begin();
+         it != d_rolloverCopySlices.end();
+         ++it) {
+        bsls::Types::Uint64 copied = 0;
+        while (copied < it->d_length) {
+            const bsls::Types::Uint64 length = bsl::min(
+                k_ROLLOVER_COPY_CHUNK_BYTES,
+                it->d_length - copied);
+            bsl::memcpy(toBase + it->d_toOffset + copied,
+                        fromBase + it->d_fromOffset + copied,
+                        length);
+
+            // Initiate the write back of each chunk as soon as it is copied,
+            // instead of leaving the whole range dirty in the page cache.
+
+            if (writeback) {
+                mwcu::MemOutStream errorDesc;
+                const int          rc = FileSystemUtil::writeback(
+                    toFileSet->d_dataFile,
+                    it->d_toOffset + copied,
+                    length,
+                    false,  // waitForDurability
+                    errorDesc);
+                if (0 != rc) {
+                    BALL_LOG_WARN << partitionDesc() << "Failed to write "
+                                  << "back rolled over payloads in data file ["
+                                  << toFileSet->d_dataFileName
+                                  << "], rc: " << rc
+                                  << ", error: " << errorDesc.str();
+                    writeback = false;
+                }
+            }
+
+            copied += length;
+            d_rolloverCopyWatermark.storeRelease(it->d_toOffset + copied);
+        }
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::rolloverCopyCompleteDispatched,
+                                 this,
+                                 generation));
+    d_rolloverCopySemaphore.post();
+}
+
+void FileStore::rolloverCopyCompleteDispatched(unsigned int generation)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (!d_rolloverCopyFromFileSet || generation != d_rolloverCopyGeneration) {
+        // The copy has already been completed, by a subsequent rollover or
+        // by closing the partition.
+
+        return;  // RETURN
+    }
+
+    completeRolloverCopy();
+}
+
+void FileStore::completeRolloverCopy()
+{
+    if (!d_rolloverCopyFromFileSet) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(!d_rolloverCopySlices.empty());
+    BSLS_ASSERT_SAFE(1 < d_fileSets.size());
+
+    d_rolloverCopySemaphore.wait();
+
+    const bsls::Types::Int64 elapsed = mwcsys::Time::highResolutionTimer() -
+                                       d_rolloverCopyStartTime;
+
+    // All the payloads carried over by the last rollover are now in the DATA
+    // file of the active file set (see 'rollover').
+
+    FileSet*                  activeFileSet = d_fileSets[0].get();
+    const RolloverCopySlice&  lastSlice     = d_rolloverCopySlices.back();
+    const bsls::Types::Uint64 firstOffset =
+        d_rolloverCopySlices.front().d_toOffset;
+    const bsls::Types::Uint64 numBytes = lastSlice.d_toOffset +
+                                         lastSlice.d_length - firstOffset;
+
+    if (!d_rolloverCopyFileName.empty()) {
+        // Make the copy durable before removing the rollover copy file, from
+        // which recovery would otherwise complete it.  Note that the previous
+        // file set is released right after, and that recovery ignores a
+        // rollover copy file whose previous DATA file is gone.
+
+        mwcu::MemOutStream errorDesc;
+        int                rc = FileSystemUtil::writeback(
+            activeFileSet->d_dataFile,
+            firstOffset,
+            numBytes,
+            true,  // waitForDurability
+            errorDesc);
+        if (0 != rc) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to sync rolled over payloads "
+                << "in data file [" << activeFileSet->d_dataFileName
+                << "], rc: " << rc << ", error: " << errorDesc.str()
+                << MWCTSK_ALARMLOG_END;
+        }
+
+        errorDesc.reset();
+        rc = RolloverCopyUtil::remove(errorDesc, d_rolloverCopyFileName);
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to remove rollover "
+                          << "copy file [" << d_rolloverCopyFileName
+                          << "], rc: " << rc
+                          << ", error: " << errorDesc.str();
+        }
+
+        d_rolloverCopyFileName.clear();
+    }
+    else {
+        // Mark the rollover as complete.
+
+        MappedFileDescriptor& journal = activeFileSet->d_journalFile;
+
+        OffsetPtr<const FileHeader>  fh(journal.block(), 0);
+        OffsetPtr<JournalFileHeader> jfh(journal.block(),
+                                         fh->headerWords() *
+                                             bmqp::Protocol::k_WORD_SIZE);
+        jfh->setFirstSyncPointOffsetWords(d_rolloverCopySyncPointOffset /
+                                          bmqp::Protocol::k_WORD_SIZE);
+    }
+    BALL_LOG_INFO << partitionDesc() << "Rollover complete: copied "
+                  << mwcu::PrintUtil::prettyBytes(numBytes)
+                  << " of rolled over payloads from data file ["
+                  << d_rolloverCopyFromFileSet->d_dataFileName << "] in "
+                  << mwcu::PrintUtil::prettyTimeInterval(elapsed) << ".";
+
+    d_clusterStats_p->onPartitionEvent(
+        mqbstat::ClusterStats::PartitionEventType::e_PARTITION_ROLLOVER_COPY,
+        d_config.partitionId(),
+        elapsed);
+
+    // Release the alias held on the old file set by the copy, and gc the file
+    // set if it was the last one.
+
+    FileSetSp fromFileSet;
+    fromFileSet.swap(d_rolloverCopyFromFileSet);
+    d_rolloverCopySlices.clear();
+
+    BSLS_ASSERT_SAFE(0 < fromFileSet->d_aliasedBlobBufferCount);
+    if (0 == --fromFileSet->d_aliasedBlobBufferCount) {
+        gcDispatched(d_config.partitionId(), fromFileSet.get());
+    }
+}
+
 void FileStore::truncate(FileSet* fileSet)
 {
     mwcu::MemOutStream errorDesc;
@@ -3221,10 +4279,99 @@ void FileStore::close(FileSet& fileSetRef, bool flush)
                 << MWCTSK_ALARMLOG_END;
         }
     }
+
+    if (fileSetRef.d_coldFile.isValid()) {
+        // The cold tier data file is flushed when it is written at rollover,
+        // and is read-only afterwards.
+
+        rc = FileSystemUtil::close(&fileSetRef.d_coldFile);
+        if (0 != rc) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to close cold tier data file ["
+                << fileSetRef.d_coldFileName << "], rc: " << rc
+                << MWCTSK_ALARMLOG_END;
+        }
+    }
+}
+
+int FileStore::openColdFile(FileSet* fileSet)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+    BSLS_ASSERT_SAFE(!fileSet->d_coldFile.isValid());
+
+    enum { rc_SUCCESS = 0, rc_OPEN_FAILURE = -1 };
+
+    if (d_config.coldTierLocation().isEmpty()) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    FileStoreUtil::createColdFileName(&fileSet->d_coldFileName,
+                                      d_config.coldTierLocation(),
+                                      fileSet->d_dataFileName);
+    if (!bdls::FilesystemUtil::exists(fileSet->d_coldFileName)) {
+        fileSet->d_coldFileName.clear();
+        return rc_SUCCESS;  // RETURN
+    }
+
+    const bsls::Types::Uint64 fileSize = bdls::FilesystemUtil::getFileSize(
+        fileSet->d_coldFileName);
+
+    mwcu::MemOutStream errorDesc;
+    int                rc = FileSystemUtil::open(&fileSet->d_coldFile,
+                                  fileSet->d_coldFileName.c_str(),
+                                  fileSize,
+                                  true,  // readOnly
+                                  errorDesc);
+    if (0 != rc) {
+        MWCTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Failed to open cold tier data file ["
+            << fileSet->d_coldFileName << "], rc: " << rc
+            << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+        return 10 * rc + rc_OPEN_FAILURE;  // RETURN
+    }
+
+    fileSet->d_coldFilePosition          = fileSize;
+    fileSet->d_coldFileReadAheadPosition = FileStoreUtil::coldFileHeaderSize();
+
+    return rc_SUCCESS;
 }
 
 void FileStore::archive(FileSet* fileSet)
 {
+    // The index snapshot, if any, is only a cache of the journal and is not
+    // archived.
+
+    bsl::string indexSnapshotFileName(d_allocator_p);
+    FileStoreUtil::createIndexSnapshotFileName(&indexSnapshotFileName,
+                                               fileSet->d_journalFileName);
+    if (bdls::FilesystemUtil::exists(indexSnapshotFileName) &&
+        0 != bdls::FilesystemUtil::remove(indexSnapshotFileName)) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to remove index snapshot "
+                      << "[" << indexSnapshotFileName << "].";
+    }
+
+    // Neither is a rollover copy file left behind by a failure to remove it.
+
+    bsl::string rolloverCopyFileName(d_allocator_p);
+    FileStoreUtil::createRolloverCopyFileName(&rolloverCopyFileName,
+                                              fileSet->d_dataFileName);
+    if (bdls::FilesystemUtil::exists(rolloverCopyFileName) &&
+        0 != bdls::FilesystemUtil::remove(rolloverCopyFileName)) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to remove rollover copy "
+                      << "file [" << rolloverCopyFileName << "].";
+    }
+
+    // The cold tier data file, if any, is not archived either: it lives on
+    // the cold tier location, which is typically sized for outstanding data
+    // only.
+
+    if (!fileSet->d_coldFileName.empty() &&
+        0 != bdls::FilesystemUtil::remove(fileSet->d_coldFileName)) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to remove cold tier data "
+                      << "file [" << fileSet->d_coldFileName << "].";
+    }
+
     int rc = FileSystemUtil::move(fileSet->d_dataFileName,
                                   d_config.archiveLocation());
     if (0 != rc) {
@@ -3434,7 +4581,9 @@ int FileStore::writeQueueOpRecord(DataStoreRecordHandle*  handle,
 void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
                                       QueueKeyCounterMap* queueKeyCounterMap,
                                       FileSet*            oldFileSet,
-                                      FileSet*            newFileSet)
+                                      FileSet*            newFileSet,
+                                      bool                offload,
+                                      RolloverCopySlices* deferredCopies)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 != record->d_recordOffset);
@@ -3458,8 +4607,23 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
         OffsetPtr<const MessageRecord> fromRec(aJournal.block(),
                                                record->d_recordOffset);
 
+        // The payload is read from the cold tier data file of the old file
+        // set if it was offloaded at a previous rollover, and is written to
+        // the cold tier data file of the new file set if 'offload' is true.
+
+        const MappedFileDescriptor& fromFile = record->d_isCold
+                                                   ? oldFileSet->d_coldFile
+                                                   : aDataFile;
+        MappedFileDescriptor&       toFile   = offload
+                                                   ? newFileSet->d_coldFile
+                                                   : rDataFile;
+        bsls::Types::Uint64&        toFilePos =
+            offload ? newFileSet->d_coldFilePosition : rDataFilePos;
+        BSLS_ASSERT_SAFE(fromFile.isValid());
+        BSLS_ASSERT_SAFE(toFile.isValid());
+
         // Take note of offset in rolled over data file
-        bsls::Types::Uint64 newDataFileOffset = rDataFilePos;
+        bsls::Types::Uint64 newDataFileOffset = toFilePos;
         BSLS_ASSERT_SAFE(0 ==
                          newDataFileOffset % bmqp::Protocol::k_DWORD_SIZE);
 
@@ -3470,28 +4634,61 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
             static_cast<bsls::Types::Uint64>(fromRec->messageOffsetDwords()) *
             bmqp::Protocol::k_DWORD_SIZE;
 
-        OffsetPtr<const DataHeader> dataHeader(aDataFile.block(),
-                                               messageOffset);
+        unsigned int dataMsgSize = 0;
+        if (deferredCopies && !offload && !record->d_isCold) {
+            // Only reserve the space of the payload, which is copied later by
+            // a worker thread.  Its length is known from the in-memory record
+            // so that the DATA file of the old file set is not touched at
+            // all.  Ranges which are contiguous in both files are coalesced.
+
+            dataMsgSize = record->d_dataOrQlistRecordPaddedLen;
+
+            if (!deferredCopies->empty() &&
+                deferredCopies->back().d_fromOffset +
+                        deferredCopies->back().d_length ==
+                    messageOffset &&
+                deferredCopies->back().d_toOffset +
+                        deferredCopies->back().d_length ==
+                    toFilePos) {
+                deferredCopies->back().d_length += dataMsgSize;
+            }
+            else {
+                RolloverCopySlice slice;
+                slice.d_fromOffset = messageOffset;
+                slice.d_toOffset   = toFilePos;
+                slice.d_length     = dataMsgSize;
+                deferredCopies->push_back(slice);
+            }
+        }
+        else {
+            OffsetPtr<const DataHeader> dataHeader(fromFile.block(),
+                                                   messageOffset);
 
-        const unsigned int dataMsgSize = dataHeader->messageWords() *
-                                         bmqp::Protocol::k_WORD_SIZE;
+            dataMsgSize = dataHeader->messageWords() *
+                          bmqp::Protocol::k_WORD_SIZE;
 
-        bsl::memcpy(rDataFile.block().base() + rDataFilePos,
-                    aDataFile.block().base() + messageOffset,
-                    dataMsgSize);
+            bsl::memcpy(toFile.block().base() + toFilePos,
+                        fromFile.block().base() + messageOffset,
+                        dataMsgSize);
+        }
 
-        rDataFilePos += dataMsgSize;
+        toFilePos += dataMsgSize;
 
-        // Append MessageRecord to journal.
+        // Append MessageRecord to journal.  The file key of the record tells
+        // recovery which data file holds the payload.
 
         OffsetPtr<MessageRecord> toRec(rJournal.block(), rJournalPos);
         new (toRec.get()) MessageRecord(*fromRec);
         toRec->setMessageOffsetDwords(newDataFileOffset /
                                       bmqp::Protocol::k_DWORD_SIZE);
+        toRec->setFileKey(
+            offload ? mqbu::StorageKey(FileStoreProtocol::k_COLD_FILE_KEY)
+                    : newFileSet->d_dataFileKey);
 
         // Update offset of the message in the in-memory DataStoreRecord
         // 'record'.
         record->d_messageOffset = newDataFileOffset;
+        record->d_isCold        = offload;
 
         // Increase the message and byte counter for this queue.
 
@@ -3503,7 +4700,12 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
         ++(qit->second.first);
         qit->second.second += dataMsgSize;
 
-        newFileSet->d_outstandingBytesData += dataMsgSize;
+        if (offload) {
+            newFileSet->d_outstandingBytesCold += dataMsgSize;
+        }
+        else {
+            newFileSet->d_outstandingBytesData += dataMsgSize;
+        }
     }
     else if (RecordType::e_QUEUE_OP == record->d_recordType) {
         OffsetPtr<const QueueOpRecord> fromRec(aJournal.block(),
@@ -3815,6 +5017,10 @@ int FileStore::issueSyncPointInternal(SyncPointType::Enum type,
         fs->d_outstandingBytesData,
         fs->d_outstandingBytesJournal);
 
+    if (SyncPointType::e_REGULAR == type) {
+        snapshotIndexIfNeeded();
+    }
+
     return rc_SUCCESS;
 }
 
@@ -3837,11 +5043,21 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         return;  // RETURN
     }
 
-    // `to` is the end of Receipt range.  Find the start of the range
-    // using prior 'source' history and making sure not to count anything
+    processReceipt(recordKey, source->nodeId());
+}
+
+void FileStore::processReceipt(const DataStoreRecordKey& recordKey,
+                               int                       nodeId)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isPrimary);
+
+    // 'recordKey' is the end of Receipt range.  Find the start of the range
+    // using prior 'nodeId' history and making sure not to count anything
     // twice.
 
-    int                           nodeId = source->nodeId();
     NodeReceiptContexts::iterator itNode = d_nodes.find(nodeId);
     Unreceipted::iterator         from;  // start of Receipt range
 
@@ -3853,11 +5069,26 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         from = d_unreceipted.begin();
     }
     else if (itNode->second.d_key < recordKey) {
-        from = d_unreceipted.find(itNode->second.d_key);
+        const DataStoreRecordKey& lastReceiptKey = itNode->second.d_key;
+        from = d_unreceipted.find(lastReceiptKey);
 
         if (from == d_unreceipted.end()) {
-            // we went past the last Receipt from this node
-            from = d_unreceipted.begin();
+            // we went past the last Receipt from this node, or the last
+            // Receipt (e.g., self node's durable write back) was not about a
+            // message.  Skip what it has already accounted for.  Records are
+            // inserted in key order and Receipts are cumulative, so what this
+            // node has not Receipted yet is at the back: walk back from the
+            // end rather than from the front, which would visit every record
+            // waiting for the Receipts of lagging nodes.
+            from = d_unreceipted.end();
+            while (from != d_unreceipted.begin()) {
+                Unreceipted::iterator prev = from;
+                --prev;
+                if (!(lastReceiptKey < prev->first)) {
+                    break;  // BREAK
+                }
+                from = prev;
+            }
         }
         else {
             ++from;  // `itNode->second` was the last Receipt
@@ -3871,17 +5102,12 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         return;  // RETURN
     }
 
-    // everything in [from, to] is Receipt'ed
-    bool                             isEndOfRange = false;
+    // everything in [from, recordKey] is Receipt'ed
     mqbu::StorageKey                 lastKey;
     bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
     mqbi::Queue*                     lastQueue = 0;
 
-    while (from != d_unreceipted.end() && !isEndOfRange) {
-        if (from->first == recordKey) {
-            // This is the last in the range
-            isEndOfRange = true;
-        }
+    while (from != d_unreceipted.end() && !(recordKey < from->first)) {
         if (++(from->second.d_count) >= d_replicationFactor) {
             from->second.d_handle->second.d_hasReceipt = true;
             // notify the queue
@@ -3918,6 +5144,16 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
          ++it) {
         (*it)->queueEngine()->afterNewMessage(bmqt::MessageGUID(), 0);
     }
+
+    reportReplicaLag(nodeId, recordKey);
+
+    // This Receipt may have reopened the replication window, in which case
+    // the records batched while it was full are replicated right away.
+    if (0 != d_config.replicationBatchingThreshold() &&
+        0 != d_storageEventBuilder.messageCount() &&
+        !isReplicationWindowFull()) {
+        broadcastStorageEvent();
+    }
 }
 
 int FileStore::writeMessageRecord(const bmqp::StorageHeader& header,
@@ -4677,6 +5913,9 @@ int FileStore::writeJournalRecord(const bmqp::StorageHeader& header,
                     return 10 * rc + rc_ROLLOVER_FAILURE;  // RETURN
                 }
             }
+            else {
+                snapshotIndexIfNeeded();
+            }
 
             // If self is stopping, update the flag which indicates that self
             // has received the "last" SyncPt from the primary, and self should
@@ -4861,6 +6100,10 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
         return;  // RETURN
     }
 
+    OffsetPtr<const RecordHeader> recHeader(journal.block(), journalOffset);
+    d_lastPackedKey = DataStoreRecordKey(recHeader->sequenceNumber(),
+                                         recHeader->primaryLeaseId());
+
     // Flush if the builder is 'full' or if immediate flush is requested.
     flushIfNeeded(immediateFlush);
 }
@@ -4910,6 +6153,18 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
         dataBlobBuffer.reset(dataBufferSp, totalDataLen);
     }
 
+    // Batches grow larger while the replication window is full (see
+    // 'flushIfNeeded'): replicate the records batched so far if this one
+    // would not fit in the same storage event.
+    if (0 != d_storageEventBuilder.messageCount() &&
+        bmqp::EventHeader::k_MAX_SIZE_SOFT <
+            static_cast<int>(d_storageEventBuilder.eventSize() +
+                             sizeof(bmqp::StorageHeader) +
+                             FileStoreProtocol::k_JOURNAL_RECORD_SIZE +
+                             dataBlobBuffer.size())) {
+        broadcastStorageEvent();
+    }
+
     if (bmqp::StorageMessageType::e_DATA == type) {
         buildRc = d_storageEventBuilder.packMessage(
             bmqp::StorageMessageType::e_DATA,
@@ -4963,6 +6218,13 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
         return;  // RETURN
     }
 
+    OffsetPtr<const RecordHeader> recHeader(journal.block(), journalOffset);
+    d_lastPackedKey = DataStoreRecordKey(recHeader->sequenceNumber(),
+                                         recHeader->primaryLeaseId());
+    if (flags & bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED) {
+        d_lastPackedReceiptKey = d_lastPackedKey;
+    }
+
     // Flush if the builder is 'full'.
     flushIfNeeded(false);
 }
@@ -5051,24 +6313,59 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     FileSet* activeFileSet = d_fileSets[0].get();
     BSLS_ASSERT_SAFE(activeFileSet);
 
-    OffsetPtr<const DataHeader> dataHeader(activeFileSet->d_dataFile.block(),
-                                           record.d_messageOffset);
+    // The payload is read from the previous file set if it was carried over
+    // by the last rollover and has not been copied to the active one yet.
+
+    bsls::Types::Uint64 messageOffset = record.d_messageOffset;
+    FileSet*            fileSet = rolloverCopySource(&messageOffset, record);
+    if (!fileSet) {
+        fileSet = activeFileSet;
+    }
+
+    const MappedFileDescriptor& file = record.d_isCold ? fileSet->d_coldFile
+                                                       : fileSet->d_dataFile;
+    BSLS_ASSERT_SAFE(file.isValid());
+
+    if (record.d_isCold) {
+        // Payloads in the cold tier are typically read in the order in which
+        // they were offloaded, ie, sequentially, and are likely not resident
+        // in the page cache.  Request the read-ahead of the next window of
+        // the cold tier data file when the message crosses the current one,
+        // instead of faulting its pages one by one.
+
+        const bsls::Types::Uint64 messageEnd =
+            record.d_messageOffset + record.d_dataOrQlistRecordPaddedLen;
+        if (messageEnd > activeFileSet->d_coldFileReadAheadPosition) {
+            const bsls::Types::Uint64 pageSize = ::sysconf(_SC_PAGESIZE);
+            const bsls::Types::Uint64 begin    = (record.d_messageOffset /
+                                               pageSize) *
+                                              pageSize;
+            const bsls::Types::Uint64 end      = bsl::min(
+                messageEnd + k_COLD_TIER_READ_AHEAD_BYTES,
+                activeFileSet->d_coldFilePosition);
+            FileSystemUtil::madvise(file.mapping() + begin,
+                                    end - begin,
+                                    MADV_WILLNEED);
+            activeFileSet->d_coldFileReadAheadPosition = end;
+        }
+    }
+
+    OffsetPtr<const DataHeader> dataHeader(file.block(), messageOffset);
     const unsigned int          dataHdrSize = dataHeader->headerWords() *
                                      bmqp::Protocol::k_WORD_SIZE;
-    const bsls::Types::Uint64 optionsOffset = record.d_messageOffset +
-                                              dataHdrSize;
+    const bsls::Types::Uint64 optionsOffset = messageOffset + dataHdrSize;
     const bsls::Types::Uint64 optionsSize = static_cast<bsls::Types::Uint64>(
                                                 dataHeader->optionsWords()) *
                                             bmqp::Protocol::k_WORD_SIZE;
-    const bsls::Types::Uint64 appDataOffset = record.d_messageOffset +
-                                              dataHdrSize + optionsSize;
+    const bsls::Types::Uint64 appDataOffset = messageOffset + dataHdrSize +
+                                              optionsSize;
     AliasedBufferDeleterSp deleter = d_aliasedBufferDeleterSpPool.getObject();
-    deleter->setFileSet(activeFileSet);
+    deleter->setFileSet(fileSet);
 
     if (0 != optionsSize) {
-        bsl::shared_ptr<char> optionsBufferSp(
-            deleter,
-            activeFileSet->d_dataFile.block().base() + optionsOffset);
+        bsl::shared_ptr<char> optionsBufferSp(deleter,
+                                              file.block().base() +
+                                                  optionsOffset);
 
         bdlbb::BlobBuffer optionsBlobBuffer(optionsBufferSp, optionsSize);
 
@@ -5076,9 +6373,9 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
         (*options)->appendDataBuffer(optionsBlobBuffer);
     }
 
-    bsl::shared_ptr<char> appDataBufferSp(
-        deleter,
-        activeFileSet->d_dataFile.block().base() + appDataOffset);
+    bsl::shared_ptr<char> appDataBufferSp(deleter,
+                                          file.block().base() +
+                                              appDataOffset);
 
     bdlbb::BlobBuffer appDataBlobBuffer(appDataBufferSp,
                                         record.d_appDataUnpaddedLen);
@@ -5087,82 +6384,949 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     (*appData)->appendDataBuffer(appDataBlobBuffer);
 }
 
-void FileStore::flushIfNeeded(bool immediateFlush)
-{
-    if (immediateFlush ||
-        d_storageEventBuilder.messageCount() >= d_nagglePacketCount) {
-        dispatcherFlush(true, false);
-    }
-}
-
-// CREATORS
-FileStore::FileStore(const DataStoreConfig&  config,
-                     int                     processorId,
-                     mqbi::Dispatcher*       dispatcher,
-                     mqbnet::Cluster*        cluster,
-                     mqbstat::ClusterStats*  clusterStats,
-                     BlobSpPool*             blobSpPool,
-                     StateSpPool*            statePool,
-                     bdlmt::FixedThreadPool* miscWorkThreadPool,
-                     bool                    isCSLModeEnabled,
-                     bool                    isFSMWorkflow,
-                     int                     replicationFactor,
-                     bslma::Allocator*       allocator)
-: d_allocator_p(allocator)
-, d_allocators(allocator)
-, d_storageAllocatorStore(d_allocators.get("QueueStorage"))
-, d_config(config)
-, d_partitionDescription(allocator)
-, d_dispatcherClientData()
-, d_clusterStats_p(clusterStats)
-, d_blobSpPool_p(blobSpPool)
-, d_statePool_p(statePool)
-, d_aliasedBufferDeleterSpPool(1024, d_allocators.get("AliasedBufferDeleters"))
-, d_isOpen(false)
-, d_isStopping(false)
-, d_lastSyncPtReceived(false)
-, d_records(10000, d_allocators.get("OutstandingRecords"))
-, d_unreceipted(d_allocators.get("UnreceiptedRecords"))
-, d_replicationFactor(replicationFactor)
-, d_nodes(allocator)
-, d_lastRecoveredStrongConsistency()
-, d_fileSets(allocator)
-, d_cluster_p(cluster)
-, d_miscWorkThreadPool_p(miscWorkThreadPool)
-, d_storageEventBuilder(FileStoreProtocol::k_VERSION,
-                        bmqp::EventType::e_STORAGE,
-                        config.bufferFactory(),
-                        allocator)
-, d_syncPointEventHandle()
-, d_partitionHighwatermarkEventHandle()
-, d_isPrimary(false)
-, d_primaryNode_p(0)
-, d_primaryLeaseId(0)
-, d_sequenceNum(0)
-, d_syncPoints(allocator)
-, d_storages(allocator)
-, d_isCSLModeEnabled(isCSLModeEnabled)
-, d_isFSMWorkflow(isFSMWorkflow)
-, d_ignoreCrc32c(false)
-, d_nagglePacketCount(k_NAGLE_PACKET_COUNT)
+FileSet* FileStore::rolloverCopySource(bsls::Types::Uint64*   offset,
+                                       const DataStoreRecord& record) const
 {
     // PRECONDITIONS
-    BSLS_ASSERT(allocator);
-    BSLS_ASSERT(d_cluster_p);
-    BSLS_ASSERT(1 <= clusterSize());
+    BSLS_ASSERT_SAFE(offset);
 
-    mwcu::MemOutStream os;
-    os << "PartitionId [" << d_config.partitionId()
-       << "] (cluster: " << d_cluster_p->name() << "): ";
-    d_partitionDescription.assign(os.str().data(), os.str().length());
+    if (!d_rolloverCopyFromFileSet || record.d_isCold ||
+        record.d_messageOffset + record.d_dataOrQlistRecordPaddedLen <=
+            d_rolloverCopyWatermark.loadAcquire()) {
+        return 0;  // RETURN
+    }
 
-    dispatcher->registerClient(this,
-                               mqbi::DispatcherClientType::e_QUEUE,
-                               processorId);
+    // Find the last range starting at or before the payload.
 
-    d_alarmSoftLimiter.initialize(1, 15 * bdlt::TimeUnitRatio::k_NS_PER_M);
-    // Throttling of one maximum alarm per 15 minutes
-}
+    const bsls::Types::Uint64 messageOffset = record.d_messageOffset;
+
+    size_t begin = 0;
+    size_t end   = d_rolloverCopySlices.size();
+    while (begin < end) {
+        const size_t middle = begin + (end - begin) / 2;
+        if (d_rolloverCopySlices[middle].d_toOffset <= messageOffset) {
+            begin = middle + 1;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    if (0 == begin) {
+        return 0;  // RETURN
+    }
+
+    const RolloverCopySlice& slice = d_rolloverCopySlices[begin - 1];
+    if (messageOffset >= slice.d_toOffset + slice.d_length) {
+        // Payload written after the rollover.
+
+        return 0;  // RETURN
+    }
+
+    *offset = slice.d_fromOffset + (messageOffset - slice.d_toOffset);
+    return d_rolloverCopyFromFileSet.get();
+}
+
+bsls::Types::Uint64 FileStore::rolloverCopyPendingBytes() const
+{
+    if (!d_rolloverCopyFromFileSet) {
+        return 0;  // RETURN
+    }
+
+    const RolloverCopySlice&  lastSlice = d_rolloverCopySlices.back();
+    const bsls::Types::Uint64 end = lastSlice.d_toOffset + lastSlice.d_length;
+    return end - bsl::min(end, d_rolloverCopyWatermark.loadAcquire());
+}
+
+bool FileStore::isReplicationWindowFull() const
+{
+    const int threshold = d_config.replicationBatchingThreshold();
+    if (0 >= threshold || d_unreceipted.empty()) {
+        return false;  // RETURN
+    }
+
+    // Receipts are cumulative, so every record replicated before the oldest
+    // message still waiting for its Receipts is settled.
+
+    const bsls::Types::Uint64 numInFlight =
+        FileStoreUtil::numRecordsReplicatedSince(d_unreceipted.begin()->first,
+                                                 d_replicatedKey);
+    return numInFlight >= static_cast<bsls::Types::Uint64>(threshold);
+}
+
+void FileStore::flushIfNeeded(bool immediateFlush)
+{
+    const int messageCount = d_storageEventBuilder.messageCount();
+
+    bool needFlush = immediateFlush;
+    if (!needFlush) {
+        if (isReplicationWindowFull()) {
+            // Keep batching, up to the largest batch, until Receipts reopen
+            // the window (see 'processReceipt').  Note that full batches and
+            // SyncPts, issued every second, are still replicated, so the
+            // window is not a bound on the records in flight.
+            needFlush = messageCount >=
+                        bsl::max(d_nagglePacketCount, k_NAGLE_PACKET_COUNT);
+        }
+        else {
+            needFlush = messageCount >= d_nagglePacketCount;
+        }
+    }
+
+    if (needFlush) {
+        broadcastStorageEvent();
+        writebackIfNeeded(false);
+    }
+}
+
+void FileStore::broadcastStorageEvent()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (0 == d_storageEventBuilder.messageCount()) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_TRACE << partitionDesc() << "Flushing "
+                   << d_storageEventBuilder.messageCount()
+                   << " STORAGE messages.";
+    const int maxChannelPendingItems = d_cluster_p->broadcast(
+        d_storageEventBuilder.blob());
+    if (0 == d_config.replicationBatchSize()) {
+        if (maxChannelPendingItems > 0) {
+            if (d_nagglePacketCount < k_NAGLE_PACKET_COUNT) {
+                // back off
+                ++d_nagglePacketCount;
+            }
+        }
+        else if (d_nagglePacketCount) {
+            --d_nagglePacketCount;
+        }
+    }
+    // else the batch size is fixed by configuration
+    d_storageEventBuilder.reset();
+
+    d_replicatedKey        = d_lastPackedKey;
+    d_replicatedReceiptKey = d_lastPackedReceiptKey;
+
+    for (NodeReceiptContexts::const_iterator it = d_nodes.begin();
+         it != d_nodes.end();
+         ++it) {
+        reportReplicaLag(it->first, it->second.d_key);
+    }
+}
+
+void FileStore::reportReplicaLag(int                       nodeId,
+                                 const DataStoreRecordKey& lastReceiptKey)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (nodeId == d_config.nodeId()) {
+        return;  // RETURN
+    }
+
+    bsls::Types::Int64 lag = 0;
+    if (lastReceiptKey < d_replicatedReceiptKey) {
+        // The replica has not receipted the last replicated message which
+        // requested a Receipt: it lags by all the records replicated since
+        // its last Receipt.
+        lag = d_replicatedKey.d_sequenceNum;
+        if (lastReceiptKey.d_primaryLeaseId ==
+            d_replicatedKey.d_primaryLeaseId) {
+            lag -= lastReceiptKey.d_sequenceNum;
+        }
+    }
+
+    d_clusterStats_p->setPartitionReplicaLag(d_config.partitionId(),
+                                             nodeId,
+                                             lag);
+}
+
+void FileStore::writebackIfNeeded(bool force)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isAsyncWriteback || !d_isOpen) {
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+    const FileSet* activeFileSet = d_fileSets[0].get();
+
+    bsls::Types::Uint64 numDirtyBytes =
+        (activeFileSet->d_dataFilePosition -
+         activeFileSet->d_dataFileWritebackPosition) +
+        (activeFileSet->d_journalFilePosition -
+         activeFileSet->d_journalFileWritebackPosition);
+    if (!d_isFSMWorkflow) {
+        numDirtyBytes += activeFileSet->d_qlistFilePosition -
+                         activeFileSet->d_qlistFileWritebackPosition;
+    }
+
+    if (0 == numDirtyBytes && 0 == d_pendingReceiptNode_p) {
+        d_isGroupCommitExpired = false;
+        return;  // RETURN
+    }
+
+    if (d_isGroupCommitExpired) {
+        // The window expired while a write back was in progress: sync the
+        // records written during it now, instead of opening a new window.
+        force = true;
+    }
+
+    if (!force) {
+        if (!d_isSyncBeforeReceipt) {
+            if (numDirtyBytes < k_WRITEBACK_MIN_BYTES) {
+                return;  // RETURN
+            }
+        }
+        else if (bsls::TimeInterval() != d_groupCommitMaxDelay &&
+                 numDirtyBytes < d_groupCommitMaxBytes) {
+            // Group commit: postpone the durable sync so that the records
+            // written until the window expires (or until enough bytes are
+            // pending) are covered by a single sync.  Note that the window is
+            // opened even if a write back is in progress, so that it bounds
+            // the delay of the records written meanwhile as well.
+            if (!d_isGroupCommitScheduled) {
+                d_isGroupCommitScheduled = true;
+                d_config.scheduler()->scheduleEvent(
+                    &d_groupCommitEventHandle,
+                    mwcsys::Time::nowMonotonicClock() + d_groupCommitMaxDelay,
+                    bdlf::BindUtil::bind(&FileStore::groupCommitTimeoutCb,
+                                         this,
+                                         ++d_groupCommitGeneration));
+            }
+            return;  // RETURN
+        }
+    }
+
+    if (d_isWritebackInProgress) {
+        // Dirty ranges accumulated while a write back is in progress are
+        // coalesced into the next one, initiated upon its completion.
+        return;  // RETURN
+    }
+
+    if (d_isGroupCommitScheduled) {
+        // The window is closed early.  Ok to ignore rc: a timeout already in
+        // flight is ignored, since it belongs to a previous generation.
+        d_config.scheduler()->cancelEvent(&d_groupCommitEventHandle);
+        d_isGroupCommitScheduled = false;
+        ++d_groupCommitGeneration;
+    }
+    d_isGroupCommitExpired = false;
+
+    WritebackContext context;
+    prepareWriteback(&context);
+
+    d_isWritebackInProgress = true;
+    int rc                  = d_writebackThreadPool.enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::writebackWorkerDispatched,
+                             this,
+                             context));
+    BSLS_ASSERT_SAFE(rc == 0);
+    (void)rc;  // Compiler happiness
+}
+
+void FileStore::groupCommitTimeoutCb(unsigned int generation)
+{
+    // executed by the *SCHEDULER* thread
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::groupCommitTimeoutDispatched,
+                                 this,
+                                 generation));
+}
+
+void FileStore::groupCommitTimeoutDispatched(unsigned int generation)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (!d_isGroupCommitScheduled || generation != d_groupCommitGeneration) {
+        // The window was closed early, and possibly another one opened,
+        // while this timeout was in flight.
+        return;  // RETURN
+    }
+
+    d_isGroupCommitScheduled = false;
+    ++d_groupCommitGeneration;
+
+    // If a write back is in progress, the records written during the window
+    // are synced as soon as it completes (see 'writebackIfNeeded').
+    d_isGroupCommitExpired = true;
+    writebackIfNeeded(true);
+}
+
+bool FileStore::prepareWriteback(WritebackContext* context)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(context);
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+
+    context->d_fileSet       = d_fileSets[0];
+    context->d_dataFileBegin = activeFileSet->d_dataFileWritebackPosition;
+    context->d_dataFileEnd   = activeFileSet->d_dataFilePosition;
+    context->d_journalFileBegin =
+        activeFileSet->d_journalFileWritebackPosition;
+    context->d_journalFileEnd = activeFileSet->d_journalFilePosition;
+    if (!d_isFSMWorkflow) {
+        context->d_qlistFileBegin =
+            activeFileSet->d_qlistFileWritebackPosition;
+        context->d_qlistFileEnd = activeFileSet->d_qlistFilePosition;
+    }
+    context->d_syncKey = DataStoreRecordKey(d_sequenceNum, d_primaryLeaseId);
+    context->d_receiptNode_p = d_pendingReceiptNode_p;
+    context->d_receiptKey    = d_pendingReceiptKey;
+    d_pendingReceiptNode_p   = 0;
+
+    activeFileSet->d_dataFileWritebackPosition    = context->d_dataFileEnd;
+    activeFileSet->d_journalFileWritebackPosition = context->d_journalFileEnd;
+    activeFileSet->d_qlistFileWritebackPosition   = context->d_qlistFileEnd;
+
+    return context->d_dataFileBegin != context->d_dataFileEnd ||
+           context->d_journalFileBegin != context->d_journalFileEnd ||
+           context->d_qlistFileBegin != context->d_qlistFileEnd ||
+           0 != context->d_receiptNode_p;
+}
+
+int FileStore::writeback(const WritebackContext& context)
+{
+    // executed by *ANY* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(context.d_fileSet);
+
+    const FileSet&     fileSet = *context.d_fileSet;
+    mwcu::MemOutStream errorDesc;
+
+    int rc = FileSystemUtil::writeback(fileSet.d_dataFile,
+                                       context.d_dataFileBegin,
+                                       context.d_dataFileEnd -
+                                           context.d_dataFileBegin,
+                                       d_isSyncBeforeReceipt,
+                                       errorDesc);
+    if (0 != rc) {
+        MWCTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Failed to write back data file ["
+            << fileSet.d_dataFileName << "], rc: " << rc
+            << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+        return rc;  // RETURN
+    }
+
+    rc = FileSystemUtil::writeback(fileSet.d_journalFile,
+                                   context.d_journalFileBegin,
+                                   context.d_journalFileEnd -
+                                       context.d_journalFileBegin,
+                                   d_isSyncBeforeReceipt,
+                                   errorDesc);
+    if (0 != rc) {
+        MWCTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Failed to write back journal ["
+            << fileSet.d_journalFileName << "], rc: " << rc
+            << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+        return rc;  // RETURN
+    }
+
+    if (context.d_qlistFileBegin != context.d_qlistFileEnd) {
+        rc = FileSystemUtil::writeback(fileSet.d_qlistFile,
+                                       context.d_qlistFileBegin,
+                                       context.d_qlistFileEnd -
+                                           context.d_qlistFileBegin,
+                                       d_isSyncBeforeReceipt,
+                                       errorDesc);
+        if (0 != rc) {
+            MWCTSK_ALARMLOG_ALARM("FILE_IO")
+                << partitionDesc() << "Failed to write back qlist file ["
+                << fileSet.d_qlistFileName << "], rc: " << rc
+                << ", error: " << errorDesc.str() << MWCTSK_ALARMLOG_END;
+            return rc;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void FileStore::writebackWorkerDispatched(const WritebackContext& context)
+{
+    // executed by the *WRITE BACK* thread
+
+    const bsls::Types::Int64 startTime = mwcsys::Time::highResolutionTimer();
+    const int                status    = writeback(context);
+    const bsls::Types::Int64 elapsed   = mwcsys::Time::highResolutionTimer() -
+                                         startTime;
+
+    execute(bdlf::BindUtil::bind(&FileStore::writebackCompleteDispatched,
+                                 this,
+                                 status,
+                                 elapsed,
+                                 context));
+}
+
+void FileStore::writebackCompleteDispatched(int                     status,
+                                            bsls::Types::Int64      elapsed,
+                                            const WritebackContext& context)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_isWritebackInProgress = false;
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    onWritebackComplete(status, elapsed, context);
+
+    // Initiate the write back of what has been written meanwhile.
+    writebackIfNeeded(false);
+}
+
+void FileStore::onWritebackComplete(int                     status,
+                                    bsls::Types::Int64      elapsed,
+                                    const WritebackContext& context)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isSyncBeforeReceipt) {
+        return;  // RETURN
+    }
+
+    if (0 == status) {
+        d_clusterStats_p->onPartitionEvent(
+            mqbstat::ClusterStats::PartitionEventType::e_PARTITION_SYNC,
+            d_config.partitionId(),
+            elapsed);
+        d_clusterStats_p->onPartitionEvent(
+            mqbstat::ClusterStats::PartitionEventType::e_PARTITION_SYNC_BATCH,
+            d_config.partitionId(),
+            context.numBytes());
+    }
+
+    if (0 != status) {
+        // Records are not known to be durable; keep them unreceipted.  The
+        // next successful write back covers them (Receipts are cumulative).
+        if (context.d_receiptNode_p && 0 == d_pendingReceiptNode_p) {
+            d_pendingReceiptNode_p = context.d_receiptNode_p;
+            d_pendingReceiptKey    = context.d_receiptKey;
+        }
+        return;  // RETURN
+    }
+
+    if (d_isPrimary) {
+        if (!d_isStopping) {
+            processReceipt(context.d_syncKey, d_config.nodeId());
+        }
+    }
+    else if (context.d_receiptNode_p) {
+        issueReceipt(context.d_receiptNode_p,
+                     context.d_receiptKey.d_primaryLeaseId,
+                     context.d_receiptKey.d_sequenceNum);
+    }
+}
+
+void FileStore::writebackSync()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isAsyncWriteback) {
+        return;  // RETURN
+    }
+
+    // Wait for the in-flight write back, if any.  Note that its completion
+    // is still processed asynchronously by this thread.
+    d_writebackThreadPool.drain();
+
+    if (d_isGroupCommitScheduled) {
+        // Ok to ignore rc
+        d_config.scheduler()->cancelEvent(&d_groupCommitEventHandle);
+        d_isGroupCommitScheduled = false;
+        ++d_groupCommitGeneration;
+    }
+    d_isGroupCommitExpired = false;
+
+    WritebackContext context;
+    if (!prepareWriteback(&context)) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 startTime = mwcsys::Time::highResolutionTimer();
+    const int                status    = writeback(context);
+    if (d_isOpen) {
+        onWritebackComplete(status,
+                            mwcsys::Time::highResolutionTimer() - startTime,
+                            context);
+    }
+}
+
+void FileStore::snapshotIndexIfNeeded()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+    BSLS_ASSERT_SAFE(!d_syncPoints.empty());
+
+    if (0 == d_indexSnapshotIntervalNs || d_isIndexSnapshotInProgress ||
+        !d_isOpen) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    if (0 != d_lastIndexSnapshotTime &&
+        (now - d_lastIndexSnapshotTime) < d_indexSnapshotIntervalNs) {
+        return;  // RETURN
+    }
+
+    // The snapshot is taken as of the sync point which has just been written,
+    // which is the last record of the journal.  Only the outstanding records
+    // preceding it are copied, in batches, in this thread (see
+    // 'snapshotIndexCopyDispatched'), the fields read from the journal being
+    // populated, and the snapshot written, by a worker thread.
+
+    const FileSet*     activeFileSet = d_fileSets[0].get();
+    const MemoryBlock& journalBlock  = activeFileSet->d_journalFile.block();
+    const bmqp_ctrlmsg::SyncPointOffsetPair& spoPair = d_syncPoints.back();
+    BSLS_ASSERT_SAFE(spoPair.offset() ==
+                     (activeFileSet->d_journalFilePosition -
+                      FileStoreProtocol::k_JOURNAL_RECORD_SIZE));
+
+    const OffsetPtr<const JournalOpRecord> syncPointRec(journalBlock,
+                                                        spoPair.offset());
+
+    d_indexSnapshot_sp.createInplace(d_allocator_p, d_allocator_p);
+    IndexSnapshot& snapshot    = *d_indexSnapshot_sp;
+    snapshot.d_partitionId     = d_config.partitionId();
+    snapshot.d_syncPointOffset = spoPair.offset();
+    snapshot.d_primaryLeaseId  = syncPointRec->header().primaryLeaseId();
+    snapshot.d_sequenceNum     = syncPointRec->header().sequenceNumber();
+    snapshot.d_timestamp       = syncPointRec->header().timestamp();
+    snapshot.d_dataFileOffset  = activeFileSet->d_dataFilePosition;
+    if (!d_isFSMWorkflow) {
+        snapshot.d_qlistFileOffset = activeFileSet->d_qlistFilePosition;
+    }
+    snapshot.d_syncPoints.assign(d_syncPoints.begin(), d_syncPoints.end());
+    snapshot.d_records.reserve(d_records.size());
+
+    d_indexSnapshotKey = DataStoreRecordKey(snapshot.d_sequenceNum,
+                                            snapshot.d_primaryLeaseId);
+    d_indexSnapshotCursor       = d_records.begin();
+    d_isIndexSnapshotInProgress = true;
+    d_lastIndexSnapshotTime     = now;
+
+    snapshotIndexCopyDispatched();
+}
+
+void FileStore::snapshotIndexCopyDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (!d_indexSnapshot_sp) {
+        // The snapshot has been cancelled, or has already been handed to a
+        // worker thread by another invocation of this method.
+
+        return;  // RETURN
+    }
+
+    // Records are ordered by key in 'd_records', so the records following
+    // the sync point are the ones appended to it since the snapshot was
+    // started.
+
+    for (size_t n = 0; n < k_INDEX_SNAPSHOT_BATCH_SIZE &&
+                       d_indexSnapshotCursor != d_records.end() &&
+                       !(d_indexSnapshotKey < d_indexSnapshotCursor->first);
+         ++n, ++d_indexSnapshotCursor) {
+        copyIndexSnapshotRecord(&d_indexSnapshot_sp->d_records,
+                                d_indexSnapshotCursor->first,
+                                d_indexSnapshotCursor->second);
+    }
+
+    if (d_indexSnapshotCursor != d_records.end() &&
+        !(d_indexSnapshotKey < d_indexSnapshotCursor->first)) {
+        // Copy the next batch once the events already enqueued have been
+        // processed.
+
+        execute(bdlf::BindUtil::bind(&FileStore::snapshotIndexCopyDispatched,
+                                     this));
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<IndexSnapshot> snapshot;
+    snapshot.swap(d_indexSnapshot_sp);
+
+    // Alias the active file set so that it stays mapped while the worker
+    // thread reads its JOURNAL and QLIST files, even if it is rolled over
+    // and archived meanwhile.
+
+    FileSet*               activeFileSet = d_fileSets[0].get();
+    AliasedBufferDeleterSp fileSetAlias =
+        d_aliasedBufferDeleterSpPool.getObject();
+    fileSetAlias->setFileSet(activeFileSet);
+
+    bsl::string path(d_allocator_p);
+    FileStoreUtil::createIndexSnapshotFileName(
+        &path,
+        activeFileSet->d_journalFileName);
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::snapshotIndexWorkerDispatched,
+                             this,
+                             path,
+                             snapshot,
+                             activeFileSet,
+                             fileSetAlias));
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue the write of "
+                      << "the index snapshot [" << path << "], rc: " << rc;
+        d_isIndexSnapshotInProgress = false;
+    }
+}
+
+void FileStore::snapshotIndexRecordIfPending(const RecordIterator& recordIt)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (!d_indexSnapshot_sp || d_indexSnapshotCursor == d_records.end() ||
+        recordIt->first < d_indexSnapshotCursor->first ||
+        d_indexSnapshotKey < recordIt->first) {
+        // No snapshot is being copied, or the record has already been copied,
+        // or it follows the sync point as of which the snapshot is taken.
+
+        return;  // RETURN
+    }
+
+    // The record was outstanding as of the sync point, so it must be part of
+    // the snapshot even though its removal follows the sync point in the
+    // journal.  Unless it is the next record to copy, this copies it out of
+    // order, which is fixed by the worker thread.
+
+    copyIndexSnapshotRecord(&d_indexSnapshot_sp->d_records,
+                            recordIt->first,
+                            recordIt->second);
+
+    if (recordIt == d_indexSnapshotCursor) {
+        ++d_indexSnapshotCursor;
+    }
+}
+
+void FileStore::cancelIndexSnapshot()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_indexSnapshot_sp) {
+        return;  // RETURN
+    }
+
+    d_indexSnapshot_sp.reset();
+    d_isIndexSnapshotInProgress = false;
+}
+
+void FileStore::snapshotIndexWorkerDispatched(
+    const bsl::string&                    path,
+    const bsl::shared_ptr<IndexSnapshot>& snapshot,
+    const FileSet*                        fileSet,
+    BSLS_ANNOTATION_UNUSED const AliasedBufferDeleterSp& fileSetAlias)
+{
+    // executed by a *WORKER* thread
+
+    IndexSnapshot::Records& records = snapshot->d_records;
+    if (records.end() != bsl::adjacent_find(records.begin(),
+                                            records.end(),
+                                            &isIndexSnapshotRecordNotLess)) {
+        // Records removed before being copied were copied out of order (see
+        // 'snapshotIndexRecordIfPending').
+
+        bsl::sort(records.begin(), records.end(), &isIndexSnapshotRecordLess);
+    }
+
+    // Populate the fields read from the JOURNAL and QLIST files, which are
+    // never modified once written.
+
+    const MemoryBlock& journalBlock = fileSet->d_journalFile.block();
+
+    typedef bsl::unordered_set<mqbu::StorageKey,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
+                StorageKeys;
+    StorageKeys deletedAppKeys;
+
+    for (IndexSnapshot::Records::iterator it = records.begin();
+         it != records.end();
+         ++it) {
+        IndexSnapshot::Record& entry = *it;
+
+        if (RecordType::e_MESSAGE == entry.d_record.d_recordType) {
+            const OffsetPtr<const MessageRecord> rec(
+                journalBlock,
+                entry.d_record.d_recordOffset);
+            entry.d_record.d_arrivalTimestamp = rec->header().timestamp();
+            entry.d_queueKey                  = rec->queueKey();
+            entry.d_guid                      = rec->messageGUID();
+        }
+        else if (RecordType::e_CONFIRM == entry.d_record.d_recordType) {
+            const OffsetPtr<const ConfirmRecord> rec(
+                journalBlock,
+                entry.d_record.d_recordOffset);
+            entry.d_queueKey = rec->queueKey();
+            entry.d_appKey   = rec->appKey();
+            entry.d_guid     = rec->messageGUID();
+        }
+        else {
+            BSLS_ASSERT_SAFE(RecordType::e_QUEUE_OP ==
+                             entry.d_record.d_recordType);
+
+            const OffsetPtr<const QueueOpRecord> rec(
+                journalBlock,
+                entry.d_record.d_recordOffset);
+            entry.d_queueKey = rec->queueKey();
+            entry.d_appKey   = rec->appKey();
+
+            if (d_isFSMWorkflow) {
+                continue;  // CONTINUE
+            }
+
+            if (QueueOpType::e_DELETION == rec->type()) {
+                deletedAppKeys.insert(rec->appKey());
+                continue;  // CONTINUE
+            }
+
+            if (QueueOpType::e_CREATION != rec->type() &&
+                QueueOpType::e_ADDITION != rec->type()) {
+                continue;  // CONTINUE
+            }
+
+            // Retrieve the queue uri and appId/appKey pairs from the QLIST
+            // record.
+
+            const MemoryBlock& qlistBlock = fileSet->d_qlistFile.block();
+            const bsls::Types::Uint64 queueUriRecOffset =
+                static_cast<bsls::Types::Uint64>(
+                    rec->queueUriRecordOffsetWords()) *
+                bmqp::Protocol::k_WORD_SIZE;
+            const OffsetPtr<const QueueRecordHeader> queueRecHeader(
+                qlistBlock,
+                queueUriRecOffset);
+            const unsigned int queueRecHeaderLen =
+                queueRecHeader->headerWords() * bmqp::Protocol::k_WORD_SIZE;
+            const unsigned int paddedUriLen =
+                queueRecHeader->queueUriLengthWords() *
+                bmqp::Protocol::k_WORD_SIZE;
+            const unsigned int queueRecLength =
+                queueRecHeader->queueRecordWords() *
+                bmqp::Protocol::k_WORD_SIZE;
+
+            const char* uriBegin = qlistBlock.base() + queueUriRecOffset +
+                                   queueRecHeaderLen;
+            DataStoreConfigQueueInfo& qinfo =
+                snapshot->d_queues[rec->queueKey()];
+            qinfo.setPartitionId(snapshot->d_partitionId);
+            qinfo.setCanonicalQueueUri(
+                bsl::string(uriBegin,
+                            paddedUriLen - uriBegin[paddedUriLen - 1],
+                            d_allocator_p));
+
+            MemoryBlock appIdsBlock(uriBegin + paddedUriLen +
+                                        FileStoreProtocol::k_HASH_LENGTH,
+                                    queueRecLength - queueRecHeaderLen -
+                                        paddedUriLen -
+                                        FileStoreProtocol::k_HASH_LENGTH -
+                                        sizeof(unsigned int));  // Magic
+            AppIdKeyPairs appIdKeyPairs;
+            FileStoreProtocolUtil::loadAppIdKeyPairs(
+                &appIdKeyPairs,
+                appIdsBlock,
+                queueRecHeader->numAppIds());
+            for (size_t n = 0; n < appIdKeyPairs.size(); ++n) {
+                qinfo.addAppIdKeyPair(appIdKeyPairs[n]);
+            }
+        }
+    }
+
+    // Exclude the appIds which have been deleted, as the recovery does.
+
+    for (IndexSnapshot::QueueKeyInfoMap::iterator qit =
+             snapshot->d_queues.begin();
+         !deletedAppKeys.empty() && qit != snapshot->d_queues.end();
+         ++qit) {
+        const AppIdKeyPairs& appIdKeyPairs = qit->second.appIdKeyPairs();
+        DataStoreConfigQueueInfo qinfo(d_allocator_p);
+        qinfo.setPartitionId(qit->second.partitionId());
+        qinfo.setCanonicalQueueUri(qit->second.canonicalQueueUri());
+        for (size_t n = 0; n < appIdKeyPairs.size(); ++n) {
+            if (0 == deletedAppKeys.count(appIdKeyPairs[n].second)) {
+                qinfo.addAppIdKeyPair(appIdKeyPairs[n]);
+            }
+        }
+        qit->second = qinfo;
+    }
+
+    mwcu::MemOutStream errorDesc;
+    const int rc = IndexSnapshotUtil::save(errorDesc, path, *snapshot);
+
+    execute(bdlf::BindUtil::bind(&FileStore::snapshotIndexCompleteDispatched,
+                                 this,
+                                 rc,
+                                 bsl::string(errorDesc.str(), d_allocator_p),
+                                 path));
+}
+
+void FileStore::snapshotIndexCompleteDispatched(
+    int                status,
+    const bsl::string& errorDescription,
+    const bsl::string& path)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_isIndexSnapshotInProgress = false;
+
+    bsl::string activePath(d_allocator_p);
+    if (d_isOpen && !d_fileSets.empty()) {
+        FileStoreUtil::createIndexSnapshotFileName(
+            &activePath,
+            d_fileSets[0]->d_journalFileName);
+    }
+
+    if (0 != status || activePath != path) {
+        // Either the write failed, or the file set has been rolled over (and
+        // possibly archived) meanwhile.  Remove the snapshot, which is either
+        // invalid or useless.
+
+        if (0 != status) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to write index "
+                          << "snapshot [" << path << "], rc: " << status
+                          << ", reason: " << errorDescription;
+        }
+
+        bdls::FilesystemUtil::remove(path);
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Wrote index snapshot [" << path
+                  << "].";
+}
+
+// CREATORS
+FileStore::FileStore(const DataStoreConfig&  config,
+                     int                     processorId,
+                     mqbi::Dispatcher*       dispatcher,
+                     mqbnet::Cluster*        cluster,
+                     mqbstat::ClusterStats*  clusterStats,
+                     BlobSpPool*             blobSpPool,
+                     StateSpPool*            statePool,
+                     bdlmt::FixedThreadPool* miscWorkThreadPool,
+                     bool                    isCSLModeEnabled,
+                     bool                    isFSMWorkflow,
+                     int                     replicationFactor,
+                     bslma::Allocator*       allocator)
+: d_allocator_p(allocator)
+, d_allocators(allocator)
+, d_storageAllocatorStore(d_allocators.get("QueueStorage"))
+, d_config(config)
+, d_partitionDescription(allocator)
+, d_dispatcherClientData()
+, d_clusterStats_p(clusterStats)
+, d_blobSpPool_p(blobSpPool)
+, d_statePool_p(statePool)
+, d_aliasedBufferDeleterSpPool(1024, d_allocators.get("AliasedBufferDeleters"))
+, d_isOpen(false)
+, d_isStopping(false)
+, d_lastSyncPtReceived(false)
+, d_records(10000, d_allocators.get("OutstandingRecords"))
+, d_unreceipted(d_allocators.get("UnreceiptedRecords"))
+, d_replicationFactor(replicationFactor)
+, d_nodes(allocator)
+, d_lastRecoveredStrongConsistency()
+, d_fileSets(allocator)
+, d_cluster_p(cluster)
+, d_miscWorkThreadPool_p(miscWorkThreadPool)
+, d_storageEventBuilder(FileStoreProtocol::k_VERSION,
+                        bmqp::EventType::e_STORAGE,
+                        config.bufferFactory(),
+                        allocator)
+, d_syncPointEventHandle()
+, d_partitionHighwatermarkEventHandle()
+, d_isPrimary(false)
+, d_primaryNode_p(0)
+, d_primaryLeaseId(0)
+, d_sequenceNum(0)
+, d_syncPoints(allocator)
+, d_storages(allocator)
+, d_isCSLModeEnabled(isCSLModeEnabled)
+, d_isFSMWorkflow(isFSMWorkflow)
+, d_ignoreCrc32c(false)
+, d_nagglePacketCount(0 < config.replicationBatchSize()
+                         ? config.replicationBatchSize()
+                         : k_NAGLE_PACKET_COUNT)
+, d_isAsyncWriteback(config.writeBackend() ==
+                     mqbcfg::StorageWriteBackend::E_ASYNC_WRITEBACK)
+, d_isSyncBeforeReceipt(d_isAsyncWriteback && config.hasSyncBeforeReceipt())
+, d_writebackThreadPool(1, k_WRITEBACK_MAX_PENDING_JOBS, allocator)
+, d_isWritebackInProgress(false)
+, d_pendingReceiptNode_p(0)
+, d_pendingReceiptKey()
+, d_groupCommitMaxDelay(
+      bsls::TimeInterval().addMilliseconds(config.groupCommitMaxDelayMs()))
+, d_groupCommitMaxBytes(config.groupCommitMaxBytes())
+, d_groupCommitEventHandle()
+, d_isGroupCommitScheduled(false)
+, d_groupCommitGeneration(0)
+, d_isGroupCommitExpired(false)
+, d_indexSnapshotIntervalNs(
+      static_cast<bsls::Types::Int64>(config.indexSnapshotIntervalMs()) *
+      bdlt::TimeUnitRatio::k_NS_PER_MS)
+, d_lastIndexSnapshotTime(0)
+, d_isIndexSnapshotInProgress(false)
+, d_indexSnapshot_sp()
+, d_indexSnapshotKey()
+, d_indexSnapshotCursor()
+, d_rolloverCopyFromFileSet()
+, d_rolloverCopySlices(allocator)
+, d_rolloverCopyWatermark(0)
+, d_rolloverCopySemaphore()
+, d_rolloverCopySyncPointOffset(0)
+, d_rolloverCopyFileName(allocator)
+, d_rolloverCopyStartTime(0)
+, d_rolloverCopyGeneration(0)
+, d_lastPackedKey()
+, d_lastPackedReceiptKey()
+, d_replicatedKey()
+, d_replicatedReceiptKey()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(allocator);
+    BSLS_ASSERT(d_cluster_p);
+    BSLS_ASSERT(1 <= clusterSize());
+
+    mwcu::MemOutStream os;
+    os << "PartitionId [" << d_config.partitionId()
+       << "] (cluster: " << d_cluster_p->name() << "): ";
+    d_partitionDescription.assign(os.str().data(), os.str().length());
+
+    dispatcher->registerClient(this,
+                               mqbi::DispatcherClientType::e_QUEUE,
+                               processorId);
+
+    d_alarmSoftLimiter.initialize(1, 15 * bdlt::TimeUnitRatio::k_NS_PER_M);
+    // Throttling of one maximum alarm per 15 minutes
+}
 
 FileStore::~FileStore()
 {
@@ -5178,7 +7342,8 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
     enum {
         rc_SUCCESS                   = 0,
         rc_NON_RECOVERY_MODE_FAILURE = -1,
-        rc_RECOVERY_MODE_FAILURE     = -2
+        rc_RECOVERY_MODE_FAILURE     = -2,
+        rc_WRITEBACK_THREAD_FAILURE  = -3
     };
 
     BALL_LOG_INFO_BLOCK
@@ -5193,6 +7358,12 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
         return rc_SUCCESS;  // RETURN
     }
 
+    if (d_isAsyncWriteback && 0 != d_writebackThreadPool.start()) {
+        BALL_LOG_ERROR << partitionDesc()
+                       << "Failed to start the write back thread.";
+        return rc_WRITEBACK_THREAD_FAILURE;  // RETURN
+    }
+
     mwcu::MemOutStream errorDescription;
     int rc = openInRecoveryMode(errorDescription, queueKeyInfoMap);
     if (rc == 0) {
@@ -5209,6 +7380,7 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
         if (0 != rc) {
             BALL_LOG_ERROR << partitionDesc() << "Recovery: failed to open in "
                            << "'non-recovery' mode, rc: " << rc;
+            d_writebackThreadPool.stop();
             return rc * 10 + rc_NON_RECOVERY_MODE_FAILURE;  // RETURN
         }
 
@@ -5219,6 +7391,7 @@ int FileStore::open(const QueueKeyInfoMap& queueKeyInfoMap)
         BALL_LOG_ERROR << partitionDesc() << "Failed to open in recovery mode,"
                        << " rc:" << rc << ", reason: ["
                        << errorDescription.str() << "].";
+        d_writebackThreadPool.stop();
         return rc_RECOVERY_MODE_FAILURE;  // RETURN
     }
 
@@ -5246,20 +7419,34 @@ void FileStore::close(bool flush)
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_groupCommitEventHandle);
     // Ok to ignore rc above
 
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
 
+    // Wait for the payloads carried over by the last rollover, if any, to be
+    // copied, so that the active file set is complete and the previous one
+    // can be released.
+    completeRolloverCopy();
+
     // Clear 'd_records' so that gc logic is invoked on all mapped data files.
     // Note that logic will be invoked in this thread.  Note that data file of
     // active file set will not be gc'd because its alias blob buffer count
     // will not go to 0 as its initialized with 1.
+    cancelIndexSnapshot();
     d_unreceipted.clear();
     d_records.clear();
 
     // After mapped data files have been gc'd, there should be only 1 file set
-    // remaining in 'd_fileSets' (the active one).  Truncate and close it out.
+    // remaining in 'd_fileSets' (the active one).  Write back whatever is
+    // left dirty, stop the write back thread, and truncate and close it out.
     BSLS_ASSERT_SAFE(1 == d_fileSets.size());
+    if (d_isAsyncWriteback) {
+        writebackSync();
+        d_writebackThreadPool.stop();
+        d_isWritebackInProgress = false;
+        d_pendingReceiptNode_p  = 0;
+    }
     truncate(d_fileSets[0].get());
     close(*d_fileSets[0], flush);
 }
@@ -5408,8 +7595,10 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
 
     // If 'd_replicationFactor' is 1, then the message need not be persisted to
     // any replicas (i.e. eventual consistency). Therefore the writing of the
-    // message by this node is sufficient to set the receipt.
-    if (1 == d_replicationFactor && !attributes->hasReceipt()) {
+    // message by this node is sufficient to set the receipt, unless it must
+    // first be durably synced.
+    if (1 == d_replicationFactor && !d_isSyncBeforeReceipt &&
+        !attributes->hasReceipt()) {
         attributes->setReceipt(true);
     }
 
@@ -5508,8 +7697,11 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
                            ReceiptContext(queueKey,
                                           guid,
                                           recordIt,
-                                          1,  // receipt count
+                                          d_isSyncBeforeReceipt ? 0 : 1,
                                           attributes->queueHandle())));
+        // Self node's Receipt is either the write above, or the completion
+        // of the durable write back of the record (see
+        // 'writebackCompleteDispatched').
         flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
     }
 
@@ -6038,8 +8230,10 @@ void FileStore::removeRecordRaw(const DataStoreRecordHandle& handle)
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
     if (RecordType::e_MESSAGE == record.d_recordType) {
-        activeFileSet->d_outstandingBytesData -=
-            record.d_dataOrQlistRecordPaddedLen;
+        bsls::Types::Uint64& outstandingBytes =
+            record.d_isCold ? activeFileSet->d_outstandingBytesCold
+                            : activeFileSet->d_outstandingBytesData;
+        outstandingBytes -= record.d_dataOrQlistRecordPaddedLen;
         cancelUnreceipted(recordIt->first);
     }
     else if (RecordType::e_QUEUE_OP == record.d_recordType) {
@@ -6049,6 +8243,7 @@ void FileStore::removeRecordRaw(const DataStoreRecordHandle& handle)
         }
     }
 
+    snapshotIndexRecordIfPending(recordIt);
     d_records.erase(recordIt);
 }
 
@@ -6134,9 +8329,18 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
             if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 == rc)) {
                 if (header.flags() &
                     bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED) {
-                    issueReceipt(source,
-                                 recHeader->primaryLeaseId(),
-                                 recHeader->sequenceNumber());
+                    if (d_isSyncBeforeReceipt) {
+                        // Defer the Receipt until the record is durable.
+                        d_pendingReceiptNode_p = source;
+                        d_pendingReceiptKey    = DataStoreRecordKey(
+                            recHeader->sequenceNumber(),
+                            recHeader->primaryLeaseId());
+                    }
+                    else {
+                        issueReceipt(source,
+                                     recHeader->primaryLeaseId(),
+                                     recHeader->sequenceNumber());
+                    }
                 }
             }
         }
@@ -6188,6 +8392,8 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
                 << MWCTSK_ALARMLOG_END;
         }
     }  // end: while loop
+
+    writebackIfNeeded(false);
 }
 
 int FileStore::processRecoveryEvent(const bsl::shared_ptr<bdlbb::Blob>& blob)
@@ -6793,23 +8999,14 @@ void FileStore::dispatcherFlush(bool storage, bool queues)
     BSLS_ASSERT_SAFE(d_isPrimary);
 
     if (storage) {
-        if (d_storageEventBuilder.messageCount() != 0) {
-            BALL_LOG_TRACE << partitionDesc() << "Flushing "
-                           << d_storageEventBuilder.messageCount()
-                           << " STORAGE messages.";
-            const int maxChannelPendingItems = d_cluster_p->broadcast(
-                d_storageEventBuilder.blob());
-            if (maxChannelPendingItems > 0) {
-                if (d_nagglePacketCount < k_NAGLE_PACKET_COUNT) {
-                    // back off
-                    ++d_nagglePacketCount;
-                }
-            }
-            else if (d_nagglePacketCount) {
-                --d_nagglePacketCount;
-            }
-            d_storageEventBuilder.reset();
+        if (!isReplicationWindowFull()) {
+            broadcastStorageEvent();
         }
+        // else keep batching until Receipts reopen the window (see
+        // 'flushIfNeeded').  Records which must reach the replicas right
+        // away use 'flushStorage' instead.
+
+        writebackIfNeeded(false);
     }
     if (queues && d_storageEventBuilder.messageCount() == 0) {
         // Empty 'd_storageEventBuilder' means it has been flushed and it is a
@@ -6897,7 +9094,7 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
         // If queues are idle, 'dispatcherFlush()' won't get called.
         // Internal-ticket D168465018.
 
-        dispatcherFlush(true, false);
+        flushIfNeeded(true);
     }
 
     return haveMore;
@@ -6969,6 +9166,18 @@ void FileStore::forceRollover()
     }
 }
 
+void FileStore::flushStorage()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+    BSLS_ASSERT_SAFE(d_isPrimary);
+
+    broadcastStorageEvent();
+    writebackIfNeeded(false);
+}
+
 void FileStore::registerStorage(ReplicatedStorage* storage)
 {
     BSLS_ASSERT_SAFE(storage);
@@ -7076,6 +9285,10 @@ void FileStore::flush()
         return;  // RETURN
     }
 
+    // Idle time is a good time to write back whatever is left dirty.  Note
+    // that durable syncs are left to the group commit window, if any.
+    writebackIfNeeded(!d_isSyncBeforeReceipt);
+
     const bool haveMore        = gcExpiredMessages(bdlt::CurrentTime::utc());
     const bool haveMoreHistory = gcHistory();
 
@@ -7196,6 +9409,7 @@ void FileStore::loadSummary(mqbcmd::FileStore* fileStore) const
                                     d_nagglePacketCount,
                                     d_fileSets,
                                     d_storages);
+    fileStore->summary().rolloverPendingBytes() = rolloverCopyPendingBytes();
 }
 
 // ACCESSORS
@@ -7332,6 +9546,10 @@ void FileStore::loadCurrentFiles(mqbs::FileStoreSet* fileStoreSet) const
     BSLS_ASSERT(d_fileSets.size() > 0);
     BSLS_ASSERT(d_fileSets[0].get());
 
+    // The files of the active file set are only complete once the payloads
+    // carried over by the last rollover, if any, have been copied.
+    const_cast<FileStore*>(this)->completeRolloverCopy();
+
     FileStoreUtil::loadCurrentFiles(fileStoreSet,
                                     *d_fileSets[0],
                                     !d_isFSMWorkflow);
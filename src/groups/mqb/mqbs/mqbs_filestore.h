@@ -42,6 +42,7 @@
 #include <mqbs_fileset.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_mappedfiledescriptor.h>
+#include <mqbs_rollovercopyutil.h>
 #include <mqbs_storagecollectionutil.h>
 #include <mqbu_storagekey.h>
 
@@ -76,13 +77,19 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_semaphore.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_cpp11.h>
+#include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
 
 // FORWARD DECLARATIONS
+namespace bslmt {
+class Latch;
+}
 namespace mqbcmd {
 class FileStore;
 }
@@ -95,6 +102,9 @@ class Domain;
 namespace mqbstat {
 class ClusterStats;
 }
+namespace mwcsys {
+class StatMonitorSnapshotRecorder;
+}
 
 namespace mqbs {
 
@@ -102,6 +112,7 @@ namespace mqbs {
 class DataFileIterator;
 class FileStore;
 class FileStoreSet;
+struct IndexSnapshot;
 class JournalFileIterator;
 class QlistFileIterator;
 class ReplicatedStorage;
@@ -209,6 +220,8 @@ class FileStore : public DataStore {
 
     typedef bdlmt::EventScheduler::RecurringEventHandle RecurringEventHandle;
 
+    typedef bdlmt::EventScheduler::EventHandle EventHandle;
+
     typedef DataStoreConfig::QueueKeyInfoMapConstIter QueueKeyInfoMapConstIter;
     typedef DataStoreConfig::QueueKeyInfoMapInsertRc  QueueKeyInfoMapInsertRc;
 
@@ -259,6 +272,76 @@ class FileStore : public DataStore {
     /// Map of NodeId -> NodeContext to assist in Receipt processing
     typedef bsl::unordered_map<int, NodeContext> NodeReceiptContexts;
 
+    /// This context describes one write back of the dirty ranges of the
+    /// active file set, performed by the write back thread when the
+    /// `E_ASYNC_WRITEBACK` write backend is in use.
+    struct WritebackContext {
+        FileSetSp d_fileSet;
+        // File set being written back.
+
+        bsls::Types::Uint64 d_dataFileBegin;
+        bsls::Types::Uint64 d_dataFileEnd;
+        bsls::Types::Uint64 d_journalFileBegin;
+        bsls::Types::Uint64 d_journalFileEnd;
+        bsls::Types::Uint64 d_qlistFileBegin;
+        bsls::Types::Uint64 d_qlistFileEnd;
+        // Dirty ranges of each file.
+
+        DataStoreRecordKey d_syncKey;
+        // Key of the last record covered by
+        // this write back.
+
+        mqbnet::ClusterNode* d_receiptNode_p;
+        // Replica: node to send the deferred
+        // Receipt to, if any.
+
+        DataStoreRecordKey d_receiptKey;
+        // Replica: key of the deferred
+        // Receipt.
+
+        WritebackContext();
+
+        /// Return the total number of bytes covered by this write back.
+        bsls::Types::Uint64 numBytes() const;
+    };
+
+    /// Payload of a message recovered from the journal, whose CRC32-C is
+    /// validated once the journal has been fully replayed.
+    struct RecoveredMessage {
+        bsls::Types::Uint64 d_journalOffset;
+        // Offset of the MESSAGE record in
+        // the JOURNAL file.
+
+        bsls::Types::Uint64 d_appDataOffset;
+        // Offset of the payload in the DATA
+        // file, or in the cold tier data file
+        // if 'd_isCold' is true.
+
+        unsigned int d_appDataLen;
+        // Unpadded length of the payload.
+
+        unsigned int d_crc32c;
+        // CRC32-C of the payload, as per the
+        // MESSAGE record.
+
+        bool d_isCold;
+        // Whether the payload resides in the
+        // cold tier data file.
+
+        bool d_isValid;
+        // Whether the CRC32-C of the payload
+        // matches 'd_crc32c'.
+    };
+
+    typedef bsl::vector<RecoveredMessage> RecoveredMessages;
+
+    /// Range of payloads carried over by a rollover, whose bytes are copied
+    /// from the DATA file of the previous file set to the DATA file of the
+    /// active file set by a worker thread.
+    typedef RolloverCopy::Slice RolloverCopySlice;
+
+    typedef RolloverCopy::Slices RolloverCopySlices;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -394,7 +477,180 @@ class FileStore : public DataStore {
     // 'd_storageEventBuilder' before
     // flushing the builder.  Depending
     // the cluster channels load, it can
-    // grow or shrink.
+    // grow or shrink, unless the batch
+    // size is configured.
+
+    const bool d_isAsyncWriteback;
+    // Whether the 'E_ASYNC_WRITEBACK'
+    // write backend is in use.
+
+    const bool d_isSyncBeforeReceipt;
+    // Whether records must be durably
+    // synced before being receipted.
+    // Only true if 'd_isAsyncWriteback'.
+
+    bdlmt::FixedThreadPool d_writebackThreadPool;
+    // Single thread on which the dirty
+    // ranges of the active file set are
+    // written back, so that the partition
+    // thread never blocks on (or gets
+    // throttled by) page cache write
+    // back.  Only started if
+    // 'd_isAsyncWriteback'.
+
+    bool d_isWritebackInProgress;
+    // Whether a write back job has been
+    // enqueued and its completion has not
+    // yet been processed.  At most one job
+    // is in flight, and the dirty ranges
+    // accumulated meanwhile are coalesced
+    // into the next one.
+
+    mqbnet::ClusterNode* d_pendingReceiptNode_p;
+    // Replica: node to send the Receipt
+    // deferred until the next write back
+    // completes, if any.
+
+    DataStoreRecordKey d_pendingReceiptKey;
+    // Replica: key of the deferred Receipt
+
+    const bsls::TimeInterval d_groupCommitMaxDelay;
+    // Maximum time a durable sync is
+    // delayed in order to batch more
+    // records into it (group commit).
+    // Zero means that a sync is issued as
+    // soon as the previous one completes.
+    // Only used if 'd_isSyncBeforeReceipt'.
+
+    const bsls::Types::Uint64 d_groupCommitMaxBytes;
+    // Number of unsynced bytes which ends
+    // the group commit window early.
+
+    EventHandle d_groupCommitEventHandle;
+    // Handle to the event closing the
+    // current group commit window.
+
+    bool d_isGroupCommitScheduled;
+    // Whether a group commit window is
+    // open, i.e. whether
+    // 'd_groupCommitEventHandle' is
+    // scheduled.
+
+    unsigned int d_groupCommitGeneration;
+    // Generation of the current group
+    // commit window, incremented each time
+    // a window is opened or closed.  The
+    // timeout of a window is ignored
+    // unless it belongs to the current
+    // one, so that a timeout already in
+    // flight when its window was closed
+    // early does not close the next one.
+
+    bool d_isGroupCommitExpired;
+    // Whether the current group commit
+    // window expired while a write back
+    // was in progress, in which case the
+    // records written during the window
+    // are synced as soon as the write back
+    // completes.
+
+    const bsls::Types::Int64 d_indexSnapshotIntervalNs;
+    // Minimum interval, in nanoseconds,
+    // between two snapshots of the
+    // in-memory index.  Zero means that
+    // no snapshot is taken.
+
+    bsls::Types::Int64 d_lastIndexSnapshotTime;
+    // High resolution time at which the
+    // last snapshot of the in-memory index
+    // was taken.
+
+    bool d_isIndexSnapshotInProgress;
+    // Whether a snapshot of the in-memory
+    // index is being taken, i.e. whether
+    // its records are being copied by this
+    // thread or it is being written by a
+    // worker thread.  At most one snapshot
+    // is taken at any time.
+
+    bsl::shared_ptr<IndexSnapshot> d_indexSnapshot_sp;
+    // Snapshot of the in-memory index whose
+    // records are being copied, in
+    // batches, by this thread, if any.
+
+    DataStoreRecordKey d_indexSnapshotKey;
+    // Key of the sync point as of which
+    // 'd_indexSnapshot_sp' is taken.  Only
+    // the records preceding it are copied.
+
+    RecordIterator d_indexSnapshotCursor;
+    // Next record to copy into
+    // 'd_indexSnapshot_sp'.  Only valid if
+    // it is not null.
+
+    FileSetSp d_rolloverCopyFromFileSet;
+    // Previous file set whose payloads,
+    // carried over by the last rollover,
+    // are being copied to the active file
+    // set by a worker thread, if any.  It
+    // holds one alias on that file set
+    // until the copy completes.
+
+    RolloverCopySlices d_rolloverCopySlices;
+    // Ranges of payloads to copy, sorted
+    // by offset in the DATA file of the
+    // active file set.  Not modified while
+    // a copy is in progress.
+
+    bsls::AtomicUint64 d_rolloverCopyWatermark;
+    // Offset in the DATA file of the
+    // active file set up to which the
+    // payloads have been copied.
+
+    bslmt::Semaphore d_rolloverCopySemaphore;
+    // Semaphore posted by the worker
+    // thread once the copy is done.
+
+    bsls::Types::Uint64 d_rolloverCopySyncPointOffset;
+    // Offset of the first sync point in
+    // the JOURNAL file of the active file
+    // set, recorded in its header once the
+    // copy completes if it could not be
+    // recorded when the copy started.
+
+    bsl::string d_rolloverCopyFileName;
+    // Name of the file describing the
+    // copy in progress, from which
+    // recovery completes the copy if the
+    // broker stops in between, or empty
+    // if that file could not be written.
+
+    bsls::Types::Int64 d_rolloverCopyStartTime;
+    // High resolution time at which the
+    // copy was enqueued.
+
+    unsigned int d_rolloverCopyGeneration;
+    // Number of copies started, used to
+    // ignore the completion notification
+    // of a copy which has already been
+    // completed by 'completeRolloverCopy'.
+
+    DataStoreRecordKey d_lastPackedKey;
+    // Key of the last record packed in
+    // 'd_storageEventBuilder'.
+
+    DataStoreRecordKey d_lastPackedReceiptKey;
+    // Key of the last message requesting
+    // a Receipt packed in
+    // 'd_storageEventBuilder'.
+
+    DataStoreRecordKey d_replicatedKey;
+    // Key of the last record broadcast to
+    // the replicas.
+
+    DataStoreRecordKey d_replicatedReceiptKey;
+    // Key of the last message requesting
+    // a Receipt broadcast to the replicas.
 
   private:
     // NOT IMPLEMENTED
@@ -428,6 +684,12 @@ class FileStore : public DataStore {
     /// invocation of other flavor of `close`.
     void close(FileSet& fileSetRef, bool flush);
 
+    /// Open and map in read-only mode the cold tier data file of the
+    /// specified `fileSet` if the cold tier is enabled and the file exists.
+    /// Return zero on success or if there is no such file, non-zero value
+    /// otherwise.
+    int openColdFile(FileSet* fileSet);
+
     /// Move all files contained in the specified `fileSet` to the archive
     /// location as specified in this instance's configuration provided at
     /// construction.  Note that files are not truncated or closed.
@@ -475,24 +737,146 @@ class FileStore : public DataStore {
     /// Else, use the information from `queueKeyInfoMap` to validate against
     /// the messages recovered from `jit` and `dit`; QList file will not be
     /// used since `queueKeyInfoMap` already contains such queue
-    /// information.  Return zero on success, non zero value otherwise.  The
-    /// behavior is undefined unless the journal iterator `jit` is in
-    /// reverse mode.  Note that this method invalidates all iterators.
-    int recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
-                        bsls::Types::Uint64* journalOffset,
-                        bsls::Types::Uint64* qlistOffset,
-                        bsls::Types::Uint64* dataOffset,
-                        JournalFileIterator* jit,
-                        QlistFileIterator*   qit,
-                        DataFileIterator*    dit);
+    /// information.  If the specified `snapshot` is not null, only replay
+    /// the records following the sync point as of which it was taken, and
+    /// merge them with the content of `snapshot`.  Log the time spent in
+    /// each step of the recovery using the specified `statRecorder`.
+    /// Return zero on success, non zero value otherwise.  The behavior is
+    /// undefined unless the journal iterator `jit` is in reverse mode.
+    /// Note that this method invalidates all iterators.
+    int recoverMessages(QueueKeyInfoMap*                     queueKeyInfoMap,
+                        bsls::Types::Uint64*                 journalOffset,
+                        bsls::Types::Uint64*                 qlistOffset,
+                        bsls::Types::Uint64*                 dataOffset,
+                        JournalFileIterator*                 jit,
+                        QlistFileIterator*                   qit,
+                        DataFileIterator*                    dit,
+                        mwcsys::StatMonitorSnapshotRecorder* statRecorder,
+                        const IndexSnapshot*                 snapshot);
+
+    /// Load into the specified `snapshot` the index snapshot of the file set
+    /// represented by the specified `recoveryFileSet`, and validate it
+    /// against the JOURNAL, DATA and QLIST files mapped by the specified
+    /// `journalFd`, `dataFd` and `qlistFd`.  Return zero on success, and a
+    /// non-zero value if there is no usable snapshot, in which case the
+    /// whole journal must be replayed.
+    int loadIndexSnapshot(IndexSnapshot*              snapshot,
+                          const FileStoreSet&         recoveryFileSet,
+                          const MappedFileDescriptor& journalFd,
+                          const MappedFileDescriptor& dataFd,
+                          const MappedFileDescriptor& qlistFd);
+
+    /// Start taking a snapshot of the in-memory index as of the last sync
+    /// point, if snapshots are enabled, none is in progress and the
+    /// configured interval has elapsed since the last one.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void snapshotIndexIfNeeded();
+
+    /// Copy the next batch of outstanding records into the snapshot of the
+    /// in-memory index being taken, if any, and schedule the copy of the
+    /// following batch, or have the snapshot written by a worker thread if
+    /// all the records have been copied.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void snapshotIndexCopyDispatched();
+
+    /// Copy into the snapshot of the in-memory index being taken, if any,
+    /// the record at the specified `recordIt` if it is part of that
+    /// snapshot and has not been copied yet.  The behavior is undefined
+    /// unless the record is about to be removed from `d_records`.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void snapshotIndexRecordIfPending(const RecordIterator& recordIt);
+
+    /// Stop taking the snapshot of the in-memory index whose records are
+    /// being copied, if any.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void cancelIndexSnapshot();
+
+    /// Populate the fields of the records of the specified `snapshot` which
+    /// are read from the JOURNAL and QLIST files of the specified
+    /// `fileSet`, along with the queues of the partition, and write it to
+    /// the specified `path`.  The specified `fileSetAlias` keeps `fileSet`
+    /// mapped until then.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void snapshotIndexWorkerDispatched(
+        const bsl::string&                    path,
+        const bsl::shared_ptr<IndexSnapshot>& snapshot,
+        const FileSet*                        fileSet,
+        const AliasedBufferDeleterSp&         fileSetAlias);
+
+    /// Process the completion, with the specified `status` and
+    /// `errorDescription`, of the write of the index snapshot to the
+    /// specified `path`.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void snapshotIndexCompleteDispatched(int                status,
+                                         const bsl::string& errorDescription,
+                                         const bsl::string& path);
+
+    /// Validate, in parallel chunks, the CRC32-C of the payloads in the
+    /// DATA file mapped by the specified `dataFd` (or in the cold tier data
+    /// file of the active file set) of the specified `messages` recovered
+    /// from the JOURNAL file mapped by the specified `journalFd`, and
+    /// remove from the outstanding records the messages failing the
+    /// validation.
+    void validateRecoveredMessages(RecoveredMessages*          messages,
+                                   const MappedFileDescriptor& journalFd,
+                                   const MappedFileDescriptor& dataFd);
+
+    /// Validate the CRC32-C of the payloads, in the DATA file mapped at the
+    /// specified `dataFileBase` or in the cold tier data file mapped at the
+    /// specified `coldFileBase`, of the specified [`begin`, `end`) range of
+    /// recovered messages, and arrive at the specified `latch`, if any.
+    ///
+    /// THREAD: This method can be invoked from *any* thread.
+    static void validateRecoveredMessagesChunk(RecoveredMessage* begin,
+                                               RecoveredMessage* end,
+                                               const char*       dataFileBase,
+                                               const char*       coldFileBase,
+                                               bslmt::Latch*     latch);
 
     /// Rollover the outstanding messages belonging to the storages mapped
     /// to this file store, from active file set into the rollover file set,
     /// and make rolled over file set the new active file set.  Return zero
     /// on success, non-zero value otherwise.  Note that in its *current*
     /// implementation, this routine has no side-effect in case of failure.
+    /// Also note that, in non-FSM workflow, the payloads remaining in the
+    /// DATA file may be copied to the new file set by a worker thread after
+    /// this method returns, in which case the copy is first recorded in a
+    /// rollover copy file, from which recovery completes it if needed.
     int rollover(bsls::Types::Uint64 timestamp);
 
+    /// Copy the payloads described by `d_rolloverCopySlices` from the
+    /// specified `fromFileSet` to the specified `toFileSet` in bounded
+    /// chunks, advancing `d_rolloverCopyWatermark` after each one, and
+    /// notify the dispatcher thread of the completion of the copy having
+    /// the specified `generation`.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void rolloverCopyWorkerDispatched(const FileSetSp& fromFileSet,
+                                      const FileSetSp& toFileSet,
+                                      unsigned int     generation);
+
+    /// Complete the rollover whose payloads copy has the specified
+    /// `generation`, unless it has already been completed.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void rolloverCopyCompleteDispatched(unsigned int generation);
+
+    /// If payloads carried over by the last rollover are being copied by a
+    /// worker thread, wait for the copy to be done and complete the
+    /// rollover: make the copy durable and remove the rollover copy file
+    /// (or, if there is none, record the first sync point in the header of
+    /// the JOURNAL file of the active file set), and release the previous
+    /// file set.
+    void completeRolloverCopy();
+
     /// If the specified `file` of specified `fileType` having specified
     /// `currentSize` and `fileName` cannot accommodate additional
     /// `requestedSpace`, roll over the `file`.  Return zero on success,
@@ -516,11 +900,29 @@ class FileStore : public DataStore {
     /// Rollover over the specified `record` from `oldFileSet` to the
     /// `newFileSet`, and if it is a message record, update the counter of
     /// the corresponding queue by one in the specified
-    /// `queueKeyCounterMap`.
+    /// `queueKeyCounterMap`, and write its payload to the cold tier data
+    /// file of `newFileSet` if the specified `offload` flag is true, or to
+    /// its DATA file otherwise.  If the specified `deferredCopies` is not
+    /// null and the payload is written to the DATA file, only reserve its
+    /// space and append the range to copy to `deferredCopies` instead of
+    /// copying it.
     void writeRolledOverRecord(DataStoreRecord*    record,
                                QueueKeyCounterMap* queueKeyCounterMap,
                                FileSet*            oldFileSet,
-                               FileSet*            newFileSet);
+                               FileSet*            newFileSet,
+                               bool                offload,
+                               RolloverCopySlices* deferredCopies);
+
+    /// Load into the specified `offloads` whether the payload of each
+    /// outstanding message, in the iteration order of the records, must be
+    /// written to the cold tier data file when rolling over at the
+    /// specified `timestamp`, and return the total number of bytes to
+    /// write to the cold tier data file.  Note that this routine yields
+    /// the same result on every node of the cluster, since the offset of
+    /// the payloads is part of the replicated state.
+    bsls::Types::Uint64
+    selectColdMessages(bsl::vector<char>*  offloads,
+                       bsls::Types::Uint64 timestamp) const;
 
     /// Issue a sync point.
     ///
@@ -610,6 +1012,88 @@ class FileStore : public DataStore {
                       unsigned int         primaryLeaseId,
                       bsls::Types::Uint64  sequenceNumber);
 
+    /// Account for a Receipt from the node having the specified `nodeId`
+    /// for all unreceipted messages up to and including the specified
+    /// `recordKey`, and notify the queues of the messages which reached
+    /// the replication factor.  Note that self node's own Receipt is the
+    /// completion of the durable write back of the records.
+    void processReceipt(const DataStoreRecordKey& recordKey, int nodeId);
+
+    /// Report to the cluster stats the number of records replicated to the
+    /// node having the specified `nodeId` since its specified
+    /// `lastReceiptKey`, if it has not receipted the last replicated
+    /// message requesting a Receipt.  This method has no effect if `nodeId`
+    /// is self.
+    void reportReplicaLag(int                       nodeId,
+                          const DataStoreRecordKey& lastReceiptKey);
+
+    /// Enqueue a write back of the dirty ranges of the active file set to
+    /// the write back thread if no write back is in progress and if either
+    /// the specified `force` flag is true, records are pending durable
+    /// sync, or the amount of dirty bytes is large enough.  When records
+    /// are pending durable sync and a group commit delay is configured, the
+    /// sync is instead postponed until either the group commit window
+    /// expires or enough bytes are pending.  The window is opened even if a
+    /// write back is in progress, and if it expires before the write back
+    /// completes, the records written during it are synced upon that
+    /// completion.  This method has no effect unless the
+    /// `E_ASYNC_WRITEBACK` write backend is in use.
+    void writebackIfNeeded(bool force);
+
+    /// Callback invoked when the group commit window having the specified
+    /// `generation` expires.
+    ///
+    /// THREAD: This method is called from the scheduler thread.
+    void groupCommitTimeoutCb(unsigned int generation);
+
+    /// Close the group commit window having the specified `generation` and
+    /// sync the records written during it, unless that window was already
+    /// closed.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void groupCommitTimeoutDispatched(unsigned int generation);
+
+    /// Load into the specified `context` the dirty ranges of the active
+    /// file set and mark them as written back.  Return true if there is
+    /// anything to write back, and false otherwise.
+    bool prepareWriteback(WritebackContext* context);
+
+    /// Write back the dirty ranges described by the specified `context`,
+    /// waiting for them to be durable if records must be synced before
+    /// being receipted.  Return zero on success, non-zero value otherwise.
+    ///
+    /// THREAD: This method can be invoked from *any* thread.
+    int writeback(const WritebackContext& context);
+
+    /// Write back the dirty ranges described by the specified `context`
+    /// and dispatch the completion to the partition thread.
+    ///
+    /// THREAD: This method is invoked in the write back thread.
+    void writebackWorkerDispatched(const WritebackContext& context);
+
+    /// Process the completion, with the specified `status`, of the write
+    /// back described by the specified `context` which took the specified
+    /// `elapsed` nanoseconds, and initiate the next write back, if needed.
+    ///
+    /// THREAD: This method executes in the partition dispatcher thread.
+    void writebackCompleteDispatched(int                     status,
+                                     bsls::Types::Int64      elapsed,
+                                     const WritebackContext& context);
+
+    /// Issue the Receipts which were waiting for the successful (as
+    /// indicated by the specified `status`) write back described by the
+    /// specified `context`, and report the specified `elapsed` nanoseconds
+    /// it took to the cluster stats if it was a durable sync.
+    void onWritebackComplete(int                     status,
+                             bsls::Types::Int64      elapsed,
+                             const WritebackContext& context);
+
+    /// Write back synchronously the dirty ranges of the active file set and
+    /// wait for any in-flight write back to complete.  This is used before
+    /// the active file set stops being written to, i.e. upon rollover and
+    /// close.
+    void writebackSync();
+
     /// Insert the specified `record` value by the specified `key` into the
     /// list of outstanding records, and assign to the specified `handle` an
     /// iterator to the inserted record.
@@ -633,10 +1117,18 @@ class FileStore : public DataStore {
         RecordType::Enum               recordType,
         bsls::Types::Uint64            recordOffset);
 
-    ///  if the specified `immediateFlush` is `true` or the
-    /// `d_storageEventBuilder` is over the `d_nagglePacketCount` limit.
+    /// Replicate the records batched in `d_storageEventBuilder` if the
+    /// specified `immediateFlush` is `true` or the `d_storageEventBuilder`
+    /// is over the `d_nagglePacketCount` limit, or over the
+    /// `k_NAGLE_PACKET_COUNT` limit if the replication window is full.
     void flushIfNeeded(bool immediateFlush);
 
+    /// Broadcast the records batched in `d_storageEventBuilder`, if any, to
+    /// the replicas, adapt the `d_nagglePacketCount` limit to the load of
+    /// the cluster channels unless the batch size is configured, and
+    /// update the replica lag stats.
+    void broadcastStorageEvent();
+
     // PRIVATE ACCESSORS
 
     /// Return a brief description of the partition for logging purposes.
@@ -653,6 +1145,22 @@ class FileStore : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
+    /// Return the previous file set if the payload of the specified
+    /// `record`, carried over by the last rollover, has not been copied to
+    /// the active file set yet, and load into the specified `offset` its
+    /// offset in the DATA file of that file set.  Return null otherwise.
+    FileSet* rolloverCopySource(bsls::Types::Uint64*   offset,
+                                const DataStoreRecord& record) const;
+
+    /// Return the number of bytes of the payloads carried over by the last
+    /// rollover which remain to be copied to the active file set.
+    bsls::Types::Uint64 rolloverCopyPendingBytes() const;
+
+    /// Return true if a replication batching threshold is configured and
+    /// at least that many records have been replicated since the oldest
+    /// message still waiting for its Receipts, false otherwise.
+    bool isReplicationWindowFull() const;
+
     /// Attempt to garbage-collect messages for which TTL has expired where
     /// the specified `currentTimeUtc` is the current timestamp (UTC).
     /// Return `true`, if there are expired items unprocessed because of the
@@ -879,6 +1387,14 @@ class FileStore : public DataStore {
     /// Initiate a forced rollover of this partition.
     void forceRollover();
 
+    /// Replicate the records batched so far to the peers right away, even
+    /// if the replication window is full.  Behavior is undefined unless
+    /// this node is the primary for this partition.  Note that this is
+    /// meant for records which must reach the replicas ahead of subsequent
+    /// cluster state changes, such as a QueueDeletion record written
+    /// before the queue is unassigned.
+    void flushStorage();
+
     void registerStorage(ReplicatedStorage* storage);
 
     void unregisterStorage(const ReplicatedStorage* storage);
@@ -970,7 +1486,9 @@ class FileStore : public DataStore {
 
     /// Load into the specified `fileStoreSet` the active (current) file
     /// set.  The behavior is undefined unless there is a fileSet in current
-    /// use.
+    /// use.  Note that this method first waits for the payloads carried
+    /// over by the last rollover, if any, to be copied to the active file
+    /// set.
     void loadCurrentFiles(mqbs::FileStoreSet* fileStoreSet) const;
 
     /// Return a sorted list of pairs of sync point and corresponding
@@ -1101,6 +1619,32 @@ inline FileStore::NodeContext::NodeContext(bdlbb::BlobBufferFactory* factory,
     // NOTHING
 }
 
+// ---------------------------------
+// class FileStore::WritebackContext
+// ---------------------------------
+
+inline FileStore::WritebackContext::WritebackContext()
+: d_fileSet()
+, d_dataFileBegin(0)
+, d_dataFileEnd(0)
+, d_journalFileBegin(0)
+, d_journalFileEnd(0)
+, d_qlistFileBegin(0)
+, d_qlistFileEnd(0)
+, d_syncKey()
+, d_receiptNode_p(0)
+, d_receiptKey()
+{
+    // NOTHING
+}
+
+inline bsls::Types::Uint64 FileStore::WritebackContext::numBytes() const
+{
+    return (d_dataFileEnd - d_dataFileBegin) +
+           (d_journalFileEnd - d_journalFileBegin) +
+           (d_qlistFileEnd - d_qlistFileBegin);
+}
+
 // ---------------
 // class FileStore
 // ---------------
@@ -18,10 +18,12 @@
 
 // MQB
 #include <mqbcfg_messages.h>
+#include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
 #include <mqbmock_dispatcher.h>
 #include <mqbnet_mockcluster.h>
 #include <mqbs_datastore.h>
+#include <mqbs_filebackedstorage.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoretestutil.h>
@@ -31,6 +33,7 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
@@ -54,7 +57,9 @@
 #include <bdls_filesystemutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_memory.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
@@ -166,7 +171,10 @@ struct Tester {
 
   public:
     // CREATORS
-    Tester(const char* location)
+    /// Create a `Tester` object whose file store is located at the
+    /// specified `location`, and which has a cold tier with small data
+    /// files if the optionally specified `withColdTier` is true.
+    explicit Tester(const char* location, bool withColdTier = false)
     : d_scheduler(bsls::SystemClockType::e_MONOTONIC, s_allocator_p)
     , d_bufferFactory(1024, s_allocator_p)
     , d_itemPool(mqbnet::Channel::k_ITEM_SIZE, s_allocator_p)
@@ -208,6 +216,15 @@ struct Tester {
         d_partitionCfg.preallocate()         = false;
         d_partitionCfg.prefaultPages()       = false;
 
+        if (withColdTier) {
+            d_partitionCfg.maxDataFileSize()  = 64 * 1024;
+            d_partitionCfg.coldTierLocation() = d_clusterLocation;
+            d_partitionCfg.coldTierLocation().append("/cold");
+            bdls::FilesystemUtil::createDirectories(
+                d_partitionCfg.coldTierLocation(),
+                true);
+        }
+
         d_clusterCfg.name().assign("mock-cluster");
         d_clusterCfg.partitionConfig() = d_partitionCfg;
 
@@ -241,6 +258,7 @@ struct Tester {
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setColdTierLocation(d_partitionCfg.coldTierLocation())
             .setQueueCreationCb(
                 bdlf::BindUtil::bind(&queueCreationCb,
                                      bdlf::PlaceHolders::_1,   // status
@@ -269,6 +287,23 @@ struct Tester {
                                   1,  // numPartitions
                                   d_clusterStatsRootContext_sp.get(),
                                   s_allocator_p);
+        resetFileStore();
+    }
+
+    ~Tester()
+    {
+        bdls::FilesystemUtil::remove(d_clusterLocation, true);
+        bdls::FilesystemUtil::remove(d_clusterArchiveLocation, true);
+    }
+
+    // MANIPULATORS
+
+    /// Destroy the file store, if any, and create a new one having the same
+    /// configuration, which recovers the files of the previous one when
+    /// opened.
+    void resetFileStore()
+    {
+        d_fs_mp.reset();
         d_fs_mp.load(new (*s_allocator_p)
                          mqbs::FileStore(d_dsCfg,
                                          0,  // processorId
@@ -285,13 +320,6 @@ struct Tester {
                      s_allocator_p);
     }
 
-    ~Tester()
-    {
-        bdls::FilesystemUtil::remove(d_clusterLocation, true);
-        bdls::FilesystemUtil::remove(d_clusterArchiveLocation, true);
-    }
-
-    // MANIPULATORS
     bool writeRecords(mqbs::FileStore*               fs,
                       bsl::vector<HandleRecordPair>* records,
                       SyncPointOffsetPairs*          spOffsetPairs,
@@ -747,6 +775,8 @@ struct Tester {
     // ACCESSORS
     mqbs::FileStore& fileStore() const { return *(d_fs_mp); }
 
+    bdlbb::BlobBufferFactory* bufferFactory() { return &d_bufferFactory; }
+
     mqbnet::ClusterNode* node() const { return d_node_p; }
 };
 
@@ -974,6 +1004,354 @@ static void test2_printTest()
     fs.close();
 }
 
+static void test3_coldTierRecovery()
+// ------------------------------------------------------------------------
+// COLD TIER RECOVERY
+//
+// Concerns:
+//   1. Rolling over a partition having a cold tier offloads the oldest
+//      payloads to a cold tier data file.
+//   2. The offloaded payloads are read back from the cold tier data file.
+//   3. A file store recovered from the files of a partition having
+//      offloaded payloads recovers all the messages with their payloads.
+//
+// Plan:
+//   Write messages to a partition having small data files until it rolls
+//   over twice, then close it, recover it in a new file store, and check
+//   the payloads of all the messages before and after recovery.
+//
+// Testing:
+//   rollover with a cold tier
+//   recovery from a cold tier data file
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    mwctst::TestHelper::printTestName("COLD TIER RECOVERY");
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-3";
+    const int  k_NUM_MESSAGES          = 100;
+    const int  k_PAYLOAD_LENGTH        = 1000;
+
+    Tester tester(k_FILE_STORE_LOCATION, true);  // withColdTier
+
+    BSLS_ASSERT_OPT(tester.fileStore().open() == 0);
+    tester.fileStore().setPrimary(tester.node(), 1U);
+
+    const bmqt::Uri uri("bmq://bmq.test.persistent.priority/cold",
+                        s_allocator_p);
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "12345");
+
+    // Rolling over a queue requires its storage to be registered.
+
+    mqbs::FileBackedStorage storage(&tester.fileStore(),
+                                    uri,
+                                    queueKey,
+                                    mqbconfm::Domain(s_allocator_p),
+                                    0,  // parentCapacityMeter
+                                    bmqp::RdaInfo(),
+                                    s_allocator_p);
+    tester.fileStore().registerStorage(&storage);
+
+    mqbs::DataStoreRecordHandle handle;
+    BSLS_ASSERT_OPT(0 == tester.fileStore().writeQueueCreationRecord(
+                             &handle,
+                             uri,
+                             queueKey,
+                             AppIdKeyPairs(),
+                             bdlt::EpochUtil::convertToTimeT64(
+                                 bdlt::CurrentTime::utc()),
+                             true));  // isNewQueue
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    bsl::vector<bsl::string>       payloads(s_allocator_p);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            0);  // crc32c
+
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        bsl::string payload(k_PAYLOAD_LENGTH,
+                            static_cast<char>('a' + i % 26),
+                            s_allocator_p);
+        payload.append(bsl::to_string(i));
+
+        bsl::shared_ptr<bdlbb::Blob> appData;
+        appData.createInplace(s_allocator_p,
+                              tester.bufferFactory(),
+                              s_allocator_p);
+        bdlbb::BlobUtil::append(appData.get(),
+                                payload.c_str(),
+                                static_cast<int>(payload.length()));
+
+        ASSERT_EQ_D(i,
+                    0,
+                    tester.fileStore().writeMessageRecord(
+                        &attributes,
+                        &handle,
+                        guid,
+                        appData,
+                        bsl::shared_ptr<bdlbb::Blob>(),  // options
+                        queueKey));
+
+        guids.push_back(guid);
+        payloads.push_back(payload);
+    }
+
+    bsl::vector<bsl::string> coldFiles(s_allocator_p);
+    bdls::FilesystemUtil::findMatchingPaths(
+        &coldFiles,
+        (bsl::string(k_FILE_STORE_LOCATION, s_allocator_p) +
+         "/cold/*.bmq_cold")
+            .c_str());
+    ASSERT_LT(0U, coldFiles.size());
+
+    PV("Check the payloads before and after recovery");
+
+    for (int pass = 0; pass < 2; ++pass) {
+        mqbs::FileStore& fs = tester.fileStore();
+
+        int                     numMessages = 0;
+        mqbs::FileStoreIterator fsIt(&fs);
+        while (fsIt.next()) {
+            if (mqbs::RecordType::e_MESSAGE != fsIt.type()) {
+                continue;  // CONTINUE
+            }
+
+            mqbs::MessageRecord record;
+            fsIt.loadMessageRecord(&record);
+
+            const bsl::vector<bmqt::MessageGUID>::const_iterator it =
+                bsl::find(guids.begin(), guids.end(), record.messageGUID());
+            ASSERT_D(pass, it != guids.end());
+            if (it == guids.end()) {
+                continue;  // CONTINUE
+            }
+
+            bsl::shared_ptr<bdlbb::Blob>   appData;
+            bsl::shared_ptr<bdlbb::Blob>   options;
+            mqbi::StorageMessageAttributes attributes;
+            fs.loadMessageRaw(&appData, &options, &attributes, fsIt.handle());
+
+            const bsl::string& expected = payloads[it - guids.begin()];
+            ASSERT_EQ_D(pass,
+                        static_cast<int>(expected.length()),
+                        appData->length());
+            if (static_cast<int>(expected.length()) == appData->length()) {
+                bsl::string actual(s_allocator_p);
+                actual.resize(expected.length());
+                bdlbb::BlobUtil::copy(&actual[0],
+                                      *appData,
+                                      0,
+                                      appData->length());
+                ASSERT_EQ_D(pass, expected, actual);
+            }
+
+            ++numMessages;
+        }
+        ASSERT_EQ_D(pass, k_NUM_MESSAGES, numMessages);
+
+        if (0 == pass) {
+            fs.unregisterStorage(&storage);
+            fs.close();
+
+            tester.resetFileStore();
+            ASSERT_EQ(0, tester.fileStore().open());
+        }
+    }
+
+    tester.fileStore().close();
+}
+
+static void test4_deferredRolloverCopy()
+// ------------------------------------------------------------------------
+// DEFERRED ROLLOVER COPY
+//
+// Concerns:
+//   1. Rolling over a partition having more outstanding payloads than the
+//      threshold above which they are copied in the background (16 MiB)
+//      carries all of them over to the new file set.
+//   2. The payloads are readable right after the rollover, while the copy
+//      may still be in progress.
+//   3. Once the copy is complete, no rollover copy file is left behind,
+//      and a file store recovered from the files of the partition
+//      recovers all the messages with their payloads.
+//
+// Plan:
+//   Write 20 MiB of payloads to a partition, force it to roll over, check
+//   the payloads, then close it, recover it in a new file store, and check
+//   the payloads again.
+//
+// Testing:
+//   rollover with a deferred copy of the payloads
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    mwctst::TestHelper::printTestName("DEFERRED ROLLOVER COPY");
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-4";
+    const int  k_NUM_MESSAGES          = 320;
+    const int  k_PAYLOAD_LENGTH        = 64 * 1024;
+
+    Tester tester(k_FILE_STORE_LOCATION);
+
+    BSLS_ASSERT_OPT(tester.fileStore().open() == 0);
+    tester.fileStore().setPrimary(tester.node(), 1U);
+
+    const bmqt::Uri uri("bmq://bmq.test.persistent.priority/copy",
+                        s_allocator_p);
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "12345");
+
+    // Rolling over a queue requires its storage to be registered.
+
+    mqbs::FileBackedStorage storage(&tester.fileStore(),
+                                    uri,
+                                    queueKey,
+                                    mqbconfm::Domain(s_allocator_p),
+                                    0,  // parentCapacityMeter
+                                    bmqp::RdaInfo(),
+                                    s_allocator_p);
+    tester.fileStore().registerStorage(&storage);
+
+    mqbs::DataStoreRecordHandle handle;
+    BSLS_ASSERT_OPT(0 == tester.fileStore().writeQueueCreationRecord(
+                             &handle,
+                             uri,
+                             queueKey,
+                             AppIdKeyPairs(),
+                             bdlt::EpochUtil::convertToTimeT64(
+                                 bdlt::CurrentTime::utc()),
+                             true));  // isNewQueue
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            0);  // crc32c
+
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        // The payload of each message is filled with a character depending
+        // on its index, so that a payload copied to the wrong place is
+        // detected.
+
+        const bsl::string payload(k_PAYLOAD_LENGTH,
+                                  static_cast<char>('a' + i % 26),
+                                  s_allocator_p);
+
+        bsl::shared_ptr<bdlbb::Blob> appData;
+        appData.createInplace(s_allocator_p,
+                              tester.bufferFactory(),
+                              s_allocator_p);
+        bdlbb::BlobUtil::append(appData.get(),
+                                payload.c_str(),
+                                static_cast<int>(payload.length()));
+
+        ASSERT_EQ_D(i,
+                    0,
+                    tester.fileStore().writeMessageRecord(
+                        &attributes,
+                        &handle,
+                        guid,
+                        appData,
+                        bsl::shared_ptr<bdlbb::Blob>(),  // options
+                        queueKey));
+
+        guids.push_back(guid);
+    }
+
+    mqbs::FileStoreSet before(s_allocator_p);
+    tester.fileStore().loadCurrentFiles(&before);
+
+    tester.fileStore().forceRollover();
+
+    mqbs::FileStoreSet after(s_allocator_p);
+    tester.fileStore().loadCurrentFiles(&after);
+    ASSERT_NE(before.dataFile(), after.dataFile());
+
+    PV("Check the payloads after the rollover and after recovery");
+
+    for (int pass = 0; pass < 2; ++pass) {
+        mqbs::FileStore& fs = tester.fileStore();
+
+        int                     numMessages = 0;
+        mqbs::FileStoreIterator fsIt(&fs);
+        while (fsIt.next()) {
+            if (mqbs::RecordType::e_MESSAGE != fsIt.type()) {
+                continue;  // CONTINUE
+            }
+
+            mqbs::MessageRecord record;
+            fsIt.loadMessageRecord(&record);
+
+            const bsl::vector<bmqt::MessageGUID>::const_iterator it =
+                bsl::find(guids.begin(), guids.end(), record.messageGUID());
+            ASSERT_D(pass, it != guids.end());
+            if (it == guids.end()) {
+                continue;  // CONTINUE
+            }
+
+            bsl::shared_ptr<bdlbb::Blob>   appData;
+            bsl::shared_ptr<bdlbb::Blob>   options;
+            mqbi::StorageMessageAttributes attributes;
+            fs.loadMessageRaw(&appData, &options, &attributes, fsIt.handle());
+
+            const int  index    = static_cast<int>(it - guids.begin());
+            const char expected = static_cast<char>('a' + index % 26);
+            ASSERT_EQ_D(pass << ", " << index,
+                        k_PAYLOAD_LENGTH,
+                        appData->length());
+            if (k_PAYLOAD_LENGTH == appData->length()) {
+                bsl::string actual(s_allocator_p);
+                actual.resize(k_PAYLOAD_LENGTH);
+                bdlbb::BlobUtil::copy(&actual[0],
+                                      *appData,
+                                      0,
+                                      appData->length());
+                ASSERT_EQ_D(pass << ", " << index,
+                            bsl::string::npos,
+                            actual.find_first_not_of(expected));
+            }
+
+            ++numMessages;
+        }
+        ASSERT_EQ_D(pass, k_NUM_MESSAGES, numMessages);
+
+        if (0 == pass) {
+            fs.unregisterStorage(&storage);
+            fs.close();
+
+            // Closing the partition completes the copy, after which the
+            // rollover copy file is removed.
+
+            bsl::vector<bsl::string> copyFiles(s_allocator_p);
+            bdls::FilesystemUtil::findMatchingPaths(
+                &copyFiles,
+                (bsl::string(k_FILE_STORE_LOCATION, s_allocator_p) + "/*" +
+                 mqbs::FileStoreProtocol::k_ROLLOVER_COPY_FILE_EXTENSION)
+                    .c_str());
+            ASSERT_EQ(0U, copyFiles.size());
+
+            tester.resetFileStore();
+            ASSERT_EQ(0, tester.fileStore().open());
+        }
+    }
+
+    tester.fileStore().close();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -990,6 +1368,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_deferredRolloverCopy(); break;
+    case 3: test3_coldTierRecovery(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
     default: {
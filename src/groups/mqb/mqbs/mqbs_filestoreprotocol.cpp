@@ -69,7 +69,8 @@ const unsigned int FileHeader::k_MAGIC1;
 const unsigned int FileHeader::k_MAGIC2;
 
 /// Force variables/symbols definition so they can be used in other files
-const int FileStoreProtocol::k_VERSION;
+const int          FileStoreProtocol::k_VERSION;
+const unsigned int FileStoreProtocol::k_COLD_FILE_KEY;
 
 // ------------------------
 // struct FileStoreProtocol
@@ -78,6 +79,9 @@ const int FileStoreProtocol::k_VERSION;
 const char* FileStoreProtocol::k_DATA_FILE_EXTENSION(".bmq_data");
 const char* FileStoreProtocol::k_JOURNAL_FILE_EXTENSION(".bmq_journal");
 const char* FileStoreProtocol::k_QLIST_FILE_EXTENSION(".bmq_qlist");
+const char* FileStoreProtocol::k_INDEX_SNAPSHOT_FILE_EXTENSION(".bmq_index");
+const char* FileStoreProtocol::k_COLD_FILE_EXTENSION(".bmq_cold");
+const char* FileStoreProtocol::k_ROLLOVER_COPY_FILE_EXTENSION(".bmq_copy");
 const char* FileStoreProtocol::k_COMMON_FILE_EXTENSION_PREFIX(".bmq_");
 const char* FileStoreProtocol::k_COMMON_FILE_PREFIX("bmq_");
 
@@ -165,6 +165,23 @@ struct FileStoreProtocol {
 
     static const char* k_QLIST_FILE_EXTENSION;
 
+    static const char* k_INDEX_SNAPSHOT_FILE_EXTENSION;
+    // Extension of the snapshot of the in-memory index of a partition,
+    // which is not part of the file set and can always be discarded
+
+    static const char* k_COLD_FILE_EXTENSION;
+    // Extension of the cold tier data file of a file set, which lives in
+    // the partition's cold tier location
+
+    static const char* k_ROLLOVER_COPY_FILE_EXTENSION;
+    // Extension of the file describing the rolled over payloads still to
+    // be copied to the DATA file of a file set, which only exists while
+    // that copy is in progress
+
+    static const unsigned int k_COLD_FILE_KEY = 0x434F4C44;  // 'COLD'
+    // Value of the file key of a message record whose payload resides in
+    // the cold tier data file of the file set instead of its DATA file
+
     static const char* k_COMMON_FILE_EXTENSION_PREFIX;
 
     static const char* k_COMMON_FILE_PREFIX;
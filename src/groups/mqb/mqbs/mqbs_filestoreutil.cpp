@@ -26,11 +26,13 @@
 #include <mqbs_mappedfiledescriptor.h>
 #include <mqbs_offsetptr.h>
 #include <mqbs_qlistfileiterator.h>
+#include <mqbs_rollovercopyutil.h>
 #include <mqbu_storagekey.h>
 
 // MWC
 #include <mwctsk_alarmlog.h>
 #include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
 #include <mwcu_stringutil.h>
 
 // BDE
@@ -38,6 +40,7 @@
 #include <bdlb_string.h>
 #include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
@@ -289,6 +292,14 @@ int FileStoreUtil::findFileStoreSetsFromPaths(
                     .setJournalFileSize(
                         bdls::FilesystemUtil::getFileSize(files[i].c_str()));
             }
+            else if (hasIndexSnapshotFileExtension(files[i]) ||
+                     hasColdFileExtension(files[i]) ||
+                     hasRolloverCopyFileExtension(files[i])) {
+                // Index snapshots, cold tier data files and rollover copy
+                // files are not part of the file set.
+
+                continue;  // CONTINUE
+            }
             else {
                 localRC  = rc_FILE_EXTENSION_UNKNOWN;
                 returnRC = 10 * returnRC + rc_FILE_EXTENSION_UNKNOWN;
@@ -323,6 +334,14 @@ int FileStoreUtil::findFileStoreSetsFromPaths(
             else if (hasJournalFileExtension(files[i])) {
                 (*fileSetMap)[timestamp].setJournalFile(files[i]);
             }
+            else if (hasIndexSnapshotFileExtension(files[i]) ||
+                     hasColdFileExtension(files[i]) ||
+                     hasRolloverCopyFileExtension(files[i])) {
+                // Index snapshots, cold tier data files and rollover copy
+                // files are not part of the file set.
+
+                continue;  // CONTINUE
+            }
             else {
                 localRC  = rc_FILE_EXTENSION_UNKNOWN;
                 returnRC = 10 * returnRC + localRC;
@@ -426,6 +445,98 @@ bool FileStoreUtil::hasQlistFileExtension(const bsl::string& filename)
         FileStoreProtocol::k_QLIST_FILE_EXTENSION);
 }
 
+void FileStoreUtil::createIndexSnapshotFileName(
+    bsl::string*       filename,
+    const bsl::string& journalFileName)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(filename);
+    BSLS_ASSERT_SAFE(hasJournalFileExtension(journalFileName));
+
+    filename->assign(journalFileName,
+                     0,
+                     journalFileName.length() -
+                         bsl::strlen(
+                             FileStoreProtocol::k_JOURNAL_FILE_EXTENSION));
+    filename->append(FileStoreProtocol::k_INDEX_SNAPSHOT_FILE_EXTENSION);
+}
+
+bool FileStoreUtil::hasIndexSnapshotFileExtension(const bsl::string& filename)
+{
+    return mwcu::StringUtil::endsWith(
+        filename,
+        FileStoreProtocol::k_INDEX_SNAPSHOT_FILE_EXTENSION);
+}
+
+void FileStoreUtil::createColdFileName(
+    bsl::string*             filename,
+    const bslstl::StringRef& coldTierLocation,
+    const bsl::string&       dataFileName)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(filename);
+    BSLS_ASSERT_SAFE(hasDataFileExtension(dataFileName));
+
+    bsl::string leaf;
+    int         rc = bdls::PathUtil::getLeaf(&leaf, dataFileName);
+    BSLS_ASSERT_SAFE(0 == rc);
+    (void)rc;
+
+    leaf.resize(leaf.length() -
+                bsl::strlen(FileStoreProtocol::k_DATA_FILE_EXTENSION));
+    leaf.append(FileStoreProtocol::k_COLD_FILE_EXTENSION);
+
+    filename->assign(coldTierLocation.data(), coldTierLocation.length());
+    bdls::PathUtil::appendRaw(filename, leaf.c_str());
+}
+
+bool FileStoreUtil::hasColdFileExtension(const bsl::string& filename)
+{
+    return mwcu::StringUtil::endsWith(
+        filename,
+        FileStoreProtocol::k_COLD_FILE_EXTENSION);
+}
+
+void FileStoreUtil::createRolloverCopyFileName(bsl::string*       filename,
+                                               const bsl::string& dataFileName)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(filename);
+    BSLS_ASSERT_SAFE(hasDataFileExtension(dataFileName));
+
+    const bsl::size_t extensionLength = bsl::strlen(
+        FileStoreProtocol::k_DATA_FILE_EXTENSION);
+
+    filename->assign(dataFileName, 0, dataFileName.length() - extensionLength);
+    filename->append(FileStoreProtocol::k_ROLLOVER_COPY_FILE_EXTENSION);
+}
+
+bool FileStoreUtil::hasRolloverCopyFileExtension(const bsl::string& filename)
+{
+    return mwcu::StringUtil::endsWith(
+        filename,
+        FileStoreProtocol::k_ROLLOVER_COPY_FILE_EXTENSION);
+}
+
+bsls::Types::Uint64 FileStoreUtil::numRecordsReplicatedSince(
+    const DataStoreRecordKey& oldestUnreceiptedKey,
+    const DataStoreRecordKey& lastReplicatedKey)
+{
+    if (lastReplicatedKey < oldestUnreceiptedKey) {
+        // That message has not been replicated yet.
+        return 0;  // RETURN
+    }
+
+    if (oldestUnreceiptedKey.d_primaryLeaseId !=
+        lastReplicatedKey.d_primaryLeaseId) {
+        // Sequence numbers restart at one with each primary lease.
+        return lastReplicatedKey.d_sequenceNum;  // RETURN
+    }
+
+    return lastReplicatedKey.d_sequenceNum -
+           oldestUnreceiptedKey.d_sequenceNum + 1;
+}
+
 int FileStoreUtil::createFilePattern(bsl::string*             pattern,
                                      const bslstl::StringRef& basePath,
                                      int                      partitionId)
@@ -647,6 +758,83 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
     return 0;
 }
 
+int FileStoreUtil::createColdFile(bsl::ostream&          errorDescription,
+                                  FileSet*               fileSet,
+                                  int                    partitionId,
+                                  const DataStoreConfig& dataStoreConfig,
+                                  bsls::Types::Uint64    size)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+    BSLS_ASSERT_SAFE(!fileSet->d_coldFile.isValid());
+    BSLS_ASSERT_SAFE(!dataStoreConfig.coldTierLocation().isEmpty());
+
+    enum {
+        rc_SUCCESS           = 0,
+        rc_FILE_OPEN_FAILURE = -1,
+        rc_FILE_GROW_FAILURE = -2
+    };
+
+    createColdFileName(&fileSet->d_coldFileName,
+                       dataStoreConfig.coldTierLocation(),
+                       fileSet->d_dataFileName);
+
+    const bsls::Types::Uint64 headerSize = coldFileHeaderSize();
+
+    mwcu::MemOutStream errorDesc;
+    int                rc = FileSystemUtil::open(&fileSet->d_coldFile,
+                                  fileSet->d_coldFileName.c_str(),
+                                  headerSize + size,
+                                  false,  // readOnly
+                                  errorDesc);
+    if (0 != rc) {
+        errorDescription << "Failed to open cold tier data file ["
+                         << fileSet->d_coldFileName << "], rc: " << rc
+                         << ", error: " << errorDesc.str();
+        return 10 * rc + rc_FILE_OPEN_FAILURE;  // RETURN
+    }
+
+    rc = FileSystemUtil::grow(&fileSet->d_coldFile,
+                              dataStoreConfig.hasPreallocate(),
+                              errorDesc);
+    if (0 != rc) {
+        errorDescription << "Failed to grow cold tier data file ["
+                         << fileSet->d_coldFileName << "], rc: " << rc
+                         << ", error: " << errorDesc.str();
+        FileSystemUtil::close(&fileSet->d_coldFile);
+        bdls::FilesystemUtil::remove(fileSet->d_coldFileName);
+        return 10 * rc + rc_FILE_GROW_FAILURE;  // RETURN
+    }
+
+    // Cold tier data file -- append BlazingMQ header and DataFileHeader.
+    // The file key of the DataFileHeader identifies the file as a cold tier
+    // data file.
+
+    MappedFileDescriptor& coldFile    = fileSet->d_coldFile;
+    bsls::Types::Uint64&  coldFilePos = fileSet->d_coldFilePosition;
+
+    OffsetPtr<FileHeader> fh(coldFile.block(), 0);
+    new (fh.get()) FileHeader();
+    fh->setFileType(FileType::e_DATA).setPartitionId(partitionId);
+    coldFilePos = sizeof(FileHeader);
+
+    OffsetPtr<DataFileHeader> dfh(coldFile.block(), coldFilePos);
+    new (dfh.get()) DataFileHeader();
+    dfh->setFileKey(mqbu::StorageKey(FileStoreProtocol::k_COLD_FILE_KEY));
+
+    // Payloads start after the headers, padded to their alignment.
+    coldFilePos = headerSize;
+
+    fileSet->d_coldFileReadAheadPosition = headerSize;
+    fileSet->d_outstandingBytesCold      = headerSize;
+
+    BALL_LOG_INFO << "Created cold tier data file ["
+                  << fileSet->d_coldFileName << "] of size "
+                  << mwcu::PrintUtil::prettyBytes(coldFile.fileSize());
+
+    return rc_SUCCESS;
+}
+
 int FileStoreUtil::extractTimestamp(bsl::string*       timestamp,
                                     const bsl::string& filename)
 {
@@ -1056,6 +1244,10 @@ int FileStoreUtil::openRecoveryFileSet(bsl::ostream&         errorDescription,
         rc_RECOVERY_SET_RETRIEVAL_FAILURE = -2  // Failed to retrieve file set
                                                 // from which recovery could be
                                                 // performed
+        ,
+        rc_ROLLOVER_COPY_FAILURE = -3  // Failed to complete the copy of
+                                       // the payloads carried over by an
+                                       // interrupted rollover
     };
 
     const int                 k_INVALID_INDEX = -1;
@@ -1182,7 +1374,42 @@ int FileStoreUtil::openRecoveryFileSet(bsl::ostream&         errorDescription,
         return rc_RECOVERY_SET_RETRIEVAL_FAILURE;  // RETURN
     }
 
-    // Found a recoverable set.  Archive the remaining file sets.
+    // Found a recoverable set.  If the broker stopped while the payloads
+    // carried over by the rollover which created it were being copied from
+    // the previous file set, complete that copy before that file set gets
+    // archived.
+
+    bsl::string rolloverCopyFileName;
+    createRolloverCopyFileName(&rolloverCopyFileName,
+                               fileSets[recoveryIndex].dataFile());
+    if (readOnly || !dataFd) {
+        if (bdls::FilesystemUtil::exists(rolloverCopyFileName)) {
+            BALL_LOG_WARN << "PartitionId [" << partitionId << "]: file set: "
+                          << fileSets[recoveryIndex] << " has an incomplete "
+                          << "rollover copy [" << rolloverCopyFileName
+                          << "], which is not completed in read mode.";
+        }
+    }
+    else {
+        mwcu::MemOutStream errorDesc;
+        rc = RolloverCopyUtil::complete(errorDesc,
+                                        dataFd,
+                                        rolloverCopyFileName);
+        if (0 != rc) {
+            errorDescription << "Failed to complete the rollover copy of file "
+                             << "set " << fileSets[recoveryIndex]
+                             << ", rc: " << rc
+                             << ", error: " << errorDesc.str();
+            FileSystemUtil::close(journalFd);
+            FileSystemUtil::close(dataFd);
+            if (qlistFd) {
+                FileSystemUtil::close(qlistFd);
+            }
+            return 10 * rc + rc_ROLLOVER_COPY_FAILURE;  // RETURN
+        }
+    }
+
+    // Archive the remaining file sets.
     BALL_LOG_INFO << "PartitionId [" << partitionId << "]: archiving "
                   << archivingIndices.size() << " file sets.";
 
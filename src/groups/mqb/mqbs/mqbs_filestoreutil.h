@@ -46,6 +46,8 @@
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbs {
@@ -131,6 +133,73 @@ struct FileStoreUtil {
     /// (data, journal or qlist respectively) extension.
     static bool hasQlistFileExtension(const bsl::string& filename);
 
+    /// Load into the specified `filename` the name of the index snapshot
+    /// file associated with the journal file having the specified
+    /// `journalFileName`.
+    static void
+    createIndexSnapshotFileName(bsl::string*       filename,
+                                const bsl::string& journalFileName);
+
+    /// Return true if the specified `filename` ends with the index snapshot
+    /// file extension.
+    static bool hasIndexSnapshotFileExtension(const bsl::string& filename);
+
+    /// Load into the specified `filename` the name of the cold tier data
+    /// file, located in the specified `coldTierLocation`, associated with
+    /// the data file having the specified `dataFileName`.
+    static void createColdFileName(bsl::string*             filename,
+                                   const bslstl::StringRef& coldTierLocation,
+                                   const bsl::string&       dataFileName);
+
+    /// Return true if the specified `filename` ends with the cold tier data
+    /// file extension.
+    static bool hasColdFileExtension(const bsl::string& filename);
+
+    /// Return the size of the headers of a cold tier data file, i.e., the
+    /// BlazingMQ header and the data file header, rounded up to the
+    /// alignment of the payloads following them, which is also the offset
+    /// of the first payload in the file.
+    static bsls::Types::Uint64 coldFileHeaderSize();
+
+    /// Load into the specified `offloads` whether the payload of each
+    /// record in the specified range [`first`, `last`) of pairs of a key
+    /// and a `DataStoreRecord` must be written to the cold tier data file
+    /// when rolling over at the specified `timestamp`, and return the total
+    /// number of bytes to write to the cold tier data file.  The payloads
+    /// already in the cold tier stay there, the payloads at least the
+    /// specified `minAgeSeconds` old move there unless `minAgeSeconds` is
+    /// zero, and the oldest remaining payloads move there until the ones
+    /// left take at most the specified `maxHotBytes`.  Note that only the
+    /// records of type `e_MESSAGE` have a payload.
+    template <class ITER>
+    static bsls::Types::Uint64
+    selectColdMessages(bsl::vector<char>*  offloads,
+                       ITER                first,
+                       ITER                last,
+                       bsls::Types::Uint64 timestamp,
+                       bsls::Types::Uint64 minAgeSeconds,
+                       bsls::Types::Uint64 maxHotBytes);
+
+    /// Load into the specified `filename` the name of the rollover copy
+    /// file associated with the data file having the specified
+    /// `dataFileName`.
+    static void createRolloverCopyFileName(bsl::string*       filename,
+                                           const bsl::string& dataFileName);
+
+    /// Return true if the specified `filename` ends with the rollover copy
+    /// file extension.
+    static bool hasRolloverCopyFileExtension(const bsl::string& filename);
+
+    /// Return the number of records replicated since the message having
+    /// the specified `oldestUnreceiptedKey`, inclusive, given that the last
+    /// replicated record has the specified `lastReplicatedKey`, or zero if
+    /// that message has not been replicated yet.  Note that if the primary
+    /// lease changed since that message, only the records replicated under
+    /// the lease of `lastReplicatedKey` are counted.
+    static bsls::Types::Uint64
+    numRecordsReplicatedSince(const DataStoreRecordKey& oldestUnreceiptedKey,
+                              const DataStoreRecordKey& lastReplicatedKey);
+
     /// Populate the specified `pattern` with a string pattern which can be
     /// used to search BlazingMQ files belonging to the specified
     /// `partitionId` located at the specified `basePath` location.  Return
@@ -167,6 +236,21 @@ struct FileStoreUtil {
                       bool                     needQList,
                       bslma::Allocator*        allocator);
 
+    /// Create, open and map the cold tier data file of the specified
+    /// `fileSet` for the specified `partitionId` in the cold tier location
+    /// of the specified `dataStoreConfig`, sized to hold at least the
+    /// specified `size` bytes of payload, and write the BlazingMQ header
+    /// and the data file header to it.  Return zero on success, non-zero
+    /// value otherwise along with populating the specified
+    /// `errorDescription` with a brief reason for logging purposes.  The
+    /// behavior is undefined unless the data file of `fileSet` has been
+    /// created.  Note that the cold tier data file is deleted on failure.
+    static int createColdFile(bsl::ostream&          errorDescription,
+                              FileSet*               fileSet,
+                              int                    partitionId,
+                              const DataStoreConfig& dataStoreConfig,
+                              bsls::Types::Uint64    size);
+
     /// Populate the specified `timestamp` with the `YYYYMMDD_HHMMSS`
     /// pattern extracted from the specified BlazingMQ `filename`.  Return
     /// zero on success, non-zero value otherwise.
@@ -313,6 +397,78 @@ struct FileStoreUtil {
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+// --------------------
+// struct FileStoreUtil
+// --------------------
+
+// CLASS METHODS
+inline bsls::Types::Uint64 FileStoreUtil::coldFileHeaderSize()
+{
+    const bsls::Types::Uint64 size = sizeof(FileHeader) +
+                                     sizeof(DataFileHeader);
+    const bsls::Types::Uint64 alignment = bmqp::Protocol::k_DWORD_SIZE;
+
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+template <class ITER>
+bsls::Types::Uint64
+FileStoreUtil::selectColdMessages(bsl::vector<char>*  offloads,
+                                  ITER                first,
+                                  ITER                last,
+                                  bsls::Types::Uint64 timestamp,
+                                  bsls::Types::Uint64 minAgeSeconds,
+                                  bsls::Types::Uint64 maxHotBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offloads);
+
+    offloads->clear();
+
+    // First pass: payloads already in the cold tier stay there, and payloads
+    // older than the configured age move there.
+
+    bsls::Types::Uint64 coldBytes = 0;
+    bsls::Types::Uint64 hotBytes  = 0;
+    for (ITER it = first; it != last; ++it) {
+        const DataStoreRecord& record = it->second;
+        if (RecordType::e_MESSAGE != record.d_recordType) {
+            offloads->push_back(0);
+            continue;  // CONTINUE
+        }
+
+        if (record.d_isCold ||
+            (0 != minAgeSeconds && record.d_arrivalTimestamp <= timestamp &&
+             timestamp - record.d_arrivalTimestamp >= minAgeSeconds)) {
+            offloads->push_back(1);
+            coldBytes += record.d_dataOrQlistRecordPaddedLen;
+        }
+        else {
+            offloads->push_back(0);
+            hotBytes += record.d_dataOrQlistRecordPaddedLen;
+        }
+    }
+
+    // Second pass: offload the oldest remaining payloads until the payloads
+    // left are below the watermark.
+
+    size_t index = 0;
+    for (ITER it = first; it != last && hotBytes > maxHotBytes;
+         ++it, ++index) {
+        const DataStoreRecord& record = it->second;
+        if (RecordType::e_MESSAGE != record.d_recordType ||
+            (*offloads)[index]) {
+            continue;  // CONTINUE
+        }
+
+        (*offloads)[index] = 1;
+        coldBytes += record.d_dataOrQlistRecordPaddedLen;
+        hotBytes -= record.d_dataOrQlistRecordPaddedLen;
+    }
+
+    return coldBytes;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -0,0 +1,328 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_filestoreutil.t.cpp                                           -*-C++-*-
+#include <mqbs_filestoreutil.h>
+
+// MQB
+#include <mqbs_datastore.h>
+#include <mqbs_filestoreprotocol.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bsl::pair<int, mqbs::DataStoreRecord> RecordPair;
+typedef bsl::vector<RecordPair>               Records;
+
+/// Append to the specified `records` a message record having a payload of
+/// the specified `length` bytes which arrived at the specified
+/// `arrivalTimestamp`, and which is in the cold tier if the specified
+/// `isCold` is true.
+void addMessage(Records*            records,
+                unsigned int        length,
+                bsls::Types::Uint64 arrivalTimestamp,
+                bool                isCold = false)
+{
+    mqbs::DataStoreRecord record(mqbs::RecordType::e_MESSAGE,
+                                 records->size() * 60,
+                                 length);
+    record.d_arrivalTimestamp = arrivalTimestamp;
+    record.d_isCold           = isCold;
+    records->push_back(RecordPair(static_cast<int>(records->size()), record));
+}
+
+/// Append to the specified `records` a confirm record.
+void addConfirm(Records* records)
+{
+    mqbs::DataStoreRecord record(mqbs::RecordType::e_CONFIRM,
+                                 records->size() * 60);
+    records->push_back(RecordPair(static_cast<int>(records->size()), record));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_coldFileName()
+// ------------------------------------------------------------------------
+// COLD FILE NAME
+//
+// Concerns:
+//   1. The cold tier data file of a data file is located in the cold tier
+//      location, and has the name of the data file with the cold tier data
+//      file extension.
+//   2. 'hasColdFileExtension' only recognizes cold tier data files.
+//
+// Testing:
+//   createColdFileName
+//   hasColdFileExtension
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COLD FILE NAME");
+
+    const bsl::string dataFileName(
+        "/bmq/storage/bmq_2.20260101_101010.bmq_data",
+        s_allocator_p);
+
+    bsl::string coldFileName(s_allocator_p);
+    mqbs::FileStoreUtil::createColdFileName(&coldFileName,
+                                            "/bmq/cold",
+                                            dataFileName);
+    ASSERT_EQ(coldFileName,
+              bsl::string("/bmq/cold/bmq_2.20260101_101010.bmq_cold",
+                          s_allocator_p));
+
+    ASSERT(mqbs::FileStoreUtil::hasColdFileExtension(coldFileName));
+    ASSERT(!mqbs::FileStoreUtil::hasDataFileExtension(coldFileName));
+    ASSERT(!mqbs::FileStoreUtil::hasColdFileExtension(dataFileName));
+    ASSERT(!mqbs::FileStoreUtil::hasColdFileExtension(
+        "/bmq/storage/bmq_2.20260101_101010.bmq_journal"));
+}
+
+static void test2_selectColdMessages()
+// ------------------------------------------------------------------------
+// SELECT COLD MESSAGES
+//
+// Concerns:
+//   1. Nothing is offloaded if the payloads are young enough and below the
+//      watermark.
+//   2. Payloads already in the cold tier stay there.
+//   3. Payloads at least 'minAgeSeconds' old are offloaded, unless
+//      'minAgeSeconds' is zero.
+//   4. The oldest remaining payloads are offloaded until the ones left are
+//      below the watermark.
+//   5. Only message records are selected, and 'offloads' has one entry per
+//      record.
+//
+// Testing:
+//   selectColdMessages
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SELECT COLD MESSAGES");
+
+    const bsls::Types::Uint64 k_NOW = 1000000;
+
+    Records records(s_allocator_p);
+    addMessage(&records, 100, k_NOW - 50);
+    addConfirm(&records);
+    addMessage(&records, 200, k_NOW - 40, true);
+    addMessage(&records, 300, k_NOW - 30);
+    addMessage(&records, 400, k_NOW - 20);
+    addConfirm(&records);
+    addMessage(&records, 500, k_NOW - 10);
+
+    bsl::vector<char>   offloads(s_allocator_p);
+    bsls::Types::Uint64 coldBytes = 0;
+
+    {
+        PV("Below the watermark, no minimum age");
+
+        offloads.assign(2, 1);
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            records.begin(),
+                                                            records.end(),
+                                                            k_NOW,
+                                                            0,
+                                                            1300);
+        ASSERT_EQ(coldBytes, 200U);
+        ASSERT_EQ(offloads.size(), records.size());
+
+        const char k_EXPECTED[] = {0, 0, 1, 0, 0, 0, 0};
+        for (size_t i = 0; i < offloads.size(); ++i) {
+            ASSERT_EQ_D(i, offloads[i], k_EXPECTED[i]);
+        }
+    }
+
+    {
+        PV("Minimum age");
+
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            records.begin(),
+                                                            records.end(),
+                                                            k_NOW,
+                                                            30,
+                                                            1300);
+        ASSERT_EQ(coldBytes, 600U);
+        ASSERT_EQ(offloads.size(), records.size());
+
+        const char k_EXPECTED[] = {1, 0, 1, 1, 0, 0, 0};
+        for (size_t i = 0; i < offloads.size(); ++i) {
+            ASSERT_EQ_D(i, offloads[i], k_EXPECTED[i]);
+        }
+    }
+
+    {
+        PV("Above the watermark");
+
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            records.begin(),
+                                                            records.end(),
+                                                            k_NOW,
+                                                            0,
+                                                            900);
+        ASSERT_EQ(coldBytes, 600U);
+        ASSERT_EQ(offloads.size(), records.size());
+
+        const char k_EXPECTED[] = {1, 0, 1, 1, 0, 0, 0};
+        for (size_t i = 0; i < offloads.size(); ++i) {
+            ASSERT_EQ_D(i, offloads[i], k_EXPECTED[i]);
+        }
+    }
+
+    {
+        PV("Empty watermark");
+
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            records.begin(),
+                                                            records.end(),
+                                                            k_NOW,
+                                                            0,
+                                                            0);
+        ASSERT_EQ(coldBytes, 1500U);
+
+        const char k_EXPECTED[] = {1, 0, 1, 1, 1, 0, 1};
+        for (size_t i = 0; i < offloads.size(); ++i) {
+            ASSERT_EQ_D(i, offloads[i], k_EXPECTED[i]);
+        }
+    }
+
+    {
+        PV("Message arrived after the rollover timestamp");
+
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            records.begin(),
+                                                            records.end(),
+                                                            k_NOW - 45,
+                                                            1,
+                                                            1300);
+        ASSERT_EQ(coldBytes, 300U);
+
+        const char k_EXPECTED[] = {1, 0, 1, 0, 0, 0, 0};
+        for (size_t i = 0; i < offloads.size(); ++i) {
+            ASSERT_EQ_D(i, offloads[i], k_EXPECTED[i]);
+        }
+    }
+
+    {
+        PV("No records");
+
+        Records empty(s_allocator_p);
+        coldBytes = mqbs::FileStoreUtil::selectColdMessages(&offloads,
+                                                            empty.begin(),
+                                                            empty.end(),
+                                                            k_NOW,
+                                                            10,
+                                                            0);
+        ASSERT_EQ(coldBytes, 0U);
+        ASSERT(offloads.empty());
+    }
+}
+
+static void test3_numRecordsReplicatedSince()
+// ------------------------------------------------------------------------
+// NUM RECORDS REPLICATED SINCE
+//
+// Concerns:
+//   1. Nothing is counted while the oldest unreceipted message has not
+//      been replicated.
+//   2. The oldest unreceipted message and every record replicated after it
+//      are counted.
+//   3. If the primary lease changed since the oldest unreceipted message,
+//      only the records replicated under the new lease are counted.
+//
+// Testing:
+//   numRecordsReplicatedSince
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("NUM RECORDS REPLICATED SINCE");
+
+    typedef mqbs::DataStoreRecordKey Key;
+
+    {
+        PV("Not replicated yet");
+
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(10, 2),
+                                                                 Key(9, 2)),
+                  0U);
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(1, 3),
+                                                                 Key(50, 2)),
+                  0U);
+    }
+
+    {
+        PV("Same lease");
+
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(10, 2),
+                                                                 Key(10, 2)),
+                  1U);
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(10, 2),
+                                                                 Key(109, 2)),
+                  100U);
+    }
+
+    {
+        PV("Lease change");
+
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(500, 2),
+                                                                 Key(1, 3)),
+                  1U);
+        ASSERT_EQ(mqbs::FileStoreUtil::numRecordsReplicatedSince(Key(500, 2),
+                                                                 Key(100, 3)),
+                  100U);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    // One time app initialization.
+    bsls::TimeUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_numRecordsReplicatedSince(); break;
+    case 2: test2_selectColdMessages(); break;
+    case 1: test1_coldFileName(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_ALLOC);
+}
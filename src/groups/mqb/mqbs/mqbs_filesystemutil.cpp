@@ -665,6 +665,66 @@ int FileSystemUtil::flush(void*               mapping,
     return rc_SUCCESS;
 }
 
+int FileSystemUtil::writeback(const MappedFileDescriptor& mfd,
+                              bsls::Types::Uint64         offset,
+                              bsls::Types::Uint64         length,
+                              bool                        waitForDurability,
+                              bsl::ostream&               errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    enum { rc_SUCCESS = 0, rc_SYSCALL_FAILURE = -1 };
+
+    if (0 == length) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'fdatasync' is sufficient for durability since the files are grown to
+    // their full size upfront, and thus their size (metadata) do not change
+    // when records are appended.
+
+    int rc = waitForDurability
+                 ? ::fdatasync(mfd.fd())
+                 : ::sync_file_range(mfd.fd(),
+                                     static_cast<off64_t>(offset),
+                                     static_cast<off64_t>(length),
+                                     SYNC_FILE_RANGE_WRITE);
+    if (0 != rc) {
+        errorDescription << "Failed to "
+                         << (waitForDurability ? "fdatasync"
+                                               : "sync_file_range")
+                         << " file with fd [" << mfd.fd() << "], offset ["
+                         << offset << "], length [" << length
+                         << "], rc: " << rc << ", errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        return rc_SYSCALL_FAILURE;  // RETURN
+    }
+#else
+    // 'msync' requires the address to be aligned on a page boundary.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        ::sysconf(_SC_PAGESIZE));
+    const bsls::Types::Uint64 begin = offset - (offset % pageSize);
+
+    int rc = ::msync(mfd.mapping() + begin,
+                     offset + length - begin,
+                     waitForDurability ? MS_SYNC : MS_ASYNC);
+    if (0 != rc) {
+        errorDescription << "Failed to msync file with fd [" << mfd.fd()
+                         << "], offset [" << begin << "], length ["
+                         << (offset + length - begin) << "], rc: " << rc
+                         << ", errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        return rc_SYSCALL_FAILURE;  // RETURN
+    }
+#endif
+
+    return rc_SUCCESS;
+}
+
 void FileSystemUtil::disableDump(void* mapping, bsls::Types::Uint64 size)
 {
     // PRECONDITIONS
@@ -152,6 +152,23 @@ struct FileSystemUtil {
                      bsls::Types::Uint64 size,
                      bsl::ostream&       errorDescription);
 
+    /// Initiate the write back to disk of the dirty pages in the range of
+    /// the specified `length` bytes starting at the specified `offset` in
+    /// the file represented by the specified `mfd`.  If the specified
+    /// `waitForDurability` flag is true, block until the data of the file
+    /// (up to at least `offset + length`) is durably stored on disk,
+    /// otherwise return as soon as the write back has been initiated.
+    /// Return zero on success, a non-zero value otherwise with the
+    /// specified `errorDescription` containing a detailed error.  Note that
+    /// on Linux, this method uses `sync_file_range` and `fdatasync` which,
+    /// unlike `msync`, do not need to walk the page tables of the whole
+    /// mapping.
+    static int writeback(const MappedFileDescriptor& mfd,
+                         bsls::Types::Uint64         offset,
+                         bsls::Types::Uint64         length,
+                         bool                        waitForDurability,
+                         bsl::ostream&               errorDescription);
+
     /// Indicate to the OS not to dump the specified `mapping` of the
     /// specified `size` to file.  Note that this method only has effect if
     /// on Linux and the `MADV_DONTDUMP` flag is defined.
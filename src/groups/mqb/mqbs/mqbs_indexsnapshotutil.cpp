@@ -0,0 +1,656 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_indexsnapshotutil.cpp                                         -*-C++-*-
+#include <mqbs_indexsnapshotutil.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbs_filestoreprotocol.h>
+
+// BMQ
+#include <bmqp_crc32c.h>
+#include <bmqp_protocol.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdlb_scopeexit.h>
+#include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_cerrno.h>
+#include <bsl_cstring.h>
+#include <bsls_assert.h>
+
+// SYS
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+// CONSTANTS
+const unsigned int k_MAGIC = 0x424D5149;  // 'BMQI'
+
+const unsigned int k_VERSION = 2;
+// Version 2 added the cold tier flag of message records
+
+const int k_HEADER_SIZE = 20;
+// Magic, version, payload length and payload CRC32-C
+
+const unsigned int k_MAX_CRC32C_CHUNK_SIZE = 64 * 1024 * 1024;
+
+// Flags of a serialized record: its 'bmqp::MessagePropertiesInfo', and
+// whether its payload resides in the cold tier data file
+const unsigned char k_MPI_IS_PRESENT  = 1 << 0;
+const unsigned char k_MPI_IS_RECYCLED = 1 << 1;
+const unsigned char k_IS_COLD         = 1 << 2;
+
+// =============
+// class Encoder
+// =============
+
+/// Mechanism to append integers in network byte order, strings, keys and
+/// GUIDs to a buffer.
+class Encoder {
+  private:
+    // DATA
+    bsl::vector<char>* d_buffer_p;
+
+  public:
+    // CREATORS
+    explicit Encoder(bsl::vector<char>* buffer)
+    : d_buffer_p(buffer)
+    {
+    }
+
+    // MANIPULATORS
+    void putBytes(const void* data, bsl::size_t length)
+    {
+        const char* begin = static_cast<const char*>(data);
+        d_buffer_p->insert(d_buffer_p->end(), begin, begin + length);
+    }
+
+    void putUint8(unsigned char value)
+    {
+        d_buffer_p->push_back(static_cast<char>(value));
+    }
+
+    void putUint16(unsigned short value)
+    {
+        const bdlb::BigEndianUint16 v = bdlb::BigEndianUint16::make(value);
+        putBytes(&v, sizeof(v));
+    }
+
+    void putUint32(unsigned int value)
+    {
+        const bdlb::BigEndianUint32 v = bdlb::BigEndianUint32::make(value);
+        putBytes(&v, sizeof(v));
+    }
+
+    void putUint64(bsls::Types::Uint64 value)
+    {
+        const bdlb::BigEndianUint64 v = bdlb::BigEndianUint64::make(value);
+        putBytes(&v, sizeof(v));
+    }
+
+    void putString(const bsl::string& value)
+    {
+        putUint32(static_cast<unsigned int>(value.length()));
+        putBytes(value.data(), value.length());
+    }
+
+    void putStorageKey(const mqbu::StorageKey& value)
+    {
+        putBytes(value.data(), mqbu::StorageKey::e_KEY_LENGTH_BINARY);
+    }
+
+    void putGuid(const bmqt::MessageGUID& value)
+    {
+        unsigned char buffer[bmqt::MessageGUID::e_SIZE_BINARY];
+        value.toBinary(buffer);
+        putBytes(buffer, sizeof(buffer));
+    }
+};
+
+// =============
+// class Decoder
+// =============
+
+/// Mechanism to read back, with bounds checking, what `Encoder` wrote.  Once
+/// a read goes past the end of the buffer, all subsequent reads return zero
+/// values and `isValid` returns false.
+class Decoder {
+  private:
+    // DATA
+    const char* d_cursor_p;
+
+    const char* d_end_p;
+
+    bool d_isValid;
+
+  public:
+    // CREATORS
+    Decoder(const char* begin, const char* end)
+    : d_cursor_p(begin)
+    , d_end_p(end)
+    , d_isValid(true)
+    {
+    }
+
+    // MANIPULATORS
+    bool getBytes(void* buffer, bsl::size_t length)
+    {
+        if (!d_isValid ||
+            static_cast<bsl::size_t>(d_end_p - d_cursor_p) < length) {
+            d_isValid = false;
+            bsl::memset(buffer, 0, length);
+            return false;  // RETURN
+        }
+
+        bsl::memcpy(buffer, d_cursor_p, length);
+        d_cursor_p += length;
+        return true;
+    }
+
+    unsigned char getUint8()
+    {
+        unsigned char value;
+        getBytes(&value, sizeof(value));
+        return value;
+    }
+
+    unsigned short getUint16()
+    {
+        bdlb::BigEndianUint16 value;
+        getBytes(&value, sizeof(value));
+        return value;
+    }
+
+    unsigned int getUint32()
+    {
+        bdlb::BigEndianUint32 value;
+        getBytes(&value, sizeof(value));
+        return value;
+    }
+
+    bsls::Types::Uint64 getUint64()
+    {
+        bdlb::BigEndianUint64 value;
+        getBytes(&value, sizeof(value));
+        return value;
+    }
+
+    void getString(bsl::string* value)
+    {
+        const unsigned int length = getUint32();
+        if (!d_isValid ||
+            static_cast<bsl::size_t>(d_end_p - d_cursor_p) < length) {
+            d_isValid = false;
+            value->clear();
+            return;  // RETURN
+        }
+
+        value->assign(d_cursor_p, length);
+        d_cursor_p += length;
+    }
+
+    void getStorageKey(mqbu::StorageKey* value)
+    {
+        char buffer[mqbu::StorageKey::e_KEY_LENGTH_BINARY];
+        getBytes(buffer, sizeof(buffer));
+        value->fromBinary(buffer);
+    }
+
+    void getGuid(bmqt::MessageGUID* value)
+    {
+        unsigned char buffer[bmqt::MessageGUID::e_SIZE_BINARY];
+        getBytes(buffer, sizeof(buffer));
+        value->fromBinary(buffer);
+    }
+
+    // ACCESSORS
+    bool isValid() const { return d_isValid; }
+
+    bool isEmpty() const { return d_cursor_p == d_end_p; }
+
+    bsl::size_t numBytesLeft() const { return d_end_p - d_cursor_p; }
+};
+
+/// Return the CRC32-C of the specified `length` bytes at the specified
+/// `data`.
+unsigned int calculateCrc32c(const char* data, bsl::size_t length)
+{
+    unsigned int crc32c = bmqp::Crc32c::k_NULL_CRC32C;
+    while (length) {
+        const unsigned int chunkLength = static_cast<unsigned int>(
+            bsl::min(length,
+                     static_cast<bsl::size_t>(k_MAX_CRC32C_CHUNK_SIZE)));
+        crc32c = bmqp::Crc32c::calculate(data, chunkLength, crc32c);
+        data += chunkLength;
+        length -= chunkLength;
+    }
+
+    return crc32c;
+}
+
+void encodeRecord(Encoder* encoder, const IndexSnapshot::Record& record)
+{
+    const DataStoreRecord& rec = record.d_record;
+
+    unsigned char mpiFlags = 0;
+    if (rec.d_messagePropertiesInfo.isPresent()) {
+        mpiFlags |= k_MPI_IS_PRESENT;
+    }
+    if (rec.d_messagePropertiesInfo.isRecycled()) {
+        mpiFlags |= k_MPI_IS_RECYCLED;
+    }
+    if (rec.d_isCold) {
+        mpiFlags |= k_IS_COLD;
+    }
+
+    encoder->putUint64(record.d_key.d_sequenceNum);
+    encoder->putUint32(record.d_key.d_primaryLeaseId);
+    encoder->putUint8(static_cast<unsigned char>(rec.d_recordType));
+    encoder->putUint64(rec.d_recordOffset);
+    encoder->putUint64(rec.d_messageOffset);
+    encoder->putUint32(rec.d_appDataUnpaddedLen);
+    encoder->putUint32(rec.d_dataOrQlistRecordPaddedLen);
+    encoder->putUint8(mpiFlags);
+    encoder->putUint16(rec.d_messagePropertiesInfo.schemaId());
+    encoder->putUint64(rec.d_arrivalTimestamp);
+    encoder->putStorageKey(record.d_queueKey);
+    encoder->putStorageKey(record.d_appKey);
+    encoder->putGuid(record.d_guid);
+}
+
+void decodeRecord(IndexSnapshot::Record* record, Decoder* decoder)
+{
+    DataStoreRecord& rec = record->d_record;
+
+    record->d_key.d_sequenceNum    = decoder->getUint64();
+    record->d_key.d_primaryLeaseId = decoder->getUint32();
+    rec.d_recordType = static_cast<RecordType::Enum>(decoder->getUint8());
+    rec.d_recordOffset               = decoder->getUint64();
+    rec.d_messageOffset              = decoder->getUint64();
+    rec.d_appDataUnpaddedLen         = decoder->getUint32();
+    rec.d_dataOrQlistRecordPaddedLen = decoder->getUint32();
+
+    const unsigned char  mpiFlags = decoder->getUint8();
+    const unsigned short schemaId = decoder->getUint16();
+    rec.d_messagePropertiesInfo   = bmqp::MessagePropertiesInfo(
+        0 != (mpiFlags & k_MPI_IS_PRESENT),
+        schemaId,
+        0 != (mpiFlags & k_MPI_IS_RECYCLED));
+    rec.d_isCold = 0 != (mpiFlags & k_IS_COLD);
+
+    // Recovered records are always considered receipted.
+    rec.d_hasReceipt       = true;
+    rec.d_arrivalTimepoint = 0;
+    rec.d_arrivalTimestamp = decoder->getUint64();
+
+    decoder->getStorageKey(&record->d_queueKey);
+    decoder->getStorageKey(&record->d_appKey);
+    decoder->getGuid(&record->d_guid);
+}
+
+}  // close unnamed namespace
+
+// --------------------
+// struct IndexSnapshot
+// --------------------
+
+// CREATORS
+IndexSnapshot::IndexSnapshot(bslma::Allocator* basicAllocator)
+: d_partitionId(-1)
+, d_syncPointOffset(0)
+, d_primaryLeaseId(0)
+, d_sequenceNum(0)
+, d_timestamp(0)
+, d_dataFileOffset(0)
+, d_qlistFileOffset(0)
+, d_syncPoints(basicAllocator)
+, d_queues(basicAllocator)
+, d_records(basicAllocator)
+{
+    // NOTHING
+}
+
+IndexSnapshot::IndexSnapshot(const IndexSnapshot& other,
+                             bslma::Allocator*    basicAllocator)
+: d_partitionId(other.d_partitionId)
+, d_syncPointOffset(other.d_syncPointOffset)
+, d_primaryLeaseId(other.d_primaryLeaseId)
+, d_sequenceNum(other.d_sequenceNum)
+, d_timestamp(other.d_timestamp)
+, d_dataFileOffset(other.d_dataFileOffset)
+, d_qlistFileOffset(other.d_qlistFileOffset)
+, d_syncPoints(other.d_syncPoints, basicAllocator)
+, d_queues(other.d_queues, basicAllocator)
+, d_records(other.d_records, basicAllocator)
+{
+    // NOTHING
+}
+
+// ------------------------
+// struct IndexSnapshotUtil
+// ------------------------
+
+// CLASS METHODS
+int IndexSnapshotUtil::save(bsl::ostream&        errorDescription,
+                            const bsl::string&   path,
+                            const IndexSnapshot& snapshot)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_OPEN_FAILURE  = -1,
+        rc_WRITE_FAILURE = -2,
+        rc_SYNC_FAILURE  = -3
+    };
+
+    bslma::Allocator* allocator =
+        snapshot.d_records.get_allocator().mechanism();
+
+    // Encode the payload first, leaving room for the header.
+    bsl::vector<char> buffer(allocator);
+    buffer.reserve(k_HEADER_SIZE + 64 * (snapshot.d_records.size() + 1));
+    buffer.resize(k_HEADER_SIZE);
+
+    Encoder encoder(&buffer);
+    encoder.putUint32(static_cast<unsigned int>(snapshot.d_partitionId));
+    encoder.putUint64(snapshot.d_syncPointOffset);
+    encoder.putUint32(snapshot.d_primaryLeaseId);
+    encoder.putUint64(snapshot.d_sequenceNum);
+    encoder.putUint64(snapshot.d_timestamp);
+    encoder.putUint64(snapshot.d_dataFileOffset);
+    encoder.putUint64(snapshot.d_qlistFileOffset);
+
+    encoder.putUint32(
+        static_cast<unsigned int>(snapshot.d_syncPoints.size()));
+    for (IndexSnapshot::SyncPoints::const_iterator it =
+             snapshot.d_syncPoints.begin();
+         it != snapshot.d_syncPoints.end();
+         ++it) {
+        const bmqp_ctrlmsg::SyncPoint& syncPoint = it->syncPoint();
+        encoder.putUint32(syncPoint.primaryLeaseId());
+        encoder.putUint64(syncPoint.sequenceNum());
+        encoder.putUint32(syncPoint.dataFileOffsetDwords());
+        encoder.putUint32(syncPoint.qlistFileOffsetWords());
+        encoder.putUint64(it->offset());
+    }
+
+    encoder.putUint32(static_cast<unsigned int>(snapshot.d_queues.size()));
+    for (IndexSnapshot::QueueKeyInfoMap::const_iterator it =
+             snapshot.d_queues.begin();
+         it != snapshot.d_queues.end();
+         ++it) {
+        const DataStoreConfigQueueInfo&                qinfo = it->second;
+        const DataStoreConfigQueueInfo::AppIdKeyPairs& appIdKeyPairs =
+            qinfo.appIdKeyPairs();
+
+        encoder.putStorageKey(it->first);
+        encoder.putString(qinfo.canonicalQueueUri());
+        encoder.putUint32(static_cast<unsigned int>(appIdKeyPairs.size()));
+        for (bsl::size_t n = 0; n < appIdKeyPairs.size(); ++n) {
+            encoder.putString(appIdKeyPairs[n].first);
+            encoder.putStorageKey(appIdKeyPairs[n].second);
+        }
+    }
+
+    encoder.putUint64(snapshot.d_records.size());
+    for (IndexSnapshot::Records::const_iterator it =
+             snapshot.d_records.begin();
+         it != snapshot.d_records.end();
+         ++it) {
+        encodeRecord(&encoder, *it);
+    }
+
+    // Now that the payload is known, populate the header.
+    const bsls::Types::Uint64 payloadLength = buffer.size() - k_HEADER_SIZE;
+    const unsigned int        crc32c        = calculateCrc32c(
+        buffer.data() + k_HEADER_SIZE,
+        payloadLength);
+
+    bsl::vector<char> header(allocator);
+    Encoder           headerEncoder(&header);
+    headerEncoder.putUint32(k_MAGIC);
+    headerEncoder.putUint32(k_VERSION);
+    headerEncoder.putUint64(payloadLength);
+    headerEncoder.putUint32(crc32c);
+    BSLS_ASSERT_SAFE(k_HEADER_SIZE == static_cast<int>(header.size()));
+    bsl::memcpy(buffer.data(), header.data(), k_HEADER_SIZE);
+
+    // Write the file.
+    const int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0660);
+    if (-1 == fd) {
+        errorDescription << "Failed to open index snapshot file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny closeGuard(bdlf::BindUtil::bind(&::close, fd));
+
+    const char* data      = buffer.data();
+    bsl::size_t remaining = buffer.size();
+    while (remaining) {
+        const ssize_t rc = ::write(fd, data, remaining);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;  // CONTINUE
+            }
+
+            errorDescription << "Failed to write index snapshot file ["
+                             << path << "], errno: " << errno << " ["
+                             << bsl::strerror(errno) << "].";
+            return rc_WRITE_FAILURE;  // RETURN
+        }
+
+        data += rc;
+        remaining -= rc;
+    }
+
+    if (0 != ::fdatasync(fd)) {
+        errorDescription << "Failed to sync index snapshot file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_SYNC_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int IndexSnapshotUtil::load(bsl::ostream&      errorDescription,
+                            IndexSnapshot*     snapshot,
+                            const bsl::string& path)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(snapshot);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_OPEN_FAILURE    = -1,
+        rc_READ_FAILURE    = -2,
+        rc_INVALID_HEADER  = -3,
+        rc_INVALID_VERSION = -4,
+        rc_INVALID_LENGTH  = -5,
+        rc_CRC32C_MISMATCH = -6,
+        rc_INVALID_PAYLOAD = -7
+    };
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (-1 == fd) {
+        errorDescription << "Failed to open index snapshot file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny closeGuard(bdlf::BindUtil::bind(&::close, fd));
+
+    struct stat st;
+    if (0 != ::fstat(fd, &st)) {
+        errorDescription << "Failed to stat index snapshot file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_READ_FAILURE;  // RETURN
+    }
+
+    if (st.st_size < k_HEADER_SIZE) {
+        errorDescription << "Index snapshot file [" << path << "] is too "
+                         << "small: " << st.st_size << " bytes.";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    bslma::Allocator* allocator = snapshot->d_records.get_allocator()
+                                      .mechanism();
+
+    bsl::vector<char> buffer(static_cast<bsl::size_t>(st.st_size),
+                             allocator);
+    char*             data      = buffer.data();
+    bsl::size_t       remaining = buffer.size();
+    while (remaining) {
+        const ssize_t rc = ::read(fd, data, remaining);
+        if (rc <= 0) {
+            if (rc < 0 && EINTR == errno) {
+                continue;  // CONTINUE
+            }
+
+            errorDescription << "Failed to read index snapshot file ["
+                             << path << "], errno: " << errno << " ["
+                             << bsl::strerror(errno) << "].";
+            return rc_READ_FAILURE;  // RETURN
+        }
+
+        data += rc;
+        remaining -= rc;
+    }
+
+    Decoder headerDecoder(buffer.data(), buffer.data() + k_HEADER_SIZE);
+    const unsigned int        magic         = headerDecoder.getUint32();
+    const unsigned int        version       = headerDecoder.getUint32();
+    const bsls::Types::Uint64 payloadLength = headerDecoder.getUint64();
+    const unsigned int        crc32c        = headerDecoder.getUint32();
+
+    if (k_MAGIC != magic) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid magic: " << magic << ".";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    if (k_VERSION != version) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "unsupported version: " << version << ".";
+        return rc_INVALID_VERSION;  // RETURN
+    }
+
+    if (payloadLength != buffer.size() - k_HEADER_SIZE) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid payload length: " << payloadLength
+                         << ", file size: " << buffer.size() << ".";
+        return rc_INVALID_LENGTH;  // RETURN
+    }
+
+    const char* payload = buffer.data() + k_HEADER_SIZE;
+    if (crc32c != calculateCrc32c(payload, payloadLength)) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid CRC32-C.";
+        return rc_CRC32C_MISMATCH;  // RETURN
+    }
+
+    // Decode the payload.  Note that list sizes are checked against the
+    // number of bytes left before reserving any memory.
+
+    Decoder decoder(payload, payload + payloadLength);
+
+    snapshot->d_partitionId     = static_cast<int>(decoder.getUint32());
+    snapshot->d_syncPointOffset = decoder.getUint64();
+    snapshot->d_primaryLeaseId  = decoder.getUint32();
+    snapshot->d_sequenceNum     = decoder.getUint64();
+    snapshot->d_timestamp       = decoder.getUint64();
+    snapshot->d_dataFileOffset  = decoder.getUint64();
+    snapshot->d_qlistFileOffset = decoder.getUint64();
+
+    const unsigned int numSyncPoints = decoder.getUint32();
+    snapshot->d_syncPoints.clear();
+    if (numSyncPoints > decoder.numBytesLeft()) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid number of sync points: "
+                         << numSyncPoints << ".";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+    snapshot->d_syncPoints.resize(numSyncPoints);
+    for (unsigned int i = 0; i < numSyncPoints; ++i) {
+        bmqp_ctrlmsg::SyncPointOffsetPair& spoPair =
+            snapshot->d_syncPoints[i];
+        bmqp_ctrlmsg::SyncPoint& syncPoint = spoPair.syncPoint();
+        syncPoint.primaryLeaseId()         = decoder.getUint32();
+        syncPoint.sequenceNum()            = decoder.getUint64();
+        syncPoint.dataFileOffsetDwords()   = decoder.getUint32();
+        syncPoint.qlistFileOffsetWords()   = decoder.getUint32();
+        spoPair.offset()                   = decoder.getUint64();
+    }
+
+    const unsigned int numQueues = decoder.getUint32();
+    snapshot->d_queues.clear();
+    for (unsigned int i = 0; i < numQueues && decoder.isValid(); ++i) {
+        mqbu::StorageKey queueKey;
+        decoder.getStorageKey(&queueKey);
+
+        DataStoreConfigQueueInfo& qinfo = snapshot->d_queues[queueKey];
+        qinfo.setPartitionId(snapshot->d_partitionId);
+
+        bsl::string uri(allocator);
+        decoder.getString(&uri);
+        qinfo.setCanonicalQueueUri(uri);
+
+        const unsigned int numAppIds = decoder.getUint32();
+        for (unsigned int n = 0; n < numAppIds && decoder.isValid(); ++n) {
+            DataStoreConfigQueueInfo::AppIdKeyPair appIdKeyPair;
+            decoder.getString(&appIdKeyPair.first);
+            decoder.getStorageKey(&appIdKeyPair.second);
+            qinfo.addAppIdKeyPair(appIdKeyPair);
+        }
+    }
+
+    const bsls::Types::Uint64 numRecords = decoder.getUint64();
+    snapshot->d_records.clear();
+    if (numRecords > decoder.numBytesLeft()) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid number of records: " << numRecords
+                         << ".";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+    snapshot->d_records.resize(numRecords);
+    for (bsls::Types::Uint64 i = 0; i < numRecords; ++i) {
+        decodeRecord(&snapshot->d_records[i], &decoder);
+    }
+
+    if (!decoder.isValid() || !decoder.isEmpty()) {
+        errorDescription << "Index snapshot file [" << path << "] has an "
+                         << "invalid payload.";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,196 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_indexsnapshotutil.h                                           -*-C++-*-
+#ifndef INCLUDED_MQBS_INDEXSNAPSHOTUTIL
+#define INCLUDED_MQBS_INDEXSNAPSHOTUTIL
+
+//@PURPOSE: Provide utilities to persist the in-memory index of a partition.
+//
+//@CLASSES:
+//  mqbs::IndexSnapshot:     Snapshot of the in-memory index of a partition
+//  mqbs::IndexSnapshotUtil: Utilities to save and load an 'IndexSnapshot'
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: 'mqbs::IndexSnapshot' is a value-semantic-like struct holding
+// the state a 'mqbs::FileStore' rebuilds from its journal at startup (the
+// outstanding records, the queues and their appId/appKey pairs, and the sync
+// points), as of a given sync point record of the journal.  Its purpose is to
+// let recovery replay only the records appended to the journal after that
+// sync point, instead of the whole journal.  'mqbs::IndexSnapshotUtil'
+// provides routines to save an 'mqbs::IndexSnapshot' to, and load it from, a
+// file.
+//
+// Note that an index snapshot is only a cache of the journal: it can always
+// be discarded, in which case the whole journal is replayed.
+//
+/// File Format
+///-----------
+// All integers are in network byte order.  The file starts with a fixed size
+// header:
+//..
+//  +---------------+---------------+---------------+---------------+
+//  |                             Magic                             |
+//  +---------------+---------------+---------------+---------------+
+//  |                            Version                            |
+//  +---------------+---------------+---------------+---------------+
+//  |                      Payload Length (upper)                   |
+//  +---------------+---------------+---------------+---------------+
+//  |                      Payload Length (lower)                   |
+//  +---------------+---------------+---------------+---------------+
+//  |                        Payload CRC32-C                        |
+//  +---------------+---------------+---------------+---------------+
+//..
+// followed by the payload, which contains the fields of the snapshot, then
+// the sync points, the queues and the records, each list being prefixed by
+// its number of elements.  A file which is truncated, whose payload CRC32-C
+// does not match, or which has an unknown version is rejected by 'load'.
+
+// MQB
+
+#include <mqbs_datastore.h>
+#include <mqbu_storagekey.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ====================
+// struct IndexSnapshot
+// ====================
+
+/// Snapshot of the in-memory index of a partition as of a sync point.
+struct IndexSnapshot {
+    // TYPES
+
+    /// An outstanding record, along with the keys and GUID of the journal
+    /// record it refers to, so that the records appended to the journal
+    /// after the snapshot can be applied without reading the journal again.
+    struct Record {
+        // DATA
+        DataStoreRecordKey d_key;
+
+        DataStoreRecord d_record;
+
+        mqbu::StorageKey d_queueKey;
+        // Null unless the record is a message, confirm or queue op.
+
+        mqbu::StorageKey d_appKey;
+        // Null unless the record is a confirm or queue op for a specific
+        // appKey.
+
+        bmqt::MessageGUID d_guid;
+        // Unset unless the record is a message or confirm.
+    };
+
+    typedef bsl::vector<Record> Records;
+
+    typedef bsl::vector<bmqp_ctrlmsg::SyncPointOffsetPair> SyncPoints;
+
+    typedef DataStoreConfig::QueueKeyInfoMap QueueKeyInfoMap;
+
+    // DATA
+    int d_partitionId;
+
+    bsls::Types::Uint64 d_syncPointOffset;
+    // Offset, in the journal, of the sync point as of which this snapshot
+    // was taken.
+
+    unsigned int d_primaryLeaseId;
+    // Primary leaseId in the record header of the sync point.
+
+    bsls::Types::Uint64 d_sequenceNum;
+    // Sequence number in the record header of the sync point.
+
+    bsls::Types::Uint64 d_timestamp;
+    // Timestamp in the record header of the sync point.
+
+    bsls::Types::Uint64 d_dataFileOffset;
+    // Offset of the end of the last record in the DATA file.
+
+    bsls::Types::Uint64 d_qlistFileOffset;
+    // Offset of the end of the last record in the QLIST file, if any.
+
+    SyncPoints d_syncPoints;
+    // Sync points of the journal, from oldest to newest, ending with the
+    // one as of which this snapshot was taken.
+
+    QueueKeyInfoMap d_queues;
+    // Queues (and their appId/appKey pairs) alive in the partition.  Empty
+    // if the queues are not recorded in the partition (CSL FSM workflow).
+
+    Records d_records;
+    // Outstanding records, in the order of 'mqbs::FileStore'.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IndexSnapshot, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `IndexSnapshot` object, using the specified
+    /// `basicAllocator` to supply memory.
+    explicit IndexSnapshot(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an `IndexSnapshot` object having the same value as the
+    /// specified `other`, using the specified `basicAllocator` to supply
+    /// memory.
+    IndexSnapshot(const IndexSnapshot& other,
+                  bslma::Allocator*    basicAllocator = 0);
+};
+
+// ========================
+// struct IndexSnapshotUtil
+// ========================
+
+/// This component provides utilities to save and load an `IndexSnapshot`.
+struct IndexSnapshotUtil {
+    // CLASS METHODS
+
+    /// Write the specified `snapshot` to the file at the specified `path`,
+    /// truncating it if it exists, and durably sync it to disk.  Return
+    /// zero on success, non-zero value otherwise and populate the specified
+    /// `errorDescription` with details.  Note that the file is left in a
+    /// state rejected by `load` if this method fails or is interrupted.
+    static int save(bsl::ostream&        errorDescription,
+                    const bsl::string&   path,
+                    const IndexSnapshot& snapshot);
+
+    /// Load into the specified `snapshot` the content of the file at the
+    /// specified `path`.  Return zero on success, non-zero value if the
+    /// file cannot be read, is corrupted or has an unsupported version and
+    /// populate the specified `errorDescription` with details.  Behavior is
+    /// undefined unless `snapshot` is non-null.
+    static int load(bsl::ostream&      errorDescription,
+                    IndexSnapshot*     snapshot,
+                    const bsl::string& path);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,386 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_indexsnapshotutil.t.cpp                                       -*-C++-*-
+#include <mqbs_indexsnapshotutil.h>
+
+// MQB
+#include <mqbs_filestoreprotocol.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+#include <mwcu_tempfile.h>
+
+// BDE
+#include <bsl_fstream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_timeutil.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Populate the specified `snapshot` with a few sync points, queues and
+/// records.
+void populateSnapshot(mqbs::IndexSnapshot* snapshot)
+{
+    snapshot->d_partitionId     = 3;
+    snapshot->d_syncPointOffset = 4096;
+    snapshot->d_primaryLeaseId  = 7;
+    snapshot->d_sequenceNum     = 1234;
+    snapshot->d_timestamp       = 1700000000;
+    snapshot->d_dataFileOffset  = 8192;
+    snapshot->d_qlistFileOffset = 512;
+
+    for (unsigned int i = 0; i < 3; ++i) {
+        bmqp_ctrlmsg::SyncPointOffsetPair spoPair;
+        spoPair.syncPoint().primaryLeaseId()       = 7;
+        spoPair.syncPoint().sequenceNum()          = 1000 + i;
+        spoPair.syncPoint().dataFileOffsetDwords() = 100 * i;
+        spoPair.syncPoint().qlistFileOffsetWords() = 10 * i;
+        spoPair.offset()                           = 1024 * (i + 1);
+        snapshot->d_syncPoints.push_back(spoPair);
+    }
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+    const mqbu::StorageKey appKey(mqbu::StorageKey::BinaryRepresentation(),
+                                  "fghij");
+
+    mqbs::DataStoreConfigQueueInfo& qinfo = snapshot->d_queues[queueKey];
+    qinfo.setCanonicalQueueUri("bmq://bmq.test.persistent.priority/q1");
+    qinfo.setPartitionId(snapshot->d_partitionId);
+    qinfo.addAppIdKeyPair(mqbs::DataStoreConfigQueueInfo::AppIdKeyPair(
+        "foo",
+        appKey));
+
+    for (unsigned int i = 0; i < 5; ++i) {
+        mqbs::IndexSnapshot::Record record;
+        record.d_key = mqbs::DataStoreRecordKey(100 + i, 7);
+        record.d_record.d_recordType     = (i % 2)
+                                               ? mqbs::RecordType::e_CONFIRM
+                                               : mqbs::RecordType::e_MESSAGE;
+        record.d_record.d_recordOffset   = 64 * (i + 1);
+        record.d_record.d_messageOffset  = (i % 2) ? 0 : 128 * (i + 1);
+        record.d_record.d_appDataUnpaddedLen         = (i % 2) ? 0 : 37;
+        record.d_record.d_dataOrQlistRecordPaddedLen = (i % 2) ? 0 : 48;
+        record.d_record.d_messagePropertiesInfo =
+            bmqp::MessagePropertiesInfo(true, 2 * i, 1 == i % 2);
+        record.d_record.d_isCold           = (0 == i % 4);
+        record.d_record.d_arrivalTimestamp = 1700000000 + i;
+        record.d_queueKey                  = queueKey;
+        if (i % 2) {
+            record.d_appKey = appKey;
+        }
+        record.d_guid.fromHex("0000000000003039CD8101000000270F");
+        snapshot->d_records.push_back(record);
+    }
+}
+
+/// Read the content of the file at the specified `path` into the specified
+/// `content`.
+void readFile(bsl::vector<char>* content, const bsl::string& path)
+{
+    bsl::ifstream file(path.c_str(), bsl::ios::binary);
+    content->assign(bsl::istreambuf_iterator<char>(file),
+                    bsl::istreambuf_iterator<char>());
+}
+
+/// Write the specified `content` to the file at the specified `path`.
+void writeFile(const bsl::string& path, const bsl::vector<char>& content)
+{
+    bsl::ofstream file(path.c_str(), bsl::ios::binary | bsl::ios::trunc);
+    file.write(content.data(), content.size());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   A snapshot saved to a file is loaded back with the same value.
+//
+// Testing:
+//   static int save(...);
+//   static int load(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcu::TempFile      tempFile(s_allocator_p);
+    mqbs::IndexSnapshot snapshot(s_allocator_p);
+    populateSnapshot(&snapshot);
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0,
+              mqbs::IndexSnapshotUtil::save(errorDesc,
+                                            tempFile.path(),
+                                            snapshot));
+
+    mqbs::IndexSnapshot loaded(s_allocator_p);
+    ASSERT_EQ(0,
+              mqbs::IndexSnapshotUtil::load(errorDesc,
+                                            &loaded,
+                                            tempFile.path()));
+
+    ASSERT_EQ(snapshot.d_partitionId, loaded.d_partitionId);
+    ASSERT_EQ(snapshot.d_syncPointOffset, loaded.d_syncPointOffset);
+    ASSERT_EQ(snapshot.d_primaryLeaseId, loaded.d_primaryLeaseId);
+    ASSERT_EQ(snapshot.d_sequenceNum, loaded.d_sequenceNum);
+    ASSERT_EQ(snapshot.d_timestamp, loaded.d_timestamp);
+    ASSERT_EQ(snapshot.d_dataFileOffset, loaded.d_dataFileOffset);
+    ASSERT_EQ(snapshot.d_qlistFileOffset, loaded.d_qlistFileOffset);
+    ASSERT(snapshot.d_syncPoints == loaded.d_syncPoints);
+
+    ASSERT_EQ(snapshot.d_queues.size(), loaded.d_queues.size());
+    const mqbs::DataStoreConfigQueueInfo& expectedQInfo =
+        snapshot.d_queues.begin()->second;
+    mqbs::IndexSnapshot::QueueKeyInfoMap::const_iterator qit =
+        loaded.d_queues.find(snapshot.d_queues.begin()->first);
+    ASSERT(qit != loaded.d_queues.end());
+    ASSERT_EQ(expectedQInfo.canonicalQueueUri(),
+              qit->second.canonicalQueueUri());
+    ASSERT_EQ(expectedQInfo.partitionId(), qit->second.partitionId());
+    ASSERT(expectedQInfo.appIdKeyPairs() == qit->second.appIdKeyPairs());
+
+    ASSERT_EQ(snapshot.d_records.size(), loaded.d_records.size());
+    for (size_t i = 0; i < snapshot.d_records.size(); ++i) {
+        const mqbs::IndexSnapshot::Record& expected = snapshot.d_records[i];
+        const mqbs::IndexSnapshot::Record& actual   = loaded.d_records[i];
+
+        ASSERT_EQ_D(i, expected.d_key, actual.d_key);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_recordType,
+                    actual.d_record.d_recordType);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_recordOffset,
+                    actual.d_record.d_recordOffset);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_messageOffset,
+                    actual.d_record.d_messageOffset);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_appDataUnpaddedLen,
+                    actual.d_record.d_appDataUnpaddedLen);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_dataOrQlistRecordPaddedLen,
+                    actual.d_record.d_dataOrQlistRecordPaddedLen);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_messagePropertiesInfo.isPresent(),
+                    actual.d_record.d_messagePropertiesInfo.isPresent());
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_messagePropertiesInfo.schemaId(),
+                    actual.d_record.d_messagePropertiesInfo.schemaId());
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_messagePropertiesInfo.isRecycled(),
+                    actual.d_record.d_messagePropertiesInfo.isRecycled());
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_isCold,
+                    actual.d_record.d_isCold);
+        ASSERT_EQ_D(i,
+                    expected.d_record.d_arrivalTimestamp,
+                    actual.d_record.d_arrivalTimestamp);
+        ASSERT_EQ_D(i, expected.d_queueKey, actual.d_queueKey);
+        ASSERT_EQ_D(i, expected.d_appKey, actual.d_appKey);
+        ASSERT_EQ_D(i, expected.d_guid, actual.d_guid);
+    }
+}
+
+static void test2_emptySnapshot()
+// ------------------------------------------------------------------------
+// EMPTY SNAPSHOT
+//
+// Concerns:
+//   A snapshot without any sync point, queue or record can be saved and
+//   loaded back.
+//
+// Testing:
+//   static int save(...);
+//   static int load(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("EMPTY SNAPSHOT");
+
+    mwcu::TempFile      tempFile(s_allocator_p);
+    mqbs::IndexSnapshot snapshot(s_allocator_p);
+    snapshot.d_partitionId = 0;
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0,
+              mqbs::IndexSnapshotUtil::save(errorDesc,
+                                            tempFile.path(),
+                                            snapshot));
+
+    mqbs::IndexSnapshot loaded(s_allocator_p);
+    populateSnapshot(&loaded);
+    ASSERT_EQ(0,
+              mqbs::IndexSnapshotUtil::load(errorDesc,
+                                            &loaded,
+                                            tempFile.path()));
+    ASSERT_EQ(0, loaded.d_partitionId);
+    ASSERT(loaded.d_syncPoints.empty());
+    ASSERT(loaded.d_queues.empty());
+    ASSERT(loaded.d_records.empty());
+}
+
+static void test3_corruptedSnapshot()
+// ------------------------------------------------------------------------
+// CORRUPTED SNAPSHOT
+//
+// Concerns:
+//   A missing, truncated, extended or corrupted snapshot file is rejected.
+//
+// Testing:
+//   static int load(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CORRUPTED SNAPSHOT");
+
+    mwcu::TempFile      tempFile(s_allocator_p);
+    mqbs::IndexSnapshot snapshot(s_allocator_p);
+    populateSnapshot(&snapshot);
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0,
+              mqbs::IndexSnapshotUtil::save(errorDesc,
+                                            tempFile.path(),
+                                            snapshot));
+
+    bsl::vector<char> content(s_allocator_p);
+    readFile(&content, tempFile.path());
+    ASSERT(!content.empty());
+
+    {
+        PV("Missing file");
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        bsl::string         path(tempFile.path() + ".missing",
+                         s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc, &loaded, path));
+    }
+
+    {
+        PV("Truncated header");
+        writeFile(tempFile.path(),
+                  bsl::vector<char>(content.begin(),
+                                    content.begin() + 10,
+                                    s_allocator_p));
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+    }
+
+    {
+        PV("Truncated payload");
+        writeFile(tempFile.path(),
+                  bsl::vector<char>(content.begin(),
+                                    content.end() - 1,
+                                    s_allocator_p));
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+    }
+
+    {
+        PV("Extended payload");
+        bsl::vector<char> extended(content, s_allocator_p);
+        extended.push_back('x');
+        writeFile(tempFile.path(), extended);
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+    }
+
+    {
+        PV("Corrupted magic");
+        bsl::vector<char> corrupted(content, s_allocator_p);
+        corrupted[0] ^= 0xFF;
+        writeFile(tempFile.path(), corrupted);
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+    }
+
+    {
+        PV("Corrupted payload");
+        bsl::vector<char> corrupted(content, s_allocator_p);
+        corrupted[corrupted.size() / 2] ^= 0xFF;
+        writeFile(tempFile.path(), corrupted);
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+    }
+
+    {
+        PV("Intact file");
+        writeFile(tempFile.path(), content);
+        mqbs::IndexSnapshot loaded(s_allocator_p);
+        ASSERT_EQ(0,
+                  mqbs::IndexSnapshotUtil::load(errorDesc,
+                                                &loaded,
+                                                tempFile.path()));
+        ASSERT_EQ(snapshot.d_records.size(), loaded.d_records.size());
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    // One time app initialization.
+    bsls::TimeUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_corruptedSnapshot(); break;
+    case 2: test2_emptySnapshot(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_ALLOC);
+}
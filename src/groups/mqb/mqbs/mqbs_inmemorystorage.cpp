@@ -70,6 +70,8 @@ InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
               .addMilliseconds(config.deduplicationTimeMs())
               .totalNanoseconds(),
           allocatorStore ? allocatorStore->get("Handles") : d_allocator_p)
+, d_expiryWheel(allocatorStore ? allocatorStore->get("Handles")
+                               : d_allocator_p)
 , d_virtualStorageCatalog(
       this,
       allocatorStore ? allocatorStore->get("VirtualHandles") : d_allocator_p)
@@ -100,6 +102,17 @@ int InMemoryStorage::configure(
     d_capacityMeter.setLimits(limits.messages(), limits.bytes())
         .setWatermarkThresholds(limits.messagesWatermarkRatio(),
                                 limits.bytesWatermarkRatio());
+
+    if (messageTtl > d_ttlSeconds) {
+        // The expiry wheel may have been advanced past the arrival time of
+        // messages which have not expired with the new TTL, so reindex them.
+        d_expiryWheel.clear();
+        for (ItemsMapIter it = d_items.begin(); it != d_items.end(); ++it) {
+            it->second.setExpiryHandle(d_expiryWheel.insert(
+                it->first,
+                it->second.attributes().arrivalTimestamp()));
+        }
+    }
     d_ttlSeconds = messageTtl;
 
     return 0;
@@ -199,9 +212,14 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                         : mqbi::StorageResult::e_LIMIT_BYTES);  // RETURN
         }
 
-        d_items.insert(bsl::make_pair(msgGUID,
-                                      Item(appData, options, *attributes)),
-                       attributes->arrivalTimepoint());
+        bsl::pair<ItemsMapIter, bool> irc = d_items.insert(
+            bsl::make_pair(msgGUID, Item(appData, options, *attributes)),
+            attributes->arrivalTimepoint());
+        if (irc.second) {
+            irc.first->second.setExpiryHandle(
+                d_expiryWheel.insert(msgGUID,
+                                     attributes->arrivalTimestamp()));
+        }
 
         d_virtualStorageCatalog.put(msgGUID,
                                     msgSize,
@@ -246,9 +264,14 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                             storageKeys.size());  // Bump up
     }
     else {
-        d_items.insert(bsl::make_pair(msgGUID,
-                                      Item(appData, options, *attributes)),
-                       attributes->arrivalTimepoint());
+        bsl::pair<ItemsMapIter, bool> irc = d_items.insert(
+            bsl::make_pair(msgGUID, Item(appData, options, *attributes)),
+            attributes->arrivalTimepoint());
+        if (irc.second) {
+            irc.first->second.setExpiryHandle(
+                d_expiryWheel.insert(msgGUID,
+                                     attributes->arrivalTimestamp()));
+        }
     }
 
     return mqbi::StorageResult::e_SUCCESS;  // RETURN
@@ -301,6 +324,7 @@ InMemoryStorage::remove(const bmqt::MessageGUID& msgGUID,
 
     int msgLen = it->second.appData()->length();
 
+    d_expiryWheel.remove(it->second.expiryHandle());
     d_items.erase(it);
 
     // Update resource usage
@@ -331,6 +355,7 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
 
         d_virtualStorageCatalog.removeAll(mqbu::StorageKey::k_NULL_KEY);
         d_items.clear();
+        d_expiryWheel.clear();
         d_capacityMeter.clear();
 
         if (d_queue_p) {
@@ -405,6 +430,7 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
             // zero).  So we just delete the guid from the underlying (this)
             // storage.
 
+            d_expiryWheel.remove(it->second.expiryHandle());
             d_items.erase(it);
         }
 
@@ -433,29 +459,37 @@ int InMemoryStorage::gcExpiredMessages(
     bsls::Types::Int64*  configuredTtlValue,
     bsls::Types::Uint64  secondsFromEpoch)
 {
-    *configuredTtlValue = d_ttlSeconds;
+    *configuredTtlValue      = d_ttlSeconds;
+    *latestMsgTimestampEpoch = 0;
 
     int                      numMsgsDeleted = 0;
     const bsls::Types::Int64 now   = mwcsys::Time::highResolutionTimer();
     int                      limit = k_GC_MESSAGES_BATCH_SIZE;
 
-    for (ItemsMapIter next = d_items.begin(), cit;
-         --limit && next != d_items.end();) {
-        cit = next++;
+    // Messages arrived before 'secondsFromEpoch - d_ttlSeconds' have
+    // expired.  The expiry wheel yields them without walking the items.
+    if (secondsFromEpoch > static_cast<bsls::Types::Uint64>(d_ttlSeconds)) {
+        d_expiryWheel.advance(secondsFromEpoch - d_ttlSeconds);
+    }
+
+    while (--limit > 0 && d_expiryWheel.hasExpired()) {
+        ItemsMapIter it = d_items.find(d_expiryWheel.firstExpired());
+        BSLS_ASSERT_SAFE(it != d_items.end());
 
         const mqbi::StorageMessageAttributes& attribs =
-            cit->second.attributes();
+            it->second.attributes();
         *latestMsgTimestampEpoch = attribs.arrivalTimestamp();
 
         if ((secondsFromEpoch - attribs.arrivalTimestamp()) <=
             static_cast<bsls::Types::Uint64>(d_ttlSeconds)) {
+            // The clock went back.
             break;  // BREAK
         }
 
-        int msgLen = cit->second.appData()->length();
+        int msgLen = it->second.appData()->length();
         d_capacityMeter.remove(1, msgLen);
         if (d_queue_p) {
-            d_queue_p->queueEngine()->beforeMessageRemoved(cit->first);
+            d_queue_p->queueEngine()->beforeMessageRemoved(it->first);
             d_queue_p->stats()->onEvent(
                 mqbstat::QueueStatsDomain::EventType::e_DEL_MESSAGE,
                 msgLen);
@@ -463,16 +497,28 @@ int InMemoryStorage::gcExpiredMessages(
 
         // Remove message from all virtual storages and the physical (this)
         // storage.
-        d_virtualStorageCatalog.remove(cit->first,
+        d_virtualStorageCatalog.remove(it->first,
                                        mqbu::StorageKey::k_NULL_KEY);
-        d_items.erase(cit, now);
+        d_expiryWheel.remove(it->second.expiryHandle());
+        d_items.erase(it, now);
         ++numMsgsDeleted;
     }
 
-    if (d_queue_p && (numMsgsDeleted > 0)) {
+    if (!d_expiryWheel.hasExpired() && !d_items.empty()) {
+        // Report the oldest message, which has not expired.
+        *latestMsgTimestampEpoch =
+            d_items.begin()->second.attributes().arrivalTimestamp();
+    }
+
+    if (d_queue_p) {
+        if (numMsgsDeleted > 0) {
+            d_queue_p->stats()->onEvent(
+                mqbstat::QueueStatsDomain::EventType::e_GC_MESSAGE,
+                numMsgsDeleted);
+        }
         d_queue_p->stats()->onEvent(
-            mqbstat::QueueStatsDomain::EventType::e_GC_MESSAGE,
-            numMsgsDeleted);
+            mqbstat::QueueStatsDomain::EventType::e_GC_TIME,
+            mwcsys::Time::highResolutionTimer() - now);
     }
 
     if (d_items.empty()) {
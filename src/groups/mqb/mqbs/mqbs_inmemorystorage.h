@@ -33,6 +33,7 @@
 
 #include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
+#include <mqbs_expirywheel.h>
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_virtualstoragecatalog.h>
 #include <mqbu_capacitymeter.h>
@@ -92,6 +93,8 @@ class InMemoryStorage_Item {
 
     mqbi::StorageMessageAttributes d_attributes;
 
+    ExpiryWheel::Handle d_expiryHandle;
+
   public:
     // CREATORS
     InMemoryStorage_Item();
@@ -107,6 +110,7 @@ class InMemoryStorage_Item {
     setOptions(const bsl::shared_ptr<bdlbb::Blob>& value);
     InMemoryStorage_Item&
     setAttributes(const mqbi::StorageMessageAttributes& value);
+    InMemoryStorage_Item& setExpiryHandle(ExpiryWheel::Handle value);
     mqbi::StorageMessageAttributes& attributes();
 
     void reset();
@@ -115,6 +119,7 @@ class InMemoryStorage_Item {
     const bsl::shared_ptr<bdlbb::Blob>&   appData() const;
     const bsl::shared_ptr<bdlbb::Blob>&   options() const;
     const mqbi::StorageMessageAttributes& attributes() const;
+    ExpiryWheel::Handle                   expiryHandle() const;
 };
 
 // =====================
@@ -184,6 +189,10 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     ItemsMap d_items;
 
+    ExpiryWheel d_expiryWheel;
+    // Index of the items by arrival timestamp,
+    // used to find the expired ones.
+
     VirtualStorageCatalog d_virtualStorageCatalog;
 
     RecordHandles d_queueOpRecordHandles;
@@ -619,6 +628,7 @@ inline InMemoryStorage_Item::InMemoryStorage_Item()
 : d_appData()
 , d_options()
 , d_attributes()
+, d_expiryHandle(0)
 {
 }
 
@@ -629,6 +639,7 @@ inline InMemoryStorage_Item::InMemoryStorage_Item(
 : d_appData(appData)
 , d_options(options)
 , d_attributes(attributes)
+, d_expiryHandle(0)
 {
 }
 
@@ -654,6 +665,13 @@ inline InMemoryStorage_Item& InMemoryStorage_Item::setAttributes(
     return *this;
 }
 
+inline InMemoryStorage_Item&
+InMemoryStorage_Item::setExpiryHandle(ExpiryWheel::Handle value)
+{
+    d_expiryHandle = value;
+    return *this;
+}
+
 inline mqbi::StorageMessageAttributes& InMemoryStorage_Item::attributes()
 {
     return d_attributes;
@@ -663,6 +681,7 @@ inline void InMemoryStorage_Item::reset()
 {
     d_appData.reset();
     d_options.reset();
+    d_expiryHandle = 0;
 }
 
 // ACCESSORS
@@ -684,6 +703,11 @@ InMemoryStorage_Item::attributes() const
     return d_attributes;
 }
 
+inline ExpiryWheel::Handle InMemoryStorage_Item::expiryHandle() const
+{
+    return d_expiryHandle;
+}
+
 // ---------------------
 // class InMemoryStorage
 // ---------------------
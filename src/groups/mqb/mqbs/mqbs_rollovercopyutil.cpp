@@ -0,0 +1,519 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_rollovercopyutil.cpp                                          -*-C++-*-
+#include <mqbs_rollovercopyutil.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbs_filesystemutil.h>
+
+// BMQ
+#include <bmqp_crc32c.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlb_bigendian.h>
+#include <bdlb_scopeexit.h>
+#include <bdlf_bind.h>
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bsl_cerrno.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsls_assert.h>
+
+// SYS
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("MQBS.ROLLOVERCOPYUTIL");
+
+// CONSTANTS
+const unsigned int k_MAGIC = 0x424D5152;  // 'BMQR'
+
+const unsigned int k_VERSION = 1;
+
+const int k_HEADER_SIZE = 20;
+// Magic, version, payload length and payload CRC32-C
+
+const int k_SLICE_SIZE = 24;
+// Offsets and length of a range
+
+// FUNCTIONS
+void putUint32(bsl::vector<char>* buffer, unsigned int value)
+{
+    const bdlb::BigEndianUint32 v = bdlb::BigEndianUint32::make(value);
+    const char*                 p = reinterpret_cast<const char*>(&v);
+    buffer->insert(buffer->end(), p, p + sizeof(v));
+}
+
+void putUint64(bsl::vector<char>* buffer, bsls::Types::Uint64 value)
+{
+    const bdlb::BigEndianUint64 v = bdlb::BigEndianUint64::make(value);
+    const char*                 p = reinterpret_cast<const char*>(&v);
+    buffer->insert(buffer->end(), p, p + sizeof(v));
+}
+
+unsigned int getUint32(const char* data)
+{
+    bdlb::BigEndianUint32 value;
+    bsl::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+bsls::Types::Uint64 getUint64(const char* data)
+{
+    bdlb::BigEndianUint64 value;
+    bsl::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/// Durably sync to disk the directory containing the file at the specified
+/// `path`, so that the creation or the removal of that file is durable.
+/// Return zero on success, and the `errno` of the failure otherwise.
+int syncDirectory(const bsl::string& path)
+{
+    bsl::string directory(path.get_allocator().mechanism());
+    if (0 != bdls::PathUtil::getDirname(&directory, path)) {
+        directory.assign(".");
+    }
+
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (-1 == fd) {
+        return errno;  // RETURN
+    }
+
+    int rc = 0;
+    if (0 != ::fsync(fd)) {
+        rc = errno;
+    }
+    ::close(fd);
+
+    return rc;
+}
+
+}  // close unnamed namespace
+
+// -------------------
+// struct RolloverCopy
+// -------------------
+
+// CREATORS
+RolloverCopy::RolloverCopy(bslma::Allocator* basicAllocator)
+: d_fromDataFileName(basicAllocator)
+, d_slices(basicAllocator)
+{
+    // NOTHING
+}
+
+RolloverCopy::RolloverCopy(const RolloverCopy& other,
+                           bslma::Allocator*   basicAllocator)
+: d_fromDataFileName(other.d_fromDataFileName, basicAllocator)
+, d_slices(other.d_slices, basicAllocator)
+{
+    // NOTHING
+}
+
+// -----------------------
+// struct RolloverCopyUtil
+// -----------------------
+
+// CLASS METHODS
+int RolloverCopyUtil::save(bsl::ostream&       errorDescription,
+                           const bsl::string&  path,
+                           const RolloverCopy& copy)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                = 0,
+        rc_OPEN_FAILURE           = -1,
+        rc_WRITE_FAILURE          = -2,
+        rc_SYNC_FAILURE           = -3,
+        rc_DIRECTORY_SYNC_FAILURE = -4
+    };
+
+    bsl::vector<char> buffer(copy.d_slices.get_allocator().mechanism());
+    buffer.reserve(k_HEADER_SIZE + 8 + copy.d_fromDataFileName.length() +
+                   k_SLICE_SIZE * copy.d_slices.size());
+    buffer.resize(k_HEADER_SIZE);
+
+    putUint32(&buffer,
+              static_cast<unsigned int>(copy.d_fromDataFileName.length()));
+    buffer.insert(buffer.end(),
+                  copy.d_fromDataFileName.begin(),
+                  copy.d_fromDataFileName.end());
+    putUint32(&buffer, static_cast<unsigned int>(copy.d_slices.size()));
+    for (RolloverCopy::Slices::const_iterator it = copy.d_slices.begin();
+         it != copy.d_slices.end();
+         ++it) {
+        putUint64(&buffer, it->d_fromOffset);
+        putUint64(&buffer, it->d_toOffset);
+        putUint64(&buffer, it->d_length);
+    }
+
+    // Now that the payload is known, populate the header.
+    const bsls::Types::Uint64 payloadLength = buffer.size() - k_HEADER_SIZE;
+    const unsigned int        crc32c        = bmqp::Crc32c::calculate(
+        buffer.data() + k_HEADER_SIZE,
+        static_cast<unsigned int>(payloadLength));
+
+    bsl::vector<char> header(buffer.get_allocator());
+    putUint32(&header, k_MAGIC);
+    putUint32(&header, k_VERSION);
+    putUint64(&header, payloadLength);
+    putUint32(&header, crc32c);
+    BSLS_ASSERT_SAFE(k_HEADER_SIZE == static_cast<int>(header.size()));
+    bsl::memcpy(buffer.data(), header.data(), k_HEADER_SIZE);
+
+    // Write the file.
+    const int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0660);
+    if (-1 == fd) {
+        errorDescription << "Failed to open rollover copy file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny closeGuard(bdlf::BindUtil::bind(&::close, fd));
+
+    const char* data      = buffer.data();
+    bsl::size_t remaining = buffer.size();
+    while (remaining) {
+        const ssize_t rc = ::write(fd, data, remaining);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;  // CONTINUE
+            }
+
+            errorDescription << "Failed to write rollover copy file ["
+                             << path << "], errno: " << errno << " ["
+                             << bsl::strerror(errno) << "].";
+            return rc_WRITE_FAILURE;  // RETURN
+        }
+
+        data += rc;
+        remaining -= rc;
+    }
+
+    if (0 != ::fdatasync(fd)) {
+        errorDescription << "Failed to sync rollover copy file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_SYNC_FAILURE;  // RETURN
+    }
+
+    // The file may have just been created: sync its directory entry too, or
+    // the file could be missing after a crash although its content is
+    // durable.
+
+    const int error = syncDirectory(path);
+    if (0 != error) {
+        errorDescription << "Failed to sync the directory of rollover copy "
+                         << "file [" << path << "], errno: " << error << " ["
+                         << bsl::strerror(error) << "].";
+        return rc_DIRECTORY_SYNC_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int RolloverCopyUtil::remove(bsl::ostream&      errorDescription,
+                             const bsl::string& path)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                = 0,
+        rc_REMOVE_FAILURE         = -1,
+        rc_DIRECTORY_SYNC_FAILURE = -2
+    };
+
+    if (0 != bdls::FilesystemUtil::remove(path)) {
+        errorDescription << "Failed to remove rollover copy file [" << path
+                         << "].";
+        return rc_REMOVE_FAILURE;  // RETURN
+    }
+
+    const int error = syncDirectory(path);
+    if (0 != error) {
+        errorDescription << "Failed to sync the directory of removed "
+                         << "rollover copy file [" << path << "], errno: "
+                         << error << " [" << bsl::strerror(error) << "].";
+        return rc_DIRECTORY_SYNC_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int RolloverCopyUtil::load(bsl::ostream&      errorDescription,
+                           RolloverCopy*      copy,
+                           const bsl::string& path)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(copy);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS         = 0,
+        rc_OPEN_FAILURE    = -1,
+        rc_READ_FAILURE    = -2,
+        rc_INVALID_HEADER  = -3,
+        rc_INVALID_VERSION = -4,
+        rc_INVALID_LENGTH  = -5,
+        rc_CRC32C_MISMATCH = -6,
+        rc_INVALID_PAYLOAD = -7
+    };
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (-1 == fd) {
+        errorDescription << "Failed to open rollover copy file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny closeGuard(bdlf::BindUtil::bind(&::close, fd));
+
+    struct stat st;
+    if (0 != ::fstat(fd, &st)) {
+        errorDescription << "Failed to stat rollover copy file [" << path
+                         << "], errno: " << errno << " ["
+                         << bsl::strerror(errno) << "].";
+        return rc_READ_FAILURE;  // RETURN
+    }
+
+    if (st.st_size < k_HEADER_SIZE) {
+        errorDescription << "Rollover copy file [" << path << "] is too "
+                         << "small: " << st.st_size << " bytes.";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    bsl::vector<char> buffer(static_cast<bsl::size_t>(st.st_size),
+                             copy->d_slices.get_allocator().mechanism());
+    char*             data      = buffer.data();
+    bsl::size_t       remaining = buffer.size();
+    while (remaining) {
+        const ssize_t rc = ::read(fd, data, remaining);
+        if (rc <= 0) {
+            if (rc < 0 && EINTR == errno) {
+                continue;  // CONTINUE
+            }
+
+            errorDescription << "Failed to read rollover copy file [" << path
+                             << "], errno: " << errno << " ["
+                             << bsl::strerror(errno) << "].";
+            return rc_READ_FAILURE;  // RETURN
+        }
+
+        data += rc;
+        remaining -= rc;
+    }
+
+    const unsigned int        magic         = getUint32(buffer.data());
+    const unsigned int        version       = getUint32(buffer.data() + 4);
+    const bsls::Types::Uint64 payloadLength = getUint64(buffer.data() + 8);
+    const unsigned int        crc32c        = getUint32(buffer.data() + 16);
+
+    if (k_MAGIC != magic) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "invalid magic: " << magic << ".";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    if (k_VERSION != version) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "unsupported version: " << version << ".";
+        return rc_INVALID_VERSION;  // RETURN
+    }
+
+    if (payloadLength != buffer.size() - k_HEADER_SIZE) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "invalid payload length: " << payloadLength
+                         << ", file size: " << buffer.size() << ".";
+        return rc_INVALID_LENGTH;  // RETURN
+    }
+
+    const char* payload = buffer.data() + k_HEADER_SIZE;
+    if (crc32c !=
+        bmqp::Crc32c::calculate(payload,
+                                static_cast<unsigned int>(payloadLength))) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "invalid CRC32-C.";
+        return rc_CRC32C_MISMATCH;  // RETURN
+    }
+
+    // Decode the payload, checking each length against the number of bytes
+    // left.
+
+    const char* cursor = payload;
+    const char* end    = payload + payloadLength;
+
+    if (end - cursor < 4) {
+        errorDescription << "Rollover copy file [" << path << "] is "
+                         << "truncated.";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+    const unsigned int nameLength = getUint32(cursor);
+    cursor += 4;
+
+    if (static_cast<bsl::size_t>(end - cursor) < nameLength + 4) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "invalid file name length: " << nameLength << ".";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+    copy->d_fromDataFileName.assign(cursor, nameLength);
+    cursor += nameLength;
+
+    const unsigned int numSlices = getUint32(cursor);
+    cursor += 4;
+
+    if (static_cast<bsl::size_t>(end - cursor) !=
+        static_cast<bsl::size_t>(numSlices) * k_SLICE_SIZE) {
+        errorDescription << "Rollover copy file [" << path << "] has an "
+                         << "invalid number of ranges: " << numSlices << ".";
+        return rc_INVALID_PAYLOAD;  // RETURN
+    }
+
+    copy->d_slices.resize(numSlices);
+    for (unsigned int i = 0; i < numSlices; ++i) {
+        RolloverCopy::Slice& slice = copy->d_slices[i];
+        slice.d_fromOffset         = getUint64(cursor);
+        slice.d_toOffset           = getUint64(cursor + 8);
+        slice.d_length             = getUint64(cursor + 16);
+        cursor += k_SLICE_SIZE;
+    }
+
+    return rc_SUCCESS;
+}
+
+int RolloverCopyUtil::complete(bsl::ostream&         errorDescription,
+                               MappedFileDescriptor* toDataFd,
+                               const bsl::string&    path,
+                               bslma::Allocator*     basicAllocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(toDataFd);
+    BSLS_ASSERT_SAFE(toDataFd->isValid());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS           = 0,
+        rc_LOAD_FAILURE      = -1,
+        rc_OPEN_FAILURE      = -2,
+        rc_INVALID_RANGE     = -3,
+        rc_WRITEBACK_FAILURE = -4,
+        rc_REMOVE_FAILURE    = -5
+    };
+
+    if (!bdls::FilesystemUtil::exists(path)) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    RolloverCopy copy(basicAllocator);
+    int          rc = load(errorDescription, &copy, path);
+    if (0 != rc) {
+        return 10 * rc + rc_LOAD_FAILURE;  // RETURN
+    }
+
+    if (!bdls::FilesystemUtil::exists(copy.d_fromDataFileName)) {
+        // The previous file set is only released once the copy is complete,
+        // hence the file was left behind by a copy which completed, but
+        // failed to remove it.
+
+        BALL_LOG_WARN << "Ignoring rollover copy file [" << path << "], as "
+                      << "data file [" << copy.d_fromDataFileName
+                      << "] to copy from is gone.";
+
+        rc = remove(errorDescription, path);
+        if (0 != rc) {
+            return 10 * rc + rc_REMOVE_FAILURE;  // RETURN
+        }
+
+        return rc_SUCCESS;  // RETURN
+    }
+
+    const bsls::Types::Int64 fromFileSize = bdls::FilesystemUtil::getFileSize(
+        copy.d_fromDataFileName);
+
+    MappedFileDescriptor fromDataFd;
+    rc = FileSystemUtil::open(&fromDataFd,
+                              copy.d_fromDataFileName.c_str(),
+                              fromFileSize,
+                              true,  // readOnly
+                              errorDescription);
+    if (0 != rc) {
+        return 10 * rc + rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny closeGuard(
+        bdlf::BindUtil::bind(&FileSystemUtil::close, &fromDataFd));
+
+    bsls::Types::Uint64 copied = 0;
+    for (RolloverCopy::Slices::const_iterator it = copy.d_slices.begin();
+         it != copy.d_slices.end();
+         ++it) {
+        if (it->d_fromOffset + it->d_length >
+                static_cast<bsls::Types::Uint64>(fromFileSize) ||
+            it->d_toOffset + it->d_length > toDataFd->fileSize()) {
+            errorDescription << "Rollover copy file [" << path << "] has an "
+                             << "out of bounds range [from: "
+                             << it->d_fromOffset << ", to: " << it->d_toOffset
+                             << ", length: " << it->d_length << "].";
+            return rc_INVALID_RANGE;  // RETURN
+        }
+
+        bsl::memcpy(toDataFd->block().base() + it->d_toOffset,
+                    fromDataFd.block().base() + it->d_fromOffset,
+                    it->d_length);
+        copied += it->d_length;
+    }
+
+    if (!copy.d_slices.empty()) {
+        const RolloverCopy::Slice& first = copy.d_slices.front();
+        const RolloverCopy::Slice& last  = copy.d_slices.back();
+        rc = FileSystemUtil::writeback(*toDataFd,
+                                       first.d_toOffset,
+                                       last.d_toOffset + last.d_length -
+                                           first.d_toOffset,
+                                       true,  // waitForDurability
+                                       errorDescription);
+        if (0 != rc) {
+            return 10 * rc + rc_WRITEBACK_FAILURE;  // RETURN
+        }
+    }
+
+    // The copy is durable: the previous file set is not needed anymore.
+
+    rc = remove(errorDescription, path);
+    if (0 != rc) {
+        return 10 * rc + rc_REMOVE_FAILURE;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Completed the copy of " << copied << " bytes of rolled "
+                  << "over payloads from [" << copy.d_fromDataFileName
+                  << "], as per [" << path << "].";
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,180 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_rollovercopyutil.h                                            -*-C++-*-
+#ifndef INCLUDED_MQBS_ROLLOVERCOPYUTIL
+#define INCLUDED_MQBS_ROLLOVERCOPYUTIL
+
+//@PURPOSE: Provide utilities to persist and resume a rollover copy.
+//
+//@CLASSES:
+//  mqbs::RolloverCopy:     Payload ranges carried over by a rollover
+//  mqbs::RolloverCopyUtil: Utilities to save, load and complete a copy
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: When a 'mqbs::FileStore' rolls over with many outstanding
+// payloads, it only reserves their space in the DATA file of the new file
+// set and copies them from the DATA file of the previous file set in the
+// background, while new records are already written to the new file set.
+// 'mqbs::RolloverCopy' describes such a copy: the DATA file it copies from,
+// and the ranges to copy.  'mqbs::RolloverCopyUtil' provides routines to save
+// a 'mqbs::RolloverCopy' to a file alongside the new file set before it
+// accepts any record, and to complete the copy described by such a file at
+// recovery, should the broker stop before the copy is done.  The file is
+// removed once the copy is durable.  The directory containing the file is
+// synced after the file is created and after it is removed, so that a crash
+// can neither lose a saved file nor resurrect a removed one.
+//
+/// File Format
+///-----------
+// All integers are in network byte order.  The file starts with a fixed size
+// header:
+//..
+//  +---------------+---------------+---------------+---------------+
+//  |                             Magic                             |
+//  +---------------+---------------+---------------+---------------+
+//  |                            Version                            |
+//  +---------------+---------------+---------------+---------------+
+//  |                      Payload Length (upper)                   |
+//  +---------------+---------------+---------------+---------------+
+//  |                      Payload Length (lower)                   |
+//  +---------------+---------------+---------------+---------------+
+//  |                        Payload CRC32-C                        |
+//  +---------------+---------------+---------------+---------------+
+//..
+// followed by the payload, which contains the name of the DATA file to copy
+// from, then the ranges, prefixed by their number.  A file which is
+// truncated, whose payload CRC32-C does not match, or which has an unknown
+// version is rejected by 'load'.
+
+// MQB
+#include <mqbs_mappedfiledescriptor.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ===================
+// struct RolloverCopy
+// ===================
+
+/// Payload ranges carried over by a rollover, to be copied from the DATA
+/// file of the previous file set to the DATA file of the new one.
+struct RolloverCopy {
+    // TYPES
+
+    /// Range of payloads to copy.
+    struct Slice {
+        // DATA
+        bsls::Types::Uint64 d_fromOffset;
+        // Offset of the range in the DATA file of the previous file set.
+
+        bsls::Types::Uint64 d_toOffset;
+        // Offset of the range in the DATA file of the new file set.
+
+        bsls::Types::Uint64 d_length;
+        // Length of the range, in bytes.
+    };
+
+    typedef bsl::vector<Slice> Slices;
+
+    // DATA
+    bsl::string d_fromDataFileName;
+    // Name of the DATA file of the previous file set.
+
+    Slices d_slices;
+    // Ranges to copy, sorted by offset in the DATA file of the new file
+    // set.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RolloverCopy, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `RolloverCopy` object, using the specified
+    /// `basicAllocator` to supply memory.
+    explicit RolloverCopy(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a `RolloverCopy` object having the same value as the
+    /// specified `other`, using the specified `basicAllocator` to supply
+    /// memory.
+    RolloverCopy(const RolloverCopy& other,
+                 bslma::Allocator*   basicAllocator = 0);
+};
+
+// =======================
+// struct RolloverCopyUtil
+// =======================
+
+/// This component provides utilities to save, load and complete a
+/// `RolloverCopy`.
+struct RolloverCopyUtil {
+    // CLASS METHODS
+
+    /// Write the specified `copy` to the file at the specified `path`,
+    /// truncating it if it exists, and durably sync it, as well as its
+    /// directory entry, to disk.  Return zero on success, non-zero value
+    /// otherwise and populate the specified `errorDescription` with
+    /// details.  Note that the file is left in a state rejected by `load`
+    /// if this method fails or is interrupted.
+    static int save(bsl::ostream&       errorDescription,
+                    const bsl::string&  path,
+                    const RolloverCopy& copy);
+
+    /// Remove the file at the specified `path`, and durably sync the
+    /// removal to disk by syncing the directory containing it.  Return
+    /// zero on success, non-zero value otherwise and populate the specified
+    /// `errorDescription` with details.
+    static int remove(bsl::ostream& errorDescription, const bsl::string& path);
+
+    /// Load into the specified `copy` the content of the file at the
+    /// specified `path`.  Return zero on success, non-zero value if the
+    /// file cannot be read, is corrupted or has an unsupported version and
+    /// populate the specified `errorDescription` with details.  Behavior is
+    /// undefined unless `copy` is non-null.
+    static int load(bsl::ostream&      errorDescription,
+                    RolloverCopy*      copy,
+                    const bsl::string& path);
+
+    /// If there is a file at the specified `path`, copy the ranges it
+    /// describes into the DATA file mapped by the specified `toDataFd`,
+    /// durably sync them to disk and remove the file.  If the DATA file to
+    /// copy from does not exist anymore, the copy is deemed complete and
+    /// the file is only removed.  Return zero on success or if there is no
+    /// file at `path`, non-zero value otherwise and populate the specified
+    /// `errorDescription` with details.  Use the optionally specified
+    /// `basicAllocator` to supply memory.  Behavior is undefined unless
+    /// `toDataFd` is a valid, writable mapping.  Note that this method may
+    /// be called again, with the same result, if it fails or is
+    /// interrupted.
+    static int complete(bsl::ostream&         errorDescription,
+                        MappedFileDescriptor* toDataFd,
+                        const bsl::string&    path,
+                        bslma::Allocator*     basicAllocator = 0);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
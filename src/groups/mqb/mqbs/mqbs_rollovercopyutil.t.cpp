@@ -0,0 +1,396 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_rollovercopyutil.t.cpp                                        -*-C++-*-
+#include <mqbs_rollovercopyutil.h>
+
+// MQB
+#include <mqbs_filesystemutil.h>
+#include <mqbs_mappedfiledescriptor.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+#include <mwcu_tempdirectory.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_timeutil.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+// CONSTANTS
+const int k_FILE_SIZE = 8192;
+
+/// Populate the specified `copy` with a few ranges to copy from the file at
+/// the specified `fromDataFileName`.
+void populateCopy(mqbs::RolloverCopy*  copy,
+                  const bsl::string& fromDataFileName)
+{
+    copy->d_fromDataFileName = fromDataFileName;
+
+    const mqbs::RolloverCopy::Slice slices[] = {{64, 32, 100},
+                                                {1000, 132, 8},
+                                                {4096, 512, 2048}};
+    copy->d_slices.assign(slices, slices + 3);
+}
+
+/// Return the path of the file having the specified `leaf` name in the
+/// specified `directory`.
+bsl::string filePath(const mwcu::TempDirectory& directory, const char* leaf)
+{
+    bsl::string path(directory.path(), s_allocator_p);
+    bdls::PathUtil::appendRaw(&path, leaf);
+    return path;
+}
+
+/// Read the content of the file at the specified `path` into the specified
+/// `content`.
+void readFile(bsl::vector<char>* content, const bsl::string& path)
+{
+    bsl::ifstream file(path.c_str(), bsl::ios::binary);
+    content->assign(bsl::istreambuf_iterator<char>(file),
+                    bsl::istreambuf_iterator<char>());
+}
+
+/// Write the specified `content` to the file at the specified `path`.
+void writeFile(const bsl::string& path, const bsl::vector<char>& content)
+{
+    bsl::ofstream file(path.c_str(), bsl::ios::binary | bsl::ios::trunc);
+    file.write(content.data(), content.size());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   A rollover copy saved to a file is loaded back with the same value.
+//
+// Testing:
+//   static int save(...);
+//   static int load(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    const bsl::string   path = filePath(tempDir, "bmq_0.copy");
+
+    mqbs::RolloverCopy copy(s_allocator_p);
+    populateCopy(&copy, filePath(tempDir, "bmq_0.bmq_data"));
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::save(errorDesc, path, copy));
+
+    mqbs::RolloverCopy loaded(s_allocator_p);
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+
+    ASSERT_EQ(copy.d_fromDataFileName, loaded.d_fromDataFileName);
+    ASSERT_EQ(copy.d_slices.size(), loaded.d_slices.size());
+    for (size_t i = 0; i < copy.d_slices.size(); ++i) {
+        ASSERT_EQ_D(i,
+                    copy.d_slices[i].d_fromOffset,
+                    loaded.d_slices[i].d_fromOffset);
+        ASSERT_EQ_D(i,
+                    copy.d_slices[i].d_toOffset,
+                    loaded.d_slices[i].d_toOffset);
+        ASSERT_EQ_D(i, copy.d_slices[i].d_length, loaded.d_slices[i].d_length);
+    }
+}
+
+static void test2_corruptedCopy()
+// ------------------------------------------------------------------------
+// CORRUPTED COPY
+//
+// Concerns:
+//   A missing, truncated or corrupted rollover copy file is rejected by
+//   'load'.
+//
+// Testing:
+//   static int load(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CORRUPTED COPY");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    const bsl::string   path = filePath(tempDir, "bmq_0.copy");
+
+    mqbs::RolloverCopy copy(s_allocator_p);
+    populateCopy(&copy, filePath(tempDir, "bmq_0.bmq_data"));
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::save(errorDesc, path, copy));
+
+    bsl::vector<char> content(s_allocator_p);
+    readFile(&content, path);
+
+    {
+        PV("Missing file");
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_NE(0,
+                  mqbs::RolloverCopyUtil::load(errorDesc,
+                                               &loaded,
+                                               path + ".missing"));
+    }
+
+    {
+        PV("Truncated file");
+        writeFile(path,
+                  bsl::vector<char>(content.begin(),
+                                    content.end() - 1,
+                                    s_allocator_p));
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_NE(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+    }
+
+    {
+        PV("Invalid magic");
+        bsl::vector<char> corrupted(content, s_allocator_p);
+        corrupted[0] ^= 0xFF;
+        writeFile(path, corrupted);
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_NE(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+    }
+
+    {
+        PV("Unsupported version");
+        bsl::vector<char> corrupted(content, s_allocator_p);
+        corrupted[7] ^= 0xFF;
+        writeFile(path, corrupted);
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_NE(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+    }
+
+    {
+        PV("Corrupted payload");
+        bsl::vector<char> corrupted(content, s_allocator_p);
+        corrupted.back() ^= 0xFF;
+        writeFile(path, corrupted);
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_NE(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+    }
+
+    {
+        PV("Intact file");
+        writeFile(path, content);
+        mqbs::RolloverCopy loaded(s_allocator_p);
+        ASSERT_EQ(0, mqbs::RolloverCopyUtil::load(errorDesc, &loaded, path));
+    }
+}
+
+static void test3_complete()
+// ------------------------------------------------------------------------
+// COMPLETE
+//
+// Concerns:
+//   - Recovering a file set whose rollover copy was interrupted (the
+//     broker stopped with the rollover copy file still present) copies the
+//     recorded ranges from the previous DATA file, and removes the file.
+//   - Completing again, once the file is gone, is a no-op.
+//   - A file whose previous DATA file is gone is removed, the copy having
+//     completed before.
+//   - A file with out of bounds ranges is rejected and kept.
+//
+// Testing:
+//   static int complete(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPLETE");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    const bsl::string   fromPath = filePath(tempDir, "bmq_0.1.bmq_data");
+    const bsl::string   toPath   = filePath(tempDir, "bmq_0.2.bmq_data");
+    const bsl::string   copyPath = filePath(tempDir, "bmq_0.2.bmq_copy");
+
+    // The previous DATA file, and the DATA file of the new file set, in
+    // which the ranges to copy are still zeroed when the broker stops.
+
+    bsl::vector<char> fromContent(k_FILE_SIZE, 0, s_allocator_p);
+    for (int i = 0; i < k_FILE_SIZE; ++i) {
+        fromContent[i] = static_cast<char>(i % 251 + 1);
+    }
+    writeFile(fromPath, fromContent);
+    writeFile(toPath, bsl::vector<char>(k_FILE_SIZE, 0, s_allocator_p));
+
+    mqbs::RolloverCopy copy(s_allocator_p);
+    populateCopy(&copy, fromPath);
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::save(errorDesc, copyPath, copy));
+
+    // Recovery maps the DATA file of the new file set, and completes the
+    // copy.
+
+    mqbs::MappedFileDescriptor toDataFd;
+    ASSERT_EQ(0,
+              mqbs::FileSystemUtil::open(&toDataFd,
+                                         toPath.c_str(),
+                                         k_FILE_SIZE,
+                                         false,  // readOnly
+                                         errorDesc));
+
+    ASSERT_EQ(0,
+              mqbs::RolloverCopyUtil::complete(errorDesc,
+                                               &toDataFd,
+                                               copyPath,
+                                               s_allocator_p));
+    ASSERT_EQ(false, bdls::FilesystemUtil::exists(copyPath));
+
+    for (size_t i = 0; i < copy.d_slices.size(); ++i) {
+        const mqbs::RolloverCopy::Slice& slice = copy.d_slices[i];
+        ASSERT_EQ_D(i,
+                    0,
+                    bsl::memcmp(toDataFd.block().base() + slice.d_toOffset,
+                                fromContent.data() + slice.d_fromOffset,
+                                slice.d_length));
+    }
+
+    // Bytes outside of the ranges are left untouched.
+    ASSERT_EQ(0, toDataFd.block().base()[0]);
+    ASSERT_EQ(0, toDataFd.block().base()[k_FILE_SIZE - 1]);
+
+    mqbs::FileSystemUtil::close(&toDataFd);
+
+    bsl::vector<char> toContent(s_allocator_p);
+    readFile(&toContent, toPath);
+    const mqbs::RolloverCopy::Slice& lastSlice = copy.d_slices.back();
+    ASSERT_EQ(0,
+              bsl::memcmp(toContent.data() + lastSlice.d_toOffset,
+                          fromContent.data() + lastSlice.d_fromOffset,
+                          lastSlice.d_length));
+
+    ASSERT_EQ(0,
+              mqbs::FileSystemUtil::open(&toDataFd,
+                                         toPath.c_str(),
+                                         k_FILE_SIZE,
+                                         false,  // readOnly
+                                         errorDesc));
+
+    PV("No rollover copy file");
+    ASSERT_EQ(0,
+              mqbs::RolloverCopyUtil::complete(errorDesc,
+                                               &toDataFd,
+                                               copyPath,
+                                               s_allocator_p));
+
+    PV("Out of bounds range");
+    {
+        mqbs::RolloverCopy invalid(copy, s_allocator_p);
+        invalid.d_slices.back().d_length = k_FILE_SIZE;
+        ASSERT_EQ(0,
+                  mqbs::RolloverCopyUtil::save(errorDesc, copyPath, invalid));
+
+        ASSERT_NE(0,
+                  mqbs::RolloverCopyUtil::complete(errorDesc,
+                                                   &toDataFd,
+                                                   copyPath,
+                                                   s_allocator_p));
+        ASSERT_EQ(true, bdls::FilesystemUtil::exists(copyPath));
+    }
+
+    PV("Previous DATA file gone");
+    {
+        ASSERT_EQ(0, mqbs::RolloverCopyUtil::save(errorDesc, copyPath, copy));
+        ASSERT_EQ(0, bdls::FilesystemUtil::remove(fromPath));
+
+        ASSERT_EQ(0,
+                  mqbs::RolloverCopyUtil::complete(errorDesc,
+                                                   &toDataFd,
+                                                   copyPath,
+                                                   s_allocator_p));
+        ASSERT_EQ(false, bdls::FilesystemUtil::exists(copyPath));
+    }
+
+    mqbs::FileSystemUtil::close(&toDataFd);
+}
+
+static void test4_remove()
+// ------------------------------------------------------------------------
+// REMOVE
+//
+// Concerns:
+//   1. 'remove' removes a saved rollover copy file.
+//   2. 'remove' fails if there is no file to remove.
+//
+// Testing:
+//   static int remove(...);
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REMOVE");
+
+    mwcu::TempDirectory tempDir(s_allocator_p);
+    const bsl::string   path = filePath(tempDir, "bmq_0.copy");
+
+    mqbs::RolloverCopy copy(s_allocator_p);
+    populateCopy(&copy, filePath(tempDir, "bmq_0.bmq_data"));
+
+    mwcu::MemOutStream errorDesc(s_allocator_p);
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::save(errorDesc, path, copy));
+    ASSERT(bdls::FilesystemUtil::exists(path));
+
+    ASSERT_EQ(0, mqbs::RolloverCopyUtil::remove(errorDesc, path));
+    ASSERT(!bdls::FilesystemUtil::exists(path));
+
+    ASSERT_NE(0, mqbs::RolloverCopyUtil::remove(errorDesc, path));
+    PV(errorDesc.str());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    // One time app initialization.
+    bsls::TimeUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_remove(); break;
+    case 3: test3_complete(); break;
+    case 2: test2_corruptedCopy(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_ALLOC);
+}
@@ -39,18 +39,45 @@ VirtualStorage::VirtualStorage(mqbi::Storage*          storage,
 , d_storage_p(storage)
 , d_appId(appId, allocator)
 , d_appKey(appKey)
-, d_guids(allocator)
-, d_totalBytes(0)
+, d_log_sp()
+, d_ordinal(-1)
 {
     BSLS_ASSERT_SAFE(d_storage_p);
     BSLS_ASSERT_SAFE(allocator);
     BSLS_ASSERT_SAFE(!appId.empty());
     BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    d_log_sp.createInplace(allocator, allocator);
+    d_ordinal = d_log_sp->addApp();
+}
+
+VirtualStorage::VirtualStorage(
+    mqbi::Storage*                            storage,
+    const bsl::string&                        appId,
+    const mqbu::StorageKey&                   appKey,
+    const bsl::shared_ptr<VirtualStorageLog>& log,
+    bslma::Allocator*                         allocator)
+: d_allocator_p(allocator)
+, d_storage_p(storage)
+, d_appId(appId, allocator)
+, d_appKey(appKey)
+, d_log_sp(log)
+, d_ordinal(-1)
+{
+    BSLS_ASSERT_SAFE(d_storage_p);
+    BSLS_ASSERT_SAFE(d_log_sp);
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(!appId.empty());
+    BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    d_ordinal = d_log_sp->addApp();
 }
 
 VirtualStorage::~VirtualStorage()
 {
-    // NOTHING
+    // Release the messages of this storage which are not referenced by
+    // other virtual storages sharing the log.
+    d_log_sp->removeApp(d_ordinal);
 }
 
 // MANIPULATORS
@@ -110,18 +137,7 @@ mqbi::StorageResult::Enum VirtualStorage::put(const bmqt::MessageGUID& msgGUID,
                                               const bmqp::RdaInfo&     rdaInfo,
                                               unsigned int subScriptionId)
 {
-    if (d_guids
-            .insert(bsl::make_pair(
-                msgGUID,
-                MessageContext(msgSize, rdaInfo, subScriptionId)))
-            .second == false) {
-        // Duplicate GUID
-        return mqbi::StorageResult::e_GUID_NOT_UNIQUE;  // RETURN
-    }
-
-    // Success: new GUID
-    d_totalBytes += msgSize;
-    return mqbi::StorageResult::e_SUCCESS;
+    return d_log_sp->put(msgGUID, msgSize, rdaInfo, subScriptionId, d_ordinal);
 }
 
 mqbi::StorageResult::Enum VirtualStorage::put(
@@ -142,7 +158,8 @@ VirtualStorage::getIterator(const mqbu::StorageKey& appKey)
     static_cast<void>(appKey);
 
     bslma::ManagedPtr<mqbi::StorageIterator> mp(
-        new (*d_allocator_p) VirtualStorageIterator(this, d_guids.begin()),
+        new (*d_allocator_p)
+            VirtualStorageIterator(this, d_log_sp->begin(d_ordinal)),
         d_allocator_p);
 
     return mp;
@@ -157,8 +174,8 @@ VirtualStorage::getIterator(bslma::ManagedPtr<mqbi::StorageIterator>* out,
     BSLS_ASSERT_SAFE(d_appKey == appKey);
     static_cast<void>(appKey);
 
-    GuidListIter it = d_guids.find(msgGUID);
-    if (it == d_guids.end()) {
+    VirtualStorageLog::ConstIterator it = d_log_sp->find(msgGUID, d_ordinal);
+    if (it == d_log_sp->end()) {
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
@@ -184,24 +201,13 @@ VirtualStorage::remove(const bmqt::MessageGUID&    msgGUID,
                        BSLS_ANNOTATION_UNUSED bool clearAll)
 
 {
-    GuidList::const_iterator it = d_guids.find(msgGUID);
-    if (it == d_guids.end()) {
-        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
-    }
-
-    if (msgSize) {
-        *msgSize = it->second.d_size;
-    }
-    d_totalBytes -= it->second.d_size;
-    d_guids.erase(it);
-    return mqbi::StorageResult::e_SUCCESS;
+    return d_log_sp->remove(msgGUID, d_ordinal, msgSize);
 }
 
 mqbi::StorageResult::Enum VirtualStorage::removeAll(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey)
 {
-    d_guids.clear();
-    d_totalBytes = 0;
+    d_log_sp->removeAll(d_ordinal);
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -215,8 +221,8 @@ mqbi::StorageResult::Enum
 VirtualStorage::getMessageSize(int*                     msgSize,
                                const bmqt::MessageGUID& msgGUID) const
 {
-    GuidList::const_iterator cit = d_guids.find(msgGUID);
-    if (cit == d_guids.end()) {
+    VirtualStorageLog::ConstIterator cit = d_log_sp->find(msgGUID, d_ordinal);
+    if (cit == d_log_sp->end()) {
         return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
     }
 
@@ -323,8 +329,8 @@ bool VirtualStorageIterator::loadMessageAndAttributes() const
 
 // CREATORS
 VirtualStorageIterator::VirtualStorageIterator(
-    VirtualStorage*                                 storage,
-    const VirtualStorage::GuidList::const_iterator& initialPosition)
+    VirtualStorage*                         storage,
+    const VirtualStorageLog::ConstIterator& initialPosition)
 : d_virtualStorage_p(storage)
 , d_iterator(initialPosition)
 , d_attributes()
@@ -347,7 +353,8 @@ bool VirtualStorageIterator::advance()
     BSLS_ASSERT_SAFE(!atEnd());
 
     clear();
-    ++d_iterator;
+    d_virtualStorage_p->d_log_sp->next(&d_iterator,
+                                       d_virtualStorage_p->d_ordinal);
     return !atEnd();
 }
 
@@ -356,7 +363,8 @@ void VirtualStorageIterator::reset()
     clear();
 
     // Reset iterator to beginning
-    d_iterator = d_virtualStorage_p->d_guids.begin();
+    d_iterator = d_virtualStorage_p->d_log_sp->begin(
+        d_virtualStorage_p->d_ordinal);
 }
 
 // ACCESSORS
@@ -373,7 +381,9 @@ bmqp::RdaInfo& VirtualStorageIterator::rdaInfo() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_iterator->second.d_rdaInfo;
+    return d_virtualStorage_p->d_log_sp->rdaInfo(
+        d_iterator,
+        d_virtualStorage_p->d_ordinal);
 }
 
 unsigned int VirtualStorageIterator::subscriptionId() const
@@ -381,7 +391,9 @@ unsigned int VirtualStorageIterator::subscriptionId() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
-    return d_iterator->second.d_subscriptionId;
+    return d_virtualStorage_p->d_log_sp->subscriptionId(
+        d_iterator,
+        d_virtualStorage_p->d_ordinal);
 }
 
 const bsl::shared_ptr<bdlbb::Blob>& VirtualStorageIterator::appData() const
@@ -405,7 +417,7 @@ VirtualStorageIterator::attributes() const
 
 bool VirtualStorageIterator::atEnd() const
 {
-    return (d_iterator == d_virtualStorage_p->d_guids.end());
+    return (d_iterator == d_virtualStorage_p->d_log_sp->end());
 }
 
 bool VirtualStorageIterator::hasReceipt() const
@@ -24,7 +24,11 @@
 //  storage.
 //
 //@DESCRIPTION: 'mqbs::VirtualStorage' provides a mechanism to add per-client
-// state to an underlying BlazingMQ storage.
+// state to an underlying BlazingMQ storage.  The messages of a virtual storage
+// and their per-client state are kept in a 'mqbs::VirtualStorageLog', which
+// can be shared by all the virtual storages of a queue (see
+// 'mqbs::VirtualStorageCatalog') so that a message referenced by several
+// clients is stored once.
 //
 /// Warning
 ///-------
@@ -39,14 +43,12 @@
 #include <mqbi_storage.h>
 #include <mqbs_datastore.h>
 #include <mqbs_filestoreprotocol.h>
+#include <mqbs_virtualstoragelog.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
 #include <bmqt_messageguid.h>
 
-// MWC
-#include <mwcc_orderedhashmap.h>
-
 // BDE
 #include <bdlbb_blob.h>
 #include <bsl_memory.h>
@@ -76,26 +78,6 @@ class VirtualStorage : public mqbi::Storage {
     friend class VirtualStorageIterator;
 
     // PRIVATE TYPES
-    struct MessageContext {
-        int                   d_size;
-        mutable bmqp::RdaInfo d_rdaInfo;
-        unsigned int          d_subscriptionId;
-
-        MessageContext(int                  size,
-                       const bmqp::RdaInfo& rdaInfo,
-                       unsigned int         subScriptionId);
-    };
-
-    /// msgGUID -> MessageContext
-    /// Must be a container in which iteration order is same as insertion
-    /// order.
-    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
-                                 MessageContext,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
-        GuidList;
-
-    typedef GuidList::iterator GuidListIter;
-
     typedef mqbi::Storage::StorageKeys StorageKeys;
 
   private:
@@ -112,12 +94,13 @@ class VirtualStorage : public mqbi::Storage {
     mqbu::StorageKey d_appKey;
     // Storage key of the associated 'appId'.
 
-    GuidList d_guids;
-    // List of guids that are part of this storage.
+    bsl::shared_ptr<VirtualStorageLog> d_log_sp;
+    // Log of the messages that are part of this
+    // storage, possibly shared with other virtual
+    // storages.
 
-    bsls::Types::Int64 d_totalBytes;
-    // Total size (in bytes) of all the messages that
-    // it holds.
+    int d_ordinal;
+    // Ordinal of this storage in 'd_log_sp'.
 
   private:
     // NOT IMPLEMENTED
@@ -141,6 +124,18 @@ class VirtualStorage : public mqbi::Storage {
                    const mqbu::StorageKey& appKey,
                    bslma::Allocator*       allocator);
 
+    /// Create an instance of virtual storage backed by the specified real
+    /// `storage`, and having the specified `appId` and `appKey`, keeping
+    /// its messages in the specified `log` shared with other virtual
+    /// storages of `storage`, and use the specified `allocator` for any
+    /// memory allocations.  Behavior is undefined unless `storage` and
+    /// `log` are non-null, `appId` is non-empty and `appKey` is non-null.
+    VirtualStorage(mqbi::Storage*                            storage,
+                   const bsl::string&                        appId,
+                   const mqbu::StorageKey&                   appKey,
+                   const bsl::shared_ptr<VirtualStorageLog>& log,
+                   bslma::Allocator*                         allocator);
+
     /// Destructor.
     ~VirtualStorage() BSLS_KEYWORD_OVERRIDE;
 
@@ -380,7 +375,7 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     // DATA
     VirtualStorage* d_virtualStorage_p;
 
-    VirtualStorage::GuidList::const_iterator d_iterator;
+    VirtualStorageLog::ConstIterator d_iterator;
 
     mutable mqbi::StorageMessageAttributes d_attributes;
 
@@ -425,8 +420,8 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     /// Create a new VirtualStorageIterator from the specified `storage` and
     /// pointing at the specified `initialPosition`.
     VirtualStorageIterator(
-        VirtualStorage*                                 storage,
-        const VirtualStorage::GuidList::const_iterator& initialPosition);
+        VirtualStorage*                         storage,
+        const VirtualStorageLog::ConstIterator& initialPosition);
 
     /// Destructor
     ~VirtualStorageIterator() BSLS_KEYWORD_OVERRIDE;
@@ -444,7 +439,8 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
 
     /// Return a reference offering modifiable access to the RdaInfo
     /// associated to the item currently pointed at by this iterator.  The
-    /// behavior is undefined unless `atEnd` returns `false`.
+    /// reference stays valid until the message is removed from this virtual
+    /// storage.  The behavior is undefined unless `atEnd` returns `false`.
     bmqp::RdaInfo& rdaInfo() const BSLS_KEYWORD_OVERRIDE;
 
     /// Return subscription id associated to the item currently pointed at
@@ -482,21 +478,6 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
 //                             INLINE DEFINITIONS
 // ============================================================================
 
-// ------------------------------------
-// class VirtualStorage::MessageContext
-// ------------------------------------
-
-inline VirtualStorage::MessageContext::MessageContext(
-    int                  size,
-    const bmqp::RdaInfo& rdaInfo,
-    unsigned int         subScriptionId)
-: d_size(size)
-, d_rdaInfo(rdaInfo)
-, d_subscriptionId(subScriptionId)
-{
-    // NOTHING
-}
-
 // --------------------
 // class VirtualStorage
 // --------------------
@@ -546,13 +527,13 @@ inline mqbu::CapacityMeter* VirtualStorage::capacityMeter()
 inline bsls::Types::Int64 VirtualStorage::numMessages(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey) const
 {
-    return d_guids.size();
+    return d_log_sp->numMessages(d_ordinal);
 }
 
 inline bsls::Types::Int64 VirtualStorage::numBytes(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey) const
 {
-    return d_totalBytes;
+    return d_log_sp->numBytes(d_ordinal);
 }
 
 inline bool VirtualStorage::isEmpty() const
@@ -568,7 +549,7 @@ inline bool VirtualStorage::isEmpty() const
 
 inline bool VirtualStorage::hasMessage(const bmqt::MessageGUID& msgGUID) const
 {
-    return 1 == d_guids.count(msgGUID);
+    return d_log_sp->hasMessage(msgGUID, d_ordinal);
 }
 
 }  // close package namespace
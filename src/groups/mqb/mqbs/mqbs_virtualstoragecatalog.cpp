@@ -38,12 +38,15 @@ namespace mqbs {
 VirtualStorageCatalog::VirtualStorageCatalog(mqbi::Storage*    storage,
                                              bslma::Allocator* allocator)
 : d_storage_p(storage)
+, d_log_sp()
 , d_virtualStorages(allocator)
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(storage);
     BSLS_ASSERT_SAFE(allocator);
+
+    d_log_sp.createInplace(allocator, allocator);
 }
 
 VirtualStorageCatalog::~VirtualStorageCatalog()
@@ -70,13 +73,8 @@ VirtualStorageCatalog::put(const bmqt::MessageGUID& msgGUID,
                                subScriptionId);  // RETURN
     }
 
-    // Add guid to all virtual storages.
-
-    for (VirtualStoragesIter it = d_virtualStorages.begin();
-         it != d_virtualStorages.end();
-         ++it) {
-        it->second->put(msgGUID, msgSize, rdaInfo, subScriptionId);
-    }
+    // Add guid to all virtual storages at once.
+    d_log_sp->putForAllApps(msgGUID, msgSize, rdaInfo, subScriptionId);
 
     return mqbi::StorageResult::e_SUCCESS;  // RETURN
 }
@@ -115,12 +113,8 @@ VirtualStorageCatalog::remove(const bmqt::MessageGUID& msgGUID,
         return it->second->remove(msgGUID);  // RETURN
     }
 
-    // Remove guid from all virtual storages.
-    for (VirtualStoragesIter it = d_virtualStorages.begin();
-         it != d_virtualStorages.end();
-         ++it) {
-        it->second->remove(msgGUID);  // ignore rc
-    }
+    // Remove guid from all virtual storages at once.
+    d_log_sp->removeForAllApps(msgGUID);
 
     return mqbi::StorageResult::e_SUCCESS;
 }
@@ -135,11 +129,7 @@ VirtualStorageCatalog::removeAll(const mqbu::StorageKey& appKey)
     }
 
     // Clear all virtual storages.
-    for (VirtualStoragesIter it = d_virtualStorages.begin();
-         it != d_virtualStorages.end();
-         ++it) {
-        it->second->removeAll(it->first);  // ignore rc
-    }
+    d_log_sp->clear();
 
     return mqbi::StorageResult::e_SUCCESS;
 }
@@ -169,6 +159,7 @@ int VirtualStorageCatalog::addVirtualStorage(bsl::ostream& errorDescription,
                       d_storage_p,
                       appId,
                       appKey,
+                      d_log_sp,
                       d_allocator_p);
     d_virtualStorages.insert(bsl::make_pair(appKey, vsp));
 
@@ -252,15 +243,7 @@ bool VirtualStorageCatalog::hasVirtualStorage(const bsl::string& appId,
 
 bool VirtualStorageCatalog::hasMessage(const bmqt::MessageGUID& msgGUID) const
 {
-    for (VirtualStoragesConstIter it = d_virtualStorages.begin();
-         it != d_virtualStorages.end();
-         ++it) {
-        if (it->second->hasMessage(msgGUID)) {
-            return true;  // RETURN
-        }
-    }
-
-    return false;
+    return d_log_sp->hasMessage(msgGUID);
 }
 
 void VirtualStorageCatalog::loadVirtualStorageDetails(
@@ -23,12 +23,15 @@
 //  mqbs::VirtualStorageCatalog: Catalog of virtual storages
 //
 //@DESCRIPTION: 'mqbs::VirtualStorageCatalog' provides a collection of virtual
-// storages associated with a queue.
+// storages associated with a queue.  All virtual storages of a catalog share a
+// single 'mqbs::VirtualStorageLog', so that a message referenced by several
+// virtual storages is stored once, along with a compact per-storage state.
 
 // MQB
 
 #include <mqbi_storage.h>
 #include <mqbs_virtualstorage.h>
+#include <mqbs_virtualstoragelog.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -71,6 +74,10 @@ class VirtualStorageCatalog {
                                  // virtual storages known to this
                                  // object
 
+    bsl::shared_ptr<VirtualStorageLog> d_log_sp;
+    // Log of the messages of all virtual
+    // storages
+
     VirtualStorages d_virtualStorages;
     // Map of appKey to corresponding
     // virtual storage
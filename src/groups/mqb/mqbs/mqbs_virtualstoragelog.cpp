@@ -0,0 +1,367 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_virtualstoragelog.cpp                                         -*-C++-*-
+#include <mqbs_virtualstoragelog.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ------------------------------
+// struct VirtualStorageLog::App
+// ------------------------------
+
+// CREATORS
+VirtualStorageLog::App::App(bslma::Allocator* basicAllocator)
+: d_bitmap(basicAllocator)
+, d_bitmapBase(0)
+, d_states(basicAllocator)
+, d_numMessages(0)
+, d_numBytes(0)
+, d_first()
+, d_isActive(true)
+{
+    // NOTHING
+}
+
+VirtualStorageLog::App::App(const App& other, bslma::Allocator* basicAllocator)
+: d_bitmap(other.d_bitmap, basicAllocator)
+, d_bitmapBase(other.d_bitmapBase)
+, d_states(other.d_states, basicAllocator)
+, d_numMessages(other.d_numMessages)
+, d_numBytes(other.d_numBytes)
+, d_first(other.d_first)
+, d_isActive(other.d_isActive)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void VirtualStorageLog::App::setPresent(bsls::Types::Int64 sequenceNumber)
+{
+    const bsls::Types::Int64 word = sequenceNumber >> 6;
+
+    if (d_bitmap.empty()) {
+        d_bitmapBase = word;
+        d_bitmap.push_back(0);
+    }
+    else if (word < d_bitmapBase) {
+        // The message was appended for another app first.
+        d_bitmap.insert(d_bitmap.begin(), d_bitmapBase - word, 0);
+        d_bitmapBase = word;
+    }
+    else {
+        const bsls::Types::Int64 size = word - d_bitmapBase + 1;
+        if (static_cast<bsls::Types::Int64>(d_bitmap.size()) < size) {
+            d_bitmap.resize(size, 0);
+        }
+    }
+
+    d_bitmap[word - d_bitmapBase] |= bsls::Types::Uint64(1)
+                                     << (sequenceNumber & 63);
+}
+
+void VirtualStorageLog::App::resetPresent(bsls::Types::Int64 sequenceNumber)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPresent(sequenceNumber));
+
+    d_bitmap[(sequenceNumber >> 6) - d_bitmapBase] &= ~(
+        bsls::Types::Uint64(1) << (sequenceNumber & 63));
+    d_states.erase(sequenceNumber);
+
+    // Messages are usually removed in order, so trimming the front words is
+    // what keeps the bitmap spanning the messages of the app only.
+    while (!d_bitmap.empty() && d_bitmap.front() == 0) {
+        d_bitmap.pop_front();
+        ++d_bitmapBase;
+    }
+    while (!d_bitmap.empty() && d_bitmap.back() == 0) {
+        d_bitmap.pop_back();
+    }
+}
+
+void VirtualStorageLog::App::clear()
+{
+    d_bitmap.clear();
+    d_bitmapBase = 0;
+    d_states.clear();
+    d_numMessages = 0;
+    d_numBytes    = 0;
+}
+
+// -----------------------
+// class VirtualStorageLog
+// -----------------------
+
+// PRIVATE MANIPULATORS
+bool VirtualStorageLog::attach(Iterator             it,
+                               const bmqp::RdaInfo& rdaInfo,
+                               unsigned int         subscriptionId,
+                               int                  ordinal)
+{
+    Message& message = it->second;
+    App&     app     = d_apps[ordinal];
+    if (app.isPresent(message.d_sequenceNumber)) {
+        return false;  // RETURN
+    }
+
+    app.setPresent(message.d_sequenceNumber);
+    if (message.d_subscriptionId != subscriptionId ||
+        !(message.d_rdaInfo == rdaInfo)) {
+        // The app keeps its own state only if it differs from the one of the
+        // message.
+        app.d_states.insert(
+            bsl::make_pair(message.d_sequenceNumber,
+                           AppState(subscriptionId, rdaInfo)));
+    }
+    ++message.d_numApps;
+
+    if (app.d_numMessages == 0 ||
+        message.d_sequenceNumber < app.d_first->second.d_sequenceNumber) {
+        // The message may be older than the oldest message of the app if it
+        // was appended for another app first.
+        app.d_first = it;
+    }
+    ++app.d_numMessages;
+    app.d_numBytes += message.d_size;
+
+    return true;
+}
+
+void VirtualStorageLog::detach(Iterator it, int ordinal)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPresent(it, ordinal));
+
+    Message& message = it->second;
+    App&     app     = d_apps[ordinal];
+
+    app.resetPresent(message.d_sequenceNumber);
+    --message.d_numApps;
+
+    --app.d_numMessages;
+    app.d_numBytes -= message.d_size;
+
+    if (app.d_numMessages != 0 && app.d_first == ConstIterator(it)) {
+        // Messages are usually removed in order, so this is cheap.
+        next(&app.d_first, ordinal);
+        BSLS_ASSERT_SAFE(app.d_first != d_messages.end());
+    }
+}
+
+// CREATORS
+VirtualStorageLog::VirtualStorageLog(bslma::Allocator* allocator)
+: d_messages(allocator)
+, d_apps(allocator)
+, d_freeOrdinals(allocator)
+, d_nextSequenceNumber(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(allocator);
+}
+
+// MANIPULATORS
+int VirtualStorageLog::addApp()
+{
+    if (!d_freeOrdinals.empty()) {
+        const int ordinal = d_freeOrdinals.back();
+        d_freeOrdinals.pop_back();
+
+        App& app = d_apps[ordinal];
+        BSLS_ASSERT_SAFE(!app.d_isActive);
+        app.clear();
+        app.d_isActive = true;
+        return ordinal;  // RETURN
+    }
+
+    // Apps are kept in a deque, so this does not invalidate the references
+    // returned by 'rdaInfo'.
+    d_apps.emplace_back();
+    return static_cast<int>(d_apps.size()) - 1;
+}
+
+void VirtualStorageLog::removeApp(int ordinal)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= ordinal &&
+                     ordinal < static_cast<int>(d_apps.size()));
+    BSLS_ASSERT_SAFE(d_apps[ordinal].d_isActive);
+
+    removeAll(ordinal);
+
+    d_apps[ordinal].d_isActive = false;
+    d_freeOrdinals.push_back(ordinal);
+}
+
+mqbi::StorageResult::Enum
+VirtualStorageLog::put(const bmqt::MessageGUID& msgGUID,
+                       int                      msgSize,
+                       const bmqp::RdaInfo&     rdaInfo,
+                       unsigned int             subscriptionId,
+                       int                      ordinal)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= ordinal &&
+                     ordinal < static_cast<int>(d_apps.size()));
+    BSLS_ASSERT_SAFE(d_apps[ordinal].d_isActive);
+
+    bsl::pair<Iterator, bool> insertion = d_messages.insert(bsl::make_pair(
+        msgGUID,
+        Message(d_nextSequenceNumber, msgSize, subscriptionId, rdaInfo)));
+    if (insertion.second) {
+        ++d_nextSequenceNumber;
+    }
+
+    if (!attach(insertion.first, rdaInfo, subscriptionId, ordinal)) {
+        // Duplicate GUID
+        return mqbi::StorageResult::e_GUID_NOT_UNIQUE;  // RETURN
+    }
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+void VirtualStorageLog::putForAllApps(const bmqt::MessageGUID& msgGUID,
+                                      int                      msgSize,
+                                      const bmqp::RdaInfo&     rdaInfo,
+                                      unsigned int             subscriptionId)
+{
+    if (d_apps.size() == d_freeOrdinals.size()) {
+        // No app to reference the message.
+        return;  // RETURN
+    }
+
+    bsl::pair<Iterator, bool> insertion = d_messages.insert(bsl::make_pair(
+        msgGUID,
+        Message(d_nextSequenceNumber, msgSize, subscriptionId, rdaInfo)));
+    if (insertion.second) {
+        ++d_nextSequenceNumber;
+    }
+
+    for (int ordinal = 0; ordinal < static_cast<int>(d_apps.size());
+         ++ordinal) {
+        if (d_apps[ordinal].d_isActive) {
+            attach(insertion.first, rdaInfo, subscriptionId, ordinal);
+        }
+    }
+}
+
+mqbi::StorageResult::Enum
+VirtualStorageLog::remove(const bmqt::MessageGUID& msgGUID,
+                          int                      ordinal,
+                          int*                     msgSize)
+{
+    Iterator it = d_messages.find(msgGUID);
+    if (it == d_messages.end() || !isPresent(it, ordinal)) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    if (msgSize) {
+        *msgSize = it->second.d_size;
+    }
+
+    detach(it, ordinal);
+    if (it->second.d_numApps == 0) {
+        d_messages.erase(it);
+    }
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+void VirtualStorageLog::removeForAllApps(const bmqt::MessageGUID& msgGUID)
+{
+    Iterator it = d_messages.find(msgGUID);
+    if (it == d_messages.end()) {
+        return;  // RETURN
+    }
+
+    for (int ordinal = 0; it->second.d_numApps != 0 &&
+                          ordinal < static_cast<int>(d_apps.size());
+         ++ordinal) {
+        if (d_apps[ordinal].d_isActive && isPresent(it, ordinal)) {
+            detach(it, ordinal);
+        }
+    }
+
+    BSLS_ASSERT_SAFE(it->second.d_numApps == 0);
+    d_messages.erase(it);
+}
+
+void VirtualStorageLog::removeAll(int ordinal)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= ordinal &&
+                     ordinal < static_cast<int>(d_apps.size()));
+
+    App& app = d_apps[ordinal];
+    if (app.d_numMessages == 0) {
+        return;  // RETURN
+    }
+
+    // Start from the oldest message of the app rather than from the oldest
+    // message of the log.
+    Iterator it = d_messages.find(app.d_first->first);
+    while (app.d_numMessages != 0 && it != d_messages.end()) {
+        if (!isPresent(it, ordinal)) {
+            ++it;
+            continue;  // CONTINUE
+        }
+
+        detach(it, ordinal);
+        if (it->second.d_numApps == 0) {
+            it = d_messages.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    BSLS_ASSERT_SAFE(app.d_numMessages == 0);
+    app.clear();
+}
+
+void VirtualStorageLog::clear()
+{
+    d_messages.clear();
+
+    for (Apps::iterator it = d_apps.begin(); it != d_apps.end(); ++it) {
+        it->clear();
+    }
+}
+
+// ACCESSORS
+bmqp::RdaInfo& VirtualStorageLog::rdaInfo(const ConstIterator& it,
+                                          int                  ordinal) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPresent(it, ordinal));
+
+    // The app takes its own copy of the state of the message, which stays at
+    // the same address until the app stops referencing the message.
+    const Message& message = it->second;
+    return d_apps[ordinal]
+        .d_states
+        .insert(bsl::make_pair(
+            message.d_sequenceNumber,
+            AppState(message.d_subscriptionId, message.d_rdaInfo)))
+        .first->second.d_rdaInfo;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
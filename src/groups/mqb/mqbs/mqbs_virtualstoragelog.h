@@ -0,0 +1,540 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_virtualstoragelog.h                                           -*-C++-*-
+#ifndef INCLUDED_MQBS_VIRTUALSTORAGELOG
+#define INCLUDED_MQBS_VIRTUALSTORAGELOG
+
+//@PURPOSE: Provide an ordered log of messages shared by virtual storages.
+//
+//@CLASSES:
+//  mqbs::VirtualStorageLog: Ordered log of messages shared by virtual storages
+//
+//@DESCRIPTION: 'mqbs::VirtualStorageLog' keeps, in insertion order, the
+// messages referenced by any of the virtual storages (i.e., apps) of a queue,
+// along with the state of each message for each app.  Each app is identified
+// by a small integer, its *ordinal*, obtained from 'addApp'.  Each message is
+// assigned a sequence number when it is appended to the log, and each app
+// keeps a bitmap, indexed by sequence number, of the messages it references.
+// The bitmap of an app only spans the sequence numbers between its oldest and
+// its most recent messages, so that the messages of a queue cost one hash node
+// in total, plus one bit per app, no matter how many apps reference them, as
+// opposed to one hash node per message per app when each virtual storage
+// keeps its own map.  A message is removed from the log once no app
+// references it anymore.
+//
+// The subscription a message was routed to, and its redelivery attempts
+// left, are kept once in the message for all apps.  An app only keeps its own
+// copy of them, in a map indexed by sequence number, for the messages put for
+// it with a different state, or whose redelivery attempts it may modify (see
+// 'rdaInfo'), i.e. typically the messages delivered to its consumers and not
+// confirmed yet.
+//
+// The messages of an app are iterated in the order of the log, skipping the
+// messages which are not referenced by the app.  To avoid skipping the whole
+// backlog of the other apps, the log keeps track of the oldest message of
+// each app.
+//
+/// Memory Footprint
+///----------------
+// With 'N' messages referenced by all of 'A' apps, the log uses 'N' hash
+// nodes of about 64 bytes (including the GUID) and 'A * N / 8' bytes of
+// bitmaps, versus 'A * N' hash nodes of about 56 bytes for per-app maps.
+// Counting the hash buckets, that is under 100 bytes per message instead of
+// over 1400 with 20 apps, which the 'MEMORY FOOTPRINT' test case of the test
+// driver measures.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+// This section illustrates intended use of this component.
+//..
+//  mqbs::VirtualStorageLog log(allocator);
+//
+//  const int app1 = log.addApp();
+//  const int app2 = log.addApp();
+//
+//  // A message for all apps, and one for the first app only.
+//  log.putForAllApps(guid1, 100, bmqp::RdaInfo(), 0);
+//  log.put(guid2, 200, bmqp::RdaInfo(), 0, app1);
+//
+//  // Iterate over the messages of the second app.
+//  for (mqbs::VirtualStorageLog::ConstIterator it = log.begin(app2);
+//       it != log.end();
+//       log.next(&it, app2)) {
+//      // 'it->first' is the guid, 'log.rdaInfo(it, app2)' the redelivery
+//      // attempts left for the app.
+//  }
+//..
+
+// MQB
+#include <mqbi_storage.h>
+
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqt_messageguid.h>
+
+// MWC
+#include <mwcc_orderedhashmap.h>
+
+// BDE
+#include <bsl_deque.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// =======================
+// class VirtualStorageLog
+// =======================
+
+/// Ordered log of the messages referenced by the virtual storages of a
+/// queue.
+class VirtualStorageLog {
+  public:
+    // PUBLIC TYPES
+
+    /// A message in the log.
+    struct Message {
+        // DATA
+        bsls::Types::Int64 d_sequenceNumber;
+        // Position of the message in the log
+
+        int d_size;
+        // Size of the message
+
+        int d_numApps;
+        // Number of apps referencing the message
+
+        unsigned int d_subscriptionId;
+        // Subscription the message was routed to,
+        // unless an app keeps its own state
+
+        bmqp::RdaInfo d_rdaInfo;
+        // Redelivery attempts left, unless an app
+        // keeps its own state
+
+        // CREATORS
+
+        /// Create a message having the specified `sequenceNumber`, `size`,
+        /// `subscriptionId` and `rdaInfo`, referenced by no app.
+        Message(bsls::Types::Int64   sequenceNumber,
+                int                  size,
+                unsigned int         subscriptionId,
+                const bmqp::RdaInfo& rdaInfo);
+    };
+
+    /// msgGUID -> Message
+    /// Must be a container in which iteration order is same as insertion
+    /// order.
+    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
+                                 Message,
+                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        Messages;
+
+    typedef Messages::const_iterator ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef Messages::iterator Iterator;
+
+    /// State of a message for an app which differs, or may differ, from the
+    /// state kept in the message.
+    struct AppState {
+        // DATA
+        unsigned int d_subscriptionId;
+        // Subscription the message was routed to
+
+        bmqp::RdaInfo d_rdaInfo;
+        // Redelivery attempts left
+
+        // CREATORS
+        AppState(unsigned int subscriptionId, const bmqp::RdaInfo& rdaInfo);
+    };
+
+    /// sequence number -> AppState
+    typedef bsl::unordered_map<bsls::Types::Int64, AppState> AppStates;
+
+    /// Messages referenced by an app, and per-app counters.
+    struct App {
+        // DATA
+        bsl::deque<bsls::Types::Uint64> d_bitmap;
+        // Bit 'n % 64' of the word 'n / 64 -
+        // d_bitmapBase' is set if the app references
+        // the message having the sequence number 'n'.
+        // The first and last words are non-zero.
+
+        bsls::Types::Int64 d_bitmapBase;
+        // Index of the first word of 'd_bitmap'
+
+        mutable AppStates d_states;
+        // State of the messages whose state is kept
+        // by the app
+
+        bsls::Types::Int64 d_numMessages;
+        // Number of messages referenced by the app
+
+        bsls::Types::Int64 d_numBytes;
+        // Size of the messages referenced by the app
+
+        ConstIterator d_first;
+        // Oldest message referenced by the app, valid
+        // only if 'd_numMessages' is positive
+
+        bool d_isActive;
+        // Whether the ordinal is in use
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(App, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create an active app referencing no message.  Optionally specify
+        /// a `basicAllocator` used to supply memory.  If `basicAllocator` is
+        /// 0, the currently installed default allocator is used.
+        explicit App(bslma::Allocator* basicAllocator = 0);
+
+        /// Create a copy of the specified `other`, using the specified
+        /// `basicAllocator` to supply memory.
+        App(const App& other, bslma::Allocator* basicAllocator);
+
+        // MANIPULATORS
+
+        /// Mark the message having the specified `sequenceNumber` as
+        /// referenced by this app.
+        void setPresent(bsls::Types::Int64 sequenceNumber);
+
+        /// Mark the message having the specified `sequenceNumber` as not
+        /// referenced by this app, and forget its state for this app, if
+        /// any.  The behavior is undefined unless `isPresent` returns true
+        /// for `sequenceNumber`.
+        void resetPresent(bsls::Types::Int64 sequenceNumber);
+
+        /// Make this app reference no message, forget the state of its
+        /// messages and reset its counters.
+        void clear();
+
+        // ACCESSORS
+
+        /// Return `true` if this app references the message having the
+        /// specified `sequenceNumber`.
+        bool isPresent(bsls::Types::Int64 sequenceNumber) const;
+    };
+
+    /// Must be a container whose elements are not moved upon insertion, so
+    /// that the references returned by `rdaInfo` stay valid.
+    typedef bsl::deque<App> Apps;
+
+  private:
+    // DATA
+    Messages d_messages;
+    // Messages referenced by at least one app
+
+    Apps d_apps;
+    // Apps, indexed by ordinal
+
+    bsl::vector<int> d_freeOrdinals;
+    // Ordinals of removed apps, to be reused
+
+    bsls::Types::Int64 d_nextSequenceNumber;
+    // Sequence number of the next message
+    // appended to the log
+
+  private:
+    // NOT IMPLEMENTED
+    VirtualStorageLog(const VirtualStorageLog&);             // = delete
+    VirtualStorageLog& operator=(const VirtualStorageLog&);  // = delete
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Make the app having the specified `ordinal` reference the message
+    /// at the specified `it`, with the specified `rdaInfo` and
+    /// `subscriptionId`.  Return `false` if it already references it.
+    bool attach(Iterator             it,
+                const bmqp::RdaInfo& rdaInfo,
+                unsigned int         subscriptionId,
+                int                  ordinal);
+
+    /// Make the app having the specified `ordinal` stop referencing the
+    /// message at the specified `it`, without erasing the message.  The
+    /// behavior is undefined unless the app references the message.
+    void detach(Iterator it, int ordinal);
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the app having the specified `ordinal` references
+    /// the message at the specified `it`.
+    bool isPresent(const ConstIterator& it, int ordinal) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(VirtualStorageLog,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty log using the specified `allocator`.
+    explicit VirtualStorageLog(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Register a new app and return its ordinal.
+    int addApp();
+
+    /// Unregister the app having the specified `ordinal`, removing it from
+    /// all messages.  The behavior is undefined unless `ordinal` was
+    /// returned by `addApp` and not removed since.
+    void removeApp(int ordinal);
+
+    /// Make the app having the specified `ordinal` reference the message
+    /// having the specified `msgGUID`, `msgSize`, `rdaInfo` and
+    /// `subscriptionId`, appending the message to the log if no other app
+    /// references it.  Return `e_GUID_NOT_UNIQUE` if the app already
+    /// references the message, and `e_SUCCESS` otherwise.
+    mqbi::StorageResult::Enum put(const bmqt::MessageGUID& msgGUID,
+                                  int                      msgSize,
+                                  const bmqp::RdaInfo&     rdaInfo,
+                                  unsigned int             subscriptionId,
+                                  int                      ordinal);
+
+    /// Make all apps reference the message having the specified `msgGUID`,
+    /// `msgSize`, `rdaInfo` and `subscriptionId`.
+    void putForAllApps(const bmqt::MessageGUID& msgGUID,
+                       int                      msgSize,
+                       const bmqp::RdaInfo&     rdaInfo,
+                       unsigned int             subscriptionId);
+
+    /// Make the app having the specified `ordinal` stop referencing the
+    /// message having the specified `msgGUID` and load its size into the
+    /// optionally specified `msgSize`.  Return `e_GUID_NOT_FOUND` if the
+    /// app does not reference the message, and `e_SUCCESS` otherwise.
+    mqbi::StorageResult::Enum
+    remove(const bmqt::MessageGUID& msgGUID, int ordinal, int* msgSize = 0);
+
+    /// Remove the message having the specified `msgGUID` from all apps.
+    void removeForAllApps(const bmqt::MessageGUID& msgGUID);
+
+    /// Make the app having the specified `ordinal` stop referencing any
+    /// message.
+    void removeAll(int ordinal);
+
+    /// Remove all messages from all apps.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return an iterator to the oldest message referenced by the app
+    /// having the specified `ordinal`, or `end()` if there is none.
+    ConstIterator begin(int ordinal) const;
+
+    /// Return the past-the-end iterator.
+    ConstIterator end() const;
+
+    /// Return an iterator to the message having the specified `msgGUID` if
+    /// the app having the specified `ordinal` references it, and `end()`
+    /// otherwise.
+    ConstIterator find(const bmqt::MessageGUID& msgGUID, int ordinal) const;
+
+    /// Advance the specified `it` to the next message referenced by the
+    /// app having the specified `ordinal`, or to `end()` if there is none.
+    /// The behavior is undefined if `it` is `end()`.
+    void next(ConstIterator* it, int ordinal) const;
+
+    /// Return a reference offering modifiable access to the redelivery
+    /// attempts left of the message at the specified `it` for the app
+    /// having the specified `ordinal`.  The reference stays valid until the
+    /// app stops referencing the message, or the log is cleared.  The
+    /// behavior is undefined unless the app references the message.  Note
+    /// that the app keeps its own copy of the state of the message from
+    /// then on.
+    bmqp::RdaInfo& rdaInfo(const ConstIterator& it, int ordinal) const;
+
+    /// Return the subscription the message at the specified `it` was routed
+    /// to for the app having the specified `ordinal`.  The behavior is
+    /// undefined unless the app references the message.
+    unsigned int subscriptionId(const ConstIterator& it, int ordinal) const;
+
+    /// Return `true` if any app references the message having the
+    /// specified `msgGUID`.
+    bool hasMessage(const bmqt::MessageGUID& msgGUID) const;
+
+    /// Return `true` if the app having the specified `ordinal` references
+    /// the message having the specified `msgGUID`.
+    bool hasMessage(const bmqt::MessageGUID& msgGUID, int ordinal) const;
+
+    /// Return the number of messages referenced by the app having the
+    /// specified `ordinal`.
+    bsls::Types::Int64 numMessages(int ordinal) const;
+
+    /// Return the total size of the messages referenced by the app having
+    /// the specified `ordinal`.
+    bsls::Types::Int64 numBytes(int ordinal) const;
+
+    /// Return the number of messages referenced by at least one app.
+    bsls::Types::Int64 size() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------------
+// struct VirtualStorageLog::Message
+// ----------------------------------
+
+inline VirtualStorageLog::Message::Message(
+    bsls::Types::Int64   sequenceNumber,
+    int                  size,
+    unsigned int         subscriptionId,
+    const bmqp::RdaInfo& rdaInfo)
+: d_sequenceNumber(sequenceNumber)
+, d_size(size)
+, d_numApps(0)
+, d_subscriptionId(subscriptionId)
+, d_rdaInfo(rdaInfo)
+{
+    // NOTHING
+}
+
+// -----------------------------------
+// struct VirtualStorageLog::AppState
+// -----------------------------------
+
+inline VirtualStorageLog::AppState::AppState(unsigned int subscriptionId,
+                                             const bmqp::RdaInfo& rdaInfo)
+: d_subscriptionId(subscriptionId)
+, d_rdaInfo(rdaInfo)
+{
+    // NOTHING
+}
+
+// ------------------------------
+// struct VirtualStorageLog::App
+// ------------------------------
+
+inline bool
+VirtualStorageLog::App::isPresent(bsls::Types::Int64 sequenceNumber) const
+{
+    const bsls::Types::Int64 word = (sequenceNumber >> 6) - d_bitmapBase;
+
+    return 0 <= word && word < static_cast<bsls::Types::Int64>(
+                                   d_bitmap.size()) &&
+           ((d_bitmap[word] >> (sequenceNumber & 63)) & 1);
+}
+
+// -----------------------
+// class VirtualStorageLog
+// -----------------------
+
+// ACCESSORS
+inline VirtualStorageLog::ConstIterator
+VirtualStorageLog::begin(int ordinal) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= ordinal &&
+                     ordinal < static_cast<int>(d_apps.size()));
+
+    const App& app = d_apps[ordinal];
+    return app.d_numMessages ? app.d_first : d_messages.end();
+}
+
+inline VirtualStorageLog::ConstIterator VirtualStorageLog::end() const
+{
+    return d_messages.end();
+}
+
+inline bool VirtualStorageLog::isPresent(const ConstIterator& it,
+                                         int                  ordinal) const
+{
+    return d_apps[ordinal].isPresent(it->second.d_sequenceNumber);
+}
+
+inline VirtualStorageLog::ConstIterator
+VirtualStorageLog::find(const bmqt::MessageGUID& msgGUID, int ordinal) const
+{
+    ConstIterator it = d_messages.find(msgGUID);
+    if (it == d_messages.end() || !isPresent(it, ordinal)) {
+        return d_messages.end();  // RETURN
+    }
+
+    return it;
+}
+
+inline void VirtualStorageLog::next(ConstIterator* it, int ordinal) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(*it != d_messages.end());
+
+    do {
+        ++*it;
+    } while (*it != d_messages.end() && !isPresent(*it, ordinal));
+}
+
+inline unsigned int
+VirtualStorageLog::subscriptionId(const ConstIterator& it, int ordinal) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isPresent(it, ordinal));
+
+    const AppStates&          states = d_apps[ordinal].d_states;
+    AppStates::const_iterator state  = states.find(
+        it->second.d_sequenceNumber);
+
+    return state == states.end() ? it->second.d_subscriptionId
+                                 : state->second.d_subscriptionId;
+}
+
+inline bool
+VirtualStorageLog::hasMessage(const bmqt::MessageGUID& msgGUID) const
+{
+    return 1 == d_messages.count(msgGUID);
+}
+
+inline bool VirtualStorageLog::hasMessage(const bmqt::MessageGUID& msgGUID,
+                                          int ordinal) const
+{
+    return find(msgGUID, ordinal) != d_messages.end();
+}
+
+inline bsls::Types::Int64 VirtualStorageLog::numMessages(int ordinal) const
+{
+    return d_apps[ordinal].d_numMessages;
+}
+
+inline bsls::Types::Int64 VirtualStorageLog::numBytes(int ordinal) const
+{
+    return d_apps[ordinal].d_numBytes;
+}
+
+inline bsls::Types::Int64 VirtualStorageLog::size() const
+{
+    return d_messages.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,453 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_virtualstoragelog.t.cpp                                       -*-C++-*-
+#include <mqbs_virtualstoragelog.h>
+
+// MQB
+#include <mqbu_messageguidutil.h>
+
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqt_messageguid.h>
+
+// MWC
+#include <mwcc_orderedhashmap.h>
+
+// BDE
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_testallocator.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bsl::vector<bmqt::MessageGUID> MessageGuids;
+
+/// State of a message kept by a virtual storage having its own map, used
+/// as the baseline of the memory footprint test.
+struct BaselineMessage {
+    int           d_size;
+    bmqp::RdaInfo d_rdaInfo;
+    unsigned int  d_subscriptionId;
+};
+
+typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
+                             BaselineMessage,
+                             bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    BaselineMessages;
+
+/// Load into the specified `guids` the specified `count` new GUIDs.
+void generateGuids(MessageGuids* guids, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+        guids->push_back(guid);
+    }
+}
+
+/// Load into the specified `result` the GUIDs of the messages of the app
+/// having the specified `ordinal` in the specified `log`, in order.
+void loadGuids(MessageGuids*                  result,
+               const mqbs::VirtualStorageLog& log,
+               int                            ordinal)
+{
+    result->clear();
+    for (mqbs::VirtualStorageLog::ConstIterator it = log.begin(ordinal);
+         it != log.end();
+         log.next(&it, ordinal)) {
+        result->push_back(it->first);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   1. Add two apps and messages for all apps and for one app.
+//   2. Verify the messages and counters of each app.
+//   3. Remove the messages and verify they are erased from the log once
+//      no app references them.
+//
+// Testing:
+//   Basic functionality
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    MessageGuids guids(s_allocator_p);
+    generateGuids(&guids, 3);
+
+    mqbs::VirtualStorageLog log(s_allocator_p);
+
+    const int app1 = log.addApp();
+    const int app2 = log.addApp();
+    ASSERT_NE(app1, app2);
+
+    log.putForAllApps(guids[0], 10, bmqp::RdaInfo(), 1);
+    ASSERT_EQ(log.put(guids[1], 20, bmqp::RdaInfo(), 2, app1),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(log.put(guids[1], 20, bmqp::RdaInfo(), 2, app1),
+              mqbi::StorageResult::e_GUID_NOT_UNIQUE);
+    log.putForAllApps(guids[2], 30, bmqp::RdaInfo(), 3);
+
+    ASSERT_EQ(log.size(), 3);
+    ASSERT_EQ(log.numMessages(app1), 3);
+    ASSERT_EQ(log.numBytes(app1), 60);
+    ASSERT_EQ(log.numMessages(app2), 2);
+    ASSERT_EQ(log.numBytes(app2), 40);
+
+    ASSERT(log.hasMessage(guids[1]));
+    ASSERT(log.hasMessage(guids[1], app1));
+    ASSERT(!log.hasMessage(guids[1], app2));
+    ASSERT(log.find(guids[1], app2) == log.end());
+    ASSERT_EQ(log.subscriptionId(log.find(guids[1], app1), app1), 2U);
+
+    MessageGuids result(s_allocator_p);
+    loadGuids(&result, log, app2);
+    ASSERT_EQ(result.size(), 2U);
+    ASSERT_EQ(result[0], guids[0]);
+    ASSERT_EQ(result[1], guids[2]);
+
+    int msgSize = 0;
+    ASSERT_EQ(log.remove(guids[0], app1, &msgSize),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(msgSize, 10);
+    ASSERT_EQ(log.remove(guids[0], app1),
+              mqbi::StorageResult::e_GUID_NOT_FOUND);
+
+    // Still referenced by 'app2'
+    ASSERT_EQ(log.size(), 3);
+    ASSERT_EQ(log.begin(app1)->first, guids[1]);
+
+    ASSERT_EQ(log.remove(guids[0], app2), mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(log.size(), 2);
+    ASSERT(!log.hasMessage(guids[0]));
+    ASSERT_EQ(log.begin(app2)->first, guids[2]);
+
+    log.removeForAllApps(guids[2]);
+    ASSERT_EQ(log.size(), 1);
+    ASSERT_EQ(log.numMessages(app2), 0);
+    ASSERT(log.begin(app2) == log.end());
+
+    log.clear();
+    ASSERT_EQ(log.size(), 0);
+    ASSERT_EQ(log.numMessages(app1), 0);
+    ASSERT_EQ(log.numBytes(app1), 0);
+}
+
+static void test2_oldestMessage()
+// ------------------------------------------------------------------------
+// OLDEST MESSAGE
+//
+// Concerns:
+//   The first message of an app is its oldest message in the log, even if
+//   it was added to the app after a more recent message, and iteration
+//   skips the messages of other apps.
+//
+// Plan:
+//   1. Add messages to one app, then add the oldest of them to another app
+//      after a more recent one.
+//   2. Verify the iteration order of the second app.
+//   3. Remove messages out of order and verify the first message.
+//
+// Testing:
+//   begin
+//   next
+//   remove
+{
+    mwctst::TestHelper::printTestName("OLDEST MESSAGE");
+
+    MessageGuids guids(s_allocator_p);
+    generateGuids(&guids, 4);
+
+    mqbs::VirtualStorageLog log(s_allocator_p);
+
+    const int app1 = log.addApp();
+    const int app2 = log.addApp();
+
+    for (size_t i = 0; i < guids.size(); ++i) {
+        log.put(guids[i], 1, bmqp::RdaInfo(), 0, app1);
+    }
+
+    log.put(guids[2], 1, bmqp::RdaInfo(), 0, app2);
+    log.put(guids[1], 1, bmqp::RdaInfo(), 0, app2);
+
+    MessageGuids result(s_allocator_p);
+    loadGuids(&result, log, app2);
+    ASSERT_EQ(result.size(), 2U);
+    ASSERT_EQ(result[0], guids[1]);
+    ASSERT_EQ(result[1], guids[2]);
+
+    // Removing a message which is not the first keeps the first
+    log.remove(guids[2], app1);
+    ASSERT_EQ(log.begin(app1)->first, guids[0]);
+
+    // Removing the first advances to the next message of the app
+    log.remove(guids[0], app1);
+    ASSERT_EQ(log.begin(app1)->first, guids[1]);
+    log.remove(guids[1], app1);
+    ASSERT_EQ(log.begin(app1)->first, guids[3]);
+
+    loadGuids(&result, log, app1);
+    ASSERT_EQ(result.size(), 1U);
+    ASSERT_EQ(result[0], guids[3]);
+}
+
+static void test3_addRemoveApp()
+// ------------------------------------------------------------------------
+// ADD AND REMOVE APP
+//
+// Concerns:
+//   Removing an app releases the messages referenced only by it, and its
+//   ordinal can be reused by a new app which does not see the messages of
+//   the removed app.  Apps added after a message can reference it.
+//
+// Plan:
+//   1. Add messages to two apps, remove one app and verify the log.
+//   2. Add a new app, verify it reuses the ordinal and has no messages.
+//   3. Add an existing message to the new app.
+//
+// Testing:
+//   addApp
+//   removeApp
+//   removeAll
+{
+    mwctst::TestHelper::printTestName("ADD AND REMOVE APP");
+
+    MessageGuids guids(s_allocator_p);
+    generateGuids(&guids, 2);
+
+    mqbs::VirtualStorageLog log(s_allocator_p);
+
+    const int app1 = log.addApp();
+    const int app2 = log.addApp();
+
+    log.putForAllApps(guids[0], 1, bmqp::RdaInfo(), 0);
+    log.put(guids[1], 1, bmqp::RdaInfo(), 0, app2);
+
+    log.removeApp(app2);
+    ASSERT_EQ(log.size(), 1);
+    ASSERT(!log.hasMessage(guids[1]));
+
+    const int app3 = log.addApp();
+    ASSERT_EQ(app3, app2);
+    ASSERT_EQ(log.numMessages(app3), 0);
+    ASSERT(!log.hasMessage(guids[0], app3));
+
+    const int app4 = log.addApp();
+    ASSERT_EQ(log.put(guids[0], 1, bmqp::RdaInfo(), 0, app4),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT(log.hasMessage(guids[0], app4));
+
+    log.removeAll(app1);
+    ASSERT_EQ(log.numMessages(app1), 0);
+    ASSERT_EQ(log.size(), 1);
+
+    log.removeAll(app4);
+    ASSERT_EQ(log.size(), 0);
+}
+
+static void test4_appState()
+// ------------------------------------------------------------------------
+// APP STATE
+//
+// Concerns:
+//   Each app sees the state a message was put with for it, modifying the
+//   redelivery attempts of a message for an app does not affect the other
+//   apps, and the reference returned by 'rdaInfo' stays valid while apps
+//   and messages are added.
+//
+// Plan:
+//   1. Put a message with a different state for each app and verify the
+//      state seen by each app.
+//   2. Modify the redelivery attempts of a message for one app and verify
+//      the other app is not affected.
+//   3. Add apps and messages and verify the reference is still valid.
+//
+// Testing:
+//   rdaInfo
+//   subscriptionId
+{
+    mwctst::TestHelper::printTestName("APP STATE");
+
+    const int k_NUM_MESSAGES = 1000;
+    const int k_NUM_APPS     = 100;
+
+    MessageGuids guids(s_allocator_p);
+    generateGuids(&guids, k_NUM_MESSAGES);
+
+    mqbs::VirtualStorageLog log(s_allocator_p);
+
+    const int app1 = log.addApp();
+    const int app2 = log.addApp();
+
+    bmqp::RdaInfo rdaInfo;
+    rdaInfo.setCounter(5);
+
+    log.putForAllApps(guids[0], 1, rdaInfo, 1);
+    log.put(guids[1], 1, bmqp::RdaInfo(), 7, app1);
+    log.put(guids[1], 1, rdaInfo, 8, app2);
+
+    mqbs::VirtualStorageLog::ConstIterator it = log.find(guids[1], app1);
+    ASSERT_EQ(log.subscriptionId(it, app1), 7U);
+    ASSERT_EQ(log.subscriptionId(it, app2), 8U);
+    ASSERT(log.rdaInfo(it, app1).isUnlimited());
+    ASSERT_EQ(log.rdaInfo(it, app2).counter(), 5U);
+
+    it                   = log.find(guids[0], app1);
+    bmqp::RdaInfo& first = log.rdaInfo(it, app1);
+    ASSERT_EQ(first.counter(), 5U);
+
+    first.setCounter(2);
+    ASSERT_EQ(log.rdaInfo(it, app1).counter(), 2U);
+    ASSERT_EQ(log.rdaInfo(it, app2).counter(), 5U);
+    ASSERT_EQ(log.subscriptionId(it, app1), 1U);
+
+    for (int i = 0; i < k_NUM_APPS; ++i) {
+        log.addApp();
+    }
+    for (int i = 2; i < k_NUM_MESSAGES; ++i) {
+        log.putForAllApps(guids[i], 1, bmqp::RdaInfo(), 0);
+        log.rdaInfo(log.find(guids[i], app1), app1).setCounter(1);
+    }
+
+    ASSERT_EQ(&first, &log.rdaInfo(it, app1));
+    ASSERT_EQ(first.counter(), 2U);
+
+    // Once removed and put again, the message has the state it was put with
+    log.remove(guids[0], app1);
+    log.put(guids[0], 1, bmqp::RdaInfo(), 1, app1);
+    ASSERT(log.rdaInfo(log.find(guids[0], app1), app1).isUnlimited());
+}
+
+static void test5_memoryFootprint()
+// ------------------------------------------------------------------------
+// MEMORY FOOTPRINT
+//
+// Concerns:
+//   Messages referenced by many apps are kept at the cost of one hash node
+//   in total, rather than one hash node per app, i.e. the log uses an
+//   order of magnitude less memory than one map per virtual storage.
+//
+// Plan:
+//   1. Put the same messages for all of many apps into a log, and into one
+//      map per app, each using its own test allocator.
+//   2. Compare the memory in use by each, and verify it drops back to zero
+//      once the messages are removed.
+//
+// Testing:
+//   Memory footprint
+{
+    mwctst::TestHelper::printTestName("MEMORY FOOTPRINT");
+
+    const int k_NUM_APPS     = 20;
+    const int k_NUM_MESSAGES = 10000;
+
+    MessageGuids guids(s_allocator_p);
+    generateGuids(&guids, k_NUM_MESSAGES);
+
+    bslma::TestAllocator logAllocator("log", false);
+    bslma::TestAllocator baselineAllocator("baseline", false);
+
+    {
+        mqbs::VirtualStorageLog log(&logAllocator);
+        for (int i = 0; i < k_NUM_APPS; ++i) {
+            log.addApp();
+        }
+
+        bsl::vector<BaselineMessages*> baseline(s_allocator_p);
+        for (int i = 0; i < k_NUM_APPS; ++i) {
+            baseline.push_back(new (*s_allocator_p)
+                                   BaselineMessages(&baselineAllocator));
+        }
+
+        const BaselineMessage message = {1, bmqp::RdaInfo(), 0};
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            log.putForAllApps(guids[i], 1, bmqp::RdaInfo(), 0);
+            for (int j = 0; j < k_NUM_APPS; ++j) {
+                baseline[j]->insert(bsl::make_pair(guids[i], message));
+            }
+        }
+
+        const bsls::Types::Int64 logBytes = logAllocator.numBytesInUse();
+        const bsls::Types::Int64 baselineBytes =
+            baselineAllocator.numBytesInUse();
+
+        PV("Log: " << logBytes / k_NUM_MESSAGES << " bytes per message, "
+                   << "per-app maps: " << baselineBytes / k_NUM_MESSAGES
+                   << " bytes per message");
+
+        ASSERT_GE(baselineBytes, 10 * logBytes);
+
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            log.removeForAllApps(guids[i]);
+        }
+        ASSERT_EQ(log.size(), 0);
+
+        for (int i = 0; i < k_NUM_APPS; ++i) {
+            s_allocator_p->deleteObject(baseline[i]);
+        }
+    }
+
+    ASSERT_EQ(logAllocator.numBytesInUse(), 0);
+    ASSERT_EQ(baselineAllocator.numBytesInUse(), 0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mqbu::MessageGUIDUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_memoryFootprint(); break;
+    case 4: test4_appState(); break;
+    case 3: test3_addRemoveApp(); break;
+    case 2: test2_oldestMessage(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
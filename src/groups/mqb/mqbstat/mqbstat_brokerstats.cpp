@@ -48,7 +48,11 @@ static const char k_BROKER_STAT_NAME[] = "broker";
 /// Namespace for the constants of stat values that applies to the queues
 /// from the clients
 struct BrokerStatsIndex {
-    enum Enum { e_STAT_QUEUE_COUNT, e_STAT_CLIENT_COUNT };
+    enum Enum {
+        e_STAT_QUEUE_COUNT,
+        e_STAT_CLIENT_COUNT,
+        e_STAT_DISPATCHER_MIGRATIONS
+    };
 };
 
 }  // close unnamed namespace
@@ -87,6 +91,10 @@ bsls::Types::Int64 BrokerStats::getValue(const mwcst::StatContext& context,
     case Stat::e_CLIENT_COUNT: {
         return STAT_RANGE(rangeMax, BrokerStatsIndex::e_STAT_CLIENT_COUNT);
     }
+    case Stat::e_DISPATCHER_MIGRATIONS_DELTA: {
+        return STAT_RANGE(valueDifference,
+                          BrokerStatsIndex::e_STAT_DISPATCHER_MIGRATIONS);
+    }
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
     }
@@ -129,6 +137,11 @@ void BrokerStats::onEvent(EventType::Enum type)
     case EventType::e_QUEUE_DESTROYED: {
         d_statContext_p->adjustValue(BrokerStatsIndex::e_STAT_QUEUE_COUNT, -1);
     } break;
+    case EventType::e_DISPATCHER_CLIENT_MIGRATED: {
+        d_statContext_p->adjustValue(
+            BrokerStatsIndex::e_STAT_DISPATCHER_MIGRATIONS,
+            1);
+    } break;
     default: {
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
@@ -152,7 +165,8 @@ BrokerStatsUtil::initializeStatContext(int               historySize,
         .statValueAllocator(allocator)
         .storeExpiredSubcontextValues(true)
         .value("queue_count")
-        .value("client_count");
+        .value("client_count")
+        .value("dispatcher_migrations");
 
     bsl::shared_ptr<mwcst::StatContext> statContext =
         bsl::shared_ptr<mwcst::StatContext>(
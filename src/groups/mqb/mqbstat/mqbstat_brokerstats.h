@@ -66,7 +66,8 @@ class BrokerStats {
             e_CLIENT_CREATED,
             e_CLIENT_DESTROYED,
             e_QUEUE_CREATED,
-            e_QUEUE_DESTROYED
+            e_QUEUE_DESTROYED,
+            e_DISPATCHER_CLIENT_MIGRATED
         };
     };
 
@@ -74,7 +75,11 @@ class BrokerStats {
     /// from this object.
     struct Stat {
         // TYPES
-        enum Enum { e_CLIENT_COUNT, e_QUEUE_COUNT };
+        enum Enum {
+            e_CLIENT_COUNT,
+            e_QUEUE_COUNT,
+            e_DISPATCHER_MIGRATIONS_DELTA
+        };
     };
 
   private:
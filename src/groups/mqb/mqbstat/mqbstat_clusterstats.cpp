@@ -83,6 +83,26 @@ struct ClusterStatsIndex {
         ,
         e_PARTITION_JOURNAL_BYTES
         // Value: Outstanding bytes in the journal file of the partition.
+        ,
+        e_PARTITION_SYNC_TIME
+        // Value: Nanoseconds time it took for a durable sync of the
+        //        partition.
+        ,
+        e_PARTITION_SYNC_BATCH_BYTES
+        // Value: Number of bytes covered by a durable sync of the partition.
+        ,
+        e_PARTITION_RECOVERY_TIME
+        // Value: Nanoseconds time it took to recover the partition from its
+        //        files.
+        ,
+        e_PARTITION_ROLLOVER_COPY_TIME
+        // Value: Nanoseconds time it took for the background copy of the
+        //        payloads carried over by a rollover of the partition.
+        // Per replica stats
+        ,
+        e_PARTITION_REPLICA_LAG
+        // Value: Number of records replicated to the replica and not yet
+        //        receipted by it.
     };
 };
 
@@ -205,6 +225,41 @@ bsls::Types::Int64 ClusterStats::getValue(const mwcst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_SYNC_TIME_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(averagePerEvent,
+                                                  e_PARTITION_SYNC_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_PARTITION_SYNC_TIME_MAX: {
+        const bsls::Types::Int64 max = STAT_RANGE(rangeMax,
+                                                  e_PARTITION_SYNC_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case Stat::e_PARTITION_SYNC_BATCH_BYTES_AVG: {
+        const bsls::Types::Int64 avg = STAT_RANGE(
+            averagePerEvent,
+            e_PARTITION_SYNC_BATCH_BYTES);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_PARTITION_SYNC_COUNT: {
+        return STAT_RANGE(eventsDifference, e_PARTITION_SYNC_TIME);
+    }
+    case Stat::e_PARTITION_RECOVERY_TIME: {
+        return STAT_SINGLE(value, e_PARTITION_RECOVERY_TIME);
+    }
+    case Stat::e_PARTITION_ROLLOVER_COPY_TIME: {
+        const bsls::Types::Int64 value = STAT_RANGE(
+            rangeMax,
+            e_PARTITION_ROLLOVER_COPY_TIME);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICA_LAG_MAX: {
+        const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
+                                                    e_PARTITION_REPLICA_LAG);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -217,8 +272,10 @@ bsls::Types::Int64 ClusterStats::getValue(const mwcst::StatContext& context,
 }
 
 ClusterStats::ClusterStats(bslma::Allocator* allocator)
-: d_statContext_mp(0)
+: d_allocator_p(allocator)
+, d_statContext_mp(0)
 , d_partitionsStatContexts(allocator)
+, d_replicasStatContexts(allocator)
 {
     // NOTHING
 }
@@ -258,6 +315,7 @@ void ClusterStats::initialize(const bsl::string&  name,
                                                     &localAllocator))));
         setNodeRoleForPartition(pId, PrimaryStatus::e_UNKNOWN);
     }
+    d_replicasStatContexts.resize(partitionsCount);
 }
 
 void ClusterStats::onPartitionEvent(PartitionEventType::Enum type,
@@ -277,6 +335,22 @@ void ClusterStats::onPartitionEvent(PartitionEventType::Enum type,
     case PartitionEventType::e_PARTITION_ROLLOVER: {
         sc->reportValue(ClusterStatsIndex::e_PARTITION_ROLLOVER_TIME, value);
     } break;
+    case PartitionEventType::e_PARTITION_SYNC: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_SYNC_TIME, value);
+    } break;
+    case PartitionEventType::e_PARTITION_SYNC_BATCH: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_SYNC_BATCH_BYTES,
+                        value);
+    } break;
+    case PartitionEventType::e_PARTITION_RECOVERY: {
+        // Recovery only happens when the partition is opened, so keep the
+        // last value rather than a per-interval one.
+        sc->setValue(ClusterStatsIndex::e_PARTITION_RECOVERY_TIME, value);
+    } break;
+    case PartitionEventType::e_PARTITION_ROLLOVER_COPY: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_ROLLOVER_COPY_TIME,
+                        value);
+    } break;
     default: {
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
@@ -386,6 +460,36 @@ ClusterStats::setPartitionOutstandingBytes(int                partitionId,
     return *this;
 }
 
+ClusterStats&
+ClusterStats::setPartitionReplicaLag(int                partitionId,
+                                     int                nodeId,
+                                     bsls::Types::Int64 value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(partitionId >= 0 &&
+                     partitionId <
+                         static_cast<int>(d_partitionsStatContexts.size()));
+    BSLS_ASSERT_SAFE(d_partitionsStatContexts[partitionId] &&
+                     "initialize was not called");
+
+    // Each partition only ever accesses its own map, from its own dispatcher
+    // thread, so no synchronization is needed.
+    bsl::shared_ptr<mwcst::StatContext>& replicaContext =
+        d_replicasStatContexts[partitionId][nodeId];
+    if (!replicaContext) {
+        bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
+        const bsl::string replicaName = "node" + bsl::to_string(nodeId);
+        replicaContext = bsl::shared_ptr<mwcst::StatContext>(
+            d_partitionsStatContexts[partitionId]->addSubcontext(
+                mwcst::StatContextConfiguration(replicaName,
+                                                &localAllocator)));
+    }
+
+    replicaContext->reportValue(ClusterStatsIndex::e_PARTITION_REPLICA_LAG,
+                                value);
+    return *this;
+}
+
 // -------------------------
 // struct ClusterStats::Role
 // -------------------------
@@ -569,15 +673,23 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("partition_status")
         .value("partition.rollover_time", mwcst::StatValue::DMCST_DISCRETE)
         .value("partition.data_bytes", mwcst::StatValue::DMCST_DISCRETE)
-        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE);
-
-    // NOTE: For the clusters, the stat context will have two levels of
-    //       children, first level is per cluster, and second level is per
-    //       partition in the cluster.  For convenience, we configure the stat
-    //       context at the root, meaning that not all columns will be relevant
-    //       to all rows, but this is ok, the drawback is a slight waste of
-    //       memory - which is acceptable here since a broker will not have
-    //       thousands of clusters and partitions.
+        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.sync_time", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.sync_batch_bytes",
+               mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.recovery_time")
+        .value("partition.rollover_copy_time",
+               mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.replica_lag", mwcst::StatValue::DMCST_DISCRETE);
+
+    // NOTE: For the clusters, the stat context will have up to three levels
+    //       of children, first level is per cluster, second level is per
+    //       partition in the cluster, and third level is per replica of the
+    //       partition (only on its primary).  For convenience, we configure
+    //       the stat context at the root, meaning that not all columns will be
+    //       relevant to all rows, but this is ok, the drawback is a slight
+    //       waste of memory - which is acceptable here since a broker will not
+    //       have thousands of clusters and partitions.
 
     return bsl::shared_ptr<mwcst::StatContext>(
         new (*allocator) mwcst::StatContext(config, allocator),
@@ -37,6 +37,7 @@
 // BDE
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
@@ -70,6 +71,22 @@ class ClusterStats {
         enum Enum {
             e_PARTITION_ROLLOVER
             // Time in nanoseconds it took for the rollover operation.
+            ,
+            e_PARTITION_SYNC
+            // Time in nanoseconds it took for a durable sync of the
+            // partition files.
+            ,
+            e_PARTITION_SYNC_BATCH
+            // Number of bytes covered by a durable sync of the partition
+            // files.
+            ,
+            e_PARTITION_RECOVERY
+            // Time in nanoseconds it took to recover the partition from its
+            // files at startup.
+            ,
+            e_PARTITION_ROLLOVER_COPY
+            // Time in nanoseconds it took for the background copy of the
+            // message payloads carried over by a rollover.
         };
     };
 
@@ -109,6 +126,39 @@ class ClusterStats {
             e_PARTITION_JOURNAL_CONTENT
             // Maximum observed outstanding bytes in the journal file of the
             // partition.
+            ,
+            e_PARTITION_SYNC_TIME_AVG
+            // Average time in nanoseconds it took for the durable syncs of
+            // the partition during the report interval.
+            ,
+            e_PARTITION_SYNC_TIME_MAX
+            // Maximum time in nanoseconds it took for a durable sync of the
+            // partition during the report interval.
+            ,
+            e_PARTITION_SYNC_BATCH_BYTES_AVG
+            // Average number of bytes covered by the durable syncs of the
+            // partition during the report interval.
+            ,
+            e_PARTITION_SYNC_COUNT
+            // Number of durable syncs of the partition during the report
+            // interval.
+            ,
+            e_PARTITION_RECOVERY_TIME
+            // Time in nanoseconds it took to recover the partition from its
+            // files the last time it was opened.
+            ,
+            e_PARTITION_ROLLOVER_COPY_TIME
+            // Time in nanoseconds it took for the background copy of the
+            // payloads carried over by a rollover of the partition.  Note
+            // that in case when more than one copy completed during the
+            // report interval, then the maximum time is returned.
+            // ReplicaStats: those metrics make sense only from the 'replica
+            //               level' stat context, child of a 'partition level'
+            //               one
+            ,
+            e_PARTITION_REPLICA_LAG_MAX
+            // Maximum observed number of records replicated by the primary
+            // of the partition to the replica and not yet receipted by it.
         };
     };
 
@@ -161,8 +211,16 @@ class ClusterStats {
         static const char* toAscii(Enum value);
     };
 
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<int, bsl::shared_ptr<mwcst::StatContext> >
+        ReplicaStatContexts;
+
   private:
     // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
     bslma::ManagedPtr<mwcst::StatContext> d_statContext_mp;
     // StatContext for the cluster
 
@@ -173,6 +231,14 @@ class ClusterStats {
     // are created as children of the
     // above 'd_StatContext_mp'.
 
+    bsl::vector<ReplicaStatContexts> d_replicasStatContexts;
+    // StatContext for each replica node of
+    // each partition, indexed by the
+    // partition id and then by the node
+    // id.  Those statContext are created
+    // on first use, as children of the
+    // corresponding partition statContext.
+
   private:
     // NOT IMPLEMENTED
     ClusterStats(const ClusterStats&) BSLS_CPP11_DELETED;
@@ -257,6 +323,15 @@ class ClusterStats {
                                  bsls::Types::Int64 dataBytes,
                                  bsls::Types::Int64 journalBytes);
 
+    /// Set the number of records replicated by self, as the primary of the
+    /// specified `partitionId`, to the replica having the specified
+    /// `nodeId` and not yet receipted by it, to the specified `value`.
+    /// Note that this method must always be invoked from the dispatcher
+    /// thread of `partitionId`.
+    ClusterStats& setPartitionReplicaLag(int                partitionId,
+                                         int                nodeId,
+                                         bsls::Types::Int64 value);
+
     /// Return a pointer to the statcontext.
     mwcst::StatContext* statContext();
 };
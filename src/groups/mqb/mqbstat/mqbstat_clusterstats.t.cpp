@@ -0,0 +1,204 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_clusterstats.t.cpp                                         -*-C++-*-
+#include <mqbstat_clusterstats.h>
+
+// MWC
+#include <mwcst_statcontext.h>
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsls_assert.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - Initialize the cluster stat context and ensure one subcontext is
+//     created per partition.
+//
+// Plan:
+//   Instantiate the component under test and verify values
+//
+// Testing:
+//   Stat Context initialization
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Breathing Test");
+
+    const int k_HISTORY_SIZE = 2;
+
+    bsl::shared_ptr<mwcst::StatContext> clusters =
+        mqbstat::ClusterStatsUtil::initializeStatContextCluster(
+            k_HISTORY_SIZE,
+            s_allocator_p);
+
+    mqbstat::ClusterStats clusterStats(s_allocator_p);
+    clusterStats.initialize("testCluster", 2, clusters.get(), s_allocator_p);
+
+    clusters->snapshot();
+
+    ASSERT_EQ(clusters->numSubcontexts(), 1);
+    ASSERT_EQ(clusterStats.statContext()->numSubcontexts(), 2);
+
+    const mwcst::StatContext* partition =
+        clusterStats.statContext()->getSubcontext("partition1");
+    ASSERT(partition);
+    ASSERT_EQ(partition->numSubcontexts(), 0);
+    ASSERT_EQ(mqbstat::ClusterStats::getValue(
+                  *partition,
+                  1,
+                  mqbstat::ClusterStats::Stat::e_PARTITION_REPLICA_LAG_MAX),
+              0);
+}
+
+static void test2_partitionReplicaLag()
+// ------------------------------------------------------------------------
+// PARTITION REPLICA LAG
+//
+// Concerns:
+//   1. A subcontext is created under the partition, on first use, for each
+//      replica whose lag is reported.
+//   2. The lags of the replicas, and of the partitions, are independent.
+//   3. The maximum lag reported during the interval is returned, and zero
+//      if none was reported.
+//
+// Plan:
+//   - Report the lag of replicas of two partitions, across snapshots.
+//   - Verify the subcontexts and the values.
+//
+// Testing:
+//   setPartitionReplicaLag
+//   getValue(e_PARTITION_REPLICA_LAG_MAX)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PARTITION REPLICA LAG");
+
+    typedef mqbstat::ClusterStats::Stat Stat;
+
+#define ASSERT_EQ_LAG(CONTEXT, SNAPSHOT, VALUE)                               \
+    ASSERT_EQ(VALUE,                                                          \
+              mqbstat::ClusterStats::getValue(                                \
+                  *CONTEXT,                                                   \
+                  SNAPSHOT,                                                   \
+                  Stat::e_PARTITION_REPLICA_LAG_MAX));
+
+    const int k_HISTORY_SIZE = 3;
+
+    bsl::shared_ptr<mwcst::StatContext> clusters =
+        mqbstat::ClusterStatsUtil::initializeStatContextCluster(
+            k_HISTORY_SIZE,
+            s_allocator_p);
+
+    mqbstat::ClusterStats clusterStats(s_allocator_p);
+    clusterStats.initialize("testCluster", 2, clusters.get(), s_allocator_p);
+
+    const mwcst::StatContext* partition0 =
+        clusterStats.statContext()->getSubcontext("partition0");
+    const mwcst::StatContext* partition1 =
+        clusterStats.statContext()->getSubcontext("partition1");
+    BSLS_ASSERT_OPT(partition0);
+    BSLS_ASSERT_OPT(partition1);
+
+    {
+        PV("First interval");
+
+        clusterStats.setPartitionReplicaLag(0, 1, 5)
+            .setPartitionReplicaLag(0, 1, 3)
+            .setPartitionReplicaLag(0, 2, 7)
+            .setPartitionReplicaLag(1, 1, 4);
+
+        clusters->snapshot();
+
+        ASSERT_EQ(partition0->numSubcontexts(), 2);
+        ASSERT_EQ(partition1->numSubcontexts(), 1);
+
+        const mwcst::StatContext* replica01 = partition0->getSubcontext(
+            "node1");
+        const mwcst::StatContext* replica02 = partition0->getSubcontext(
+            "node2");
+        const mwcst::StatContext* replica11 = partition1->getSubcontext(
+            "node1");
+        BSLS_ASSERT_OPT(replica01);
+        BSLS_ASSERT_OPT(replica02);
+        BSLS_ASSERT_OPT(replica11);
+
+        ASSERT_EQ_LAG(replica01, 1, 5);
+        ASSERT_EQ_LAG(replica02, 1, 7);
+        ASSERT_EQ_LAG(replica11, 1, 4);
+    }
+
+    {
+        PV("Second interval");
+
+        clusterStats.setPartitionReplicaLag(0, 1, 2);
+
+        clusters->snapshot();
+
+        // The subcontext of a replica is only created once.
+        ASSERT_EQ(partition0->numSubcontexts(), 2);
+        ASSERT_EQ(partition1->numSubcontexts(), 1);
+
+        const mwcst::StatContext* replica01 = partition0->getSubcontext(
+            "node1");
+        const mwcst::StatContext* replica02 = partition0->getSubcontext(
+            "node2");
+
+        ASSERT_EQ_LAG(replica01, 1, 2);
+        ASSERT_EQ_LAG(replica02, 1, 0);
+
+        // Across both intervals
+        ASSERT_EQ_LAG(replica01, 2, 5);
+        ASSERT_EQ_LAG(replica02, 2, 7);
+    }
+
+#undef ASSERT_EQ_LAG
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_partitionReplicaLag(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_DEFAULT);
+    // Do not check for default/global allocator usage.
+}
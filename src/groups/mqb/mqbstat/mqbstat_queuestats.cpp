@@ -141,6 +141,11 @@ struct DomainQueueStats {
         // Value:      Accumulated number of messages in the strong
         //             consistency queue expired before receiving quorum
         //             Receipts
+
+        ,
+        e_STAT_GC_TIME
+        // Value:      The time spent garbage-collecting expired messages of
+        //             the queue in one run (in nanoseconds).
     };
 };
 
@@ -327,6 +332,16 @@ QueueStatsDomain::getValue(const mwcst::StatContext& context,
         return STAT_RANGE(valueDifference,
                           DomainQueueStats::e_STAT_NO_SC_MSGS);
     }
+    case QueueStatsDomain::Stat::e_GC_TIME_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_GC_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_GC_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_GC_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
     }
@@ -472,6 +487,10 @@ void QueueStatsDomain::onEvent(EventType::Enum type, bsls::Types::Int64 value)
         d_statContext_mp->adjustValue(DomainQueueStats::e_STAT_NO_SC_MSGS,
                                       value);
     } break;
+    case EventType::e_GC_TIME: {
+        d_statContext_mp->reportValue(DomainQueueStats::e_STAT_GC_TIME,
+                                      value);
+    } break;
     default: {
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
@@ -675,7 +694,7 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("cfg_msgs")
         .value("cfg_bytes")
         .value("content_msgs")
-        .value("content_bytes");
+        .value("gc_time", mwcst::StatValue::DMCST_DISCRETE);
     // NOTE: If the stats are using too much memory, we could reconsider
     //       nb_producer, nb_consumer, messages and bytes to be using atomic
     //       int and not stat value.
@@ -862,6 +881,16 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      DomainQueueStats::e_STAT_NO_SC_MSGS,
                      mwcst::StatUtil::value,
                      start);
+    schema.addColumn("gc_time_avg",
+                     DomainQueueStats::e_STAT_GC_TIME,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("gc_time_max",
+                     DomainQueueStats::e_STAT_GC_TIME,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
 
     // Configure records
     mwcst::TableRecords& records = table->records();
@@ -940,6 +969,14 @@ void QueueStatsUtil::initializeTableAndTipDomains(
     tip->setColumnGroup("GC");
     tip->addColumn("gc_msgs_delta", "delta").zeroString("");
     tip->addColumn("gc_msgs_abs", "abs").zeroString("");
+    tip->addColumn("gc_time_avg", "time avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("gc_time_max", "time max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
 }
 
 void QueueStatsUtil::initializeTableAndTipClients(
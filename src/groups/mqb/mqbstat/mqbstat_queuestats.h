@@ -92,7 +92,8 @@ class QueueStatsDomain {
             e_CHANGE_ROLE,
             e_CFG_MSGS,
             e_CFG_BYTES,
-            e_NO_SC_MESSAGE
+            e_NO_SC_MESSAGE,
+            e_GC_TIME
         };
     };
 
@@ -135,7 +136,9 @@ class QueueStatsDomain {
             e_CFG_MSGS,
             e_CFG_BYTES,
             e_NO_SC_MSGS_DELTA,
-            e_NO_SC_MSGS_ABS
+            e_NO_SC_MSGS_ABS,
+            e_GC_TIME_AVG,
+            e_GC_TIME_MAX
         };
     };
 
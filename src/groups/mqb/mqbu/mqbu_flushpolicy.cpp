@@ -0,0 +1,138 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_flushpolicy.cpp                                               -*-C++-*-
+#include <mqbu_flushpolicy.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdlb_print.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_iostream.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ----------------------
+// struct FlushPolicyMode
+// ----------------------
+
+// CLASS METHODS
+bsl::ostream& FlushPolicyMode::print(bsl::ostream&         stream,
+                                     FlushPolicyMode::Enum value,
+                                     int                   level,
+                                     int                   spacesPerLevel)
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bdlb::Print::indent(stream, level, spacesPerLevel);
+    stream << FlushPolicyMode::toAscii(value);
+
+    if (spacesPerLevel >= 0) {
+        stream << '\n';
+    }
+
+    return stream;
+}
+
+const char* FlushPolicyMode::toAscii(FlushPolicyMode::Enum value)
+{
+#define CASE(X)                                                               \
+    case e_##X: return #X;
+
+    switch (value) {
+        CASE(LATENCY)
+        CASE(THROUGHPUT)
+        CASE(ADAPTIVE)
+    default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream& stream, FlushPolicyMode::Enum value)
+{
+    return FlushPolicyMode::print(stream, value, 0, -1);
+}
+
+// -----------------
+// class FlushPolicy
+// -----------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64 FlushPolicy::k_RATE_WINDOW_NS;
+
+// CREATORS
+FlushPolicy::FlushPolicy(FlushPolicyMode::Enum mode,
+                         int                   maxBytes,
+                         bsls::Types::Int64    maxDelayNs,
+                         bsls::Types::Int64    rateThreshold)
+: d_mode(mode)
+, d_maxBytes(maxBytes)
+, d_maxDelayNs(maxDelayNs)
+, d_rateThreshold(rateThreshold)
+, d_isCoalescing(mode == FlushPolicyMode::e_THROUGHPUT)
+, d_hasPending(false)
+, d_firstPendingTime(0)
+, d_windowStartTime(0)
+, d_windowCount(0)
+, d_rate(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < maxBytes);
+    BSLS_ASSERT_SAFE(0 <= maxDelayNs);
+    BSLS_ASSERT_SAFE(0 <= rateThreshold);
+}
+
+// MANIPULATORS
+void FlushPolicy::onItem(bsls::Types::Int64 now)
+{
+    if (!d_hasPending) {
+        d_hasPending       = true;
+        d_firstPendingTime = now;
+    }
+
+    if (d_mode != FlushPolicyMode::e_ADAPTIVE) {
+        return;  // RETURN
+    }
+
+    ++d_windowCount;
+
+    const bsls::Types::Int64 elapsed = now - d_windowStartTime;
+    if (elapsed < k_RATE_WINDOW_NS) {
+        return;  // RETURN
+    }
+
+    // The window is complete: compute the rate over it and start a new one.
+    // An idle period simply results in a longer window, and thus a lower
+    // rate.
+    d_rate = d_windowCount * bdlt::TimeUnitRatio::k_NS_PER_S / elapsed;
+    d_windowCount     = 0;
+    d_windowStartTime = now;
+
+    if (!d_isCoalescing) {
+        d_isCoalescing = d_rate >= d_rateThreshold;
+    }
+    else {
+        d_isCoalescing = d_rate >= d_rateThreshold / 2;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
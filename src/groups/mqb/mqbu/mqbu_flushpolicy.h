@@ -0,0 +1,297 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_flushpolicy.h                                                 -*-C++-*-
+#ifndef INCLUDED_MQBU_FLUSHPOLICY
+#define INCLUDED_MQBU_FLUSHPOLICY
+
+//@PURPOSE: Provide a mechanism deciding when to flush coalesced writes.
+//
+//@CLASSES:
+//  mqbu::FlushPolicyMode: Enumeration of the flush policies
+//  mqbu::FlushPolicy:     Mechanism deciding when to flush coalesced writes
+//
+//@DESCRIPTION:
+// This component provides a mechanism, 'mqbu::FlushPolicy', used by a writer
+// which accumulates messages into a buffer (typically an event builder) to
+// decide whether the buffer should be written out now, or held a little
+// longer so that more messages are coalesced into a single write.  The
+// behavior is governed by one of the modes enumerated by
+// 'mqbu::FlushPolicyMode':
+//
+//: o !e_LATENCY!: every flush opportunity results in a flush; this is the
+//:   historical behavior, minimizing the latency of each message.
+//
+//: o !e_THROUGHPUT!: messages are coalesced until either 'maxBytes' bytes are
+//:   pending, or the oldest pending message has been held for 'maxDelay'
+//:   nanoseconds, trading a bounded latency for fewer, larger writes.
+//
+//: o !e_ADAPTIVE!: the policy measures the rate of messages and behaves as
+//:   'e_LATENCY' while it is below 'rateThreshold' messages per second, and
+//:   as 'e_THROUGHPUT' once it reaches it.  Coalescing stops when the rate
+//:   drops below half of the threshold, so that the policy does not flap
+//:   around the threshold.
+//
+// Note that the policy never holds messages on its own: it is up to the user
+// to arm a timer expiring at 'deadline()' when 'shouldFlush' returns 'false',
+// and to flush when it fires.
+//
+/// Thread Safety
+///-------------
+// NOT Thread-Safe.
+//
+/// Usage
+///-----
+// This section illustrates intended use of this component.
+//..
+//  mqbu::FlushPolicy policy(mqbu::FlushPolicyMode::e_THROUGHPUT,
+//                           64 * 1024,                 // maxBytes
+//                           500 * 1000,                // maxDelay (ns)
+//                           0);                        // rateThreshold
+//
+//  // When a message is added to the builder
+//  policy.onItem(mwcsys::Time::highResolutionTimer());
+//
+//  // When the writer has no more messages to process
+//  const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+//  if (policy.shouldFlush(builder.eventSize(), now)) {
+//      flushBuilder();
+//      policy.onFlushed();
+//  }
+//  else {
+//      // Arm a timer expiring at 'policy.deadline()', if none is armed.
+//  }
+//..
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ======================
+// struct FlushPolicyMode
+// ======================
+
+/// This struct defines the modes of a `FlushPolicy`.
+struct FlushPolicyMode {
+    // TYPES
+    enum Enum {
+        e_LATENCY = 0  // Flush at every opportunity
+        ,
+        e_THROUGHPUT = 1  // Coalesce up to a byte and time budget
+        ,
+        e_ADAPTIVE = 2  // Coalesce only at high message rates
+    };
+
+    // CLASS METHODS
+
+    /// Write the string representation of the specified enumeration `value`
+    /// to the specified output `stream`, and return a reference to
+    /// `stream`.  Optionally specify an initial indentation `level`, whose
+    /// absolute value is incremented recursively for nested objects.  If
+    /// `level` is specified, optionally specify `spacesPerLevel`, whose
+    /// absolute value indicates the number of spaces per indentation level
+    /// for this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative, format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`) value.  See
+    /// `toAscii` for what constitutes the string representation of a
+    /// `FlushPolicyMode::Enum` value.
+    static bsl::ostream& print(bsl::ostream&         stream,
+                               FlushPolicyMode::Enum value,
+                               int                   level          = 0,
+                               int                   spacesPerLevel = 4);
+
+    /// Return the non-modifiable string representation corresponding to the
+    /// specified enumeration `value`, if it exists, and a unique (error)
+    /// string otherwise.  The string representation of `value` matches its
+    /// corresponding enumerator name with the `e_` prefix elided.
+    static const char* toAscii(FlushPolicyMode::Enum value);
+};
+
+// FREE OPERATORS
+
+/// Format the specified `value` to the specified output `stream` and return
+/// a reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, FlushPolicyMode::Enum value);
+
+// =================
+// class FlushPolicy
+// =================
+
+/// Mechanism deciding when to flush coalesced writes.
+class FlushPolicy {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Duration (in nanoseconds) of the window over which the rate of
+    /// messages is measured in `e_ADAPTIVE` mode.
+    static const bsls::Types::Int64 k_RATE_WINDOW_NS = 100 * 1000 * 1000;
+
+  private:
+    // DATA
+    FlushPolicyMode::Enum d_mode;
+    // Mode of this policy
+
+    int d_maxBytes;
+    // Number of pending bytes triggering a flush
+    // when coalescing
+
+    bsls::Types::Int64 d_maxDelayNs;
+    // Maximum time (in nanoseconds) a message is
+    // held when coalescing
+
+    bsls::Types::Int64 d_rateThreshold;
+    // Rate (messages per second) at which an
+    // 'e_ADAPTIVE' policy starts coalescing
+
+    bool d_isCoalescing;
+    // Whether messages are currently being
+    // coalesced
+
+    bool d_hasPending;
+    // Whether messages were added since the last
+    // flush
+
+    bsls::Types::Int64 d_firstPendingTime;
+    // Time (in nanoseconds) at which the oldest
+    // pending message was added
+
+    bsls::Types::Int64 d_windowStartTime;
+    // Time (in nanoseconds) at which the current
+    // rate measurement window started
+
+    bsls::Types::Int64 d_windowCount;
+    // Number of messages added during the current
+    // rate measurement window
+
+    bsls::Types::Int64 d_rate;
+    // Rate (messages per second) measured over
+    // the last complete window
+
+  public:
+    // CREATORS
+
+    /// Create a `FlushPolicy` having the specified `mode`, coalescing up to
+    /// the specified `maxBytes` bytes for at most the specified
+    /// `maxDelayNs` nanoseconds, and, if `mode` is `e_ADAPTIVE`, starting
+    /// to coalesce once the rate of messages reaches the specified
+    /// `rateThreshold` per second.  The behavior is undefined unless
+    /// `0 < maxBytes`, `0 <= maxDelayNs` and `0 <= rateThreshold`.
+    FlushPolicy(FlushPolicyMode::Enum mode,
+                int                   maxBytes,
+                bsls::Types::Int64    maxDelayNs,
+                bsls::Types::Int64    rateThreshold);
+
+    // MANIPULATORS
+
+    /// Record that a message was added to the buffer at the specified
+    /// `now` time (in nanoseconds).
+    void onItem(bsls::Types::Int64 now);
+
+    /// Record that the buffer was flushed.
+    void onFlushed();
+
+    // ACCESSORS
+
+    /// Return `true` if a buffer having the specified `pendingBytes` should
+    /// be flushed at the specified `now` time (in nanoseconds), and `false`
+    /// if it should be held until `deadline()`.
+    bool shouldFlush(int pendingBytes, bsls::Types::Int64 now) const;
+
+    /// Return the time (in nanoseconds) at which the pending messages must
+    /// be flushed.  The behavior is undefined unless `hasPending()`.
+    bsls::Types::Int64 deadline() const;
+
+    /// Return `true` if messages were added since the last flush.
+    bool hasPending() const;
+
+    /// Return `true` if messages are currently being coalesced.
+    bool isCoalescing() const;
+
+    /// Return the mode of this policy.
+    FlushPolicyMode::Enum mode() const;
+
+    /// Return the number of pending bytes triggering a flush when
+    /// coalescing.
+    int maxBytes() const;
+
+    /// Return the rate (messages per second) measured over the last
+    /// complete window, or 0 unless the mode is `e_ADAPTIVE`.
+    bsls::Types::Int64 rate() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------
+// class FlushPolicy
+// -----------------
+
+// MANIPULATORS
+inline void FlushPolicy::onFlushed()
+{
+    d_hasPending = false;
+}
+
+// ACCESSORS
+inline bool FlushPolicy::shouldFlush(int                pendingBytes,
+                                     bsls::Types::Int64 now) const
+{
+    if (!d_isCoalescing || !d_hasPending) {
+        return true;  // RETURN
+    }
+
+    return pendingBytes >= d_maxBytes ||
+           now - d_firstPendingTime >= d_maxDelayNs;
+}
+
+inline bsls::Types::Int64 FlushPolicy::deadline() const
+{
+    return d_firstPendingTime + d_maxDelayNs;
+}
+
+inline bool FlushPolicy::hasPending() const
+{
+    return d_hasPending;
+}
+
+inline bool FlushPolicy::isCoalescing() const
+{
+    return d_isCoalescing;
+}
+
+inline FlushPolicyMode::Enum FlushPolicy::mode() const
+{
+    return d_mode;
+}
+
+inline int FlushPolicy::maxBytes() const
+{
+    return d_maxBytes;
+}
+
+inline bsls::Types::Int64 FlushPolicy::rate() const
+{
+    return d_rate;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,237 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbu_flushpolicy.t.cpp                                             -*-C++-*-
+#include <mqbu_flushpolicy.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Add the specified `count` messages to the specified `policy`, evenly
+/// spread over one rate measurement window starting at the specified
+/// `now`, then advance `now` to the end of that window and flush.
+void addOverWindow(mqbu::FlushPolicy*  policy,
+                   bsls::Types::Int64* now,
+                   int                 count)
+{
+    const bsls::Types::Int64 k_WINDOW_NS =
+        mqbu::FlushPolicy::k_RATE_WINDOW_NS;
+
+    for (int i = 1; i <= count; ++i) {
+        policy->onItem(*now + i * k_WINDOW_NS / count);
+    }
+
+    *now += k_WINDOW_NS;
+    policy->onFlushed();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   1. Verify a policy in 'e_LATENCY' mode flushes at every opportunity.
+//   2. Verify the string representation of the modes.
+//
+// Testing:
+//   Basic functionality
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbu::FlushPolicy policy(mqbu::FlushPolicyMode::e_LATENCY, 1024, 1000, 0);
+
+    ASSERT_EQ(policy.maxBytes(), 1024);
+    ASSERT_EQ(policy.mode(), mqbu::FlushPolicyMode::e_LATENCY);
+    ASSERT(!policy.isCoalescing());
+    ASSERT(!policy.hasPending());
+    ASSERT(policy.shouldFlush(0, 0));
+
+    policy.onItem(10);
+    ASSERT(policy.hasPending());
+    ASSERT(policy.shouldFlush(1, 10));
+
+    policy.onFlushed();
+    ASSERT(!policy.hasPending());
+
+    mwcu::MemOutStream os(s_allocator_p);
+    os << mqbu::FlushPolicyMode::e_ADAPTIVE;
+    ASSERT_EQ(os.str(), "ADAPTIVE");
+}
+
+static void test2_throughput()
+// ------------------------------------------------------------------------
+// THROUGHPUT
+//
+// Concerns:
+//   In 'e_THROUGHPUT' mode, messages are held until either the byte or the
+//   time budget is exhausted.
+//
+// Plan:
+//   1. Add a message and verify it is held while under both budgets.
+//   2. Verify it is released once the byte budget is reached.
+//   3. Verify it is released once the time budget is reached.
+//
+// Testing:
+//   onItem
+//   shouldFlush
+//   deadline
+{
+    mwctst::TestHelper::printTestName("THROUGHPUT");
+
+    const int                k_MAX_BYTES    = 1024;
+    const bsls::Types::Int64 k_MAX_DELAY_NS = 1000;
+
+    mqbu::FlushPolicy policy(mqbu::FlushPolicyMode::e_THROUGHPUT,
+                             k_MAX_BYTES,
+                             k_MAX_DELAY_NS,
+                             0);
+
+    ASSERT(policy.isCoalescing());
+
+    // Nothing pending, nothing to hold
+    ASSERT(policy.shouldFlush(0, 0));
+
+    policy.onItem(100);
+    policy.onItem(200);
+    ASSERT_EQ(policy.deadline(), 100 + k_MAX_DELAY_NS);
+
+    ASSERT(!policy.shouldFlush(k_MAX_BYTES - 1, 100 + k_MAX_DELAY_NS - 1));
+    ASSERT(policy.shouldFlush(k_MAX_BYTES, 100));
+    ASSERT(policy.shouldFlush(1, 100 + k_MAX_DELAY_NS));
+
+    // Flushing restarts the time budget at the next message
+    policy.onFlushed();
+    policy.onItem(5000);
+    ASSERT_EQ(policy.deadline(), 5000 + k_MAX_DELAY_NS);
+    ASSERT(!policy.shouldFlush(1, 5001));
+}
+
+static void test3_adaptive()
+// ------------------------------------------------------------------------
+// ADAPTIVE
+//
+// Concerns:
+//   In 'e_ADAPTIVE' mode, the policy starts coalescing once the rate of
+//   messages reaches the threshold, and stops when it drops below half of
+//   the threshold.
+//
+// Plan:
+//   1. Add messages at a rate below the threshold and verify the policy
+//      does not coalesce.
+//   2. Add messages at a rate above the threshold and verify the policy
+//      coalesces.
+//   3. Add messages at a rate between half the threshold and the threshold
+//      and verify the policy keeps coalescing.
+//   4. Add messages at a rate below half the threshold and verify the
+//      policy stops coalescing.
+//
+// Testing:
+//   onItem
+//   isCoalescing
+//   rate
+{
+    mwctst::TestHelper::printTestName("ADAPTIVE");
+
+    const bsls::Types::Int64 k_WINDOW_NS =
+        mqbu::FlushPolicy::k_RATE_WINDOW_NS;
+    const bsls::Types::Int64 k_THRESHOLD = 1000;  // per second
+
+    mqbu::FlushPolicy policy(mqbu::FlushPolicyMode::e_ADAPTIVE,
+                             1024,
+                             1000,
+                             k_THRESHOLD);
+
+    ASSERT(!policy.isCoalescing());
+
+    bsls::Types::Int64 now = k_WINDOW_NS;
+
+    // Close the initial window
+    policy.onItem(now);
+
+    PVV("Low rate");
+    addOverWindow(&policy, &now, 50);  // 500 per second
+    ASSERT_EQ(policy.rate(), 500);
+    ASSERT(!policy.isCoalescing());
+    ASSERT(policy.shouldFlush(1, now));
+
+    PVV("High rate");
+    addOverWindow(&policy, &now, 200);  // 2000 per second
+    ASSERT_EQ(policy.rate(), 2000);
+    ASSERT(policy.isCoalescing());
+    policy.onItem(now + 1);
+    ASSERT(!policy.shouldFlush(1, now + 2));
+    policy.onFlushed();
+
+    PVV("Rate between half the threshold and the threshold");
+    addOverWindow(&policy, &now, 70);  // 700 per second
+    ASSERT(policy.isCoalescing());
+
+    PVV("Rate below half the threshold");
+    addOverWindow(&policy, &now, 20);  // 200 per second
+    ASSERT(!policy.isCoalescing());
+
+    PVV("Idle period");
+    addOverWindow(&policy, &now, 200);
+    ASSERT(policy.isCoalescing());
+    now += 10 * k_WINDOW_NS;
+    policy.onItem(now);
+    ASSERT(!policy.isCoalescing());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_adaptive(); break;
+    case 2: test2_throughput(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -145,6 +145,14 @@ class LoadBalancer {
     /// client must be preserved and restored.
     void setProcessorForClient(const TYPE* client, int processorId);
 
+    /// Associate the specified `client` with the specified `processorId`
+    /// instead of its current processor, updating the number of clients of
+    /// both processors.  The behaviour is undefined unless
+    /// `0 <= processorId < processorsCount()` and `client` is currently
+    /// associated with a processor.  This method is useful to rebalance
+    /// clients across processors after their initial association.
+    void moveClient(const TYPE* client, int processorId);
+
     /// Remove the association of the specified `client` with its processor.
     /// This method has no effect if `client` is not associated with any
     /// processor.
@@ -162,6 +170,10 @@ class LoadBalancer {
     /// `processorId`.  The behavior is undefined unless '0 <= processorId <
     /// processorsCount()'.
     int clientsCountForProcessor(int processorId) const;
+
+    /// Return the processorId associated to the specified `client`, or -1
+    /// if `client` is not associated with any processor.
+    int processorForClient(const TYPE* client) const;
 };
 
 // ============================================================================
@@ -232,6 +244,24 @@ void LoadBalancer<TYPE>::setProcessorForClient(const TYPE* client,
     d_clients[client] = processorId;
 }
 
+template <class TYPE>
+void LoadBalancer<TYPE>::moveClient(const TYPE* client, int processorId)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= processorId && processorId < processorsCount());
+
+    typename ClientMap::iterator it = d_clients.find(client);
+    BSLS_ASSERT_SAFE(it != d_clients.end());
+
+    // Move the client and its contribution to the counters to the new
+    // processor.
+    d_counters[it->second] -= 1;
+    d_counters[processorId] += 1;
+    it->second = processorId;
+}
+
 template <class TYPE>
 void LoadBalancer<TYPE>::removeClient(const TYPE* client)
 {
@@ -273,6 +303,15 @@ int LoadBalancer<TYPE>::clientsCountForProcessor(int processorId) const
     return d_counters[processorId];
 }
 
+template <class TYPE>
+int LoadBalancer<TYPE>::processorForClient(const TYPE* client) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    typename ClientMap::const_iterator it = d_clients.find(client);
+    return it == d_clients.end() ? -1 : it->second;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
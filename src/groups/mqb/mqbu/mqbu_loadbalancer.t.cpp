@@ -227,6 +227,49 @@ static void test4_forceAssociate()
         obj.setProcessorForClient(reinterpret_cast<MyDummyType*>(4), -1));
 }
 
+static void test5_moveClient()
+{
+    mwctst::TestHelper::printTestName("MOVE CLIENT");
+
+    const int                       k_NUM_PROCESSORS = 3;
+    mqbu::LoadBalancer<MyDummyType> obj(k_NUM_PROCESSORS, s_allocator_p);
+
+    MyDummyType* client = reinterpret_cast<MyDummyType*>(1);
+
+    PV(":: Unknown client has no processor");
+    ASSERT_EQ(obj.processorForClient(client), -1);
+
+    PV(":: Assign client '1' to processor '0'");
+    obj.setProcessorForClient(client, 0);
+    ASSERT_EQ(obj.processorForClient(client), 0);
+
+    PV(":: Move client '1' to processor '2'");
+    obj.moveClient(client, 2);
+    ASSERT_EQ(obj.processorForClient(client), 2);
+    ASSERT_EQ(obj.getProcessorForClient(client), 2);
+    ASSERT_EQ(obj.clientsCount(), 1);
+    ASSERT_EQ(obj.clientsCountForProcessor(0), 0);
+    ASSERT_EQ(obj.clientsCountForProcessor(1), 0);
+    ASSERT_EQ(obj.clientsCountForProcessor(2), 1);
+
+    PV(":: New clients are balanced against the moved client");
+    ASSERT_NE(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(2)),
+              2);
+    ASSERT_NE(obj.getProcessorForClient(reinterpret_cast<MyDummyType*>(3)),
+              2);
+    ensureIsBalanced(obj);
+
+    PV(":: Removing the moved client updates its new processor");
+    obj.removeClient(client);
+    ASSERT_EQ(obj.processorForClient(client), -1);
+    ASSERT_EQ(obj.clientsCountForProcessor(2), 0);
+
+    PV(":: Testing 'moveClient' with invalid processor");
+    obj.setProcessorForClient(client, 0);
+    ASSERT_OPT_FAIL(obj.moveClient(client, k_NUM_PROCESSORS));
+    ASSERT_OPT_FAIL(obj.moveClient(client, -1));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -237,6 +280,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_moveClient(); break;
     case 4: test4_forceAssociate(); break;
     case 3: test3_loadBalancing(); break;
     case 2: test2_singleProcessorLoadBalancer(); break;
@@ -215,8 +215,9 @@ class MonitoredQueue {
     /// Increment `d_queueLength` and report if necessary
     void incrementLength();
 
-    /// Decrement `d_queueLength` and report if necessary
-    void decrementLength();
+    /// Decrement `d_queueLength` by the optionally specified `count` and
+    /// report if necessary
+    void decrementLength(int count = 1);
 
   private:
     // NOT IMPLEMENTED
@@ -299,6 +300,14 @@ class MonitoredQueue {
     /// was empty.  On failure, `value` is not changed.
     int tryPopFront(ElementType* value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumValues` elements from the front of this queue and load them
+    /// into the array starting at the specified `buffer`.  Return the
+    /// number of elements removed, which is 0 if the queue was empty.  Note
+    /// that only some queues, such as `mwcc::MpscRingQueue`, remove the
+    /// elements in a single batch; others remove them one at a time.
+    int tryPopFrontBatch(ElementType* buffer, int maxNumValues);
+
     /// Pop an element from the front of the queue into the specified
     /// `buffer`.  Block if there are no elements in the queue, up to the
     /// specified `timeout` *absolute* time.  Return 0 if an item was
@@ -424,9 +433,9 @@ inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength()
+inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength(int count)
 {
-    const bsls::Types::Int64 newLength = --d_queueLength;
+    const bsls::Types::Int64 newLength = (d_queueLength -= count);
 
     if (d_state > MonitoredQueueState::e_NORMAL &&
         newLength <= d_lowWatermark) {
@@ -634,6 +643,22 @@ MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(ElementType* buffer)
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFrontBatch(
+    ElementType* buffer,
+    int          maxNumValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+
+    const int count = Traits::tryPopFrontBatch(&d_queue, buffer, maxNumValues);
+    if (count != 0) {
+        decrementLength(count);
+    }
+
+    return count;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::popFront(ElementType* value)
 {
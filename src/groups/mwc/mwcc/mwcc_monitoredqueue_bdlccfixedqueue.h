@@ -78,6 +78,15 @@ struct MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> > {
     /// non-zero value otherwise.  See the documentation of
     /// `bdlcc::FixedQueue` for more details.
     static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Remove, without blocking, up to the specified `maxNumElements` from
+    /// the front of the specified `queue` and load them into the array
+    /// starting at the specified `buffer`.  Return the number of elements
+    /// removed.  Note that `bdlcc::FixedQueue` does not support batch
+    /// removal, so elements are removed one at a time.
+    static int tryPopFrontBatch(QueueType*   queue,
+                                ElementType* buffer,
+                                int          maxNumElements);
 };
 
 // ============================================================================
@@ -126,6 +135,20 @@ inline int MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> >::popFront(
     return 0;
 }
 
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> >::tryPopFrontBatch(
+    QueueType*   queue,
+    ElementType* buffer,
+    int          maxNumElements)
+{
+    int count = 0;
+    while (count < maxNumElements && queue->tryPopFront(buffer + count) == 0) {
+        ++count;
+    }
+
+    return count;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
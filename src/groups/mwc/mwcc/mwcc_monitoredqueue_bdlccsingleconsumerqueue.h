@@ -80,6 +80,15 @@ struct MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> > {
     /// non-zero value otherwise.  See the documentation of
     /// `bdlcc::SingleConsumerQueue` for more details.
     static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Remove, without blocking, up to the specified `maxNumElements` from
+    /// the front of the specified `queue` and load them into the array
+    /// starting at the specified `buffer`.  Return the number of elements
+    /// removed.  Note that `bdlcc::SingleConsumerQueue` does not support batch
+    /// removal, so elements are removed one at a time.
+    static int tryPopFrontBatch(QueueType*   queue,
+                                ElementType* buffer,
+                                int          maxNumElements);
 };
 
 // ============================================================================
@@ -131,6 +140,21 @@ MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> >::enablePushBack(
     queue->enablePushBack();
 }
 
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> >::tryPopFrontBatch(
+    QueueType*   queue,
+    ElementType* buffer,
+    int          maxNumElements)
+{
+    int count = 0;
+    while (count < maxNumElements && queue->tryPopFront(buffer + count) == 0) {
+        ++count;
+    }
+
+    return count;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
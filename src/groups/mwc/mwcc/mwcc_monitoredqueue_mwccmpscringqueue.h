@@ -0,0 +1,143 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_monitoredqueue_mwccmpscringqueue.h                            -*-C++-*-
+#ifndef INCLUDED_MWCC_MONITOREDQUEUE_MWCCMPSCRINGQUEUE
+#define INCLUDED_MWCC_MONITOREDQUEUE_MWCCMPSCRINGQUEUE
+
+//@PURPOSE: Provide 'MonitoredQueueTraits' for 'mwcc::MpscRingQueue'.
+//
+//@CLASSES:
+//  MonitoredQueueTraits: specialization for 'mwcc::MpscRingQueue'
+//
+//@SEE_ALSO: mwcc_monitoredqueue, mwcc_mpscringqueue
+//
+//@DESCRIPTION: This component defines a partial specialization of
+// 'mwcc::MonitoredQueueTraits' that interfaces 'mwcc::MonitoredQueue' with
+// 'mwcc::MpscRingQueue'.  The traits forward
+// 'mwcc::MonitoredQueue::tryPopFrontBatch' to the batched dequeue of the
+// ring, which publishes the new head of the queue only once per batch.
+
+// MWC
+#include <mwcc_monitoredqueue.h>
+#include <mwcc_mpscringqueue.h>
+
+// BDE
+#include <bslma_allocator.h>
+
+namespace BloombergLP {
+
+namespace mwcc {
+
+// ======================================================
+// struct MonitoredQueueTraits< MpscRingQueue<ELEMENT> >
+// ======================================================
+
+/// This specialization provides the types and functions necessary to
+/// interface a `mwcc::MonitoredQueue` with a `mwcc::MpscRingQueue`.
+template <typename ELEMENT>
+struct MonitoredQueueTraits<MpscRingQueue<ELEMENT> > {
+    // PUBLIC TYPES
+    typedef ELEMENT                ElementType;
+    typedef int                    InitialCapacityType;
+    typedef MpscRingQueue<ELEMENT> QueueType;
+
+    // CLASS METHODS
+
+    /// Return the maximum number of elements that may be stored in the
+    /// specified `queue`.
+    static int capacity(const QueueType& queue);
+
+    /// Return `true` if the specified `queue` is enqueue disabled, and
+    /// `false` otherwise.
+    static bool isPushBackDisabled(const QueueType& queue);
+
+    /// Disable enqueuing into the specified `queue`.
+    static void disablePushBack(QueueType* queue);
+
+    /// Enable enqueuing into the specified `queue`.
+    static void enablePushBack(QueueType* queue);
+
+    /// Remove the element from the front of the specified `queue` and load
+    /// that element into the specified `buffer`, blocking until the queue
+    /// is not empty.  Return 0 on success, and a non-zero value otherwise.
+    static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Remove, without blocking, up to the specified `maxNumElements` from
+    /// the front of the specified `queue` and load them into the array
+    /// starting at the specified `buffer`.  Return the number of elements
+    /// removed.
+    static int tryPopFrontBatch(QueueType*   queue,
+                                ElementType* buffer,
+                                int          maxNumElements);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------------------------------------
+// struct MonitoredQueueTraits< MpscRingQueue<ELEMENT> >
+// ------------------------------------------------------
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::capacity(
+    const QueueType& queue)
+{
+    return queue.capacity();
+}
+
+template <typename ELEMENT>
+inline bool MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::isPushBackDisabled(
+    const QueueType& queue)
+{
+    return queue.isPushBackDisabled();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::disablePushBack(
+    QueueType* queue)
+{
+    queue->disablePushBack();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::enablePushBack(
+    QueueType* queue)
+{
+    queue->enablePushBack();
+}
+
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::popFront(QueueType*   queue,
+                                                        ElementType* buffer)
+{
+    return queue->popFront(buffer);
+}
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<MpscRingQueue<ELEMENT> >::tryPopFrontBatch(
+    QueueType*   queue,
+    ElementType* buffer,
+    int          maxNumElements)
+{
+    return queue->tryPopFrontBatch(buffer, maxNumElements);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
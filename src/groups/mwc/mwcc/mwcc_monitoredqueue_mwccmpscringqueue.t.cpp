@@ -0,0 +1,196 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_monitoredqueue_mwccmpscringqueue.t.cpp                        -*-C++-*-
+#include <mwcc_monitoredqueue_mwccmpscringqueue.h>
+
+// MWC
+#include <mwcc_mpscringqueue.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mwcc::MonitoredQueue<mwcc::MpscRingQueue<int> > Queue;
+
+/// Append the specified `state` to the specified `states`.
+void recordState(bsl::vector<mwcc::MonitoredQueueState::Enum>* states,
+                 mwcc::MonitoredQueueState::Enum               state)
+{
+    states->push_back(state);
+}
+
+}  // close unnamed namespace
+
+// Check that all member functions can be instantiated.
+
+namespace BloombergLP {
+namespace mwcc {
+
+template class MonitoredQueue<MpscRingQueue<int> >;
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// MONITORED MPSC RING QUEUE - BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MONITORED MPSC RING QUEUE "
+                                      "- BREATHING TEST");
+
+    const int k_QUEUE_SIZE = 8;
+
+    Queue queue(k_QUEUE_SIZE, s_allocator_p);
+
+    ASSERT_EQ(queue.capacity(), k_QUEUE_SIZE);
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.isEmpty(), true);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
+
+    ASSERT_EQ(queue.pushBack(1), 0);
+    ASSERT_EQ(queue.tryPushBack(2), 0);
+    ASSERT_EQ(queue.numElements(), 2);
+    ASSERT_EQ(queue.isEmpty(), false);
+
+    int item = -1;
+    ASSERT_EQ(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, 1);
+    ASSERT_EQ(queue.numElements(), 1);
+
+    ASSERT_EQ(queue.popFront(&item), 0);
+    ASSERT_EQ(item, 2);
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.isEmpty(), true);
+
+    queue.disablePushBack();
+    ASSERT_NE(queue.tryPushBack(3), 0);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
+    queue.enablePushBack();
+    ASSERT_EQ(queue.tryPushBack(3), 0);
+
+    queue.reset();
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.isEmpty(), true);
+}
+
+static void test2_watermarksAndBatch()
+// ------------------------------------------------------------------------
+// MONITORED MPSC RING QUEUE - WATERMARKS AND BATCH
+//
+// Concerns:
+//   - Filling the bounded ring reports 'e_QUEUE_FILLED'.
+//   - Popping a batch of elements updates the length of the queue by the
+//     number of popped elements, and reports 'e_NORMAL' once it reaches
+//     the low watermark.
+//
+// Testing:
+//   tryPopFrontBatch
+//   setWatermarks
+//   setStateCallback
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MONITORED MPSC RING QUEUE "
+                                      "- WATERMARKS AND BATCH");
+
+    const int k_QUEUE_SIZE      = 8;
+    const int k_LOW_WATERMARK   = 2;
+    const int k_HIGH_WATERMARK  = 4;
+    const int k_HIGH_WATERMARK2 = 6;
+
+    bsl::vector<mwcc::MonitoredQueueState::Enum> states(s_allocator_p);
+
+    Queue queue(k_QUEUE_SIZE, s_allocator_p);
+    queue.setWatermarks(k_LOW_WATERMARK, k_HIGH_WATERMARK, k_HIGH_WATERMARK2)
+        .setStateCallback(bdlf::BindUtil::bind(&recordState,
+                                               &states,
+                                               bdlf::PlaceHolders::_1));
+
+    for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+        ASSERT_EQ_D(i, queue.tryPushBack(i), 0);
+    }
+    ASSERT_NE(queue.tryPushBack(k_QUEUE_SIZE), 0);
+    ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_QUEUE_FILLED);
+
+    ASSERT_EQ(states.size(), 3U);
+    ASSERT_EQ(states[0], mwcc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED);
+    ASSERT_EQ(states[1],
+              mwcc::MonitoredQueueState::e_HIGH_WATERMARK_2_REACHED);
+    ASSERT_EQ(states[2], mwcc::MonitoredQueueState::e_QUEUE_FILLED);
+
+    int buffer[k_QUEUE_SIZE];
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, 5), 5);
+    ASSERT_EQ(queue.numElements(), 3);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_QUEUE_FILLED);
+
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer + 5, k_QUEUE_SIZE), 3);
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.state(), mwcc::MonitoredQueueState::e_NORMAL);
+    ASSERT_EQ(states.size(), 4U);
+    ASSERT_EQ(states[3], mwcc::MonitoredQueueState::e_NORMAL);
+
+    for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+        ASSERT_EQ_D(i, buffer[i], i);
+    }
+
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, k_QUEUE_SIZE), 0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_watermarksAndBatch(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
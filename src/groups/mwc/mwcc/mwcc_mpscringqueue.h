@@ -0,0 +1,766 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_mpscringqueue.h                                               -*-C++-*-
+#ifndef INCLUDED_MWCC_MPSCRINGQUEUE
+#define INCLUDED_MWCC_MPSCRINGQUEUE
+
+//@PURPOSE: Provide a lock-free multi-producer single-consumer ring queue.
+//
+//@CLASSES:
+//  mwcc::MpscRingQueue: lock-free MPSC ring buffer with an overflow list
+//
+//@SEE_ALSO: bdlcc_singleconsumerqueue, mwcc_monitoredqueue
+//
+//@DESCRIPTION: 'mwcc::MpscRingQueue' is a bounded, lock-free, FIFO queue
+// supporting any number of concurrent producers and exactly one consumer.
+// Storage is a power-of-two sized ring of slots allocated once at
+// construction, so that neither enqueuing nor dequeuing allocates memory.
+//
+// Each slot carries a sequence number which tells producers whether the slot
+// is free for the current lap of the ring, and tells the consumer whether the
+// slot has been published.  A producer claims a position with a single
+// compare-and-swap on the shared tail, constructs the element in place and
+// then publishes it by advancing the slot's sequence number.  The consumer
+// never performs an atomic read-modify-write on the fast path.
+//
+// Every slot, as well as the producer and consumer indices, is padded to a
+// cache line so that producers writing adjacent slots, and the consumer
+// advancing the head, do not invalidate each other's cache lines.  The price
+// is memory: a queue of capacity 'N' uses at least 'N' cache lines.
+//
+// The ring is *bounded*: 'tryPushBack' fails when the ring is full.
+// 'pushBack', on the other hand, never waits for the consumer: when the ring
+// is full, the element is appended to an unbounded overflow list protected by
+// a mutex, which the consumer drains once it has emptied the ring.  Until the
+// overflow list is drained, all subsequent elements also go to it, so that
+// the elements enqueued by a given producer are always consumed in order.
+// Because 'pushBack' never blocks, the consumer thread itself can safely
+// enqueue into a full queue.  Note that 'capacity' only describes the ring,
+// whereas 'numElements' and 'isEmpty' also account for the overflow list.
+//
+// The consumer may block in 'popFront'; in that case, it advertises itself as
+// waiting and the producer publishing the next element wakes it up.  The
+// consumer can also drain up to a given number of elements at once with
+// 'tryPopFrontBatch', which releases the slots one by one but publishes the
+// new head only once.  Elements of the overflow list are only consumed once
+// every claimed slot of the ring has been consumed.
+//
+/// Thread Safety
+///-------------
+// 'pushBack', 'tryPushBack', 'disablePushBack', 'enablePushBack' and all
+// accessors may be called concurrently from any number of threads.
+// 'popFront', 'tryPopFront', 'tryPopFrontBatch' and 'removeAll' must only be
+// called from a single (consumer) thread at a time.
+//
+/// Usage
+///-----
+//..
+//  mwcc::MpscRingQueue<int> queue(1024, allocator);
+//
+//  // Producer threads
+//  queue.pushBack(1);
+//
+//  // Consumer thread
+//  int buffer[32];
+//  const int numPopped = queue.tryPopFrontBatch(buffer, 32);
+//..
+
+// MWC
+
+// BDE
+#include <bsl_deque.h>
+#include <bsl_new.h>
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mwcc {
+
+// ===================
+// class MpscRingQueue
+// ===================
+
+/// Lock-free multi-producer single-consumer FIFO ring queue, spilling to an
+/// overflow list when the ring is full.
+template <class TYPE>
+class MpscRingQueue {
+  private:
+    // PRIVATE TYPES
+
+    /// Element storage with the sequence number driving its life cycle.
+    /// For the slot at ring index `i`, a sequence of `position` means the
+    /// slot is free for the producer claiming `position`, and a sequence of
+    /// `position + 1` means the element enqueued at `position` is ready to
+    /// be consumed.
+    struct Slot {
+        bsls::AtomicUint64       d_sequence;
+        bsls::ObjectBuffer<TYPE> d_value;
+    };
+
+    enum {
+        k_CACHE_LINE_SIZE = 64,
+        k_SLOT_SIZE       = (sizeof(Slot) + k_CACHE_LINE_SIZE - 1) /
+                      k_CACHE_LINE_SIZE * k_CACHE_LINE_SIZE
+    };
+
+    enum RcEnum {
+        // Return codes of the push operations
+        rc_SUCCESS  = 0,
+        rc_FULL     = -1,
+        rc_DISABLED = -2
+    };
+
+    // DATA
+    // Read-mostly fields, shared by producers and the consumer.
+
+    char* d_buffer_p;
+    // Memory allocated for the slots, including the
+    // slack needed to align them on a cache line
+
+    char* d_slots_p;
+    // Address of the first slot, aligned on a cache
+    // line
+
+    bsls::Types::Uint64 d_mask;
+    // Capacity minus one, used to map a position to a
+    // ring index
+
+    bsls::AtomicBool d_isPushBackDisabled;
+    // Whether enqueuing is currently disabled
+
+    bsls::AtomicBool d_isConsumerWaiting;
+    // Whether the consumer is (about to be) blocked in
+    // 'popFront' and needs to be woken up
+
+    bslmt::Semaphore d_consumerSemaphore;
+    // Semaphore the blocked consumer waits on
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator used to supply memory
+
+    bsls::AtomicInt d_numOverflow;
+    // Number of elements in 'd_overflow', read by the
+    // producers to decide whether to bypass the ring
+
+    bslmt::Mutex d_overflowMutex;
+    // Mutex protecting 'd_overflow'
+
+    bsl::deque<TYPE> d_overflow;
+    // Elements enqueued with 'pushBack' while the ring
+    // was full, or while this list was not empty
+
+    char d_tailPadding[k_CACHE_LINE_SIZE];
+
+    bsls::AtomicUint64 d_tail;
+    // Next position to be claimed by a producer
+
+    char d_headPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+    bsls::AtomicUint64 d_head;
+    // Next position to be consumed.  Only written by
+    // the consumer.
+
+    char d_endPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+  private:
+    // NOT IMPLEMENTED
+    MpscRingQueue(const MpscRingQueue&) BSLS_KEYWORD_DELETED;
+    MpscRingQueue& operator=(const MpscRingQueue&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the smallest power of two greater than or equal to the
+    /// specified `capacity`, and not smaller than 2.
+    static bsls::Types::Uint64 roundUpCapacity(int capacity);
+
+    // PRIVATE MANIPULATORS
+
+    /// Claim the next free position, load it into the specified `position`
+    /// and return the corresponding slot.  Return 0 if the queue is full.
+    Slot* claimSlot(bsls::Types::Uint64* position);
+
+    /// Make the element constructed in the specified `slot` at the
+    /// specified `position` visible to the consumer, and wake up the
+    /// consumer if it is blocked.
+    void publishSlot(Slot* slot, bsls::Types::Uint64 position);
+
+    /// Append the specified `value` to the overflow list, and wake up the
+    /// consumer if it is blocked.
+    void pushOverflow(const TYPE& value);
+
+    /// Append the specified move-insertable `value` to the overflow list,
+    /// and wake up the consumer if it is blocked.
+    void pushOverflow(bslmf::MovableRef<TYPE> value);
+
+    /// Wake up the consumer if it is blocked in `popFront`.
+    void wakeUpConsumer();
+
+    /// Remove up to the specified `maxNumValues` elements from the front of
+    /// the overflow list and load them, in order, into the array starting
+    /// at the specified `buffer`.  Return the number of elements removed.
+    int popOverflow(TYPE* buffer, int maxNumValues);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the slot corresponding to the specified `position`.
+    Slot* slotAt(bsls::Types::Uint64 position) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MpscRingQueue, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a queue able to hold at least the specified `capacity`
+    /// elements; the actual capacity is `capacity` rounded up to the next
+    /// power of two.  Use the optionally specified `basicAllocator` to
+    /// supply memory.  The behavior is undefined unless `0 < capacity`.
+    explicit MpscRingQueue(int capacity, bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object, destroying any element still in the queue.
+    ~MpscRingQueue();
+
+    // MANIPULATORS
+
+    /// Append the specified `value` to the back of this queue, spilling it
+    /// to the overflow list if the ring is full.  Return 0 on success, and
+    /// a non-zero value if the queue is disabled.  Note that this method
+    /// never waits for the consumer.
+    int pushBack(const TYPE& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// queue, spilling it to the overflow list if the ring is full.
+    /// `value` is left in a valid but unspecified state.  Return 0 on
+    /// success, and a non-zero value if the queue is disabled.  Note that
+    /// this method never waits for the consumer.
+    int pushBack(bslmf::MovableRef<TYPE> value);
+
+    /// Attempt to append the specified `value` to the ring of this queue.
+    /// Return 0 on success, and a non-zero value if the ring is full, the
+    /// overflow list is not empty, or the queue is disabled.
+    int tryPushBack(const TYPE& value);
+
+    /// Attempt to append the specified move-insertable `value` to the ring
+    /// of this queue.  `value` is left in a valid but unspecified state on
+    /// success, and unchanged on failure.  Return 0 on success, and a
+    /// non-zero value if the ring is full, the overflow list is not empty,
+    /// or the queue is disabled.
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+
+    /// Remove the element from the front of this queue and load that
+    /// element into the specified `value`.  If the queue is empty, block
+    /// until it is not empty.  Return 0 on success.
+    int popFront(TYPE* value);
+
+    /// Attempt to remove the element from the front of this queue without
+    /// blocking, and, if successful, load the specified `value` with the
+    /// removed element.  Return 0 on success, and a non-zero value if the
+    /// queue was empty.  On failure, `value` is not changed.
+    int tryPopFront(TYPE* value);
+
+    /// Remove, without blocking, up to the specified `maxNumValues`
+    /// elements from the front of this queue and load them, in order, into
+    /// the array starting at the specified `buffer`.  Return the number of
+    /// elements removed, which is 0 if the queue was empty.  The behavior
+    /// is undefined unless `buffer` has room for `maxNumValues` elements.
+    int tryPopFrontBatch(TYPE* buffer, int maxNumValues);
+
+    /// Remove and destroy all elements from this queue.
+    void removeAll();
+
+    /// Disable enqueuing into this queue.  All subsequent calls to
+    /// `pushBack` and `tryPushBack` fail immediately.
+    void disablePushBack();
+
+    /// Enable enqueuing into this queue.
+    void enablePushBack();
+
+    // ACCESSORS
+
+    /// Return the maximum number of elements that may be stored in the
+    /// ring of this queue.
+    int capacity() const;
+
+    /// Return `true` if this queue is empty (has no elements ready to be
+    /// consumed, neither in the ring nor in the overflow list), and `false`
+    /// otherwise.  Note that the value returned may be obsolete by the time
+    /// it is received.
+    bool isEmpty() const;
+
+    /// Return `true` if this queue holds at least `capacity` elements, and
+    /// `false` otherwise.  Note that the value returned may be obsolete by
+    /// the time it is received.
+    bool isFull() const;
+
+    /// Return `true` if enqueuing is disabled, and `false` otherwise.
+    bool isPushBackDisabled() const;
+
+    /// Return the number of elements currently in this queue, including
+    /// the ones being enqueued and the ones in the overflow list.  Note that
+    /// the value returned may be obsolete by the time it is received.
+    int numElements() const;
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator* allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class MpscRingQueue
+// -------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline bsls::Types::Uint64 MpscRingQueue<TYPE>::roundUpCapacity(int capacity)
+{
+    bsls::Types::Uint64 result = 2;
+    while (result < static_cast<bsls::Types::Uint64>(capacity)) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline typename MpscRingQueue<TYPE>::Slot*
+MpscRingQueue<TYPE>::claimSlot(bsls::Types::Uint64* position)
+{
+    bsls::Types::Uint64 current = d_tail.loadRelaxed();
+    while (true) {
+        Slot*                     slot     = slotAt(current);
+        const bsls::Types::Uint64 sequence = slot->d_sequence.loadAcquire();
+        const bsls::Types::Int64  distance = static_cast<bsls::Types::Int64>(
+            sequence - current);
+
+        if (distance == 0) {
+            // The slot is free for this lap: try to claim it.
+            const bsls::Types::Uint64 previous =
+                d_tail.testAndSwapAcqRel(current, current + 1);
+            if (previous == current) {
+                *position = current;
+                return slot;  // RETURN
+            }
+
+            current = previous;
+        }
+        else if (distance < 0) {
+            // The slot still holds the element from the previous lap.
+            return 0;  // RETURN
+        }
+        else {
+            // Another producer claimed 'current' already.
+            current = d_tail.loadRelaxed();
+        }
+    }
+}
+
+template <class TYPE>
+inline void MpscRingQueue<TYPE>::publishSlot(Slot*               slot,
+                                             bsls::Types::Uint64 position)
+{
+    // The sequentially consistent store below, paired with the one of the
+    // consumer in 'popFront', guarantees that either the consumer sees the
+    // published element, or we see that it is waiting.
+    slot->d_sequence = position + 1;
+
+    wakeUpConsumer();
+}
+
+template <class TYPE>
+void MpscRingQueue<TYPE>::pushOverflow(const TYPE& value)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        d_overflow.push_back(value);
+
+        // Sequentially consistent, as the store in 'publishSlot'.
+        ++d_numOverflow;
+    }  // UNLOCK
+
+    wakeUpConsumer();
+}
+
+template <class TYPE>
+void MpscRingQueue<TYPE>::pushOverflow(bslmf::MovableRef<TYPE> value)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        d_overflow.push_back(bslmf::MovableRefUtil::move(value));
+
+        // Sequentially consistent, as the store in 'publishSlot'.
+        ++d_numOverflow;
+    }  // UNLOCK
+
+    wakeUpConsumer();
+}
+
+template <class TYPE>
+inline void MpscRingQueue<TYPE>::wakeUpConsumer()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isConsumerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_isConsumerWaiting.testAndSwap(true, false)) {
+            d_consumerSemaphore.post();
+        }
+    }
+}
+
+template <class TYPE>
+int MpscRingQueue<TYPE>::popOverflow(TYPE* buffer, int maxNumValues)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+    int count = 0;
+    while (count < maxNumValues && !d_overflow.empty()) {
+        buffer[count] = bslmf::MovableRefUtil::move(d_overflow.front());
+        d_overflow.pop_front();
+        ++count;
+    }
+
+    d_numOverflow -= count;
+
+    return count;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline typename MpscRingQueue<TYPE>::Slot*
+MpscRingQueue<TYPE>::slotAt(bsls::Types::Uint64 position) const
+{
+    return reinterpret_cast<Slot*>(d_slots_p +
+                                   (position & d_mask) * k_SLOT_SIZE);
+}
+
+// CREATORS
+template <class TYPE>
+MpscRingQueue<TYPE>::MpscRingQueue(int               capacity,
+                                   bslma::Allocator* basicAllocator)
+: d_buffer_p(0)
+, d_slots_p(0)
+, d_mask(roundUpCapacity(capacity) - 1)
+, d_isPushBackDisabled(false)
+, d_isConsumerWaiting(false)
+, d_consumerSemaphore()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numOverflow(0)
+, d_overflowMutex()
+, d_overflow(d_allocator_p)
+, d_tail(0)
+, d_head(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(capacity > 0);
+
+    const bsls::Types::Uint64 numSlots = d_mask + 1;
+    d_buffer_p                         = static_cast<char*>(
+        d_allocator_p->allocate(numSlots * k_SLOT_SIZE + k_CACHE_LINE_SIZE));
+
+    const bsls::Types::UintPtr address =
+        reinterpret_cast<bsls::Types::UintPtr>(d_buffer_p);
+    d_slots_p = d_buffer_p +
+                (k_CACHE_LINE_SIZE - address % k_CACHE_LINE_SIZE) %
+                    k_CACHE_LINE_SIZE;
+
+    for (bsls::Types::Uint64 i = 0; i < numSlots; ++i) {
+        Slot* slot = new (slotAt(i)) Slot();
+        slot->d_sequence.storeRelaxed(i);
+    }
+}
+
+template <class TYPE>
+MpscRingQueue<TYPE>::~MpscRingQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::pushBack(const TYPE& value)
+{
+    const int rc = tryPushBack(value);
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(rc != rc_FULL)) {
+        return rc;  // RETURN
+    }
+
+    // The ring is full, or elements enqueued before this one are still in
+    // the overflow list: spill instead of waiting for the consumer, which may
+    // well be the calling thread.
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    pushOverflow(value);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
+{
+    TYPE&     object = bslmf::MovableRefUtil::access(value);
+    const int rc     = tryPushBack(bslmf::MovableRefUtil::move(object));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(rc != rc_FULL)) {
+        return rc;  // RETURN
+    }
+
+    // See the 'const TYPE&' overload; 'object' is left unchanged by the
+    // failed 'tryPushBack'.
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    pushOverflow(bslmf::MovableRefUtil::move(object));
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isPushBackDisabled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_DISABLED;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numOverflow.load() != 0)) {
+        // Preserve the order with respect to the elements spilled by
+        // 'pushBack'.
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_FULL;  // RETURN
+    }
+
+    bsls::Types::Uint64 position;
+    Slot*               slot = claimSlot(&position);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(slot == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_FULL;  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(slot->d_value.address(),
+                                       d_allocator_p,
+                                       value);
+    publishSlot(slot, position);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isPushBackDisabled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_DISABLED;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numOverflow.load() != 0)) {
+        // Preserve the order with respect to the elements spilled by
+        // 'pushBack'.
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_FULL;  // RETURN
+    }
+
+    bsls::Types::Uint64 position;
+    Slot*               slot = claimSlot(&position);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(slot == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_FULL;  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(slot->d_value.address(),
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(value));
+    publishSlot(slot, position);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::popFront(TYPE* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    while (tryPopFront(value) != 0) {
+        // Advertise that we are about to block, and check again: a producer
+        // which published before seeing the flag is caught by the second
+        // attempt, any other one will post the semaphore.
+        d_isConsumerWaiting = true;
+        if (tryPopFront(value) == 0) {
+            // A leftover 'post' from a producer racing with the line below
+            // only causes a spurious wake up of the next wait.
+            d_isConsumerWaiting = false;
+            return 0;  // RETURN
+        }
+
+        d_consumerSemaphore.wait();
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::tryPopFront(TYPE* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    return tryPopFrontBatch(value, 1) == 1 ? 0 : -1;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::tryPopFrontBatch(TYPE* buffer,
+                                                 int   maxNumValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(maxNumValues > 0);
+
+    const bsls::Types::Uint64 head     = d_head.loadRelaxed();
+    bsls::Types::Uint64       position = head;
+    int                       count    = 0;
+
+    while (count < maxNumValues) {
+        Slot* slot = slotAt(position);
+        if (slot->d_sequence.load() != position + 1) {
+            break;  // BREAK
+        }
+
+        TYPE& object  = slot->d_value.object();
+        buffer[count] = bslmf::MovableRefUtil::move(object);
+        bslma::DestructionUtil::destroy(&object);
+
+        // Hand the slot over to the producers of the next lap.
+        slot->d_sequence.storeRelease(position + d_mask + 1);
+
+        ++position;
+        ++count;
+    }
+
+    if (count != 0) {
+        d_head.storeRelease(position);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(count < maxNumValues &&
+                                              d_numOverflow.load() != 0)) {
+        // Only move on to the overflow list once every claimed slot has been
+        // consumed: a slot claimed but not yet published may hold an element
+        // enqueued before the ones of the overflow list.  The producer
+        // publishing it wakes us up if needed.
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_tail.loadAcquire() == position) {
+            count += popOverflow(buffer + count, maxNumValues - count);
+        }
+    }
+
+    return count;
+}
+
+template <class TYPE>
+void MpscRingQueue<TYPE>::removeAll()
+{
+    bsls::Types::Uint64 position = d_head.loadRelaxed();
+    while (true) {
+        Slot* slot = slotAt(position);
+        if (slot->d_sequence.loadAcquire() != position + 1) {
+            break;  // BREAK
+        }
+
+        bslma::DestructionUtil::destroy(slot->d_value.address());
+        slot->d_sequence.storeRelease(position + d_mask + 1);
+        ++position;
+    }
+
+    d_head.storeRelease(position);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+    d_overflow.clear();
+    d_numOverflow = 0;
+}
+
+template <class TYPE>
+inline void MpscRingQueue<TYPE>::disablePushBack()
+{
+    d_isPushBackDisabled = true;
+}
+
+template <class TYPE>
+inline void MpscRingQueue<TYPE>::enablePushBack()
+{
+    d_isPushBackDisabled = false;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+template <class TYPE>
+inline bool MpscRingQueue<TYPE>::isEmpty() const
+{
+    const bsls::Types::Uint64 head = d_head.loadAcquire();
+    return slotAt(head)->d_sequence.loadAcquire() != head + 1 &&
+           d_numOverflow.load() == 0;
+}
+
+template <class TYPE>
+inline bool MpscRingQueue<TYPE>::isFull() const
+{
+    return numElements() >= capacity();
+}
+
+template <class TYPE>
+inline bool MpscRingQueue<TYPE>::isPushBackDisabled() const
+{
+    return d_isPushBackDisabled;
+}
+
+template <class TYPE>
+inline int MpscRingQueue<TYPE>::numElements() const
+{
+    // Load 'head' first: it never moves past 'tail'.
+    const bsls::Types::Uint64 head = d_head.loadAcquire();
+    const bsls::Types::Uint64 tail = d_tail.loadAcquire();
+
+    return static_cast<int>(tail - head) + d_numOverflow.load();
+}
+
+template <class TYPE>
+inline bslma::Allocator* MpscRingQueue<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
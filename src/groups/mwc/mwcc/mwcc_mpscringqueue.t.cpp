@@ -0,0 +1,473 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_mpscringqueue.t.cpp                                           -*-C++-*-
+#include <mwcc_mpscringqueue.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslmf_movableref.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mwcc::MpscRingQueue<int> IntQueue;
+
+/// Enqueue the specified `numItems` on the specified `queue`, each value
+/// encoding the specified `producerId` in its upper bits and the sequence
+/// number of the item in its lower bits.
+void producerThread(IntQueue* queue, int producerId, int numItems)
+{
+    for (int i = 0; i < numItems; ++i) {
+        const int rc = queue->pushBack((producerId << 24) | i);
+        BSLS_ASSERT_OPT(rc == 0);
+        (void)rc;
+    }
+}
+
+/// Pop one item from the specified `queue`, store it in the specified
+/// `value` and post on the specified `done` semaphore.
+void blockingConsumerThread(IntQueue*         queue,
+                            int*              value,
+                            bslmt::Semaphore* done)
+{
+    queue->popFront(value);
+    done->post();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   MpscRingQueue(int capacity, bslma::Allocator *basicAllocator = 0);
+//   pushBack
+//   tryPushBack
+//   popFront
+//   tryPopFront
+//   disablePushBack
+//   enablePushBack
+//   capacity
+//   isEmpty
+//   isFull
+//   isPushBackDisabled
+//   numElements
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    PV("Capacity is rounded up to a power of two");
+    {
+        IntQueue queue(1, s_allocator_p);
+        ASSERT_EQ(queue.capacity(), 2);
+    }
+    {
+        IntQueue queue(5, s_allocator_p);
+        ASSERT_EQ(queue.capacity(), 8);
+    }
+
+    IntQueue queue(4, s_allocator_p);
+    ASSERT_EQ(queue.capacity(), 4);
+    ASSERT_EQ(queue.isEmpty(), true);
+    ASSERT_EQ(queue.isFull(), false);
+    ASSERT_EQ(queue.numElements(), 0);
+    ASSERT_EQ(queue.isPushBackDisabled(), false);
+
+    int item = -1;
+    ASSERT_NE(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, -1);
+
+    PV("Fill the queue");
+    ASSERT_EQ(queue.pushBack(1), 0);
+    ASSERT_EQ(queue.tryPushBack(2), 0);
+    ASSERT_EQ(queue.tryPushBack(3), 0);
+    ASSERT_EQ(queue.pushBack(4), 0);
+    ASSERT_EQ(queue.isEmpty(), false);
+    ASSERT_EQ(queue.isFull(), true);
+    ASSERT_EQ(queue.numElements(), 4);
+
+    ASSERT_NE(queue.tryPushBack(5), 0);
+    ASSERT_EQ(queue.numElements(), 4);
+
+    PV("Drain the queue");
+    ASSERT_EQ(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, 1);
+    ASSERT_EQ(queue.isFull(), false);
+    ASSERT_EQ(queue.popFront(&item), 0);
+    ASSERT_EQ(item, 2);
+    ASSERT_EQ(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, 3);
+    ASSERT_EQ(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, 4);
+    ASSERT_EQ(queue.isEmpty(), true);
+    ASSERT_EQ(queue.numElements(), 0);
+
+    PV("Disable and enable");
+    queue.disablePushBack();
+    ASSERT_EQ(queue.isPushBackDisabled(), true);
+    ASSERT_NE(queue.pushBack(6), 0);
+    ASSERT_NE(queue.tryPushBack(6), 0);
+    ASSERT_EQ(queue.isEmpty(), true);
+
+    queue.enablePushBack();
+    ASSERT_EQ(queue.isPushBackDisabled(), false);
+    ASSERT_EQ(queue.tryPushBack(7), 0);
+    ASSERT_EQ(queue.tryPopFront(&item), 0);
+    ASSERT_EQ(item, 7);
+}
+
+static void test2_wrapAround()
+// ------------------------------------------------------------------------
+// WRAP AROUND
+//
+// Concerns:
+//   - Slots are correctly reused when positions wrap around the ring many
+//     times.
+//   - Elements using an allocator are moved in and out of the ring, and the
+//     ones left in the queue are destroyed by 'removeAll' and the
+//     destructor.
+//
+// Testing:
+//   pushBack(bslmf::MovableRef<TYPE>)
+//   tryPushBack(bslmf::MovableRef<TYPE>)
+//   removeAll
+//   ~MpscRingQueue
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("WRAP AROUND");
+
+    const int k_NUM_LAPS = 1000;
+
+    {
+        PV("Many laps with a partially filled ring");
+        IntQueue queue(4, s_allocator_p);
+
+        int next = 0;
+        for (int i = 0; i < k_NUM_LAPS; ++i) {
+            ASSERT_EQ(queue.tryPushBack(i * 3), 0);
+            ASSERT_EQ(queue.tryPushBack(i * 3 + 1), 0);
+            ASSERT_EQ(queue.tryPushBack(i * 3 + 2), 0);
+
+            for (int j = 0; j < 3; ++j) {
+                int item = -1;
+                ASSERT_EQ(queue.tryPopFront(&item), 0);
+                ASSERT_EQ(item, next);
+                ++next;
+            }
+            ASSERT_EQ(queue.isEmpty(), true);
+        }
+    }
+
+    {
+        PV("Allocating elements");
+        mwcc::MpscRingQueue<bsl::string> queue(2, s_allocator_p);
+
+        const bsl::string k_LONG_STRING(100, 'x', s_allocator_p);
+
+        for (int i = 0; i < k_NUM_LAPS; ++i) {
+            bsl::string value(k_LONG_STRING, s_allocator_p);
+            ASSERT_EQ(queue.pushBack(bslmf::MovableRefUtil::move(value)), 0);
+
+            bsl::string other(k_LONG_STRING, s_allocator_p);
+            ASSERT_EQ(queue.tryPushBack(bslmf::MovableRefUtil::move(other)),
+                      0);
+
+            bsl::string item(s_allocator_p);
+            ASSERT_EQ(queue.tryPopFront(&item), 0);
+            ASSERT_EQ(item, k_LONG_STRING);
+
+            queue.removeAll();
+            ASSERT_EQ(queue.isEmpty(), true);
+            ASSERT_EQ(queue.numElements(), 0);
+        }
+
+        // Leave elements in the queue, for the destructor to destroy them.
+        ASSERT_EQ(queue.tryPushBack(k_LONG_STRING), 0);
+        ASSERT_EQ(queue.tryPushBack(k_LONG_STRING), 0);
+    }
+}
+
+static void test3_popFrontBatch()
+// ------------------------------------------------------------------------
+// POP FRONT BATCH
+//
+// Concerns:
+//   'tryPopFrontBatch' pops at most the requested number of elements, in
+//   order, and frees their slots for subsequent pushes.
+//
+// Testing:
+//   tryPopFrontBatch
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("POP FRONT BATCH");
+
+    IntQueue queue(8, s_allocator_p);
+    int      buffer[8];
+
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, 8), 0);
+
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_EQ(queue.tryPushBack(i), 0);
+    }
+    ASSERT_EQ(queue.isFull(), true);
+
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, 3), 3);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ_D(i, buffer[i], i);
+    }
+    ASSERT_EQ(queue.numElements(), 5);
+
+    // The released slots are available again.
+    for (int i = 8; i < 11; ++i) {
+        ASSERT_EQ(queue.tryPushBack(i), 0);
+    }
+    ASSERT_NE(queue.tryPushBack(11), 0);
+
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, 8), 8);
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_EQ_D(i, buffer[i], i + 3);
+    }
+    ASSERT_EQ(queue.isEmpty(), true);
+    ASSERT_EQ(queue.tryPopFrontBatch(buffer, 8), 0);
+}
+
+static void test4_multipleProducers()
+// ------------------------------------------------------------------------
+// MULTIPLE PRODUCERS
+//
+// Concerns:
+//   - No element is lost or duplicated when several producers enqueue
+//     concurrently on a small ring, forcing them to spill to the overflow
+//     list.
+//   - Elements from a given producer are dequeued in the order in which
+//     they were enqueued.
+//   - A consumer blocked in 'popFront' is woken up by a producer.
+//
+// Testing:
+//   pushBack
+//   popFront
+//   tryPopFrontBatch
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("MULTIPLE PRODUCERS");
+
+    const int k_NUM_PRODUCERS = 4;
+    const int k_NUM_ITEMS     = 100000;
+    const int k_BATCH_SIZE    = 16;
+
+    IntQueue           queue(64, s_allocator_p);
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        threadGroup.addThread(bdlf::BindUtil::bindS(s_allocator_p,
+                                                    &producerThread,
+                                                    &queue,
+                                                    i,
+                                                    k_NUM_ITEMS));
+    }
+
+    bsl::vector<int> nextSequence(k_NUM_PRODUCERS, 0, s_allocator_p);
+    int              buffer[k_BATCH_SIZE];
+    int              numReceived = 0;
+    bool             inOrder     = true;
+
+    while (numReceived < k_NUM_PRODUCERS * k_NUM_ITEMS) {
+        int numItems = queue.tryPopFrontBatch(buffer, k_BATCH_SIZE);
+        if (numItems == 0) {
+            queue.popFront(&buffer[0]);
+            numItems = 1;
+        }
+
+        for (int i = 0; i < numItems; ++i) {
+            const int producerId = buffer[i] >> 24;
+            const int sequence   = buffer[i] & 0xFFFFFF;
+
+            inOrder = inOrder && sequence == nextSequence[producerId];
+            nextSequence[producerId] = sequence + 1;
+        }
+        numReceived += numItems;
+    }
+
+    threadGroup.joinAll();
+
+    ASSERT_EQ(inOrder, true);
+    ASSERT_EQ(queue.isEmpty(), true);
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        ASSERT_EQ_D(i, nextSequence[i], k_NUM_ITEMS);
+    }
+
+    PV("Wake up a blocked consumer");
+    {
+        bslmt::Semaphore done;
+        int              item = -1;
+
+        threadGroup.addThread(bdlf::BindUtil::bindS(s_allocator_p,
+                                                    &blockingConsumerThread,
+                                                    &queue,
+                                                    &item,
+                                                    &done));
+
+        // Give the consumer a chance to block before pushing.
+        bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.1));
+        ASSERT_EQ(queue.pushBack(42), 0);
+
+        done.wait();
+        threadGroup.joinAll();
+        ASSERT_EQ(item, 42);
+    }
+}
+
+static void test5_overflow()
+// ------------------------------------------------------------------------
+// OVERFLOW
+//
+// Concerns:
+//   - 'pushBack' on a full ring does not wait for the consumer, so that the
+//     consumer thread itself can enqueue into its own full queue.
+//   - Elements spilled to the overflow list are consumed after the ones of
+//     the ring, in order, and 'tryPushBack' fails until the overflow list
+//     is drained.
+//   - Elements left in the overflow list are destroyed by 'removeAll' and
+//     the destructor.
+//
+// Testing:
+//   pushBack
+//   tryPushBack
+//   tryPopFrontBatch
+//   removeAll
+//   isEmpty
+//   numElements
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("OVERFLOW");
+
+    const int k_CAPACITY  = 4;
+    const int k_NUM_ITEMS = 4 * k_CAPACITY;
+
+    {
+        PV("Self-enqueue on a full ring from the consumer thread");
+        IntQueue queue(k_CAPACITY, s_allocator_p);
+        int      buffer[k_NUM_ITEMS];
+
+        for (int i = 0; i < k_CAPACITY; ++i) {
+            ASSERT_EQ(queue.tryPushBack(i), 0);
+        }
+        ASSERT_EQ(queue.isFull(), true);
+
+        // Would never return if 'pushBack' waited for the consumer.
+        for (int i = k_CAPACITY; i < k_NUM_ITEMS; ++i) {
+            ASSERT_EQ_D(i, queue.pushBack(i), 0);
+        }
+        ASSERT_EQ(queue.numElements(), k_NUM_ITEMS);
+
+        // Free a slot of the ring: 'tryPushBack' still fails, as it would
+        // otherwise overtake the spilled elements.
+        int item = -1;
+        ASSERT_EQ(queue.tryPopFront(&item), 0);
+        ASSERT_EQ(item, 0);
+        ASSERT_NE(queue.tryPushBack(k_NUM_ITEMS), 0);
+        ASSERT_EQ(queue.pushBack(k_NUM_ITEMS), 0);
+
+        // The ring is drained first, then the overflow list.
+        ASSERT_EQ(queue.tryPopFrontBatch(buffer, 2), 2);
+        ASSERT_EQ(buffer[0], 1);
+        ASSERT_EQ(buffer[1], 2);
+        ASSERT_EQ(queue.tryPopFrontBatch(buffer, k_NUM_ITEMS),
+                  k_NUM_ITEMS - 2);
+        for (int i = 0; i < k_NUM_ITEMS - 2; ++i) {
+            ASSERT_EQ_D(i, buffer[i], i + 3);
+        }
+        ASSERT_EQ(queue.isEmpty(), true);
+        ASSERT_EQ(queue.numElements(), 0);
+
+        // Back to the ring.
+        ASSERT_EQ(queue.tryPushBack(k_NUM_ITEMS + 1), 0);
+        ASSERT_EQ(queue.popFront(&item), 0);
+        ASSERT_EQ(item, k_NUM_ITEMS + 1);
+    }
+
+    {
+        PV("Allocating elements left in the overflow list");
+        mwcc::MpscRingQueue<bsl::string> queue(2, s_allocator_p);
+
+        const bsl::string k_LONG_STRING(100, 'x', s_allocator_p);
+
+        for (int i = 0; i < 4; ++i) {
+            bsl::string value(k_LONG_STRING, s_allocator_p);
+            ASSERT_EQ(queue.pushBack(bslmf::MovableRefUtil::move(value)), 0);
+        }
+        ASSERT_EQ(queue.numElements(), 4);
+
+        queue.removeAll();
+        ASSERT_EQ(queue.isEmpty(), true);
+        ASSERT_EQ(queue.numElements(), 0);
+
+        // Leave elements in both the ring and the overflow list, for the
+        // destructor to destroy them.
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_EQ(queue.pushBack(k_LONG_STRING), 0);
+        }
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_overflow(); break;
+    case 4: test4_multipleProducers(); break;
+    case 3: test3_popFrontBatch(); break;
+    case 2: test2_wrapAround(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -156,6 +156,7 @@
 // MWC
 
 #include <mwcc_monitoredqueue_bdlccsingleconsumerqueue.h>
+#include <mwcc_monitoredqueue_mwccmpscringqueue.h>
 #include <mwcu_printutil.h>
 
 // BDE
@@ -386,6 +387,8 @@ class MultiQueueThreadPoolConfig {
 
     typedef MonitoredQueue<bdlcc::SingleConsumerQueue<QueueItem> > Queue;
 
+    typedef MonitoredQueue<MpscRingQueue<QueueItem> > RingQueue;
+
     typedef MultiQueueThreadPool_QueueCreatorRet QueueCreatorRet;
 
     /// Create the queue for the specified `queueId` using the specified
@@ -395,12 +398,29 @@ class MultiQueueThreadPoolConfig {
         Queue*(QueueCreatorRet* ret, int queueId, bslma::Allocator* allocator)>
         QueueCreatorFn;
 
+    /// Create the bounded lock-free queue for the specified `queueId` using
+    /// the specified `allocator`.  Populate the specified `ret` with
+    /// additional options associated with the returned queue.
+    typedef bsl::function<RingQueue*(QueueCreatorRet*  ret,
+                                     int               queueId,
+                                     bslma::Allocator* allocator)>
+        RingQueueCreatorFn;
+
     /// Callback invoked when processing the specified `event` popped from
     /// the queue having the specified `queueId` and created with the
     /// specified `queueContext`.
     typedef bsl::function<void(int queueId, void* queueContext, Event* event)>
         EventFn;
 
+    /// Callback invoked when processing the specified `numEvents` user
+    /// `events`, consecutively popped from the queue having the specified
+    /// `queueId` and created with the specified `queueContext`.
+    typedef bsl::function<void(int     queueId,
+                               void*   queueContext,
+                               Event** events,
+                               int     numEvents)>
+        EventBatchFn;
+
     // FRIENDS
     template <typename T>
     friend class MultiQueueThreadPool;
@@ -426,12 +446,21 @@ class MultiQueueThreadPoolConfig {
 
     EventFn d_eventCallbackFn;
 
+    EventBatchFn d_eventBatchCallbackFn;
+    // Optional callback used instead of
+    // 'd_eventCallbackFn' to process runs of
+    // consecutive user events, if set
+
     CreatorFn d_objectCreatorFn;
 
     ResetterFn d_objectResetterFn;
 
     QueueCreatorFn d_queueCreatorFn;
 
+    RingQueueCreatorFn d_ringQueueCreatorFn;
+    // Optional creator of bounded lock-free queues,
+    // used instead of 'd_queueCreatorFn' if set
+
     bsl::string d_name;
 
     EventFinalizationType d_finalizeType;
@@ -516,6 +545,27 @@ class MultiQueueThreadPoolConfig {
     MultiQueueThreadPoolConfig<TYPE>&
     setMonitorAlarm(bslstl::StringRef         alarmString,
                     const bsls::TimeInterval& timeout);
+
+    /// Create the queues of the MQTP with the specified `ringQueueCreator`
+    /// instead of the queue creator provided at construction, and return a
+    /// reference offering modifiable access to this object.  Such queues
+    /// are lock-free rings (see `mwcc_mpscringqueue`): an event enqueued on
+    /// a full ring spills to an unbounded overflow list instead of waiting
+    /// for the processing thread, which may therefore enqueue on its own
+    /// queue, and the processing thread dequeues events in batches.
+    MultiQueueThreadPoolConfig<TYPE>&
+    setRingQueueCreator(const RingQueueCreatorFn& ringQueueCreator);
+
+    /// Process user events with the specified `eventBatchCallback` instead
+    /// of the event callback provided at construction, and return a
+    /// reference offering modifiable access to this object.  The processing
+    /// thread dequeues events in batches and hands each run of consecutive
+    /// `MWCC_USER` events of a batch to `eventBatchCallback` at once; all
+    /// other events (including the `MWCC_QUEUE_EMPTY` and
+    /// `MWCC_FINALIZE_EVENT` ones) are still delivered to the event
+    /// callback, one at a time.
+    MultiQueueThreadPoolConfig<TYPE>&
+    setEventBatchCallback(const EventBatchFn& eventBatchCallback);
 };
 
 // ==========================
@@ -533,12 +583,15 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     typedef MultiQueueThreadPoolConfig<TYPE> Config;
     typedef MultiQueueThreadPoolEvent<TYPE>  Event;
     typedef typename Config::QueueItem       QueueItem;
-    typedef typename Config::Queue           Queue;
-    typedef typename Config::CreatorFn       CreatorFn;
-    typedef typename Config::ResetterFn      ResetterFn;
-    typedef typename Config::QueueCreatorRet QueueCreatorRet;
-    typedef typename Config::QueueCreatorFn  QueueCreatorFn;
-    typedef typename Config::EventFn         EventFn;
+    typedef typename Config::Queue              Queue;
+    typedef typename Config::RingQueue          RingQueue;
+    typedef typename Config::CreatorFn          CreatorFn;
+    typedef typename Config::ResetterFn         ResetterFn;
+    typedef typename Config::QueueCreatorRet    QueueCreatorRet;
+    typedef typename Config::QueueCreatorFn     QueueCreatorFn;
+    typedef typename Config::RingQueueCreatorFn RingQueueCreatorFn;
+    typedef typename Config::EventFn            EventFn;
+    typedef typename Config::EventBatchFn       EventBatchFn;
 
   private:
     // PRIVATE TYPES
@@ -546,6 +599,11 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         ObjectPool<Event, CreatorFn, bdlcc::ObjectPoolFunctors::Reset<Event> >
             EventPool;
 
+    enum {
+        k_MAX_BATCH_SIZE = 32  // Maximum number of items popped at once
+                               // from a queue
+    };
+
     enum MonitorEventState {
         e_MONITOR_PENDING  // an event has been enqueued on the queue but the
                            // next 'processMonitorEvents' hasn't been called
@@ -562,7 +620,12 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     struct QueueInfo {
         // PUBLIC DATA
         Queue* d_queue_p;
-        // Pointer to the queue
+        // Pointer to the queue, unless it is a
+        // ring queue
+
+        RingQueue* d_ringQueue_p;
+        // Pointer to the queue, if it is a ring
+        // queue
 
         bsl::shared_ptr<void> d_context_p;
         // Pointer to context passed at
@@ -584,6 +647,7 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         // CREATORS
         QueueInfo(bslma::Allocator* basicAllocator = 0)
         : d_queue_p(0)
+        , d_ringQueue_p(0)
         , d_context_p()
         , d_name(basicAllocator)
         , d_processedZero(false)
@@ -595,6 +659,7 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
 
         QueueInfo(const QueueInfo& other, bslma::Allocator* basicAllocator = 0)
         : d_queue_p(other.d_queue_p)
+        , d_ringQueue_p(other.d_ringQueue_p)
         , d_context_p(other.d_context_p)
         , d_name(other.d_name, basicAllocator)
         , d_processedZero(other.d_processedZero.load())
@@ -607,11 +672,76 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         // MANIPULATORS
         void reset()
         {
-            d_queue_p = 0;
+            d_queue_p     = 0;
+            d_ringQueue_p = 0;
             d_context_p.reset();
             d_monitorState          = e_MONITOR_PROCESSED;
             d_exclusiveThreadHandle = bslmt::ThreadUtil::invalidHandle();
         }
+
+        int pushBack(const QueueItem& item)
+        {
+            return d_ringQueue_p ? d_ringQueue_p->pushBack(item)
+                                 : d_queue_p->pushBack(item);
+        }
+
+        int tryPushBack(const QueueItem& item)
+        {
+            return d_ringQueue_p ? d_ringQueue_p->tryPushBack(item)
+                                 : d_queue_p->tryPushBack(item);
+        }
+
+        /// Pop up to the specified `maxNumItems` items into the specified
+        /// `buffer` without blocking and return the number of items popped.
+        int tryPopFront(QueueItem* buffer, int maxNumItems)
+        {
+            return d_ringQueue_p
+                       ? d_ringQueue_p->tryPopFrontBatch(buffer, maxNumItems)
+                       : d_queue_p->tryPopFrontBatch(buffer, maxNumItems);
+        }
+
+        void popFront(QueueItem* item)
+        {
+            if (d_ringQueue_p) {
+                d_ringQueue_p->popFront(item);
+            }
+            else {
+                d_queue_p->popFront(item);
+            }
+        }
+
+        void disablePushBack()
+        {
+            if (d_ringQueue_p) {
+                d_ringQueue_p->disablePushBack();
+            }
+            else {
+                d_queue_p->disablePushBack();
+            }
+        }
+
+        void deleteQueue(bslma::Allocator* allocator)
+        {
+            if (d_ringQueue_p) {
+                allocator->deleteObject(d_ringQueue_p);
+            }
+            else {
+                allocator->deleteObject(d_queue_p);
+            }
+        }
+
+        // ACCESSORS
+        bool isEmpty() const
+        {
+            return d_ringQueue_p ? d_ringQueue_p->isEmpty()
+                                 : d_queue_p->isEmpty();
+        }
+
+        bsls::Types::Int64 numElements() const
+        {
+            return d_ringQueue_p ? d_ringQueue_p->numElements()
+                                 : d_queue_p->numElements();
+        }
     };
 
   private:
@@ -659,6 +789,12 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// event back to the pool if `true` is returned.
     bool unrefEvent(Event* event, bool release);
 
+    /// Unref the specified `event`, which has just been processed by the
+    /// queue with the specified `queue` and `info`, and if this was the
+    /// last reference to it, finalize it as configured and release it back
+    /// to the pool.
+    void releaseProcessedEvent(int queue, QueueInfo& info, Event* event);
+
     /// Pop and process events from the queue with the specified `queue`
     /// until a `0` event is popped off.
     void processQueue(int queue);
@@ -761,6 +897,11 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// Return the number of queues specified at construction.
     int numQueues() const;
 
+    /// Return the number of items currently pending in the queue with the
+    /// specified `queueId`.  The behavior is undefined unless this MQTP is
+    /// started.
+    bsls::Types::Int64 numElements(int queueId) const;
+
     /// Return the handle to the thread managing the specified `queueId`.
     /// The behavior is undefined unless this object was created in the
     /// exclusive mode.
@@ -903,6 +1044,7 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
 , d_threadPool_p(threadPool)
 , d_eventScheduler_p(0)
 , d_eventCallbackFn(bsl::allocator_arg, basicAllocator, eventCallback)
+, d_eventBatchCallbackFn(bsl::allocator_arg, basicAllocator)
 , d_objectCreatorFn(bsl::allocator_arg,
                     basicAllocator,
                     Util::defaultCreator<TYPE>())
@@ -910,6 +1052,7 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
                      basicAllocator,
                      Util::resetResetter<TYPE>())
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, queueCreator)
+, d_ringQueueCreatorFn(bsl::allocator_arg, basicAllocator)
 , d_name(basicAllocator)
 , d_finalizeType(MWCC_FINALIZE_NONE)
 , d_monitorAlarmString(basicAllocator)
@@ -932,9 +1075,11 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
 , d_threadPool_p(threadPool)
 , d_eventScheduler_p(0)
 , d_eventCallbackFn(bsl::allocator_arg, basicAllocator, eventCallback)
+, d_eventBatchCallbackFn(bsl::allocator_arg, basicAllocator)
 , d_objectCreatorFn(bsl::allocator_arg, basicAllocator, objectCreator)
 , d_objectResetterFn(bsl::allocator_arg, basicAllocator, objectResetter)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, queueCreator)
+, d_ringQueueCreatorFn(bsl::allocator_arg, basicAllocator)
 , d_name(basicAllocator)
 , d_finalizeType(MWCC_FINALIZE_NONE)
 , d_monitorAlarmString(basicAllocator)
@@ -954,6 +1099,9 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
 , d_eventCallbackFn(bsl::allocator_arg,
                     basicAllocator,
                     other.d_eventCallbackFn)
+, d_eventBatchCallbackFn(bsl::allocator_arg,
+                         basicAllocator,
+                         other.d_eventBatchCallbackFn)
 , d_objectCreatorFn(bsl::allocator_arg,
                     basicAllocator,
                     other.d_objectCreatorFn)
@@ -961,6 +1109,9 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
                      basicAllocator,
                      other.d_objectResetterFn)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, other.d_queueCreatorFn)
+, d_ringQueueCreatorFn(bsl::allocator_arg,
+                       basicAllocator,
+                       other.d_ringQueueCreatorFn)
 , d_name(other.d_name, basicAllocator)
 , d_finalizeType(other.d_finalizeType)
 , d_monitorAlarmString(other.d_monitorAlarmString, basicAllocator)
@@ -1028,6 +1179,24 @@ MultiQueueThreadPoolConfig<TYPE>::setMonitorAlarm(
     return *this;
 }
 
+template <typename TYPE>
+inline MultiQueueThreadPoolConfig<TYPE>&
+MultiQueueThreadPoolConfig<TYPE>::setRingQueueCreator(
+    const RingQueueCreatorFn& ringQueueCreator)
+{
+    d_ringQueueCreatorFn = ringQueueCreator;
+    return *this;
+}
+
+template <typename TYPE>
+inline MultiQueueThreadPoolConfig<TYPE>&
+MultiQueueThreadPoolConfig<TYPE>::setEventBatchCallback(
+    const EventBatchFn& eventBatchCallback)
+{
+    d_eventBatchCallbackFn = eventBatchCallback;
+    return *this;
+}
+
 // --------------------------
 // class MultiQueueThreadPool
 // --------------------------
@@ -1083,7 +1252,7 @@ inline void MultiQueueThreadPool<TYPE>::processMonitorEvents()
             QueueItem newItem = {true  // isMonitorEvent
                                  ,
                                  0};  // Pointer to event
-            const int ret     = d_queues[i].d_queue_p->tryPushBack(newItem);
+            const int ret     = d_queues[i].tryPushBack(newItem);
             if (ret != 0) {
                 BALL_LOG_ERROR << d_config.d_monitorAlarmString
                                << " Couldn't enqueue monitor event on queue '"
@@ -1110,18 +1279,50 @@ inline bool MultiQueueThreadPool<TYPE>::unrefEvent(Event* event, bool release)
     return isLastRef;
 }
 
+template <typename TYPE>
+inline void
+MultiQueueThreadPool<TYPE>::releaseProcessedEvent(int        queue,
+                                                  QueueInfo& info,
+                                                  Event*     event)
+{
+    if (!unrefEvent(event, false)) {
+        return;  // RETURN
+    }
+
+    const bool finalize =
+        d_config.d_finalizeType == Config::MWCC_FINALIZE_ALL ||
+        (d_config.d_finalizeType == Config::MWCC_FINALIZE_MULTI_QUEUE &&
+         event->d_enqueuedOnMultipleQueues);
+
+    if (finalize) {
+        event->d_type = Event::MWCC_FINALIZE_EVENT;
+        d_config.d_eventCallbackFn(queue, info.d_context_p.get(), event);
+    }
+    d_pool.releaseObject(event);
+}
+
 template <typename TYPE>
 inline void MultiQueueThreadPool<TYPE>::processQueue(int queue)
 {
     QueueInfo& info = d_queues[queue];
-    QueueItem  item;
+    QueueItem  items[k_MAX_BATCH_SIZE];
+    Event*     events[k_MAX_BATCH_SIZE];
+
+    // Only pop one item at a time in single-threaded mode: an event executed
+    // immediately may re-enter this method, and would then be processed
+    // before the remainder of the current batch.
+    const int  maxBatchSize   = isSingleThreaded()
+                                    ? 1
+                                    : static_cast<int>(k_MAX_BATCH_SIZE);
+    const bool isBatchEnabled = static_cast<bool>(
+        d_config.d_eventBatchCallbackFn);
 
     // Store the thread id of the thread being exclusively used
     info.d_exclusiveThreadHandle = bslmt::ThreadUtil::self();
 
     while (true) {
-        const int popRet = info.d_queue_p->tryPopFront(&item);
-        if (popRet != 0) {
+        int numItems = info.tryPopFront(items, maxBatchSize);
+        if (numItems == 0) {
             // Queue is empty
             d_config.d_eventCallbackFn(queue,
                                        info.d_context_p.get(),
@@ -1134,46 +1335,70 @@ inline void MultiQueueThreadPool<TYPE>::processQueue(int queue)
                 return;  // RETURN
             }
 
-            info.d_queue_p->popFront(&item);
+            info.popFront(&items[0]);
+            numItems = 1;
         }
 
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(item.d_monitorEvent)) {
-            // Process monitor event
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-            const MonitorEventState prevState = static_cast<MonitorEventState>(
-                info.d_monitorState.swap(e_MONITOR_PROCESSED));
-            if (prevState == e_MONITOR_STUCK) {
-                // The queue was stuck, but is now back to normal
-                BALL_LOG_INFO << "Queue '" << info.d_name << "' is back to "
-                              << "work";
-            }
-            continue;  // CONTINUE
-        }
+        int i = 0;
+        while (i < numItems) {
+            const QueueItem& item = items[i];
 
-        Event* event = item.d_event_p;
-        if (event == 0) {
-            // We've been told to return
-            info.d_processedZero = true;
-            return;  // RETURN
-        }
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(item.d_monitorEvent)) {
+                // Process monitor event
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-        d_config.d_eventCallbackFn(queue, info.d_context_p.get(), event);
+                const MonitorEventState prevState =
+                    static_cast<MonitorEventState>(
+                        info.d_monitorState.swap(e_MONITOR_PROCESSED));
+                if (prevState == e_MONITOR_STUCK) {
+                    // The queue was stuck, but is now back to normal
+                    BALL_LOG_INFO << "Queue '" << info.d_name
+                                  << "' is back to work";
+                }
+                ++i;
+                continue;  // CONTINUE
+            }
 
-        if (unrefEvent(event, false)) {
-            bool finalize = (d_config.d_finalizeType ==
-                             Config::MWCC_FINALIZE_ALL);
-            finalize      = finalize || ((d_config.d_finalizeType ==
-                                     Config::MWCC_FINALIZE_MULTI_QUEUE) &&
-                                    event->d_enqueuedOnMultipleQueues);
+            if (item.d_event_p == 0) {
+                // We've been told to return.  Release the events popped
+                // along with the stop marker, just like 'stop' does for the
+                // ones left in the queue.
+                for (int j = i + 1; j < numItems; ++j) {
+                    if (!items[j].d_monitorEvent) {
+                        d_pool.releaseObject(items[j].d_event_p);
+                    }
+                }
+
+                info.d_processedZero = true;
+                return;  // RETURN
+            }
 
-            if (finalize) {
-                event->d_type = Event::MWCC_FINALIZE_EVENT;
+            if (!isBatchEnabled) {
+                Event* event = item.d_event_p;
                 d_config.d_eventCallbackFn(queue,
                                            info.d_context_p.get(),
                                            event);
+                releaseProcessedEvent(queue, info, event);
+                ++i;
+                continue;  // CONTINUE
+            }
+
+            // Hand the run of consecutive user events starting at 'item' to
+            // the batch callback at once.
+            int numEvents = 0;
+            while (i < numItems && !items[i].d_monitorEvent &&
+                   items[i].d_event_p != 0) {
+                events[numEvents++] = items[i++].d_event_p;
+            }
+
+            d_config.d_eventBatchCallbackFn(queue,
+                                            info.d_context_p.get(),
+                                            events,
+                                            numEvents);
+
+            for (int j = 0; j < numEvents; ++j) {
+                releaseProcessedEvent(queue, info, events[j]);
             }
-            d_pool.releaseObject(event);
         }
     }
 }
@@ -1224,10 +1449,10 @@ inline int MultiQueueThreadPool<TYPE>::enqueueEventImp(Event* event,
         // [try to] Push back item
         int pushRet = 0;
         if (tryPush) {
-            pushRet = info.d_queue_p->tryPushBack(newItem);
+            pushRet = info.tryPushBack(newItem);
         }
         else {
-            pushRet = info.d_queue_p->pushBack(newItem);
+            pushRet = info.pushBack(newItem);
         }
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(pushRet != 0)) {
@@ -1296,9 +1521,18 @@ inline int MultiQueueThreadPool<TYPE>::start()
     // Create the queues
     for (size_t i = 0; i < d_queues.size(); ++i) {
         QueueCreatorRet ret;
-        d_queues[i].d_queue_p   = d_config.d_queueCreatorFn(&ret,
-                                                          static_cast<int>(i),
-                                                          d_allocator_p);
+        if (d_config.d_ringQueueCreatorFn) {
+            d_queues[i].d_ringQueue_p = d_config.d_ringQueueCreatorFn(
+                &ret,
+                static_cast<int>(i),
+                d_allocator_p);
+        }
+        else {
+            d_queues[i].d_queue_p = d_config.d_queueCreatorFn(
+                &ret,
+                static_cast<int>(i),
+                d_allocator_p);
+        }
         d_queues[i].d_context_p = ret.context();
         if (ret.name().empty()) {
             // Generate a name for the queue
@@ -1375,8 +1609,8 @@ inline void MultiQueueThreadPool<TYPE>::stop()
         QueueItem item = {false  // isMonitorEvent
                           ,
                           0};  // pointer to event
-        info.d_queue_p->pushBack(item);
-        info.d_queue_p->disablePushBack();
+        info.pushBack(item);
+        info.disablePushBack();
 
         if (isSingleThreaded()) {
             processQueue(static_cast<int>(i));
@@ -1388,11 +1622,11 @@ inline void MultiQueueThreadPool<TYPE>::stop()
             bslmt::ThreadUtil::yield();
         }
 
-        while (!info.d_queue_p->tryPopFront(&item)) {
+        while (info.tryPopFront(&item, 1) != 0) {
             d_pool.releaseObject(item.d_event_p);
         }
 
-        d_allocator_p->deleteObject(info.d_queue_p);
+        info.deleteQueue(d_allocator_p);
         info.reset();
     }
 }
@@ -1508,7 +1742,7 @@ inline void MultiQueueThreadPool<TYPE>::waitUntilEmpty()
     while (!fullPass) {
         fullPass = true;
         for (size_t i = 0; i < d_queues.size(); ++i) {
-            while (!d_queues[i].d_queue_p->isEmpty()) {
+            while (!d_queues[i].isEmpty()) {
                 bslmt::ThreadUtil::yield();
                 fullPass = false;
             }
@@ -1534,6 +1768,18 @@ inline int MultiQueueThreadPool<TYPE>::numQueues() const
     return static_cast<int>(d_queues.size());
 }
 
+template <typename TYPE>
+inline bsls::Types::Int64
+MultiQueueThreadPool<TYPE>::numElements(int queueId) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= queueId);
+    BSLS_ASSERT_SAFE(queueId < numQueues());
+    BSLS_ASSERT_SAFE(isStarted() && "MQTP has not been started");
+
+    return d_queues[queueId].numElements();
+}
+
 template <typename TYPE>
 inline bslmt::ThreadUtil::Handle
 MultiQueueThreadPool<TYPE>::queueThreadHandle(int queueId) const
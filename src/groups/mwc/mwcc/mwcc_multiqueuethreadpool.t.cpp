@@ -35,9 +35,12 @@
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslmt_threadattributes.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
 
@@ -76,6 +79,22 @@ queueCreator(MQTP::QueueCreatorRet*            ret,
     return new (*allocator) MQTP::Queue(fixedQueueSize, allocator);
 }
 
+static MQTP::RingQueue*
+ringQueueCreator(MQTP::QueueCreatorRet*            ret,
+                 int                               queueId,
+                 bslma::Allocator*                 allocator,
+                 int                               queueSize,
+                 bsl::map<int, bsl::vector<int> >* queueContextMap)
+{
+    PV("Creating ring queue [queueId: " << queueId << "]\n");
+
+    ret->context().load(&(*queueContextMap)[queueId],
+                        0,
+                        &bslma::ManagedPtrUtil::noOpDeleter);
+
+    return new (*allocator) MQTP::RingQueue(queueSize, allocator);
+}
+
 static void
 eventCb(BSLS_ANNOTATION_UNUSED int queueId, void* context, MQTP::Event* event)
 {
@@ -85,17 +104,92 @@ eventCb(BSLS_ANNOTATION_UNUSED int queueId, void* context, MQTP::Event* event)
     }
 }
 
+/// Append the objects of the specified `numEvents` `events` to the vector
+/// pointed to by the specified `context`, and increment the specified
+/// `numBatches`.  Wait on the specified `gate` before processing the first
+/// batch of a queue.
+static void eventBatchCb(BSLS_ANNOTATION_UNUSED int queueId,
+                         void*                      context,
+                         MQTP::Event**              events,
+                         int                        numEvents,
+                         bsls::AtomicInt*           numBatches,
+                         bslmt::Semaphore*          gate)
+{
+    BSLS_ASSERT_OPT(numEvents > 0);
+
+    bsl::vector<int>* vec = reinterpret_cast<bsl::vector<int>*>(context);
+    if (vec->empty()) {
+        gate->wait();
+    }
+
+    for (int i = 0; i < numEvents; ++i) {
+        BSLS_ASSERT_OPT(events[i]->type() == MQTP::Event::MWCC_USER);
+        vec->push_back(events[i]->object());
+    }
+
+    ++(*numBatches);
+}
+
+/// Append the object of the specified `event` to the vector pointed to by
+/// the specified `context`.  On the event holding -1, enqueue the specified
+/// `numEvents` events with objects '0' to 'numEvents - 1' on the specified
+/// `queueId` of the MQTP pointed to by the specified `mqtp`, from this very
+/// processing thread.  Post on the specified `done` semaphore once the last
+/// of them is processed.
+static void selfEnqueueEventCb(int               queueId,
+                               void*             context,
+                               MQTP::Event*      event,
+                               MQTP**            mqtp,
+                               int               numEvents,
+                               bslmt::Semaphore* done)
+{
+    if (event->type() != MQTP::Event::MWCC_USER) {
+        return;  // RETURN
+    }
+
+    bsl::vector<int>* vec = reinterpret_cast<bsl::vector<int>*>(context);
+    vec->push_back(event->object());
+
+    if (event->object() == -1) {
+        for (int i = 0; i < numEvents; ++i) {
+            MQTP::Event* newEvent = (*mqtp)->getUnmanagedEvent();
+            newEvent->object()    = i;
+            (*mqtp)->enqueueEvent(newEvent, queueId);
+        }
+    }
+    else if (event->object() == numEvents - 1) {
+        done->post();
+    }
+}
+
 static MQTP::Queue* performanceTestQueueCreator(bslma::Allocator* allocator,
                                                 int fixedQueueSize)
 {
     return new (*allocator) MQTP::Queue(fixedQueueSize, allocator);
 }
 
+static MQTP::RingQueue*
+performanceTestRingQueueCreator(bslma::Allocator* allocator, int queueSize)
+{
+    return new (*allocator) MQTP::RingQueue(queueSize, allocator);
+}
+
 void performanceTestEventCb()
 {
     // NOTHING
 }
 
+/// Enqueue the specified `numIterations` events on the first queue of the
+/// specified `mqtp`.
+static void performanceTestProducer(MQTP* mqtp, int numIterations)
+{
+    for (int i = 0; i < numIterations; ++i) {
+        MQTP::Event* event = mqtp->getUnmanagedEvent();
+        event->object()    = 0;
+        mqtp->enqueueEvent(event, 0);
+    }
+}
+
 struct PerformanceTestObject {
     int d_value;
 };
@@ -228,6 +322,292 @@ static void test1_breathingTest()
     threadPool.stop();
 }
 
+static void test2_ringQueue()
+// ------------------------------------------------------------------------
+// RING QUEUE
+//
+// Concerns:
+//   - A MQTP configured with a ring queue creator processes events in
+//     order, including when producers have to wait for a full queue.
+//   - Events enqueued on all queues reach every queue.
+//
+// Testing:
+//   MultiQueueThreadPoolConfig::setRingQueueCreator
+//   numElements
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // See 'test1_breathingTest'.
+
+    mwctst::TestHelper::printTestName("RING QUEUE");
+
+    // CONSTANTS
+    const int k_NUM_QUEUES = 2;
+    const int k_QUEUE_SIZE = 4;
+    const int k_NUM_EVENTS = 1000;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(s_allocator_p);
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &eventCb,
+                              bdlf::PlaceHolders::_1,   // queueId
+                              bdlf::PlaceHolders::_2,   // context
+                              bdlf::PlaceHolders::_3),  // event
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // ret
+                              bdlf::PlaceHolders::_2,  // queueId
+                              bdlf::PlaceHolders::_3,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+        s_allocator_p);
+    config.setRingQueueCreator(
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &ringQueueCreator,
+                              bdlf::PlaceHolders::_1,  // ret
+                              bdlf::PlaceHolders::_2,  // queueId
+                              bdlf::PlaceHolders::_3,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mfqtp(config, s_allocator_p);
+    ASSERT_EQ(mfqtp.start(), 0);
+    ASSERT_EQ(mfqtp.numElements(0), 0);
+    ASSERT_EQ(mfqtp.numElements(1), 0);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        MQTP::Event* event = mfqtp.getUnmanagedEvent();
+        event->object()    = i;
+        mfqtp.enqueueEvent(event, 0);
+    }
+
+    MQTP::Event* event = mfqtp.getUnmanagedEvent();
+    event->object()    = k_NUM_EVENTS;
+    mfqtp.enqueueEventOnAllQueues(event);
+
+    mfqtp.waitUntilEmpty();
+    ASSERT_EQ(mfqtp.numElements(0), 0);
+    ASSERT_EQ(mfqtp.numElements(1), 0);
+
+    mfqtp.stop();
+    ASSERT_EQ(mfqtp.isStarted(), false);
+
+    ASSERT_EQ(queueContextMap[0].size(),
+              static_cast<size_t>(k_NUM_EVENTS + 1));
+    for (int i = 0; i <= k_NUM_EVENTS; ++i) {
+        ASSERT_EQ_D(i, queueContextMap[0][i], i);
+    }
+
+    ASSERT_EQ(queueContextMap[1].size(), 1U);
+    ASSERT_EQ(queueContextMap[1][0], k_NUM_EVENTS);
+
+    threadPool.stop();
+}
+
+static void test3_eventBatch()
+// ------------------------------------------------------------------------
+// EVENT BATCH
+//
+// Concerns:
+//   - A MQTP configured with an event batch callback delivers all user
+//     events, in order, through that callback and never through the event
+//     callback.
+//   - Events are delivered in batches when the processing thread lags
+//     behind the producer.
+//
+// Testing:
+//   MultiQueueThreadPoolConfig::setEventBatchCallback
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // See 'test1_breathingTest'.
+
+    mwctst::TestHelper::printTestName("EVENT BATCH");
+
+    // CONSTANTS
+    const int k_NUM_QUEUES = 2;
+    const int k_QUEUE_SIZE = 1024;
+    const int k_NUM_EVENTS = 1000;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(s_allocator_p);
+    bsls::AtomicInt                  numBatches(0);
+    bslmt::Semaphore                 gate;
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    // Only the 'MWCC_QUEUE_EMPTY' events are delivered to 'eventCb', which
+    // ignores them.
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &eventCb,
+                              bdlf::PlaceHolders::_1,   // queueId
+                              bdlf::PlaceHolders::_2,   // context
+                              bdlf::PlaceHolders::_3),  // event
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // ret
+                              bdlf::PlaceHolders::_2,  // queueId
+                              bdlf::PlaceHolders::_3,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+        s_allocator_p);
+    config.setEventBatchCallback(
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &eventBatchCb,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // context
+                              bdlf::PlaceHolders::_3,  // events
+                              bdlf::PlaceHolders::_4,  // numEvents
+                              &numBatches,
+                              &gate));
+
+    MQTP mfqtp(config, s_allocator_p);
+    ASSERT_EQ(mfqtp.start(), 0);
+
+    // The processing threads are held on their first batch until all events
+    // are enqueued, so that the remaining ones are popped in batches.
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        MQTP::Event* event = mfqtp.getUnmanagedEvent();
+        event->object()    = i;
+        mfqtp.enqueueEvent(event, 0);
+    }
+
+    MQTP::Event* event = mfqtp.getUnmanagedEvent();
+    event->object()    = k_NUM_EVENTS;
+    mfqtp.enqueueEventOnAllQueues(event);
+
+    gate.post(k_NUM_QUEUES);
+    mfqtp.waitUntilEmpty();
+    mfqtp.stop();
+
+    ASSERT_EQ(queueContextMap[0].size(),
+              static_cast<size_t>(k_NUM_EVENTS + 1));
+    for (int i = 0; i <= k_NUM_EVENTS; ++i) {
+        ASSERT_EQ_D(i, queueContextMap[0][i], i);
+    }
+
+    ASSERT_EQ(queueContextMap[1].size(), 1U);
+    ASSERT_EQ(queueContextMap[1][0], k_NUM_EVENTS);
+
+    // At most 32 events per batch, and each queue has at least one batch.
+    ASSERT_GE(numBatches, (k_NUM_EVENTS + 1) / 32 + 1);
+    ASSERT_LT(numBatches, k_NUM_EVENTS / 2);
+
+    threadPool.stop();
+}
+
+static void test4_ringQueueSelfEnqueue()
+// ------------------------------------------------------------------------
+// RING QUEUE SELF ENQUEUE
+//
+// Concerns:
+//   - A processing thread enqueuing more events on its own ring queue than
+//     the ring can hold does not deadlock, and the events are processed in
+//     order.
+//
+// Testing:
+//   MultiQueueThreadPoolConfig::setRingQueueCreator
+//   enqueueEvent
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // See 'test1_breathingTest'.
+
+    mwctst::TestHelper::printTestName("RING QUEUE SELF ENQUEUE");
+
+    // CONSTANTS
+    const int k_NUM_QUEUES = 1;
+    const int k_QUEUE_SIZE = 4;
+    const int k_NUM_EVENTS = 16 * k_QUEUE_SIZE;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(s_allocator_p);
+    MQTP*                            mqtp = 0;
+    bslmt::Semaphore                 done;
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &selfEnqueueEventCb,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // context
+                              bdlf::PlaceHolders::_3,  // event
+                              &mqtp,
+                              k_NUM_EVENTS,
+                              &done),
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // ret
+                              bdlf::PlaceHolders::_2,  // queueId
+                              bdlf::PlaceHolders::_3,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+        s_allocator_p);
+    config.setRingQueueCreator(
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &ringQueueCreator,
+                              bdlf::PlaceHolders::_1,  // ret
+                              bdlf::PlaceHolders::_2,  // queueId
+                              bdlf::PlaceHolders::_3,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mfqtp(config, s_allocator_p);
+    mqtp = &mfqtp;
+    ASSERT_EQ(mfqtp.start(), 0);
+
+    MQTP::Event* event = mfqtp.getUnmanagedEvent();
+    event->object()    = -1;
+    mfqtp.enqueueEvent(event, 0);
+
+    done.wait();
+    mfqtp.waitUntilEmpty();
+    mfqtp.stop();
+
+    ASSERT_EQ(queueContextMap[0].size(),
+              static_cast<size_t>(k_NUM_EVENTS + 1));
+    ASSERT_EQ(queueContextMap[0][0], -1);
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        ASSERT_EQ_D(i, queueContextMap[0][i + 1], i);
+    }
+
+    threadPool.stop();
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance()
 // ------------------------------------------------------------------------
@@ -315,6 +695,33 @@ static void testN1_performance()
     PRINT("Stopping mfqtp ...");
     mfqtp.stop();
 
+    // Test with MQTP using ring queues
+    PRINT("=====================");
+    PRINT("MQTP (MpscRingQueue)");
+    PRINT("=====================");
+
+    config.setRingQueueCreator(
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &performanceTestRingQueueCreator,
+                              bdlf::PlaceHolders::_3,
+                              k_FIXED_QUEUE_SIZE));
+
+    MQTP ringMqtp(config, s_allocator_p);
+    BSLS_ASSERT_OPT(ringMqtp.start() == 0);
+
+    PRINT("Enqueuing " << k_NUM_ITERATIONS << " items ...");
+    startTime = bsls::TimeUtil::getTimer();
+    performanceTestProducer(&ringMqtp, k_NUM_ITERATIONS);
+    PRINT("Enqueued " << k_NUM_ITERATIONS << " items.");
+
+    ringMqtp.waitUntilEmpty();
+    endTime = bsls::TimeUtil::getTimer();
+
+    printProcessedItems(k_NUM_ITERATIONS, endTime - startTime);
+
+    PRINT("Stopping ringMqtp ...");
+    ringMqtp.stop();
+
     // Now test with fixedQueue
     PRINT("=================");
     PRINT("bdlcc::FixedQueue");
@@ -442,6 +849,141 @@ static void testN1_performance_GoogleBenchmark(benchmark::State& state)
     }
 }
 
+static void testN1_ringPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check the overhead of the MQTP using 'mwcc::MpscRingQueue' queues
+//
+// Plan:
+//  1) Create a MQTP with a single ring queue and enqueue events as quickly
+//     as possible on it.  See how many we can process in a few seconds.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    mwctst::TestHelper::printTestName("RING PERFORMANCE TEST");
+
+    // CONSTANTS
+    const int k_NUM_QUEUES     = 1;
+    const int k_NUM_ITERATIONS = 10 * 1000 * 1000;  // 10 M
+    const int k_QUEUE_SIZE     = 256 * 1024;        // 256K
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        3,                                // minThreads
+        3,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(k_NUM_QUEUES,
+                        &threadPool,
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestEventCb),
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestQueueCreator,
+                                              bdlf::PlaceHolders::_3,
+                                              k_QUEUE_SIZE),
+                        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+                        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+                        s_allocator_p);
+    config.setRingQueueCreator(
+        bdlf::BindUtil::bindS(s_allocator_p,
+                              &performanceTestRingQueueCreator,
+                              bdlf::PlaceHolders::_3,
+                              k_QUEUE_SIZE));
+
+    MQTP mfqtp(config, s_allocator_p);
+    BSLS_ASSERT_OPT(mfqtp.start() == 0);
+
+    for (auto _ : state) {
+        performanceTestProducer(&mfqtp, k_NUM_ITERATIONS);
+        mfqtp.waitUntilEmpty();
+    }
+
+    mfqtp.stop();
+}
+
+static void
+testN1_multiProducerPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// MULTI PRODUCER PERFORMANCE TEST
+//
+// Concerns:
+//  a) Compare the default queues of the MQTP with 'mwcc::MpscRingQueue'
+//     queues when several threads enqueue events on the same queue, which
+//     is how the dispatcher of the broker uses the MQTP.
+//
+// Plan:
+//  1) Create a MQTP with a single queue, of the type selected by the first
+//     argument of the benchmark ('0' for the default queue, '1' for the
+//     ring queue), and enqueue events on it from the number of threads
+//     specified by the second argument of the benchmark.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+
+    // CONSTANTS
+    const int  k_NUM_QUEUES     = 1;
+    const int  k_NUM_ITERATIONS = 10 * 1000 * 1000;  // 10 M
+    const int  k_QUEUE_SIZE     = 256 * 1024;        // 256K
+    const bool k_USE_RING_QUEUE = state.range(0) != 0;
+    const int  k_NUM_PRODUCERS  = static_cast<int>(state.range(1));
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        1,                                // minThreads
+        1,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        s_allocator_p);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(k_NUM_QUEUES,
+                        &threadPool,
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestEventCb),
+                        bdlf::BindUtil::bindS(s_allocator_p,
+                                              &performanceTestQueueCreator,
+                                              bdlf::PlaceHolders::_3,
+                                              k_QUEUE_SIZE),
+                        mwcc::MultiQueueThreadPoolUtil::defaultCreator<int>(),
+                        mwcc::MultiQueueThreadPoolUtil::noOpResetter<int>(),
+                        s_allocator_p);
+    if (k_USE_RING_QUEUE) {
+        config.setRingQueueCreator(
+            bdlf::BindUtil::bindS(s_allocator_p,
+                                  &performanceTestRingQueueCreator,
+                                  bdlf::PlaceHolders::_3,
+                                  k_QUEUE_SIZE));
+    }
+
+    MQTP mfqtp(config, s_allocator_p);
+    BSLS_ASSERT_OPT(mfqtp.start() == 0);
+
+    for (auto _ : state) {
+        bslmt::ThreadGroup producers(s_allocator_p);
+        for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+            producers.addThread(
+                bdlf::BindUtil::bindS(s_allocator_p,
+                                      &performanceTestProducer,
+                                      &mfqtp,
+                                      k_NUM_ITERATIONS / k_NUM_PRODUCERS));
+        }
+        producers.joinAll();
+        mfqtp.waitUntilEmpty();
+    }
+
+    mfqtp.stop();
+}
+
 static void testN1_fixedPerformance_GoogleBenchmark(benchmark::State& state)
 // ------------------------------------------------------------------------
 // PERFORMANCE TEST
@@ -514,6 +1056,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_ringQueueSelfEnqueue(); break;
+    case 3: test3_eventBatch(); break;
+    case 2: test2_ringQueue(); break;
     case 1: test1_breathingTest(); break;
     case -1:
 #ifdef BSLS_PLATFORM_OS_LINUX
@@ -521,6 +1066,16 @@ int main(int argc, char* argv[])
             ->Unit(benchmark::kMillisecond);
         BENCHMARK(testN1_performance_GoogleBenchmark)
             ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_ringPerformance_GoogleBenchmark)
+            ->Unit(benchmark::kMillisecond);
+        BENCHMARK(testN1_multiProducerPerformance_GoogleBenchmark)
+            ->Args({0, 1})
+            ->Args({1, 1})
+            ->Args({0, 4})
+            ->Args({1, 4})
+            ->Args({0, 8})
+            ->Args({1, 8})
+            ->Unit(benchmark::kMillisecond);
         benchmark::Initialize(&argc, argv);
         benchmark::RunSpecifiedBenchmarks();
 #else
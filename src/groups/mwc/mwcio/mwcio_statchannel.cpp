@@ -41,15 +41,30 @@ StatChannelConfig::StatChannelConfig(
     BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
 : d_channel_sp(channel)
 , d_statContext_sp(statContext)
+, d_zeroCopyThreshold(0)
 {
     // NOTHING
 }
 
+StatChannelConfig::StatChannelConfig(
+    const bsl::shared_ptr<mwcio::Channel>&     channel,
+    const bsl::shared_ptr<mwcst::StatContext>& statContext,
+    bsls::Types::Int64                         zeroCopyThreshold,
+    BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
+: d_channel_sp(channel)
+, d_statContext_sp(statContext)
+, d_zeroCopyThreshold(zeroCopyThreshold)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(zeroCopyThreshold >= 0);
+}
+
 StatChannelConfig::StatChannelConfig(
     const StatChannelConfig& other,
     BSLS_ANNOTATION_UNUSED bslma::Allocator* basicAllocator)
 : d_channel_sp(other.d_channel_sp)
 , d_statContext_sp(other.d_statContext_sp)
+, d_zeroCopyThreshold(other.d_zeroCopyThreshold)
 {
     // NOTHING
 }
@@ -123,6 +138,17 @@ void StatChannel::write(Status*            status,
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(*status)) {
         d_config.d_statContext_sp->adjustValue(Stat::e_BYTES_OUT,
                                                blob.length());
+
+        if (d_config.d_zeroCopyThreshold != 0 &&
+            blob.length() >= d_config.d_zeroCopyThreshold) {
+            // The underlying channel may still copy the blob (e.g., if it
+            // coalesces it with other writes, or if zero-copy is not
+            // supported by the platform), so this only reports an upper
+            // bound of the bytes actually written with zero-copy.
+            d_config.d_statContext_sp->adjustValue(
+                Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT,
+                blob.length());
+        }
     }
 }
 
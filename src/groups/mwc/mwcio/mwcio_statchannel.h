@@ -28,6 +28,18 @@
 //@DESCRIPTION: This component defines a mechanism, 'mwcio::StatChannel', which
 // is a concrete implementation of the 'mwcio::Channel' protocol that collects
 // stats.
+//
+/// Zero-copy
+///---------
+// When the underlying channel is configured to send writes of at least a
+// given size using zero-copy (e.g., 'MSG_ZEROCOPY' on Linux), that threshold
+// can be provided in the 'StatChannelConfig' so that the channel also reports
+// the number of bytes written with a write eligible to zero-copy.  Note that
+// this is an upper bound of the number of bytes actually written without a
+// copy: the underlying channel may coalesce an eligible write with others or
+// fall back to copying it, and zero-copy may not be supported by the
+// platform at all.  If the threshold is 0, zero-copy is considered disabled
+// and the value is never updated.
 
 // MWC
 
@@ -64,6 +76,11 @@ class StatChannelConfig {
     bsl::shared_ptr<mwcst::StatContext> d_statContext_sp;
     // stat conext for this channel
 
+    bsls::Types::Int64 d_zeroCopyThreshold;
+    // minimum size of a write for it to be sent
+    // using zero-copy by the underlying channel,
+    // or 0 if zero-copy is disabled
+
     // FRIENDS
     friend class StatChannel;
 
@@ -73,9 +90,20 @@ class StatChannelConfig {
                                    bslma::UsesBslmaAllocator)
 
     // CREATORS
+
+    /// Create a `StatChannelConfig` for a channel decorating the specified
+    /// `channel` and reporting its stats to the specified `statContext`.
+    /// Optionally specify a `zeroCopyThreshold`, the minimum size of a
+    /// write for it to be sent using zero-copy by `channel`; if 0, zero-copy
+    /// is considered disabled.  Optionally specify a `basicAllocator` used
+    /// to supply memory.
     StatChannelConfig(const bsl::shared_ptr<Channel>&            channel,
                       const bsl::shared_ptr<mwcst::StatContext>& statContext,
                       bslma::Allocator* basicAllocator = 0);
+    StatChannelConfig(const bsl::shared_ptr<Channel>&            channel,
+                      const bsl::shared_ptr<mwcst::StatContext>& statContext,
+                      bsls::Types::Int64 zeroCopyThreshold,
+                      bslma::Allocator*  basicAllocator = 0);
     StatChannelConfig(const StatChannelConfig& other,
                       bslma::Allocator*        basicAllocator = 0);
 };
@@ -98,7 +126,11 @@ class StatChannel : public DecoratingChannelPartialImp {
     ///       `mwcio::StatChannelFactory`).
     struct Stat {
         // TYPES
-        enum Enum { e_BYTES_IN = 0, e_BYTES_OUT = 1 };
+        enum Enum {
+            e_BYTES_IN                     = 0,
+            e_BYTES_OUT                    = 1,
+            e_ZERO_COPY_ELIGIBLE_BYTES_OUT = 2
+        };
     };
 
   private:
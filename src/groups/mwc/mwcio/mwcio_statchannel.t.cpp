@@ -0,0 +1,238 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcio_statchannel.t.cpp                                            -*-C++-*-
+#include <mwcio_statchannel.h>
+
+// MWC
+#include <mwcio_channel.h>
+#include <mwcio_statchannelfactory.h>
+#include <mwcio_status.h>
+#include <mwcio_testchannel.h>
+#include <mwcst_statcontext.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bslma_managedptr.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mwcio::StatChannelFactoryUtil::Stat Stat;
+
+/// Write to the specified `channel` a blob of the specified `length` bytes,
+/// using the specified `bufferFactory`, and return the status of the write.
+bool writeBlob(mwcio::Channel*                 channel,
+               int                             length,
+               bdlbb::PooledBlobBufferFactory* bufferFactory)
+{
+    const bsl::string data(length, 'x', s_allocator_p);
+    bdlbb::Blob       blob(bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(&blob, data.data(), length);
+
+    mwcio::Status status(s_allocator_p);
+    channel->write(&status, blob);
+    return status;
+}
+
+/// Return the value of the specified `stat` of the specified `context`,
+/// since the previous snapshot if the specified `delta` is true, or in total
+/// otherwise.
+bsls::Types::Int64 getValue(const mwcst::StatContext& context,
+                            Stat::Enum                stat,
+                            bool                      delta = false)
+{
+    return mwcio::StatChannelFactoryUtil::getValue(context,
+                                                   delta ? 1 : 0,
+                                                   stat);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - The bytes and the writes sent through the channel are reported, and
+//     failed writes are not.
+//   - Nothing is reported as eligible to zero-copy if no threshold was
+//     configured.
+//
+// Plan:
+//   Write blobs through a channel having no zero-copy threshold and verify
+//   the values of its stat context.
+//
+// Testing:
+//   write
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    bslma::ManagedPtr<mwcst::StatContext> rootStatContext =
+        mwcio::StatChannelFactoryUtil::createStatContext("channels",
+                                                         2,
+                                                         s_allocator_p);
+    bsl::shared_ptr<mwcst::StatContext> statContext(
+        rootStatContext->addSubcontext(
+            mwcst::StatContextConfiguration("channel", s_allocator_p)));
+
+    bsl::shared_ptr<mwcio::TestChannel> testChannel;
+    testChannel.createInplace(s_allocator_p, s_allocator_p);
+
+    mwcio::StatChannel channel(
+        mwcio::StatChannelConfig(testChannel, statContext, s_allocator_p),
+        s_allocator_p);
+
+    ASSERT(writeBlob(&channel, 100, &bufferFactory));
+    ASSERT(writeBlob(&channel, 5000, &bufferFactory));
+
+    testChannel->setWriteStatus(
+        mwcio::Status(mwcio::StatusCategory::e_CONNECTION, s_allocator_p));
+    ASSERT(!writeBlob(&channel, 200, &bufferFactory));
+
+    ASSERT_EQ(testChannel->writeCalls().size(), 3U);
+
+    rootStatContext->snapshot();
+
+    ASSERT_EQ(getValue(*statContext, Stat::e_BYTES_OUT_ABS), 5100);
+    ASSERT_EQ(getValue(*statContext, Stat::e_WRITES_OUT_ABS), 2);
+    ASSERT_EQ(getValue(*statContext, Stat::e_BYTES_IN_ABS), 0);
+    ASSERT_EQ(getValue(*statContext, Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_ABS),
+              0);
+}
+
+static void test2_zeroCopyEligibleBytes()
+// ------------------------------------------------------------------------
+// ZERO-COPY ELIGIBLE BYTES
+//
+// Concerns:
+//   1. Only the bytes of the writes at least as large as the zero-copy
+//      threshold are reported as eligible to zero-copy.
+//   2. The bytes of a failed write are not reported.
+//   3. The values are reported per interval and in total.
+//
+// Plan:
+//   Write blobs below, at and above the zero-copy threshold of a channel,
+//   across snapshots, and verify the values of its stat context.
+//
+// Testing:
+//   write
+//   StatChannelFactoryUtil::getValue(e_ZERO_COPY_ELIGIBLE_BYTES_OUT_*)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ZERO-COPY ELIGIBLE BYTES");
+
+    const bsls::Types::Int64 k_THRESHOLD = 1000;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+
+    bslma::ManagedPtr<mwcst::StatContext> rootStatContext =
+        mwcio::StatChannelFactoryUtil::createStatContext("channels",
+                                                         3,
+                                                         s_allocator_p);
+    bsl::shared_ptr<mwcst::StatContext> statContext(
+        rootStatContext->addSubcontext(
+            mwcst::StatContextConfiguration("channel", s_allocator_p)));
+
+    bsl::shared_ptr<mwcio::TestChannel> testChannel;
+    testChannel.createInplace(s_allocator_p, s_allocator_p);
+
+    mwcio::StatChannel channel(mwcio::StatChannelConfig(testChannel,
+                                                        statContext,
+                                                        k_THRESHOLD,
+                                                        s_allocator_p),
+                               s_allocator_p);
+
+    {
+        PV("First interval");
+
+        ASSERT(writeBlob(&channel, 999, &bufferFactory));
+        ASSERT(writeBlob(&channel, 1000, &bufferFactory));
+        ASSERT(writeBlob(&channel, 4000, &bufferFactory));
+
+        rootStatContext->snapshot();
+
+        ASSERT_EQ(getValue(*statContext, Stat::e_BYTES_OUT_ABS), 5999);
+        ASSERT_EQ(
+            getValue(*statContext, Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_ABS),
+            5000);
+    }
+
+    {
+        PV("Second interval");
+
+        ASSERT(writeBlob(&channel, 10, &bufferFactory));
+        ASSERT(writeBlob(&channel, 2000, &bufferFactory));
+
+        testChannel->setWriteStatus(
+            mwcio::Status(mwcio::StatusCategory::e_LIMIT, s_allocator_p));
+        ASSERT(!writeBlob(&channel, 3000, &bufferFactory));
+
+        rootStatContext->snapshot();
+
+        ASSERT_EQ(getValue(*statContext, Stat::e_BYTES_OUT_DELTA, true),
+                  2010);
+        ASSERT_EQ(getValue(*statContext,
+                           Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_DELTA,
+                           true),
+                  2000);
+        ASSERT_EQ(
+            getValue(*statContext, Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_ABS),
+            7000);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_zeroCopyEligibleBytes(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_DEFAULT);
+    // Do not check for default/global allocator usage.
+}
@@ -45,6 +45,7 @@ StatChannelFactoryConfig::StatChannelFactoryConfig(
     bslma::Allocator*           basicAllocator)
 : d_baseFactory_p(base)
 , d_statContextCreator(statContextCreator)
+, d_zeroCopyThreshold(0)
 , d_allocator_p(basicAllocator)
 {
     // PRECONDITIONS
@@ -56,11 +57,23 @@ StatChannelFactoryConfig::StatChannelFactoryConfig(
     bslma::Allocator*               basicAllocator)
 : d_baseFactory_p(original.d_baseFactory_p)
 , d_statContextCreator(original.d_statContextCreator)
+, d_zeroCopyThreshold(original.d_zeroCopyThreshold)
 , d_allocator_p(basicAllocator)
 {
     // NOTHING
 }
 
+// MANIPULATORS
+StatChannelFactoryConfig&
+StatChannelFactoryConfig::setZeroCopyThreshold(bsls::Types::Int64 value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value >= 0);
+
+    d_zeroCopyThreshold = value;
+    return *this;
+}
+
 // ------------------------------
 // class StatChannelFactoryHandle
 // ------------------------------
@@ -129,7 +142,10 @@ void StatChannelFactory::baseResultCallback(
     bsl::shared_ptr<StatChannel> newChannel;
     newChannel.createInplace(
         handleSp->d_allocator_p,
-        StatChannelConfig(channel, statContext, handleSp->d_allocator_p),
+        StatChannelConfig(channel,
+                          statContext,
+                          d_config.d_zeroCopyThreshold,
+                          handleSp->d_allocator_p),
         handleSp->d_allocator_p);
 
     handleSp->d_resultCallback(event, status, newChannel);
@@ -220,6 +236,7 @@ StatChannelFactoryUtil::statContextConfiguration(const bsl::string& name,
     config.isTable(true);
     config.value("in_bytes")
         .value("out_bytes")
+        .value("out_bytes_zc_eligible")
         .storeExpiredSubcontextValues(true);
 
     if (historySize != -1) {
@@ -268,6 +285,14 @@ void StatChannelFactoryUtil::initializeStatsTable(
                      StatChannel::Stat::e_BYTES_OUT,
                      mwcst::StatUtil::value,
                      start);
+    schema.addColumn("out_bytes_zc_eligible",
+                     StatChannel::Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT,
+                     mwcst::StatUtil::value,
+                     start);
+    schema.addColumn("out_writes",
+                     StatChannel::Stat::e_BYTES_OUT,
+                     mwcst::StatUtil::increments,
+                     start);
 
     if (!(end == mwcst::StatValue::SnapshotLocation())) {
         schema.addColumn("in_bytes_delta",
@@ -280,6 +305,16 @@ void StatChannelFactoryUtil::initializeStatsTable(
                          mwcst::StatUtil::valueDifference,
                          start,
                          end);
+        schema.addColumn("out_bytes_zc_eligible_delta",
+                         StatChannel::Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT,
+                         mwcst::StatUtil::valueDifference,
+                         start,
+                         end);
+        schema.addColumn("out_writes_delta",
+                         StatChannel::Stat::e_BYTES_OUT,
+                         mwcst::StatUtil::incrementsDifference,
+                         start,
+                         end);
     }
 
     // Configure records
@@ -316,6 +351,13 @@ void StatChannelFactoryUtil::initializeStatsTable(
             .printAsMemory();
     }
     tip->addColumn("out_bytes", "total").zeroString("").printAsMemory();
+    tip->addColumn("out_bytes_zc_eligible", "zc eligible")
+        .zeroString("")
+        .printAsMemory();
+    if (!(end == mwcst::StatValue::SnapshotLocation())) {
+        tip->addColumn("out_writes_delta", "writes delta").zeroString("");
+    }
+    tip->addColumn("out_writes", "writes").zeroString("");
 }
 
 bsls::Types::Int64
@@ -352,6 +394,21 @@ StatChannelFactoryUtil::getValue(const mwcst::StatContext& context,
     case Stat::e_BYTES_OUT_ABS: {
         return STAT_SINGLE(value, StatChannel::Stat::e_BYTES_OUT);
     }
+    case Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_DELTA: {
+        return STAT_RANGE(valueDifference,
+                          StatChannel::Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT);
+    }
+    case Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT_ABS: {
+        return STAT_SINGLE(value,
+                           StatChannel::Stat::e_ZERO_COPY_ELIGIBLE_BYTES_OUT);
+    }
+    case Stat::e_WRITES_OUT_DELTA: {
+        return STAT_RANGE(incrementsDifference,
+                          StatChannel::Stat::e_BYTES_OUT);
+    }
+    case Stat::e_WRITES_OUT_ABS: {
+        return STAT_SINGLE(increments, StatChannel::Stat::e_BYTES_OUT);
+    }
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
     }
@@ -57,6 +57,7 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_cpp11.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mwcio {
@@ -89,6 +90,11 @@ class StatChannelFactoryConfig {
 
     StatContextCreatorFn d_statContextCreator;
 
+    bsls::Types::Int64 d_zeroCopyThreshold;
+    // minimum size of a write for it to be sent
+    // using zero-copy by the channels of the base
+    // factory, or 0 if zero-copy is disabled
+
     bslma::Allocator* d_allocator_p;
 
     // FRIENDS
@@ -113,6 +119,16 @@ class StatChannelFactoryConfig {
 
     StatChannelFactoryConfig(const StatChannelFactoryConfig& original,
                              bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Set the minimum size of a write for it to be sent using zero-copy by
+    /// the channels of the base factory to the specified `value`, and
+    /// return a reference offering modifiable access to this object.  The
+    /// channels created by the factory use it to report the number of bytes
+    /// written with a write eligible to zero-copy (see `StatChannel`).  A
+    /// `value` of 0 (the default) means zero-copy is disabled.
+    StatChannelFactoryConfig& setZeroCopyThreshold(bsls::Types::Int64 value);
 };
 
 // ===============================
@@ -247,7 +263,11 @@ struct StatChannelFactoryUtil {
             e_BYTES_IN_DELTA,
             e_BYTES_IN_ABS,
             e_BYTES_OUT_DELTA,
-            e_BYTES_OUT_ABS
+            e_BYTES_OUT_ABS,
+            e_ZERO_COPY_ELIGIBLE_BYTES_OUT_DELTA,
+            e_ZERO_COPY_ELIGIBLE_BYTES_OUT_ABS,
+            e_WRITES_OUT_DELTA,
+            e_WRITES_OUT_ABS
         };
     };
 
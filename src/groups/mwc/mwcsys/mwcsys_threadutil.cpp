@@ -22,16 +22,22 @@
 
 // BDE
 #include <ball_log.h>
+#include <bdlb_numericparseutil.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cerrno.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bslma_default.h>
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
 // Linux
 #if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
 #include <sys/prctl.h>
 #endif
 
@@ -59,6 +65,93 @@ bslmt::ThreadAttributes ThreadUtil::defaultAttributes()
     return attributes;
 }
 
+int ThreadUtil::parseCpuList(bsl::vector<int>*  cpus,
+                             const bsl::string& cpuList)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_INVALID_INDEX = -1,
+        rc_INVALID_RANGE = -2
+    };
+
+    cpus->clear();
+
+    if (!cpuList.empty() && cpuList[cpuList.length() - 1] == ',') {
+        // Trailing comma, i.e. empty last item
+        return rc_INVALID_INDEX;  // RETURN
+    }
+
+    bsl::string::size_type pos = 0;
+    while (pos < cpuList.length()) {
+        bsl::string::size_type end = cpuList.find(',', pos);
+        if (end == bsl::string::npos) {
+            end = cpuList.length();
+        }
+
+        // Parse 'first[-last]'
+        const bslstl::StringRef item(cpuList.data() + pos, end - pos);
+        bslstl::StringRef       remainder;
+        int                     first = -1;
+        int                     last  = -1;
+        if (bdlb::NumericParseUtil::parseInt(&first, &remainder, item) !=
+                0 ||
+            first < 0) {
+            return rc_INVALID_INDEX;  // RETURN
+        }
+        last = first;
+        if (!remainder.empty()) {
+            const bslstl::StringRef lastStr(remainder.data() + 1,
+                                            remainder.length() - 1);
+            if (remainder[0] != '-' ||
+                bdlb::NumericParseUtil::parseInt(&last,
+                                                 &remainder,
+                                                 lastStr) != 0 ||
+                !remainder.empty() || last < first) {
+                return rc_INVALID_RANGE;  // RETURN
+            }
+        }
+        if (last >= k_MAX_NUM_CPUS) {
+            return rc_INVALID_RANGE;  // RETURN
+        }
+
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus->push_back(cpu);
+        }
+
+        pos = end + 1;
+    }
+
+    bsl::sort(cpus->begin(), cpus->end());
+    cpus->erase(bsl::unique(cpus->begin(), cpus->end()), cpus->end());
+
+    return rc_SUCCESS;
+}
+
+bsl::ostream& ThreadUtil::printCpuList(bsl::ostream&           stream,
+                                       const bsl::vector<int>& cpus)
+{
+    size_t i = 0;
+    while (i < cpus.size()) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            ++j;
+        }
+
+        stream << (i == 0 ? "" : ",") << cpus[i];
+        if (j != i) {
+            stream << "-" << cpus[j];
+        }
+
+        i = j + 1;
+    }
+
+    return stream;
+}
+
 // LINUX
 // -----
 #if defined(BSLS_PLATFORM_OS_LINUX)
@@ -95,12 +188,105 @@ void ThreadUtil::setCurrentThreadNameOnce(const bsl::string& value)
     }
 }
 
+const bool ThreadUtil::k_SUPPORT_THREAD_AFFINITY = true;
+
+const int ThreadUtil::k_MAX_NUM_CPUS = CPU_SETSIZE;
+
+int ThreadUtil::setCurrentThreadAffinity(const bsl::vector<int>& cpus)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!cpus.empty());
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE) {
+            BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+            BALL_LOG_ERROR << "Invalid CPU index for thread affinity "
+                           << "[cpu: " << cpus[i] << "]";
+            return -1;  // RETURN
+        }
+        CPU_SET(cpus[i], &cpuSet);
+    }
+
+    // A 'pid' of 0 designates the calling thread.
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        const int err = errno;
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR_BLOCK
+        {
+            BALL_LOG_OUTPUT_STREAM << "Failed to set thread affinity "
+                                   << "[cpus: '";
+            printCpuList(BALL_LOG_OUTPUT_STREAM, cpus)
+                << "', errno: " << err << ", strerr: '" << bsl::strerror(err)
+                << "']";
+        }
+        return -2;  // RETURN
+    }
+
+    return 0;
+}
+
+int ThreadUtil::loadCurrentThreadAffinity(bsl::vector<int>* cpus)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cpus);
+
+    cpus->clear();
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        return -1;  // RETURN
+    }
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            cpus->push_back(cpu);
+        }
+    }
+
+    return 0;
+}
+
+int ThreadUtil::numaNodeOfCpu(int cpu)
+{
+    // The kernel exposes the node of a CPU as a 'nodeN' link in the sysfs
+    // directory of that CPU.
+    const bsl::string pattern = "/sys/devices/system/cpu/cpu" +
+                                bsl::to_string(cpu) + "/node*";
+
+    bsl::vector<bsl::string> paths;
+    bdls::FilesystemUtil::findMatchingPaths(&paths, pattern.c_str());
+    if (paths.size() != 1) {
+        return -1;  // RETURN
+    }
+
+    const bsl::string::size_type pos = paths[0].rfind("node");
+    int                          node = -1;
+    bslstl::StringRef            remainder;
+    if (bdlb::NumericParseUtil::parseInt(
+            &node,
+            &remainder,
+            bslstl::StringRef(paths[0].data() + pos + 4,
+                              paths[0].length() - pos - 4)) != 0 ||
+        !remainder.empty()) {
+        return -1;  // RETURN
+    }
+
+    return node;
+}
+
 // UNSUPPORTED_PLATFORMS
 // ---------------------
 #else
 
 const bool ThreadUtil::k_SUPPORT_THREAD_NAME = false;
 
+const bool ThreadUtil::k_SUPPORT_THREAD_AFFINITY = false;
+
+const int ThreadUtil::k_MAX_NUM_CPUS = 1024;
+
 void ThreadUtil::setCurrentThreadName(
     BSLS_ANNOTATION_UNUSED const bsl::string& value)
 {
@@ -115,7 +301,65 @@ void ThreadUtil::setCurrentThreadNameOnce(
     // NOT AVAILABLE
 }
 
+int ThreadUtil::setCurrentThreadAffinity(
+    BSLS_ANNOTATION_UNUSED const bsl::vector<int>& cpus)
+{
+    // NOT AVAILABLE
+
+    return -1;
+}
+
+int ThreadUtil::loadCurrentThreadAffinity(bsl::vector<int>* cpus)
+{
+    // NOT AVAILABLE
+
+    cpus->clear();
+    return -1;
+}
+
+int ThreadUtil::numaNodeOfCpu(BSLS_ANNOTATION_UNUSED int cpu)
+{
+    // NOT AVAILABLE
+
+    return -1;
+}
+
 #endif
 
+// -------------------------
+// class ThreadAffinityGuard
+// -------------------------
+
+ThreadAffinityGuard::ThreadAffinityGuard(const bsl::vector<int>& cpus,
+                                         bslma::Allocator* basicAllocator)
+: d_previousCpus(basicAllocator)
+{
+    if (cpus.empty() || !ThreadUtil::k_SUPPORT_THREAD_AFFINITY) {
+        return;  // RETURN
+    }
+
+    bsl::vector<int> previousCpus(basicAllocator);
+    if (ThreadUtil::loadCurrentThreadAffinity(&previousCpus) != 0 ||
+        previousCpus.empty()) {
+        return;  // RETURN
+    }
+
+    if (ThreadUtil::setCurrentThreadAffinity(cpus) == 0) {
+        d_previousCpus.swap(previousCpus);
+    }
+}
+
+ThreadAffinityGuard::~ThreadAffinityGuard()
+{
+    if (isEngaged()) {
+        ThreadUtil::setCurrentThreadAffinity(d_previousCpus);
+    }
+}
+
+bool ThreadAffinityGuard::isEngaged() const
+{
+    return !d_previousCpus.empty();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
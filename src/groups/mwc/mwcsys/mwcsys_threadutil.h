@@ -20,12 +20,35 @@
 //@PURPOSE: Provide utilities related to thread management.
 //
 //@CLASSES:
-//  mwcsys::ThreadUtil: utilities related to thread management.
+//  mwcsys::ThreadUtil:          utilities related to thread management.
+//  mwcsys::ThreadAffinityGuard: scoped change of the current thread affinity
 //
 //@DESCRIPTION: 'mwcsys::ThreadUtil' provide a utility namespace for operations
-// related to thread management, such as naming threads.  Each operation may be
-// platform specific, please refer to the associated function documentation for
-// individual support explanation.
+// related to thread management, such as naming threads or pinning them to a
+// set of CPUs.  Each operation may be platform specific, please refer to the
+// associated function documentation for individual support explanation.
+//
+// 'mwcsys::ThreadAffinityGuard' restricts the current thread to a set of CPUs
+// for the duration of a scope, and restores its previous affinity on
+// destruction.  Because threads inherit the affinity of the thread creating
+// them, it is the way to pin the threads of a component (e.g., a thread pool)
+// which doesn't expose its threads: create them, typically by starting the
+// component, while such a guard is alive.
+//
+/// CPU sets
+///--------
+// CPU sets are represented as a sorted 'bsl::vector<int>' of CPU indices,
+// and are expressed in configuration using the Linux 'cpulist' format, i.e.,
+// a comma separated list of CPU indices and ranges of indices, such as
+// '0-3,8,10-11'.  CPU indices must be lower than 'k_MAX_NUM_CPUS', the
+// size of the CPU sets of the platform.
+//
+/// NUMA
+///----
+// On Linux, memory is by default allocated on the NUMA node of the CPU of the
+// thread first touching it, hence pinning a thread to the CPUs of a single
+// node also makes the memory it allocates and initializes local to that
+// node.  'numaNodeOfCpu' reports the node of a CPU.
 //
 /// NOTE
 ///----
@@ -37,8 +60,12 @@
 // MWC
 
 // BDE
+#include <bsl_ostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
 #include <bslmt_threadattributes.h>
+#include <bsls_keyword.h>
 
 namespace BloombergLP {
 namespace mwcsys {
@@ -55,6 +82,14 @@ struct ThreadUtil {
     /// naming thread.
     static const bool k_SUPPORT_THREAD_NAME;
 
+    /// Boolean constant indicating whether the current platform supports
+    /// setting the CPU affinity of threads.
+    static const bool k_SUPPORT_THREAD_AFFINITY;
+
+    /// Number of CPUs the CPU sets of the current platform can hold, i.e.,
+    /// upper bound (excluded) of the CPU indices accepted in a CPU list.
+    static const int k_MAX_NUM_CPUS;
+
     // CLASS METHODS
 
     /// Return `bslmt::ThreadAttributes` object pre-initialized with default
@@ -78,6 +113,77 @@ struct ThreadUtil {
     ///   - this functionality is only supported on LINUX, and the name can
     ///     be up to 15 characters.
     static void setCurrentThreadNameOnce(const bsl::string& value);
+
+    /// Load into the specified `cpus` the sorted set of CPU indices
+    /// described by the specified `cpuList`, in the Linux `cpulist` format
+    /// (e.g., `0-3,8,10-11`).  Return 0 on success, or a non-zero value if
+    /// `cpuList` is malformed, in which case `cpus` is left unspecified.
+    /// Note that an empty `cpuList` denotes an empty set.
+    static int parseCpuList(bsl::vector<int>*  cpus,
+                            const bsl::string& cpuList);
+
+    /// Print to the specified `stream` the specified sorted `cpus` in the
+    /// Linux `cpulist` format, collapsing consecutive indices into ranges,
+    /// and return `stream`.
+    static bsl::ostream& printCpuList(bsl::ostream&           stream,
+                                      const bsl::vector<int>& cpus);
+
+    /// Restrict the current thread to run on the specified `cpus`.  Return
+    /// 0 on success, or a non-zero value on error or if
+    /// `k_SUPPORT_THREAD_AFFINITY` is false.  The behavior is undefined
+    /// unless `cpus` is not empty.
+    static int setCurrentThreadAffinity(const bsl::vector<int>& cpus);
+
+    /// Load into the specified `cpus` the sorted set of CPUs the current
+    /// thread is allowed to run on.  Return 0 on success, or a non-zero
+    /// value on error or if `k_SUPPORT_THREAD_AFFINITY` is false.
+    static int loadCurrentThreadAffinity(bsl::vector<int>* cpus);
+
+    /// Return the NUMA node of the specified `cpu`, or -1 if it can't be
+    /// determined.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX.
+    static int numaNodeOfCpu(int cpu);
+};
+
+// =========================
+// class ThreadAffinityGuard
+// =========================
+
+/// Scoped guard restricting the current thread to a set of CPUs and
+/// restoring its previous affinity on destruction.
+class ThreadAffinityGuard {
+  private:
+    // DATA
+    bsl::vector<int> d_previousCpus;
+    // CPUs the thread was allowed to run on
+    // before this guard was created, empty if
+    // the affinity wasn't changed
+
+    // NOT IMPLEMENTED
+    ThreadAffinityGuard(const ThreadAffinityGuard&) BSLS_KEYWORD_DELETED;
+    ThreadAffinityGuard&
+    operator=(const ThreadAffinityGuard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Restrict the current thread to run on the specified `cpus`, unless
+    /// `cpus` is empty, until this object is destroyed.  Use the optionally
+    /// specified `basicAllocator` to supply memory.
+    explicit ThreadAffinityGuard(const bsl::vector<int>& cpus,
+                                 bslma::Allocator*       basicAllocator = 0);
+
+    /// Restore the affinity the current thread had at construction of this
+    /// object, if it was changed, and destroy this object.
+    ~ThreadAffinityGuard();
+
+    // ACCESSORS
+
+    /// Return `true` if the affinity of the current thread was changed by
+    /// this object, and `false` otherwise.
+    bool isEngaged() const;
 };
 
 }  // close package namespace
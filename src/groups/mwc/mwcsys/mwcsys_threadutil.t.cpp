@@ -0,0 +1,281 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcsys_threadutil.t.cpp                                            -*-C++-*-
+#include <mwcsys_threadutil.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   HELPER
+// ----------------------------------------------------------------------------
+
+/// Return the specified `cpus` printed in the Linux `cpulist` format.
+static bsl::string printCpus(const bsl::vector<int>& cpus)
+{
+    mwcu::MemOutStream os(s_allocator_p);
+    mwcsys::ThreadUtil::printCpuList(os, cpus);
+    return bsl::string(os.str(), s_allocator_p);
+}
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_parseCpuList()
+// ------------------------------------------------------------------------
+// PARSE CPU LIST
+//
+// Concerns:
+//   - An empty list denotes an empty set.
+//   - Indices and ranges are parsed, and the resulting set is sorted and
+//     free of duplicates, even if the list is not sorted or its items
+//     overlap.
+//   - Malformed lists (empty items, invalid indices, reversed or
+//     incomplete ranges, indices out of bounds) are rejected.
+//
+// Plan:
+//   Parse a few lists and compare the rc and the parsed sets, printed in
+//   the 'cpulist' format.
+//
+// Testing:
+//   parseCpuList
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PARSE CPU LIST");
+
+    struct Test {
+        int         d_line;      // Line
+        const char* d_cpuList;   // List to parse
+        bool        d_isValid;   // Whether the list is valid
+        const char* d_expected;  // Expected set, if valid
+    } k_DATA[] = {
+        // Valid lists
+        {L_, "", true, ""},
+        {L_, "0", true, "0"},
+        {L_, "0-3", true, "0-3"},
+        {L_, "5-5", true, "5"},
+        {L_, "3,1,2", true, "1-3"},
+        {L_, "0-3,2-5", true, "0-5"},
+        {L_, "8,0-1,1,8", true, "0-1,8"},
+        {L_, "10-11,8,0-3", true, "0-3,8,10-11"},
+
+        // Malformed lists
+        {L_, ",", false, ""},
+        {L_, "1,", false, ""},
+        {L_, ",1", false, ""},
+        {L_, "1,,2", false, ""},
+        {L_, "a", false, ""},
+        {L_, "1a", false, ""},
+        {L_, "-1", false, ""},
+        {L_, "1-", false, ""},
+        {L_, "3-1", false, ""},
+        {L_, "1-2-3", false, ""},
+        {L_, "1-a", false, ""},
+        {L_, "1:2", false, ""},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": parsing '" << test.d_cpuList << "'");
+
+        const bsl::string cpuList(test.d_cpuList, s_allocator_p);
+        bsl::vector<int>  cpus(s_allocator_p);
+        const int rc = mwcsys::ThreadUtil::parseCpuList(&cpus, cpuList);
+        ASSERT_EQ_D("line " << test.d_line, rc == 0, test.d_isValid);
+        if (test.d_isValid) {
+            ASSERT_EQ_D("line " << test.d_line,
+                        printCpus(cpus),
+                        test.d_expected);
+        }
+    }
+
+    PV("Bounds of the CPU indices");
+
+    const bsl::string lastCpu = bsl::to_string(
+        mwcsys::ThreadUtil::k_MAX_NUM_CPUS - 1);
+    const bsl::string tooLarge = bsl::to_string(
+        mwcsys::ThreadUtil::k_MAX_NUM_CPUS);
+
+    bsl::vector<int> cpus(s_allocator_p);
+    ASSERT_EQ(0, mwcsys::ThreadUtil::parseCpuList(&cpus, lastCpu));
+    ASSERT_EQ(printCpus(cpus), lastCpu);
+    ASSERT_EQ(0,
+              mwcsys::ThreadUtil::parseCpuList(&cpus, "0-" + lastCpu));
+    ASSERT_EQ(static_cast<size_t>(mwcsys::ThreadUtil::k_MAX_NUM_CPUS),
+              cpus.size());
+
+    ASSERT_NE(0, mwcsys::ThreadUtil::parseCpuList(&cpus, tooLarge));
+    ASSERT_NE(0,
+              mwcsys::ThreadUtil::parseCpuList(&cpus, "0-" + tooLarge));
+}
+
+static void test2_printCpuList()
+// ------------------------------------------------------------------------
+// PRINT CPU LIST
+//
+// Concerns:
+//   - Consecutive indices are collapsed into ranges, and isolated ones are
+//     printed alone.
+//   - Parsing a printed set yields the same set.
+//
+// Plan:
+//   Print a few sets, compare the output, and parse it back.
+//
+// Testing:
+//   printCpuList
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PRINT CPU LIST");
+
+    struct Test {
+        int         d_line;      // Line
+        int         d_cpus[8];   // Sorted set to print
+        size_t      d_numCpus;   // Number of CPUs in the set
+        const char* d_expected;  // Expected output
+    } k_DATA[] = {
+        {L_, {0}, 0, ""},
+        {L_, {0}, 1, "0"},
+        {L_, {7}, 1, "7"},
+        {L_, {0, 1}, 2, "0-1"},
+        {L_, {0, 1, 2, 3}, 4, "0-3"},
+        {L_, {0, 2, 4}, 3, "0,2,4"},
+        {L_, {0, 1, 3, 4, 5, 7}, 6, "0-1,3-5,7"},
+        {L_, {2, 8, 9, 10, 11, 20, 21}, 7, "2,8-11,20-21"},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        const bsl::vector<int> cpus(test.d_cpus,
+                                    test.d_cpus + test.d_numCpus,
+                                    s_allocator_p);
+
+        const bsl::string output = printCpus(cpus);
+        ASSERT_EQ_D("line " << test.d_line, output, test.d_expected);
+
+        bsl::vector<int> parsed(s_allocator_p);
+        ASSERT_EQ_D("line " << test.d_line,
+                    mwcsys::ThreadUtil::parseCpuList(&parsed, output),
+                    0);
+        ASSERT_EQ_D("line " << test.d_line, printCpus(parsed), output);
+        ASSERT_D("line " << test.d_line, parsed == cpus);
+    }
+}
+
+static void test3_threadAffinityGuard()
+// ------------------------------------------------------------------------
+// THREAD AFFINITY GUARD
+//
+// Concerns:
+//   - A guard created with an empty set leaves the affinity of the thread
+//     unchanged.
+//   - A guard restricts the thread to the specified set while it is alive,
+//     and restores its previous affinity on destruction.
+//   - A guard is a no-op if the platform doesn't support setting the
+//     affinity of threads.
+//
+// Plan:
+//   Create guards with an empty set, and with the last CPU the thread is
+//   allowed to run on, and check the affinity of the thread while they are
+//   alive and after their destruction.
+//
+// Testing:
+//   ThreadAffinityGuard
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("THREAD AFFINITY GUARD");
+
+    bsl::vector<int> initialCpus(s_allocator_p);
+    bsl::vector<int> cpus(s_allocator_p);
+
+    if (!mwcsys::ThreadUtil::k_SUPPORT_THREAD_AFFINITY) {
+        cpus.push_back(0);
+        mwcsys::ThreadAffinityGuard guard(cpus, s_allocator_p);
+        ASSERT(!guard.isEngaged());
+        return;  // RETURN
+    }
+
+    ASSERT_EQ(mwcsys::ThreadUtil::loadCurrentThreadAffinity(&initialCpus), 0);
+    ASSERT(!initialCpus.empty());
+    PV("Initial affinity: " << printCpus(initialCpus));
+
+    {
+        PV("Empty set");
+
+        mwcsys::ThreadAffinityGuard guard(cpus, s_allocator_p);
+        ASSERT(!guard.isEngaged());
+
+        ASSERT_EQ(mwcsys::ThreadUtil::loadCurrentThreadAffinity(&cpus), 0);
+        ASSERT_EQ(printCpus(cpus), printCpus(initialCpus));
+    }
+
+    {
+        PV("Single CPU");
+
+        bsl::vector<int> lastCpu(s_allocator_p);
+        lastCpu.push_back(initialCpus.back());
+        {
+            mwcsys::ThreadAffinityGuard guard(lastCpu, s_allocator_p);
+            ASSERT(guard.isEngaged());
+
+            ASSERT_EQ(mwcsys::ThreadUtil::loadCurrentThreadAffinity(&cpus),
+                      0);
+            ASSERT_EQ(printCpus(cpus), printCpus(lastCpu));
+        }
+
+        ASSERT_EQ(mwcsys::ThreadUtil::loadCurrentThreadAffinity(&cpus), 0);
+        ASSERT_EQ(printCpus(cpus), printCpus(initialCpus));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_threadAffinityGuard(); break;
+    case 2: test2_printCpuList(); break;
+    case 1: test1_parseCpuList(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
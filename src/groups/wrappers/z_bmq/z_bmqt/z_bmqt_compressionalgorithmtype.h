@@ -9,7 +9,13 @@ extern "C" {
 
 struct z_bmqt_CompressionAlgorithmType {
     // TYPES
-    enum Enum { ec_UNKNOWN = -1, ec_NONE = 0, ec_ZLIB = 1 };
+    enum Enum {
+        ec_UNKNOWN = -1,
+        ec_NONE    = 0,
+        ec_ZLIB    = 1,
+        ec_ZSTD    = 2,
+        ec_LZ4     = 3
+    };
 
     // CONSTANTS
 
@@ -21,7 +27,7 @@ struct z_bmqt_CompressionAlgorithmType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify that a
     /// header's `CompressionAlgorithmType` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_TYPE = ec_ZLIB;
+    static const int k_HIGHEST_SUPPORTED_TYPE = ec_LZ4;
 
     /// Return the non-modifiable string representation corresponding to the
     /// specified enumeration `value`, if it exists, and a unique (error)
@@ -348,6 +348,8 @@ void PrometheusStatConsumer::captureQueueStats()
                     {"queue_nack_noquorum_msgs",
                      Stat::e_NO_SC_MSGS_DELTA,
                      true},
+                    {"queue_gc_time_avg", Stat::e_GC_TIME_AVG, false},
+                    {"queue_gc_time_max", Stat::e_GC_TIME_MAX, false},
                 };
 
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
@@ -467,6 +469,9 @@ void PrometheusStatConsumer::captureBrokerStats()
     static const DatapointDef defs[] = {
         {"brkr_summary_queues_count", Stat::e_QUEUE_COUNT, false},
         {"brkr_summary_clients_count", Stat::e_CLIENT_COUNT, false},
+        {"brkr_dispatcher_migrations",
+         Stat::e_DISPATCHER_MIGRATIONS_DELTA,
+         true},
     };
 
     Tagger tagger;
@@ -614,6 +619,14 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                 prefix + "journal_outstanding_bytes";
             const bsl::string data_outstanding_bytes =
                 prefix + "data_outstanding_bytes";
+            const bsl::string sync_time_avg = prefix + "sync_time_avg";
+            const bsl::string sync_time_max = prefix + "sync_time_max";
+            const bsl::string sync_batch_bytes_avg =
+                prefix + "sync_batch_bytes_avg";
+            const bsl::string sync_count = prefix + "sync_count";
+            const bsl::string recovery_time = prefix + "recovery_time";
+            const bsl::string rollover_copy_time = prefix +
+                                                   "rollover_copy_time";
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(),
@@ -624,6 +637,24 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                  false},
                 {data_outstanding_bytes.c_str(),
                  mqbstat::ClusterStats::Stat::e_PARTITION_DATA_CONTENT,
+                 false},
+                {sync_time_avg.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_SYNC_TIME_AVG,
+                 false},
+                {sync_time_max.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_SYNC_TIME_MAX,
+                 false},
+                {sync_batch_bytes_avg.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_SYNC_BATCH_BYTES_AVG,
+                 false},
+                {sync_count.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_SYNC_COUNT,
+                 true},
+                {recovery_time.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_RECOVERY_TIME,
+                 false},
+                {rollover_copy_time.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_ROLLOVER_COPY_TIME,
                  false}};
 
             Tagger tagger;
@@ -642,6 +673,28 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                             dpIt->d_stat));
                 updateMetric(dpIt, tagger.getLabels(), value);
             }
+
+            // Iterate over each replica of the partition (e.g.,
+            // 'cluster_partition1_node3_replica_lag')
+            for (mwcst::StatContextIterator replicaIt =
+                     partitionIt->subcontextIterator();
+                 replicaIt;
+                 ++replicaIt) {
+                const bsl::string replica_lag = prefix + replicaIt->name() +
+                                                "_replica_lag";
+                const DatapointDef replicaDef = {
+                    replica_lag.c_str(),
+                    mqbstat::ClusterStats::Stat::e_PARTITION_REPLICA_LAG_MAX,
+                    false};
+
+                const bsls::Types::Int64 value =
+                    mqbstat::ClusterStats::getValue(
+                        *replicaIt,
+                        d_snapshotId,
+                        mqbstat::ClusterStats::Stat::
+                            e_PARTITION_REPLICA_LAG_MAX);
+                updateMetric(&replicaDef, tagger.getLabels(), value);
+            }
         }
     }
 }
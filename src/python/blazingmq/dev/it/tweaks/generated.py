@@ -525,6 +525,36 @@ class TweakFactory:
                             ...
                     use_ntf = UseNtf()
                     
+                    class ZeroCopyThreshold(metaclass=TweakMetaclass):
+                    
+                        def __call__(self, value: int) -> Callable:
+                            ...
+                    zero_copy_threshold = ZeroCopyThreshold()
+                    
+                    class FlushPolicy(metaclass=TweakMetaclass):
+                    
+                        def __call__(self, value: blazingmq.schemas.mqbcfg.ClientFlushPolicy) -> Callable:
+                            ...
+                    flush_policy = FlushPolicy()
+                    
+                    class FlushMaxBytes(metaclass=TweakMetaclass):
+                    
+                        def __call__(self, value: int) -> Callable:
+                            ...
+                    flush_max_bytes = FlushMaxBytes()
+                    
+                    class FlushMaxDelayUs(metaclass=TweakMetaclass):
+                    
+                        def __call__(self, value: int) -> Callable:
+                            ...
+                    flush_max_delay_us = FlushMaxDelayUs()
+                    
+                    class FlushRateThreshold(metaclass=TweakMetaclass):
+                    
+                        def __call__(self, value: int) -> Callable:
+                            ...
+                    flush_rate_threshold = FlushRateThreshold()
+                    
                 
                     def __call__(self, value: typing.Union[blazingmq.schemas.mqbcfg.TcpInterfaceConfig,NoneType]) -> Callable:
                         ...
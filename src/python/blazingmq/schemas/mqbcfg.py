@@ -24,6 +24,26 @@ class BmqconfConfig:
     )
 
 
+class ClientFlushPolicy(Enum):
+    """Enumeration of the policies used by a client session to decide when
+    to flush the PUSH and ACK messages it coalesces.
+
+    E_LATENCY............: flush as soon as the session has no more
+    events to process
+    E_THROUGHPUT.........: coalesce messages until 'flushMaxBytes' are
+    pending or the oldest pending message has
+    waited for 'flushMaxDelayUs'
+    E_ADAPTIVE...........: behave as 'E_LATENCY' at low message rates,
+    and as 'E_THROUGHPUT' once the rate of
+    messages reaches 'flushRateThreshold' per
+    second
+    """
+
+    E_LATENCY = "E_LATENCY"
+    E_THROUGHPUT = "E_THROUGHPUT"
+    E_ADAPTIVE = "E_ADAPTIVE"
+
+
 @dataclass
 class ClusterAttributes:
     """Type representing the attributes specific to a cluster.
@@ -166,6 +186,17 @@ class ClusterMonitorConfig:
 
 @dataclass
 class DispatcherProcessorParameters:
+    """queueSize..................: capacity of the queue of each processor
+    queueSizeLowWatermark......: queue size below which the queue is
+    considered back to normal
+    queueSizeHighWatermark.....: queue size above which an alarm is raised
+    useLockFreeQueue...........: use a lock-free ring buffer as the queue
+    of each processor instead of the default queue.  The ring holds
+    'queueSize' events, rounded up to a power of two; beyond that, events
+    spill to an unbounded overflow list, so that, like the default queue,
+    the queue is not bounded by 'queueSize'
+    """
+
     queue_size: Optional[int] = field(
         default=None,
         metadata={
@@ -193,6 +224,15 @@ class DispatcherProcessorParameters:
             "required": True,
         },
     )
+    use_lock_free_queue: bool = field(
+        default=False,
+        metadata={
+            "name": "useLockFreeQueue",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -900,6 +940,22 @@ class StorageSyncConfig:
     )
 
 
+class StorageWriteBackend(Enum):
+    """Enumeration of the mechanisms used to write back the partition files.
+
+    E_MMAP...............: records are written to the memory mapped files
+    and written back to disk by the kernel's page
+    cache writeback
+    E_ASYNC_WRITEBACK....: records are written to the memory mapped files
+    and the dirty ranges are proactively written
+    back to disk by a dedicated thread, with
+    completions delivered to the partition thread
+    """
+
+    E_MMAP = "E_MMAP"
+    E_ASYNC_WRITEBACK = "E_ASYNC_WRITEBACK"
+
+
 @dataclass
 class SyslogConfig:
     enabled: bool = field(
@@ -971,6 +1027,10 @@ class TcpInterfaceConfig:
     useNtf...............:
     Use the new NTF based TCP transport library instead of
     the existing one based on BTE
+    zeroCopyThreshold....:
+    Minimum size (in bytes) of a write for it to be sent using
+    zero-copy ('MSG_ZEROCOPY'), if supported by the platform.  0 to
+    disable.
     """
 
     name: Optional[str] = field(
@@ -1061,6 +1121,111 @@ class TcpInterfaceConfig:
             "required": True,
         },
     )
+    zero_copy_threshold: int = field(
+        default=0,
+        metadata={
+            "name": "zeroCopyThreshold",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    flush_policy: ClientFlushPolicy = field(
+        default=ClientFlushPolicy.E_LATENCY,
+        metadata={
+            "name": "flushPolicy",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    flush_max_bytes: int = field(
+        default=1048576,
+        metadata={
+            "name": "flushMaxBytes",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    flush_max_delay_us: int = field(
+        default=1000,
+        metadata={
+            "name": "flushMaxDelayUs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    flush_rate_threshold: int = field(
+        default=10000,
+        metadata={
+            "name": "flushRateThreshold",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+
+
+@dataclass
+class ThreadPlacementConfig:
+    """Placement of the broker threads on the CPUs of the host.
+
+    Each element is a set of CPUs, in the Linux 'cpulist' format (e.g.,
+    '0-3,8'), the corresponding threads are restricted to; an empty
+    value leaves the threads unpinned.  Memory being allocated on the
+    NUMA node of the thread first touching it, the CPUs of a set should
+    belong to a single NUMA node.  The effective placement, and the NUMA
+    nodes it spans, is reported by the 'BROKERCONFIG DUMP' command.
+    sessions..: dispatcher processors of the client sessions
+    queues....: dispatcher processors of the queues
+    clusters..: dispatcher processors of the clusters
+    ioThreads.: IO threads of the network channel factories
+    scheduler.: thread of the event scheduler
+    """
+
+    sessions: Optional[str] = field(
+        default=None,
+        metadata={
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    queues: Optional[str] = field(
+        default=None,
+        metadata={
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    clusters: Optional[str] = field(
+        default=None,
+        metadata={
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    io_threads: Optional[str] = field(
+        default=None,
+        metadata={
+            "name": "ioThreads",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    scheduler: Optional[str] = field(
+        default=None,
+        metadata={
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1129,6 +1294,24 @@ class DispatcherProcessorConfig:
             "required": True,
         },
     )
+    rebalance_interval_ms: int = field(
+        default=0,
+        metadata={
+            "name": "rebalanceIntervalMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    rebalance_threshold_percent: int = field(
+        default=20,
+        metadata={
+            "name": "rebalanceThresholdPercent",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1263,6 +1446,45 @@ class PartitionConfig:
     storage files to disk at shutdown
     syncConfig...........: configuration for storage synchronization and
     recovery
+    writeBackend.........: mechanism used to write back dirty pages of the
+    partition files to disk
+    syncBeforeReceipt....: flag to indicate whether a message is receipted
+    only after its record has been durably synced
+    to disk (requires 'E_ASYNC_WRITEBACK' write
+    backend)
+    groupCommitMaxDelayMs: maximum time, in milliseconds, a durable sync
+    is delayed in order to batch more records into
+    it (0 means no delay)
+    groupCommitMaxBytes..: number of unsynced bytes which triggers a
+    durable sync without waiting for
+    'groupCommitMaxDelayMs'
+    indexSnapshotIntervalMs: minimum interval, in milliseconds, between
+    two snapshots of the in-memory index of a
+    partition, used to only replay the tail of the
+    journal at startup (0 means no snapshot)
+    coldTierLocation.....: location of the cold tier files, to which the
+    payloads of old messages are offloaded from
+    the data file at rollover (empty means no
+    cold tier; a cold tier is only supported
+    by a cluster having one node)
+    coldTierMinAgeSeconds: minimum age, in seconds, of a message for its
+    payload to be offloaded to the cold tier at
+    rollover (0 means that payloads are offloaded
+    only when the data file would otherwise be
+    too full to roll over)
+    replicationBatchSize.: number of records batched into one storage
+    event replicated to the replicas (0 means
+    that the batch size adapts to the load of
+    the cluster channels, 1 favors latency and
+    larger values favor throughput)
+    replicationBatchingThreshold:
+    number of records replicated since the oldest
+    message still waiting for its Receipts beyond
+    which records are batched, up to the largest
+    batch, until Receipts arrive (this is not a
+    bound on the records in flight, as full
+    batches and SyncPts are still replicated; 0
+    means no threshold)
     """
 
     num_partitions: Optional[int] = field(
@@ -1362,6 +1584,87 @@ class PartitionConfig:
             "required": True,
         },
     )
+    write_backend: StorageWriteBackend = field(
+        default=StorageWriteBackend.E_MMAP,
+        metadata={
+            "name": "writeBackend",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    sync_before_receipt: bool = field(
+        default=False,
+        metadata={
+            "name": "syncBeforeReceipt",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_delay_ms: int = field(
+        default=0,
+        metadata={
+            "name": "groupCommitMaxDelayMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_bytes: int = field(
+        default=1048576,
+        metadata={
+            "name": "groupCommitMaxBytes",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    index_snapshot_interval_ms: int = field(
+        default=0,
+        metadata={
+            "name": "indexSnapshotIntervalMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    cold_tier_location: str = field(
+        default="",
+        metadata={
+            "name": "coldTierLocation",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    cold_tier_min_age_seconds: int = field(
+        default=0,
+        metadata={
+            "name": "coldTierMinAgeSeconds",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    replication_batch_size: int = field(
+        default=0,
+        metadata={
+            "name": "replicationBatchSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    replication_batching_threshold: int = field(
+        default=0,
+        metadata={
+            "name": "replicationBatchingThreshold",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1808,7 +2111,8 @@ class AppConfig:
     bmqconfConfig........: configuration for bmqconf
     plugins..............: configuration for the plugins
     msgPropertiesSupport.: information about if/how to advertise support for v2 message properties
-    configureStream......: send new ConfigureStream instead of old ConfigureQueue/&gt;
+    configureStream......: send new ConfigureStream instead of old ConfigureQueue
+    threadPlacement......: placement of the broker threads on the CPUs of the host/&gt;
     """
 
     broker_instance_name: Optional[str] = field(
@@ -1962,6 +2266,15 @@ class AppConfig:
             "required": True,
         },
     )
+    thread_placement: Optional[ThreadPlacementConfig] = field(
+        default=None,
+        metadata={
+            "name": "threadPlacement",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass